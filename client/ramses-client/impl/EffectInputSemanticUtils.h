@@ -95,6 +95,8 @@ namespace ramses
                 return ramses_internal::EFixedSemantics_TextPositionsAttribute;
             case EEffectAttributeSemantic_TextTextureCoordinates:
                 return ramses_internal::EFixedSemantics_TextTextureCoordinatesAttribute;
+            case EEffectAttributeSemantic_InstanceWorldMatrix:
+                return ramses_internal::EFixedSemantics_InstanceWorldMatrixAttribute;
             default:
                 return ramses_internal::EFixedSemantics_Invalid;
             }
@@ -108,6 +110,8 @@ namespace ramses
                 return EEffectAttributeSemantic_TextPositions;
             case ramses_internal::EFixedSemantics_TextTextureCoordinatesAttribute:
                 return EEffectAttributeSemantic_TextTextureCoordinates;
+            case ramses_internal::EFixedSemantics_InstanceWorldMatrixAttribute:
+                return EEffectAttributeSemantic_InstanceWorldMatrix;
             case ramses_internal::EFixedSemantics_Invalid:
                 return EEffectAttributeSemantic_Invalid;
             default:
@@ -128,6 +132,7 @@ namespace ramses
             case ramses_internal::EFixedSemantics_VertexCustomAttribute:
             case ramses_internal::EFixedSemantics_TextPositionsAttribute:
             case ramses_internal::EFixedSemantics_TextTextureCoordinatesAttribute:
+            case ramses_internal::EFixedSemantics_InstanceWorldMatrixAttribute:
                 return true;
             default:
                 return false;
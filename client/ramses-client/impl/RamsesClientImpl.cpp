@@ -54,6 +54,7 @@
 #include "Components/ResourcePersistation.h"
 #include "Components/ManagedResource.h"
 #include "Components/ResourceTableOfContents.h"
+#include "Components/ResourceFileInputStream.h"
 #include "Animation/AnimationSystemFactory.h"
 #include "Resource/ArrayResource.h"
 #include "Resource/EffectResource.h"
@@ -70,6 +71,7 @@
 #include "Collections/IInputStream.h"
 #include "Collections/String.h"
 #include "Collections/HashMap.h"
+#include "Collections/HashSet.h"
 #include "PlatformAbstraction/PlatformTime.h"
 #include "PlatformAbstraction/PlatformGuard.h"
 #include "Utils/LogMacros.h"
@@ -77,6 +79,7 @@
 
 #include "PlatformAbstraction/PlatformTypes.h"
 #include <array>
+#include <algorithm>
 
 namespace ramses
 {
@@ -260,6 +263,7 @@ namespace ramses
         TextureUtils::FillMipDataSizes(texDesc.m_dataSizes, mipMapCount, mipLevelData);
 
         ramses_internal::TextureResource* resource = new ramses_internal::TextureResource(textureType, texDesc, ramses_internal::ResourceCacheFlag(cacheFlag.getValue()), name);
+        resource->setChunkedHashingThreshold(m_framework.getChunkedHashingThreshold());
         TextureUtils::FillMipData(static_cast<uint8_t*>(const_cast<void*>(resource->getData())), mipMapCount, mipLevelData);
 
         return resource;
@@ -330,7 +334,8 @@ namespace ramses
 
     ArrayResourceImpl& RamsesClientImpl::createArrayResourceImpl(uint32_t count, const ramses_internal::Byte* arrayData, resourceCacheFlag_t cacheFlag, const char* name, ramses_internal::EDataType elementType, ERamsesObjectType objectType, ramses_internal::EResourceType resourceType)
     {
-        const auto* resource = new ramses_internal::ArrayResource(resourceType, count, elementType, arrayData, ramses_internal::ResourceCacheFlag(cacheFlag.getValue()), name);
+        auto* resource = new ramses_internal::ArrayResource(resourceType, count, elementType, arrayData, ramses_internal::ResourceCacheFlag(cacheFlag.getValue()), name);
+        resource->setChunkedHashingThreshold(m_framework.getChunkedHashingThreshold());
         ramses_internal::ManagedResource res = manageResource(resource);
         ramses_internal::ResourceHashUsage usage = m_appLogic.getHashUsage(res.getResourceObject()->getHash());
         ArrayResourceImpl& pimpl = *new ArrayResourceImpl(usage, objectType, *this, name);
@@ -436,6 +441,99 @@ namespace ramses
         return indexArray;
     }
 
+    ArrayResourceImpl* RamsesClientImpl::createUpdatedArrayResourceImpl(const ArrayResourceImpl& baseArray, uint32_t firstElement, uint32_t count, const ramses_internal::Byte* arrayData, resourceCacheFlag_t cacheFlag, const char* name)
+    {
+        if (!validateArray(count, arrayData))
+        {
+            return NULL;
+        }
+        if (&baseArray.getClientImpl() != this)
+        {
+            LOG_ERROR(ramses_internal::CONTEXT_CLIENT, "RamsesClient::createUpdatedArray Base array must be created by this client!");
+            return NULL;
+        }
+        const uint32_t elementCount = baseArray.getElementCount();
+        if (firstElement >= elementCount || count > elementCount - firstElement)
+        {
+            LOG_ERROR(ramses_internal::CONTEXT_CLIENT, "RamsesClient::createUpdatedArray Updated elements [" << firstElement << ", " << firstElement + count << ") exceed base array size " << elementCount << "!");
+            return NULL;
+        }
+
+        const ramses_internal::ResourceContentHash baseHash = baseArray.getLowlevelResourceHash();
+        ramses_internal::ManagedResource baseResource = getResource_ThreadSafe(baseHash);
+        if (baseResource.getResourceObject() == NULL)
+        {
+            baseResource = forceLoadResource_ThreadSafe(baseHash);
+            if (baseResource.getResourceObject() == NULL)
+            {
+                LOG_ERROR(ramses_internal::CONTEXT_CLIENT, "RamsesClient::createUpdatedArray Could not get data of base array!");
+                return NULL;
+            }
+        }
+
+        const ramses_internal::IResource& baseResourceObject = *baseResource.getResourceObject();
+        baseResourceObject.decompress();
+        const ramses_internal::EDataType elementType = baseArray.getElementType();
+        const uint32_t elementSize = ramses_internal::EnumToSize(elementType);
+        std::vector<ramses_internal::Byte> data(baseResourceObject.getResourceData()->getRawData(), baseResourceObject.getResourceData()->getRawData() + elementCount * elementSize);
+        ramses_internal::PlatformMemory::Copy(data.data() + firstElement * elementSize, arrayData, count * elementSize);
+
+        auto* resource = new ramses_internal::ArrayResource(baseResourceObject.getTypeID(), elementCount, elementType, data.data(), ramses_internal::ResourceCacheFlag(cacheFlag.getValue()), name);
+        resource->setDeltaInfo(ramses_internal::ResourceDeltaInfo(baseHash, firstElement * elementSize, count * elementSize));
+        resource->setChunkedHashingThreshold(m_framework.getChunkedHashingThreshold());
+        ramses_internal::ManagedResource res = manageResource(resource);
+        ramses_internal::ResourceHashUsage usage = m_appLogic.getHashUsage(res.getResourceObject()->getHash());
+        ArrayResourceImpl* pimpl = new ArrayResourceImpl(usage, baseArray.getType(), *this, name);
+        pimpl->initializeFromFrameworkData(elementCount, elementType);
+
+        return pimpl;
+    }
+
+    template <typename ArrayType, typename ElementType>
+    const ArrayType* RamsesClientImpl::createUpdatedConstArray(const ArrayType& baseArray, uint32_t firstElement, uint32_t count, const ElementType* arrayData, resourceCacheFlag_t cacheFlag, const char* name)
+    {
+        ArrayResourceImpl* pimpl = createUpdatedArrayResourceImpl(baseArray.impl, firstElement, count, reinterpret_cast<const ramses_internal::Byte*>(arrayData), cacheFlag, name);
+        if (pimpl == NULL)
+        {
+            return NULL;
+        }
+
+        ArrayType* array = new ArrayType(*pimpl);
+        addResourceObjectToRegistry_ThreadSafe(*array);
+
+        return array;
+    }
+
+    const FloatArray* RamsesClientImpl::createUpdatedConstFloatArray(const FloatArray& baseArray, uint32_t firstElement, uint32_t count, const float* arrayData, resourceCacheFlag_t cacheFlag, const char* name)
+    {
+        return createUpdatedConstArray(baseArray, firstElement, count, arrayData, cacheFlag, name);
+    }
+
+    const Vector2fArray* RamsesClientImpl::createUpdatedConstVector2fArray(const Vector2fArray& baseArray, uint32_t firstElement, uint32_t count, const float* arrayData, resourceCacheFlag_t cacheFlag, const char* name)
+    {
+        return createUpdatedConstArray(baseArray, firstElement, count, arrayData, cacheFlag, name);
+    }
+
+    const Vector3fArray* RamsesClientImpl::createUpdatedConstVector3fArray(const Vector3fArray& baseArray, uint32_t firstElement, uint32_t count, const float* arrayData, resourceCacheFlag_t cacheFlag, const char* name)
+    {
+        return createUpdatedConstArray(baseArray, firstElement, count, arrayData, cacheFlag, name);
+    }
+
+    const Vector4fArray* RamsesClientImpl::createUpdatedConstVector4fArray(const Vector4fArray& baseArray, uint32_t firstElement, uint32_t count, const float* arrayData, resourceCacheFlag_t cacheFlag, const char* name)
+    {
+        return createUpdatedConstArray(baseArray, firstElement, count, arrayData, cacheFlag, name);
+    }
+
+    const UInt16Array* RamsesClientImpl::createUpdatedConstUInt16Array(const UInt16Array& baseArray, uint32_t firstElement, uint32_t count, const uint16_t* arrayData, resourceCacheFlag_t cacheFlag, const char* name)
+    {
+        return createUpdatedConstArray(baseArray, firstElement, count, arrayData, cacheFlag, name);
+    }
+
+    const UInt32Array* RamsesClientImpl::createUpdatedConstUInt32Array(const UInt32Array& baseArray, uint32_t firstElement, uint32_t count, const uint32_t* arrayData, resourceCacheFlag_t cacheFlag, const char* name)
+    {
+        return createUpdatedConstArray(baseArray, firstElement, count, arrayData, cacheFlag, name);
+    }
+
     status_t RamsesClientImpl::writeResourcesToFile(const ResourceFileDescription& fileDescription, bool compress) const
     {
         LOG_DEBUG(ramses_internal::CONTEXT_CLIENT, "RamsesClient::writeResourcesToFile:  " << fileDescription.getFilename());
@@ -751,6 +849,28 @@ namespace ramses
         return StatusOK;
     }
 
+    status_t RamsesClientImpl::readLowLevelResourceTableOfContents(ramses_internal::BinaryFileInputStream& inputStream, const ramses_internal::String& resourceFilename, ramses_internal::ResourceTableOfContents& toc) const
+    {
+        const ramses_internal::String fileInfo = ramses_internal::String("resource file '") + resourceFilename + ramses_internal::String("'");
+        if (inputStream.getState() != ramses_internal::EStatus_RAMSES_OK || !ReadRamsesVersionAndPrintWarningOnMismatch(inputStream, fileInfo))
+        {
+            return addErrorEntry((ramses_internal::StringOutputStream() << "RamsesClient::readLowLevelResourceTableOfContents '" << resourceFilename << "' failed, file is invalid").c_str());
+        }
+
+        uint64_t offsetForHLResources = 0;
+        uint64_t offsetForLLResourceBlock = 0;
+        inputStream >> offsetForHLResources;
+        inputStream >> offsetForLLResourceBlock;
+        inputStream.seek(static_cast<ramses_internal::Int>(offsetForLLResourceBlock), ramses_internal::EFileSeekOrigin_BeginningOfFile);
+
+        if (!toc.readTOCPosAndTOCFromStream(inputStream))
+        {
+            return addErrorEntry((ramses_internal::StringOutputStream() << "RamsesClient::readLowLevelResourceTableOfContents '" << resourceFilename << "' failed, file is invalid").c_str());
+        }
+
+        return StatusOK;
+    }
+
     ramses_internal::ManagedResource RamsesClientImpl::getResource(ramses_internal::ResourceContentHash hash) const
     {
         return m_appLogic.getResource(hash);
@@ -955,6 +1075,141 @@ namespace ramses
         return StatusOK;
     }
 
+    status_t RamsesClientImpl::packResourceFiles(const ramses_internal::Vector<ramses_internal::String>& inputFilenames, const ramses_internal::String& outputFilename, bool compress, bool appendToOutputFile)
+    {
+        LOG_DEBUG(ramses_internal::CONTEXT_CLIENT, "RamsesClient::packResourceFiles:  " << outputFilename);
+
+        if (getClientApplication().hasResourceFile(outputFilename))
+        {
+            return addErrorEntry("Cannot pack resources to file, its already opened by the client.");
+        }
+
+        ramses_internal::File outputResources(outputFilename);
+        const bool append = appendToOutputFile && outputResources.exists();
+
+        // LL resources of output file stay where they are, its HL resources are loaded to be written again together with new ones
+        ramses_internal::ResourceTableOfContents outputTOC;
+        ramses_internal::UInt bytesForVersion = 0;
+        ramses_internal::UInt appendOffset = 0;
+        if (append)
+        {
+            CHECK_RETURN_ERR(readResourcesFromFile(outputFilename));
+            CHECK_RETURN_ERR(closeResourceFile(outputFilename));
+            ramses_internal::ResourceFileInputStream outputFileStream(outputFilename);
+            CHECK_RETURN_ERR(readLowLevelResourceTableOfContents(outputFileStream.resourceStream, outputFilename, outputTOC));
+
+            // offsets to HL and LL resources directly follow the version
+            ramses_internal::RamsesVersion::VersionInfo outputFileVersion;
+            outputFileStream.resourceStream.seek(0, ramses_internal::EFileSeekOrigin_BeginningOfFile);
+            ramses_internal::RamsesVersion::ReadFromStream(outputFileStream.resourceStream, outputFileVersion);
+            outputFileStream.resourceStream.getPos(bytesForVersion);
+            uint64_t offsetForHLResources = 0;
+            outputFileStream.resourceStream >> offsetForHLResources;
+
+            // if HL resources and TOC follow all LL resources, as written by packer, they are overwritten by appended resources
+            // and written again afterwards, they grow with every append so no stale bytes remain at the end of file,
+            // otherwise previous HL resources and TOC stay in the file unreferenced
+            ramses_internal::UInt endOfLLResources = 0;
+            for (const auto& tocEntry : outputTOC.getFileContents())
+            {
+                endOfLLResources = std::max<ramses_internal::UInt>(endOfLLResources, tocEntry.value.offsetInBytes + tocEntry.value.sizeInBytes);
+            }
+            if (offsetForHLResources >= endOfLLResources)
+            {
+                appendOffset = static_cast<ramses_internal::UInt>(offsetForHLResources);
+            }
+            else
+            {
+                outputResources.getSizeInBytes(appendOffset);
+            }
+        }
+
+        struct ResourceToCopy
+        {
+            ramses_internal::BinaryFileInputStream* inputStream;
+            ramses_internal::ResourceFileEntry fileEntry;
+        };
+        ramses_internal::Vector<ramses_internal::ResourceFileInputStreamSPtr> inputFileStreams;
+        ramses_internal::Vector<ResourceToCopy> resourcesToCopy;
+        ramses_internal::HashSet<ramses_internal::ResourceContentHash> hashesToCopy;
+        for (const auto& inputFilename : inputFilenames)
+        {
+            CHECK_RETURN_ERR(readResourcesFromFile(inputFilename));
+
+            ramses_internal::ResourceFileInputStreamSPtr inputFileStream(new ramses_internal::ResourceFileInputStream(inputFilename));
+            ramses_internal::ResourceTableOfContents inputTOC;
+            CHECK_RETURN_ERR(readLowLevelResourceTableOfContents(inputFileStream->resourceStream, inputFilename, inputTOC));
+            inputFileStreams.push_back(inputFileStream);
+
+            // resource contained in multiple files is copied only once, resources of one file are copied in order of their offset
+            const ramses_internal::UInt firstResourceOfFile = resourcesToCopy.size();
+            for (const auto& tocEntry : inputTOC.getFileContents())
+            {
+                if (!outputTOC.containsResource(tocEntry.key) && !hashesToCopy.hasElement(tocEntry.key))
+                {
+                    hashesToCopy.put(tocEntry.key);
+                    resourcesToCopy.push_back({ &inputFileStream->resourceStream, tocEntry.value });
+                }
+            }
+            std::sort(resourcesToCopy.begin() + firstResourceOfFile, resourcesToCopy.end(), [](const ResourceToCopy& lhs, const ResourceToCopy& rhs)
+            {
+                return lhs.fileEntry.offsetInBytes < rhs.fileEntry.offsetInBytes;
+            });
+        }
+
+        ramses_internal::BinaryFileOutputStream resourceOutputStream(outputResources, append ? ramses_internal::EFileMode_WriteExistingBinary : ramses_internal::EFileMode_WriteNewBinary);
+        if (!outputResources.isOpen())
+        {
+            return addErrorEntry("Could not open file for writing resources");
+        }
+
+        // HL resources and TOC are written at the end of the file after copied LL resources,
+        // TOC has to follow HL resources directly as it is read right after them
+        if (append)
+        {
+            resourceOutputStream.seek(static_cast<ramses_internal::Int>(appendOffset), ramses_internal::EFileSeekOrigin_BeginningOfFile);
+        }
+        else
+        {
+            WriteCurrentBuildVersionToStream(resourceOutputStream);
+            resourceOutputStream.getPos(bytesForVersion);
+            resourceOutputStream << static_cast<uint64_t>(0u) << static_cast<uint64_t>(0u);
+        }
+
+        for (const auto& resource : resourcesToCopy)
+        {
+            ramses_internal::ResourcePersistation::CopyResourceToStream(*resource.inputStream, resource.fileEntry, resourceOutputStream, outputTOC, compress);
+        }
+
+        ResourceObjects resources;
+        for (const auto& resourceObject : getListOfResourceObjects())
+        {
+            const Resource& resource = RamsesObjectTypeUtils::ConvertTo<Resource>(*resourceObject);
+            if (outputTOC.containsResource(resource.impl.getLowlevelResourceHash()))
+            {
+                resources.push_back(&resource);
+            }
+        }
+
+        ramses_internal::UInt offsetHLResourcesStart = 0;
+        resourceOutputStream.getPos(offsetHLResourcesStart);
+        CHECK_RETURN_ERR(writeHLResourcesToStream(resourceOutputStream, resources));
+        ramses_internal::UInt offsetLLResourcesStart = 0;
+        resourceOutputStream.getPos(offsetLLResourcesStart);
+        outputTOC.writeTOCToStream(resourceOutputStream);
+
+        resourceOutputStream.seek(static_cast<ramses_internal::Int>(bytesForVersion), ramses_internal::EFileSeekOrigin_BeginningOfFile);
+        resourceOutputStream << static_cast<uint64_t>(offsetHLResourcesStart);
+        resourceOutputStream << static_cast<uint64_t>(offsetLLResourcesStart);
+
+        if (resourceOutputStream.getState() != ramses_internal::EStatus_RAMSES_OK)
+        {
+            return addErrorEntry("Could not write resource file");
+        }
+
+        return StatusOK;
+    }
+
     status_t RamsesClientImpl::loadResourcesAsync(const ResourceFileDescription& fileDescription)
     {
         ramses_internal::Vector<ramses_internal::String> filenames;
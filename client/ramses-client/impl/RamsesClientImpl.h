@@ -52,6 +52,7 @@ namespace ramses_internal
     class BinaryFileOutputStream;
     class BinaryFileInputStream;
     class ClientScene;
+    class ResourceTableOfContents;
 }
 
 namespace ramses
@@ -111,6 +112,12 @@ namespace ramses
         const Vector4fArray* createConstVector4fArray(uint32_t count, const float* arrayData, resourceCacheFlag_t cacheFlag, const char* name);
         const UInt16Array* createConstUInt16Array(uint32_t count, const uint16_t *arrayData, resourceCacheFlag_t cacheFlag, const char* name);
         const UInt32Array* createConstUInt32Array(uint32_t count, const uint32_t *arrayData, resourceCacheFlag_t cacheFlag, const char* name);
+        const FloatArray* createUpdatedConstFloatArray(const FloatArray& baseArray, uint32_t firstElement, uint32_t count, const float* arrayData, resourceCacheFlag_t cacheFlag, const char* name);
+        const Vector2fArray* createUpdatedConstVector2fArray(const Vector2fArray& baseArray, uint32_t firstElement, uint32_t count, const float* arrayData, resourceCacheFlag_t cacheFlag, const char* name);
+        const Vector3fArray* createUpdatedConstVector3fArray(const Vector3fArray& baseArray, uint32_t firstElement, uint32_t count, const float* arrayData, resourceCacheFlag_t cacheFlag, const char* name);
+        const Vector4fArray* createUpdatedConstVector4fArray(const Vector4fArray& baseArray, uint32_t firstElement, uint32_t count, const float* arrayData, resourceCacheFlag_t cacheFlag, const char* name);
+        const UInt16Array* createUpdatedConstUInt16Array(const UInt16Array& baseArray, uint32_t firstElement, uint32_t count, const uint16_t* arrayData, resourceCacheFlag_t cacheFlag, const char* name);
+        const UInt32Array* createUpdatedConstUInt32Array(const UInt32Array& baseArray, uint32_t firstElement, uint32_t count, const uint32_t* arrayData, resourceCacheFlag_t cacheFlag, const char* name);
         Texture2D* createTexture2D(uint32_t width, uint32_t height, ETextureFormat format, uint32_t mipMapCount, const MipLevelData mipLevelData[], bool generateMipChain, resourceCacheFlag_t cacheFlag, const char* name);
         Texture3D* createTexture3D(uint32_t width, uint32_t height, uint32_t depth, ETextureFormat format, uint32_t mipMapCount, const MipLevelData mipLevelData[], bool generateMipChain, resourceCacheFlag_t cacheFlag, const char* name);
         TextureCube* createTextureCube(uint32_t, ETextureFormat format, resourceCacheFlag_t cacheFlag, const char* name, uint32_t mipMapCount, const CubeMipLevelData mipLevelData[], bool generateMipChain);
@@ -124,6 +131,10 @@ namespace ramses
         status_t loadResources(const ResourceFileDescription& fileDescription);
         status_t loadResources(const ResourceFileDescriptionSet& resourceFileInformation);
 
+        // packs resources of input files into output file, LL resources are copied as they are stored in input files and
+        // resource contained in multiple files is stored only once. When appending, resources already stored in output file are kept
+        status_t packResourceFiles(const ramses_internal::Vector<ramses_internal::String>& inputFilenames, const ramses_internal::String& outputFilename, bool compress, bool appendToOutputFile);
+
         status_t loadResourcesAsync(const ResourceFileDescription& fileDescription);
         status_t loadResourcesAsync(const ResourceFileDescriptionSet& resourceFileInformation);
         status_t loadSceneFromFileAsync(const char* fileName, const ResourceFileDescriptionSet& resourceFileInformation);
@@ -160,6 +171,9 @@ namespace ramses
 
     private:
         ArrayResourceImpl& createArrayResourceImpl(uint32_t count, const ramses_internal::Byte* arrayData, resourceCacheFlag_t cacheFlag, const char* name, ramses_internal::EDataType elementType, ERamsesObjectType objectType, ramses_internal::EResourceType resourceType);
+        ArrayResourceImpl* createUpdatedArrayResourceImpl(const ArrayResourceImpl& baseArray, uint32_t firstElement, uint32_t count, const ramses_internal::Byte* arrayData, resourceCacheFlag_t cacheFlag, const char* name);
+        template <typename ArrayType, typename ElementType>
+        const ArrayType* createUpdatedConstArray(const ArrayType& baseArray, uint32_t firstElement, uint32_t count, const ElementType* arrayData, resourceCacheFlag_t cacheFlag, const char* name);
 
         class LoadResourcesRunnable : public ramses_internal::ITask
         {
@@ -225,6 +239,7 @@ namespace ramses
         template <typename ObjectType, typename ObjectImplType>
         status_t createAndDeserializeResourceImpls(ramses_internal::IInputStream& inStream, DeserializationContext& deserializationContext, uint32_t count, ResourceVector& container);
         status_t readResourcesFromFile(const ramses_internal::String& resourceFilename);
+        status_t readLowLevelResourceTableOfContents(ramses_internal::BinaryFileInputStream& inputStream, const ramses_internal::String& resourceFilename, ramses_internal::ResourceTableOfContents& toc) const;
         Scene* prepareSceneAndResourcesFromFiles(const char* caller, const ramses_internal::String& sceneFilename,
             const ramses_internal::Vector<ramses_internal::String>& resourceFilenames, ramses_internal::Vector<ResourceLoadStatus>& resourceloadStatus);
         void finalizeLoadedScene(Scene* scene);
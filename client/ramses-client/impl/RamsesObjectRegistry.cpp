@@ -126,12 +126,9 @@ namespace ramses
             if (RamsesObjectTypeUtils::IsConcreteType(type) && RamsesObjectTypeUtils::IsTypeMatchingBaseType(type, ofType))
             {
                 const RamsesObjectsPool& objectsPool = m_objects[type];
-                for (RamsesObjectHandle handle(0u); handle < objectsPool.getTotalCount(); ++handle)
+                for (const auto handle : objectsPool)
                 {
-                    if (objectsPool.isAllocated(handle))
-                    {
-                        objects.push_back(*objectsPool.getMemory(handle));
-                    }
+                    objects.push_back(*objectsPool.getMemory(handle));
                 }
             }
         }
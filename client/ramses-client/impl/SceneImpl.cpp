@@ -1306,6 +1306,17 @@ namespace ramses
         return StatusOK;
     }
 
+    status_t SceneImpl::prefetchResource(const Resource& resource)
+    {
+        if (!isFromTheSameClientAs(resource.impl))
+        {
+            return addErrorEntry("Scene::prefetchResource failed, resource is not from same client as scene.");
+        }
+
+        m_scene.prefetchClientResource(resource.impl.getLowlevelResourceHash());
+        return StatusOK;
+    }
+
     status_t SceneImpl::flush(sceneVersionTag_t sceneVersion)
     {
         if (m_nextSceneVersion != InvalidSceneVersionTag && sceneVersion == InvalidSceneVersionTag)
@@ -83,6 +83,7 @@ namespace ramses
     class VertexDataBufferImpl;
     class Texture2DBuffer;
     class Texture2DBufferImpl;
+    class Resource;
 
     class SceneImpl final : public ClientObjectImpl
     {
@@ -215,6 +216,7 @@ namespace ramses
         status_t destroy(SceneObject& object);
 
         status_t setExpirationTimestamp(uint64_t ptpExpirationTimestampInMilliseconds);
+        status_t prefetchResource(const Resource& resource);
 
         status_t flush(sceneVersionTag_t sceneVersion);
 
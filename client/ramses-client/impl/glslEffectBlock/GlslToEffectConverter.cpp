@@ -98,12 +98,68 @@ namespace ramses_internal
         }
         else if (storageQualifier == glslang::EvqUniform)
         {
+            if (symbol->getType().getBasicType() == glslang::EbtBlock)
+            {
+                return handleUniformBlock(symbol);
+            }
             return setInputTypeFromType(symbol->getType(), String(symbol->getName().c_str()), m_uniformInputs);
         }
 
         return true;
     }
 
+    bool GlslToEffectConverter::handleUniformBlock(const glslang::TIntermSymbol* symbol)
+    {
+        const glslang::TType& type = symbol->getType();
+        const String blockName(type.getTypeName().c_str());
+
+        // only std140 has a layout defined independent of the GL implementation, which is needed to pack the block on CPU side
+        if (type.getQualifier().layoutPacking != glslang::ElpStd140)
+        {
+            m_message << blockName << ": only uniform blocks with std140 layout supported";
+            return false;
+        }
+        if (type.isArray())
+        {
+            m_message << blockName << ": arrays of uniform blocks not supported";
+            return false;
+        }
+
+        // members of blocks with instance name are identified by block name in GL, members of anonymous blocks by their own name
+        const bool isAnonymousBlock = glslang::IsAnonymous(symbol->getName());
+        for (const auto& blockMember : *type.getStruct())
+        {
+            const glslang::TType& memberType = *blockMember.type;
+            const String memberName(memberType.getFieldName().c_str());
+            const String inputName = isAnonymousBlock ? memberName : getStructFieldIdentifier(blockName, memberName, -1);
+
+            if (memberType.isStruct())
+            {
+                m_message << inputName << ": structs in uniform blocks not supported";
+                return false;
+            }
+            if (memberType.getQualifier().layoutMatrix == glslang::ElmRowMajor)
+            {
+                m_message << inputName << ": row major matrices in uniform blocks not supported";
+                return false;
+            }
+
+            uint32_t elementCount;
+            CHECK_RETURN_ERR(getElementCountFromType(memberType, inputName, elementCount));
+            CHECK_RETURN_ERR(createEffectInputType(memberType, inputName, elementCount, m_uniformInputs));
+
+            EffectInputInformation& input = m_uniformInputs.back();
+            if (input.semantics != EFixedSemantics_Invalid)
+            {
+                m_message << inputName << ": semantic uniforms cannot be members of uniform blocks";
+                return false;
+            }
+            input.uniformBlockName = blockName;
+        }
+
+        return true;
+    }
+
     bool GlslToEffectConverter::makeUniformsUnique()
     {
         EffectInputInformationVector temp;
@@ -222,6 +278,10 @@ namespace ramses_internal
     {
         for(auto& input : m_attributeInputs)
         {
+            // world matrices of instances are provided by renderer, there is no buffer to be set for them
+            if (input.semantics == EFixedSemantics_InstanceWorldMatrixAttribute)
+                continue;
+
             switch (input.dataType)
             {
             case EDataType_UInt16:
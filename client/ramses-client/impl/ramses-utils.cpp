@@ -23,9 +23,20 @@
 
 #include "Utils/File.h"
 #include "Utils/LogMacros.h"
+#include "Utils/ParallelJobs.h"
 #include "PlatformAbstraction/PlatformMemory.h"
 #include "PlatformAbstraction/PlatformMath.h"
 #include "lodepng.h"
+#include <cmath>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RAMSES_MIPMAPS_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define RAMSES_MIPMAPS_NEON
+#include <arm_neon.h>
+#endif
 
 namespace ramses
 {
@@ -133,87 +144,194 @@ namespace ramses
         return pow;
     }
 
-    MipLevelData* RamsesUtils::GenerateMipMapsTexture2D(uint32_t originalWidth, uint32_t originalHeight, uint8_t bytesPerPixel, uint8_t* data, uint32_t& mipMapCount)
+    namespace
     {
-        // copy original data
-        const uint32_t originalSize = originalWidth * originalHeight * bytesPerPixel;
-        uint8_t* originalData = new uint8_t[originalSize];
-        ramses_internal::PlatformMemory::Copy(originalData, data, originalSize);
+        // sRGB encoded components are converted to linear intensity for filtering and back
+        class SRGBConversionTables
+        {
+        public:
+            SRGBConversionTables()
+            {
+                for (uint32_t i = 0u; i < 256u; ++i)
+                {
+                    const float c = static_cast<float>(i) / 255.f;
+                    m_toLinear[i] = (c <= 0.04045f) ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+                }
+                for (uint32_t i = 0u; i < LinearSteps; ++i)
+                {
+                    const float l = static_cast<float>(i) / static_cast<float>(LinearSteps - 1u);
+                    const float c = (l <= 0.0031308f) ? l * 12.92f : 1.055f * std::pow(l, 1.f / 2.4f) - 0.055f;
+                    m_toSRGB[i] = static_cast<uint8_t>(c * 255.f + 0.5f);
+                }
+            }
+
+            uint8_t average(uint8_t a, uint8_t b, uint8_t c, uint8_t d) const
+            {
+                const float linearAverage = 0.25f * (m_toLinear[a] + m_toLinear[b] + m_toLinear[c] + m_toLinear[d]);
+                return m_toSRGB[static_cast<uint32_t>(linearAverage * static_cast<float>(LinearSteps - 1u) + 0.5f)];
+            }
+
+            static const SRGBConversionTables& Get()
+            {
+                static const SRGBConversionTables tables;
+                return tables;
+            }
 
-        if (!IsPowerOfTwo(originalWidth) || !IsPowerOfTwo(originalHeight))
+        private:
+            static const uint32_t LinearSteps = 4096u;
+            float m_toLinear[256];
+            uint8_t m_toSRGB[LinearSteps];
+        };
+
+        struct MipChainLevel
         {
-            // if no mip maps can be created only return original data
-            mipMapCount = 1u;
-        }
-        else
+            uint32_t width;
+            uint32_t height;
+            uint32_t faceSize;
+            uint8_t* data; // faces are stored one after another
+        };
+
+        // 2x2 box filter of RGBA8 pixels, two target pixels per iteration, returns number of target pixels processed
+        uint32_t DownsampleRGBA8RowVectorized(const uint8_t* sourceRow0, const uint8_t* sourceRow1, uint8_t* targetRow, uint32_t targetWidth)
         {
-            mipMapCount = ramses_internal::max(Log2(originalWidth), Log2(originalHeight)) + 1u;
+            uint32_t col = 0u;
+#if defined(RAMSES_MIPMAPS_SSE2)
+            const __m128i zero = _mm_setzero_si128();
+            for (; col + 2u <= targetWidth; col += 2u)
+            {
+                const __m128i row0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(sourceRow0 + col * 8u));
+                const __m128i row1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(sourceRow1 + col * 8u));
+                __m128i pixels01 = _mm_add_epi16(_mm_unpacklo_epi8(row0, zero), _mm_unpacklo_epi8(row1, zero));
+                __m128i pixels23 = _mm_add_epi16(_mm_unpackhi_epi8(row0, zero), _mm_unpackhi_epi8(row1, zero));
+                pixels01 = _mm_add_epi16(pixels01, _mm_srli_si128(pixels01, 8));
+                pixels23 = _mm_add_epi16(pixels23, _mm_srli_si128(pixels23, 8));
+                const __m128i average = _mm_srli_epi16(_mm_unpacklo_epi64(pixels01, pixels23), 2);
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(targetRow + col * 4u), _mm_packus_epi16(average, average));
+            }
+#elif defined(RAMSES_MIPMAPS_NEON)
+            for (; col + 2u <= targetWidth; col += 2u)
+            {
+                const uint8x16_t row0 = vld1q_u8(sourceRow0 + col * 8u);
+                const uint8x16_t row1 = vld1q_u8(sourceRow1 + col * 8u);
+                const uint16x8_t pixels01 = vaddl_u8(vget_low_u8(row0), vget_low_u8(row1));
+                const uint16x8_t pixels23 = vaddl_u8(vget_high_u8(row0), vget_high_u8(row1));
+                const uint16x8_t sum = vcombine_u16(vadd_u16(vget_low_u16(pixels01), vget_high_u16(pixels01)), vadd_u16(vget_low_u16(pixels23), vget_high_u16(pixels23)));
+                vst1_u8(targetRow + col * 4u, vshrn_n_u16(sum, 2));
+            }
+#else
+            (void)sourceRow0;
+            (void)sourceRow1;
+            (void)targetRow;
+            (void)targetWidth;
+#endif
+            return col;
         }
 
-        // prepare mip data generation
-        ramses::MipLevelData* mipLevelData = new ramses::MipLevelData[mipMapCount];
-
-        mipLevelData[0].m_size = originalSize;
-        mipLevelData[0].m_data = originalData;
-
-        uint32_t currentMipMapIndex = 1u;
-        while (currentMipMapIndex < mipMapCount)
+        void DownsampleRows(const MipChainLevel& source, const MipChainLevel& target, const uint8_t* sourceFace, uint8_t* targetFace, uint32_t bytesPerPixel, bool sRGB, uint32_t firstRow, uint32_t endRow)
         {
-            uint32_t nextWidth = ramses_internal::max(originalWidth >> 1, 1u);
-            uint32_t nextHeight = ramses_internal::max(originalHeight >> 1, 1u);
-            uint32_t nextSize = nextWidth * nextHeight * bytesPerPixel;
-            uint8_t* nextData = new uint8_t[nextSize];
+            const uint32_t sourceRowSize = source.width * bytesPerPixel;
+            const uint32_t targetRowSize = target.width * bytesPerPixel;
+            // sources with single row or column are filtered by using it twice, which results in average of two pixels
+            const uint32_t nextRowOffset = (source.height > 1u ? sourceRowSize : 0u);
+            const uint32_t nextPixelOffset = (source.width > 1u ? bytesPerPixel : 0u);
+            // alpha is filtered linearly also for sRGB textures
+            const uint32_t sRGBComponents = (sRGB ? ramses_internal::min(bytesPerPixel, 3u) : 0u);
+            const SRGBConversionTables* sRGBTables = (sRGB ? &SRGBConversionTables::Get() : nullptr);
+
+            for (uint32_t row = firstRow; row < endRow; ++row)
+            {
+                const uint8_t* sourceRow0 = sourceFace + row * 2u * sourceRowSize;
+                const uint8_t* sourceRow1 = sourceRow0 + nextRowOffset;
+                uint8_t* targetRow = targetFace + row * targetRowSize;
 
-            uint32_t originalRowSize = originalWidth * bytesPerPixel;
-            uint32_t nextRowSize = nextWidth * bytesPerPixel;
+                uint32_t col = 0u;
+                if (bytesPerPixel == 4u && !sRGB && nextPixelOffset != 0u)
+                {
+                    col = DownsampleRGBA8RowVectorized(sourceRow0, sourceRow1, targetRow, target.width);
+                }
 
-            for (uint32_t row = 0u; row < nextHeight; row++)
-            {
-                for (uint32_t col = 0u; col < nextWidth; col++)
+                for (; col < target.width; ++col)
                 {
-                    const uint32_t nextIndex = (row * nextRowSize) + col * bytesPerPixel;
-                    const uint32_t originalIndex = ((row * originalRowSize * 2u) + col * 2u * bytesPerPixel);
-                    for (uint32_t i = 0u; i < bytesPerPixel; i++) // iterate through pixel components
+                    const uint8_t* pixel0 = sourceRow0 + col * 2u * bytesPerPixel;
+                    const uint8_t* pixel1 = sourceRow1 + col * 2u * bytesPerPixel;
+                    uint8_t* targetPixel = targetRow + col * bytesPerPixel;
+                    uint32_t i = 0u;
+                    for (; i < sRGBComponents; ++i)
                     {
-                        // apply box filter
-                        uint32_t tmp = 0u;
-                        if (originalHeight > 1 && originalWidth > 1)
-                        {
-                            tmp = static_cast<uint32_t>(originalData[originalIndex + i]) +
-                                static_cast<uint32_t>(originalData[originalIndex + i + bytesPerPixel]) +
-                                static_cast<uint32_t>(originalData[originalIndex + originalRowSize + i]) +
-                                static_cast<uint32_t>(originalData[originalIndex + originalRowSize + i + bytesPerPixel]);
-                            tmp >>= 2; // divide by 4
-                        }
-                        else
-                        {
-                            if (originalHeight == 1)
-                            {
-                                tmp = static_cast<uint32_t>(originalData[originalIndex + i]) +
-                                    static_cast<uint32_t>(originalData[originalIndex + i + bytesPerPixel]);
-                                tmp >>= 1; // divide by 2
-                            }
-                            if (originalWidth == 1)
-                            {
-                                tmp = static_cast<uint32_t>(originalData[originalIndex + i]) +
-                                    static_cast<uint32_t>(originalData[originalIndex + originalRowSize + i]);
-                                tmp >>= 1; // divide by 2
-                            }
-                        }
-
-                        nextData[nextIndex + i] = static_cast<uint8_t>(tmp);
+                        targetPixel[i] = sRGBTables->average(pixel0[i], pixel0[i + nextPixelOffset], pixel1[i], pixel1[i + nextPixelOffset]);
+                    }
+                    for (; i < bytesPerPixel; ++i)
+                    {
+                        const uint32_t sum = static_cast<uint32_t>(pixel0[i]) + pixel0[i + nextPixelOffset] + pixel1[i] + pixel1[i + nextPixelOffset];
+                        targetPixel[i] = static_cast<uint8_t>(sum >> 2);
                     }
                 }
             }
+        }
+
+        // all levels of all faces are stored in one allocation which is owned by first face of first level
+        std::vector<MipChainLevel> GenerateMipChain(uint32_t width, uint32_t height, uint32_t bytesPerPixel, const uint8_t* data, uint32_t faceCount, bool sRGB)
+        {
+            uint32_t mipMapCount = 1u;
+            if (IsPowerOfTwo(width) && IsPowerOfTwo(height))
+            {
+                mipMapCount = ramses_internal::max(Log2(width), Log2(height)) + 1u;
+            }
+
+            std::vector<MipChainLevel> levels(mipMapCount);
+            uint32_t totalSize = 0u;
+            for (uint32_t level = 0u; level < mipMapCount; ++level)
+            {
+                levels[level].width = ramses_internal::max(width >> level, 1u);
+                levels[level].height = ramses_internal::max(height >> level, 1u);
+                levels[level].faceSize = levels[level].width * levels[level].height * bytesPerPixel;
+                totalSize += levels[level].faceSize * faceCount;
+            }
+
+            uint8_t* mipChainData = new uint8_t[totalSize];
+            for (auto& level : levels)
+            {
+                level.data = mipChainData;
+                mipChainData += level.faceSize * faceCount;
+            }
+            ramses_internal::PlatformMemory::Copy(levels[0].data, data, levels[0].faceSize * faceCount);
+
+            // rows of all faces are split into jobs big enough to outweigh distributing them to threads
+            const uint32_t minimumBytesPerJob = 64u * 1024u;
+            for (uint32_t level = 1u; level < mipMapCount; ++level)
+            {
+                const MipChainLevel& source = levels[level - 1u];
+                const MipChainLevel& target = levels[level];
+                const uint32_t rowsPerJob = ramses_internal::max(minimumBytesPerJob / (target.width * bytesPerPixel), 1u);
+                const uint32_t jobsPerFace = (target.height + rowsPerJob - 1u) / rowsPerJob;
+
+                ramses_internal::ParallelJobs::Execute(jobsPerFace * faceCount, [&](uint32_t job)
+                {
+                    const uint32_t face = job / jobsPerFace;
+                    const uint32_t firstRow = (job % jobsPerFace) * rowsPerJob;
+                    const uint32_t endRow = ramses_internal::min(firstRow + rowsPerJob, target.height);
+                    DownsampleRows(source, target, source.data + face * source.faceSize, target.data + face * target.faceSize, bytesPerPixel, sRGB, firstRow, endRow);
+                });
+            }
 
-            mipLevelData[currentMipMapIndex].m_size = nextSize;
-            mipLevelData[currentMipMapIndex].m_data = nextData;
+            return levels;
+        }
+    }
+
+    MipLevelData* RamsesUtils::GenerateMipMapsTexture2D(uint32_t originalWidth, uint32_t originalHeight, uint8_t bytesPerPixel, uint8_t* data, uint32_t& mipMapCount)
+    {
+        return GenerateMipMapsTexture2D(originalWidth, originalHeight, bytesPerPixel, data, mipMapCount, false);
+    }
+
+    MipLevelData* RamsesUtils::GenerateMipMapsTexture2D(uint32_t originalWidth, uint32_t originalHeight, uint8_t bytesPerPixel, uint8_t* data, uint32_t& mipMapCount, bool sRGBFiltering)
+    {
+        const std::vector<MipChainLevel> levels = GenerateMipChain(originalWidth, originalHeight, bytesPerPixel, data, 1u, sRGBFiltering);
+        mipMapCount = static_cast<uint32_t>(levels.size());
 
-            originalData = nextData;
-            nextData = NULL;
-            originalWidth = nextWidth;
-            originalHeight = nextHeight;
-            currentMipMapIndex++;
+        MipLevelData* mipLevelData = new MipLevelData[mipMapCount];
+        for (uint32_t level = 0u; level < mipMapCount; ++level)
+        {
+            mipLevelData[level] = MipLevelData(levels[level].faceSize, levels[level].data);
         }
 
         return mipLevelData;
@@ -221,41 +339,34 @@ namespace ramses
 
     CubeMipLevelData* RamsesUtils::GenerateMipMapsTextureCube(uint32_t faceWidth, uint32_t faceHeight, uint8_t bytesPerPixel, uint8_t* data, uint32_t& mipMapCount)
     {
-        const uint32_t faceSize = faceWidth * faceHeight * bytesPerPixel;
-        mipMapCount = 0u;
-        MipLevelData* faceMips[6];
-        faceMips[0] = GenerateMipMapsTexture2D(faceWidth, faceHeight, bytesPerPixel, &data[faceSize * 0], mipMapCount);
-        faceMips[1] = GenerateMipMapsTexture2D(faceWidth, faceHeight, bytesPerPixel, &data[faceSize * 1], mipMapCount);
-        faceMips[2] = GenerateMipMapsTexture2D(faceWidth, faceHeight, bytesPerPixel, &data[faceSize * 2], mipMapCount);
-        faceMips[3] = GenerateMipMapsTexture2D(faceWidth, faceHeight, bytesPerPixel, &data[faceSize * 3], mipMapCount);
-        faceMips[4] = GenerateMipMapsTexture2D(faceWidth, faceHeight, bytesPerPixel, &data[faceSize * 4], mipMapCount);
-        faceMips[5] = GenerateMipMapsTexture2D(faceWidth, faceHeight, bytesPerPixel, &data[faceSize * 5], mipMapCount);
+        return GenerateMipMapsTextureCube(faceWidth, faceHeight, bytesPerPixel, data, mipMapCount, false);
+    }
+
+    CubeMipLevelData* RamsesUtils::GenerateMipMapsTextureCube(uint32_t faceWidth, uint32_t faceHeight, uint8_t bytesPerPixel, uint8_t* data, uint32_t& mipMapCount, bool sRGBFiltering)
+    {
+        const std::vector<MipChainLevel> levels = GenerateMipChain(faceWidth, faceHeight, bytesPerPixel, data, 6u, sRGBFiltering);
+        mipMapCount = static_cast<uint32_t>(levels.size());
 
         CubeMipLevelData* cubeMipMaps = new CubeMipLevelData[mipMapCount];
-        for (uint32_t level = 0; level < mipMapCount; level++)
+        for (uint32_t level = 0u; level < mipMapCount; ++level)
         {
-            new (&cubeMipMaps[level]) CubeMipLevelData(
-                faceMips[0][level].m_size,
-                faceMips[0][level].m_data,
-                faceMips[1][level].m_data,
-                faceMips[2][level].m_data,
-                faceMips[3][level].m_data,
-                faceMips[4][level].m_data,
-                faceMips[5][level].m_data);
+            const uint32_t faceSize = levels[level].faceSize;
+            const uint8_t* levelData = levels[level].data;
+            cubeMipMaps[level] = CubeMipLevelData(faceSize,
+                levelData, levelData + faceSize,
+                levelData + 2u * faceSize, levelData + 3u * faceSize,
+                levelData + 4u * faceSize, levelData + 5u * faceSize);
         }
 
-        for (uint8_t level = 0; level < 6u; level++)
-        {
-            delete[] faceMips[level];
-        }
         return cubeMipMaps;
     }
 
     void RamsesUtils::DeleteGeneratedMipMaps(MipLevelData*& data, uint32_t numMipMaps)
     {
-        for (uint32_t i = 0; i < numMipMaps; i++)
+        // data of all levels is stored in single allocation starting with first level
+        if (numMipMaps > 0u)
         {
-            delete[] data[i].m_data;
+            delete[] data[0].m_data;
         }
 
         delete[] data;
@@ -264,15 +375,12 @@ namespace ramses
 
     void RamsesUtils::DeleteGeneratedMipMaps(CubeMipLevelData*& data, uint32_t numMipMaps)
     {
-        for (uint8_t level = 0u; level < numMipMaps; level++)
+        // data of all levels and faces is stored in single allocation starting with first face of first level
+        if (numMipMaps > 0u)
         {
-            delete[] data[level].m_dataPX;
-            delete[] data[level].m_dataNX;
-            delete[] data[level].m_dataPY;
-            delete[] data[level].m_dataNY;
-            delete[] data[level].m_dataPZ;
-            delete[] data[level].m_dataNZ;
+            delete[] data[0].m_dataPX;
         }
+
         delete[] data;
         data = NULL;
     }
@@ -116,6 +116,48 @@ namespace ramses
         return arr;
     }
 
+    const FloatArray* RamsesClient::createUpdatedConstFloatArray(const FloatArray& baseArray, uint32_t firstElement, uint32_t count, const float* arrayData, resourceCacheFlag_t cacheFlag, const char* name)
+    {
+        const FloatArray* arr = impl.createUpdatedConstFloatArray(baseArray, firstElement, count, arrayData, cacheFlag, name);
+        LOG_HL_CLIENT_API6(LOG_API_RESOURCE_PTR_STRING(arr), LOG_API_RAMSESOBJECT_STRING(baseArray), firstElement, count, LOG_API_GENERIC_PTR_STRING(arrayData), cacheFlag.getValue(), name);
+        return arr;
+    }
+
+    const Vector2fArray* RamsesClient::createUpdatedConstVector2fArray(const Vector2fArray& baseArray, uint32_t firstElement, uint32_t count, const float* arrayData, resourceCacheFlag_t cacheFlag, const char* name)
+    {
+        const Vector2fArray* arr = impl.createUpdatedConstVector2fArray(baseArray, firstElement, count, arrayData, cacheFlag, name);
+        LOG_HL_CLIENT_API6(LOG_API_RESOURCE_PTR_STRING(arr), LOG_API_RAMSESOBJECT_STRING(baseArray), firstElement, count, LOG_API_GENERIC_PTR_STRING(arrayData), cacheFlag.getValue(), name);
+        return arr;
+    }
+
+    const Vector3fArray* RamsesClient::createUpdatedConstVector3fArray(const Vector3fArray& baseArray, uint32_t firstElement, uint32_t count, const float* arrayData, resourceCacheFlag_t cacheFlag, const char* name)
+    {
+        const Vector3fArray* arr = impl.createUpdatedConstVector3fArray(baseArray, firstElement, count, arrayData, cacheFlag, name);
+        LOG_HL_CLIENT_API6(LOG_API_RESOURCE_PTR_STRING(arr), LOG_API_RAMSESOBJECT_STRING(baseArray), firstElement, count, LOG_API_GENERIC_PTR_STRING(arrayData), cacheFlag.getValue(), name);
+        return arr;
+    }
+
+    const Vector4fArray* RamsesClient::createUpdatedConstVector4fArray(const Vector4fArray& baseArray, uint32_t firstElement, uint32_t count, const float* arrayData, resourceCacheFlag_t cacheFlag, const char* name)
+    {
+        const Vector4fArray* arr = impl.createUpdatedConstVector4fArray(baseArray, firstElement, count, arrayData, cacheFlag, name);
+        LOG_HL_CLIENT_API6(LOG_API_RESOURCE_PTR_STRING(arr), LOG_API_RAMSESOBJECT_STRING(baseArray), firstElement, count, LOG_API_GENERIC_PTR_STRING(arrayData), cacheFlag.getValue(), name);
+        return arr;
+    }
+
+    const UInt16Array* RamsesClient::createUpdatedConstUInt16Array(const UInt16Array& baseArray, uint32_t firstElement, uint32_t count, const uint16_t* arrayData, resourceCacheFlag_t cacheFlag, const char* name)
+    {
+        const UInt16Array* arr = impl.createUpdatedConstUInt16Array(baseArray, firstElement, count, arrayData, cacheFlag, name);
+        LOG_HL_CLIENT_API6(LOG_API_RESOURCE_PTR_STRING(arr), LOG_API_RAMSESOBJECT_STRING(baseArray), firstElement, count, LOG_API_GENERIC_PTR_STRING(arrayData), cacheFlag.getValue(), name);
+        return arr;
+    }
+
+    const UInt32Array* RamsesClient::createUpdatedConstUInt32Array(const UInt32Array& baseArray, uint32_t firstElement, uint32_t count, const uint32_t* arrayData, resourceCacheFlag_t cacheFlag, const char* name)
+    {
+        const UInt32Array* arr = impl.createUpdatedConstUInt32Array(baseArray, firstElement, count, arrayData, cacheFlag, name);
+        LOG_HL_CLIENT_API6(LOG_API_RESOURCE_PTR_STRING(arr), LOG_API_RAMSESOBJECT_STRING(baseArray), firstElement, count, LOG_API_GENERIC_PTR_STRING(arrayData), cacheFlag.getValue(), name);
+        return arr;
+    }
+
     Texture2D* RamsesClient::createTexture2D(uint32_t width, uint32_t height, ETextureFormat format, uint32_t mipMapCount, const MipLevelData mipLevelData[], bool generateMipChain, resourceCacheFlag_t cacheFlag, const char* name /* = 0 */)
     {
         Texture2D* tex = impl.createTexture2D(width, height, format, mipMapCount, mipLevelData, generateMipChain, cacheFlag, name);
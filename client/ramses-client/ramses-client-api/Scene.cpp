@@ -158,6 +158,13 @@ namespace ramses
         return status;
     }
 
+    status_t Scene::prefetchResource(const Resource& resource)
+    {
+        const status_t status = impl.prefetchResource(resource);
+        LOG_HL_CLIENT_API1(status, LOG_API_RAMSESOBJECT_STRING(resource));
+        return status;
+    }
+
     status_t Scene::flush(sceneVersionTag_t sceneVersionTag)
     {
         const status_t status = impl.flush(sceneVersionTag);
@@ -40,7 +40,8 @@ namespace ramses
     {
         EEffectAttributeSemantic_Invalid = 0,                 /// Invalid semantic
         EEffectAttributeSemantic_TextPositions,               /// Text specific - vertex positions input. MUST be of type vec2
-        EEffectAttributeSemantic_TextTextureCoordinates       /// Text specific - texture coordinates input. MUST be of type vec2
+        EEffectAttributeSemantic_TextTextureCoordinates,      /// Text specific - texture coordinates input. MUST be of type vec2
+        EEffectAttributeSemantic_InstanceWorldMatrix          /// World matrix of mesh per instance, provided by renderer (no buffer to be set). MUST be of type mat4
     };
 }
 
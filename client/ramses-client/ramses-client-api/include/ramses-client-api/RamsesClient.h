@@ -147,6 +147,102 @@ namespace ramses
         */
         const UInt32Array* createConstUInt32Array(uint32_t numberOfIndices, const uint32_t* arrayData, resourceCacheFlag_t cacheFlag = ResourceCacheFlag_DoNotCache, const char* name = 0);
 
+        /**
+        * @brief Create a new FloatArray as copy of an existing one with a range of float values replaced.
+        *
+        * The new FloatArray is sent to renderers as delta of the base array when they already hold the base array,
+        * only the replaced float values are transferred then. Use this for arrays which are repeatedly updated in small parts.
+        *
+        * @param[in] baseArray The FloatArray to copy, must have been created by this client
+        * @param[in] firstElement Index of the first of the float values to replace
+        * @param[in] numberOfFloats The number of float values to replace, replaced range must be within the base array
+        * @param[in] arrayData Pointer to the float data of the replacing float values
+        * @param[in] cacheFlag The optional flag sent to the renderer. The value describes how the cache implementation should handle the resource.
+        * @param[in] name The optional name of the FloatArray
+        * @return A pointer to the created FloatArray, null on failure
+        */
+        const FloatArray* createUpdatedConstFloatArray(const FloatArray& baseArray, uint32_t firstElement, uint32_t numberOfFloats, const float* arrayData, resourceCacheFlag_t cacheFlag = ResourceCacheFlag_DoNotCache, const char* name = 0);
+
+        /**
+        * @brief Create a new Vector2fArray as copy of an existing one with a range of vectors replaced.
+        *
+        * The new Vector2fArray is sent to renderers as delta of the base array when they already hold the base array,
+        * only the replaced vectors are transferred then. Use this for arrays which are repeatedly updated in small parts.
+        *
+        * @param[in] baseArray The Vector2fArray to copy, must have been created by this client
+        * @param[in] firstElement Index of the first of the vectors to replace
+        * @param[in] numberOfVectors The number of vectors to replace, replaced range must be within the base array
+        * @param[in] arrayData Pointer to the float data of the replacing vectors
+        * @param[in] cacheFlag The optional flag sent to the renderer. The value describes how the cache implementation should handle the resource.
+        * @param[in] name The optional name of the Vector2fArray
+        * @return A pointer to the created Vector2fArray, null on failure
+        */
+        const Vector2fArray* createUpdatedConstVector2fArray(const Vector2fArray& baseArray, uint32_t firstElement, uint32_t numberOfVectors, const float* arrayData, resourceCacheFlag_t cacheFlag = ResourceCacheFlag_DoNotCache, const char* name = 0);
+
+        /**
+        * @brief Create a new Vector3fArray as copy of an existing one with a range of vectors replaced.
+        *
+        * The new Vector3fArray is sent to renderers as delta of the base array when they already hold the base array,
+        * only the replaced vectors are transferred then. Use this for arrays which are repeatedly updated in small parts.
+        *
+        * @param[in] baseArray The Vector3fArray to copy, must have been created by this client
+        * @param[in] firstElement Index of the first of the vectors to replace
+        * @param[in] numberOfVectors The number of vectors to replace, replaced range must be within the base array
+        * @param[in] arrayData Pointer to the float data of the replacing vectors
+        * @param[in] cacheFlag The optional flag sent to the renderer. The value describes how the cache implementation should handle the resource.
+        * @param[in] name The optional name of the Vector3fArray
+        * @return A pointer to the created Vector3fArray, null on failure
+        */
+        const Vector3fArray* createUpdatedConstVector3fArray(const Vector3fArray& baseArray, uint32_t firstElement, uint32_t numberOfVectors, const float* arrayData, resourceCacheFlag_t cacheFlag = ResourceCacheFlag_DoNotCache, const char* name = 0);
+
+        /**
+        * @brief Create a new Vector4fArray as copy of an existing one with a range of vectors replaced.
+        *
+        * The new Vector4fArray is sent to renderers as delta of the base array when they already hold the base array,
+        * only the replaced vectors are transferred then. Use this for arrays which are repeatedly updated in small parts.
+        *
+        * @param[in] baseArray The Vector4fArray to copy, must have been created by this client
+        * @param[in] firstElement Index of the first of the vectors to replace
+        * @param[in] numberOfVectors The number of vectors to replace, replaced range must be within the base array
+        * @param[in] arrayData Pointer to the float data of the replacing vectors
+        * @param[in] cacheFlag The optional flag sent to the renderer. The value describes how the cache implementation should handle the resource.
+        * @param[in] name The optional name of the Vector4fArray
+        * @return A pointer to the created Vector4fArray, null on failure
+        */
+        const Vector4fArray* createUpdatedConstVector4fArray(const Vector4fArray& baseArray, uint32_t firstElement, uint32_t numberOfVectors, const float* arrayData, resourceCacheFlag_t cacheFlag = ResourceCacheFlag_DoNotCache, const char* name = 0);
+
+        /**
+        * @brief Create a new UInt16Array as copy of an existing one with a range of indices replaced.
+        *
+        * The new UInt16Array is sent to renderers as delta of the base array when they already hold the base array,
+        * only the replaced indices are transferred then. Use this for arrays which are repeatedly updated in small parts.
+        *
+        * @param[in] baseArray The UInt16Array to copy, must have been created by this client
+        * @param[in] firstElement Index of the first of the indices to replace
+        * @param[in] numberOfIndices The number of indices to replace, replaced range must be within the base array
+        * @param[in] arrayData Pointer to the uint16_t data of the replacing indices
+        * @param[in] cacheFlag The optional flag sent to the renderer. The value describes how the cache implementation should handle the resource.
+        * @param[in] name The optional name of the UInt16Array
+        * @return A pointer to the created UInt16Array, null on failure
+        */
+        const UInt16Array* createUpdatedConstUInt16Array(const UInt16Array& baseArray, uint32_t firstElement, uint32_t numberOfIndices, const uint16_t* arrayData, resourceCacheFlag_t cacheFlag = ResourceCacheFlag_DoNotCache, const char* name = 0);
+
+        /**
+        * @brief Create a new UInt32Array as copy of an existing one with a range of indices replaced.
+        *
+        * The new UInt32Array is sent to renderers as delta of the base array when they already hold the base array,
+        * only the replaced indices are transferred then. Use this for arrays which are repeatedly updated in small parts.
+        *
+        * @param[in] baseArray The UInt32Array to copy, must have been created by this client
+        * @param[in] firstElement Index of the first of the indices to replace
+        * @param[in] numberOfIndices The number of indices to replace, replaced range must be within the base array
+        * @param[in] arrayData Pointer to the uint32_t data of the replacing indices
+        * @param[in] cacheFlag The optional flag sent to the renderer. The value describes how the cache implementation should handle the resource.
+        * @param[in] name The optional name of the UInt32Array
+        * @return A pointer to the created UInt32Array, null on failure
+        */
+        const UInt32Array* createUpdatedConstUInt32Array(const UInt32Array& baseArray, uint32_t firstElement, uint32_t numberOfIndices, const uint32_t* arrayData, resourceCacheFlag_t cacheFlag = ResourceCacheFlag_DoNotCache, const char* name = 0);
+
         /**
         * @brief Saves all scene contents (including all client resources) to a file.
         *
@@ -58,6 +58,7 @@ namespace ramses
     class IndexDataBuffer;
     class VertexDataBuffer;
     class Texture2DBuffer;
+    class Resource;
     class SceneObject;
 
     /**
@@ -237,6 +238,23 @@ namespace ramses
          */
         status_t setExpirationTimestamp(uint64_t ptpExpirationTimestampInMilliseconds);
 
+        /**
+        * @brief Announces that given resource is going to be used by this scene soon.
+        *        The announcement is sent to all subscribed renderers with next flush, renderers then
+        *        fetch the resource in background and keep it ready, so that a later flush using it
+        *        does not have to wait for the resource to arrive.
+        *        Prefetching a resource already used by the scene has no effect.
+        *        Renderers keep only a limited amount of prefetched data, oldest prefetched resources
+        *        not used by any scene yet are dropped first and fetched again once used.
+        *        The resource has to be kept alive by the user until it is used by the scene,
+        *        otherwise it cannot be provided to the renderers.
+        *
+        * @param[in] resource The resource expected to be used by this scene soon.
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t prefetchResource(const Resource& resource);
+
         /**
         * @brief Commits all changes done to the scene since the last flush or since scene creation. This makes a new
         *        valid scene state available to all local and remote renderers.
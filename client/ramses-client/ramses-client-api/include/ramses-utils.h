@@ -71,6 +71,7 @@ namespace ramses
         * @brief Generate mip maps from original texture 2D data. You obtain ownership of all the
         *        data returned in the mip map data object.
         * Note, that the original texture data gets copied and represents the first mip map level.
+        * Data of all mip map levels is stored in a single allocation, which starts with the data of the first level.
         * @see DeleteGeneratedMipMaps for deleting generated mip maps.
         * @param[in] width Width of the original texture.
         * @param[in] height Height of the original texture.
@@ -83,10 +84,25 @@ namespace ramses
         */
         static MipLevelData* GenerateMipMapsTexture2D(uint32_t width, uint32_t height, uint8_t bytesPerPixel, uint8_t* data, uint32_t& mipMapCount);
 
+        /**
+        * @brief Same as GenerateMipMapsTexture2D above, with choice of filtering color components in linear color space.
+        * @param[in] width Width of the original texture.
+        * @param[in] height Height of the original texture.
+        * @param[in] bytesPerPixel Number of bytes stored per pixel in the original texture data.
+        * @param[in] data Original texture data.
+        * @param[out] mipMapCount Number of generated mip map levels.
+        * @param[in] sRGBFiltering If true, up to first three components of a pixel are treated as sRGB encoded and filtered
+        *            in linear color space, any further component (alpha) is filtered as it is.
+        * @return generated mip map data, see GenerateMipMapsTexture2D above.
+        */
+        static MipLevelData* GenerateMipMapsTexture2D(uint32_t width, uint32_t height, uint8_t bytesPerPixel, uint8_t* data, uint32_t& mipMapCount, bool sRGBFiltering);
+
         /**
         * @brief Generate mip maps from original texture cube data. You obtain ownership of all the
         *        data returned in the mip map data object.
         * Note, that the original texture data gets copied and represents the first mip map level.
+        * Data of all mip map levels and faces is stored in a single allocation, which starts with the data of the first face
+        * of the first level.
         * @see DeleteGeneratedMipMaps for deleting generated mip maps.
         * @param[in] faceWidth Width of the original texture.
         * @param[in] faceHeight Height of the original texture.
@@ -99,6 +115,19 @@ namespace ramses
         */
         static CubeMipLevelData* GenerateMipMapsTextureCube(uint32_t faceWidth, uint32_t faceHeight, uint8_t bytesPerPixel, uint8_t* data, uint32_t& mipMapCount);
 
+        /**
+        * @brief Same as GenerateMipMapsTextureCube above, with choice of filtering color components in linear color space.
+        * @param[in] faceWidth Width of the original texture.
+        * @param[in] faceHeight Height of the original texture.
+        * @param[in] bytesPerPixel Number of bytes stored per pixel in the original texture data.
+        * @param[in] data Original texture data. Face data is expected in order [PX, NX, PY, NY, PZ, NZ]
+        * @param[out] mipMapCount Number of generated mip map levels.
+        * @param[in] sRGBFiltering If true, up to first three components of a pixel are treated as sRGB encoded and filtered
+        *            in linear color space, any further component (alpha) is filtered as it is.
+        * @return generated mip map data, see GenerateMipMapsTextureCube above.
+        */
+        static CubeMipLevelData* GenerateMipMapsTextureCube(uint32_t faceWidth, uint32_t faceHeight, uint8_t bytesPerPixel, uint8_t* data, uint32_t& mipMapCount, bool sRGBFiltering);
+
         /**
         * @brief Deletes mip map data created with RamsesUtils::GenerateMipMapsTexture2D.
         * @param[in, out] data Generated mip map data.
@@ -311,6 +311,58 @@ TEST_F(AGlslEffect, canParseShaderInputs)
     EXPECT_EQ(EffectInputInformation("attributeFloat", 1, EDataType_FloatBuffer, EFixedSemantics_Invalid, EEffectInputTextureType_Invalid), attributes[1]);
 }
 
+TEST_F(AGlslEffect, keepsMatrixTypeOfInstanceWorldMatrixAttribute)
+{
+    const char* vertexShader =
+        "precision highp float;\n"
+        "uniform mat4 viewProjection;\n"
+        "attribute mat4 instanceWorldMatrix;\n"
+        "attribute vec3 position;\n"
+        "void main(void)\n"
+        "{\n"
+        "    gl_Position = viewProjection * instanceWorldMatrix * vec4(position, 1.0);\n"
+        "}\n";
+    const char* fragmentShader =
+        "precision highp float;\n"
+        "void main(void)\n"
+        "{\n"
+        "    gl_FragColor = vec4(0.0);\n"
+        "}\n";
+
+    HashMap<String, EFixedSemantics> semantics;
+    semantics.put("instanceWorldMatrix", EFixedSemantics_InstanceWorldMatrixAttribute);
+
+    GlslEffect ge(vertexShader, fragmentShader, emptyCompilerDefines, semantics, "");
+    ScopedPointer<EffectResource> res(ge.createEffectResource(ResourceCacheFlag(0u)));
+    ASSERT_TRUE(res.get() != NULL);
+
+    const EffectInputInformationVector& attributes = res->getAttributeInputs();
+    ASSERT_EQ(2u, attributes.size());
+    EXPECT_EQ(EffectInputInformation("instanceWorldMatrix", 1, EDataType_Matrix44F, EFixedSemantics_InstanceWorldMatrixAttribute, EEffectInputTextureType_Invalid), attributes[0]);
+    EXPECT_EQ(EffectInputInformation("position", 1, EDataType_Vector3Buffer, EFixedSemantics_Invalid, EEffectInputTextureType_Invalid), attributes[1]);
+}
+
+TEST_F(AGlslEffect, rejectsMatrixAttributeWithoutInstanceWorldMatrixSemantic)
+{
+    const char* vertexShader =
+        "precision highp float;\n"
+        "attribute mat4 worldMatrix;\n"
+        "void main(void)\n"
+        "{\n"
+        "    gl_Position = worldMatrix * vec4(0.0);\n"
+        "}\n";
+    const char* fragmentShader =
+        "precision highp float;\n"
+        "void main(void)\n"
+        "{\n"
+        "    gl_FragColor = vec4(0.0);\n"
+        "}\n";
+
+    GlslEffect ge(vertexShader, fragmentShader, emptyCompilerDefines, emptySemanticInputs, "");
+    ScopedPointer<EffectResource> res(ge.createEffectResource(ResourceCacheFlag(0u)));
+    EXPECT_TRUE(res.get() == NULL);
+}
+
 TEST_F(AGlslEffect, canParseSamplerInputsGLSLES2)
 {
     const char* vertexShader =
@@ -406,6 +458,98 @@ TEST_F(AGlslEffect, canParseArrayInputs)
     EXPECT_EQ(EffectInputInformation("i", 2, EDataType_Int32, EFixedSemantics_Invalid, EEffectInputTextureType_Invalid), uniforms[2]);
 }
 
+TEST_F(AGlslEffect, canParseStd140UniformBlocks)
+{
+    const char* vertexShader =
+        "#version 300 es\n"
+        "layout(std140) uniform Material\n"
+        "{\n"
+        "    vec4 color;\n"
+        "    float weights[3];\n"
+        "} material;\n"
+        "void main(void)\n"
+        "{\n"
+        "    gl_Position = material.color * material.weights[0];\n"
+        "}\n";
+    const char* fragmentShader =
+        "#version 300 es\n"
+        "precision highp float;\n"
+        "layout(std140) uniform Light\n"
+        "{\n"
+        "    mat3 lightRotation;\n"
+        "    ivec2 lightCount;\n"
+        "};\n"
+        "out vec4 color;\n"
+        "void main(void)\n"
+        "{\n"
+        "    color = vec4(lightRotation[0], float(lightCount.x));\n"
+        "}\n";
+    GlslEffect ge(vertexShader, fragmentShader, emptyCompilerDefines, emptySemanticInputs, "");
+    ScopedPointer<EffectResource> res(ge.createEffectResource(ResourceCacheFlag(0u)));
+
+    ASSERT_TRUE(res.get() != NULL);
+
+    const EffectInputInformationVector& uniforms = res->getUniformInputs();
+
+    ASSERT_EQ(4u, uniforms.size());
+    EXPECT_EQ(EffectInputInformation("Material.color", 1, EDataType_Vector4F, EFixedSemantics_Invalid, EEffectInputTextureType_Invalid, "Material"), uniforms[0]);
+    EXPECT_EQ(EffectInputInformation("Material.weights", 3, EDataType_Float, EFixedSemantics_Invalid, EEffectInputTextureType_Invalid, "Material"), uniforms[1]);
+    EXPECT_EQ(EffectInputInformation("lightRotation", 1, EDataType_Matrix33F, EFixedSemantics_Invalid, EEffectInputTextureType_Invalid, "Light"), uniforms[2]);
+    EXPECT_EQ(EffectInputInformation("lightCount", 1, EDataType_Vector2I, EFixedSemantics_Invalid, EEffectInputTextureType_Invalid, "Light"), uniforms[3]);
+}
+
+TEST_F(AGlslEffect, rejectsUniformBlocksWithoutStd140Layout)
+{
+    const char* vertexShader =
+        "#version 300 es\n"
+        "layout(shared) uniform Material\n"
+        "{\n"
+        "    vec4 color;\n"
+        "};\n"
+        "void main(void)\n"
+        "{\n"
+        "    gl_Position = color;\n"
+        "}\n";
+    const char* fragmentShader =
+        "#version 300 es\n"
+        "out lowp vec4 color;\n"
+        "void main(void)\n"
+        "{\n"
+        "    color = vec4(0.0);\n"
+        "}\n";
+    GlslEffect ge(vertexShader, fragmentShader, emptyCompilerDefines, emptySemanticInputs, "");
+    ScopedPointer<EffectResource> res(ge.createEffectResource(ResourceCacheFlag(0u)));
+    EXPECT_TRUE(res.get() == NULL);
+}
+
+TEST_F(AGlslEffect, rejectsSemanticUniformInUniformBlock)
+{
+    const char* vertexShader =
+        "#version 300 es\n"
+        "layout(std140) uniform Transformations\n"
+        "{\n"
+        "    mat4 mvpMatrix;\n"
+        "};\n"
+        "void main(void)\n"
+        "{\n"
+        "    gl_Position = mvpMatrix * vec4(0.0);\n"
+        "}\n";
+    const char* fragmentShader =
+        "#version 300 es\n"
+        "out lowp vec4 color;\n"
+        "void main(void)\n"
+        "{\n"
+        "    color = vec4(0.0);\n"
+        "}\n";
+
+    HashMap<String, EFixedSemantics> semantics;
+    semantics.put("mvpMatrix", EFixedSemantics_ModelViewProjectionMatrix);
+
+    GlslEffect ge(vertexShader, fragmentShader, emptyCompilerDefines, semantics, "");
+    ScopedPointer<EffectResource> res(ge.createEffectResource(ResourceCacheFlag(0u)));
+    EXPECT_TRUE(res.get() == NULL);
+}
+
 TEST_F(AGlslEffect, failsWithWrongSemanticForType)
 {
     const char* vertexShader =
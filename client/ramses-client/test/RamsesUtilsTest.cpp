@@ -12,6 +12,8 @@
 #include "ramses-client-api/Texture2D.h"
 #include "ramses-client-api/MipLevelData.h"
 #include "Texture2DImpl.h"
+#include <algorithm>
+#include <vector>
 
 using namespace testing;
 
@@ -209,4 +211,100 @@ namespace ramses
         RamsesUtils::DeleteGeneratedMipMaps(mipData, mipMapCount);
         EXPECT_FALSE(mipData);
     }
+
+    TEST_F(ARamsesUtilsTest, generateMipMapsForLargeRGBATexture2DInSingleAllocation)
+    {
+        const uint8_t pixelSize = 4u;
+        const uint32_t width = 512u;
+        const uint32_t height = 256u;
+        std::vector<uint8_t> data(width * height * pixelSize);
+        for (uint32_t i = 0u; i < data.size(); ++i)
+        {
+            data[i] = static_cast<uint8_t>((i * 7u) ^ (i >> 9u));
+        }
+
+        uint32_t mipMapCount = 0u;
+        MipLevelData* mipData = RamsesUtils::GenerateMipMapsTexture2D(width, height, pixelSize, data.data(), mipMapCount);
+        ASSERT_TRUE(mipData);
+        EXPECT_EQ(10u, mipMapCount);
+
+        for (uint32_t level = 1u; level < mipMapCount; ++level)
+        {
+            // levels follow each other in memory
+            EXPECT_EQ(mipData[level - 1u].m_data + mipData[level - 1u].m_size, mipData[level].m_data);
+
+            const uint32_t sourceWidth = std::max(width >> (level - 1u), 1u);
+            const uint32_t sourceHeight = std::max(height >> (level - 1u), 1u);
+            const uint32_t targetWidth = std::max(sourceWidth / 2u, 1u);
+            const uint32_t targetHeight = std::max(sourceHeight / 2u, 1u);
+            ASSERT_EQ(targetWidth * targetHeight * pixelSize, mipData[level].m_size);
+
+            const uint8_t* source = mipData[level - 1u].m_data;
+            const uint32_t nextRowOffset = (sourceHeight > 1u ? sourceWidth * pixelSize : 0u);
+            const uint32_t nextPixelOffset = (sourceWidth > 1u ? pixelSize : 0u);
+            for (uint32_t row = 0u; row < targetHeight; ++row)
+            {
+                for (uint32_t byte = 0u; byte < targetWidth * pixelSize; ++byte)
+                {
+                    const uint32_t sourceIndex = row * 2u * sourceWidth * pixelSize + (byte / pixelSize) * 2u * pixelSize + byte % pixelSize;
+                    const uint32_t expected = (source[sourceIndex] + source[sourceIndex + nextPixelOffset] + source[sourceIndex + nextRowOffset] + source[sourceIndex + nextRowOffset + nextPixelOffset]) / 4u;
+                    ASSERT_EQ(expected, mipData[level].m_data[row * targetWidth * pixelSize + byte]);
+                }
+            }
+        }
+
+        RamsesUtils::DeleteGeneratedMipMaps(mipData, mipMapCount);
+        EXPECT_FALSE(mipData);
+    }
+
+    TEST_F(ARamsesUtilsTest, generateMipMapsForTexture2DWithSRGBFilteringExceptForAlpha)
+    {
+        const uint8_t pixelSize = 4u;
+        const uint8_t data[16u] = { 0u, 0u, 0u, 0u, 255u, 255u, 255u, 255u, 0u, 0u, 0u, 0u, 255u, 255u, 255u, 255u };
+
+        uint32_t mipMapCount = 0u;
+        MipLevelData* mipData = RamsesUtils::GenerateMipMapsTexture2D(2u, 2u, pixelSize, const_cast<uint8_t*>(data), mipMapCount, true);
+        ASSERT_TRUE(mipData);
+        ASSERT_EQ(2u, mipMapCount);
+
+        // half intensity in linear space is brighter when encoded as sRGB
+        EXPECT_EQ(188u, mipData[1].m_data[0]);
+        EXPECT_EQ(188u, mipData[1].m_data[1]);
+        EXPECT_EQ(188u, mipData[1].m_data[2]);
+        EXPECT_EQ(127u, mipData[1].m_data[3]);
+
+        RamsesUtils::DeleteGeneratedMipMaps(mipData, mipMapCount);
+    }
+
+    TEST_F(ARamsesUtilsTest, generateMipMapsForTextureCubeInSingleAllocation)
+    {
+        const uint8_t pixelSize = 1u;
+        uint8_t data[96u]; // = 4*4*6
+        for (uint8_t i = 0; i < 96u; i++)
+        {
+            data[i] = i + 1u;
+        }
+
+        uint32_t mipMapCount = 0u;
+        CubeMipLevelData* mipData = RamsesUtils::GenerateMipMapsTextureCube(4u, 4u, pixelSize, data, mipMapCount);
+        ASSERT_TRUE(mipData);
+        ASSERT_EQ(3u, mipMapCount);
+
+        for (uint32_t level = 0u; level < mipMapCount; ++level)
+        {
+            const uint32_t faceSize = mipData[level].m_faceDataSize;
+            EXPECT_EQ(mipData[level].m_dataPX + faceSize, mipData[level].m_dataNX);
+            EXPECT_EQ(mipData[level].m_dataNX + faceSize, mipData[level].m_dataPY);
+            EXPECT_EQ(mipData[level].m_dataPY + faceSize, mipData[level].m_dataNY);
+            EXPECT_EQ(mipData[level].m_dataNY + faceSize, mipData[level].m_dataPZ);
+            EXPECT_EQ(mipData[level].m_dataPZ + faceSize, mipData[level].m_dataNZ);
+            if (level > 0u)
+            {
+                EXPECT_EQ(mipData[level - 1u].m_dataNZ + mipData[level - 1u].m_faceDataSize, mipData[level].m_dataPX);
+            }
+        }
+
+        RamsesUtils::DeleteGeneratedMipMaps(mipData, mipMapCount);
+        EXPECT_FALSE(mipData);
+    }
 }
@@ -970,6 +970,58 @@ namespace ramses
         EXPECT_TRUE(NULL == a);
     }
 
+    TEST_F(AResourceTestClient, createUpdatedVector3fArrayHasDataOfBaseWithReplacedRange)
+    {
+        const float data[3 * 4] = { 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f, 10.f, 11.f, 12.f };
+        const Vector3fArray *base = client.createConstVector3fArray(4, data);
+        ASSERT_TRUE(NULL != base);
+
+        const float updatedData[3 * 2] = { 20.f, 21.f, 22.f, 23.f, 24.f, 25.f };
+        const Vector3fArray *updated = client.createUpdatedConstVector3fArray(*base, 1u, 2u, updatedData);
+        ASSERT_TRUE(NULL != updated);
+        EXPECT_EQ(4u, updated->impl.getElementCount());
+        EXPECT_EQ(ramses_internal::EDataType_Vector3F, updated->impl.getElementType());
+
+        const float expectedData[3 * 4] = { 1.f, 2.f, 3.f, 20.f, 21.f, 22.f, 23.f, 24.f, 25.f, 10.f, 11.f, 12.f };
+        const Vector3fArray *expected = client.createConstVector3fArray(4, expectedData);
+        EXPECT_EQ(expected->impl.getLowlevelResourceHash(), updated->impl.getLowlevelResourceHash());
+
+        const ramses_internal::ManagedResource resource = getCreatedResource(updated->impl.getLowlevelResourceHash());
+        ASSERT_TRUE(NULL != resource.getResourceObject());
+        EXPECT_EQ(0, ramses_internal::PlatformMemory::Compare(expectedData, resource.getResourceObject()->getResourceData()->getRawData(), sizeof(expectedData)));
+    }
+
+    TEST_F(AResourceTestClient, createUpdatedUInt16ArrayIsMarkedAsDeltaOfBase)
+    {
+        const uint16_t data[4] = { 1u, 2u, 3u, 4u };
+        const UInt16Array *base = client.createConstUInt16Array(4, data);
+        ASSERT_TRUE(NULL != base);
+
+        const uint16_t updatedData[1] = { 42u };
+        const UInt16Array *updated = client.createUpdatedConstUInt16Array(*base, 3u, 1u, updatedData);
+        ASSERT_TRUE(NULL != updated);
+
+        const ramses_internal::ManagedResource resource = getCreatedResource(updated->impl.getLowlevelResourceHash());
+        ASSERT_TRUE(NULL != resource.getResourceObject());
+        const ramses_internal::ResourceDeltaInfo& deltaInfo = resource.getResourceObject()->getDeltaInfo();
+        EXPECT_EQ(base->impl.getLowlevelResourceHash(), deltaInfo.baseHash);
+        EXPECT_EQ(3u * sizeof(uint16_t), deltaInfo.changedDataOffset);
+        EXPECT_EQ(sizeof(uint16_t), deltaInfo.changedDataSize);
+    }
+
+    TEST_F(AResourceTestClient, createUpdatedArrayFailsForRangeOutsideOfBase)
+    {
+        const float data[4] = {};
+        const FloatArray *base = client.createConstFloatArray(4, data);
+        ASSERT_TRUE(NULL != base);
+
+        const float updatedData[2] = {};
+        EXPECT_TRUE(NULL == client.createUpdatedConstFloatArray(*base, 3u, 2u, updatedData));
+        EXPECT_TRUE(NULL == client.createUpdatedConstFloatArray(*base, 4u, 1u, updatedData));
+        EXPECT_TRUE(NULL == client.createUpdatedConstFloatArray(*base, 0u, 0u, updatedData));
+        EXPECT_TRUE(NULL == client.createUpdatedConstFloatArray(*base, 0u, 1u, NULL));
+    }
+
 
 
 
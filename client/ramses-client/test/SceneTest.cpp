@@ -202,6 +202,32 @@ namespace ramses
         }
     }
 
+    TEST_F(AScene, canPrefetchResource)
+    {
+        const uint8_t data[] = { 1, 2, 3 };
+        const MipLevelData mipData(3u, data);
+        Texture2D* texture = client.createTexture2D(1u, 1u, ETextureFormat_RGB8, 1u, &mipData, false);
+        ASSERT_TRUE(texture != NULL);
+
+        EXPECT_EQ(StatusOK, m_scene.prefetchResource(*texture));
+
+        const ramses_internal::ResourceContentHashVector& prefetched = m_scene.impl.getIScene().getResourceChanges().m_prefetchedClientResources;
+        ASSERT_EQ(1u, prefetched.size());
+        EXPECT_EQ(texture->impl.getLowlevelResourceHash(), prefetched.front());
+    }
+
+    TEST_F(AScene, failsToPrefetchResourceFromAnotherClient)
+    {
+        RamsesClient anotherClient("anotherClient", framework);
+        const uint8_t data[] = { 1, 2, 3 };
+        const MipLevelData mipData(3u, data);
+        Texture2D* texture = anotherClient.createTexture2D(1u, 1u, ETextureFormat_RGB8, 1u, &mipData, false);
+        ASSERT_TRUE(texture != NULL);
+
+        EXPECT_NE(StatusOK, m_scene.prefetchResource(*texture));
+        EXPECT_TRUE(m_scene.impl.getIScene().getResourceChanges().m_prefetchedClientResources.empty());
+    }
+
     TEST_F(AScene, failsToCreateTextureSamplerWhenRenderTargetIsFromAnotherScene)
     {
         Scene& anotherScene = *client.createScene(12u);
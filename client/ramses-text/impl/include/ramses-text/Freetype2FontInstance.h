@@ -15,6 +15,7 @@
 #include "ramses-text/FontData.h"
 #include "ramses-text/CommonHashers.h"
 #include <unordered_map>
+#include <memory>
 
 namespace ramses
 {
@@ -36,6 +37,10 @@ namespace ramses
 
         GlyphId getGlyphId(char32_t character) const;
 
+        // Creates an instance with its own FT face from the same font data and settings. It shares no
+        // FreeType objects with this instance, so it can load glyphs on another thread using a separate FT library.
+        std::unique_ptr<Freetype2FontInstance> createCopy(FT_Library freetypeLib) const;
+
     protected:
         struct GlyphBitmapData;
 
@@ -49,6 +54,7 @@ namespace ramses
         const FontData&         m_font;
         FT_Face                 m_face = nullptr;
         FT_Size                 m_size = nullptr;
+        uint32_t                m_pixelSize = 0u;
         bool                    m_forceAutohinting = false;
         int                     m_height = 0;
         int                     m_ascender = 0;
@@ -38,6 +38,9 @@ namespace ramses
 
         const TextureSampler& getTextureSampler(size_t atlasPage) const;
 
+        size_t getPageCount() const;
+        float getFillRatio() const;
+
     private:
         GlyphTextureAtlas(const GlyphTextureAtlas&) = delete;
         GlyphTextureAtlas& operator=(const GlyphTextureAtlas&) = delete;
@@ -10,6 +10,10 @@
 #define RAMSES_GLYPHTEXTUREPAGE_H
 
 #include "ramses-text/Quad.h"
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <tuple>
 
 namespace ramses
 {
@@ -36,6 +40,7 @@ namespace ramses
         QuadOffset claimSpace(QuadIndex freeQuadIndex, const QuadSize& subportionSize);
         void releaseSpace(Quad quad);
         QuadIndex findFreeSpace(QuadSize const& size) const;
+        float getFillRatio() const;
 
         // Texture data management
         void updateDataWithPadding(const Quad& targetQuad, const uint8_t* sourceData, GlyphPageData& cacheForDataUpdate);
@@ -43,6 +48,19 @@ namespace ramses
         const TextureSampler& getSampler() const;
 
     private:
+        // Free quads are indexed by area (best fit search skips all smaller quads) and by their corners (for finding merge candidates),
+        // quads are removed from m_freeQuads by swapping with the last one so that indices stay valid
+        using AreaKey = std::tuple<uint32_t, uint32_t, uint32_t>;
+        using CornerKey = uint64_t;
+        static AreaKey GetAreaKey(const Quad& quad);
+        static CornerKey GetCornerKey(uint32_t x, uint32_t y);
+
+        void addFreeQuad(const Quad& quad);
+        void removeFreeQuad(QuadIndex index);
+        void indexFreeQuad(QuadIndex index);
+        void unindexFreeQuad(QuadIndex index);
+        bool findMergeCandidate(const Quad& quad, QuadIndex& candidateOut) const;
+
         bool mergeFreeQuad(Quad& freeQuadInAndOut);
         void copyPaddingToCache(const Quad& updateQuad, GlyphPageData& cacheForDataUpdate);
         void copyUpdateDataWithoutPaddingToCache(const Quad& updateQuad, const uint8_t* data, GlyphPageData& cacheForDataUpdate);
@@ -50,6 +68,13 @@ namespace ramses
 
         const QuadSize m_size;
         Quads m_freeQuads;
+        uint32_t m_freeArea = 0u;
+        std::map<AreaKey, QuadIndex> m_freeQuadsByArea;
+        std::multiset<uint32_t> m_freeQuadWidths;
+        std::multiset<uint32_t> m_freeQuadHeights;
+        std::unordered_map<CornerKey, QuadIndex> m_freeQuadsByTopLeft;
+        std::unordered_map<CornerKey, QuadIndex> m_freeQuadsByTopRight;
+        std::unordered_map<CornerKey, QuadIndex> m_freeQuadsByBottomLeft;
         Scene& m_ownerScene;
         Texture2DBuffer& m_textureBuffer;
         TextureSampler&  m_textureSampler;
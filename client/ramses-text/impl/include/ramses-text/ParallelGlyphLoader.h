@@ -0,0 +1,45 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_TEXT_PARALLELGLYPHLOADER_H
+#define RAMSES_TEXT_PARALLELGLYPHLOADER_H
+
+#include "ramses-text-api/Glyph.h"
+#include "ramses-text/Quad.h"
+#include "Utils/ParallelJobs.h"
+#include <vector>
+
+namespace ramses
+{
+    class Freetype2FontInstance;
+
+    // Loads glyph bitmaps of Freetype2 font instances on multiple threads. Every thread initializes its own
+    // FT library and creates its own copies of the font instances, so no FreeType object is shared between threads.
+    class ParallelGlyphLoader
+    {
+    public:
+        struct Job
+        {
+            const Freetype2FontInstance* fontInstance;
+            GlyphKey key;
+            QuadSize size;
+            GlyphData data;
+            bool loaded;
+        };
+        using Jobs = std::vector<Job>;
+
+        // threadCount 0 uses the number of hardware threads, jobs are never split among more threads than there are jobs.
+        // Jobs stay marked as not loaded if no thread could initialize FreeType.
+        static void LoadGlyphBitmaps(Jobs& jobs, uint32_t threadCount);
+
+    private:
+        static void LoadGlyphBitmapsOnCurrentThread(Jobs& jobs, ramses_internal::ParallelJobs::JobQueue& jobQueue);
+    };
+}
+
+#endif
@@ -0,0 +1,49 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_TEXT_TEXTBATCHALLOCATOR_H
+#define RAMSES_TEXT_TEXTBATCHALLOCATOR_H
+
+#include <stdint.h>
+#include <vector>
+#include <limits>
+
+namespace ramses
+{
+    // Sub-allocates contiguous ranges of glyph quads within the shared buffers of a text batch.
+    // Allocation is first-fit over free ranges sorted by offset, so packing is deterministic.
+    class TextBatchAllocator
+    {
+    public:
+        explicit TextBatchAllocator(uint32_t capacity);
+
+        uint32_t allocate(uint32_t count);
+        void release(uint32_t offset, uint32_t count);
+
+        // End of the highest allocated range, i.e. the number of quads which need to be drawn
+        uint32_t getUsedEnd() const;
+        uint32_t getAllocatedCount() const;
+        uint32_t getCapacity() const;
+
+        static const uint32_t InvalidOffset = std::numeric_limits<uint32_t>::max();
+
+    private:
+        struct Range
+        {
+            uint32_t offset;
+            uint32_t count;
+        };
+
+        const uint32_t m_capacity;
+        uint32_t m_usedEnd = 0u;
+        uint32_t m_allocatedCount = 0u;
+        std::vector<Range> m_freeRanges;
+    };
+}
+
+#endif
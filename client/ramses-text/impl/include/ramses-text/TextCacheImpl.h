@@ -10,17 +10,23 @@
 #define RAMSES_TEXTCACHEIMPL_H
 
 #include "ramses-text/GlyphTextureAtlas.h"
+#include "ramses-text/TextBatchAllocator.h"
 #include "ramses-text-api/TextLine.h"
 #include "ramses-text-api/FontInstanceOffsets.h"
 #include <unordered_map>
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace ramses
 {
     class Scene;
     class MeshNode;
     class Effect;
+    class Appearance;
+    class GeometryBinding;
+    class UniformInput;
+    class AttributeInput;
     class IFontAccessor;
 
     class TextCacheImpl
@@ -31,8 +37,11 @@ namespace ramses
 
         GlyphMetricsVector      getPositionedGlyphs(const std::u32string& str, FontInstanceId font);
         GlyphMetricsVector      getPositionedGlyphs(const std::u32string& str, const FontInstanceOffsets& fontOffsets);
+        bool                    preloadGlyphs(const std::u32string& characters, const std::vector<FontInstanceId>& fontInstances, uint32_t threadCount);
 
         TextLineId              createTextLine(const GlyphMetricsVector& glyphs, const Effect& effect);
+        TextLineId              createBatchedTextLine(const GlyphMetricsVector& glyphs, const Effect& effect, float offsetX, float offsetY);
+        bool                    updateTextLine(TextLineId textId, const GlyphMetricsVector& glyphs);
         TextLine const*         getTextLine(TextLineId textId) const;
         TextLine*               getTextLine(TextLineId textId);
         bool                    deleteTextLine(TextLineId textId);
@@ -43,6 +52,51 @@ namespace ramses
         TextCacheImpl(TextCacheImpl&&) = delete;
         TextCacheImpl& operator=(TextCacheImpl&&) = delete;
 
+        // Quads are indexed with 16 bit indices, 4 vertices per quad
+        static const uint32_t TextBatchCapacityInQuads = 4096u;
+
+        struct TextBatch
+        {
+            TextBatch(size_t atlasPage_, const Effect& effect_)
+                : atlasPage(atlasPage_)
+                , effect(effect_)
+                , allocator(TextBatchCapacityInQuads)
+            {
+            }
+
+            const size_t atlasPage;
+            const Effect& effect;
+            TextBatchAllocator allocator;
+            MeshNode* meshNode = nullptr;
+            Appearance* appearance = nullptr;
+            GeometryBinding* geometryBinding = nullptr;
+            VertexDataBuffer* positions = nullptr;
+            VertexDataBuffer* textureCoordinates = nullptr;
+            IndexDataBuffer* indices = nullptr;
+        };
+
+        struct BatchedTextLine
+        {
+            TextBatch* batch;
+            uint32_t firstQuad;
+            uint32_t quadCount;
+            float offsetX;
+            float offsetY;
+        };
+
+        bool registerMissingGlyphs(const GlyphMetricsVector& glyphs);
+        static bool FindTextInputs(const Effect& effect, UniformInput& texInput, AttributeInput& posInput, AttributeInput& texCoordInput);
+
+        TextBatch* createTextBatch(size_t atlasPage, const Effect& effect);
+        void destroyTextBatch(TextBatch& batch);
+        void destroyTextBatchObjects(TextBatch& batch);
+        bool allocateInTextBatch(size_t atlasPage, const Effect& effect, uint32_t quadCount, BatchedTextLine& batchedLineOut);
+        void releaseFromTextBatch(const BatchedTextLine& batchedLine);
+        void writeBatchedGeometry(const BatchedTextLine& batchedLine, const GlyphGeometry& geometry);
+        void assignBatchToTextLine(const TextBatch& batch, TextLine& textLine);
+        bool updateBatchedTextLine(TextLine& textLine, BatchedTextLine& batchedLine, const GlyphGeometry& geometry);
+        bool updateUnbatchedTextLine(TextLine& textLine, const GlyphGeometry& geometry);
+
         Scene& m_scene;
         IFontAccessor& m_fontAccessor;
         GlyphTextureAtlas m_textureAtlas;
@@ -50,6 +104,9 @@ namespace ramses
         using Texts = std::unordered_map<TextLineId, TextLine>;
         Texts m_textLines;
 
+        std::vector<std::unique_ptr<TextBatch>> m_textBatches;
+        std::unordered_map<TextLineId, BatchedTextLine> m_batchedTextLines;
+
         TextLineId m_textIdCounter{ 0u };
     };
 }
@@ -18,6 +18,7 @@ namespace ramses
     Freetype2FontInstance::Freetype2FontInstance(FontInstanceId id, FT_Library freetypeLib, const FontData& font, uint32_t pixelSize, bool forceAutohinting)
         : m_id(id)
         , m_font(font)
+        , m_pixelSize(pixelSize)
         , m_forceAutohinting(forceAutohinting)
     {
         // TODO Violin check if face has to be created per instance, or is enough to have it per font
@@ -77,6 +78,11 @@ namespace ramses
             FT_Done_Face(m_face);
     }
 
+    std::unique_ptr<Freetype2FontInstance> Freetype2FontInstance::createCopy(FT_Library freetypeLib) const
+    {
+        return std::unique_ptr<Freetype2FontInstance>{ new Freetype2FontInstance(m_id, freetypeLib, m_font, m_pixelSize, m_forceAutohinting) };
+    }
+
     void Freetype2FontInstance::loadAndAppendGlyphMetrics(std::u32string::const_iterator charsBegin, std::u32string::const_iterator charsEnd, GlyphMetricsVector& positionedGlyphs)
     {
         activateSize();
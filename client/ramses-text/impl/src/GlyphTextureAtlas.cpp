@@ -259,4 +259,21 @@ namespace ramses
     {
         return getPage(atlasPage).getSampler();
     }
+
+    size_t GlyphTextureAtlas::getPageCount() const
+    {
+        return m_glyphAtlasPages.size();
+    }
+
+    float GlyphTextureAtlas::getFillRatio() const
+    {
+        if (m_glyphAtlasPages.empty())
+            return 0.f;
+
+        // all pages have same size, so the atlas fill ratio is the average of the page fill ratios
+        float fillRatioSum = 0.f;
+        for (const auto& page : m_glyphAtlasPages)
+            fillRatioSum += page->getFillRatio();
+        return fillRatioSum / static_cast<float>(m_glyphAtlasPages.size());
+    }
 }
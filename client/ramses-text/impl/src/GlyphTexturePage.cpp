@@ -11,25 +11,9 @@
 #include "ramses-client-api/TextureSampler.h"
 #include "ramses-client-api/Texture2DBuffer.h"
 #include <assert.h>
+#include <limits>
 
 
-namespace
-{
-    bool CanFitQuadInFreeSpace(const ramses::QuadSize& freeSpace, const ramses::QuadSize& quadToFit, uint32_t& remainingSpaceOut)
-    {
-        const bool canFit = freeSpace.x >= quadToFit.x && freeSpace.y >= quadToFit.y;
-        if (!canFit)
-        {
-            return false;
-        }
-        else
-        {
-            remainingSpaceOut = freeSpace.getArea() - quadToFit.getArea();
-            return true;
-        }
-    }
-}
-
 namespace ramses
 {
     GlyphTexturePage::GlyphTexturePage(Scene& scene, const QuadSize& size)
@@ -47,7 +31,7 @@ namespace ramses
             ETextureSamplingMethod_Bilinear,
             m_textureBuffer))
     {
-        m_freeQuads.push_back(Quad(QuadOffset(0, 0), size));
+        addFreeQuad(Quad(QuadOffset(0, 0), size));
     }
 
     GlyphTexturePage::~GlyphTexturePage()
@@ -98,7 +82,7 @@ namespace ramses
         const Quad box = m_freeQuads[freeQuadIndex];
         assert(subportionSize.y <= box.getSize().y && subportionSize.x <= box.getSize().x);
 
-        m_freeQuads.erase(m_freeQuads.begin() + freeQuadIndex);
+        removeFreeQuad(freeQuadIndex);
 
         const uint32_t px = box.getOrigin().x;
         const uint32_t py = box.getOrigin().y;
@@ -143,25 +127,121 @@ namespace ramses
         }));
 
         while (mergeFreeQuad(box));
-        m_freeQuads.push_back(box);
+        addFreeQuad(box);
     }
 
     // TODO Violin fix this, make it not have an "in and out" parameter
     bool GlyphTexturePage::mergeFreeQuad(Quad& freeQuadInAndOut)
     {
-        const uint32_t n = uint32_t(m_freeQuads.size());
-        for (uint32_t i = 0; i < n; i++)
+        QuadIndex candidate;
+        if (!findMergeCandidate(freeQuadInAndOut, candidate))
+            return false;
+
+        const bool merged = freeQuadInAndOut.merge(m_freeQuads[candidate]);
+        assert(merged);
+        (void)merged;
+        removeFreeQuad(candidate);
+        return true;
+    }
+
+    bool GlyphTexturePage::findMergeCandidate(const Quad& quad, QuadIndex& candidateOut) const
+    {
+        const uint32_t minX = quad.getOrigin().x;
+        const uint32_t minY = quad.getOrigin().y;
+        const uint32_t maxX = minX + quad.getSize().x;
+        const uint32_t maxY = minY + quad.getSize().y;
+
+        // neighbor to the right or below starts at our top right or bottom left corner
+        auto it = m_freeQuadsByTopLeft.find(GetCornerKey(maxX, minY));
+        if (it != m_freeQuadsByTopLeft.end() && m_freeQuads[it->second].getSize().y == quad.getSize().y)
         {
-            Quad& box2 = m_freeQuads[i];
-            if (freeQuadInAndOut.merge(box2))
-            {
-                m_freeQuads.erase(m_freeQuads.begin() + i);
-                return true;
-            }
+            candidateOut = it->second;
+            return true;
+        }
+        it = m_freeQuadsByTopLeft.find(GetCornerKey(minX, maxY));
+        if (it != m_freeQuadsByTopLeft.end() && m_freeQuads[it->second].getSize().x == quad.getSize().x)
+        {
+            candidateOut = it->second;
+            return true;
         }
+
+        // neighbor to the left or above ends at our top left corner
+        it = m_freeQuadsByTopRight.find(GetCornerKey(minX, minY));
+        if (it != m_freeQuadsByTopRight.end() && m_freeQuads[it->second].getSize().y == quad.getSize().y)
+        {
+            candidateOut = it->second;
+            return true;
+        }
+        it = m_freeQuadsByBottomLeft.find(GetCornerKey(minX, minY));
+        if (it != m_freeQuadsByBottomLeft.end() && m_freeQuads[it->second].getSize().x == quad.getSize().x)
+        {
+            candidateOut = it->second;
+            return true;
+        }
+
         return false;
     }
 
+    GlyphTexturePage::AreaKey GlyphTexturePage::GetAreaKey(const Quad& quad)
+    {
+        // free quads never overlap, so the origin makes the key unique and the order deterministic
+        return AreaKey{ quad.getSize().getArea(), quad.getOrigin().y, quad.getOrigin().x };
+    }
+
+    GlyphTexturePage::CornerKey GlyphTexturePage::GetCornerKey(uint32_t x, uint32_t y)
+    {
+        return (CornerKey(x) << 32u) | y;
+    }
+
+    void GlyphTexturePage::addFreeQuad(const Quad& quad)
+    {
+        m_freeQuads.push_back(quad);
+        m_freeArea += quad.getSize().getArea();
+        indexFreeQuad(m_freeQuads.size() - 1u);
+    }
+
+    void GlyphTexturePage::removeFreeQuad(QuadIndex index)
+    {
+        assert(index < m_freeQuads.size());
+        m_freeArea -= m_freeQuads[index].getSize().getArea();
+        unindexFreeQuad(index);
+
+        const QuadIndex lastIndex = m_freeQuads.size() - 1u;
+        if (index != lastIndex)
+        {
+            unindexFreeQuad(lastIndex);
+            m_freeQuads[index] = m_freeQuads[lastIndex];
+            indexFreeQuad(index);
+        }
+        m_freeQuads.pop_back();
+    }
+
+    void GlyphTexturePage::indexFreeQuad(QuadIndex index)
+    {
+        const Quad& quad = m_freeQuads[index];
+        const QuadOffset& origin = quad.getOrigin();
+        const QuadSize& size = quad.getSize();
+        m_freeQuadsByArea[GetAreaKey(quad)] = index;
+        m_freeQuadWidths.insert(size.x);
+        m_freeQuadHeights.insert(size.y);
+        m_freeQuadsByTopLeft[GetCornerKey(origin.x, origin.y)] = index;
+        m_freeQuadsByTopRight[GetCornerKey(origin.x + size.x, origin.y)] = index;
+        m_freeQuadsByBottomLeft[GetCornerKey(origin.x, origin.y + size.y)] = index;
+    }
+
+    void GlyphTexturePage::unindexFreeQuad(QuadIndex index)
+    {
+        const Quad& quad = m_freeQuads[index];
+        const QuadOffset& origin = quad.getOrigin();
+        const QuadSize& size = quad.getSize();
+        m_freeQuadsByArea.erase(GetAreaKey(quad));
+        m_freeQuadWidths.erase(m_freeQuadWidths.find(size.x));
+        m_freeQuadHeights.erase(m_freeQuadHeights.find(size.y));
+        m_freeQuadsByTopLeft.erase(GetCornerKey(origin.x, origin.y));
+        m_freeQuadsByTopRight.erase(GetCornerKey(origin.x + size.x, origin.y));
+        m_freeQuadsByBottomLeft.erase(GetCornerKey(origin.x, origin.y + size.y));
+    }
+
     void GlyphTexturePage::copyPaddingToCache(const Quad& updateQuad, GlyphPageData& cacheForDataUpdate)
     {
         const uint32_t targetRowCount = updateQuad.getSize().y;
@@ -212,27 +292,26 @@ namespace ramses
         assert(size.getArea() > 0);
         assert(size.x <= m_size.x && size.y <= m_size.y);
 
-        uint32_t scoreOfBestFit = std::numeric_limits<uint32_t>::max();
-        GlyphTexturePage::QuadIndex bestQuadIndex = std::numeric_limits<GlyphTexturePage::QuadIndex>::max();
+        // no free quad is wide or high enough
+        if (m_freeQuads.empty() || *m_freeQuadWidths.rbegin() < size.x || *m_freeQuadHeights.rbegin() < size.y)
+            return std::numeric_limits<GlyphTexturePage::QuadIndex>::max();
 
-        for (GlyphTexturePage::QuadIndex i = 0; i < m_freeQuads.size(); i++)
+        // Best fit is the smallest free quad which can hold the requested size in both dimensions.
+        // Free quads with smaller area can never hold it, so the search starts at the requested area. Larger quads
+        // of unsuitable shape are still visited, so in the worst case all free quads are checked.
+        const AreaKey smallestCandidate{ size.getArea(), 0u, 0u };
+        for (auto it = m_freeQuadsByArea.lower_bound(smallestCandidate); it != m_freeQuadsByArea.end(); ++it)
         {
-            uint32_t newScore;
-            const bool canFit = CanFitQuadInFreeSpace(m_freeQuads[i].getSize(), size, newScore);
-            if (canFit)
-            {
-                const bool fitsBetter = (newScore < scoreOfBestFit);
-                if (fitsBetter)
-                {
-                    bestQuadIndex = i;
-                    scoreOfBestFit = newScore;
-                }
-
-                if (scoreOfBestFit == 0)
-                    break;
-            }
+            const QuadSize& freeSize = m_freeQuads[it->second].getSize();
+            if (freeSize.x >= size.x && freeSize.y >= size.y)
+                return it->second;
         }
 
-        return bestQuadIndex;
+        return std::numeric_limits<GlyphTexturePage::QuadIndex>::max();
+    }
+
+    float GlyphTexturePage::getFillRatio() const
+    {
+        return 1.f - static_cast<float>(m_freeArea) / static_cast<float>(m_size.getArea());
     }
 }
@@ -0,0 +1,56 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "ramses-text/ParallelGlyphLoader.h"
+#include "ramses-text/Freetype2FontInstance.h"
+#include "ramses-text/Logger.h"
+#include <unordered_map>
+#include <memory>
+
+namespace ramses
+{
+    void ParallelGlyphLoader::LoadGlyphBitmaps(Jobs& jobs, uint32_t threadCount)
+    {
+        if (jobs.empty())
+            return;
+
+        // every participating thread loads with its own FreeType objects
+        ramses_internal::ParallelJobs::ExecuteWorkers(static_cast<uint32_t>(jobs.size()), [&jobs](ramses_internal::ParallelJobs::JobQueue& jobQueue)
+        {
+            LoadGlyphBitmapsOnCurrentThread(jobs, jobQueue);
+        }, threadCount);
+    }
+
+    void ParallelGlyphLoader::LoadGlyphBitmapsOnCurrentThread(Jobs& jobs, ramses_internal::ParallelJobs::JobQueue& jobQueue)
+    {
+        FT_Library freetypeLib = nullptr;
+        const int32_t error = FT_Init_FreeType(&freetypeLib);
+        if (error != 0)
+        {
+            LOG_TEXT_ERROR("ParallelGlyphLoader: Failed to initialize FreeType with error " << error);
+            return;
+        }
+
+        {
+            std::unordered_map<FontInstanceId, std::unique_ptr<Freetype2FontInstance>> fontInstanceCopies;
+            uint32_t jobIdx = 0u;
+            while (jobQueue.takeJob(jobIdx))
+            {
+                Job& job = jobs[jobIdx];
+                auto& fontInstanceCopy = fontInstanceCopies[job.key.fontInstanceId];
+                if (!fontInstanceCopy)
+                    fontInstanceCopy = job.fontInstance->createCopy(freetypeLib);
+
+                job.data = fontInstanceCopy->loadGlyphBitmapData(job.key.identifier, job.size.x, job.size.y);
+                job.loaded = true;
+            }
+        }
+
+        FT_Done_FreeType(freetypeLib);
+    }
+}
@@ -0,0 +1,106 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "ramses-text/TextBatchAllocator.h"
+#include <assert.h>
+#include <algorithm>
+
+namespace ramses
+{
+    const uint32_t TextBatchAllocator::InvalidOffset;
+
+    TextBatchAllocator::TextBatchAllocator(uint32_t capacity)
+        : m_capacity(capacity)
+    {
+    }
+
+    uint32_t TextBatchAllocator::allocate(uint32_t count)
+    {
+        if (count == 0u)
+            return InvalidOffset;
+
+        for (auto it = m_freeRanges.begin(); it != m_freeRanges.end(); ++it)
+        {
+            if (it->count >= count)
+            {
+                const uint32_t offset = it->offset;
+                it->offset += count;
+                it->count -= count;
+                if (it->count == 0u)
+                    m_freeRanges.erase(it);
+                m_allocatedCount += count;
+                return offset;
+            }
+        }
+
+        if (m_capacity - m_usedEnd < count)
+            return InvalidOffset;
+
+        const uint32_t offset = m_usedEnd;
+        m_usedEnd += count;
+        m_allocatedCount += count;
+        return offset;
+    }
+
+    void TextBatchAllocator::release(uint32_t offset, uint32_t count)
+    {
+        if (count == 0u)
+            return;
+
+        assert(offset + count <= m_usedEnd);
+        assert(m_allocatedCount >= count);
+        m_allocatedCount -= count;
+
+        auto it = std::lower_bound(m_freeRanges.begin(), m_freeRanges.end(), offset, [](const Range& range, uint32_t value)
+        {
+            return range.offset < value;
+        });
+        it = m_freeRanges.insert(it, Range{ offset, count });
+
+        // merge with successor
+        const auto next = std::next(it);
+        if (next != m_freeRanges.end() && it->offset + it->count == next->offset)
+        {
+            it->count += next->count;
+            it = std::prev(m_freeRanges.erase(next));
+        }
+
+        // merge with predecessor
+        if (it != m_freeRanges.begin())
+        {
+            const auto prev = std::prev(it);
+            if (prev->offset + prev->count == it->offset)
+            {
+                prev->count += it->count;
+                it = std::prev(m_freeRanges.erase(it));
+            }
+        }
+
+        // trailing free range shrinks used area
+        if (it->offset + it->count == m_usedEnd)
+        {
+            m_usedEnd = it->offset;
+            m_freeRanges.erase(it);
+        }
+    }
+
+    uint32_t TextBatchAllocator::getUsedEnd() const
+    {
+        return m_usedEnd;
+    }
+
+    uint32_t TextBatchAllocator::getAllocatedCount() const
+    {
+        return m_allocatedCount;
+    }
+
+    uint32_t TextBatchAllocator::getCapacity() const
+    {
+        return m_capacity;
+    }
+}
@@ -11,6 +11,8 @@
 #include "ramses-text-api/IFontAccessor.h"
 #include "ramses-text-api/IFontInstance.h"
 #include "ramses-text/Logger.h"
+#include "ramses-text/Freetype2FontInstance.h"
+#include "ramses-text/ParallelGlyphLoader.h"
 
 #include "ramses-client-api/Scene.h"
 #include "ramses-client-api/MeshNode.h"
@@ -24,6 +26,10 @@
 
 #include <iostream>
 #include <limits>
+#include <unordered_set>
+#include <iterator>
+#include <algorithm>
+#include <assert.h>
 
 namespace ramses
 {
@@ -61,26 +67,16 @@ namespace ramses
         return getPositionedGlyphs(str, { { font, 0u } });
     }
 
-    TextLineId TextCacheImpl::createTextLine(const GlyphMetricsVector& glyphs, const Effect& effect)
+    bool TextCacheImpl::FindTextInputs(const Effect& effect, UniformInput& texInput, AttributeInput& posInput, AttributeInput& texCoordInput)
     {
-        if (glyphs.empty())
-        {
-            LOG_TEXT_ERROR("TextCache::createTextLine failed - cannot create text geometry for empty string");
-            return InvalidTextLineId;
-        }
-
-        UniformInput texInput;
-        AttributeInput posInput;
-        AttributeInput texCoordInput;
         effect.findUniformInput(EEffectUniformSemantic_TextTexture, texInput);
         effect.findAttributeInput(EEffectAttributeSemantic_TextPositions, posInput);
         effect.findAttributeInput(EEffectAttributeSemantic_TextTextureCoordinates, texCoordInput);
-        if (!texInput.isValid() || !posInput.isValid() || !texCoordInput.isValid())
-        {
-            LOG_TEXT_ERROR("TextCache::createTextLine failed - text appearance effect must provide inputs for positions and coordinates attributes and a texture uniform");
-            return InvalidTextLineId;
-        }
+        return texInput.isValid() && posInput.isValid() && texCoordInput.isValid();
+    }
 
+    bool TextCacheImpl::registerMissingGlyphs(const GlyphMetricsVector& glyphs)
+    {
         for (const auto& glyph : glyphs)
         {
             if (!m_textureAtlas.isGlyphRegistered(glyph.key))
@@ -88,8 +84,8 @@ namespace ramses
                 IFontInstance* fontInstance = m_fontAccessor.getFontInstance(glyph.key.fontInstanceId);
                 if (fontInstance == nullptr)
                 {
-                    LOG_TEXT_ERROR("TextCache::createTextLine: Could not find font instance " << glyph.key.fontInstanceId.getValue());
-                    return InvalidTextLineId;
+                    LOG_TEXT_ERROR("TextCache: Could not find font instance " << glyph.key.fontInstanceId.getValue());
+                    return false;
                 }
                 QuadSize glyphSize;
                 GlyphData data = fontInstance->loadGlyphBitmapData(glyph.key.identifier, glyphSize.x, glyphSize.y);
@@ -97,6 +93,83 @@ namespace ramses
             }
         }
 
+        return true;
+    }
+
+    bool TextCacheImpl::preloadGlyphs(const std::u32string& characters, const std::vector<FontInstanceId>& fontInstances, uint32_t threadCount)
+    {
+        ParallelGlyphLoader::Jobs jobs;
+        GlyphMetricsVector glyphsToLoadSequentially;
+        std::unordered_set<GlyphKey> glyphsToLoad;
+
+        for (const auto& fontInstanceId : fontInstances)
+        {
+            IFontInstance* fontInstance = m_fontAccessor.getFontInstance(fontInstanceId);
+            if (fontInstance == nullptr)
+            {
+                LOG_TEXT_ERROR("TextCache::preloadGlyphs failed - could not find font instance " << fontInstanceId.getValue());
+                return false;
+            }
+
+            std::u32string supportedCharacters;
+            std::copy_if(characters.cbegin(), characters.cend(), std::back_inserter(supportedCharacters), [fontInstance](char32_t character)
+            {
+                return fontInstance->supportsCharacter(character);
+            });
+
+            // shaping and metrics stay on calling thread, they fill caches of the font instance which are used for layouting later
+            GlyphMetricsVector glyphs;
+            fontInstance->loadAndAppendGlyphMetrics(supportedCharacters.cbegin(), supportedCharacters.cend(), glyphs);
+
+            // only Freetype2 based font instances can be copied for loading on other threads
+            const Freetype2FontInstance* freetype2FontInstance = dynamic_cast<const Freetype2FontInstance*>(fontInstance);
+            for (const auto& glyph : glyphs)
+            {
+                if (m_textureAtlas.isGlyphRegistered(glyph.key) || !glyphsToLoad.insert(glyph.key).second)
+                    continue;
+
+                if (freetype2FontInstance != nullptr)
+                    jobs.push_back({ freetype2FontInstance, glyph.key, QuadSize(), GlyphData(), false });
+                else
+                    glyphsToLoadSequentially.push_back(glyph);
+            }
+        }
+
+        ParallelGlyphLoader::LoadGlyphBitmaps(jobs, threadCount);
+
+        for (auto& job : jobs)
+        {
+            // glyphs which failed to load are loaded again on demand when creating text line
+            if (job.loaded)
+                m_textureAtlas.registerGlyph(job.key, job.size, std::move(job.data));
+        }
+
+        return registerMissingGlyphs(glyphsToLoadSequentially);
+    }
+
+    TextLineId TextCacheImpl::createTextLine(const GlyphMetricsVector& glyphs, const Effect& effect)
+    {
+        if (glyphs.empty())
+        {
+            LOG_TEXT_ERROR("TextCache::createTextLine failed - cannot create text geometry for empty string");
+            return InvalidTextLineId;
+        }
+
+        UniformInput texInput;
+        AttributeInput posInput;
+        AttributeInput texCoordInput;
+        if (!FindTextInputs(effect, texInput, posInput, texCoordInput))
+        {
+            LOG_TEXT_ERROR("TextCache::createTextLine failed - text appearance effect must provide inputs for positions and coordinates attributes and a texture uniform");
+            return InvalidTextLineId;
+        }
+
+        if (!registerMissingGlyphs(glyphs))
+        {
+            LOG_TEXT_ERROR("TextCache::createTextLine failed - could not load glyphs");
+            return InvalidTextLineId;
+        }
+
         const GlyphGeometry geometry = m_textureAtlas.mapGlyphsAndCreateGeometry(glyphs);
         if (geometry.atlasPage == std::numeric_limits<decltype(geometry.atlasPage)>::max() || geometry.indices.empty())
         {
@@ -150,6 +223,345 @@ namespace ramses
         return textLineId;
     }
 
+    TextLineId TextCacheImpl::createBatchedTextLine(const GlyphMetricsVector& glyphs, const Effect& effect, float offsetX, float offsetY)
+    {
+        if (glyphs.empty())
+        {
+            LOG_TEXT_ERROR("TextCache::createBatchedTextLine failed - cannot create text geometry for empty string");
+            return InvalidTextLineId;
+        }
+
+        UniformInput texInput;
+        AttributeInput posInput;
+        AttributeInput texCoordInput;
+        if (!FindTextInputs(effect, texInput, posInput, texCoordInput))
+        {
+            LOG_TEXT_ERROR("TextCache::createBatchedTextLine failed - text appearance effect must provide inputs for positions and coordinates attributes and a texture uniform");
+            return InvalidTextLineId;
+        }
+
+        if (!registerMissingGlyphs(glyphs))
+        {
+            LOG_TEXT_ERROR("TextCache::createBatchedTextLine failed - could not load glyphs");
+            return InvalidTextLineId;
+        }
+
+        const GlyphGeometry geometry = m_textureAtlas.mapGlyphsAndCreateGeometry(glyphs);
+        if (geometry.atlasPage == std::numeric_limits<decltype(geometry.atlasPage)>::max() || geometry.indices.empty())
+        {
+            LOG_TEXT_ERROR("TextCache::createBatchedTextLine failed - glyphs could not be mapped in atlas");
+            return InvalidTextLineId;
+        }
+
+        const uint32_t quadCount = static_cast<uint32_t>(geometry.indices.size() / 6u);
+        BatchedTextLine batchedLine{ nullptr, 0u, 0u, offsetX, offsetY };
+        if (!allocateInTextBatch(geometry.atlasPage, effect, quadCount, batchedLine))
+        {
+            LOG_TEXT_ERROR("TextCache::createBatchedTextLine failed - could not allocate space for " << quadCount << " glyphs in text batch");
+            m_textureAtlas.unmapGlyphsFromPage(glyphs, geometry.atlasPage);
+            return InvalidTextLineId;
+        }
+        writeBatchedGeometry(batchedLine, geometry);
+
+        auto textLineId = m_textIdCounter;
+        m_textIdCounter.getReference()++;
+
+        TextLine& textLine = m_textLines[textLineId];
+        textLine.glyphs = glyphs;
+        assignBatchToTextLine(*batchedLine.batch, textLine);
+        m_batchedTextLines.insert(std::make_pair(textLineId, batchedLine));
+
+        return textLineId;
+    }
+
+    bool TextCacheImpl::updateTextLine(TextLineId textId, const GlyphMetricsVector& glyphs)
+    {
+        const auto textLineIt = m_textLines.find(textId);
+        if (textLineIt == m_textLines.end())
+        {
+            LOG_TEXT_ERROR("TextCache::updateTextLine: Cannot update text line " << textId.getValue() << ", no such entry");
+            return false;
+        }
+
+        if (glyphs.empty())
+        {
+            LOG_TEXT_ERROR("TextCache::updateTextLine failed - cannot create text geometry for empty string");
+            return false;
+        }
+
+        if (!registerMissingGlyphs(glyphs))
+        {
+            LOG_TEXT_ERROR("TextCache::updateTextLine failed - could not load glyphs");
+            return false;
+        }
+
+        // map new glyphs before unmapping old ones so that glyphs common to both stay on their page
+        const GlyphGeometry geometry = m_textureAtlas.mapGlyphsAndCreateGeometry(glyphs);
+        if (geometry.atlasPage == std::numeric_limits<decltype(geometry.atlasPage)>::max() || geometry.indices.empty())
+        {
+            LOG_TEXT_ERROR("TextCache::updateTextLine failed - glyphs could not be mapped in atlas");
+            return false;
+        }
+
+        TextLine& textLine = textLineIt->second;
+        const size_t previousAtlasPage = textLine.atlasPage;
+        const auto batchedLineIt = m_batchedTextLines.find(textId);
+        const bool updated = (batchedLineIt != m_batchedTextLines.end()) ?
+            updateBatchedTextLine(textLine, batchedLineIt->second, geometry) :
+            updateUnbatchedTextLine(textLine, geometry);
+
+        if (!updated)
+        {
+            m_textureAtlas.unmapGlyphsFromPage(glyphs, geometry.atlasPage);
+            return false;
+        }
+
+        m_textureAtlas.unmapGlyphsFromPage(textLine.glyphs, previousAtlasPage);
+        textLine.glyphs = glyphs;
+        textLine.atlasPage = geometry.atlasPage;
+
+        return true;
+    }
+
+    bool TextCacheImpl::updateBatchedTextLine(TextLine& textLine, BatchedTextLine& batchedLine, const GlyphGeometry& geometry)
+    {
+        const uint32_t quadCount = static_cast<uint32_t>(geometry.indices.size() / 6u);
+        if (geometry.atlasPage == batchedLine.batch->atlasPage && quadCount <= batchedLine.quadCount)
+        {
+            // fits into already allocated range, unused quads are collapsed by writeBatchedGeometry
+            writeBatchedGeometry(batchedLine, geometry);
+            return true;
+        }
+
+        BatchedTextLine newBatchedLine{ nullptr, 0u, 0u, batchedLine.offsetX, batchedLine.offsetY };
+        if (!allocateInTextBatch(geometry.atlasPage, batchedLine.batch->effect, quadCount, newBatchedLine))
+        {
+            LOG_TEXT_ERROR("TextCache::updateTextLine failed - could not allocate space for " << quadCount << " glyphs in text batch");
+            return false;
+        }
+        writeBatchedGeometry(newBatchedLine, geometry);
+        releaseFromTextBatch(batchedLine);
+
+        batchedLine = newBatchedLine;
+        assignBatchToTextLine(*batchedLine.batch, textLine);
+
+        return true;
+    }
+
+    bool TextCacheImpl::updateUnbatchedTextLine(TextLine& textLine, const GlyphGeometry& geometry)
+    {
+        GeometryBinding& geometryBinding = *textLine.meshNode->getGeometryBinding();
+        UniformInput texInput;
+        AttributeInput posInput;
+        AttributeInput texCoordInput;
+        if (!FindTextInputs(geometryBinding.getEffect(), texInput, posInput, texCoordInput))
+        {
+            LOG_TEXT_ERROR("TextCache::updateTextLine failed - text appearance effect must provide inputs for positions and coordinates attributes and a texture uniform");
+            return false;
+        }
+
+        const uint32_t numIndices = static_cast<uint32_t>(geometry.indices.size());
+        const uint32_t indicesByteSize = numIndices * sizeof(geometry.indices[0]);
+        const uint32_t numVertexElements = static_cast<uint32_t>(geometry.positions.size());
+        const uint32_t positionsDataSize = numVertexElements * sizeof(geometry.positions[0]);
+        const uint32_t texCoordsDataSize = numVertexElements * sizeof(geometry.texcoords[0]);
+
+        // reuse existing buffers if the new text fits, otherwise replace them
+        if (indicesByteSize > textLine.indices->getMaximumSizeInBytes())
+        {
+            IndexDataBuffer* indices = m_scene.createIndexDataBuffer(indicesByteSize, ramses::EDataType_UInt16, "");
+            geometryBinding.setIndices(*indices);
+            m_scene.destroy(*textLine.indices);
+            textLine.indices = indices;
+        }
+        if (positionsDataSize > textLine.positions->getMaximumSizeInBytes())
+        {
+            VertexDataBuffer* positions = m_scene.createVertexDataBuffer(positionsDataSize, ramses::EDataType_Vector2F, "");
+            geometryBinding.setInputBuffer(posInput, *positions);
+            m_scene.destroy(*textLine.positions);
+            textLine.positions = positions;
+        }
+        if (texCoordsDataSize > textLine.textureCoordinates->getMaximumSizeInBytes())
+        {
+            VertexDataBuffer* textureCoordinates = m_scene.createVertexDataBuffer(texCoordsDataSize, ramses::EDataType_Vector2F, "");
+            geometryBinding.setInputBuffer(texCoordInput, *textureCoordinates);
+            m_scene.destroy(*textLine.textureCoordinates);
+            textLine.textureCoordinates = textureCoordinates;
+        }
+
+        textLine.indices->setData(reinterpret_cast<const char*>(geometry.indices.data()), indicesByteSize);
+        textLine.positions->setData(reinterpret_cast<const char*>(geometry.positions.data()), positionsDataSize);
+        textLine.textureCoordinates->setData(reinterpret_cast<const char*>(geometry.texcoords.data()), texCoordsDataSize);
+        textLine.meshNode->setIndexCount(numIndices);
+
+        if (geometry.atlasPage != textLine.atlasPage)
+            textLine.meshNode->getAppearance()->setInputTexture(texInput, m_textureAtlas.getTextureSampler(geometry.atlasPage));
+
+        return true;
+    }
+
+    TextCacheImpl::TextBatch* TextCacheImpl::createTextBatch(size_t atlasPage, const Effect& effect)
+    {
+        UniformInput texInput;
+        AttributeInput posInput;
+        AttributeInput texCoordInput;
+        if (!FindTextInputs(effect, texInput, posInput, texCoordInput))
+            return nullptr;
+
+        const uint32_t vertexDataSize = TextBatchCapacityInQuads * 8u * sizeof(float);
+        const uint32_t indicesByteSize = TextBatchCapacityInQuads * 6u * sizeof(uint16_t);
+        std::unique_ptr<TextBatch> batch(new TextBatch(atlasPage, effect));
+        batch->geometryBinding = m_scene.createGeometryBinding(effect);
+        batch->appearance = m_scene.createAppearance(effect);
+        batch->meshNode = m_scene.createMeshNode();
+        batch->indices = m_scene.createIndexDataBuffer(indicesByteSize, ramses::EDataType_UInt16, "");
+        batch->positions = m_scene.createVertexDataBuffer(vertexDataSize, ramses::EDataType_Vector2F, "");
+        batch->textureCoordinates = m_scene.createVertexDataBuffer(vertexDataSize, ramses::EDataType_Vector2F, "");
+        if (batch->geometryBinding == nullptr || batch->appearance == nullptr || batch->meshNode == nullptr ||
+            batch->indices == nullptr || batch->positions == nullptr || batch->textureCoordinates == nullptr)
+        {
+            LOG_TEXT_ERROR("TextCache: failed to create scene objects for text batch, check Ramses logs for more details");
+            destroyTextBatchObjects(*batch);
+            return nullptr;
+        }
+
+        // index data is the same for all quads and is written once for the whole batch capacity
+        std::vector<uint16_t> indices;
+        indices.reserve(TextBatchCapacityInQuads * 6u);
+        for (uint32_t quad = 0u; quad < TextBatchCapacityInQuads; ++quad)
+        {
+            const uint16_t firstVertex = static_cast<uint16_t>(quad * 4u);
+            indices.push_back(firstVertex + 2u);
+            indices.push_back(firstVertex + 1u);
+            indices.push_back(firstVertex);
+            indices.push_back(firstVertex + 3u);
+            indices.push_back(firstVertex + 2u);
+            indices.push_back(firstVertex);
+        }
+        assert(indicesByteSize == indices.size() * sizeof(indices[0]));
+        batch->indices->setData(reinterpret_cast<const char*>(indices.data()), indicesByteSize);
+
+        batch->meshNode->setStartIndex(0);
+
+        batch->geometryBinding->setIndices(*batch->indices);
+        batch->geometryBinding->setInputBuffer(posInput, *batch->positions);
+        batch->geometryBinding->setInputBuffer(texCoordInput, *batch->textureCoordinates);
+
+        batch->appearance->setInputTexture(texInput, m_textureAtlas.getTextureSampler(atlasPage));
+
+        batch->meshNode->setAppearance(*batch->appearance);
+        batch->meshNode->setGeometryBinding(*batch->geometryBinding);
+
+        m_textBatches.push_back(std::move(batch));
+        return m_textBatches.back().get();
+    }
+
+    void TextCacheImpl::destroyTextBatch(TextBatch& batch)
+    {
+        destroyTextBatchObjects(batch);
+
+        const auto it = std::find_if(m_textBatches.begin(), m_textBatches.end(), [&batch](const std::unique_ptr<TextBatch>& b) { return b.get() == &batch; });
+        assert(it != m_textBatches.end());
+        m_textBatches.erase(it);
+    }
+
+    void TextCacheImpl::destroyTextBatchObjects(TextBatch& batch)
+    {
+        if (batch.meshNode != nullptr)
+            m_scene.destroy(*batch.meshNode);
+        if (batch.geometryBinding != nullptr)
+            m_scene.destroy(*batch.geometryBinding);
+        if (batch.appearance != nullptr)
+            m_scene.destroy(*batch.appearance);
+        if (batch.positions != nullptr)
+            m_scene.destroy(*batch.positions);
+        if (batch.textureCoordinates != nullptr)
+            m_scene.destroy(*batch.textureCoordinates);
+        if (batch.indices != nullptr)
+            m_scene.destroy(*batch.indices);
+    }
+
+    bool TextCacheImpl::allocateInTextBatch(size_t atlasPage, const Effect& effect, uint32_t quadCount, BatchedTextLine& batchedLineOut)
+    {
+        if (quadCount > TextBatchCapacityInQuads)
+            return false;
+
+        for (const auto& batch : m_textBatches)
+        {
+            if (batch->atlasPage == atlasPage && &batch->effect == &effect)
+            {
+                const uint32_t firstQuad = batch->allocator.allocate(quadCount);
+                if (firstQuad != TextBatchAllocator::InvalidOffset)
+                {
+                    batchedLineOut.batch = batch.get();
+                    batchedLineOut.firstQuad = firstQuad;
+                    batchedLineOut.quadCount = quadCount;
+                    batch->meshNode->setIndexCount(batch->allocator.getUsedEnd() * 6u);
+                    return true;
+                }
+            }
+        }
+
+        TextBatch* newBatch = createTextBatch(atlasPage, effect);
+        if (newBatch == nullptr)
+            return false;
+
+        batchedLineOut.batch = newBatch;
+        batchedLineOut.firstQuad = newBatch->allocator.allocate(quadCount);
+        batchedLineOut.quadCount = quadCount;
+        assert(batchedLineOut.firstQuad != TextBatchAllocator::InvalidOffset);
+        newBatch->meshNode->setIndexCount(newBatch->allocator.getUsedEnd() * 6u);
+        return true;
+    }
+
+    void TextCacheImpl::releaseFromTextBatch(const BatchedTextLine& batchedLine)
+    {
+        TextBatch& batch = *batchedLine.batch;
+        batch.allocator.release(batchedLine.firstQuad, batchedLine.quadCount);
+        if (batch.allocator.getAllocatedCount() == 0u)
+        {
+            destroyTextBatch(batch);
+            return;
+        }
+
+        // released quads might still be referenced by the drawn index range, collapse them
+        const uint32_t usedEnd = batch.allocator.getUsedEnd();
+        if (batchedLine.firstQuad < usedEnd)
+        {
+            const uint32_t collapsedQuads = std::min(batchedLine.quadCount, usedEnd - batchedLine.firstQuad);
+            const std::vector<float> zeroes(collapsedQuads * 8u, 0.f);
+            batch.positions->setData(reinterpret_cast<const char*>(zeroes.data()), static_cast<uint32_t>(zeroes.size() * sizeof(float)), batchedLine.firstQuad * 8u * sizeof(float));
+        }
+        batch.meshNode->setIndexCount(usedEnd * 6u);
+    }
+
+    void TextCacheImpl::writeBatchedGeometry(const BatchedTextLine& batchedLine, const GlyphGeometry& geometry)
+    {
+        TextBatch& batch = *batchedLine.batch;
+        assert(geometry.positions.size() <= batchedLine.quadCount * 8u);
+
+        // positions of quads not used by the geometry stay zero and produce degenerate triangles
+        std::vector<float> positions(batchedLine.quadCount * 8u, 0.f);
+        for (size_t i = 0u; i < geometry.positions.size(); i += 2u)
+        {
+            positions[i] = geometry.positions[i] + batchedLine.offsetX;
+            positions[i + 1u] = geometry.positions[i + 1u] + batchedLine.offsetY;
+        }
+
+        const uint32_t byteOffset = batchedLine.firstQuad * 8u * sizeof(float);
+        batch.positions->setData(reinterpret_cast<const char*>(positions.data()), static_cast<uint32_t>(positions.size() * sizeof(float)), byteOffset);
+        batch.textureCoordinates->setData(reinterpret_cast<const char*>(geometry.texcoords.data()), static_cast<uint32_t>(geometry.texcoords.size() * sizeof(float)), byteOffset);
+    }
+
+    void TextCacheImpl::assignBatchToTextLine(const TextBatch& batch, TextLine& textLine)
+    {
+        textLine.atlasPage = batch.atlasPage;
+        textLine.meshNode = batch.meshNode;
+        textLine.positions = batch.positions;
+        textLine.textureCoordinates = batch.textureCoordinates;
+        textLine.indices = batch.indices;
+    }
+
     TextLine const* TextCacheImpl::getTextLine(TextLineId textId) const
     {
         const auto it = m_textLines.find(textId);
@@ -171,6 +583,17 @@ namespace ramses
         }
 
         TextLine& textLine = m_textLines[textId];
+
+        const auto batchedLineIt = m_batchedTextLines.find(textId);
+        if (batchedLineIt != m_batchedTextLines.end())
+        {
+            releaseFromTextBatch(batchedLineIt->second);
+            m_batchedTextLines.erase(batchedLineIt);
+            m_textureAtlas.unmapGlyphsFromPage(textLine.glyphs, textLine.atlasPage);
+            m_textLines.erase(textId);
+            return true;
+        }
+
         auto geometry = textLine.meshNode->getGeometryBinding();
         auto appearance = textLine.meshNode->getAppearance();
         m_scene.destroy(*textLine.meshNode);
@@ -31,11 +31,26 @@ namespace ramses
         return impl->getPositionedGlyphs(str, font);
     }
 
+    bool TextCache::preloadGlyphs(const std::u32string& characters, const std::vector<FontInstanceId>& fontInstances, uint32_t threadCount)
+    {
+        return impl->preloadGlyphs(characters, fontInstances, threadCount);
+    }
+
     TextLineId TextCache::createTextLine(const GlyphMetricsVector& glyphs, const Effect& effect)
     {
         return impl->createTextLine(glyphs, effect);
     }
 
+    TextLineId TextCache::createBatchedTextLine(const GlyphMetricsVector& glyphs, const Effect& effect, float offsetX, float offsetY)
+    {
+        return impl->createBatchedTextLine(glyphs, effect, offsetX, offsetY);
+    }
+
+    bool TextCache::updateTextLine(TextLineId textId, const GlyphMetricsVector& glyphs)
+    {
+        return impl->updateTextLine(textId, glyphs);
+    }
+
     TextLine const* TextCache::getTextLine(TextLineId textId) const
     {
         return impl->getTextLine(textId);
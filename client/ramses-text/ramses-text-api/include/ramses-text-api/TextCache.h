@@ -12,6 +12,7 @@
 #include "ramses-text-api/TextLine.h"
 #include "ramses-text-api/FontInstanceOffsets.h"
 #include <string>
+#include <vector>
 
 namespace ramses
 {
@@ -68,6 +69,23 @@ namespace ramses
         */
         GlyphMetricsVector      getPositionedGlyphs(const std::u32string& str, const FontInstanceOffsets& fontOffsets);
 
+        /**
+        * @brief Load and store glyph bitmaps for a set of characters ahead of creating text lines with them
+        *
+        * Text line creation loads bitmaps of glyphs not yet stored in the text cache on the calling thread,
+        * which can take long when many new glyphs are needed at once, e.g. when switching language.
+        * Preloading moves this work ahead and spreads the bitmap loading of Freetype2 font instances
+        * over multiple threads, each using its own Freetype2 library and font faces. Glyph metrics are
+        * still loaded on the calling thread. Font instances of custom implementations are loaded sequentially.
+        *
+        * @param[in] characters The characters to preload glyphs for, characters not supported by a font instance are ignored for it
+        * @param[in] fontInstances Ids of font instances to preload glyphs from. The font instances
+        *                 must be available at the font accessor passed in the constructor of the text cache.
+        * @param[in] threadCount Maximum number of threads to load glyph bitmaps with, 0 to use the number of hardware threads
+        * @return True on success, false if any of the font instances could not be found
+        */
+        bool                    preloadGlyphs(const std::u32string& characters, const std::vector<FontInstanceId>& fontInstances, uint32_t threadCount = 0u);
+
         /**
         * @brief Create the scene objects, e.g., mesh and appearance...etc, needed for rendering a text line (represented by glyph metrics)
         * @param[in] glyphs The glyph metrics for which to create a text line
@@ -76,6 +94,39 @@ namespace ramses
         */
         TextLineId              createTextLine(const GlyphMetricsVector& glyphs, const Effect& effect);
 
+        /**
+        * @brief Create a text line which shares its scene objects with other batched text lines
+        *
+        * All batched text lines whose glyphs end up on the same atlas page and which use the same effect
+        * are packed into shared vertex and index data buffers and are rendered by a single mesh node.
+        * Since the mesh node is shared, the text line cannot be transformed individually, instead
+        * its glyphs are placed at the given offset within the coordinate space of the batch.
+        *
+        * The scene objects referenced by the returned TextLine (mesh node and data buffers) are owned
+        * by the text cache and shared with other batched text lines, they must not be modified or destroyed.
+        * The mesh node of a text line can change when the text line is updated.
+        *
+        * @param[in] glyphs The glyph metrics for which to create a text line
+        * @param[in] effect The effect used for creating the appearance of the text batch and rendering the meshes
+        * @param[in] offsetX Horizontal offset of the text line within the batch
+        * @param[in] offsetY Vertical offset of the text line within the batch
+        * @return Id of the text line created
+        */
+        TextLineId              createBatchedTextLine(const GlyphMetricsVector& glyphs, const Effect& effect, float offsetX, float offsetY);
+
+        /**
+        * @brief Replace the glyphs of an existing text line
+        *
+        * The existing scene objects of the text line are updated in place where possible. Buffers of
+        * a non-batched text line are only re-created if the new text does not fit into them. A batched text
+        * line keeps its space in the batch unless the new text needs more glyphs or a different atlas page.
+        *
+        * @param[in] textId Id of the text line object to update
+        * @param[in] glyphs The new glyph metrics of the text line
+        * @return True on success, false otherwise (the text line is unchanged then)
+        */
+        bool                    updateTextLine(TextLineId textId, const GlyphMetricsVector& glyphs);
+
         /**
         * @brief Get a const pointer to a (previously created) text line object
         * @param[in] textId Id of the text line object to get
@@ -205,4 +205,29 @@ namespace ramses
     {
         EXPECT_FALSE(FontInstance10->supportsCharacter(0x19aa));
     }
+
+    TEST_F(AFreetype2FontInstance, CreatesCopyWhichLoadsSameGlyphBitmapDataUsingOtherFreetypeLibrary)
+    {
+        FT_Library freetypeLib = nullptr;
+        ASSERT_EQ(0, FT_Init_FreeType(&freetypeLib));
+        {
+            const std::unique_ptr<Freetype2FontInstance> copy = FontInstance10->createCopy(freetypeLib);
+            ASSERT_TRUE(copy);
+            EXPECT_EQ(FontInstance10->getHeight(), copy->getHeight());
+
+            for (const auto character : std::u32string(U"@abc123"))
+            {
+                const GlyphId glyphId = FontInstance10->getGlyphId(character);
+                EXPECT_EQ(glyphId, copy->getGlyphId(character));
+
+                QuadSize expectedSize;
+                QuadSize size;
+                const GlyphData expectedData = FontInstance10->loadGlyphBitmapData(glyphId, expectedSize.x, expectedSize.y);
+                const GlyphData data = copy->loadGlyphBitmapData(glyphId, size.x, size.y);
+                EXPECT_EQ(expectedSize, size);
+                EXPECT_EQ(expectedData, data);
+            }
+        }
+        FT_Done_FreeType(freetypeLib);
+    }
 }
@@ -446,4 +446,22 @@ namespace ramses
         // TODO(Violin) does not work yet
         //EXPECT_EQ(0u, geometry4.atlasPage);
     }
+
+    TEST_F(AGlyphTextureAtlas, ReportsFillRatioOverAllPages)
+    {
+        EXPECT_EQ(0u, m_atlas.getPageCount());
+        EXPECT_FLOAT_EQ(0.f, m_atlas.getFillRatio());
+
+        // including padding, glyph covers half of the page
+        const GlyphMetricsVector glyphs1 = { { GlyphKey(GlyphId('a'), FakeFontId), AtlasTextureWidth - 2, AtlasTextureHeight / 2 - 2, 0, 0, 0 } };
+        createTestGlyphGeometry(glyphs1);
+        EXPECT_EQ(1u, m_atlas.getPageCount());
+        EXPECT_FLOAT_EQ(0.5f, m_atlas.getFillRatio());
+
+        // full page glyph goes to new page
+        const GlyphMetricsVector glyphs2 = { { GlyphKey(GlyphId('b'), FakeFontId), AtlasTextureWidth - 2, AtlasTextureHeight - 2, 0, 0, 0 } };
+        createTestGlyphGeometry(glyphs2);
+        EXPECT_EQ(2u, m_atlas.getPageCount());
+        EXPECT_FLOAT_EQ(0.75f, m_atlas.getFillRatio());
+    }
 }
@@ -480,4 +480,64 @@ namespace ramses
             EXPECT_EQ(m_glyphPage->findFreeSpace(vec2[i]), index);
         }
     }
+
+    TEST_F(AGlyphTexturePage, HasZeroFillRatioWhenEmptyAndFullWhenFullyClaimed)
+    {
+        EXPECT_FLOAT_EQ(0.f, m_glyphPage->getFillRatio());
+        const Quad quad = claimTestQuad(EClaimedQuadSize::FullPage);
+        EXPECT_FLOAT_EQ(1.f, m_glyphPage->getFillRatio());
+        m_glyphPage->releaseSpace(quad);
+        EXPECT_FLOAT_EQ(0.f, m_glyphPage->getFillRatio());
+    }
+
+    TEST_F(AGlyphTexturePage, ReportsFillRatioOfClaimedSpace)
+    {
+        claimTestQuad(EClaimedQuadSize::QuarterPage);
+        EXPECT_FLOAT_EQ(0.25f, m_glyphPage->getFillRatio());
+        claimTestQuad(EClaimedQuadSize::QuarterPage);
+        EXPECT_FLOAT_EQ(0.5f, m_glyphPage->getFillRatio());
+    }
+
+    TEST_F(AGlyphTexturePage, FindsNoFreeSpaceIfNoFreeQuadIsWideOrHighEnough)
+    {
+        claimTestQuad(EClaimedQuadSize::HalfPage);
+        EXPECT_EQ(std::numeric_limits<GlyphTexturePage::QuadIndex>::max(), m_glyphPage->findFreeSpace(QuadSize(PageWidth / 2 + 1, 1)));
+        EXPECT_NE(std::numeric_limits<GlyphTexturePage::QuadIndex>::max(), m_glyphPage->findFreeSpace(QuadSize(PageWidth / 2, PageHeight)));
+    }
+
+    TEST_F(AGlyphTexturePage, PacksSameSequenceOfQuadsDeterministically)
+    {
+        GlyphTexturePage otherPage(m_scene, QuadSize(PageWidth, PageHeight));
+        const std::vector<QuadSize> sizes = { QuadSize(3, 5), QuadSize(2, 2), QuadSize(5, 3), QuadSize(1, 7), QuadSize(4, 4), QuadSize(2, 6), QuadSize(3, 3) };
+
+        for (const auto& size : sizes)
+        {
+            const auto index = m_glyphPage->findFreeSpace(size);
+            const auto otherIndex = otherPage.findFreeSpace(size);
+            ASSERT_NE(std::numeric_limits<GlyphTexturePage::QuadIndex>::max(), index);
+            ASSERT_NE(std::numeric_limits<GlyphTexturePage::QuadIndex>::max(), otherIndex);
+            EXPECT_EQ(m_glyphPage->claimSpace(index, size), otherPage.claimSpace(otherIndex, size));
+        }
+        EXPECT_FLOAT_EQ(m_glyphPage->getFillRatio(), otherPage.getFillRatio());
+    }
+
+    TEST_F(AGlyphTexturePage, MergesAllFreeSpaceBackWhenReleasingManyClaimedQuads)
+    {
+        std::vector<Quad> claimed;
+        for (uint32_t i = 0u; i < PageWidth * PageHeight; ++i)
+        {
+            const QuadSize size(1u + i % 3u, 1u + i % 2u);
+            const auto index = m_glyphPage->findFreeSpace(size);
+            if (index == std::numeric_limits<GlyphTexturePage::QuadIndex>::max())
+                break;
+            claimed.emplace_back(m_glyphPage->claimSpace(index, size), size);
+        }
+        EXPECT_LT(0.9f, m_glyphPage->getFillRatio());
+
+        for (const auto& quad : claimed)
+            m_glyphPage->releaseSpace(quad);
+
+        expectFreeArea(PageWidth * PageHeight);
+        EXPECT_FLOAT_EQ(0.f, m_glyphPage->getFillRatio());
+    }
 }
@@ -0,0 +1,76 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+#include "ramses-text-api/FontRegistry.h"
+#include "ramses-text/ParallelGlyphLoader.h"
+#include "ramses-text/Freetype2FontInstance.h"
+
+namespace ramses
+{
+    class AParallelGlyphLoader : public testing::TestWithParam<uint32_t>
+    {
+    public:
+        static void SetUpTestCase()
+        {
+            FRegistry = new FontRegistry;
+            const auto fontId = FRegistry->createFreetype2Font("res/ramses-text-Roboto-Bold.ttf");
+            FontInstance12 = static_cast<Freetype2FontInstance*>(FRegistry->getFontInstance(FRegistry->createFreetype2FontInstance(fontId, 12)));
+            FontInstance20 = static_cast<Freetype2FontInstance*>(FRegistry->getFontInstance(FRegistry->createFreetype2FontInstanceWithHarfBuzz(fontId, 20)));
+        }
+
+        static void TearDownTestCase()
+        {
+            delete FRegistry;
+        }
+
+    protected:
+        static void AddJobs(const std::u32string& characters, Freetype2FontInstance& fontInstance, FontInstanceId fontInstanceId, ParallelGlyphLoader::Jobs& jobs)
+        {
+            for (const auto character : characters)
+                jobs.push_back({ &fontInstance, GlyphKey(fontInstance.getGlyphId(character), fontInstanceId), QuadSize(), GlyphData(), false });
+        }
+
+        static FontRegistry* FRegistry;
+        static Freetype2FontInstance* FontInstance12;
+        static Freetype2FontInstance* FontInstance20;
+    };
+
+    FontRegistry* AParallelGlyphLoader::FRegistry(nullptr);
+    Freetype2FontInstance* AParallelGlyphLoader::FontInstance12(nullptr);
+    Freetype2FontInstance* AParallelGlyphLoader::FontInstance20(nullptr);
+
+    INSTANTIATE_TEST_CASE_P(AParallelGlyphLoaderTests, AParallelGlyphLoader, ::testing::Values(0u, 1u, 3u, 64u));
+
+    TEST_P(AParallelGlyphLoader, loadsSameGlyphBitmapsAsFontInstances)
+    {
+        ParallelGlyphLoader::Jobs jobs;
+        AddJobs(U"abcdefghijklmnopqrstuvwxyz0123456789@", *FontInstance12, FontInstanceId(12u), jobs);
+        AddJobs(U"ABCDEFGHIJKLMNOPQRSTUVWXYZ!?%", *FontInstance20, FontInstanceId(20u), jobs);
+
+        ParallelGlyphLoader::LoadGlyphBitmaps(jobs, GetParam());
+
+        for (const auto& job : jobs)
+        {
+            EXPECT_TRUE(job.loaded);
+
+            Freetype2FontInstance& fontInstance = (job.key.fontInstanceId == FontInstanceId(12u) ? *FontInstance12 : *FontInstance20);
+            QuadSize expectedSize;
+            const GlyphData expectedData = fontInstance.loadGlyphBitmapData(job.key.identifier, expectedSize.x, expectedSize.y);
+            EXPECT_EQ(expectedSize, job.size);
+            EXPECT_EQ(expectedData, job.data);
+        }
+    }
+
+    TEST_P(AParallelGlyphLoader, doesNothingForNoJobs)
+    {
+        ParallelGlyphLoader::Jobs jobs;
+        ParallelGlyphLoader::LoadGlyphBitmaps(jobs, GetParam());
+        EXPECT_TRUE(jobs.empty());
+    }
+}
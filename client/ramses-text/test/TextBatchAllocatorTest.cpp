@@ -0,0 +1,91 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "ramses-text/TextBatchAllocator.h"
+
+namespace ramses
+{
+    TEST(ATextBatchAllocator, isInitiallyEmpty)
+    {
+        TextBatchAllocator allocator(100u);
+        EXPECT_EQ(100u, allocator.getCapacity());
+        EXPECT_EQ(0u, allocator.getUsedEnd());
+        EXPECT_EQ(0u, allocator.getAllocatedCount());
+    }
+
+    TEST(ATextBatchAllocator, allocatesConsecutiveRanges)
+    {
+        TextBatchAllocator allocator(100u);
+        EXPECT_EQ(0u, allocator.allocate(10u));
+        EXPECT_EQ(10u, allocator.allocate(5u));
+        EXPECT_EQ(15u, allocator.allocate(20u));
+        EXPECT_EQ(35u, allocator.getUsedEnd());
+        EXPECT_EQ(35u, allocator.getAllocatedCount());
+    }
+
+    TEST(ATextBatchAllocator, failsToAllocateZeroOrMoreThanCapacity)
+    {
+        TextBatchAllocator allocator(100u);
+        EXPECT_EQ(TextBatchAllocator::InvalidOffset, allocator.allocate(0u));
+        EXPECT_EQ(TextBatchAllocator::InvalidOffset, allocator.allocate(101u));
+        EXPECT_EQ(0u, allocator.allocate(90u));
+        EXPECT_EQ(TextBatchAllocator::InvalidOffset, allocator.allocate(11u));
+        EXPECT_EQ(90u, allocator.allocate(10u));
+        EXPECT_EQ(100u, allocator.getUsedEnd());
+    }
+
+    TEST(ATextBatchAllocator, reusesReleasedRangeFirstFit)
+    {
+        TextBatchAllocator allocator(100u);
+        allocator.allocate(10u);
+        const uint32_t second = allocator.allocate(10u);
+        allocator.allocate(10u);
+
+        allocator.release(second, 10u);
+        EXPECT_EQ(30u, allocator.getUsedEnd());
+        EXPECT_EQ(20u, allocator.getAllocatedCount());
+
+        EXPECT_EQ(second, allocator.allocate(4u));
+        EXPECT_EQ(second + 4u, allocator.allocate(6u));
+        EXPECT_EQ(30u, allocator.allocate(1u));
+    }
+
+    TEST(ATextBatchAllocator, shrinksUsedEndWhenReleasingTrailingRanges)
+    {
+        TextBatchAllocator allocator(100u);
+        const uint32_t first = allocator.allocate(10u);
+        const uint32_t second = allocator.allocate(10u);
+        const uint32_t third = allocator.allocate(10u);
+
+        allocator.release(second, 10u);
+        EXPECT_EQ(30u, allocator.getUsedEnd());
+        allocator.release(third, 10u);
+        EXPECT_EQ(10u, allocator.getUsedEnd());
+        allocator.release(first, 10u);
+        EXPECT_EQ(0u, allocator.getUsedEnd());
+        EXPECT_EQ(0u, allocator.getAllocatedCount());
+    }
+
+    TEST(ATextBatchAllocator, mergesAdjacentReleasedRanges)
+    {
+        TextBatchAllocator allocator(100u);
+        const uint32_t first = allocator.allocate(10u);
+        const uint32_t second = allocator.allocate(10u);
+        const uint32_t third = allocator.allocate(10u);
+        allocator.allocate(10u);
+
+        allocator.release(first, 10u);
+        allocator.release(third, 10u);
+        allocator.release(second, 10u);
+
+        // only a merged range can hold this
+        EXPECT_EQ(first, allocator.allocate(30u));
+        EXPECT_EQ(40u, allocator.getUsedEnd());
+    }
+}
@@ -512,4 +512,203 @@ namespace ramses
 
         EXPECT_EQ(InvalidTextLineId, m_textCache.createTextLine(positionedGlyphs, *textEffect));
     }
+
+    TEST_F(ATextCache, createsBatchedTextLinesSharingMeshNode)
+    {
+        const auto positionedGlyphs1 = m_textCache.getPositionedGlyphs(U" test ", LatinFontInstance12);
+        const auto positionedGlyphs2 = m_textCache.getPositionedGlyphs(U"tset", LatinFontInstance12);
+
+        UniformInput colorInput;
+        Effect* textEffect = RamsesUtils::CreateStandardTextEffect(m_client, colorInput);
+        ASSERT_TRUE(textEffect != nullptr);
+
+        const TextLineId textLineId1 = m_textCache.createBatchedTextLine(positionedGlyphs1, *textEffect, 0.f, 0.f);
+        const TextLineId textLineId2 = m_textCache.createBatchedTextLine(positionedGlyphs2, *textEffect, 0.f, 20.f);
+        EXPECT_NE(InvalidTextLineId, textLineId1);
+        EXPECT_NE(InvalidTextLineId, textLineId2);
+        const TextLine* textLine1 = m_textCache.getTextLine(textLineId1);
+        const TextLine* textLine2 = m_textCache.getTextLine(textLineId2);
+        ASSERT_TRUE(textLine1 != nullptr);
+        ASSERT_TRUE(textLine2 != nullptr);
+
+        EXPECT_EQ(positionedGlyphs1, textLine1->glyphs);
+        EXPECT_EQ(positionedGlyphs2, textLine2->glyphs);
+        EXPECT_EQ(textLine1->atlasPage, textLine2->atlasPage);
+        ASSERT_TRUE(textLine1->meshNode != nullptr);
+        EXPECT_EQ(textLine1->meshNode, textLine2->meshNode);
+        EXPECT_EQ(textLine1->positions, textLine2->positions);
+        EXPECT_EQ(textLine1->textureCoordinates, textLine2->textureCoordinates);
+        EXPECT_EQ(textLine1->indices, textLine2->indices);
+
+        // 4 visible glyphs in each line
+        EXPECT_EQ(48u, textLine1->meshNode->getIndexCount());
+        EXPECT_EQ(256u, textLine1->positions->getUsedSizeInBytes());
+        EXPECT_EQ(256u, textLine1->textureCoordinates->getUsedSizeInBytes());
+    }
+
+    TEST_F(ATextCache, deletesBatchedTextLines)
+    {
+        const auto positionedGlyphs1 = m_textCache.getPositionedGlyphs(U" test ", LatinFontInstance12);
+        const auto positionedGlyphs2 = m_textCache.getPositionedGlyphs(U"tset", LatinFontInstance12);
+
+        UniformInput colorInput;
+        Effect* textEffect = RamsesUtils::CreateStandardTextEffect(m_client, colorInput);
+        ASSERT_TRUE(textEffect != nullptr);
+
+        const TextLineId textLineId1 = m_textCache.createBatchedTextLine(positionedGlyphs1, *textEffect, 0.f, 0.f);
+        const TextLineId textLineId2 = m_textCache.createBatchedTextLine(positionedGlyphs2, *textEffect, 0.f, 20.f);
+        const MeshNode* batchMeshNode = m_textCache.getTextLine(textLineId2)->meshNode;
+
+        EXPECT_TRUE(m_textCache.deleteTextLine(textLineId2));
+        EXPECT_EQ(nullptr, m_textCache.getTextLine(textLineId2));
+        EXPECT_FALSE(m_textCache.deleteTextLine(textLineId2));
+
+        const TextLine* textLine1 = m_textCache.getTextLine(textLineId1);
+        ASSERT_TRUE(textLine1 != nullptr);
+        EXPECT_EQ(batchMeshNode, textLine1->meshNode);
+        EXPECT_EQ(24u, textLine1->meshNode->getIndexCount());
+
+        EXPECT_TRUE(m_textCache.deleteTextLine(textLineId1));
+        EXPECT_EQ(nullptr, m_textCache.getTextLine(textLineId1));
+    }
+
+    TEST_F(ATextCache, failsToCreateBatchedTextLineFromEmptyStringOrUsingNonTextEffect)
+    {
+        UniformInput colorInput;
+        Effect* textEffect = RamsesUtils::CreateStandardTextEffect(m_client, colorInput);
+        ASSERT_TRUE(textEffect != nullptr);
+        EXPECT_EQ(InvalidTextLineId, m_textCache.createBatchedTextLine({}, *textEffect, 0.f, 0.f));
+
+        EffectDescription effectDesc;
+        effectDesc.setVertexShader("void main() { gl_Position = vec4(1.0, 0.0, 0.0, 1.0); }\n");
+        effectDesc.setFragmentShader("void main() { gl_FragColor = vec4(1.0, 0.0, 0.0, 1.0); }\n");
+        Effect* effect = m_client.createEffect(effectDesc);
+        ASSERT_TRUE(effect != nullptr);
+        const auto positionedGlyphs = m_textCache.getPositionedGlyphs(U"x", LatinFontInstance12);
+        EXPECT_EQ(InvalidTextLineId, m_textCache.createBatchedTextLine(positionedGlyphs, *effect, 0.f, 0.f));
+    }
+
+    TEST_F(ATextCache, updatesTextLineInPlaceIfNewTextFits)
+    {
+        const auto positionedGlyphs1 = m_textCache.getPositionedGlyphs(U" test ", LatinFontInstance12);
+        const auto positionedGlyphs2 = m_textCache.getPositionedGlyphs(U"et", LatinFontInstance12);
+
+        UniformInput colorInput;
+        Effect* textEffect = RamsesUtils::CreateStandardTextEffect(m_client, colorInput);
+        ASSERT_TRUE(textEffect != nullptr);
+
+        const TextLineId textLineId = m_textCache.createTextLine(positionedGlyphs1, *textEffect);
+        const TextLine* textLine = m_textCache.getTextLine(textLineId);
+        ASSERT_TRUE(textLine != nullptr);
+        const MeshNode* meshNode = textLine->meshNode;
+        const IndexDataBuffer* indices = textLine->indices;
+        const VertexDataBuffer* positions = textLine->positions;
+
+        EXPECT_TRUE(m_textCache.updateTextLine(textLineId, positionedGlyphs2));
+        EXPECT_EQ(positionedGlyphs2, textLine->glyphs);
+        EXPECT_EQ(meshNode, textLine->meshNode);
+        EXPECT_EQ(indices, textLine->indices);
+        EXPECT_EQ(positions, textLine->positions);
+        EXPECT_EQ(12u, textLine->meshNode->getIndexCount());
+    }
+
+    TEST_F(ATextCache, updatesTextLineWithLargerBuffersIfNewTextDoesNotFit)
+    {
+        const auto positionedGlyphs1 = m_textCache.getPositionedGlyphs(U"et", LatinFontInstance12);
+        const auto positionedGlyphs2 = m_textCache.getPositionedGlyphs(U" test ", LatinFontInstance12);
+
+        UniformInput colorInput;
+        Effect* textEffect = RamsesUtils::CreateStandardTextEffect(m_client, colorInput);
+        ASSERT_TRUE(textEffect != nullptr);
+
+        const TextLineId textLineId = m_textCache.createTextLine(positionedGlyphs1, *textEffect);
+        const TextLine* textLine = m_textCache.getTextLine(textLineId);
+        ASSERT_TRUE(textLine != nullptr);
+        const MeshNode* meshNode = textLine->meshNode;
+
+        EXPECT_TRUE(m_textCache.updateTextLine(textLineId, positionedGlyphs2));
+        EXPECT_EQ(positionedGlyphs2, textLine->glyphs);
+        EXPECT_EQ(meshNode, textLine->meshNode);
+        EXPECT_EQ(24u, textLine->meshNode->getIndexCount());
+        EXPECT_EQ(48u, textLine->indices->getUsedSizeInBytes());
+        EXPECT_EQ(128u, textLine->positions->getUsedSizeInBytes());
+        EXPECT_EQ(128u, textLine->textureCoordinates->getUsedSizeInBytes());
+        EXPECT_TRUE(m_textCache.deleteTextLine(textLineId));
+    }
+
+    TEST_F(ATextCache, updatesBatchedTextLine)
+    {
+        const auto positionedGlyphs1 = m_textCache.getPositionedGlyphs(U"et", LatinFontInstance12);
+        const auto positionedGlyphs2 = m_textCache.getPositionedGlyphs(U" test ", LatinFontInstance12);
+
+        UniformInput colorInput;
+        Effect* textEffect = RamsesUtils::CreateStandardTextEffect(m_client, colorInput);
+        ASSERT_TRUE(textEffect != nullptr);
+
+        const TextLineId textLineId1 = m_textCache.createBatchedTextLine(positionedGlyphs1, *textEffect, 0.f, 0.f);
+        const TextLineId textLineId2 = m_textCache.createBatchedTextLine(positionedGlyphs1, *textEffect, 0.f, 20.f);
+        const TextLine* textLine1 = m_textCache.getTextLine(textLineId1);
+        ASSERT_TRUE(textLine1 != nullptr);
+        EXPECT_EQ(24u, textLine1->meshNode->getIndexCount());
+
+        // does not fit into its previous range anymore, gets appended
+        EXPECT_TRUE(m_textCache.updateTextLine(textLineId1, positionedGlyphs2));
+        EXPECT_EQ(positionedGlyphs2, textLine1->glyphs);
+        EXPECT_EQ(m_textCache.getTextLine(textLineId2)->meshNode, textLine1->meshNode);
+        EXPECT_EQ(48u, textLine1->meshNode->getIndexCount());
+
+        // fits into its range, updated in place
+        EXPECT_TRUE(m_textCache.updateTextLine(textLineId1, positionedGlyphs1));
+        EXPECT_EQ(positionedGlyphs1, textLine1->glyphs);
+        EXPECT_EQ(48u, textLine1->meshNode->getIndexCount());
+    }
+
+    TEST_F(ATextCache, failsToUpdateNonExistingTextLineOrWithEmptyString)
+    {
+        const auto positionedGlyphs = m_textCache.getPositionedGlyphs(U"x", LatinFontInstance12);
+        EXPECT_FALSE(m_textCache.updateTextLine(TextLineId(3u), positionedGlyphs));
+
+        UniformInput colorInput;
+        Effect* textEffect = RamsesUtils::CreateStandardTextEffect(m_client, colorInput);
+        ASSERT_TRUE(textEffect != nullptr);
+        const TextLineId textLineId = m_textCache.createTextLine(positionedGlyphs, *textEffect);
+        EXPECT_FALSE(m_textCache.updateTextLine(textLineId, {}));
+        EXPECT_EQ(positionedGlyphs, m_textCache.getTextLine(textLineId)->glyphs);
+    }
+
+    TEST_F(ATextCache, preloadsGlyphsSoThatTextLineCanBeCreatedWithoutLoadingThemAgain)
+    {
+        const FontInstanceId fontInstance = FRegistry->createFreetype2FontInstance(LatinFont, 16);
+        const auto positionedGlyphs = m_textCache.getPositionedGlyphs(U"preloaded text", fontInstance);
+
+        EXPECT_TRUE(m_textCache.preloadGlyphs(U"abcdefghijklmnopqrstuvwxyz ", { fontInstance }, 4u));
+
+        // glyph bitmaps are stored in cache already, font instance is not needed anymore
+        EXPECT_TRUE(FRegistry->deleteFontInstance(fontInstance));
+
+        UniformInput colorInput;
+        Effect* textEffect = RamsesUtils::CreateStandardTextEffect(m_client, colorInput);
+        ASSERT_TRUE(textEffect != nullptr);
+        const TextLineId textLineId = m_textCache.createTextLine(positionedGlyphs, *textEffect);
+        EXPECT_NE(InvalidTextLineId, textLineId);
+        EXPECT_EQ(positionedGlyphs, m_textCache.getTextLine(textLineId)->glyphs);
+    }
+
+    TEST_F(ATextCache, preloadsGlyphsOfMultipleFontInstancesUsingDefaultThreadCount)
+    {
+        EXPECT_TRUE(m_textCache.preloadGlyphs(U"0123456789 test", { LatinFontInstance12, LatinFontInstance20 }));
+        // already preloaded glyphs are skipped
+        EXPECT_TRUE(m_textCache.preloadGlyphs(U"0123456789", { LatinFontInstance12 }, 1u));
+
+        const auto positionedGlyphs = m_textCache.getPositionedGlyphs(U"test 42", LatinFontInstance20);
+        UniformInput colorInput;
+        Effect* textEffect = RamsesUtils::CreateStandardTextEffect(m_client, colorInput);
+        ASSERT_TRUE(textEffect != nullptr);
+        EXPECT_NE(InvalidTextLineId, m_textCache.createTextLine(positionedGlyphs, *textEffect));
+    }
+
+    TEST_F(ATextCache, failsToPreloadGlyphsFromNonExistingFontInstance)
+    {
+        EXPECT_FALSE(m_textCache.preloadGlyphs(U"abc", { LatinFontInstance12, FontInstanceId(999u) }, 2u));
+    }
 }
@@ -0,0 +1,73 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_ANIMATIONPROCESSBATCH_H
+#define RAMSES_ANIMATIONPROCESSBATCH_H
+
+#include "Animation/AnimationCommon.h"
+#include "Utils/DataTypeUtils.h"
+#include "Collections/Vector.h"
+
+namespace ramses_internal
+{
+    struct AnimationProcessData;
+
+    // Collects the animations processed within one time step and evaluates step and linear interpolation
+    // of float based splines in a single pass over structure-of-arrays component streams.
+    // Animations which cannot be batched (bezier interpolation, integral types) are dispatched using the scalar path,
+    // values are always applied to data binds in the order the animations were added.
+    class AnimationProcessBatch
+    {
+    public:
+        // Process data is expected to have its spline iterator already set to the processed time stamp
+        // and must stay valid until the batch is processed
+        void add(const AnimationProcessData& processData);
+        void process();
+
+        UInt32 getNumAnimations() const;
+        UInt32 getNumBatchedAnimations() const;
+
+        static Bool CanBatch(const AnimationProcessData& processData);
+
+        static void InterpolateStep(const Float* startValues, const Float* endValues, const Float* fractions, Float* results, UInt32 count);
+        static void InterpolateLinear(const Float* startValues, const Float* endValues, const Float* fractions, Float* results, UInt32 count);
+
+    private:
+        struct ComponentStream
+        {
+            Vector<Float> m_startValues;
+            Vector<Float> m_endValues;
+            Vector<Float> m_fractions;
+            Vector<Float> m_results;
+        };
+
+        struct Entry
+        {
+            const AnimationProcessData* m_processData;
+            EDataTypeID m_dataType;
+            ComponentStream* m_stream;
+            UInt32 m_offset;
+        };
+
+        void addToStream(const AnimationProcessData& processData, EDataTypeID dataType, ComponentStream& stream);
+        template <typename EDataType>
+        static void AppendComponents(const AnimationProcessData& processData, ComponentStream& stream);
+        template <typename EDataType>
+        static void AppendValueComponents(const EDataType& startValue, const EDataType& endValue, Float fraction, ComponentStream& stream);
+        template <typename EDataType>
+        static void DispatchResult(const Entry& entry);
+        void clear();
+
+        Vector<Entry> m_entries;
+        ComponentStream m_stepStream;
+        ComponentStream m_linearStream;
+        UInt32 m_numBatchedAnimations = 0u;
+    };
+}
+
+#endif
@@ -10,31 +10,39 @@
 #define RAMSES_ANIMATIONPROCESSDATACACHE_H
 
 #include "Collections/HashMap.h"
+#include "Collections/Vector.h"
 #include "Animation/AnimationProcessData.h"
 #include "Animation/AnimationData.h"
 
 namespace ramses_internal
 {
+    // Process data of active animations is kept densely packed so that processing iterates contiguous memory,
+    // handles map to the index of their process data.
     class AnimationProcessDataCache
     {
     public:
-        typedef HashMap<AnimationHandle, AnimationProcessData> DataProcessMap;
+        typedef Vector<AnimationProcessData> ProcessDataVector;
 
         AnimationProcessDataCache(const AnimationData& animationData);
 
         void addProcessData(AnimationHandle handle);
         void removeProcessData(AnimationHandle handle);
         Bool hasProcessData(AnimationHandle handle) const;
+        UInt32 getNumProcessData() const;
 
-        DataProcessMap::ConstIterator begin() const;
-        DataProcessMap::Iterator begin();
-        DataProcessMap::ConstIterator end() const;
-        DataProcessMap::Iterator end();
+        ProcessDataVector::const_iterator begin() const;
+        ProcessDataVector::iterator begin();
+        ProcessDataVector::const_iterator end() const;
+        ProcessDataVector::iterator end();
 
     private:
         void addProcessDataFor(AnimationHandle handle);
 
-        DataProcessMap m_processDataCache;
+        typedef HashMap<AnimationHandle, UInt32> HandleToIndexMap;
+
+        ProcessDataVector m_processData;
+        Vector<AnimationHandle> m_processDataHandles;
+        HandleToIndexMap m_handleToIndex;
         const AnimationData& m_animationData;
     };
 
@@ -53,39 +61,61 @@ namespace ramses_internal
 
     inline void AnimationProcessDataCache::removeProcessData(AnimationHandle handle)
     {
-        m_processDataCache.remove(handle);
+        UInt32 index = 0u;
+        if (m_handleToIndex.remove(handle, &index) != EStatus_RAMSES_OK)
+        {
+            return;
+        }
+
+        // move last process data to the removed slot to keep the storage dense
+        const UInt32 lastIndex = static_cast<UInt32>(m_processData.size() - 1u);
+        if (index != lastIndex)
+        {
+            m_processData[index] = m_processData[lastIndex];
+            m_processDataHandles[index] = m_processDataHandles[lastIndex];
+            m_handleToIndex[m_processDataHandles[index]] = index;
+        }
+        m_processData.pop_back();
+        m_processDataHandles.pop_back();
     }
 
     inline Bool AnimationProcessDataCache::hasProcessData(AnimationHandle handle) const
     {
-        return ( m_processDataCache.find(handle) != m_processDataCache.end() );
+        return m_handleToIndex.contains(handle);
+    }
+
+    inline UInt32 AnimationProcessDataCache::getNumProcessData() const
+    {
+        return static_cast<UInt32>(m_processData.size());
     }
 
-    inline AnimationProcessDataCache::DataProcessMap::ConstIterator AnimationProcessDataCache::begin() const
+    inline AnimationProcessDataCache::ProcessDataVector::const_iterator AnimationProcessDataCache::begin() const
     {
-        return m_processDataCache.begin();
+        return m_processData.begin();
     }
 
-    inline AnimationProcessDataCache::DataProcessMap::Iterator AnimationProcessDataCache::begin()
+    inline AnimationProcessDataCache::ProcessDataVector::iterator AnimationProcessDataCache::begin()
     {
-        return m_processDataCache.begin();
+        return m_processData.begin();
     }
 
-    inline AnimationProcessDataCache::DataProcessMap::ConstIterator AnimationProcessDataCache::end() const
+    inline AnimationProcessDataCache::ProcessDataVector::const_iterator AnimationProcessDataCache::end() const
     {
-        return m_processDataCache.end();
+        return m_processData.end();
     }
 
-    inline AnimationProcessDataCache::DataProcessMap::Iterator AnimationProcessDataCache::end()
+    inline AnimationProcessDataCache::ProcessDataVector::iterator AnimationProcessDataCache::end()
     {
-        return m_processDataCache.end();
+        return m_processData.end();
     }
 
     inline void AnimationProcessDataCache::addProcessDataFor(AnimationHandle handle)
     {
         AnimationProcessData processData;
         m_animationData.getAnimationProcessData(handle, processData);
-        m_processDataCache.put(handle, processData);
+        m_handleToIndex.put(handle, static_cast<UInt32>(m_processData.size()));
+        m_processData.push_back(processData);
+        m_processDataHandles.push_back(handle);
     }
 }
 
@@ -27,6 +27,10 @@ namespace ramses_internal
 
         void dispatch();
 
+        // Sets an already interpolated value to destinations, used when spline was evaluated outside of dispatcher
+        template <typename EDataType>
+        void dispatchInterpolatedValue(const EDataType& interpolatedValue);
+
         template <template<typename> class Key, typename EDataType>
         void dispatchSpline(const Spline<Key, EDataType>& spline);
 
@@ -37,6 +41,8 @@ namespace ramses_internal
         const AnimationProcessData& m_processData;
         Variant m_interpolatedValue;
 
+        void dispatchDataBinds();
+
         template <typename ClassType, typename EDataType, typename HandleType, typename HandleType2>
         EDataType getFinalValue(const AnimationDataBind<ClassType, EDataType, HandleType, HandleType2> &dataBind) const;
 
@@ -44,6 +50,13 @@ namespace ramses_internal
         EDataType getInterpolatedValue(const EDataType& offset) const;
     };
 
+    template <typename EDataType>
+    inline void AnimationProcessDataDispatch::dispatchInterpolatedValue(const EDataType& interpolatedValue)
+    {
+        m_interpolatedValue.setValue(interpolatedValue);
+        dispatchDataBinds();
+    }
+
     template <typename EDataType>
     inline EDataType AnimationProcessDataDispatch::getInterpolatedValue(const EDataType& offset) const
     {
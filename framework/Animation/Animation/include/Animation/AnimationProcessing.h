@@ -13,6 +13,7 @@
 #include "Animation/AnimationData.h"
 #include "Animation/AnimationProcessingFinished.h"
 #include "Animation/AnimationProcessDataCache.h"
+#include "Animation/AnimationProcessBatch.h"
 
 namespace ramses_internal
 {
@@ -34,11 +35,12 @@ namespace ramses_internal
     private:
         void process(const AnimationTime& timeStamp);
         void processActiveAnimations();
-        void processAnimation(AnimationProcessData& processData);
+        void updateSplineIterator(AnimationProcessData& processData) const;
         void resetProcessDataIfCached(AnimationHandle handle);
 
         AnimationProcessDataCache m_processDataCache;
         AnimationTime m_timeStamp;
+        AnimationProcessBatch m_processBatch;
 
         AnimationProcessingFinished m_finishedAnimationProcessing;
     };
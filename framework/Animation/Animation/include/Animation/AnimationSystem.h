@@ -90,6 +90,7 @@ namespace ramses_internal
 
         virtual void                         registerAnimationLogicListener(AnimationLogicListener* listener) override;
         virtual void                         unregisterAnimationLogicListener(AnimationLogicListener* listener) override;
+        virtual void                         setActivityListener(IAnimationSystemActivityListener* listener) override;
 
     protected:
         SplineHandle                         allocateSplineBasic(EDataTypeID dataTypeID, SplineHandle handleRequest);
@@ -101,6 +102,7 @@ namespace ramses_internal
         void                                 setAnimationFlags(AnimationHandle handle, Animation::Flags flags, const Animation& animation);
         void                                 setAnimationLoopDuration(AnimationHandle handle, AnimationTime::Duration duration, const Animation& animation);
         AnimationSystemHandle                getHandle() const;
+        void                                 updateActivity();
 
         AnimationData            m_animationData;
         AnimationLogic           m_animationLogic;
@@ -110,6 +112,8 @@ namespace ramses_internal
         static const UInt64 LoopingLengthMultiplier = 1u << 20;
     private:
         AnimationSystemHandle    m_handle;
+        IAnimationSystemActivityListener* m_activityListener;
+        Bool                     m_active;
     };
 }
 
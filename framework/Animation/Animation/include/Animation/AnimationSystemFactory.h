@@ -16,6 +16,7 @@ namespace ramses_internal
 {
     class SceneActionCollection;
     class IAnimationSystem;
+    class IAnimationSystemActivityListener;
     struct AnimationSystemSizeInformation;
 
     enum EAnimationSystemOwner
@@ -28,13 +29,14 @@ namespace ramses_internal
     class AnimationSystemFactory
     {
     public:
-        AnimationSystemFactory(EAnimationSystemOwner ownerType, SceneActionCollection* actionCollector = 0);
+        AnimationSystemFactory(EAnimationSystemOwner ownerType, SceneActionCollection* actionCollector = 0, IAnimationSystemActivityListener* activityListener = 0);
 
         IAnimationSystem* createAnimationSystem(UInt32 flags, const AnimationSystemSizeInformation& sizeInfo);
 
     protected:
         EAnimationSystemOwner m_ownerType;
         SceneActionCollection* m_actionCollector;
+        IAnimationSystemActivityListener* m_activityListener;
     };
 }
 
@@ -22,20 +22,14 @@ namespace ramses_internal
 
     AnimationData::~AnimationData()
     {
-        for (SplineHandle handle(0u); handle < m_splinePool.getTotalCount(); ++handle)
+        for (const auto handle : m_splinePool)
         {
-            if (m_splinePool.isAllocated(handle))
-            {
-                delete *m_splinePool.getMemory(handle);
-            }
+            delete *m_splinePool.getMemory(handle);
         }
 
-        for (DataBindHandle handle(0u); handle < m_dataBindPool.getTotalCount(); ++handle)
+        for (const auto handle : m_dataBindPool)
         {
-            if (m_dataBindPool.isAllocated(handle))
-            {
-                delete *m_dataBindPool.getMemory(handle);
-            }
+            delete *m_dataBindPool.getMemory(handle);
         }
     }
 
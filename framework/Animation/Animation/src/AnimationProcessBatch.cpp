@@ -0,0 +1,240 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Animation/AnimationProcessBatch.h"
+#include "Animation/AnimationProcessData.h"
+#include "Animation/AnimationProcessDataDispatch.h"
+#include "Animation/AnimatableTypeTraits.h"
+#include "Animation/Spline.h"
+#include "Animation/SplineKey.h"
+#include "Animation/SplineKeyTangents.h"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define RAMSES_ANIMATION_BATCH_USE_SSE
+#endif
+
+namespace ramses_internal
+{
+    void AnimationProcessBatch::add(const AnimationProcessData& processData)
+    {
+        const EDataTypeID dataType = processData.m_spline->getDataType();
+        Entry entry = { &processData, dataType, nullptr, 0u };
+
+        if (CanBatch(processData))
+        {
+            entry.m_stream = (processData.m_interpolationType == EInterpolationType_Step ? &m_stepStream : &m_linearStream);
+            entry.m_offset = static_cast<UInt32>(entry.m_stream->m_startValues.size());
+            addToStream(processData, dataType, *entry.m_stream);
+            ++m_numBatchedAnimations;
+        }
+
+        m_entries.push_back(entry);
+    }
+
+    void AnimationProcessBatch::process()
+    {
+        const UInt32 numStepComponents = static_cast<UInt32>(m_stepStream.m_startValues.size());
+        if (numStepComponents > 0u)
+        {
+            m_stepStream.m_results.resize(numStepComponents);
+            InterpolateStep(m_stepStream.m_startValues.data(), m_stepStream.m_endValues.data(), m_stepStream.m_fractions.data(), m_stepStream.m_results.data(), numStepComponents);
+        }
+        const UInt32 numLinearComponents = static_cast<UInt32>(m_linearStream.m_startValues.size());
+        if (numLinearComponents > 0u)
+        {
+            m_linearStream.m_results.resize(numLinearComponents);
+            InterpolateLinear(m_linearStream.m_startValues.data(), m_linearStream.m_endValues.data(), m_linearStream.m_fractions.data(), m_linearStream.m_results.data(), numLinearComponents);
+        }
+
+        for (const auto& entry : m_entries)
+        {
+            if (entry.m_stream == nullptr)
+            {
+                AnimationProcessDataDispatch dataDispatch(*entry.m_processData);
+                dataDispatch.dispatch();
+                continue;
+            }
+
+            switch (entry.m_dataType)
+            {
+            case EDataTypeID_Float:
+                DispatchResult<Float>(entry);
+                break;
+            case EDataTypeID_Vector2f:
+                DispatchResult<Vector2>(entry);
+                break;
+            case EDataTypeID_Vector3f:
+                DispatchResult<Vector3>(entry);
+                break;
+            case EDataTypeID_Vector4f:
+                DispatchResult<Vector4>(entry);
+                break;
+            default:
+                assert(false);
+            }
+        }
+
+        clear();
+    }
+
+    UInt32 AnimationProcessBatch::getNumAnimations() const
+    {
+        return static_cast<UInt32>(m_entries.size());
+    }
+
+    UInt32 AnimationProcessBatch::getNumBatchedAnimations() const
+    {
+        return m_numBatchedAnimations;
+    }
+
+    Bool AnimationProcessBatch::CanBatch(const AnimationProcessData& processData)
+    {
+        if (processData.m_spline == nullptr || !processData.m_splineIterator.getSegment().IsValid())
+        {
+            return false;
+        }
+
+        if (processData.m_interpolationType != EInterpolationType_Step && processData.m_interpolationType != EInterpolationType_Linear)
+        {
+            return false;
+        }
+
+        switch (processData.m_spline->getDataType())
+        {
+        case EDataTypeID_Float:
+        case EDataTypeID_Vector2f:
+        case EDataTypeID_Vector3f:
+        case EDataTypeID_Vector4f:
+            break;
+        default:
+            return false;
+        }
+
+        const ESplineKeyType keyType = processData.m_spline->getKeyType();
+        return keyType == ESplineKeyType_Basic || keyType == ESplineKeyType_Tangents;
+    }
+
+    void AnimationProcessBatch::InterpolateStep(const Float* startValues, const Float* endValues, const Float* fractions, Float* results, UInt32 count)
+    {
+        UInt32 i = 0u;
+#ifdef RAMSES_ANIMATION_BATCH_USE_SSE
+        const __m128 one = _mm_set1_ps(1.f);
+        for (; i + 4u <= count; i += 4u)
+        {
+            const __m128 startValue = _mm_loadu_ps(startValues + i);
+            const __m128 endValue = _mm_loadu_ps(endValues + i);
+            const __m128 isBeforeEnd = _mm_cmplt_ps(_mm_loadu_ps(fractions + i), one);
+            _mm_storeu_ps(results + i, _mm_or_ps(_mm_and_ps(isBeforeEnd, startValue), _mm_andnot_ps(isBeforeEnd, endValue)));
+        }
+#endif
+        // same expression as Interpolator::InterpolateStep so that results do not depend on batching
+        for (; i < count; ++i)
+        {
+            results[i] = (fractions[i] < 1.f ? startValues[i] : endValues[i]);
+        }
+    }
+
+    void AnimationProcessBatch::InterpolateLinear(const Float* startValues, const Float* endValues, const Float* fractions, Float* results, UInt32 count)
+    {
+        UInt32 i = 0u;
+#ifdef RAMSES_ANIMATION_BATCH_USE_SSE
+        for (; i + 4u <= count; i += 4u)
+        {
+            const __m128 startValue = _mm_loadu_ps(startValues + i);
+            const __m128 valDiff = _mm_sub_ps(_mm_loadu_ps(endValues + i), startValue);
+            _mm_storeu_ps(results + i, _mm_add_ps(startValue, _mm_mul_ps(valDiff, _mm_loadu_ps(fractions + i))));
+        }
+#endif
+        // same expression as Interpolator::InterpolateLinear so that results do not depend on batching
+        for (; i < count; ++i)
+        {
+            const Float valDiff = endValues[i] - startValues[i];
+            results[i] = startValues[i] + valDiff * fractions[i];
+        }
+    }
+
+    void AnimationProcessBatch::addToStream(const AnimationProcessData& processData, EDataTypeID dataType, ComponentStream& stream)
+    {
+        switch (dataType)
+        {
+        case EDataTypeID_Float:
+            AppendComponents<Float>(processData, stream);
+            break;
+        case EDataTypeID_Vector2f:
+            AppendComponents<Vector2>(processData, stream);
+            break;
+        case EDataTypeID_Vector3f:
+            AppendComponents<Vector3>(processData, stream);
+            break;
+        case EDataTypeID_Vector4f:
+            AppendComponents<Vector4>(processData, stream);
+            break;
+        default:
+            assert(false);
+        }
+    }
+
+    template <typename EDataType>
+    void AnimationProcessBatch::AppendComponents(const AnimationProcessData& processData, ComponentStream& stream)
+    {
+        const SplineSegment& segment = processData.m_splineIterator.getSegment();
+        const Float fraction = processData.m_splineIterator.getSegmentLocalTime();
+
+        if (processData.m_spline->getKeyType() == ESplineKeyType_Tangents)
+        {
+            const Spline<SplineKeyTangents, EDataType>& spline = static_cast<const Spline<SplineKeyTangents, EDataType>&>(*processData.m_spline);
+            AppendValueComponents(spline.getKey(segment.m_startIndex).m_value, spline.getKey(segment.m_endIndex).m_value, fraction, stream);
+        }
+        else
+        {
+            const Spline<SplineKey, EDataType>& spline = static_cast<const Spline<SplineKey, EDataType>&>(*processData.m_spline);
+            AppendValueComponents(spline.getKey(segment.m_startIndex).m_value, spline.getKey(segment.m_endIndex).m_value, fraction, stream);
+        }
+    }
+
+    template <typename EDataType>
+    void AnimationProcessBatch::AppendValueComponents(const EDataType& startValue, const EDataType& endValue, Float fraction, ComponentStream& stream)
+    {
+        typedef AnimatableTypeTraits<EDataType> TypeTraits;
+        for (UInt32 i = 0u; i < TypeTraits::NumComponents; ++i)
+        {
+            const EVectorComponent component = static_cast<EVectorComponent>(i);
+            stream.m_startValues.push_back(TypeTraits::GetComponent(startValue, component));
+            stream.m_endValues.push_back(TypeTraits::GetComponent(endValue, component));
+            stream.m_fractions.push_back(fraction);
+        }
+    }
+
+    template <typename EDataType>
+    void AnimationProcessBatch::DispatchResult(const Entry& entry)
+    {
+        typedef AnimatableTypeTraits<EDataType> TypeTraits;
+        EDataType interpolatedValue(0.f);
+        for (UInt32 i = 0u; i < TypeTraits::NumComponents; ++i)
+        {
+            TypeTraits::SetComponent(interpolatedValue, entry.m_stream->m_results[entry.m_offset + i], static_cast<EVectorComponent>(i));
+        }
+
+        AnimationProcessDataDispatch dataDispatch(*entry.m_processData);
+        dataDispatch.dispatchInterpolatedValue(interpolatedValue);
+    }
+
+    void AnimationProcessBatch::clear()
+    {
+        m_entries.clear();
+        for (ComponentStream* stream : { &m_stepStream, &m_linearStream })
+        {
+            stream->m_startValues.clear();
+            stream->m_endValues.clear();
+            stream->m_fractions.clear();
+            stream->m_results.clear();
+        }
+        m_numBatchedAnimations = 0u;
+    }
+}
@@ -24,7 +24,11 @@ namespace ramses_internal
     void AnimationProcessDataDispatch::dispatch()
     {
         m_processData.m_spline->dispatch(*this);
+        dispatchDataBinds();
+    }
 
+    void AnimationProcessDataDispatch::dispatchDataBinds()
+    {
         for (const auto dataBind : m_processData.m_dataBinds)
         {
             assert(dataBind != 0);
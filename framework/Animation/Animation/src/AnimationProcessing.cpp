@@ -64,27 +64,25 @@ namespace ramses_internal
 
     void AnimationProcessing::processActiveAnimations()
     {
-        for (AnimationProcessDataCache::DataProcessMap::Iterator it = m_processDataCache.begin();
-            it != m_processDataCache.end(); ++it)
+        for (auto& processData : m_processDataCache)
         {
-            AnimationProcessData& processData = it->value;
             if (processData.m_animation.isPlaying(m_timeStamp))
             {
-                processAnimation(processData);
+                updateSplineIterator(processData);
+                m_processBatch.add(processData);
             }
         }
+
+        m_processBatch.process();
     }
 
-    void AnimationProcessing::processAnimation(AnimationProcessData& processData)
+    void AnimationProcessing::updateSplineIterator(AnimationProcessData& processData) const
     {
         const SplineBase* const pSpline = processData.m_spline;
         const SplineTimeStamp splineTime = ComputeSplineTime(processData.m_animation, m_timeStamp);
         const Bool playReverse = (processData.m_animation.m_flags & Animation::EAnimationFlags_Reverse) != 0;
 
         processData.m_splineIterator.setTimeStamp(splineTime, pSpline, playReverse);
-
-        AnimationProcessDataDispatch dataDispatch(processData);
-        dataDispatch.dispatch();
     }
 
     void AnimationProcessing::resetProcessDataIfCached(AnimationHandle handle)
@@ -10,6 +10,7 @@
 #include "Animation/SplineKey.h"
 #include "Animation/SplineKeyTangents.h"
 #include "Animation/AnimationProcessing.h"
+#include "AnimationAPI/IAnimationSystemActivityListener.h"
 #include "Scene/SceneDataBinding.h"
 
 namespace ramses_internal
@@ -20,6 +21,8 @@ namespace ramses_internal
         , m_animationProcessing(NULL)
         , m_flags(flags)
         , m_handle(AnimationSystemHandle::Invalid())
+        , m_activityListener(NULL)
+        , m_active(false)
     {
         m_animationData.addListener(&m_animationLogic);
 
@@ -40,6 +43,11 @@ namespace ramses_internal
 
     AnimationSystem::~AnimationSystem()
     {
+        if (m_active && m_activityListener != NULL)
+        {
+            m_activityListener->onAnimationSystemDeactivated(*this);
+        }
+
         m_animationLogic.removeListener(m_animationProcessing);
         m_animationData.removeListener(&m_animationLogic);
         delete m_animationProcessing;
@@ -61,6 +69,7 @@ namespace ramses_internal
     void AnimationSystem::setTime(const AnimationTime& globalTime)
     {
         m_animationLogic.setTime(globalTime);
+        updateActivity();
     }
 
     const AnimationTime& AnimationSystem::getTime() const
@@ -247,6 +256,7 @@ namespace ramses_internal
         }
 
         m_animationData.setAnimationTimeRange(handle, timeStamp, stopTime);
+        updateActivity();
     }
 
     void AnimationSystem::setAnimationStopTime(AnimationHandle handle, const AnimationTime& timeStamp)
@@ -256,6 +266,7 @@ namespace ramses_internal
         {
             m_animationData.setAnimationTimeRange(handle, animation.m_startTime, timeStamp);
         }
+        updateActivity();
     }
 
     void AnimationSystem::setAnimationProperties(AnimationHandle handle, Float playbackSpeed, UInt32 flags, AnimationTime::Duration loopDuration, const AnimationTime& timeStamp)
@@ -276,6 +287,7 @@ namespace ramses_internal
         {
             setAnimationFlags(handle, flags, animation);
         }
+        updateActivity();
     }
 
     void AnimationSystem::stopAnimationAndRollback(AnimationHandle handle)
@@ -288,6 +300,7 @@ namespace ramses_internal
             m_animationData.setAnimationTimeRange(handle, animation.m_startTime, m_animationLogic.getTime());
             m_animationData.setAnimationProperties(handle, animation.m_playbackSpeed, flags, animation.m_loopDuration);
         }
+        updateActivity();
     }
 
     const SplineBase* AnimationSystem::getSpline(SplineHandle handle) const
@@ -377,6 +390,7 @@ namespace ramses_internal
             m_animationLogic.dequeueAnimation(handle);
         }
         m_animationData.removeAnimation(handle);
+        updateActivity();
     }
 
     SplineHandle AnimationSystem::allocateSplineBasic(EDataTypeID dataTypeID, SplineHandle handleRequest)
@@ -573,4 +587,31 @@ namespace ramses_internal
     {
         m_animationLogic.removeListener(listener);
     }
+
+    void AnimationSystem::setActivityListener(IAnimationSystemActivityListener* listener)
+    {
+        m_activityListener = listener;
+        m_active = false;
+        updateActivity();
+    }
+
+    void AnimationSystem::updateActivity()
+    {
+        const Bool active = (m_animationLogic.getNumActiveAnimations() + m_animationLogic.getNumPendingAnimations()) > 0u;
+        if (active != m_active)
+        {
+            m_active = active;
+            if (m_activityListener != NULL)
+            {
+                if (active)
+                {
+                    m_activityListener->onAnimationSystemActivated(*this);
+                }
+                else
+                {
+                    m_activityListener->onAnimationSystemDeactivated(*this);
+                }
+            }
+        }
+    }
 }
@@ -12,9 +12,10 @@
 
 namespace ramses_internal
 {
-    AnimationSystemFactory::AnimationSystemFactory(EAnimationSystemOwner ownerType, SceneActionCollection* actionCollector)
+    AnimationSystemFactory::AnimationSystemFactory(EAnimationSystemOwner ownerType, SceneActionCollection* actionCollector, IAnimationSystemActivityListener* activityListener)
         : m_ownerType(ownerType)
         , m_actionCollector(actionCollector)
+        , m_activityListener(activityListener)
     {
     }
 
@@ -27,9 +28,13 @@ namespace ramses_internal
             flags &= ~EAnimationSystemFlags_FullProcessing;
             return new AnimationSystem(flags, sizeInfo);
         case EAnimationSystemOwner_Renderer:
+        {
             // Renderer requires full processing
             flags |= EAnimationSystemFlags_FullProcessing;
-            return new AnimationSystem(flags, sizeInfo);
+            AnimationSystem* animationSystem = new AnimationSystem(flags, sizeInfo);
+            animationSystem->setActivityListener(m_activityListener);
+            return animationSystem;
+        }
         case EAnimationSystemOwner_Client:
             assert(m_actionCollector != 0);
             return new ActionCollectingAnimationSystem(flags, *m_actionCollector, sizeInfo);
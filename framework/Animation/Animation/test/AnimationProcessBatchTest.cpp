@@ -0,0 +1,159 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "AnimationTestUtils.h"
+#include "Animation/AnimationProcessBatch.h"
+#include "Animation/AnimationProcessData.h"
+#include "Animation/Interpolator.h"
+#include "Animation/SplineSolver.h"
+
+namespace ramses_internal
+{
+    class AnimationProcessBatchTest : public AnimationTest
+    {
+    public:
+        AnimationProcessBatchTest()
+        {
+            init();
+        }
+
+    protected:
+        AnimationProcessData createProcessData(EInterpolationType interpolationType, SplineTimeStamp splineTime)
+        {
+            const AnimationInstanceHandle instanceHandle = m_animationData.allocateAnimationInstance(m_animationData.getAnimationInstance(m_animationInstanceHandle).getSplineHandle(), interpolationType);
+            for (const auto dataBindHandle : m_animationData.getAnimationInstance(m_animationInstanceHandle).getDataBindings())
+            {
+                m_animationData.addDataBindingToAnimationInstance(instanceHandle, dataBindHandle);
+            }
+            const AnimationHandle animationHandle = m_animationData.allocateAnimation(instanceHandle);
+
+            AnimationProcessData processData;
+            m_animationData.getAnimationProcessData(animationHandle, processData);
+            processData.m_splineIterator.setTimeStamp(splineTime, processData.m_spline);
+            return processData;
+        }
+
+        Vector3 getExpectedValue(const AnimationProcessData& processData) const
+        {
+            const SplineVec3& spline = static_cast<const SplineVec3&>(*processData.m_spline);
+            return SplineSolverVec3(spline, processData.m_splineIterator, processData.m_interpolationType).getInterpolatedValue();
+        }
+
+        static void ExpectKernelsEqualToScalarInterpolation(UInt32 count)
+        {
+            Vector<Float> startValues(count);
+            Vector<Float> endValues(count);
+            Vector<Float> fractions(count);
+            for (UInt32 i = 0u; i < count; ++i)
+            {
+                startValues[i] = AnimationTestUtils::GetRandom<Float>();
+                endValues[i] = AnimationTestUtils::GetRandom<Float>();
+                fractions[i] = static_cast<Float>(i % 5u) * 0.25f;
+            }
+
+            Vector<Float> linearResults(count);
+            Vector<Float> stepResults(count);
+            AnimationProcessBatch::InterpolateLinear(startValues.data(), endValues.data(), fractions.data(), linearResults.data(), count);
+            AnimationProcessBatch::InterpolateStep(startValues.data(), endValues.data(), fractions.data(), stepResults.data(), count);
+
+            for (UInt32 i = 0u; i < count; ++i)
+            {
+                EXPECT_EQ(Interpolator::InterpolateLinear(startValues[i], endValues[i], fractions[i]), linearResults[i]);
+                EXPECT_EQ(Interpolator::InterpolateStep(startValues[i], endValues[i], fractions[i]), stepResults[i]);
+            }
+        }
+
+        AnimationProcessBatch m_batch;
+    };
+
+    TEST_F(AnimationProcessBatchTest, interpolationKernelsGiveSameResultsAsScalarInterpolation)
+    {
+        // covers counts which are not a multiple of vector width
+        for (UInt32 count = 1u; count <= 13u; ++count)
+        {
+            ExpectKernelsEqualToScalarInterpolation(count);
+        }
+    }
+
+    TEST_F(AnimationProcessBatchTest, canBatchOnlyStepAndLinearInterpolation)
+    {
+        EXPECT_TRUE(AnimationProcessBatch::CanBatch(createProcessData(EInterpolationType_Step, 15u)));
+        EXPECT_TRUE(AnimationProcessBatch::CanBatch(createProcessData(EInterpolationType_Linear, 15u)));
+        EXPECT_FALSE(AnimationProcessBatch::CanBatch(createProcessData(EInterpolationType_Bezier, 15u)));
+    }
+
+    TEST_F(AnimationProcessBatchTest, cannotBatchProcessDataWithoutValidSegment)
+    {
+        AnimationProcessData processData = createProcessData(EInterpolationType_Linear, 15u);
+        processData.m_splineIterator = SplineIterator();
+        EXPECT_FALSE(AnimationProcessBatch::CanBatch(processData));
+    }
+
+    TEST_F(AnimationProcessBatchTest, setsLinearlyInterpolatedValuesToDataBinds)
+    {
+        const AnimationProcessData processData = createProcessData(EInterpolationType_Linear, 17u);
+        m_batch.add(processData);
+        EXPECT_EQ(1u, m_batch.getNumAnimations());
+        EXPECT_EQ(1u, m_batch.getNumBatchedAnimations());
+        m_batch.process();
+
+        const Vector3 expectedValue = getExpectedValue(processData);
+        EXPECT_EQ(expectedValue, m_container.getVal1(0));
+        EXPECT_EQ(expectedValue, m_container.getVal1(1));
+    }
+
+    TEST_F(AnimationProcessBatchTest, setsStepInterpolatedValuesToDataBinds)
+    {
+        const AnimationProcessData processData = createProcessData(EInterpolationType_Step, 25u);
+        m_batch.add(processData);
+        m_batch.process();
+
+        const Vector3 expectedValue = getExpectedValue(processData);
+        EXPECT_EQ(expectedValue, m_container.getVal1(0));
+        EXPECT_EQ(expectedValue, m_container.getVal1(1));
+    }
+
+    TEST_F(AnimationProcessBatchTest, dispatchesNonBatchableAnimationsUsingScalarPath)
+    {
+        const AnimationProcessData processData = createProcessData(EInterpolationType_Bezier, 13u);
+        m_batch.add(processData);
+        EXPECT_EQ(1u, m_batch.getNumAnimations());
+        EXPECT_EQ(0u, m_batch.getNumBatchedAnimations());
+        m_batch.process();
+
+        const Vector3 expectedValue = getExpectedValue(processData);
+        EXPECT_EQ(expectedValue, m_container.getVal1(0));
+        EXPECT_EQ(expectedValue, m_container.getVal1(1));
+    }
+
+    TEST_F(AnimationProcessBatchTest, appliesValuesInOrderAnimationsWereAdded)
+    {
+        const AnimationProcessData processData1 = createProcessData(EInterpolationType_Bezier, 12u);
+        const AnimationProcessData processData2 = createProcessData(EInterpolationType_Linear, 22u);
+        m_batch.add(processData1);
+        m_batch.add(processData2);
+        m_batch.process();
+
+        // both animations target same data, last added wins as with unbatched processing
+        const Vector3 expectedValue = getExpectedValue(processData2);
+        EXPECT_EQ(expectedValue, m_container.getVal1(0));
+        EXPECT_EQ(expectedValue, m_container.getVal1(1));
+    }
+
+    TEST_F(AnimationProcessBatchTest, isEmptyAfterProcessing)
+    {
+        const AnimationProcessData processData = createProcessData(EInterpolationType_Linear, 17u);
+        m_batch.add(processData);
+        m_batch.add(processData);
+        EXPECT_EQ(2u, m_batch.getNumAnimations());
+        m_batch.process();
+
+        EXPECT_EQ(0u, m_batch.getNumAnimations());
+        EXPECT_EQ(0u, m_batch.getNumBatchedAnimations());
+    }
+}
@@ -13,6 +13,7 @@
 #include "Scene/Scene.h"
 #include "Scene/SceneDataBinding.h"
 #include "Animation/AnimationLogicListener.h"
+#include "AnimationAPI/IAnimationSystemActivityListener.h"
 
 using namespace testing;
 
@@ -28,6 +29,13 @@ namespace ramses_internal
         MOCK_METHOD1(onAnimationFinished, void(AnimationHandle handle));
     };
 
+    class MockAnimationSystemActivityListener : public IAnimationSystemActivityListener
+    {
+    public:
+        MOCK_METHOD1(onAnimationSystemActivated, void(IAnimationSystem& animationSystem));
+        MOCK_METHOD1(onAnimationSystemDeactivated, void(IAnimationSystem& animationSystem));
+    };
+
     class AnimationSystemTest : public testing::Test
     {
     public:
@@ -99,4 +107,40 @@ namespace ramses_internal
         m_animationSystem.setTime(20u);
         EXPECT_FALSE(m_animationSystem.hasActiveAnimations());
     }
+
+    TEST_F(AnimationSystemTest, notifiesActivityListenerWhenAnimationsBecomePendingAndFinish)
+    {
+        StrictMock<MockAnimationSystemActivityListener> activityListener;
+        m_animationSystem.setActivityListener(&activityListener);
+
+        const AnimationHandle animHandle = createAnimation();
+
+        EXPECT_CALL(activityListener, onAnimationSystemActivated(Ref(m_animationSystem)));
+        m_animationSystem.setAnimationStartTime(animHandle, 10u);
+        m_animationSystem.setAnimationStopTime(animHandle, 20u);
+        Mock::VerifyAndClearExpectations(&activityListener);
+
+        m_animationSystem.setTime(10u);
+        Mock::VerifyAndClearExpectations(&activityListener);
+
+        EXPECT_CALL(activityListener, onAnimationSystemDeactivated(Ref(m_animationSystem)));
+        m_animationSystem.setTime(20u);
+        Mock::VerifyAndClearExpectations(&activityListener);
+
+        m_animationSystem.setActivityListener(NULL);
+    }
+
+    TEST_F(AnimationSystemTest, notifiesActivityListenerImmediatelyIfAlreadyActive)
+    {
+        const AnimationHandle animHandle = createAnimation();
+        m_animationSystem.setAnimationStartTime(animHandle, 10u);
+        m_animationSystem.setAnimationStopTime(animHandle, 20u);
+
+        StrictMock<MockAnimationSystemActivityListener> activityListener;
+        EXPECT_CALL(activityListener, onAnimationSystemActivated(Ref(m_animationSystem)));
+        m_animationSystem.setActivityListener(&activityListener);
+        Mock::VerifyAndClearExpectations(&activityListener);
+
+        m_animationSystem.setActivityListener(NULL);
+    }
 }
@@ -27,6 +27,7 @@ namespace ramses_internal
     class AnimationInstance;
     class Animation;
     class AnimationLogicListener;
+    class IAnimationSystemActivityListener;
 
     class IAnimationSystem
     {
@@ -97,6 +98,7 @@ namespace ramses_internal
 
         virtual void                         registerAnimationLogicListener(AnimationLogicListener* listener) = 0;
         virtual void                         unregisterAnimationLogicListener(AnimationLogicListener* listener) = 0;
+        virtual void                         setActivityListener(IAnimationSystemActivityListener* listener) = 0;
     };
 }
 
@@ -0,0 +1,31 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_IANIMATIONSYSTEMACTIVITYLISTENER_H
+#define RAMSES_IANIMATIONSYSTEMACTIVITYLISTENER_H
+
+namespace ramses_internal
+{
+    class IAnimationSystem;
+
+    // Notified when animation system starts or stops needing time updates.
+    // Animation system is active as long as it has animations which are active or pending to be started.
+    class IAnimationSystemActivityListener
+    {
+    public:
+        virtual ~IAnimationSystemActivityListener()
+        {
+        }
+
+        virtual void onAnimationSystemActivated(IAnimationSystem& animationSystem) = 0;
+        // Also sent when active animation system is destroyed
+        virtual void onAnimationSystemDeactivated(IAnimationSystem& animationSystem) = 0;
+    };
+}
+
+#endif
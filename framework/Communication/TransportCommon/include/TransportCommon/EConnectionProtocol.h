@@ -17,6 +17,7 @@ namespace ramses_internal
     {
         EConnectionProtocol_TCP = 0,
         EConnectionProtocol_Fake,
+        EConnectionProtocol_SharedMemory,
         EConnectionProtocol_Invalid,
         EConnectionProtocol_NUMBER_OF_ELEMENTS
     };
@@ -25,6 +26,7 @@ namespace ramses_internal
     {
         "TCP",
         "Fake",
+        "SharedMemory",
         "Invalid"
     };
 
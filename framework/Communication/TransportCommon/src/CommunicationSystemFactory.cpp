@@ -33,9 +33,9 @@ namespace ramses_internal
 #if defined(HAS_TCP_COMM)
         // Construct TCPConnectionSystem
         TCPConnectionSystem* ConstructTCPConnectionManager(const ramses::RamsesFrameworkConfigImpl& config, const ParticipantIdentifier& participantIdentifier,
-            PlatformLock& frameworkLock, StatisticCollectionFramework& statisticCollection)
+            PlatformLock& frameworkLock, StatisticCollectionFramework& statisticCollection, bool useSharedMemory)
         {
-            LOG_INFO(CONTEXT_COMMUNICATION, "Use TCPConnectionSystem");
+            LOG_INFO(CONTEXT_COMMUNICATION, "Use TCPConnectionSystem" << (useSharedMemory ? " with shared memory for local participants" : ""));
 
             // own address
             const bool isDaemon = false;
@@ -49,7 +49,12 @@ namespace ramses_internal
             LOG_DEBUG(CONTEXT_COMMUNICATION, "ConstructTCPConnectionManager: Daemon Address: " << daemonNetworkAddress.getIp() << ":" << daemonNetworkAddress.getPort());
 
             // allocate
-            return new TCPConnectionSystem(participantNetworkAddress, config.getProtocolVersion(), isDaemon, daemonNetworkAddress, frameworkLock, statisticCollection);
+            TCPConnectionSystem* connectionSystem = new TCPConnectionSystem(participantNetworkAddress, config.getProtocolVersion(), isDaemon, daemonNetworkAddress, frameworkLock, statisticCollection, useSharedMemory);
+            if (config.m_tcpConfig.getResourceTransferBandwidthLimit() != 0u)
+            {
+                connectionSystem->setResourceTransferBandwidthLimit(config.m_tcpConfig.getResourceTransferBandwidthLimit());
+            }
+            return connectionSystem;
         }
 #endif
 
@@ -66,6 +71,7 @@ namespace ramses_internal
         switch(config.getUsedProtocol())
         {
             case EConnectionProtocol_TCP:
+            case EConnectionProtocol_SharedMemory:
             {
 #if defined(HAS_TCP_COMM)
                 constructedDaemon = new TcpDiscoveryDaemon(config, frameworkLock, statisticCollection, optionalRamsh);
@@ -94,7 +100,13 @@ namespace ramses_internal
 #if defined(HAS_TCP_COMM)
         case EConnectionProtocol_TCP:
         {
-            TCPConnectionSystem* connectionManager = ConstructTCPConnectionManager(config, participantIdentifier, frameworkLock, statisticCollection);
+            TCPConnectionSystem* connectionManager = ConstructTCPConnectionManager(config, participantIdentifier, frameworkLock, statisticCollection, false);
+            return connectionManager;
+        }
+        case EConnectionProtocol_SharedMemory:
+        {
+            // discovery and connection handling as TCP, messages to participants on the same host bypass the sockets
+            TCPConnectionSystem* connectionManager = ConstructTCPConnectionManager(config, participantIdentifier, frameworkLock, statisticCollection, true);
             return connectionManager;
         }
 #endif
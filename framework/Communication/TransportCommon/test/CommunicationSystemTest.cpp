@@ -199,7 +199,7 @@ namespace ramses_internal
     };
 
     INSTANTIATE_TEST_CASE_P(TypedCommunicationTest, ACommunicationSystemWithDaemonMultiParticipant,
-        ::testing::ValuesIn(CommunicationSystemTestState::GetAvailableCommunicationSystemTypes(ECommunicationSystemType_Tcp)));
+        ::testing::ValuesIn(CommunicationSystemTestState::GetAvailableCommunicationSystemTypes(ECommunicationSystemType_Tcp | ECommunicationSystemType_SharedMemory)));
 
     TEST_P(ACommunicationSystemWithDaemonMultiParticipant, canSendMessageInBothDirectionBetweenTwoParticipants)
     {
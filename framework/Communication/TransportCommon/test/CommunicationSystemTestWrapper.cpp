@@ -28,11 +28,24 @@ namespace ramses_internal
         case ECommunicationSystemType_Tcp:
             *os << type << " (ECommunicationSystemType_Tcp)";
             break;
+        case ECommunicationSystemType_SharedMemory:
+            *os << type << " (ECommunicationSystemType_SharedMemory)";
+            break;
         default:
             *os << type << " (INVALID ECommunicationSystemType)";
         }
     }
 
+    namespace
+    {
+        const char* const SharedMemoryArguments[] = { "", "--sharedMemory" };
+
+        Int32 GetArgumentCount(ECommunicationSystemType type)
+        {
+            return type == ECommunicationSystemType_SharedMemory ? 2 : 0;
+        }
+    }
+
     AsyncEventCounter::AsyncEventCounter(UInt32 waitTimeMs)
         : m_eventCounter(0)
         , m_waitTimeMs(waitTimeMs)
@@ -155,6 +168,12 @@ namespace ramses_internal
         {
             ret.push_back(ECommunicationSystemType_Tcp);
         }
+#endif
+#if defined(HAS_SHARED_MEMORY_COMM)
+        if (mask & ECommunicationSystemType_SharedMemory)
+        {
+            ret.push_back(ECommunicationSystemType_SharedMemory);
+        }
 #endif
         return ret;
     }
@@ -164,7 +183,7 @@ namespace ramses_internal
         : id(id_)
         , state(state_)
     {
-        ramses::RamsesFrameworkConfigImpl config(0, NULL);
+        ramses::RamsesFrameworkConfigImpl config(GetArgumentCount(state.communicationSystemType), SharedMemoryArguments);
         config.enableProtocolVersionOffset();
         state.applyConfigurationForSelectedConnectionSystemType(config, false, commSysConfig_);
 
@@ -195,7 +214,7 @@ namespace ramses_internal
 
     CommunicationSystemDiscoveryDaemonTestWrapper::CommunicationSystemDiscoveryDaemonTestWrapper(CommunicationSystemTestState& state_)
     {
-        ramses::RamsesFrameworkConfigImpl config(0, NULL);
+        ramses::RamsesFrameworkConfigImpl config(GetArgumentCount(state_.communicationSystemType), SharedMemoryArguments);
         config.enableProtocolVersionOffset();
         state_.applyConfigurationForSelectedConnectionSystemType(config, true, ECommunicationSystemTestConfiguration_Default);
 
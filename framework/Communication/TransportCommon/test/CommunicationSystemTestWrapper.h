@@ -26,6 +26,7 @@ namespace ramses_internal
     enum ECommunicationSystemType
     {
         ECommunicationSystemType_Tcp = BIT(0),
+        ECommunicationSystemType_SharedMemory = BIT(1),
         ECommunicationSystemType_All = BIT(3) - 1
     };
 
@@ -0,0 +1,160 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_SHAREDMEMORYCHANNEL_H
+#define RAMSES_SHAREDMEMORYCHANNEL_H
+
+#include "TransportSharedMemory/SharedMemoryRingBuffer.h"
+#include "Collections/Guid.h"
+#include <functional>
+#include <deque>
+#include <vector>
+#include <chrono>
+
+namespace ramses_internal
+{
+    enum ESharedMemoryReceiveResult
+    {
+        ESharedMemoryReceiveResult_Message = 0,
+        ESharedMemoryReceiveResult_NoMessage,
+        ESharedMemoryReceiveResult_Error
+    };
+
+    enum ESharedMemorySendResult
+    {
+        ESharedMemorySendResult_Sent = 0,
+        // receiver is behind, message is kept in the channel until sendQueuedMessages gets it through
+        ESharedMemorySendResult_Queued,
+        ESharedMemorySendResult_Error
+    };
+
+    enum ESharedMemoryHandshakeState
+    {
+        ESharedMemoryHandshakeState_InProgress = 0,
+        ESharedMemoryHandshakeState_Complete,
+        ESharedMemoryHandshakeState_Failed
+    };
+
+    // Bidirectional message channel between two participants on the same host.
+    // Every side owns the ring it receives from and an eventfd the other side signals after writing.
+    // Messages too large for the ring are passed as sealed memory file over the unix socket used for
+    // the handshake, a marker record in the ring keeps them in order with all other messages.
+    // The channel never blocks: when the ring is full messages are queued and the receiver signals
+    // back once it made space, the owner then calls sendQueuedMessages.
+    class SharedMemoryChannel final
+    {
+    public:
+        // called for every received message, data is only valid during the call
+        typedef std::function<void(UInt32 tag, const Byte* data, UInt32 size)> MessageHandler;
+
+        ~SharedMemoryChannel();
+
+        // listening socket for channels to participant localId, returns -1 on failure
+        static int CreateListener(const Guid& localId);
+
+        ESharedMemorySendResult send(UInt32 tag, const Byte* data, UInt32 size);
+        // returns false if the channel broke
+        Bool sendQueuedMessages();
+        Bool hasQueuedMessages() const;
+        ESharedMemoryReceiveResult receive(const MessageHandler& handler);
+
+        // consume pending signals, call before draining all messages with receive and retrying queued messages
+        void clearSignal();
+        int getSignalFileDescriptor() const;
+
+        static const UInt32 RingBufferCapacity = 4u * 1024u * 1024u;
+        // larger messages are never copied through the ring, resource chunks of the TCP transport still fit
+        static const UInt32 MaximumInlineMessageSize = RingBufferCapacity / 2u;
+        // send fails instead of queueing more for a receiver which does not make progress
+        static const UInt32 MaximumQueuedSize = 16u * RingBufferCapacity;
+        static const UInt32 HandshakeTimeoutMs = 1000u;
+
+    private:
+        friend class SharedMemoryHandshake;
+        struct RecordHeader;
+
+        struct QueuedMessage
+        {
+            UInt32 tag;
+            std::vector<Byte> data;
+        };
+
+        SharedMemoryChannel(int socket, std::unique_ptr<SharedMemoryRingBuffer> sendRing, int sendSignal, std::unique_ptr<SharedMemoryRingBuffer> receiveRing, int receiveSignal);
+
+        ESharedMemorySendResult trySend(UInt32 tag, const Byte* data, UInt32 size);
+        ESharedMemorySendResult writeRecord(const RecordHeader& header, const Byte* data, UInt32 size);
+        ESharedMemorySendResult sendAsMemoryFile(UInt32 tag, const Byte* data, UInt32 size);
+        Bool receiveMemoryFile(const RecordHeader& header, const MessageHandler& handler);
+        void signal();
+
+        int m_socket;
+        std::unique_ptr<SharedMemoryRingBuffer> m_sendRing;
+        int m_sendSignal;
+        std::unique_ptr<SharedMemoryRingBuffer> m_receiveRing;
+        int m_receiveSignal;
+        std::deque<QueuedMessage> m_queuedMessages;
+        UInt64 m_queuedSize;
+        std::vector<Byte> m_receiveBuffer;
+    };
+
+    // Sets up a channel without blocking. The initiator connects to the listener of the remote participant and
+    // both sides exchange the descriptors of the ring they receive from, then the initiator confirms it can use
+    // the channel. Call continueHandshake whenever the socket is readable until it is no longer in progress.
+    class SharedMemoryHandshake final
+    {
+    public:
+        ~SharedMemoryHandshake();
+
+        // returns nullptr if remote participant is not on this host or does not use shared memory
+        static std::unique_ptr<SharedMemoryHandshake> Connect(const Guid& localId, const Guid& remoteId);
+        static std::unique_ptr<SharedMemoryHandshake> Accept(int listener, const Guid& localId);
+
+        ESharedMemoryHandshakeState continueHandshake();
+        Bool isWaitingForAcknowledge() const;
+        Bool hasTimedOut(std::chrono::steady_clock::time_point now) const;
+        // channel of a complete handshake, can be taken once
+        std::unique_ptr<SharedMemoryChannel> takeChannel();
+
+        int getSocket() const;
+        Bool isInitiator() const;
+        // invalid on accepting side until hello of initiator was received
+        const Guid& getRemoteId() const;
+
+    private:
+        enum EState
+        {
+            EState_WaitingForHello = 0,
+            EState_WaitingForAcknowledge,
+            EState_Complete,
+            EState_Failed
+        };
+
+        SharedMemoryHandshake(int socket, const Guid& localId, const Guid& remoteId, Bool isInitiator);
+
+        Bool createReceiveRing();
+        Bool sendHello();
+        ESharedMemoryHandshakeState receiveHello();
+        ESharedMemoryHandshakeState receiveAcknowledge();
+        ESharedMemoryHandshakeState fail();
+        ESharedMemoryHandshakeState complete();
+
+        int m_socket;
+        const Guid m_localId;
+        Guid m_remoteId;
+        const Bool m_isInitiator;
+        const std::chrono::steady_clock::time_point m_startTime;
+        EState m_state;
+        std::unique_ptr<SharedMemoryRingBuffer> m_receiveRing;
+        int m_receiveSignal;
+        std::unique_ptr<SharedMemoryRingBuffer> m_sendRing;
+        int m_sendSignal;
+        std::unique_ptr<SharedMemoryChannel> m_channel;
+    };
+}
+
+#endif
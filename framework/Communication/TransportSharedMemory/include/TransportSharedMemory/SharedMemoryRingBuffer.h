@@ -0,0 +1,61 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_SHAREDMEMORYRINGBUFFER_H
+#define RAMSES_SHAREDMEMORYRINGBUFFER_H
+
+#include "PlatformAbstraction/PlatformTypes.h"
+#include <memory>
+
+namespace ramses_internal
+{
+    // Single producer / single consumer byte ring living in a memory file which can be mapped by
+    // two processes. Writer and reader only share the two positions, records are written as a whole.
+    class SharedMemoryRingBuffer final
+    {
+    public:
+        ~SharedMemoryRingBuffer();
+
+        // capacity is rounded up to the next power of two
+        static std::unique_ptr<SharedMemoryRingBuffer> Create(UInt32 capacity);
+        // takes ownership of fileDescriptor, also on failure
+        static std::unique_ptr<SharedMemoryRingBuffer> Attach(int fileDescriptor);
+
+        // writes both parts as one record or nothing if there is not enough space
+        Bool write(const void* header, UInt32 headerSize, const void* data, UInt32 dataSize);
+        // reads exactly size bytes or nothing if less are available
+        Bool read(void* destination, UInt32 size);
+
+        // writer asks reader to notify it after the next read, returns true if size bytes became writable meanwhile
+        Bool requestSpace(UInt32 size);
+        // reader takes pending request of writer, caller has to notify writer if it returns true
+        Bool takeSpaceRequest();
+
+        UInt32 getReadableSize() const;
+        UInt32 getWritableSize() const;
+        UInt32 getCapacity() const;
+        int getFileDescriptor() const;
+
+    private:
+        struct Header;
+
+        SharedMemoryRingBuffer(int fileDescriptor, void* mapping, UInt32 mappingSize);
+
+        void copyIn(UInt64 position, const void* data, UInt32 size);
+        void copyOut(UInt64 position, void* destination, UInt32 size) const;
+
+        const int m_fileDescriptor;
+        void* const m_mapping;
+        const UInt32 m_mappingSize;
+        Header& m_header;
+        Byte* const m_data;
+        const UInt32 m_capacity;
+    };
+}
+
+#endif
@@ -0,0 +1,34 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_SHAREDMEMORYUTILITIES_H
+#define RAMSES_SHAREDMEMORYUTILITIES_H
+
+#include "PlatformAbstraction/PlatformTypes.h"
+
+namespace ramses_internal
+{
+    namespace SharedMemoryUtilities
+    {
+        // anonymous memory file of given size, returns -1 on failure
+        int CreateMemoryFile(const char* name, UInt32 size);
+        // prevents any further modification of a memory file filled with write()
+        Bool SealMemoryFile(int fileDescriptor);
+        Bool IsMemoryFileSealed(int fileDescriptor);
+        UInt32 GetMemoryFileSize(int fileDescriptor);
+
+        // send data together with file descriptors over a unix domain socket, returns number of sent bytes or -1
+        Int32 SendWithFileDescriptors(int socket, const void* data, UInt32 size, const int* fileDescriptors, UInt32 fileDescriptorCount);
+        // receive data and up to maxFileDescriptorCount file descriptors, returns number of received bytes or -1
+        Int32 ReceiveWithFileDescriptors(int socket, void* data, UInt32 size, int* fileDescriptors, UInt32 maxFileDescriptorCount, UInt32& receivedFileDescriptorCount);
+
+        void CloseFileDescriptor(int& fileDescriptor);
+    }
+}
+
+#endif
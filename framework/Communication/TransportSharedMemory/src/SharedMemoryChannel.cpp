@@ -0,0 +1,540 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "TransportSharedMemory/SharedMemoryChannel.h"
+#include "TransportSharedMemory/SharedMemoryUtilities.h"
+#include "PlatformAbstraction/PlatformMemory.h"
+#include "Utils/LogMacros.h"
+
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <errno.h>
+#include <limits>
+
+namespace ramses_internal
+{
+    const UInt32 SharedMemoryChannel::RingBufferCapacity;
+    const UInt32 SharedMemoryChannel::MaximumInlineMessageSize;
+    const UInt32 SharedMemoryChannel::MaximumQueuedSize;
+    const UInt32 SharedMemoryChannel::HandshakeTimeoutMs;
+
+    enum ERecordKind
+    {
+        ERecordKind_Inline = 0,
+        ERecordKind_MemoryFile
+    };
+
+    struct SharedMemoryChannel::RecordHeader
+    {
+        UInt32 size;
+        UInt32 tag;
+        UInt32 kind;
+    };
+
+    namespace
+    {
+        const UInt32 HandshakeMagic = 0x52534D48u;
+
+        struct HandshakeMessage
+        {
+            UInt32 magic;
+            generic_uuid_t participantId;
+        };
+
+        socklen_t GetListenerAddress(const Guid& participantId, sockaddr_un& address)
+        {
+            // abstract socket namespace: nothing in the file system to clean up and only reachable on the same host
+            const String name = String("ramses-shm-") + participantId.toString();
+            PlatformMemory::Set(&address, 0, sizeof(address));
+            address.sun_family = AF_UNIX;
+            const UInt32 nameLength = std::min(static_cast<UInt32>(name.getLength()), static_cast<UInt32>(sizeof(address.sun_path) - 1u));
+            PlatformMemory::Copy(address.sun_path + 1, name.c_str(), nameLength);
+            return static_cast<socklen_t>(offsetof(sockaddr_un, sun_path) + 1u + nameLength);
+        }
+    }
+
+    SharedMemoryChannel::SharedMemoryChannel(int socket, std::unique_ptr<SharedMemoryRingBuffer> sendRing, int sendSignal, std::unique_ptr<SharedMemoryRingBuffer> receiveRing, int receiveSignal)
+        : m_socket(socket)
+        , m_sendRing(std::move(sendRing))
+        , m_sendSignal(sendSignal)
+        , m_receiveRing(std::move(receiveRing))
+        , m_receiveSignal(receiveSignal)
+        , m_queuedSize(0u)
+    {
+    }
+
+    SharedMemoryChannel::~SharedMemoryChannel()
+    {
+        SharedMemoryUtilities::CloseFileDescriptor(m_socket);
+        SharedMemoryUtilities::CloseFileDescriptor(m_sendSignal);
+        SharedMemoryUtilities::CloseFileDescriptor(m_receiveSignal);
+    }
+
+    int SharedMemoryChannel::CreateListener(const Guid& localId)
+    {
+        int listener = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC | SOCK_NONBLOCK, 0);
+        if (listener < 0)
+        {
+            return -1;
+        }
+
+        sockaddr_un address;
+        const socklen_t addressLength = GetListenerAddress(localId, address);
+        if (bind(listener, reinterpret_cast<const sockaddr*>(&address), addressLength) != 0 || listen(listener, 8) != 0)
+        {
+            LOG_WARN(CONTEXT_COMMUNICATION, "SharedMemoryChannel::CreateListener: failed to listen for " << localId << ", errno " << errno);
+            SharedMemoryUtilities::CloseFileDescriptor(listener);
+            return -1;
+        }
+        return listener;
+    }
+
+    ESharedMemorySendResult SharedMemoryChannel::send(UInt32 tag, const Byte* data, UInt32 size)
+    {
+        // keep order with messages which did not fit before
+        if (!sendQueuedMessages())
+        {
+            return ESharedMemorySendResult_Error;
+        }
+
+        if (m_queuedMessages.empty())
+        {
+            const ESharedMemorySendResult result = trySend(tag, data, size);
+            if (result != ESharedMemorySendResult_Queued)
+            {
+                return result;
+            }
+        }
+
+        if (m_queuedSize + size > MaximumQueuedSize)
+        {
+            LOG_WARN(CONTEXT_COMMUNICATION, "SharedMemoryChannel::send: receiver does not make progress, " << m_queuedSize << " bytes queued");
+            return ESharedMemorySendResult_Error;
+        }
+
+        QueuedMessage message;
+        message.tag = tag;
+        message.data.assign(data, data + size);
+        m_queuedMessages.push_back(std::move(message));
+        m_queuedSize += size;
+        return ESharedMemorySendResult_Queued;
+    }
+
+    Bool SharedMemoryChannel::sendQueuedMessages()
+    {
+        while (!m_queuedMessages.empty())
+        {
+            const QueuedMessage& message = m_queuedMessages.front();
+            const ESharedMemorySendResult result = trySend(message.tag, message.data.data(), static_cast<UInt32>(message.data.size()));
+            if (result == ESharedMemorySendResult_Error)
+            {
+                return false;
+            }
+            if (result == ESharedMemorySendResult_Queued)
+            {
+                return true;
+            }
+            m_queuedSize -= message.data.size();
+            m_queuedMessages.pop_front();
+        }
+        return true;
+    }
+
+    Bool SharedMemoryChannel::hasQueuedMessages() const
+    {
+        return !m_queuedMessages.empty();
+    }
+
+    ESharedMemorySendResult SharedMemoryChannel::trySend(UInt32 tag, const Byte* data, UInt32 size)
+    {
+        if (size > MaximumInlineMessageSize)
+        {
+            return sendAsMemoryFile(tag, data, size);
+        }
+
+        const RecordHeader header = { size, tag, ERecordKind_Inline };
+        return writeRecord(header, data, size);
+    }
+
+    ESharedMemorySendResult SharedMemoryChannel::writeRecord(const RecordHeader& header, const Byte* data, UInt32 size)
+    {
+        // receiver signals back after reading when it sees the request, so queued messages are retried in time
+        if (!m_sendRing->write(&header, sizeof(header), data, size) &&
+            (!m_sendRing->requestSpace(sizeof(header) + size) || !m_sendRing->write(&header, sizeof(header), data, size)))
+        {
+            return ESharedMemorySendResult_Queued;
+        }
+
+        signal();
+        return ESharedMemorySendResult_Sent;
+    }
+
+    ESharedMemorySendResult SharedMemoryChannel::sendAsMemoryFile(UInt32 tag, const Byte* data, UInt32 size)
+    {
+        // marker must fit once the descriptor is sent, nobody else writes to the ring meanwhile
+        const RecordHeader header = { size, tag, ERecordKind_MemoryFile };
+        if (m_sendRing->getWritableSize() < sizeof(header) && !m_sendRing->requestSpace(sizeof(header)))
+        {
+            return ESharedMemorySendResult_Queued;
+        }
+
+        int memoryFile = SharedMemoryUtilities::CreateMemoryFile("ramses-message", 0u);
+        if (memoryFile < 0)
+        {
+            return ESharedMemorySendResult_Error;
+        }
+
+        UInt32 writtenBytes = 0u;
+        while (writtenBytes < size)
+        {
+            const ssize_t result = ::write(memoryFile, data + writtenBytes, size - writtenBytes);
+            if (result < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (result <= 0)
+            {
+                SharedMemoryUtilities::CloseFileDescriptor(memoryFile);
+                return ESharedMemorySendResult_Error;
+            }
+            writtenBytes += static_cast<UInt32>(result);
+        }
+
+        // receiver only maps sealed files, the sender can not modify them anymore afterwards
+        if (!SharedMemoryUtilities::SealMemoryFile(memoryFile))
+        {
+            SharedMemoryUtilities::CloseFileDescriptor(memoryFile);
+            return ESharedMemorySendResult_Error;
+        }
+
+        const Int32 sentBytes = SharedMemoryUtilities::SendWithFileDescriptors(m_socket, &header, sizeof(header), &memoryFile, 1u);
+        const Bool socketFull = sentBytes < 0 && (errno == EAGAIN || errno == EWOULDBLOCK);
+        SharedMemoryUtilities::CloseFileDescriptor(memoryFile);
+        if (socketFull)
+        {
+            // too many memory files in flight, their markers are still unread so the receiver signals back after reading
+            m_sendRing->requestSpace(std::numeric_limits<UInt32>::max());
+            return ESharedMemorySendResult_Queued;
+        }
+        if (sentBytes != static_cast<Int32>(sizeof(header)))
+        {
+            return ESharedMemorySendResult_Error;
+        }
+
+        // marker record keeps order with messages passed through the ring
+        return writeRecord(header, nullptr, 0u) == ESharedMemorySendResult_Sent ? ESharedMemorySendResult_Sent : ESharedMemorySendResult_Error;
+    }
+
+    ESharedMemoryReceiveResult SharedMemoryChannel::receive(const MessageHandler& handler)
+    {
+        RecordHeader header;
+        if (!m_receiveRing->read(&header, sizeof(header)))
+        {
+            return ESharedMemoryReceiveResult_NoMessage;
+        }
+
+        Bool success = false;
+        if (header.kind == ERecordKind_Inline)
+        {
+            // whole record is always written at once, copied out before handling so the sender can continue
+            if (header.size <= m_receiveRing->getReadableSize())
+            {
+                m_receiveBuffer.resize(header.size);
+                success = m_receiveRing->read(m_receiveBuffer.data(), header.size);
+            }
+            if (success && m_receiveRing->takeSpaceRequest())
+            {
+                signal();
+            }
+            if (success)
+            {
+                handler(header.tag, m_receiveBuffer.data(), header.size);
+            }
+        }
+        else if (header.kind == ERecordKind_MemoryFile)
+        {
+            if (m_receiveRing->takeSpaceRequest())
+            {
+                signal();
+            }
+            success = receiveMemoryFile(header, handler);
+        }
+
+        return success ? ESharedMemoryReceiveResult_Message : ESharedMemoryReceiveResult_Error;
+    }
+
+    Bool SharedMemoryChannel::receiveMemoryFile(const RecordHeader& header, const MessageHandler& handler)
+    {
+        // descriptor was sent before the marker was written, so it is already queued
+        RecordHeader socketHeader;
+        int memoryFile = -1;
+        UInt32 fileDescriptorCount = 0u;
+        const Int32 receivedBytes = SharedMemoryUtilities::ReceiveWithFileDescriptors(m_socket, &socketHeader, sizeof(socketHeader), &memoryFile, 1u, fileDescriptorCount);
+        if (receivedBytes != static_cast<Int32>(sizeof(socketHeader)) || fileDescriptorCount != 1u)
+        {
+            SharedMemoryUtilities::CloseFileDescriptor(memoryFile);
+            return false;
+        }
+
+        if (socketHeader.size != header.size || socketHeader.tag != header.tag ||
+            !SharedMemoryUtilities::IsMemoryFileSealed(memoryFile) || SharedMemoryUtilities::GetMemoryFileSize(memoryFile) != header.size)
+        {
+            SharedMemoryUtilities::CloseFileDescriptor(memoryFile);
+            return false;
+        }
+
+        Bool success = true;
+        if (header.size > 0u)
+        {
+            // sealed file can not change anymore, so the message is handled directly from the mapping
+            void* mapping = mmap(nullptr, header.size, PROT_READ, MAP_SHARED | MAP_POPULATE, memoryFile, 0);
+            if (mapping != MAP_FAILED)
+            {
+                handler(header.tag, static_cast<const Byte*>(mapping), header.size);
+                munmap(mapping, header.size);
+            }
+            else
+            {
+                success = false;
+            }
+        }
+        else
+        {
+            handler(header.tag, nullptr, 0u);
+        }
+
+        SharedMemoryUtilities::CloseFileDescriptor(memoryFile);
+        return success;
+    }
+
+    void SharedMemoryChannel::signal()
+    {
+        eventfd_write(m_sendSignal, 1u);
+    }
+
+    void SharedMemoryChannel::clearSignal()
+    {
+        eventfd_t value = 0u;
+        eventfd_read(m_receiveSignal, &value);
+    }
+
+    int SharedMemoryChannel::getSignalFileDescriptor() const
+    {
+        return m_receiveSignal;
+    }
+
+    SharedMemoryHandshake::SharedMemoryHandshake(int socket, const Guid& localId, const Guid& remoteId, Bool isInitiator)
+        : m_socket(socket)
+        , m_localId(localId)
+        , m_remoteId(remoteId)
+        , m_isInitiator(isInitiator)
+        , m_startTime(std::chrono::steady_clock::now())
+        , m_state(EState_WaitingForHello)
+        , m_receiveSignal(-1)
+        , m_sendSignal(-1)
+    {
+    }
+
+    SharedMemoryHandshake::~SharedMemoryHandshake()
+    {
+        SharedMemoryUtilities::CloseFileDescriptor(m_socket);
+        SharedMemoryUtilities::CloseFileDescriptor(m_receiveSignal);
+        SharedMemoryUtilities::CloseFileDescriptor(m_sendSignal);
+    }
+
+    std::unique_ptr<SharedMemoryHandshake> SharedMemoryHandshake::Connect(const Guid& localId, const Guid& remoteId)
+    {
+        int channelSocket = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC | SOCK_NONBLOCK, 0);
+        if (channelSocket < 0)
+        {
+            return nullptr;
+        }
+
+        // completes or fails immediately for unix sockets, fails if remote participant is not on this host or does not use shared memory
+        sockaddr_un address;
+        const socklen_t addressLength = GetListenerAddress(remoteId, address);
+        if (connect(channelSocket, reinterpret_cast<const sockaddr*>(&address), addressLength) != 0)
+        {
+            SharedMemoryUtilities::CloseFileDescriptor(channelSocket);
+            return nullptr;
+        }
+
+        std::unique_ptr<SharedMemoryHandshake> handshake(new SharedMemoryHandshake(channelSocket, localId, remoteId, true));
+        if (!handshake->createReceiveRing() || !handshake->sendHello())
+        {
+            LOG_WARN(CONTEXT_COMMUNICATION, "SharedMemoryHandshake::Connect: handshake of " << localId << " with " << remoteId << " failed");
+            return nullptr;
+        }
+        return handshake;
+    }
+
+    std::unique_ptr<SharedMemoryHandshake> SharedMemoryHandshake::Accept(int listener, const Guid& localId)
+    {
+        int channelSocket = -1;
+        do
+        {
+            channelSocket = accept4(listener, nullptr, nullptr, SOCK_CLOEXEC | SOCK_NONBLOCK);
+        } while (channelSocket < 0 && errno == EINTR);
+
+        if (channelSocket < 0)
+        {
+            return nullptr;
+        }
+        return std::unique_ptr<SharedMemoryHandshake>(new SharedMemoryHandshake(channelSocket, localId, Guid(false), false));
+    }
+
+    ESharedMemoryHandshakeState SharedMemoryHandshake::continueHandshake()
+    {
+        switch (m_state)
+        {
+        case EState_WaitingForHello:
+            return receiveHello();
+        case EState_WaitingForAcknowledge:
+            return receiveAcknowledge();
+        case EState_Complete:
+            return ESharedMemoryHandshakeState_Complete;
+        case EState_Failed:
+            return ESharedMemoryHandshakeState_Failed;
+        }
+        return ESharedMemoryHandshakeState_Failed;
+    }
+
+    Bool SharedMemoryHandshake::isWaitingForAcknowledge() const
+    {
+        return m_state == EState_WaitingForAcknowledge;
+    }
+
+    Bool SharedMemoryHandshake::hasTimedOut(std::chrono::steady_clock::time_point now) const
+    {
+        return (m_state == EState_WaitingForHello || m_state == EState_WaitingForAcknowledge) &&
+            now - m_startTime > std::chrono::milliseconds(SharedMemoryChannel::HandshakeTimeoutMs);
+    }
+
+    std::unique_ptr<SharedMemoryChannel> SharedMemoryHandshake::takeChannel()
+    {
+        return std::move(m_channel);
+    }
+
+    int SharedMemoryHandshake::getSocket() const
+    {
+        return m_socket;
+    }
+
+    Bool SharedMemoryHandshake::isInitiator() const
+    {
+        return m_isInitiator;
+    }
+
+    const Guid& SharedMemoryHandshake::getRemoteId() const
+    {
+        return m_remoteId;
+    }
+
+    Bool SharedMemoryHandshake::createReceiveRing()
+    {
+        m_receiveRing = SharedMemoryRingBuffer::Create(SharedMemoryChannel::RingBufferCapacity);
+        m_receiveSignal = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        return m_receiveRing && m_receiveSignal >= 0;
+    }
+
+    Bool SharedMemoryHandshake::sendHello()
+    {
+        const HandshakeMessage localHello = { HandshakeMagic, m_localId.getGuidData() };
+        const int localFileDescriptors[2] = { m_receiveRing->getFileDescriptor(), m_receiveSignal };
+        return SharedMemoryUtilities::SendWithFileDescriptors(m_socket, &localHello, sizeof(localHello), localFileDescriptors, 2u) == static_cast<Int32>(sizeof(localHello));
+    }
+
+    ESharedMemoryHandshakeState SharedMemoryHandshake::receiveHello()
+    {
+        HandshakeMessage remoteHello;
+        int remoteFileDescriptors[2] = { -1, -1 };
+        UInt32 remoteFileDescriptorCount = 0u;
+        const Int32 receivedBytes = SharedMemoryUtilities::ReceiveWithFileDescriptors(m_socket, &remoteHello, sizeof(remoteHello), remoteFileDescriptors, 2u, remoteFileDescriptorCount);
+        if (receivedBytes < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            return ESharedMemoryHandshakeState_InProgress;
+        }
+
+        if (receivedBytes != static_cast<Int32>(sizeof(remoteHello)) || remoteFileDescriptorCount != 2u || remoteHello.magic != HandshakeMagic ||
+            (m_isInitiator && Guid(remoteHello.participantId) != m_remoteId))
+        {
+            for (UInt32 i = 0u; i < remoteFileDescriptorCount; ++i)
+            {
+                SharedMemoryUtilities::CloseFileDescriptor(remoteFileDescriptors[i]);
+            }
+            return fail();
+        }
+
+        m_remoteId = Guid(remoteHello.participantId);
+        m_sendSignal = remoteFileDescriptors[1];
+        // attach takes over the ring descriptor in any case
+        m_sendRing = SharedMemoryRingBuffer::Attach(remoteFileDescriptors[0]);
+        if (!m_sendRing)
+        {
+            return fail();
+        }
+
+        if (m_isInitiator)
+        {
+            // confirm the channel can be used, before that the acceptor must not send anything
+            const UInt32 acknowledge = HandshakeMagic;
+            if (::send(m_socket, &acknowledge, sizeof(acknowledge), MSG_NOSIGNAL) != static_cast<ssize_t>(sizeof(acknowledge)))
+            {
+                return fail();
+            }
+            return complete();
+        }
+
+        if (!createReceiveRing() || !sendHello())
+        {
+            return fail();
+        }
+        m_state = EState_WaitingForAcknowledge;
+        return ESharedMemoryHandshakeState_InProgress;
+    }
+
+    ESharedMemoryHandshakeState SharedMemoryHandshake::receiveAcknowledge()
+    {
+        UInt32 acknowledge = 0u;
+        ssize_t receivedBytes = -1;
+        do
+        {
+            receivedBytes = ::recv(m_socket, &acknowledge, sizeof(acknowledge), 0);
+        } while (receivedBytes < 0 && errno == EINTR);
+
+        if (receivedBytes < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            return ESharedMemoryHandshakeState_InProgress;
+        }
+        if (receivedBytes != static_cast<ssize_t>(sizeof(acknowledge)) || acknowledge != HandshakeMagic)
+        {
+            return fail();
+        }
+        return complete();
+    }
+
+    ESharedMemoryHandshakeState SharedMemoryHandshake::fail()
+    {
+        LOG_WARN(CONTEXT_COMMUNICATION, "SharedMemoryHandshake::fail: handshake of " << m_localId << " with " << m_remoteId << " failed, initiator " << m_isInitiator);
+        m_state = EState_Failed;
+        return ESharedMemoryHandshakeState_Failed;
+    }
+
+    ESharedMemoryHandshakeState SharedMemoryHandshake::complete()
+    {
+        m_channel.reset(new SharedMemoryChannel(m_socket, std::move(m_sendRing), m_sendSignal, std::move(m_receiveRing), m_receiveSignal));
+        m_socket = -1;
+        m_sendSignal = -1;
+        m_receiveSignal = -1;
+        m_state = EState_Complete;
+        return ESharedMemoryHandshakeState_Complete;
+    }
+}
@@ -0,0 +1,216 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "TransportSharedMemory/SharedMemoryRingBuffer.h"
+#include "TransportSharedMemory/SharedMemoryUtilities.h"
+#include "PlatformAbstraction/PlatformMemory.h"
+
+#include <sys/mman.h>
+#include <atomic>
+
+namespace ramses_internal
+{
+    static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "shared memory ring buffer needs lock free 64 bit atomics");
+
+    struct SharedMemoryRingBuffer::Header
+    {
+        // positions grow monotonically, kept on separate cache lines for writer and reader
+        std::atomic<UInt64> writePosition;
+        UInt8 writerPadding[56];
+        std::atomic<UInt64> readPosition;
+        UInt8 readerPadding[56];
+        UInt32 magic;
+        UInt32 capacity;
+        std::atomic<UInt32> spaceRequested;
+    };
+
+    static const UInt32 RingBufferMagic = 0x524D5342u;
+    static const UInt32 RingBufferDataOffset = 256u;
+    static_assert(sizeof(std::atomic<UInt64>) == sizeof(UInt64), "unexpected atomic layout");
+
+    static UInt32 RoundUpToPowerOfTwo(UInt32 value)
+    {
+        UInt32 result = 1u;
+        while (result < value)
+        {
+            result <<= 1u;
+        }
+        return result;
+    }
+
+    std::unique_ptr<SharedMemoryRingBuffer> SharedMemoryRingBuffer::Create(UInt32 capacity)
+    {
+        const UInt32 dataCapacity = RoundUpToPowerOfTwo(std::max(capacity, 64u));
+        const UInt32 mappingSize = RingBufferDataOffset + dataCapacity;
+
+        int fileDescriptor = SharedMemoryUtilities::CreateMemoryFile("ramses-ring", mappingSize);
+        if (fileDescriptor < 0)
+        {
+            return nullptr;
+        }
+
+        void* mapping = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+        if (mapping == MAP_FAILED)
+        {
+            SharedMemoryUtilities::CloseFileDescriptor(fileDescriptor);
+            return nullptr;
+        }
+
+        Header* header = new (mapping) Header;
+        header->writePosition.store(0u);
+        header->readPosition.store(0u);
+        header->spaceRequested.store(0u);
+        header->magic = RingBufferMagic;
+        header->capacity = dataCapacity;
+
+        return std::unique_ptr<SharedMemoryRingBuffer>(new SharedMemoryRingBuffer(fileDescriptor, mapping, mappingSize));
+    }
+
+    std::unique_ptr<SharedMemoryRingBuffer> SharedMemoryRingBuffer::Attach(int fileDescriptor)
+    {
+        const UInt32 mappingSize = SharedMemoryUtilities::GetMemoryFileSize(fileDescriptor);
+        if (mappingSize <= RingBufferDataOffset)
+        {
+            SharedMemoryUtilities::CloseFileDescriptor(fileDescriptor);
+            return nullptr;
+        }
+
+        void* mapping = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+        if (mapping == MAP_FAILED)
+        {
+            SharedMemoryUtilities::CloseFileDescriptor(fileDescriptor);
+            return nullptr;
+        }
+
+        // never trust the layout written by another process
+        const Header* header = static_cast<const Header*>(mapping);
+        const UInt32 capacity = header->capacity;
+        if (header->magic != RingBufferMagic || capacity == 0u || (capacity & (capacity - 1u)) != 0u || RingBufferDataOffset + capacity != mappingSize)
+        {
+            munmap(mapping, mappingSize);
+            SharedMemoryUtilities::CloseFileDescriptor(fileDescriptor);
+            return nullptr;
+        }
+
+        return std::unique_ptr<SharedMemoryRingBuffer>(new SharedMemoryRingBuffer(fileDescriptor, mapping, mappingSize));
+    }
+
+    SharedMemoryRingBuffer::SharedMemoryRingBuffer(int fileDescriptor, void* mapping, UInt32 mappingSize)
+        : m_fileDescriptor(fileDescriptor)
+        , m_mapping(mapping)
+        , m_mappingSize(mappingSize)
+        , m_header(*static_cast<Header*>(mapping))
+        , m_data(static_cast<Byte*>(mapping) + RingBufferDataOffset)
+        , m_capacity(mappingSize - RingBufferDataOffset)
+    {
+    }
+
+    SharedMemoryRingBuffer::~SharedMemoryRingBuffer()
+    {
+        munmap(m_mapping, m_mappingSize);
+        int fileDescriptor = m_fileDescriptor;
+        SharedMemoryUtilities::CloseFileDescriptor(fileDescriptor);
+    }
+
+    Bool SharedMemoryRingBuffer::write(const void* header, UInt32 headerSize, const void* data, UInt32 dataSize)
+    {
+        const UInt64 writePosition = m_header.writePosition.load(std::memory_order_relaxed);
+        const UInt64 readPosition = m_header.readPosition.load(std::memory_order_acquire);
+        const UInt64 usedSize = writePosition - readPosition;
+        if (usedSize > m_capacity || static_cast<UInt64>(headerSize) + dataSize > m_capacity - usedSize)
+        {
+            return false;
+        }
+
+        copyIn(writePosition, header, headerSize);
+        copyIn(writePosition + headerSize, data, dataSize);
+        m_header.writePosition.store(writePosition + headerSize + dataSize, std::memory_order_release);
+        return true;
+    }
+
+    Bool SharedMemoryRingBuffer::read(void* destination, UInt32 size)
+    {
+        const UInt64 readPosition = m_header.readPosition.load(std::memory_order_relaxed);
+        const UInt64 writePosition = m_header.writePosition.load(std::memory_order_acquire);
+        const UInt64 availableSize = writePosition - readPosition;
+        if (availableSize > m_capacity || size > availableSize)
+        {
+            return false;
+        }
+
+        copyOut(readPosition, destination, size);
+        m_header.readPosition.store(readPosition + size, std::memory_order_release);
+        return true;
+    }
+
+    Bool SharedMemoryRingBuffer::requestSpace(UInt32 size)
+    {
+        // pairs with fence in takeSpaceRequest: either the reader sees the request or the writer sees the new read position
+        m_header.spaceRequested.store(1u, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return getWritableSize() >= size;
+    }
+
+    Bool SharedMemoryRingBuffer::takeSpaceRequest()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_header.spaceRequested.load(std::memory_order_relaxed) == 0u)
+        {
+            return false;
+        }
+        return m_header.spaceRequested.exchange(0u, std::memory_order_relaxed) != 0u;
+    }
+
+    UInt32 SharedMemoryRingBuffer::getReadableSize() const
+    {
+        const UInt64 availableSize = m_header.writePosition.load(std::memory_order_acquire) - m_header.readPosition.load(std::memory_order_relaxed);
+        return availableSize > m_capacity ? 0u : static_cast<UInt32>(availableSize);
+    }
+
+    UInt32 SharedMemoryRingBuffer::getWritableSize() const
+    {
+        const UInt64 usedSize = m_header.writePosition.load(std::memory_order_relaxed) - m_header.readPosition.load(std::memory_order_acquire);
+        return usedSize > m_capacity ? 0u : static_cast<UInt32>(m_capacity - usedSize);
+    }
+
+    UInt32 SharedMemoryRingBuffer::getCapacity() const
+    {
+        return m_capacity;
+    }
+
+    int SharedMemoryRingBuffer::getFileDescriptor() const
+    {
+        return m_fileDescriptor;
+    }
+
+    void SharedMemoryRingBuffer::copyIn(UInt64 position, const void* data, UInt32 size)
+    {
+        if (size == 0u)
+        {
+            return;
+        }
+
+        const UInt32 offset = static_cast<UInt32>(position & (m_capacity - 1u));
+        const UInt32 firstPart = std::min(size, m_capacity - offset);
+        PlatformMemory::Copy(m_data + offset, data, firstPart);
+        PlatformMemory::Copy(m_data, static_cast<const Byte*>(data) + firstPart, size - firstPart);
+    }
+
+    void SharedMemoryRingBuffer::copyOut(UInt64 position, void* destination, UInt32 size) const
+    {
+        if (size == 0u)
+        {
+            return;
+        }
+
+        const UInt32 offset = static_cast<UInt32>(position & (m_capacity - 1u));
+        const UInt32 firstPart = std::min(size, m_capacity - offset);
+        PlatformMemory::Copy(destination, m_data + offset, firstPart);
+        PlatformMemory::Copy(static_cast<Byte*>(destination) + firstPart, m_data, size - firstPart);
+    }
+}
@@ -0,0 +1,194 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "TransportSharedMemory/SharedMemoryUtilities.h"
+#include "PlatformAbstraction/PlatformMemory.h"
+
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <assert.h>
+
+// not all supported toolchains provide memfd_create in their libc yet
+#ifndef MFD_CLOEXEC
+#define MFD_CLOEXEC 0x0001U
+#endif
+#ifndef MFD_ALLOW_SEALING
+#define MFD_ALLOW_SEALING 0x0002U
+#endif
+#ifndef F_ADD_SEALS
+#define F_ADD_SEALS 1033
+#define F_SEAL_SHRINK 0x0002
+#define F_SEAL_GROW 0x0004
+#define F_SEAL_WRITE 0x0008
+#define F_GET_SEALS 1034
+#endif
+
+namespace ramses_internal
+{
+    namespace SharedMemoryUtilities
+    {
+        static const UInt32 MaxFileDescriptorsPerMessage = 4u;
+
+        int CreateMemoryFile(const char* name, UInt32 size)
+        {
+            int fileDescriptor = static_cast<int>(syscall(SYS_memfd_create, name, MFD_CLOEXEC | MFD_ALLOW_SEALING));
+            if (fileDescriptor < 0)
+            {
+                return -1;
+            }
+            if (ftruncate(fileDescriptor, size) != 0)
+            {
+                CloseFileDescriptor(fileDescriptor);
+                return -1;
+            }
+            return fileDescriptor;
+        }
+
+        Bool SealMemoryFile(int fileDescriptor)
+        {
+            return fcntl(fileDescriptor, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE) == 0;
+        }
+
+        Bool IsMemoryFileSealed(int fileDescriptor)
+        {
+            const int requiredSeals = F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE;
+            const int seals = fcntl(fileDescriptor, F_GET_SEALS);
+            return seals >= 0 && (seals & requiredSeals) == requiredSeals;
+        }
+
+        UInt32 GetMemoryFileSize(int fileDescriptor)
+        {
+            struct stat fileStatus;
+            if (fstat(fileDescriptor, &fileStatus) != 0 || fileStatus.st_size < 0 || static_cast<UInt64>(fileStatus.st_size) > std::numeric_limits<UInt32>::max())
+            {
+                return 0u;
+            }
+            return static_cast<UInt32>(fileStatus.st_size);
+        }
+
+        Int32 SendWithFileDescriptors(int socket, const void* data, UInt32 size, const int* fileDescriptors, UInt32 fileDescriptorCount)
+        {
+            assert(fileDescriptorCount <= MaxFileDescriptorsPerMessage);
+
+            iovec io;
+            io.iov_base = const_cast<void*>(data);
+            io.iov_len = size;
+
+            union
+            {
+                char buffer[CMSG_SPACE(MaxFileDescriptorsPerMessage * sizeof(int))];
+                cmsghdr align;
+            } control;
+            PlatformMemory::Set(&control, 0, sizeof(control));
+
+            msghdr message;
+            PlatformMemory::Set(&message, 0, sizeof(message));
+            message.msg_iov = &io;
+            message.msg_iovlen = 1;
+
+            if (fileDescriptorCount > 0u)
+            {
+                message.msg_control = control.buffer;
+                message.msg_controllen = CMSG_SPACE(fileDescriptorCount * sizeof(int));
+                cmsghdr* controlHeader = CMSG_FIRSTHDR(&message);
+                controlHeader->cmsg_level = SOL_SOCKET;
+                controlHeader->cmsg_type = SCM_RIGHTS;
+                controlHeader->cmsg_len = CMSG_LEN(fileDescriptorCount * sizeof(int));
+                PlatformMemory::Copy(CMSG_DATA(controlHeader), fileDescriptors, fileDescriptorCount * sizeof(int));
+            }
+
+            ssize_t sentBytes = -1;
+            do
+            {
+                sentBytes = sendmsg(socket, &message, MSG_NOSIGNAL);
+            } while (sentBytes < 0 && errno == EINTR);
+
+            return static_cast<Int32>(sentBytes);
+        }
+
+        Int32 ReceiveWithFileDescriptors(int socket, void* data, UInt32 size, int* fileDescriptors, UInt32 maxFileDescriptorCount, UInt32& receivedFileDescriptorCount)
+        {
+            receivedFileDescriptorCount = 0u;
+
+            iovec io;
+            io.iov_base = data;
+            io.iov_len = size;
+
+            union
+            {
+                char buffer[CMSG_SPACE(MaxFileDescriptorsPerMessage * sizeof(int))];
+                cmsghdr align;
+            } control;
+
+            msghdr message;
+            PlatformMemory::Set(&message, 0, sizeof(message));
+            message.msg_iov = &io;
+            message.msg_iovlen = 1;
+            message.msg_control = control.buffer;
+            message.msg_controllen = sizeof(control.buffer);
+
+            ssize_t receivedBytes = -1;
+            do
+            {
+                receivedBytes = recvmsg(socket, &message, MSG_CMSG_CLOEXEC);
+            } while (receivedBytes < 0 && errno == EINTR);
+
+            if (receivedBytes < 0)
+            {
+                return -1;
+            }
+
+            for (cmsghdr* controlHeader = CMSG_FIRSTHDR(&message); controlHeader != nullptr; controlHeader = CMSG_NXTHDR(&message, controlHeader))
+            {
+                if (controlHeader->cmsg_level == SOL_SOCKET && controlHeader->cmsg_type == SCM_RIGHTS)
+                {
+                    const UInt32 count = static_cast<UInt32>((controlHeader->cmsg_len - CMSG_LEN(0)) / sizeof(int));
+                    const int* received = reinterpret_cast<const int*>(CMSG_DATA(controlHeader));
+                    for (UInt32 i = 0u; i < count; ++i)
+                    {
+                        // never leak descriptors the caller did not ask for
+                        if (receivedFileDescriptorCount < maxFileDescriptorCount)
+                        {
+                            fileDescriptors[receivedFileDescriptorCount++] = received[i];
+                        }
+                        else
+                        {
+                            close(received[i]);
+                        }
+                    }
+                }
+            }
+
+            if ((message.msg_flags & (MSG_TRUNC | MSG_CTRUNC)) != 0)
+            {
+                for (UInt32 i = 0u; i < receivedFileDescriptorCount; ++i)
+                {
+                    close(fileDescriptors[i]);
+                }
+                receivedFileDescriptorCount = 0u;
+                return -1;
+            }
+
+            return static_cast<Int32>(receivedBytes);
+        }
+
+        void CloseFileDescriptor(int& fileDescriptor)
+        {
+            if (fileDescriptor >= 0)
+            {
+                close(fileDescriptor);
+                fileDescriptor = -1;
+            }
+        }
+    }
+}
@@ -0,0 +1,201 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "TransportSharedMemory/SharedMemoryChannel.h"
+#include "TransportSharedMemory/SharedMemoryUtilities.h"
+#include <chrono>
+#include <poll.h>
+
+namespace ramses_internal
+{
+    class ASharedMemoryChannel : public ::testing::Test
+    {
+    public:
+        ASharedMemoryChannel()
+            : acceptorId(true)
+            , initiatorId(true)
+            , listener(SharedMemoryChannel::CreateListener(acceptorId))
+        {
+        }
+
+        ~ASharedMemoryChannel()
+        {
+            SharedMemoryUtilities::CloseFileDescriptor(listener);
+        }
+
+        void connect()
+        {
+            ASSERT_GE(listener, 0);
+            std::unique_ptr<SharedMemoryHandshake> initiatorHandshake = SharedMemoryHandshake::Connect(initiatorId, acceptorId);
+            ASSERT_TRUE(initiatorHandshake);
+            std::unique_ptr<SharedMemoryHandshake> acceptorHandshake = SharedMemoryHandshake::Accept(listener, acceptorId);
+            ASSERT_TRUE(acceptorHandshake);
+
+            EXPECT_EQ(ESharedMemoryHandshakeState_InProgress, acceptorHandshake->continueHandshake());
+            EXPECT_EQ(initiatorId, acceptorHandshake->getRemoteId());
+            EXPECT_TRUE(acceptorHandshake->isWaitingForAcknowledge());
+            EXPECT_EQ(ESharedMemoryHandshakeState_Complete, initiatorHandshake->continueHandshake());
+            EXPECT_EQ(ESharedMemoryHandshakeState_Complete, acceptorHandshake->continueHandshake());
+
+            initiator = initiatorHandshake->takeChannel();
+            acceptor = acceptorHandshake->takeChannel();
+            ASSERT_TRUE(initiator);
+            ASSERT_TRUE(acceptor);
+        }
+
+        static Bool HasSignal(const SharedMemoryChannel& channel)
+        {
+            pollfd pollInfo = { channel.getSignalFileDescriptor(), POLLIN, 0 };
+            return poll(&pollInfo, 1, 0) == 1;
+        }
+
+        ESharedMemoryReceiveResult receive(SharedMemoryChannel& channel)
+        {
+            return channel.receive([&](UInt32 tag, const Byte* data, UInt32 size) {
+                receivedTag = tag;
+                receivedData.assign(data, data + size);
+            });
+        }
+
+        const Guid acceptorId;
+        const Guid initiatorId;
+        int listener;
+        std::unique_ptr<SharedMemoryChannel> initiator;
+        std::unique_ptr<SharedMemoryChannel> acceptor;
+
+        UInt32 receivedTag = 0u;
+        std::vector<Byte> receivedData;
+    };
+
+    TEST_F(ASharedMemoryChannel, failsToConnectToParticipantWithoutListener)
+    {
+        EXPECT_FALSE(SharedMemoryHandshake::Connect(initiatorId, Guid(true)));
+    }
+
+    TEST_F(ASharedMemoryChannel, handshakeDoesNotBlockWhileWaitingForOtherSide)
+    {
+        std::unique_ptr<SharedMemoryHandshake> initiatorHandshake = SharedMemoryHandshake::Connect(initiatorId, acceptorId);
+        ASSERT_TRUE(initiatorHandshake);
+        EXPECT_EQ(acceptorId, initiatorHandshake->getRemoteId());
+        EXPECT_TRUE(initiatorHandshake->isInitiator());
+        EXPECT_EQ(ESharedMemoryHandshakeState_InProgress, initiatorHandshake->continueHandshake());
+        EXPECT_FALSE(initiatorHandshake->takeChannel());
+
+        const auto now = std::chrono::steady_clock::now();
+        EXPECT_FALSE(initiatorHandshake->hasTimedOut(now));
+        EXPECT_TRUE(initiatorHandshake->hasTimedOut(now + std::chrono::milliseconds(SharedMemoryChannel::HandshakeTimeoutMs + 1u)));
+    }
+
+    TEST_F(ASharedMemoryChannel, acceptorHandshakeFailsWhenInitiatorGoesAway)
+    {
+        std::unique_ptr<SharedMemoryHandshake> initiatorHandshake = SharedMemoryHandshake::Connect(initiatorId, acceptorId);
+        ASSERT_TRUE(initiatorHandshake);
+        std::unique_ptr<SharedMemoryHandshake> acceptorHandshake = SharedMemoryHandshake::Accept(listener, acceptorId);
+        ASSERT_TRUE(acceptorHandshake);
+        EXPECT_FALSE(acceptorHandshake->isInitiator());
+
+        EXPECT_EQ(ESharedMemoryHandshakeState_InProgress, acceptorHandshake->continueHandshake());
+        initiatorHandshake.reset();
+        EXPECT_EQ(ESharedMemoryHandshakeState_Failed, acceptorHandshake->continueHandshake());
+        EXPECT_FALSE(acceptorHandshake->takeChannel());
+    }
+
+    TEST_F(ASharedMemoryChannel, failsToListenTwiceForSameParticipant)
+    {
+        EXPECT_GE(listener, 0);
+        EXPECT_EQ(-1, SharedMemoryChannel::CreateListener(acceptorId));
+    }
+
+    TEST_F(ASharedMemoryChannel, sendsMessagesInBothDirections)
+    {
+        connect();
+        const std::vector<Byte> data = { 1u, 2u, 3u, 4u };
+
+        EXPECT_FALSE(HasSignal(*acceptor));
+        EXPECT_EQ(ESharedMemorySendResult_Sent, initiator->send(11u, data.data(), static_cast<UInt32>(data.size())));
+        EXPECT_TRUE(HasSignal(*acceptor));
+        acceptor->clearSignal();
+        EXPECT_FALSE(HasSignal(*acceptor));
+
+        EXPECT_EQ(ESharedMemoryReceiveResult_Message, receive(*acceptor));
+        EXPECT_EQ(11u, receivedTag);
+        EXPECT_EQ(data, receivedData);
+        EXPECT_EQ(ESharedMemoryReceiveResult_NoMessage, receive(*acceptor));
+
+        EXPECT_EQ(ESharedMemorySendResult_Sent, acceptor->send(12u, nullptr, 0u));
+        EXPECT_TRUE(HasSignal(*initiator));
+        EXPECT_EQ(ESharedMemoryReceiveResult_Message, receive(*initiator));
+        EXPECT_EQ(12u, receivedTag);
+        EXPECT_TRUE(receivedData.empty());
+    }
+
+    TEST_F(ASharedMemoryChannel, keepsOrderOfSmallAndLargeMessages)
+    {
+        connect();
+        const std::vector<Byte> small(100u, 1u);
+        std::vector<Byte> large(SharedMemoryChannel::MaximumInlineMessageSize + 1u);
+        for (size_t i = 0u; i < large.size(); ++i)
+        {
+            large[i] = static_cast<Byte>(i * 7u);
+        }
+
+        EXPECT_EQ(ESharedMemorySendResult_Sent, initiator->send(1u, small.data(), static_cast<UInt32>(small.size())));
+        EXPECT_EQ(ESharedMemorySendResult_Sent, initiator->send(2u, large.data(), static_cast<UInt32>(large.size())));
+        EXPECT_EQ(ESharedMemorySendResult_Sent, initiator->send(3u, small.data(), static_cast<UInt32>(small.size())));
+
+        EXPECT_EQ(ESharedMemoryReceiveResult_Message, receive(*acceptor));
+        EXPECT_EQ(1u, receivedTag);
+        EXPECT_EQ(small, receivedData);
+        EXPECT_EQ(ESharedMemoryReceiveResult_Message, receive(*acceptor));
+        EXPECT_EQ(2u, receivedTag);
+        EXPECT_EQ(large, receivedData);
+        EXPECT_EQ(ESharedMemoryReceiveResult_Message, receive(*acceptor));
+        EXPECT_EQ(3u, receivedTag);
+        EXPECT_EQ(ESharedMemoryReceiveResult_NoMessage, receive(*acceptor));
+    }
+
+    TEST_F(ASharedMemoryChannel, queuesMessagesWhenRingIsFullAndSendsThemWhenReceiverSignals)
+    {
+        connect();
+        const std::vector<Byte> data(SharedMemoryChannel::MaximumInlineMessageSize - 64u, 5u);
+        const std::vector<Byte> large(SharedMemoryChannel::MaximumInlineMessageSize + 1u, 6u);
+
+        EXPECT_EQ(ESharedMemorySendResult_Sent, initiator->send(1u, data.data(), static_cast<UInt32>(data.size())));
+        EXPECT_EQ(ESharedMemorySendResult_Sent, initiator->send(2u, data.data(), static_cast<UInt32>(data.size())));
+        EXPECT_EQ(ESharedMemorySendResult_Queued, initiator->send(3u, data.data(), static_cast<UInt32>(data.size())));
+        // keeps order behind queued message, also if it would fit
+        EXPECT_EQ(ESharedMemorySendResult_Queued, initiator->send(4u, large.data(), static_cast<UInt32>(large.size())));
+        EXPECT_TRUE(initiator->hasQueuedMessages());
+        EXPECT_FALSE(HasSignal(*initiator));
+
+        EXPECT_EQ(ESharedMemoryReceiveResult_Message, receive(*acceptor));
+        EXPECT_EQ(1u, receivedTag);
+        EXPECT_TRUE(HasSignal(*initiator));
+        initiator->clearSignal();
+        EXPECT_TRUE(initiator->sendQueuedMessages());
+        EXPECT_FALSE(initiator->hasQueuedMessages());
+
+        for (UInt32 tag = 2u; tag <= 4u; ++tag)
+        {
+            EXPECT_EQ(ESharedMemoryReceiveResult_Message, receive(*acceptor));
+            EXPECT_EQ(tag, receivedTag);
+        }
+        EXPECT_EQ(large, receivedData);
+        EXPECT_EQ(ESharedMemoryReceiveResult_NoMessage, receive(*acceptor));
+    }
+
+    TEST_F(ASharedMemoryChannel, doesNotSignalSenderWithoutQueuedMessages)
+    {
+        connect();
+        const std::vector<Byte> data(100u, 5u);
+        EXPECT_EQ(ESharedMemorySendResult_Sent, initiator->send(1u, data.data(), static_cast<UInt32>(data.size())));
+        EXPECT_EQ(ESharedMemoryReceiveResult_Message, receive(*acceptor));
+        EXPECT_FALSE(HasSignal(*initiator));
+    }
+}
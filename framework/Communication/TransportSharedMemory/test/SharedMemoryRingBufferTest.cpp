@@ -0,0 +1,117 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "TransportSharedMemory/SharedMemoryRingBuffer.h"
+#include <unistd.h>
+
+namespace ramses_internal
+{
+    class ASharedMemoryRingBuffer : public ::testing::Test
+    {
+    public:
+        ASharedMemoryRingBuffer()
+            : writer(SharedMemoryRingBuffer::Create(100u))
+            , reader(SharedMemoryRingBuffer::Attach(dup(writer->getFileDescriptor())))
+        {
+        }
+
+        std::unique_ptr<SharedMemoryRingBuffer> writer;
+        std::unique_ptr<SharedMemoryRingBuffer> reader;
+    };
+
+    TEST_F(ASharedMemoryRingBuffer, roundsCapacityUpToPowerOfTwo)
+    {
+        ASSERT_TRUE(reader);
+        EXPECT_EQ(128u, writer->getCapacity());
+        EXPECT_EQ(128u, reader->getCapacity());
+        EXPECT_EQ(128u, writer->getWritableSize());
+        EXPECT_EQ(0u, reader->getReadableSize());
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, transfersRecordBetweenMappings)
+    {
+        const UInt32 header = 42u;
+        const Byte data[] = { 1u, 2u, 3u };
+        EXPECT_TRUE(writer->write(&header, sizeof(header), data, sizeof(data)));
+        EXPECT_EQ(7u, reader->getReadableSize());
+
+        UInt32 readHeader = 0u;
+        Byte readData[3] = {};
+        EXPECT_TRUE(reader->read(&readHeader, sizeof(readHeader)));
+        EXPECT_TRUE(reader->read(readData, sizeof(readData)));
+        EXPECT_EQ(header, readHeader);
+        EXPECT_EQ(0, memcmp(data, readData, sizeof(data)));
+        EXPECT_EQ(0u, reader->getReadableSize());
+        EXPECT_EQ(128u, writer->getWritableSize());
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, rejectsRecordNotFittingIntoFreeSpace)
+    {
+        Byte data[100] = {};
+        const UInt32 header = 0u;
+        EXPECT_TRUE(writer->write(&header, sizeof(header), data, sizeof(data)));
+        EXPECT_FALSE(writer->write(&header, sizeof(header), data, 30u));
+        EXPECT_EQ(104u, reader->getReadableSize());
+
+        EXPECT_TRUE(reader->read(data, 50u));
+        EXPECT_TRUE(writer->write(&header, sizeof(header), data, 30u));
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, doesNotReadMoreThanAvailable)
+    {
+        const UInt32 header = 7u;
+        EXPECT_TRUE(writer->write(&header, sizeof(header), nullptr, 0u));
+
+        UInt64 tooLarge = 0u;
+        EXPECT_FALSE(reader->read(&tooLarge, sizeof(tooLarge)));
+        EXPECT_EQ(4u, reader->getReadableSize());
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, wrapsRecordsAroundEndOfBuffer)
+    {
+        Byte data[50];
+        for (UInt32 round = 0u; round < 20u; ++round)
+        {
+            for (UInt32 i = 0u; i < sizeof(data); ++i)
+            {
+                data[i] = static_cast<Byte>(round + i);
+            }
+            EXPECT_TRUE(writer->write(&round, sizeof(round), data, sizeof(data)));
+
+            UInt32 readRound = 0u;
+            Byte readData[50];
+            EXPECT_TRUE(reader->read(&readRound, sizeof(readRound)));
+            EXPECT_TRUE(reader->read(readData, sizeof(readData)));
+            EXPECT_EQ(round, readRound);
+            EXPECT_EQ(0, memcmp(data, readData, sizeof(data)));
+        }
+    }
+
+    TEST_F(ASharedMemoryRingBuffer, passesSpaceRequestOfWriterToReaderOnce)
+    {
+        EXPECT_FALSE(reader->takeSpaceRequest());
+
+        const UInt32 header = 7u;
+        EXPECT_TRUE(writer->write(&header, sizeof(header), nullptr, 0u));
+        EXPECT_FALSE(writer->requestSpace(writer->getCapacity()));
+        EXPECT_TRUE(writer->requestSpace(writer->getCapacity() - sizeof(header)));
+
+        EXPECT_TRUE(reader->takeSpaceRequest());
+        EXPECT_FALSE(reader->takeSpaceRequest());
+    }
+
+    TEST(ASharedMemoryRingBufferAttach, failsForMemoryWithoutRingLayout)
+    {
+        std::unique_ptr<SharedMemoryRingBuffer> ring = SharedMemoryRingBuffer::Create(64u);
+        ASSERT_TRUE(ring);
+        const int fileDescriptor = dup(ring->getFileDescriptor());
+        ASSERT_EQ(0, ftruncate(fileDescriptor, 1024));
+        EXPECT_FALSE(SharedMemoryRingBuffer::Attach(fileDescriptor));
+    }
+}
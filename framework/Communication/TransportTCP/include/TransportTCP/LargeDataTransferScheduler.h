@@ -0,0 +1,251 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_LARGEDATATRANSFERSCHEDULER_H
+#define RAMSES_LARGEDATATRANSFERSCHEDULER_H
+
+#include "Collections/Guid.h"
+#include <deque>
+#include <chrono>
+#include <algorithm>
+#include <cassert>
+
+namespace ramses_internal
+{
+    // Decides in which order the chunks of queued large data transfers are sent and how fast.
+    // A receiver deserializes one continuous stream per sender, therefore chunks of transfers to the same peer
+    // are never interleaved: the next transfer to a peer is started only after the previous one was fully sent,
+    // the pending transfer with most urgent priority first. Transfers to different peers are interleaved chunk by chunk,
+    // the peer with most urgent pending transfer first and peers with equally urgent transfers round robin.
+    // Lower priority value is more urgent.
+    // Optional bandwidth limit is applied over all peers as token bucket allowing bursts of 100ms worth of data.
+    template <typename ChunkType>
+    class LargeDataTransferScheduler
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        struct Chunk
+        {
+            ChunkType data;
+            UInt32 size;
+        };
+        using ChunkQueue = std::deque<Chunk>;
+
+        void setBandwidthLimit(UInt32 bytesPerSecond)
+        {
+            m_bandwidthLimit = bytesPerSecond;
+            m_budget = getBurstSize();
+            m_budgetInitialized = false;
+        }
+
+        UInt32 getBandwidthLimit() const
+        {
+            return m_bandwidthLimit;
+        }
+
+        void addTransfer(const Guid& peer, UInt32 priority, ChunkQueue&& chunks)
+        {
+            if (chunks.empty())
+            {
+                return;
+            }
+
+            for (const auto& chunk : chunks)
+            {
+                m_pendingBytes += chunk.size;
+            }
+
+            auto peerTransfers = findPeerTransfers(peer);
+            if (peerTransfers == m_peerTransfers.end())
+            {
+                m_peerTransfers.push_back(PeerTransfers{ peer, {}, 0u });
+                peerTransfers = m_peerTransfers.end() - 1;
+            }
+
+            // keep transfers ordered by priority, transfer which was already started stays in front
+            std::deque<Transfer>& transfers = peerTransfers->transfers;
+            auto insertPos = transfers.begin();
+            if (insertPos != transfers.end() && insertPos->started)
+            {
+                ++insertPos;
+            }
+            insertPos = std::find_if(insertPos, transfers.end(), [priority](const Transfer& transfer) { return transfer.priority > priority; });
+            transfers.insert(insertPos, Transfer{ priority, false, std::move(chunks) });
+        }
+
+        void removePeer(const Guid& peer)
+        {
+            const auto peerTransfers = findPeerTransfers(peer);
+            if (peerTransfers != m_peerTransfers.end())
+            {
+                for (const auto& transfer : peerTransfers->transfers)
+                {
+                    for (const auto& chunk : transfer.chunks)
+                    {
+                        m_pendingBytes -= chunk.size;
+                    }
+                }
+                m_peerTransfers.erase(peerTransfers);
+            }
+        }
+
+        void clear()
+        {
+            m_peerTransfers.clear();
+            m_pendingBytes = 0u;
+        }
+
+        Bool hasPendingChunks() const
+        {
+            return !m_peerTransfers.empty();
+        }
+
+        UInt64 getPendingBytes() const
+        {
+            return m_pendingBytes;
+        }
+
+        // Returns true if there is a pending chunk and bandwidth limit allows to send it at given time
+        Bool isNextChunkReady(Clock::time_point now)
+        {
+            if (!hasPendingChunks())
+            {
+                return false;
+            }
+            refillBudget(now);
+            return m_bandwidthLimit == 0u || m_budget >= 0;
+        }
+
+        // Time until the bandwidth limit allows to send next pending chunk, zero if it can be sent right away
+        std::chrono::milliseconds getTimeUntilNextChunk(Clock::time_point now) const
+        {
+            if (!hasPendingChunks() || m_bandwidthLimit == 0u || m_budget >= 0 || !m_budgetInitialized)
+            {
+                return std::chrono::milliseconds(0);
+            }
+
+            const Int64 missingBytes = -m_budget;
+            const auto refillTime = std::chrono::microseconds((missingBytes * 1000000 + m_bandwidthLimit - 1) / m_bandwidthLimit);
+            const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(now - m_lastRefill);
+            if (elapsed >= refillTime)
+            {
+                return std::chrono::milliseconds(0);
+            }
+            return std::chrono::duration_cast<std::chrono::milliseconds>(refillTime - elapsed + std::chrono::microseconds(999));
+        }
+
+        // Must only be called if isNextChunkReady returned true
+        ChunkType popNextChunk()
+        {
+            assert(hasPendingChunks());
+
+            auto nextPeer = m_peerTransfers.begin();
+            for (auto it = nextPeer + 1; it != m_peerTransfers.end(); ++it)
+            {
+                if (IsServedBefore(*it, *nextPeer))
+                {
+                    nextPeer = it;
+                }
+            }
+
+            nextPeer->lastServed = ++m_servedCounter;
+            Transfer& transfer = nextPeer->transfers.front();
+            transfer.started = true;
+
+            Chunk chunk = std::move(transfer.chunks.front());
+            transfer.chunks.pop_front();
+            m_pendingBytes -= chunk.size;
+            m_budget -= chunk.size;
+
+            if (transfer.chunks.empty())
+            {
+                nextPeer->transfers.erase(nextPeer->transfers.begin());
+                if (nextPeer->transfers.empty())
+                {
+                    m_peerTransfers.erase(nextPeer);
+                }
+            }
+
+            return std::move(chunk.data);
+        }
+
+    private:
+        struct Transfer
+        {
+            UInt32 priority;
+            Bool started;
+            ChunkQueue chunks;
+        };
+
+        struct PeerTransfers
+        {
+            Guid peer;
+            std::deque<Transfer> transfers;
+            UInt64 lastServed;
+        };
+
+        static Bool IsServedBefore(const PeerTransfers& peer, const PeerTransfers& otherPeer)
+        {
+            const UInt32 transferPriority = peer.transfers.front().priority;
+            const UInt32 otherTransferPriority = otherPeer.transfers.front().priority;
+            if (transferPriority != otherTransferPriority)
+            {
+                return transferPriority < otherTransferPriority;
+            }
+            return peer.lastServed < otherPeer.lastServed;
+        }
+
+        typename std::deque<PeerTransfers>::iterator findPeerTransfers(const Guid& peer)
+        {
+            return std::find_if(m_peerTransfers.begin(), m_peerTransfers.end(), [&peer](const PeerTransfers& peerTransfers) { return peerTransfers.peer == peer; });
+        }
+
+        Int64 getBurstSize() const
+        {
+            return std::max<Int64>(m_bandwidthLimit / 10, 1);
+        }
+
+        void refillBudget(Clock::time_point now)
+        {
+            if (m_bandwidthLimit == 0u)
+            {
+                return;
+            }
+            if (!m_budgetInitialized)
+            {
+                m_budgetInitialized = true;
+                m_lastRefill = now;
+                return;
+            }
+
+            // budget never exceeds burst size, limit elapsed time accordingly to not overflow after long idle times
+            const Int64 maxUsefulMicroseconds = (getBurstSize() - m_budget) * 1000000 / m_bandwidthLimit + 1;
+            const Int64 elapsedMicroseconds = std::min<Int64>(std::chrono::duration_cast<std::chrono::microseconds>(now - m_lastRefill).count(), maxUsefulMicroseconds);
+            const Int64 refill = elapsedMicroseconds * m_bandwidthLimit / 1000000;
+            // keep fractions of bytes for next refill when called very often
+            if (refill > 0)
+            {
+                m_budget = std::min(m_budget + refill, getBurstSize());
+                m_lastRefill = now;
+            }
+        }
+
+        // few peers only, therefore searched linearly
+        std::deque<PeerTransfers> m_peerTransfers;
+        UInt64 m_servedCounter = 0u;
+        UInt64 m_pendingBytes = 0u;
+
+        UInt32 m_bandwidthLimit = 0u;
+        Int64 m_budget = 0;
+        Bool m_budgetInitialized = false;
+        Clock::time_point m_lastRefill;
+    };
+}
+
+#endif
@@ -39,6 +39,10 @@ namespace ramses_internal
         void untrackSocket(PlatformSocket* socket);
         void untrackSocket(PlatformServerSocket* socket);
 
+        // other readable descriptors (e.g. eventfd), stay tracked until untracked explicitly
+        void trackFileDescriptor(const SocketDescription& fileDescriptor, const SocketDelegate& delegate);
+        void untrackFileDescriptor(const SocketDescription& fileDescriptor);
+
         void interruptWaitCall();
         void checkAllSockets(Bool blocking, UInt32 timeout = 0);
 
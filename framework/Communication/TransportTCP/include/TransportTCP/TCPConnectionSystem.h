@@ -19,18 +19,21 @@
 #include "TransportCommon/ICommunicationSystem.h"
 #include "TransportTCP/EConnectionType.h"
 #include "TransportTCP/EMessageId.h"
+#include "TransportTCP/LargeDataTransferScheduler.h"
 #include "Utils/BinaryOutputStream.h"
 #include "Utils/BinaryInputStream.h"
 
 namespace ramses_internal
 {
     class StatisticCollectionFramework;
+    class SharedMemoryChannel;
+    class SharedMemoryHandshake;
 
     class TCPConnectionSystem final : public Runnable, public ICommunicationSystem
     {
     public:
         TCPConnectionSystem(const NetworkParticipantAddress& participantAddress, UInt32 protocolVersion, Bool isDaemon, const NetworkParticipantAddress& daemonAddress,
-            PlatformLock& frameworkLock, StatisticCollectionFramework& statisticCollection);
+            PlatformLock& frameworkLock, StatisticCollectionFramework& statisticCollection, Bool useSharedMemory = false);
         ~TCPConnectionSystem() override;
 
         virtual bool connectServices() override;
@@ -70,6 +73,9 @@ namespace ramses_internal
         virtual void logConnectionInfo() override;
         virtual void triggerLogMessageForPeriodicLog() override;
 
+        // resource transfer shaping, bandwidth limit 0 means unlimited
+        void setResourceTransferBandwidthLimit(UInt32 bytesPerSecond);
+
     private:
         struct OutMessage
         {
@@ -94,12 +100,26 @@ namespace ramses_internal
                 : sender(false)
                 , type(type_)
                 , data(dataSize)
-                , stream(data.data())
+                , payload(data.data())
+                , payloadSize(dataSize)
+                , stream(payload)
+            {}
+
+            // refers to payload owned by the caller, e.g. mapped shared memory, without copying it
+            InMessage(EMessageId type_, const UInt8* payload_, UInt32 payloadSize_)
+                : sender(false)
+                , type(type_)
+                , data()
+                , payload(payload_)
+                , payloadSize(payloadSize_)
+                , stream(payload)
             {}
 
             Guid sender;
             EMessageId type;
             HeapArray<UInt8> data;
+            const UInt8* payload;
+            UInt32 payloadSize;
             BinaryInputStream stream;
         };
 
@@ -120,6 +140,7 @@ namespace ramses_internal
 
         static const constexpr UInt32 resourceDataSizeSimilarToOtherStacks = 1300000;
         static const constexpr int32_t socketConnectTimeoutMs = 1500;
+        static const constexpr UInt32 maxResourceChunksPerLoopIteration = 4;
 
         bool sendMessage(OutMessage&& message);
 
@@ -161,6 +182,8 @@ namespace ramses_internal
 
         void clearMessageQueue();
         void sendAllMessagesInQueue();
+        void sendScheduledResourceChunks();
+        UInt32 getSocketCheckTimeout();
 
         bool sendAliveMessages();
         bool checkConnectionsAlive();
@@ -168,6 +191,23 @@ namespace ramses_internal
 
         void setReadyToSendMessages(bool state);
 
+        // data path to participants on the same host, connection management stays on the sockets
+        void setupSharedMemoryListener();
+        void cleanupSharedMemoryListener();
+        void trackSharedMemoryListener();
+        void acceptSharedMemoryChannel(const SocketDescription& listener);
+        void continueSharedMemoryHandshake(const SocketDescription& socket);
+        void finishSharedMemoryHandshake(int socket);
+        void removeTimedOutSharedMemoryHandshakes();
+        Bool connectSharedMemoryChannel(const Guid& participant);
+        void activateSharedMemoryChannel(const Guid& participant);
+        void removeSharedMemoryChannel(const Guid& participant);
+        void removeAllSharedMemoryChannels();
+        SharedMemoryChannel* findSharedMemoryChannel(const Guid& participant) const;
+        Bool sendMessageToSharedMemoryChannel(SharedMemoryChannel& channel, const OutMessage& message) const;
+        Bool hasSharedMemoryChannelWithQueuedMessages() const;
+        void sharedMemoryChannelHasData(const SocketDescription& signal);
+
         // receive methods
         void handleSceneSubscription(InMessage& message);
         void handleSceneUnsubscription(InMessage& message);
@@ -203,6 +243,8 @@ namespace ramses_internal
         ScopedPointer<PlatformServerSocket> m_serverSocket;
         SocketInfo m_daemonSocket;
         Vector<OutMessage> m_outMessagesToSend;
+        // resource chunks on large data connections, sent when no other messages are queued
+        LargeDataTransferScheduler<OutMessage> m_resourceTransferScheduler;
         Vector<PlatformSocket*> m_newlyAcceptedSockets;
 
         HashSet<Guid> m_unfinishedConnections;
@@ -212,6 +254,15 @@ namespace ramses_internal
         HashMap<PlatformSocket*, SocketInfo> m_platformSocketMap;
         bool m_readyToSend;
 
+        const Bool m_useSharedMemory;
+        int m_sharedMemoryListener;
+        HashMap<Guid, SharedMemoryChannel*> m_sharedMemoryChannels;
+        // accepted channels wait for the participant's connection description before used
+        HashMap<Guid, SharedMemoryChannel*> m_pendingSharedMemoryChannels;
+        // handshakes in progress by their socket, sockets connect only after the handshake ended
+        HashMap<int, SharedMemoryHandshake*> m_sharedMemoryHandshakes;
+        HashSet<Guid> m_participantsWithoutSharedMemory;
+
         StatisticCollectionFramework& m_statisticCollection;
         std::atomic<bool> m_requestLogConnectionInfo{false};
         std::atomic<bool> m_requestLogMessageForPeriodicLog{false};
@@ -109,6 +109,16 @@ namespace ramses_internal
         untrackSocketInternal(m_serverSocketMap, socket);
     }
 
+    void SocketManager::trackFileDescriptor(const SocketDescription& fileDescriptor, const SocketDelegate& delegate)
+    {
+        m_socketinfos.push_back(SocketInfoPair(fileDescriptor, delegate));
+    }
+
+    void SocketManager::untrackFileDescriptor(const SocketDescription& fileDescriptor)
+    {
+        removeSocketInfoPair(fileDescriptor);
+    }
+
     void SocketManager::serverSocketCallback(const SocketDescription& socketDescription)
     {
         socketCallBackInternal<ServerSocketDelegatePair>(m_serverSocketMap, socketDescription);
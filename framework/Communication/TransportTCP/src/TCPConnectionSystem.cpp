@@ -24,13 +24,42 @@
 #include "Utils/StatisticCollection.h"
 #include "Utils/RawBinaryOutputStream.h"
 
+#if defined(HAS_SHARED_MEMORY_COMM)
+#include "TransportSharedMemory/SharedMemoryChannel.h"
+#include "TransportSharedMemory/SharedMemoryUtilities.h"
+#endif
+
 namespace ramses_internal
 {
     static const constexpr std::chrono::milliseconds AliveInterval{100};
     static const constexpr std::chrono::milliseconds AliveIntervalTimeout{6 * AliveInterval};
 
+    // transfer priority of resource, lower value is more urgent. Nothing of a renderable can be drawn without its effect and
+    // geometry, which are mostly small, therefore they are not held back by large textures requested at the same time.
+    enum EResourceTransferPriority
+    {
+        EResourceTransferPriority_Effect = 0,
+        EResourceTransferPriority_Geometry,
+        EResourceTransferPriority_Texture
+    };
+
+    static UInt32 GetResourceTransferPriority(const IResource& resource)
+    {
+        switch (resource.getTypeID())
+        {
+        case EResourceType_Effect:
+            return EResourceTransferPriority_Effect;
+        case EResourceType_Texture2D:
+        case EResourceType_Texture3D:
+        case EResourceType_TextureCube:
+            return EResourceTransferPriority_Texture;
+        default:
+            return EResourceTransferPriority_Geometry;
+        }
+    }
+
     TCPConnectionSystem::TCPConnectionSystem(const NetworkParticipantAddress& participantAddress, UInt32 protocolVersion, Bool isDaemon,
-        const NetworkParticipantAddress& daemonAddress, PlatformLock& frameworkLock, StatisticCollectionFramework& statisticCollection)
+        const NetworkParticipantAddress& daemonAddress, PlatformLock& frameworkLock, StatisticCollectionFramework& statisticCollection, Bool useSharedMemory)
         : m_socketManager()
         , m_participantAddress(participantAddress)
         , m_protocolVersion(protocolVersion)
@@ -49,6 +78,8 @@ namespace ramses_internal
         , m_mainLoop("R_TCP_ConnSys")
         , m_connectionStatusUpdateNotifier(frameworkLock)
         , m_readyToSend(false)
+        , m_useSharedMemory(useSharedMemory && !isDaemon)
+        , m_sharedMemoryListener(-1)
         , m_statisticCollection(statisticCollection)
     {
         // Must disable SIGPIPE when exists
@@ -368,7 +399,7 @@ namespace ramses_internal
 
             PlatformGuard guard(m_frameworkLock);
 
-            ByteArrayView resourceData(message.data.data() + bytesRead, static_cast<UInt32>(message.data.size() - bytesRead));
+            ByteArrayView resourceData(message.payload + bytesRead, message.payloadSize - bytesRead);
             m_resourceConsumerHandler->handleSendResource(resourceData, providerID);
         }
     }
@@ -416,7 +447,14 @@ namespace ramses_internal
                 ", resourceHash " << resource->getHash() << ", name " << resource->getName());
         }
 
+        // resources are transferred in one stream per transfer priority, the scheduler starts more urgent streams first
+        ManagedResourceVector sortedResources = managedResources;
+        std::stable_sort(sortedResources.begin(), sortedResources.end(), [](const ManagedResource& a, const ManagedResource& b) {
+            return GetResourceTransferPriority(*a.getResourceObject()) < GetResourceTransferPriority(*b.getResourceObject());
+        });
+
         Vector<Byte> buffer;
+        LargeDataTransferScheduler<OutMessage>::ChunkQueue chunks;
 
         auto preparePacketFun = [&](UInt32 neededSize) -> Pair<Byte*, UInt32> {
             buffer.resize(std::min(m_sendDataSizes.resourceDataArray, neededSize));
@@ -433,13 +471,38 @@ namespace ramses_internal
             stream << usedSize;
             stream.write(buffer.data(), usedSize);
 
-            sendMessage(std::move(msg));
+            chunks.push_back({ std::move(msg), usedSize });
 
             m_statisticCollection.statResourcesSentSize.incCounter(usedSize);
         };
 
-        ResourceStreamSerializer serializer;
-        serializer.serialize(preparePacketFun, finishedPacketFun, managedResources);
+        auto transferBegin = sortedResources.begin();
+        while (transferBegin != sortedResources.end())
+        {
+            const UInt32 priority = GetResourceTransferPriority(*transferBegin->getResourceObject());
+            const auto transferEnd = std::find_if(transferBegin, sortedResources.end(), [priority](const ManagedResource& resource) {
+                return GetResourceTransferPriority(*resource.getResourceObject()) != priority;
+            });
+
+            ManagedResourceVector transferResources;
+            transferResources.insert(transferResources.end(), transferBegin, transferEnd);
+            ResourceStreamSerializer serializer;
+            serializer.serialize(preparePacketFun, finishedPacketFun, transferResources);
+
+            const UInt32 numChunks = static_cast<UInt32>(chunks.size());
+            {
+                PlatformGuard g(m_mainLock);
+                if (m_readyToSend)
+                {
+                    m_resourceTransferScheduler.addTransfer(to, priority, std::move(chunks));
+                    m_socketManager.interruptWaitCall();
+                }
+            }
+            chunks.clear();
+            m_statisticCollection.statMessagesSent.incCounter(numChunks);
+
+            transferBegin = transferEnd;
+        }
         return true;
     }
 
@@ -626,6 +689,7 @@ namespace ramses_internal
             return false;
         }
         m_serverSocket.reset(tmpServerSocket.release());
+        setupSharedMemoryListener();
 
         LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::setupListener: accepting incoming connections on port " << m_serverSocket->getPort());
         return true;
@@ -635,6 +699,7 @@ namespace ramses_internal
     {
         m_serverSocket->close();
         m_serverSocket.reset();
+        cleanupSharedMemoryListener();
     }
 
     void TCPConnectionSystem::run()
@@ -651,6 +716,7 @@ namespace ramses_internal
             }
 
             trackServerSocket();
+            trackSharedMemoryListener();
 
             setReadyToSendMessages(true);
             clearMessageQueue();
@@ -662,15 +728,15 @@ namespace ramses_internal
                 tryConnectToOthers();
 
                 sendAllMessagesInQueue();
+                sendScheduledResourceChunks();
                 if (!sendAliveMessages())
                     break;
 
                 handleLogRequests();
 
                 // read from socket
-                const uint32_t socketCheckTimeout_ms = std::chrono::duration_cast<std::chrono::duration<uint32_t, std::milli>>(AliveInterval).count();
                 const bool canBlock = false;
-                m_socketManager.checkAllSockets(canBlock, socketCheckTimeout_ms);
+                m_socketManager.checkAllSockets(canBlock, getSocketCheckTimeout());
 
                 if (!checkConnectionsAlive())
                     break;
@@ -729,6 +795,8 @@ namespace ramses_internal
             return;
         }
 
+        removeTimedOutSharedMemoryHandshakes();
+
         Vector<Guid> nowFinishedConnections;
         for(const auto& connecton : m_unfinishedConnections)
         {
@@ -739,7 +807,10 @@ namespace ramses_internal
                 assert(m_knownParticipantAddresses.contains(connecton));
                 const NetworkParticipantAddress& address = *m_knownParticipantAddresses.get(connecton);
 
-                if (connectWithType(address, EConnectionType_OrderedControlMessages, m_controlSockets) &&
+                // shared memory channel must exist on both sides before the other side considers us connected,
+                // so sockets connect only after the handshake ended either way
+                if (connectSharedMemoryChannel(connecton) &&
+                    connectWithType(address, EConnectionType_OrderedControlMessages, m_controlSockets) &&
                     connectWithType(address, EConnectionType_LargeDataTransfer, m_dataSockets))
                 {
                     nowFinishedConnections.push_back(connecton);
@@ -835,7 +906,12 @@ namespace ramses_internal
             m_dataSockets.get(message.to, dataSocket) == EStatus_RAMSES_OK)
         {
             Bool writeSuccessful = true;
-            if (message.connectionType == EConnectionType_OrderedControlMessages)
+            SharedMemoryChannel* channel = findSharedMemoryChannel(message.to);
+            if (channel)
+            {
+                writeSuccessful = sendMessageToSharedMemoryChannel(*channel, message);
+            }
+            else if (message.connectionType == EConnectionType_OrderedControlMessages)
             {
                 assert(m_platformSocketMap.contains(controlSocket));
                 writeSuccessful = sendMessageToSocket(*m_platformSocketMap.get(controlSocket), message);
@@ -866,7 +942,11 @@ namespace ramses_internal
             if (m_dataSockets.contains(controlSocket.key))
             {
                 assert(m_platformSocketMap.contains(controlSocket.value));
-                if (!sendMessageToSocket(*m_platformSocketMap.get(controlSocket.value), message))
+                SharedMemoryChannel* channel = findSharedMemoryChannel(controlSocket.key);
+                const Bool writeSuccessful = channel ?
+                    sendMessageToSharedMemoryChannel(*channel, message) :
+                    sendMessageToSocket(*m_platformSocketMap.get(controlSocket.value), message);
+                if (!writeSuccessful)
                 {
                     LOG_WARN(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::sendBroadcastMessageToSockets: write to " << controlSocket.key << " failed");
                     brokenConnections.push_back(controlSocket.key);
@@ -1249,6 +1329,7 @@ namespace ramses_internal
         // check if now fully connected to this participant
         if (m_controlSockets.contains(id) && m_dataSockets.contains(id))
         {
+            activateSharedMemoryChannel(id);
             m_unfinishedConnections.remove(id);
             m_connectionStatusUpdateNotifier.triggerNotification(id, EConnectionStatus_Connected);
         }
@@ -1335,6 +1416,12 @@ namespace ramses_internal
         m_unfinishedConnections.remove(id);
         m_knownParticipantAddresses.remove(id);
 
+        {
+            PlatformGuard g(m_mainLock);
+            m_resourceTransferScheduler.removePeer(id);
+        }
+        removeSharedMemoryChannel(id);
+
         // remove streamsockets
         PlatformSocket* controlSocket = nullptr;
         bool hadControlSocket = false;
@@ -1386,6 +1473,10 @@ namespace ramses_internal
     {
         // closed and deleted outside thread because also created there
         m_socketManager.untrackSocket(m_serverSocket.get());
+        if (m_sharedMemoryListener >= 0)
+        {
+            m_socketManager.untrackFileDescriptor(m_sharedMemoryListener);
+        }
 
         if (m_daemonSocket.socket)
         {
@@ -1406,6 +1497,7 @@ namespace ramses_internal
             removeKnownParticipant(it->key, false);
         }
         assert(m_controlSockets.count() == 0 && m_dataSockets.count() == 0);
+        removeAllSharedMemoryChannels();
 
         m_unfinishedConnections.clear();
         m_platformSocketMap.clear();
@@ -1415,6 +1507,7 @@ namespace ramses_internal
     {
         PlatformGuard g(m_mainLock);
         m_outMessagesToSend.clear();
+        m_resourceTransferScheduler.clear();
     }
 
     void TCPConnectionSystem::sendAllMessagesInQueue()
@@ -1432,6 +1525,43 @@ namespace ramses_internal
         localOutMessagesToSend.clear();
     }
 
+    void TCPConnectionSystem::sendScheduledResourceChunks()
+    {
+        // send limited number of chunks per loop iteration to keep receiving and alive messages going,
+        // other queued messages are sent before every chunk so they never wait for a resource transfer to finish
+        for (UInt32 i = 0; i < maxResourceChunksPerLoopIteration; ++i)
+        {
+            sendAllMessagesInQueue();
+
+            // receiver on shared memory is behind, continue when it signals free space instead of queueing more
+            if (hasSharedMemoryChannelWithQueuedMessages())
+                return;
+
+            Vector<OutMessage> chunkToSend;
+            {
+                PlatformGuard g(m_mainLock);
+                if (!m_resourceTransferScheduler.isNextChunkReady(std::chrono::steady_clock::now()))
+                    return;
+                chunkToSend.push_back(m_resourceTransferScheduler.popNextChunk());
+            }
+            sendAllOutMessages(chunkToSend);
+        }
+    }
+
+    UInt32 TCPConnectionSystem::getSocketCheckTimeout()
+    {
+        std::chrono::milliseconds timeout = AliveInterval;
+        {
+            PlatformGuard g(m_mainLock);
+            if (m_resourceTransferScheduler.hasPendingChunks() && !hasSharedMemoryChannelWithQueuedMessages())
+            {
+                // wake up in time for next chunk allowed by bandwidth limit
+                timeout = std::min(timeout, m_resourceTransferScheduler.getTimeUntilNextChunk(std::chrono::steady_clock::now()));
+            }
+        }
+        return static_cast<UInt32>(timeout.count());
+    }
+
     bool TCPConnectionSystem::sendAliveMessages()
     {
         const auto now = std::chrono::steady_clock::now();
@@ -1520,11 +1650,19 @@ namespace ramses_internal
         if (m_requestLogConnectionInfo)
         {
             m_requestLogConnectionInfo = false;
+            UInt64 pendingResourceTransferBytes = 0u;
+            UInt32 resourceTransferBandwidthLimit = 0u;
+            {
+                PlatformGuard g(m_mainLock);
+                pendingResourceTransferBytes = m_resourceTransferScheduler.getPendingBytes();
+                resourceTransferBandwidthLimit = m_resourceTransferScheduler.getBandwidthLimit();
+            }
             LOG_INFO_F(CONTEXT_COMMUNICATION,
                        ([&](StringOutputStream& sos) {
                             sos << "TCPConnectionSystem:\n";
                             sos << "  Self: " << m_participantAddress.getParticipantName() << " / " << m_participantAddress.getParticipantId() << "\n";
                             sos << "  Protocol version: " << m_protocolVersion << "\n";
+                            sos << "  Resource transfer: " << pendingResourceTransferBytes << " bytes pending, bandwidth limit " << resourceTransferBandwidthLimit << " bytes/s (0 = unlimited)\n";
                             if (m_isDaemon)
                             {
                                 sos << "Participants known to daemon:\n";
@@ -1548,7 +1686,7 @@ namespace ramses_internal
                                     {
                                         sos << "  " << p.key << " / " << p.value.getParticipantName() << " at " << p.value.getIp() << ":" << p.value.getPort() << " : ";
                                         if (m_controlSockets.contains(p.key) && m_dataSockets.contains(p.key))
-                                            sos << "connected";
+                                            sos << (findSharedMemoryChannel(p.key) ? "connected (shared memory)" : "connected");
                                         else
                                             sos << "not connected";
                                         sos << "\n";
@@ -1585,6 +1723,13 @@ namespace ramses_internal
         }
     }
 
+    void TCPConnectionSystem::setResourceTransferBandwidthLimit(UInt32 bytesPerSecond)
+    {
+        LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::setResourceTransferBandwidthLimit: " << bytesPerSecond << " bytes/s");
+        PlatformGuard g(m_mainLock);
+        m_resourceTransferScheduler.setBandwidthLimit(bytesPerSecond);
+    }
+
     void TCPConnectionSystem::logConnectionInfo()
     {
         m_requestLogConnectionInfo = true;
@@ -1596,4 +1741,364 @@ namespace ramses_internal
         m_requestLogMessageForPeriodicLog = true;
         m_socketManager.interruptWaitCall();
     }
+
+#if defined(HAS_SHARED_MEMORY_COMM)
+    void TCPConnectionSystem::setupSharedMemoryListener()
+    {
+        if (m_useSharedMemory)
+        {
+            assert(m_sharedMemoryListener < 0);
+            m_sharedMemoryListener = SharedMemoryChannel::CreateListener(m_participantAddress.getParticipantId());
+            if (m_sharedMemoryListener < 0)
+            {
+                LOG_WARN(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::setupSharedMemoryListener: no shared memory listener, use sockets only");
+            }
+        }
+    }
+
+    void TCPConnectionSystem::cleanupSharedMemoryListener()
+    {
+        SharedMemoryUtilities::CloseFileDescriptor(m_sharedMemoryListener);
+    }
+
+    void TCPConnectionSystem::trackSharedMemoryListener()
+    {
+        if (m_sharedMemoryListener >= 0)
+        {
+            m_socketManager.trackFileDescriptor(m_sharedMemoryListener, SocketDelegate::Create<TCPConnectionSystem, &TCPConnectionSystem::acceptSharedMemoryChannel>(*this));
+        }
+    }
+
+    void TCPConnectionSystem::acceptSharedMemoryChannel(const SocketDescription& listener)
+    {
+        std::unique_ptr<SharedMemoryHandshake> handshake = SharedMemoryHandshake::Accept(listener, m_participantAddress.getParticipantId());
+        if (!handshake)
+        {
+            LOG_WARN(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::acceptSharedMemoryChannel: accept failed");
+            return;
+        }
+
+        // initiator sent its hello right after connecting, it is handled once the socket is checked
+        const int socket = handshake->getSocket();
+        m_socketManager.trackFileDescriptor(socket, SocketDelegate::Create<TCPConnectionSystem, &TCPConnectionSystem::continueSharedMemoryHandshake>(*this));
+        m_sharedMemoryHandshakes.put(socket, handshake.release());
+    }
+
+    void TCPConnectionSystem::continueSharedMemoryHandshake(const SocketDescription& socket)
+    {
+        SharedMemoryHandshake* handshake = nullptr;
+        if (EStatus_RAMSES_OK != m_sharedMemoryHandshakes.get(socket, handshake))
+        {
+            // handshake was removed while handling other sockets in same check
+            return;
+        }
+
+        if (handshake->continueHandshake() != ESharedMemoryHandshakeState_InProgress)
+        {
+            finishSharedMemoryHandshake(socket);
+        }
+    }
+
+    void TCPConnectionSystem::finishSharedMemoryHandshake(int socket)
+    {
+        SharedMemoryHandshake* handshake = nullptr;
+        if (EStatus_RAMSES_OK != m_sharedMemoryHandshakes.remove(socket, &handshake))
+        {
+            return;
+        }
+        m_socketManager.untrackFileDescriptor(socket);
+
+        const Guid participant = handshake->getRemoteId();
+        const Bool isInitiator = handshake->isInitiator();
+        std::unique_ptr<SharedMemoryChannel> channel = handshake->takeChannel();
+        delete handshake;
+
+        if (!channel)
+        {
+            if (isInitiator)
+            {
+                LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::finishSharedMemoryHandshake: use sockets only for " << participant);
+                m_participantsWithoutSharedMemory.put(participant);
+            }
+            return;
+        }
+
+        if (isInitiator)
+        {
+            LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::finishSharedMemoryHandshake: use shared memory for " << participant);
+            m_socketManager.trackFileDescriptor(channel->getSignalFileDescriptor(), SocketDelegate::Create<TCPConnectionSystem, &TCPConnectionSystem::sharedMemoryChannelHasData>(*this));
+            m_sharedMemoryChannels.put(participant, channel.release());
+        }
+        else
+        {
+            LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::finishSharedMemoryHandshake: accepted from " << participant);
+
+            // participant reconnected before completing the previous connection
+            SharedMemoryChannel* oldChannel = nullptr;
+            if (EStatus_RAMSES_OK == m_pendingSharedMemoryChannels.remove(participant, &oldChannel))
+            {
+                delete oldChannel;
+            }
+            m_pendingSharedMemoryChannels.put(participant, channel.release());
+        }
+    }
+
+    void TCPConnectionSystem::removeTimedOutSharedMemoryHandshakes()
+    {
+        const auto now = std::chrono::steady_clock::now();
+        Vector<int> timedOutSockets;
+        for (const auto& p : m_sharedMemoryHandshakes)
+        {
+            if (p.value->hasTimedOut(now))
+            {
+                timedOutSockets.push_back(p.key);
+            }
+        }
+
+        for (const auto socket : timedOutSockets)
+        {
+            LOG_WARN(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::removeTimedOutSharedMemoryHandshakes: handshake timed out");
+            finishSharedMemoryHandshake(socket);
+        }
+    }
+
+    Bool TCPConnectionSystem::connectSharedMemoryChannel(const Guid& participant)
+    {
+        if (m_sharedMemoryListener < 0 || m_sharedMemoryChannels.contains(participant) || m_participantsWithoutSharedMemory.hasElement(participant))
+        {
+            return true;
+        }
+
+        for (const auto& p : m_sharedMemoryHandshakes)
+        {
+            if (p.value->isInitiator() && p.value->getRemoteId() == participant)
+            {
+                return false;
+            }
+        }
+
+        std::unique_ptr<SharedMemoryHandshake> handshake = SharedMemoryHandshake::Connect(m_participantAddress.getParticipantId(), participant);
+        if (!handshake)
+        {
+            m_participantsWithoutSharedMemory.put(participant);
+            return true;
+        }
+
+        const int socket = handshake->getSocket();
+        m_socketManager.trackFileDescriptor(socket, SocketDelegate::Create<TCPConnectionSystem, &TCPConnectionSystem::continueSharedMemoryHandshake>(*this));
+        m_sharedMemoryHandshakes.put(socket, handshake.release());
+        return false;
+    }
+
+    void TCPConnectionSystem::activateSharedMemoryChannel(const Guid& participant)
+    {
+        // initiator acknowledged before connecting its sockets, so the acknowledge can be taken right away
+        int waitingSocket = -1;
+        for (const auto& p : m_sharedMemoryHandshakes)
+        {
+            if (!p.value->isInitiator() && p.value->getRemoteId() == participant && p.value->isWaitingForAcknowledge())
+            {
+                waitingSocket = p.key;
+                break;
+            }
+        }
+        if (waitingSocket >= 0)
+        {
+            continueSharedMemoryHandshake(waitingSocket);
+        }
+
+        SharedMemoryChannel* channel = nullptr;
+        if (EStatus_RAMSES_OK == m_pendingSharedMemoryChannels.remove(participant, &channel))
+        {
+            LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::activateSharedMemoryChannel: use shared memory for " << participant);
+            removeSharedMemoryChannel(participant);
+
+            // messages sent since the handshake are still pending in the signal, so they get read now
+            m_socketManager.trackFileDescriptor(channel->getSignalFileDescriptor(), SocketDelegate::Create<TCPConnectionSystem, &TCPConnectionSystem::sharedMemoryChannelHasData>(*this));
+            m_sharedMemoryChannels.put(participant, channel);
+        }
+    }
+
+    void TCPConnectionSystem::removeSharedMemoryChannel(const Guid& participant)
+    {
+        SharedMemoryChannel* channel = nullptr;
+        if (EStatus_RAMSES_OK == m_sharedMemoryChannels.remove(participant, &channel))
+        {
+            m_socketManager.untrackFileDescriptor(channel->getSignalFileDescriptor());
+            delete channel;
+        }
+
+        if (EStatus_RAMSES_OK == m_pendingSharedMemoryChannels.remove(participant, &channel))
+        {
+            delete channel;
+        }
+
+        Vector<int> handshakeSockets;
+        for (const auto& p : m_sharedMemoryHandshakes)
+        {
+            if (p.value->getRemoteId() == participant)
+            {
+                handshakeSockets.push_back(p.key);
+            }
+        }
+        for (const auto socket : handshakeSockets)
+        {
+            SharedMemoryHandshake* handshake = nullptr;
+            m_sharedMemoryHandshakes.remove(socket, &handshake);
+            m_socketManager.untrackFileDescriptor(socket);
+            delete handshake;
+        }
+
+        m_participantsWithoutSharedMemory.remove(participant);
+    }
+
+    void TCPConnectionSystem::removeAllSharedMemoryChannels()
+    {
+        for (auto& p : m_sharedMemoryChannels)
+        {
+            m_socketManager.untrackFileDescriptor(p.value->getSignalFileDescriptor());
+            delete p.value;
+        }
+        m_sharedMemoryChannels.clear();
+
+        for (auto& p : m_pendingSharedMemoryChannels)
+        {
+            delete p.value;
+        }
+        m_pendingSharedMemoryChannels.clear();
+
+        for (auto& p : m_sharedMemoryHandshakes)
+        {
+            m_socketManager.untrackFileDescriptor(p.key);
+            delete p.value;
+        }
+        m_sharedMemoryHandshakes.clear();
+        m_participantsWithoutSharedMemory.clear();
+    }
+
+    SharedMemoryChannel* TCPConnectionSystem::findSharedMemoryChannel(const Guid& participant) const
+    {
+        SharedMemoryChannel* channel = nullptr;
+        m_sharedMemoryChannels.get(participant, channel);
+        return channel;
+    }
+
+    Bool TCPConnectionSystem::sendMessageToSharedMemoryChannel(SharedMemoryChannel& channel, const OutMessage& message) const
+    {
+        // skip space reserved for the socket message header, the channel keeps type and size itself
+        const UInt32 headerSize = 2 * sizeof(UInt32);
+        const Byte* data = reinterpret_cast<const Byte*>(message.stream->getData()) + headerSize;
+        const UInt32 size = message.stream->getSize() - headerSize;
+        // queued messages go out when the receiver signals free space
+        return channel.send(static_cast<UInt32>(message.messageType), data, size) != ESharedMemorySendResult_Error;
+    }
+
+    Bool TCPConnectionSystem::hasSharedMemoryChannelWithQueuedMessages() const
+    {
+        for (const auto& p : m_sharedMemoryChannels)
+        {
+            if (p.value->hasQueuedMessages())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void TCPConnectionSystem::sharedMemoryChannelHasData(const SocketDescription& signal)
+    {
+        Guid participantId;
+        SharedMemoryChannel* channel = nullptr;
+        for (const auto& p : m_sharedMemoryChannels)
+        {
+            if (p.value->getSignalFileDescriptor() == signal)
+            {
+                participantId = p.key;
+                channel = p.value;
+                break;
+            }
+        }
+        if (!channel)
+        {
+            // channel was removed while handling other sockets in same check
+            return;
+        }
+
+        channel->clearSignal();
+
+        // signal also tells that the participant made space for messages queued for it
+        Bool handledSuccessfully = channel->sendQueuedMessages();
+
+        // message is handled directly from the channel buffer or the mapped memory file
+        auto handleMessage = [&](UInt32 tag, const Byte* data, UInt32 size) {
+            InMessage message(static_cast<EMessageId>(tag), data, size);
+            message.sender = participantId;
+            m_statisticCollection.statMessagesReceived.incCounter(1);
+            handledSuccessfully = dispatchReceivedMessage(message);
+        };
+
+        ESharedMemoryReceiveResult result = ESharedMemoryReceiveResult_NoMessage;
+        while (handledSuccessfully && (result = channel->receive(handleMessage)) == ESharedMemoryReceiveResult_Message)
+        {
+        }
+
+        if (!handledSuccessfully || result == ESharedMemoryReceiveResult_Error)
+        {
+            LOG_WARN(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::sharedMemoryChannelHasData: receive from " << participantId << " failed");
+            removeKnownParticipant(participantId, true);
+        }
+    }
+#else
+    void TCPConnectionSystem::setupSharedMemoryListener()
+    {
+        if (m_useSharedMemory)
+        {
+            LOG_WARN(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::setupSharedMemoryListener: shared memory not supported on this platform, use sockets only");
+        }
+    }
+
+    void TCPConnectionSystem::cleanupSharedMemoryListener()
+    {
+    }
+
+    void TCPConnectionSystem::trackSharedMemoryListener()
+    {
+    }
+
+    void TCPConnectionSystem::removeTimedOutSharedMemoryHandshakes()
+    {
+    }
+
+    Bool TCPConnectionSystem::connectSharedMemoryChannel(const Guid& /*participant*/)
+    {
+        return true;
+    }
+
+    void TCPConnectionSystem::activateSharedMemoryChannel(const Guid& /*participant*/)
+    {
+    }
+
+    void TCPConnectionSystem::removeSharedMemoryChannel(const Guid& /*participant*/)
+    {
+    }
+
+    void TCPConnectionSystem::removeAllSharedMemoryChannels()
+    {
+    }
+
+    SharedMemoryChannel* TCPConnectionSystem::findSharedMemoryChannel(const Guid& /*participant*/) const
+    {
+        return nullptr;
+    }
+
+    Bool TCPConnectionSystem::sendMessageToSharedMemoryChannel(SharedMemoryChannel& /*channel*/, const OutMessage& /*message*/) const
+    {
+        return false;
+    }
+
+    Bool TCPConnectionSystem::hasSharedMemoryChannelWithQueuedMessages() const
+    {
+        return false;
+    }
+#endif
 }
@@ -0,0 +1,216 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gmock/gmock.h"
+#include "TransportTCP/LargeDataTransferScheduler.h"
+#include "Collections/String.h"
+#include <string>
+
+namespace ramses_internal
+{
+    using namespace testing;
+
+    class ALargeDataTransferScheduler : public ::testing::Test
+    {
+    public:
+        using Scheduler = LargeDataTransferScheduler<String>;
+
+        ALargeDataTransferScheduler()
+            : peerA(true)
+            , peerB(true)
+            , peerC(true)
+            , now(Scheduler::Clock::now())
+        {
+        }
+
+        static Scheduler::ChunkQueue MakeTransfer(const String& name, UInt32 numChunks, UInt32 chunkSize = 10u)
+        {
+            Scheduler::ChunkQueue chunks;
+            for (UInt32 i = 0; i < numChunks; ++i)
+            {
+                chunks.push_back({ name + std::to_string(i).c_str(), chunkSize });
+            }
+            return chunks;
+        }
+
+        std::vector<String> popAllReadyChunks()
+        {
+            std::vector<String> result;
+            while (scheduler.isNextChunkReady(now))
+            {
+                result.push_back(scheduler.popNextChunk());
+            }
+            return result;
+        }
+
+    protected:
+        Scheduler scheduler;
+        const Guid peerA;
+        const Guid peerB;
+        const Guid peerC;
+        Scheduler::Clock::time_point now;
+    };
+
+    TEST_F(ALargeDataTransferScheduler, hasNoPendingChunksInitially)
+    {
+        EXPECT_FALSE(scheduler.hasPendingChunks());
+        EXPECT_FALSE(scheduler.isNextChunkReady(now));
+        EXPECT_EQ(0u, scheduler.getPendingBytes());
+        EXPECT_EQ(std::chrono::milliseconds(0), scheduler.getTimeUntilNextChunk(now));
+    }
+
+    TEST_F(ALargeDataTransferScheduler, ignoresEmptyTransfer)
+    {
+        scheduler.addTransfer(peerA, 0u, Scheduler::ChunkQueue());
+        EXPECT_FALSE(scheduler.hasPendingChunks());
+    }
+
+    TEST_F(ALargeDataTransferScheduler, sendsChunksOfSingleTransferInOrder)
+    {
+        scheduler.addTransfer(peerA, 0u, MakeTransfer("a", 3u));
+        EXPECT_TRUE(scheduler.hasPendingChunks());
+        EXPECT_EQ(30u, scheduler.getPendingBytes());
+
+        EXPECT_THAT(popAllReadyChunks(), ElementsAre("a0", "a1", "a2"));
+        EXPECT_FALSE(scheduler.hasPendingChunks());
+        EXPECT_EQ(0u, scheduler.getPendingBytes());
+    }
+
+    TEST_F(ALargeDataTransferScheduler, doesNotInterleaveTransfersToSamePeer)
+    {
+        scheduler.addTransfer(peerA, 0u, MakeTransfer("x", 2u));
+        scheduler.addTransfer(peerA, 0u, MakeTransfer("y", 2u));
+        EXPECT_THAT(popAllReadyChunks(), ElementsAre("x0", "x1", "y0", "y1"));
+    }
+
+    TEST_F(ALargeDataTransferScheduler, startsMoreUrgentTransferToSamePeerFirst)
+    {
+        scheduler.addTransfer(peerA, 5u, MakeTransfer("x", 2u));
+        scheduler.addTransfer(peerA, 7u, MakeTransfer("y", 2u));
+        scheduler.addTransfer(peerA, 1u, MakeTransfer("z", 2u));
+        EXPECT_THAT(popAllReadyChunks(), ElementsAre("z0", "z1", "x0", "x1", "y0", "y1"));
+    }
+
+    TEST_F(ALargeDataTransferScheduler, finishesStartedTransferBeforeStartingMoreUrgentTransferToSamePeer)
+    {
+        scheduler.addTransfer(peerA, 5u, MakeTransfer("x", 3u));
+        ASSERT_TRUE(scheduler.isNextChunkReady(now));
+        EXPECT_EQ("x0", scheduler.popNextChunk());
+
+        scheduler.addTransfer(peerA, 7u, MakeTransfer("y", 1u));
+        scheduler.addTransfer(peerA, 1u, MakeTransfer("z", 1u));
+        EXPECT_THAT(popAllReadyChunks(), ElementsAre("x1", "x2", "z0", "y0"));
+    }
+
+    TEST_F(ALargeDataTransferScheduler, interleavesTransfersToDifferentPeersRoundRobin)
+    {
+        scheduler.addTransfer(peerA, 0u, MakeTransfer("a", 3u));
+        scheduler.addTransfer(peerB, 0u, MakeTransfer("b", 1u));
+        scheduler.addTransfer(peerC, 0u, MakeTransfer("c", 2u));
+        EXPECT_THAT(popAllReadyChunks(), ElementsAre("a0", "b0", "c0", "a1", "c1", "a2"));
+    }
+
+    TEST_F(ALargeDataTransferScheduler, servesNewPeerBeforePeerWhichWasAlreadyServed)
+    {
+        scheduler.addTransfer(peerA, 0u, MakeTransfer("a", 3u));
+        ASSERT_TRUE(scheduler.isNextChunkReady(now));
+        EXPECT_EQ("a0", scheduler.popNextChunk());
+
+        scheduler.addTransfer(peerB, 0u, MakeTransfer("b", 2u));
+        EXPECT_THAT(popAllReadyChunks(), ElementsAre("b0", "a1", "b1", "a2"));
+    }
+
+    TEST_F(ALargeDataTransferScheduler, sendsMoreUrgentTransferToOtherPeerBeforeContinuingLessUrgentTransfer)
+    {
+        scheduler.addTransfer(peerA, 10u, MakeTransfer("a", 3u));
+        ASSERT_TRUE(scheduler.isNextChunkReady(now));
+        EXPECT_EQ("a0", scheduler.popNextChunk());
+
+        scheduler.addTransfer(peerB, 2u, MakeTransfer("b", 2u));
+        EXPECT_THAT(popAllReadyChunks(), ElementsAre("b0", "b1", "a1", "a2"));
+    }
+
+    TEST_F(ALargeDataTransferScheduler, dropsPendingTransfersOfRemovedPeer)
+    {
+        scheduler.addTransfer(peerA, 0u, MakeTransfer("a", 2u));
+        scheduler.addTransfer(peerB, 0u, MakeTransfer("b", 2u));
+        scheduler.removePeer(peerA);
+        EXPECT_EQ(20u, scheduler.getPendingBytes());
+        EXPECT_THAT(popAllReadyChunks(), ElementsAre("b0", "b1"));
+
+        scheduler.removePeer(peerC);
+        EXPECT_FALSE(scheduler.hasPendingChunks());
+    }
+
+    TEST_F(ALargeDataTransferScheduler, dropsAllTransfersOnClear)
+    {
+        scheduler.addTransfer(peerA, 0u, MakeTransfer("a", 2u));
+        scheduler.addTransfer(peerB, 0u, MakeTransfer("b", 2u));
+        scheduler.clear();
+        EXPECT_FALSE(scheduler.hasPendingChunks());
+        EXPECT_EQ(0u, scheduler.getPendingBytes());
+    }
+
+    TEST_F(ALargeDataTransferScheduler, sendsOnlyBurstOfDataWithBandwidthLimitAndContinuesWhenBudgetRefilled)
+    {
+        // 1000 bytes per second allows bursts of 100 bytes
+        scheduler.setBandwidthLimit(1000u);
+        EXPECT_EQ(1000u, scheduler.getBandwidthLimit());
+        scheduler.addTransfer(peerA, 0u, MakeTransfer("a", 4u, 60u));
+
+        // second chunk exceeds budget, but is sent because budget was not used up
+        EXPECT_THAT(popAllReadyChunks(), ElementsAre("a0", "a1"));
+        EXPECT_EQ(std::chrono::milliseconds(20), scheduler.getTimeUntilNextChunk(now));
+
+        now += std::chrono::milliseconds(10);
+        EXPECT_EQ(std::chrono::milliseconds(10), scheduler.getTimeUntilNextChunk(now));
+        EXPECT_FALSE(scheduler.isNextChunkReady(now));
+
+        now += std::chrono::milliseconds(10);
+        EXPECT_EQ(std::chrono::milliseconds(0), scheduler.getTimeUntilNextChunk(now));
+        EXPECT_THAT(popAllReadyChunks(), ElementsAre("a2"));
+
+        now += std::chrono::milliseconds(60);
+        EXPECT_THAT(popAllReadyChunks(), ElementsAre("a3"));
+    }
+
+    TEST_F(ALargeDataTransferScheduler, doesNotAccumulateBudgetBeyondBurstWhileIdle)
+    {
+        scheduler.setBandwidthLimit(1000u);
+        scheduler.addTransfer(peerA, 0u, MakeTransfer("a", 1u, 50u));
+        EXPECT_THAT(popAllReadyChunks(), ElementsAre("a0"));
+
+        now += std::chrono::hours(24);
+        scheduler.addTransfer(peerA, 0u, MakeTransfer("b", 4u, 50u));
+        EXPECT_THAT(popAllReadyChunks(), ElementsAre("b0", "b1", "b2"));
+        EXPECT_EQ(std::chrono::milliseconds(50), scheduler.getTimeUntilNextChunk(now));
+    }
+
+    TEST_F(ALargeDataTransferScheduler, waitsForLargeChunkToBeAccountedBeforeSendingNext)
+    {
+        scheduler.setBandwidthLimit(1000u);
+        scheduler.addTransfer(peerA, 0u, MakeTransfer("a", 2u, 2100u));
+        EXPECT_THAT(popAllReadyChunks(), ElementsAre("a0"));
+        EXPECT_EQ(std::chrono::milliseconds(2000), scheduler.getTimeUntilNextChunk(now));
+
+        now += std::chrono::milliseconds(1999);
+        EXPECT_FALSE(scheduler.isNextChunkReady(now));
+        now += std::chrono::milliseconds(1);
+        EXPECT_THAT(popAllReadyChunks(), ElementsAre("a1"));
+    }
+
+    TEST_F(ALargeDataTransferScheduler, canRemoveBandwidthLimit)
+    {
+        scheduler.setBandwidthLimit(1000u);
+        scheduler.addTransfer(peerA, 0u, MakeTransfer("a", 3u, 150u));
+        EXPECT_THAT(popAllReadyChunks(), ElementsAre("a0"));
+
+        scheduler.setBandwidthLimit(0u);
+        EXPECT_THAT(popAllReadyChunks(), ElementsAre("a1", "a2"));
+    }
+}
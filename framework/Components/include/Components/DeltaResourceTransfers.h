@@ -0,0 +1,77 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_DELTARESOURCETRANSFERS_H
+#define RAMSES_DELTARESOURCETRANSFERS_H
+
+#include "Components/ManagedResource.h"
+#include "Collections/Guid.h"
+#include "Collections/HashMap.h"
+#include "Collections/HashSet.h"
+#include "SceneAPI/EDataType.h"
+#include <deque>
+
+namespace ramses_internal
+{
+    class DeltaUpdateResource;
+
+    // Keeps track of resources created as delta of a base resource (see ResourceDeltaInfo) on both sides of a transfer.
+    // The sending side remembers per receiver which of these resources it sent and sends only the changed data range
+    // if the receiver is known to hold the base resource, the full data wrapped into a DeltaUpdateResource otherwise.
+    // The receiving side retains all resources which arrived this way as possible base of following updates, within a
+    // memory budget. Both sides forget a base as soon as an update on it was sent or reconstructed. If the receiver evicted
+    // a base to stay within budget it cannot reconstruct the update and requests the resource again, which the sender then
+    // answers with full data.
+    class DeltaResourceTransfers
+    {
+    public:
+        explicit DeltaResourceTransfers(UInt64 maximumRetainedBytes = 64u * 1024u * 1024u);
+
+        // sending side, returns resource as it should be sent to receiver
+        ManagedResource prepareResourceForSending(const ManagedResource& resource, const Guid& receiver);
+
+        // receiving side
+        void retainResource(const ManagedResource& resource, const Guid& provider);
+        void releaseRetainedResource(const ResourceContentHash& hash);
+        const IResource* getRetainedResource(const ResourceContentHash& hash) const;
+        UInt64 getRetainedBytes() const;
+
+        void participantHasDisconnected(const Guid& participant);
+
+        // returns nullptr if update is malformed or if base resource does not match update
+        static IResource* CreateTargetResource(const DeltaUpdateResource& update, const IResource* baseResource);
+
+    private:
+        struct SentResources
+        {
+            HashSet<ResourceContentHash> heldByReceiver;
+            HashSet<ResourceContentHash> sentAsDelta;
+        };
+
+        struct RetainedResource
+        {
+            Guid provider;
+            ManagedResource resource;
+            UInt32 size;
+        };
+
+        static const UInt32 ArrayMetadataSize = 2u * sizeof(UInt32);
+        static Bool IsValidArrayElementType(EDataType elementType);
+
+        // few delta updated resources only, therefore searched linearly
+        std::deque<RetainedResource>::iterator findRetainedResource(const ResourceContentHash& hash);
+        std::deque<RetainedResource>::const_iterator findRetainedResource(const ResourceContentHash& hash) const;
+
+        HashMap<Guid, SentResources> m_sentResources;
+        std::deque<RetainedResource> m_retainedResources;
+        const UInt64 m_maximumRetainedBytes;
+        UInt64 m_retainedBytes;
+    };
+}
+
+#endif
@@ -14,6 +14,7 @@
 #include "ResourceStorage.h"
 #include "Components/ResourceHashUsage.h"
 #include "ResourceFilesRegistry.h"
+#include "DeltaResourceTransfers.h"
 
 #include "TaskFramework/ITask.h"
 #include "TaskFramework/EnqueueOnlyOneAtATimeQueue.h"
@@ -32,6 +33,7 @@ namespace ramses_internal
     class IConnectionStatusUpdateNotifier;
     class ICommunicationSystem;
     class ResourceStreamDeserializer;
+    class DeltaUpdateResource;
 
     struct ResourceLoadInfo
     {
@@ -120,6 +122,7 @@ namespace ramses_internal
 
         void triggerLoadingResourcesFromFile();
 
+        void handleArrivedDeltaUpdate(const DeltaUpdateResource& update, const Guid& providerID);
         void sendResourcesFromFile(const Vector<IResource*>& loadedResources, uint64_t bytesLoaded, const Guid& requesterId);
         const ResourceInfo& getResourceInfo(const ResourceContentHash& hash) const;
         void storeResourceInfo(const ResourceContentHash& hash, const ResourceInfo& resourceInfo);
@@ -142,6 +145,7 @@ namespace ramses_internal
         HashMap<Guid, ResourceStreamDeserializer*>              m_resourceDeserializers;
         RequestsMap                                             m_requestedResources;
         std::unordered_map<RequesterID, ManagedResourceVector>  m_arrivedResources;
+        DeltaResourceTransfers                                  m_deltaResourceTransfers;
 
         StatisticCollectionFramework&                           m_statistics;
     };
@@ -21,6 +21,7 @@ namespace ramses_internal
     class BinaryFileInputStream;
     class BinaryFileOutputStream;
     struct ResourceFileEntry;
+    class ResourceTableOfContents;
 
     class ResourcePersistation
     {
@@ -32,7 +33,13 @@ namespace ramses_internal
 
         static IResource* ReadOneResourceFromStream(IInputStream& inStream, const ResourceContentHash& hash);
         static IResource* RetrieveResourceFromStream(BinaryFileInputStream& inStream, const ResourceFileEntry& entry);
+
+        // copies resource stored in resource file to other one as it is serialized there, without decompressing and compressing it,
+        // only resource stored uncompressed is compressed when requested
+        static void CopyResourceToStream(BinaryFileInputStream& inStream, const ResourceFileEntry& entry, BinaryFileOutputStream& outStream, ResourceTableOfContents& toc, bool compress);
     private:
+        static void CompressResources(const ManagedResourceVector& resources, IResource::CompressionLevel level);
+
         static const char* ResourceFileExtension;
     };
 }
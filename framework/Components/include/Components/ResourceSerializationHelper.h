@@ -11,6 +11,7 @@
 
 #include "PlatformAbstraction/PlatformTypes.h"
 #include "Resource/EResourceCompressionStatus.h"
+#include "Resource/EResourceType.h"
 #include "SceneAPI/SceneResourceData.h"
 
 namespace ramses_internal
@@ -34,6 +35,7 @@ namespace ramses_internal
         UInt32 ResourceMetadataSize(const IResource& resource);
 
         DeserializedResourceHeader ResourceFromMetadataStream(IInputStream& input);
+        IResource* ResourceFromTypeAndMetadataStream(EResourceType resourceType, IInputStream& input, ResourceCacheFlag cacheFlag, const String& name);
 
         void SetInvalidCreateResourceFromMetadataStreamFunction(IResource*(*fun)(IInputStream&, ResourceCacheFlag, const String&));
     }
@@ -22,7 +22,7 @@ namespace ramses_internal
 {
     struct ResourceFileEntry
     {
-        UInt32 offsetInBytes;
+        UInt64 offsetInBytes;
         UInt32 sizeInBytes;
         ResourceInfo resourceInfo;
     };
@@ -33,10 +33,12 @@ namespace ramses_internal
     {
     public:
         Bool containsResource(const ResourceContentHash& hash) const;
-        void registerContents(const ResourceInfo& info, UInt32 offsetInBytes, UInt32 sizeInBytes);
+        void registerContents(const ResourceInfo& info, UInt64 offsetInBytes, UInt32 sizeInBytes);
         const ResourceFileEntry& getEntryForHash(const ResourceContentHash& hash) const;
         const TableOfContentsMap& getFileContents() const;
+        // reads both TOC with 64 bit offsets and legacy TOC with 32 bit offsets
         Bool readTOCPosAndTOCFromStream(BinaryFileInputStream& instream);
+        // size of written TOC depends only on number of registered resources
         void writeTOCToStream(IOutputStream& outstream);
 
     private:
@@ -0,0 +1,209 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Components/DeltaResourceTransfers.h"
+#include "Components/ResourceSerializationHelper.h"
+#include "Resource/DeltaUpdateResource.h"
+#include "PlatformAbstraction/PlatformMemory.h"
+#include "Utils/BinaryInputStream.h"
+#include <algorithm>
+
+namespace ramses_internal
+{
+    DeltaResourceTransfers::DeltaResourceTransfers(UInt64 maximumRetainedBytes)
+        : m_maximumRetainedBytes(maximumRetainedBytes)
+        , m_retainedBytes(0u)
+    {
+    }
+
+    ManagedResource DeltaResourceTransfers::prepareResourceForSending(const ManagedResource& resource, const Guid& receiver)
+    {
+        const IResource& resourceObject = *resource.getResourceObject();
+        const ResourceDeltaInfo& deltaInfo = resourceObject.getDeltaInfo();
+        if (!deltaInfo.isValid())
+        {
+            return resource;
+        }
+
+        const ResourceContentHash hash = resourceObject.getHash();
+        SentResources& sentResources = m_sentResources[receiver];
+        // resource requested again after it was sent as delta means receiver could not reconstruct it, send full data then
+        const Bool sendChangedDataOnly = sentResources.heldByReceiver.hasElement(deltaInfo.baseHash) && !sentResources.sentAsDelta.hasElement(hash);
+
+        // receiver releases base resource when update on it arrives
+        sentResources.heldByReceiver.remove(deltaInfo.baseHash);
+        sentResources.sentAsDelta.remove(deltaInfo.baseHash);
+        sentResources.heldByReceiver.put(hash);
+        if (sendChangedDataOnly)
+        {
+            sentResources.sentAsDelta.put(hash);
+        }
+        else
+        {
+            sentResources.sentAsDelta.remove(hash);
+        }
+
+        ResourceDeleterCallingCallback deleter;
+        return ManagedResource(*new DeltaUpdateResource(resourceObject, sendChangedDataOnly), deleter);
+    }
+
+    void DeltaResourceTransfers::retainResource(const ManagedResource& resource, const Guid& provider)
+    {
+        const IResource& resourceObject = *resource.getResourceObject();
+        if (findRetainedResource(resourceObject.getHash()) != m_retainedResources.end())
+        {
+            return;
+        }
+
+        const UInt32 size = resourceObject.getDecompressedDataSize();
+        if (size > m_maximumRetainedBytes)
+        {
+            return;
+        }
+
+        // evict oldest first, sender is not informed and will answer re-request after failed reconstruction with full data
+        while (m_retainedBytes + size > m_maximumRetainedBytes)
+        {
+            m_retainedBytes -= m_retainedResources.front().size;
+            m_retainedResources.pop_front();
+        }
+
+        m_retainedResources.push_back({ provider, resource, size });
+        m_retainedBytes += size;
+    }
+
+    void DeltaResourceTransfers::releaseRetainedResource(const ResourceContentHash& hash)
+    {
+        const auto it = findRetainedResource(hash);
+        if (it != m_retainedResources.end())
+        {
+            m_retainedBytes -= it->size;
+            m_retainedResources.erase(it);
+        }
+    }
+
+    const IResource* DeltaResourceTransfers::getRetainedResource(const ResourceContentHash& hash) const
+    {
+        const auto it = findRetainedResource(hash);
+        return (it != m_retainedResources.end()) ? it->resource.getResourceObject() : nullptr;
+    }
+
+    UInt64 DeltaResourceTransfers::getRetainedBytes() const
+    {
+        return m_retainedBytes;
+    }
+
+    void DeltaResourceTransfers::participantHasDisconnected(const Guid& participant)
+    {
+        m_sentResources.remove(participant);
+
+        // partition keeps removed elements intact, unlike remove_if, so their sizes can be subtracted
+        const auto it = std::stable_partition(m_retainedResources.begin(), m_retainedResources.end(), [&participant](const RetainedResource& retained) { return retained.provider != participant; });
+        std::for_each(it, m_retainedResources.end(), [this](const RetainedResource& retained) { m_retainedBytes -= retained.size; });
+        m_retainedResources.erase(it, m_retainedResources.end());
+    }
+
+    IResource* DeltaResourceTransfers::CreateTargetResource(const DeltaUpdateResource& update, const IResource* baseResource)
+    {
+        // only array resources are created as delta of a base resource, their metadata is element count and element type
+        const EResourceType targetType = update.getTargetTypeID();
+        if (targetType != EResourceType_VertexArray && targetType != EResourceType_IndexArray)
+        {
+            return nullptr;
+        }
+
+        const ResourceDeltaInfo& deltaInfo = update.getTargetDeltaInfo();
+        const UInt32 targetDataSize = update.getTargetDataSize();
+        update.decompress();
+        const SceneResourceData& changedData = update.getResourceData();
+        if (static_cast<UInt64>(deltaInfo.changedDataOffset) + deltaInfo.changedDataSize > targetDataSize || changedData->size() != deltaInfo.changedDataSize)
+        {
+            return nullptr;
+        }
+
+        const Bool requiresBaseResource = update.requiresBaseResource();
+        if (requiresBaseResource && (baseResource == nullptr || baseResource->getHash() != deltaInfo.baseHash || baseResource->getDecompressedDataSize() != targetDataSize))
+        {
+            return nullptr;
+        }
+
+        // metadata was received from remote, check its size before parsing and the parsed array against the received data size
+        const std::vector<Byte>& targetMetadata = update.getTargetMetadata();
+        if (targetMetadata.size() != ArrayMetadataSize)
+        {
+            return nullptr;
+        }
+
+        UInt32 elementCount = 0u;
+        UInt32 elementTypeAsUInt = 0u;
+        BinaryInputStream elementInfoStream(targetMetadata.data());
+        elementInfoStream >> elementCount;
+        elementInfoStream >> elementTypeAsUInt;
+        const EDataType elementType = static_cast<EDataType>(elementTypeAsUInt);
+        if (!IsValidArrayElementType(elementType) || static_cast<UInt64>(elementCount) * EnumToSize(elementType) != targetDataSize)
+        {
+            return nullptr;
+        }
+
+        BinaryInputStream metadataStream(targetMetadata.data());
+        IResource* targetResource = ResourceSerializationHelper::ResourceFromTypeAndMetadataStream(targetType, metadataStream, update.getCacheFlag(), update.getName());
+        if (targetResource == nullptr)
+        {
+            return nullptr;
+        }
+
+        MemoryBlob* targetData = new MemoryBlob(targetDataSize);
+        if (requiresBaseResource)
+        {
+            baseResource->decompress();
+            PlatformMemory::Copy(targetData->getRawData(), baseResource->getResourceData()->getRawData(), targetDataSize);
+        }
+        PlatformMemory::Copy(targetData->getRawData() + deltaInfo.changedDataOffset, changedData->getRawData(), deltaInfo.changedDataSize);
+        if (!requiresBaseResource)
+        {
+            targetResource->setResourceData(SceneResourceData(targetData), update.getHash());
+            return targetResource;
+        }
+
+        // data applied on the retained base must result in the resource of the sender, hash it the same way the sender did
+        targetResource->convertTo<ResourceBase>()->setChunkedHashingThreshold(update.getTargetChunkedHashingThreshold());
+        targetResource->setResourceData(SceneResourceData(targetData));
+        if (targetResource->getHash() != update.getHash())
+        {
+            delete targetResource;
+            return nullptr;
+        }
+        return targetResource;
+    }
+
+    Bool DeltaResourceTransfers::IsValidArrayElementType(EDataType elementType)
+    {
+        switch (elementType)
+        {
+        case EDataType_UInt16:
+        case EDataType_UInt32:
+        case EDataType_Float:
+        case EDataType_Vector2F:
+        case EDataType_Vector3F:
+        case EDataType_Vector4F:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    std::deque<DeltaResourceTransfers::RetainedResource>::iterator DeltaResourceTransfers::findRetainedResource(const ResourceContentHash& hash)
+    {
+        return std::find_if(m_retainedResources.begin(), m_retainedResources.end(), [&hash](const RetainedResource& retained) { return retained.resource.getResourceObject()->getHash() == hash; });
+    }
+
+    std::deque<DeltaResourceTransfers::RetainedResource>::const_iterator DeltaResourceTransfers::findRetainedResource(const ResourceContentHash& hash) const
+    {
+        return std::find_if(m_retainedResources.begin(), m_retainedResources.end(), [&hash](const RetainedResource& retained) { return retained.resource.getResourceObject()->getHash() == hash; });
+    }
+}
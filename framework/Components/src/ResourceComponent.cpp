@@ -19,6 +19,7 @@
 #include "TransportCommon/IConnectionStatusUpdateNotifier.h"
 #include "TransportCommon/ICommunicationSystem.h"
 #include "Components/ResourceStreamSerialization.h"
+#include "Resource/DeltaUpdateResource.h"
 #include <algorithm>
 #include "PlatformAbstraction/PlatformTime.h"
 
@@ -102,7 +103,8 @@ namespace ramses_internal
             if (resource.getResourceObject())
             {
                 LOG_TRACE(CONTEXT_FRAMEWORK, "ResourceComponent::handleResourceRequest: sendResource" << StringUtils::HexFromResourceContentHash(id) << " name: " << resource.getResourceObject()->getName());
-                resourceToSendViaNetwork.push_back(resource);
+                PlatformGuard guard(m_frameworkLock);
+                resourceToSendViaNetwork.push_back(m_deltaResourceTransfers.prepareResourceForSending(resource, requesterId));
             }
             else
             {
@@ -370,8 +372,52 @@ namespace ramses_internal
         const Vector<IResource*> resources = deserializer->processData(receivedResourceData);
         for (const auto& res : resources)
         {
-            handleArrivedResource(m_resourceStorage.manageResource(*res, false));
+            if (res->getTypeID() == EResourceType_DeltaUpdate)
+            {
+                handleArrivedDeltaUpdate(*res->convertTo<DeltaUpdateResource>(), providerID);
+                delete res;
+            }
+            else
+            {
+                handleArrivedResource(m_resourceStorage.manageResource(*res, false));
+            }
+        }
+    }
+
+    void ResourceComponent::handleArrivedDeltaUpdate(const DeltaUpdateResource& update, const Guid& providerID)
+    {
+        const ResourceDeltaInfo& deltaInfo = update.getTargetDeltaInfo();
+        const IResource* baseResource = nullptr;
+        ManagedResource baseResourceFromStorage;
+        if (update.requiresBaseResource())
+        {
+            baseResource = m_deltaResourceTransfers.getRetainedResource(deltaInfo.baseHash);
+            if (!baseResource)
+            {
+                baseResourceFromStorage = m_resourceStorage.getResource(deltaInfo.baseHash);
+                baseResource = baseResourceFromStorage.getResourceObject();
+            }
         }
+
+        IResource* targetResource = DeltaResourceTransfers::CreateTargetResource(update, baseResource);
+        if (!targetResource)
+        {
+            LOG_WARN(CONTEXT_FRAMEWORK, "ResourceComponent::handleArrivedDeltaUpdate: Could not apply update for resource " << StringUtils::HexFromResourceContentHash(update.getHash())
+                << " on base resource " << StringUtils::HexFromResourceContentHash(deltaInfo.baseHash) << ", request full resource from " << providerID);
+            ResourceContentHashVector hashes;
+            hashes.push_back(update.getHash());
+            m_communicationSystem.sendRequestResources(providerID, hashes);
+            return;
+        }
+
+        LOG_TRACE(CONTEXT_FRAMEWORK, "ResourceComponent::handleArrivedDeltaUpdate: resource " << StringUtils::HexFromResourceContentHash(update.getHash()) << " reconstructed from "
+            << deltaInfo.changedDataSize << " of " << update.getTargetDataSize() << " bytes");
+
+        // provider does not send further updates on the base, the reconstructed resource is base of following updates
+        m_deltaResourceTransfers.releaseRetainedResource(deltaInfo.baseHash);
+        const ManagedResource managedResource = m_resourceStorage.manageResource(*targetResource, false);
+        m_deltaResourceTransfers.retainResource(managedResource, providerID);
+        handleArrivedResource(managedResource);
     }
 
     void ResourceComponent::handleArrivedResource(const ManagedResource& resource)
@@ -505,6 +551,7 @@ namespace ramses_internal
             delete it->value;
             m_resourceDeserializers.remove(it);
         }
+        m_deltaResourceTransfers.participantHasDisconnected(guid);
     }
 
     ManagedResource ResourceComponent::forceLoadResource(const ResourceContentHash& hash)
@@ -11,7 +11,6 @@
 #include "Collections/IOutputStream.h"
 #include "Collections/IInputStream.h"
 #include "Utils/File.h"
-#include "Utils/VoidOutputStream.h"
 #include "Utils/BinaryFileInputStream.h"
 #include "Utils/BinaryFileOutputStream.h"
 #include "Components/ManagedResource.h"
@@ -19,6 +18,9 @@
 #include "Resource/ResourceInfo.h"
 #include "Resource/IResource.h"
 #include "Components/SingleResourceSerialization.h"
+#include "Collections/HashSet.h"
+#include "Utils/ParallelJobs.h"
+#include <memory>
 
 namespace ramses_internal
 {
@@ -53,59 +55,64 @@ namespace ramses_internal
         // achieve maximum resource file loading speed by reading in increasing file position order
         // so store TOC first followed by all resources, as the toc is read before the resources
 
-        UInt offsetForTOC = 0;
-        outStream.getPos(offsetForTOC);
-
-        // get size and offset of resources by writing to dummy stream
-        VoidOutputStream dummyStream;
-        ResourceTableOfContents dummyToc;
-        ramses_internal::Vector<UInt32> resourceOffsetSize;
-        resourceOffsetSize.reserve(resourcesForFile.size() * 2);
-        UInt32 offsetBeforeWrite = 0;
-        UInt32 currentPosAfterWrite = 0;
-
-        // possible compress all resources before writing
+        // resource referenced multiple times is stored only once
+        ManagedResourceVector resourcesToWrite;
+        resourcesToWrite.reserve(resourcesForFile.size());
+        HashSet<ResourceContentHash> hashesToWrite;
         for (const auto& res : resourcesForFile)
         {
-            res.getResourceObject()->compress(compress ? IResource::CompressionLevel::OFFLINE : IResource::CompressionLevel::NONE);
+            const ResourceContentHash hash = res.getResourceObject()->getHash();
+            if (!hashesToWrite.hasElement(hash))
+            {
+                hashesToWrite.put(hash);
+                resourcesToWrite.push_back(res);
+            }
         }
 
-        for (const auto& res : resourcesForFile)
+        if (compress)
         {
-            WriteOneResourceToStream(dummyStream, res);
-            currentPosAfterWrite = dummyStream.getSize();
-            const UInt32 bytesWritten = currentPosAfterWrite - offsetBeforeWrite;
-            resourceOffsetSize.push_back(offsetBeforeWrite);
-            resourceOffsetSize.push_back(bytesWritten);
-
-            const IResource* resourceObject = res.getResourceObject();
-            dummyToc.registerContents(ResourceInfo(resourceObject), 0, 0);
-
-            offsetBeforeWrite = static_cast<UInt32>(currentPosAfterWrite);
+            CompressResources(resourcesToWrite, IResource::CompressionLevel::OFFLINE);
         }
 
-        // get size of TOC by writing to dummy stream
-        dummyToc.writeTOCToStream(dummyStream);
-        currentPosAfterWrite = dummyStream.getSize();
-        const UInt32 tocSize = currentPosAfterWrite - offsetBeforeWrite;
+        // size of TOC does not depend on offsets, so it is written with placeholders and patched after resources are written
+        UInt offsetForTOC = 0;
+        outStream.getPos(offsetForTOC);
 
-        // create final TOC with correct resource offsets
         ResourceTableOfContents toc;
-        UInt32 i = 0;
-        for (const auto& res : resourcesForFile)
+        for (const auto& res : resourcesToWrite)
         {
-            const IResource* resourceObject = res.getResourceObject();
-            const UInt32 resourceOffset = resourceOffsetSize[i++];
-            const UInt32 resourceSize = resourceOffsetSize[i++];
-            toc.registerContents(ResourceInfo(resourceObject), static_cast<UInt32>(offsetForTOC) + tocSize + resourceOffset, resourceSize);
+            toc.registerContents(ResourceInfo(res.getResourceObject()), 0u, 0u);
         }
-
-        // write final toc and resources to output stream
         toc.writeTOCToStream(outStream);
-        for (const auto& res : resourcesForFile)
+
+        for (const auto& res : resourcesToWrite)
         {
+            UInt offsetBeforeWrite = 0;
+            outStream.getPos(offsetBeforeWrite);
             WriteOneResourceToStream(outStream, res);
+            UInt offsetAfterWrite = 0;
+            outStream.getPos(offsetAfterWrite);
+
+            toc.registerContents(ResourceInfo(res.getResourceObject()), offsetBeforeWrite, static_cast<UInt32>(offsetAfterWrite - offsetBeforeWrite));
         }
+
+        UInt offsetAfterResources = 0;
+        outStream.getPos(offsetAfterResources);
+        outStream.seek(static_cast<Int>(offsetForTOC), EFileSeekOrigin_BeginningOfFile);
+        toc.writeTOCToStream(outStream);
+        outStream.seek(static_cast<Int>(offsetAfterResources), EFileSeekOrigin_BeginningOfFile);
+    }
+
+    void ResourcePersistation::CompressResources(const ManagedResourceVector& resources, IResource::CompressionLevel level)
+    {
+        if (resources.empty())
+            return;
+
+        // resources are compressed independently of each other
+        ParallelJobs::Execute(static_cast<UInt32>(resources.size()), [&resources, level](UInt32 resourceIdx)
+        {
+            resources[resourceIdx].getResourceObject()->compress(level);
+        });
     }
 
     IResource* ResourcePersistation::RetrieveResourceFromStream(BinaryFileInputStream& inStream, const ResourceFileEntry& fileEntry)
@@ -119,4 +126,30 @@ namespace ramses_internal
         assert(currentPosAfterRead - fileEntry.offsetInBytes == fileEntry.sizeInBytes);
         return resource;
     }
+
+    void ResourcePersistation::CopyResourceToStream(BinaryFileInputStream& inStream, const ResourceFileEntry& fileEntry, BinaryFileOutputStream& outStream, ResourceTableOfContents& toc, bool compress)
+    {
+        UInt offsetBeforeWrite = 0;
+        outStream.getPos(offsetBeforeWrite);
+
+        const Bool isStoredCompressed = (fileEntry.resourceInfo.compressedSize != 0u);
+        if (compress && !isStoredCompressed)
+        {
+            std::unique_ptr<IResource> resource(RetrieveResourceFromStream(inStream, fileEntry));
+            resource->compress(IResource::CompressionLevel::OFFLINE);
+            SingleResourceSerialization::SerializeResource(outStream, *resource);
+            UInt offsetAfterWrite = 0;
+            outStream.getPos(offsetAfterWrite);
+
+            toc.registerContents(ResourceInfo(resource.get()), offsetBeforeWrite, static_cast<UInt32>(offsetAfterWrite - offsetBeforeWrite));
+            return;
+        }
+
+        Vector<Char> serializedResource(fileEntry.sizeInBytes);
+        inStream.seek(static_cast<Int>(fileEntry.offsetInBytes), EFileSeekOrigin_BeginningOfFile);
+        inStream.read(serializedResource.data(), fileEntry.sizeInBytes);
+        outStream.write(serializedResource.data(), fileEntry.sizeInBytes);
+
+        toc.registerContents(fileEntry.resourceInfo, offsetBeforeWrite, fileEntry.sizeInBytes);
+    }
 }
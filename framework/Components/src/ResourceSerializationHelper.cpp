@@ -11,6 +11,7 @@
 #include "Resource/TextureResource.h"
 #include "Resource/ArrayResource.h"
 #include "Resource/EffectResource.h"
+#include "Resource/DeltaUpdateResource.h"
 #include "Utils/LogMacros.h"
 
 namespace ramses_internal
@@ -40,26 +41,8 @@ namespace ramses_internal
             return stream.getSize();
         }
 
-        DeserializedResourceHeader ResourceFromMetadataStream(IInputStream& input)
+        IResource* ResourceFromTypeAndMetadataStream(EResourceType resourceType, IInputStream& input, ResourceCacheFlag cacheFlag, const String& name)
         {
-            UInt32 resourceTypeValue = 0;
-            String name;
-            UInt32 compressionStatusValue = 0;
-            UInt32 compressedSize = 0;
-            UInt32 decompressedSize = 0;
-            UInt32 cacheFlagValue = 0;
-
-            input >> resourceTypeValue;
-            input >> name;
-            input >> compressionStatusValue;
-            input >> compressedSize;
-            input >> decompressedSize;
-            input >> cacheFlagValue;
-
-            const ResourceCacheFlag cacheFlag(cacheFlagValue);
-            const EResourceType resourceType = static_cast<EResourceType>(resourceTypeValue);
-            const EResourceCompressionStatus compressionStatus = static_cast<EResourceCompressionStatus>(compressionStatusValue);
-
             IResource* resource = nullptr;
             switch (resourceType)
             {
@@ -75,6 +58,9 @@ namespace ramses_internal
             case EResourceType_Effect:
                 resource = EffectResource::CreateResourceFromMetadataStream(input, cacheFlag, name);
                 break;
+            case EResourceType_DeltaUpdate:
+                resource = DeltaUpdateResource::CreateResourceFromMetadataStream(input, cacheFlag, name);
+                break;
             case EResourceType_Invalid:
                 if (gInvalidResourceFun)
                 {
@@ -82,7 +68,7 @@ namespace ramses_internal
                 }
                 else
                 {
-                    LOG_ERROR(CONTEXT_FRAMEWORK, "ResourceSerializationHelper::ResourceFromMetadataStream: Failed to deserialize unknown resource type " << resourceType);
+                    LOG_ERROR(CONTEXT_FRAMEWORK, "ResourceSerializationHelper::ResourceFromTypeAndMetadataStream: Failed to deserialize unknown resource type " << resourceType);
                     assert(false);
                 }
                 break;
@@ -90,8 +76,31 @@ namespace ramses_internal
                 assert(false);
             }
 
+            return resource;
+        }
+
+        DeserializedResourceHeader ResourceFromMetadataStream(IInputStream& input)
+        {
+            UInt32 resourceTypeValue = 0;
+            String name;
+            UInt32 compressionStatusValue = 0;
+            UInt32 compressedSize = 0;
+            UInt32 decompressedSize = 0;
+            UInt32 cacheFlagValue = 0;
+
+            input >> resourceTypeValue;
+            input >> name;
+            input >> compressionStatusValue;
+            input >> compressedSize;
+            input >> decompressedSize;
+            input >> cacheFlagValue;
+
+            const ResourceCacheFlag cacheFlag(cacheFlagValue);
+            const EResourceType resourceType = static_cast<EResourceType>(resourceTypeValue);
+            const EResourceCompressionStatus compressionStatus = static_cast<EResourceCompressionStatus>(compressionStatusValue);
+
             DeserializedResourceHeader result;
-            result.resource = resource;
+            result.resource = ResourceFromTypeAndMetadataStream(resourceType, input, cacheFlag, name);
             result.compressionStatus = compressionStatus;
             result.decompressedSize = decompressedSize;
             result.compressedSize = compressedSize;
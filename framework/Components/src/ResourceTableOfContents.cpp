@@ -15,13 +15,18 @@
 
 namespace ramses_internal
 {
+    namespace
+    {
+        // stored in place of number of entries of legacy TOC with 32 bit offsets, which never has that many entries
+        const uint32_t LargeFileTOCMarker = 0xFFFFFFFFu;
+    }
 
     Bool ResourceTableOfContents::containsResource(const ResourceContentHash& hash) const
     {
         return m_fileContents.contains(hash);
     }
 
-    void ResourceTableOfContents::registerContents(const ResourceInfo& resourceInfo, UInt32 offsetInBytes, UInt32 sizeInBytes)
+    void ResourceTableOfContents::registerContents(const ResourceInfo& resourceInfo, UInt64 offsetInBytes, UInt32 sizeInBytes)
     {
         ResourceFileEntry fileEntry;
         fileEntry.offsetInBytes = offsetInBytes;
@@ -38,6 +43,7 @@ namespace ramses_internal
     void ResourceTableOfContents::writeTOCToStream(IOutputStream& outstream)
     {
         const uint32_t numberOfEntries = static_cast<uint32_t>(m_fileContents.count());
+        outstream << LargeFileTOCMarker;
         outstream << numberOfEntries;
 
         // sort resources to get deterministic file
@@ -73,6 +79,11 @@ namespace ramses_internal
     {
         uint32_t numberOfEntries = 0;
         instream >> numberOfEntries;
+        const Bool hasLargeFileOffsets = (numberOfEntries == LargeFileTOCMarker);
+        if (hasLargeFileOffsets)
+        {
+            instream >> numberOfEntries;
+        }
         std::array<uint32_t, EResourceType_NUMBER_OF_ELEMENTS> objectCounts = {};
 
         for (uint32_t i = 0; i < numberOfEntries; ++i)
@@ -84,8 +95,17 @@ namespace ramses_internal
             instream >> info.hash;
             instream >> info.decompressedSize;
             instream >> info.compressedSize;
-            UInt32 offsetInBytes = 0;
-            instream >> offsetInBytes;
+            UInt64 offsetInBytes = 0;
+            if (hasLargeFileOffsets)
+            {
+                instream >> offsetInBytes;
+            }
+            else
+            {
+                UInt32 legacyOffsetInBytes = 0;
+                instream >> legacyOffsetInBytes;
+                offsetInBytes = legacyOffsetInBytes;
+            }
             UInt32 sizeInBytes = 0;
             instream >> sizeInBytes;
             registerContents(info, offsetInBytes, sizeInBytes);
@@ -0,0 +1,356 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "framework_common_gmock_header.h"
+#include "gmock/gmock.h"
+#include "Components/DeltaResourceTransfers.h"
+#include "Resource/ArrayResource.h"
+#include "Resource/DeltaUpdateResource.h"
+#include "PlatformAbstraction/PlatformMemory.h"
+#include "Utils/BinaryOutputStream.h"
+#include "Utils/BinaryInputStream.h"
+#include <memory>
+
+using namespace testing;
+
+namespace ramses_internal
+{
+    static const UInt32 ElementCount = 100u;
+
+    class ADeltaResourceTransfers : public testing::Test
+    {
+    public:
+        ADeltaResourceTransfers()
+            : receiver(true)
+            , otherReceiver(true)
+        {
+        }
+
+        // resource which differs from its base resource only in one element
+        ManagedResource createResource(Float value, const ManagedResource& base = ManagedResource(), UInt32 changedElement = 0u)
+        {
+            Float data[ElementCount] = {};
+            if (base.getResourceObject())
+            {
+                PlatformMemory::Copy(data, base.getResourceObject()->getResourceData()->getRawData(), sizeof(data));
+            }
+            data[changedElement] = value;
+
+            ArrayResource* resource = new ArrayResource(EResourceType_VertexArray, ElementCount, EDataType_Float, reinterpret_cast<const Byte*>(data), ResourceCacheFlag(0u), "res");
+            if (base.getResourceObject())
+            {
+                resource->setDeltaInfo(ResourceDeltaInfo(base.getResourceObject()->getHash(), changedElement * sizeof(Float), sizeof(Float)));
+            }
+            return ManagedResource(*resource, deleter);
+        }
+
+        static const DeltaUpdateResource* AsUpdate(const ManagedResource& resource)
+        {
+            EXPECT_EQ(EResourceType_DeltaUpdate, resource.getResourceObject()->getTypeID());
+            return resource.getResourceObject()->convertTo<DeltaUpdateResource>();
+        }
+
+        // update metadata ends with size of target metadata, target array element count and element type followed by
+        // chunked hashing threshold of target, offset is counted from end of target metadata
+        static std::unique_ptr<IResource> CreateUpdateWithModifiedMetadata(const DeltaUpdateResource& update, UInt32 offsetFromEnd, UInt32 value)
+        {
+            BinaryOutputStream stream;
+            update.serializeResourceMetadataToStream(stream);
+            std::vector<Byte> metadata(stream.getData(), stream.getData() + stream.getSize());
+            PlatformMemory::Copy(metadata.data() + metadata.size() - sizeof(UInt32) - offsetFromEnd, &value, sizeof(value));
+
+            BinaryInputStream inputStream(metadata.data());
+            std::unique_ptr<IResource> modifiedUpdate(DeltaUpdateResource::CreateResourceFromMetadataStream(inputStream, update.getCacheFlag(), update.getName()));
+            modifiedUpdate->setResourceData(update.getResourceData(), update.getHash());
+            return modifiedUpdate;
+        }
+
+        static void ExpectSameData(const IResource& a, const IResource& b)
+        {
+            ASSERT_EQ(a.getResourceData()->size(), b.getResourceData()->size());
+            EXPECT_EQ(0, PlatformMemory::Compare(a.getResourceData()->getRawData(), b.getResourceData()->getRawData(), a.getResourceData()->size()));
+        }
+
+    protected:
+        DeltaResourceTransfers transfers;
+        ResourceDeleterCallingCallback deleter;
+        const Guid receiver;
+        const Guid otherReceiver;
+    };
+
+    TEST_F(ADeltaResourceTransfers, sendsResourceWithoutDeltaInfoUnchanged)
+    {
+        const ManagedResource resource = createResource(1.f);
+        EXPECT_EQ(resource, transfers.prepareResourceForSending(resource, receiver));
+    }
+
+    TEST_F(ADeltaResourceTransfers, sendsFullDataIfReceiverIsNotKnownToHoldBase)
+    {
+        const ManagedResource base = createResource(1.f);
+        const ManagedResource resource = createResource(2.f, base, 5u);
+
+        const ManagedResource sent = transfers.prepareResourceForSending(resource, receiver);
+        const DeltaUpdateResource* update = AsUpdate(sent);
+        EXPECT_FALSE(update->requiresBaseResource());
+        EXPECT_EQ(resource.getResourceObject()->getHash(), update->getHash());
+        EXPECT_EQ(EResourceType_VertexArray, update->getTargetTypeID());
+        EXPECT_EQ(ElementCount * sizeof(Float), update->getTargetDataSize());
+        ExpectSameData(*resource.getResourceObject(), *update);
+    }
+
+    TEST_F(ADeltaResourceTransfers, sendsChangedDataOnlyIfReceiverHoldsBase)
+    {
+        const ManagedResource base = createResource(1.f);
+        const ManagedResource resource1 = createResource(2.f, base, 5u);
+        const ManagedResource resource2 = createResource(3.f, resource1, 7u);
+        transfers.prepareResourceForSending(resource1, receiver);
+
+        const ManagedResource sent = transfers.prepareResourceForSending(resource2, receiver);
+        const DeltaUpdateResource* update = AsUpdate(sent);
+        EXPECT_TRUE(update->requiresBaseResource());
+        EXPECT_EQ(resource2.getResourceObject()->getHash(), update->getHash());
+        EXPECT_EQ(resource1.getResourceObject()->getHash(), update->getTargetDeltaInfo().baseHash);
+        EXPECT_EQ(7u * sizeof(Float), update->getTargetDeltaInfo().changedDataOffset);
+        EXPECT_EQ(sizeof(Float), update->getTargetDeltaInfo().changedDataSize);
+        ASSERT_EQ(sizeof(Float), update->getResourceData()->size());
+        EXPECT_EQ(0, PlatformMemory::Compare(resource2.getResourceObject()->getResourceData()->getRawData() + 7u * sizeof(Float), update->getResourceData()->getRawData(), sizeof(Float)));
+    }
+
+    TEST_F(ADeltaResourceTransfers, sendsFullDataIfResourceSentAsChangedDataOnlyIsRequestedAgain)
+    {
+        const ManagedResource base = createResource(1.f);
+        const ManagedResource resource1 = createResource(2.f, base, 5u);
+        const ManagedResource resource2 = createResource(3.f, resource1, 7u);
+        transfers.prepareResourceForSending(resource1, receiver);
+        EXPECT_TRUE(AsUpdate(transfers.prepareResourceForSending(resource2, receiver))->requiresBaseResource());
+
+        EXPECT_FALSE(AsUpdate(transfers.prepareResourceForSending(resource2, receiver))->requiresBaseResource());
+    }
+
+    TEST_F(ADeltaResourceTransfers, sendsFullDataIfOtherUpdateOnSameBaseWasAlreadySent)
+    {
+        const ManagedResource base = createResource(1.f);
+        const ManagedResource resource1 = createResource(2.f, base, 5u);
+        const ManagedResource resource2 = createResource(3.f, resource1, 7u);
+        const ManagedResource resource3 = createResource(4.f, resource1, 9u);
+        transfers.prepareResourceForSending(resource1, receiver);
+        EXPECT_TRUE(AsUpdate(transfers.prepareResourceForSending(resource2, receiver))->requiresBaseResource());
+
+        EXPECT_FALSE(AsUpdate(transfers.prepareResourceForSending(resource3, receiver))->requiresBaseResource());
+    }
+
+    TEST_F(ADeltaResourceTransfers, tracksSentResourcesPerReceiver)
+    {
+        const ManagedResource base = createResource(1.f);
+        const ManagedResource resource1 = createResource(2.f, base, 5u);
+        const ManagedResource resource2 = createResource(3.f, resource1, 7u);
+        transfers.prepareResourceForSending(resource1, receiver);
+
+        EXPECT_FALSE(AsUpdate(transfers.prepareResourceForSending(resource2, otherReceiver))->requiresBaseResource());
+        EXPECT_TRUE(AsUpdate(transfers.prepareResourceForSending(resource2, receiver))->requiresBaseResource());
+    }
+
+    TEST_F(ADeltaResourceTransfers, forgetsSentResourcesWhenReceiverDisconnects)
+    {
+        const ManagedResource base = createResource(1.f);
+        const ManagedResource resource1 = createResource(2.f, base, 5u);
+        const ManagedResource resource2 = createResource(3.f, resource1, 7u);
+        transfers.prepareResourceForSending(resource1, receiver);
+        transfers.participantHasDisconnected(receiver);
+
+        EXPECT_FALSE(AsUpdate(transfers.prepareResourceForSending(resource2, receiver))->requiresBaseResource());
+    }
+
+    TEST_F(ADeltaResourceTransfers, reconstructsResourceFromBaseAndChangedData)
+    {
+        const ManagedResource base = createResource(1.f);
+        const ManagedResource resource1 = createResource(2.f, base, 5u);
+        const ManagedResource resource2 = createResource(3.f, resource1, 7u);
+        transfers.prepareResourceForSending(resource1, receiver);
+        const ManagedResource sent = transfers.prepareResourceForSending(resource2, receiver);
+
+        std::unique_ptr<IResource> reconstructed(DeltaResourceTransfers::CreateTargetResource(*AsUpdate(sent), resource1.getResourceObject()));
+        ASSERT_TRUE(reconstructed != nullptr);
+        EXPECT_EQ(EResourceType_VertexArray, reconstructed->getTypeID());
+        EXPECT_EQ(resource2.getResourceObject()->getHash(), reconstructed->getHash());
+        EXPECT_EQ(ElementCount, reconstructed->convertTo<ArrayResource>()->getElementCount());
+        ExpectSameData(*resource2.getResourceObject(), *reconstructed);
+    }
+
+    TEST_F(ADeltaResourceTransfers, reconstructsResourceFromFullDataWithoutBase)
+    {
+        const ManagedResource base = createResource(1.f);
+        const ManagedResource resource = createResource(2.f, base, 5u);
+        const ManagedResource sent = transfers.prepareResourceForSending(resource, receiver);
+
+        std::unique_ptr<IResource> reconstructed(DeltaResourceTransfers::CreateTargetResource(*AsUpdate(sent), nullptr));
+        ASSERT_TRUE(reconstructed != nullptr);
+        EXPECT_EQ(resource.getResourceObject()->getHash(), reconstructed->getHash());
+        ExpectSameData(*resource.getResourceObject(), *reconstructed);
+    }
+
+    TEST_F(ADeltaResourceTransfers, failsToReconstructResourceWithoutMatchingBase)
+    {
+        const ManagedResource base = createResource(1.f);
+        const ManagedResource resource1 = createResource(2.f, base, 5u);
+        const ManagedResource resource2 = createResource(3.f, resource1, 7u);
+        transfers.prepareResourceForSending(resource1, receiver);
+        const ManagedResource sent = transfers.prepareResourceForSending(resource2, receiver);
+
+        EXPECT_EQ(nullptr, DeltaResourceTransfers::CreateTargetResource(*AsUpdate(sent), nullptr));
+        EXPECT_EQ(nullptr, DeltaResourceTransfers::CreateTargetResource(*AsUpdate(sent), base.getResourceObject()));
+    }
+
+    TEST_F(ADeltaResourceTransfers, reconstructsResourceHashedWithChunkedHashingThresholdOfSender)
+    {
+        const ManagedResource base = createResource(1.f);
+        const ManagedResource resource1 = createResource(2.f, base, 5u);
+        const ManagedResource resource2 = createResource(3.f, resource1, 7u);
+        const_cast<IResource*>(resource2.getResourceObject())->convertTo<ResourceBase>()->setChunkedHashingThreshold(16u);
+        transfers.prepareResourceForSending(resource1, receiver);
+        const ManagedResource sent = transfers.prepareResourceForSending(resource2, receiver);
+        EXPECT_EQ(16u, AsUpdate(sent)->getTargetChunkedHashingThreshold());
+
+        std::unique_ptr<IResource> reconstructed(DeltaResourceTransfers::CreateTargetResource(*AsUpdate(sent), resource1.getResourceObject()));
+        ASSERT_TRUE(reconstructed != nullptr);
+        EXPECT_EQ(16u, reconstructed->getChunkedHashingThreshold());
+        EXPECT_EQ(resource2.getResourceObject()->getHash(), reconstructed->getHash());
+        ExpectSameData(*resource2.getResourceObject(), *reconstructed);
+    }
+
+    TEST_F(ADeltaResourceTransfers, failsToReconstructResourceIfBaseDataDoesNotMatchBaseHash)
+    {
+        const ManagedResource base = createResource(1.f);
+        const ManagedResource resource1 = createResource(2.f, base, 5u);
+        const ManagedResource resource2 = createResource(3.f, resource1, 7u);
+        transfers.prepareResourceForSending(resource1, receiver);
+        const ManagedResource sent = transfers.prepareResourceForSending(resource2, receiver);
+
+        // same hash as base of update, but data of other resource
+        ArrayResource corruptedBase(EResourceType_VertexArray, ElementCount, EDataType_Float, base.getResourceObject()->getResourceData()->getRawData(), ResourceCacheFlag(0u), "res");
+        corruptedBase.setResourceData(base.getResourceObject()->getResourceData(), resource1.getResourceObject()->getHash());
+
+        EXPECT_EQ(nullptr, DeltaResourceTransfers::CreateTargetResource(*AsUpdate(sent), &corruptedBase));
+    }
+
+    TEST_F(ADeltaResourceTransfers, failsToReconstructResourceWithElementCountNotMatchingDataSize)
+    {
+        const ManagedResource base = createResource(1.f);
+        const ManagedResource resource = createResource(2.f, base, 5u);
+        const ManagedResource sent = transfers.prepareResourceForSending(resource, receiver);
+
+        const std::unique_ptr<IResource> update = CreateUpdateWithModifiedMetadata(*AsUpdate(sent), 2u * sizeof(UInt32), ElementCount + 1u);
+        EXPECT_EQ(nullptr, DeltaResourceTransfers::CreateTargetResource(*update->convertTo<DeltaUpdateResource>(), nullptr));
+    }
+
+    TEST_F(ADeltaResourceTransfers, failsToReconstructResourceWithInvalidElementType)
+    {
+        const ManagedResource base = createResource(1.f);
+        const ManagedResource resource = createResource(2.f, base, 5u);
+        const ManagedResource sent = transfers.prepareResourceForSending(resource, receiver);
+
+        const std::unique_ptr<IResource> update = CreateUpdateWithModifiedMetadata(*AsUpdate(sent), sizeof(UInt32), EDataType_NUMBER_OF_ELEMENTS);
+        EXPECT_EQ(nullptr, DeltaResourceTransfers::CreateTargetResource(*update->convertTo<DeltaUpdateResource>(), nullptr));
+    }
+
+    TEST_F(ADeltaResourceTransfers, failsToReconstructResourceWithTruncatedMetadata)
+    {
+        const ManagedResource base = createResource(1.f);
+        const ManagedResource resource = createResource(2.f, base, 5u);
+        const ManagedResource sent = transfers.prepareResourceForSending(resource, receiver);
+
+        const std::unique_ptr<IResource> update = CreateUpdateWithModifiedMetadata(*AsUpdate(sent), 3u * sizeof(UInt32), sizeof(UInt32));
+        EXPECT_EQ(nullptr, DeltaResourceTransfers::CreateTargetResource(*update->convertTo<DeltaUpdateResource>(), nullptr));
+    }
+
+    TEST_F(ADeltaResourceTransfers, retainsResourcesWithinBudgetAndEvictsOldestFirst)
+    {
+        DeltaResourceTransfers transfersWithBudget(2u * ElementCount * sizeof(Float));
+        const ManagedResource resource1 = createResource(1.f);
+        const ManagedResource resource2 = createResource(2.f);
+        const ManagedResource resource3 = createResource(3.f);
+
+        transfersWithBudget.retainResource(resource1, receiver);
+        transfersWithBudget.retainResource(resource2, receiver);
+        EXPECT_EQ(resource1.getResourceObject(), transfersWithBudget.getRetainedResource(resource1.getResourceObject()->getHash()));
+        EXPECT_EQ(resource2.getResourceObject(), transfersWithBudget.getRetainedResource(resource2.getResourceObject()->getHash()));
+
+        transfersWithBudget.retainResource(resource3, receiver);
+        EXPECT_EQ(nullptr, transfersWithBudget.getRetainedResource(resource1.getResourceObject()->getHash()));
+        EXPECT_EQ(resource2.getResourceObject(), transfersWithBudget.getRetainedResource(resource2.getResourceObject()->getHash()));
+        EXPECT_EQ(resource3.getResourceObject(), transfersWithBudget.getRetainedResource(resource3.getResourceObject()->getHash()));
+        EXPECT_EQ(2u * ElementCount * sizeof(Float), transfersWithBudget.getRetainedBytes());
+    }
+
+    TEST_F(ADeltaResourceTransfers, doesNotRetainResourceLargerThanBudget)
+    {
+        DeltaResourceTransfers transfersWithBudget(ElementCount * sizeof(Float) - 1u);
+        const ManagedResource resource = createResource(1.f);
+        transfersWithBudget.retainResource(resource, receiver);
+        EXPECT_EQ(nullptr, transfersWithBudget.getRetainedResource(resource.getResourceObject()->getHash()));
+        EXPECT_EQ(0u, transfersWithBudget.getRetainedBytes());
+    }
+
+    TEST_F(ADeltaResourceTransfers, retainsSameResourceOnlyOnce)
+    {
+        const ManagedResource resource = createResource(1.f);
+        transfers.retainResource(resource, receiver);
+        transfers.retainResource(resource, receiver);
+        EXPECT_EQ(ElementCount * sizeof(Float), transfers.getRetainedBytes());
+    }
+
+    TEST_F(ADeltaResourceTransfers, releasesRetainedResource)
+    {
+        const ManagedResource resource1 = createResource(1.f);
+        const ManagedResource resource2 = createResource(2.f);
+        transfers.retainResource(resource1, receiver);
+        transfers.retainResource(resource2, receiver);
+
+        transfers.releaseRetainedResource(resource1.getResourceObject()->getHash());
+        EXPECT_EQ(nullptr, transfers.getRetainedResource(resource1.getResourceObject()->getHash()));
+        EXPECT_EQ(resource2.getResourceObject(), transfers.getRetainedResource(resource2.getResourceObject()->getHash()));
+        EXPECT_EQ(ElementCount * sizeof(Float), transfers.getRetainedBytes());
+    }
+
+    TEST_F(ADeltaResourceTransfers, releasesRetainedResourcesOfDisconnectedProvider)
+    {
+        const ManagedResource resource1 = createResource(1.f);
+        const ManagedResource resource2 = createResource(2.f);
+        transfers.retainResource(resource1, receiver);
+        transfers.retainResource(resource2, otherReceiver);
+
+        transfers.participantHasDisconnected(receiver);
+        EXPECT_EQ(nullptr, transfers.getRetainedResource(resource1.getResourceObject()->getHash()));
+        EXPECT_EQ(resource2.getResourceObject(), transfers.getRetainedResource(resource2.getResourceObject()->getHash()));
+        EXPECT_EQ(ElementCount * sizeof(Float), transfers.getRetainedBytes());
+    }
+
+    TEST_F(ADeltaResourceTransfers, releasesSizesOfRetainedResourcesOfDisconnectedProviderOnly)
+    {
+        const Float smallData[1] = { 1.f };
+        const Float largeData[10] = { 2.f };
+        const ManagedResource smallResource(*new ArrayResource(EResourceType_VertexArray, 1u, EDataType_Float, reinterpret_cast<const Byte*>(smallData), ResourceCacheFlag(0u), "small"), deleter);
+        const ManagedResource largeResource(*new ArrayResource(EResourceType_VertexArray, 10u, EDataType_Float, reinterpret_cast<const Byte*>(largeData), ResourceCacheFlag(0u), "large"), deleter);
+        const ManagedResource resource = createResource(3.f);
+
+        // resources of disconnected provider interleaved with resources of different size which stay retained
+        transfers.retainResource(smallResource, receiver);
+        transfers.retainResource(resource, otherReceiver);
+        transfers.retainResource(largeResource, receiver);
+        EXPECT_EQ((1u + 10u + ElementCount) * sizeof(Float), transfers.getRetainedBytes());
+
+        transfers.participantHasDisconnected(receiver);
+        EXPECT_EQ(nullptr, transfers.getRetainedResource(smallResource.getResourceObject()->getHash()));
+        EXPECT_EQ(nullptr, transfers.getRetainedResource(largeResource.getResourceObject()->getHash()));
+        EXPECT_EQ(resource.getResourceObject(), transfers.getRetainedResource(resource.getResourceObject()->getHash()));
+        EXPECT_EQ(ElementCount * sizeof(Float), transfers.getRetainedBytes());
+
+        transfers.participantHasDisconnected(otherReceiver);
+        EXPECT_EQ(0u, transfers.getRetainedBytes());
+    }
+}
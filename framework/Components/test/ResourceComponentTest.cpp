@@ -12,6 +12,7 @@
 #include "ResourceMock.h"
 #include "gmock/gmock-generated-actions.h"
 #include "Resource/ArrayResource.h"
+#include "Resource/DeltaUpdateResource.h"
 #include "Utils/BinaryFileOutputStream.h"
 #include "Utils/BinaryOutputStream.h"
 #include "PlatformAbstraction/PlatformMemory.h"
@@ -219,6 +220,27 @@ namespace ramses_internal
             return{ dataVec[0], hash };
         }
 
+        static ArrayResource* CreateTestResourceAsDeltaOf(float someValue, const ManagedResource& base)
+        {
+            ArrayResource* resource = static_cast<ArrayResource*>(CreateTestResource(someValue));
+            // only last vertex component differs from base
+            resource->setDeltaInfo(ResourceDeltaInfo(base.getResourceObject()->getHash(), 8u * sizeof(Float), sizeof(Float)));
+            return resource;
+        }
+
+        ManagedResourceVector transferResource(ResourceComponent& provider, const Guid& providerID, const ResourceContentHash& hash)
+        {
+            ManagedResourceVector sentResources;
+            EXPECT_CALL(communicationSystem, sendResources(m_myID, _)).WillOnce(DoAll(SaveArg<1>(&sentResources), Return(true)));
+            provider.handleRequestResources({ hash }, 0u, m_myID);
+
+            for (const auto& data : ResourceSerializationTestHelper::ConvertResourcesToResourceDataVector(sentResources, std::numeric_limits<UInt32>::max()))
+            {
+                localResourceComponent.handleSendResource(ByteArrayView(data.data(), static_cast<UInt32>(data.size())), providerID);
+            }
+            return sentResources;
+        }
+
     protected:
         DelayedSingleTaskExecutor executor;
         StrictMock<CommunicationSystemMock> communicationSystem;
@@ -1047,6 +1069,74 @@ namespace ramses_internal
     }
 
 
+    TEST_F(AResourceComponentTest, ReconstructsResourceFromDeltaUpdateOnPreviouslyReceivedResource)
+    {
+        const Guid providerID(true);
+        ResourceComponent provider(executor, providerID, communicationSystem, connectionStatusUpdateNotifier, statistics, frameworkLock);
+        const ManagedResource base = provider.manageResource(*CreateTestResource(0.f));
+        const ManagedResource resource1 = provider.manageResource(*CreateTestResourceAsDeltaOf(1.f, base));
+        const ManagedResource resource2 = provider.manageResource(*CreateTestResourceAsDeltaOf(2.f, resource1));
+        const ResourceContentHash hash1 = resource1.getResourceObject()->getHash();
+        const ResourceContentHash hash2 = resource2.getResourceObject()->getHash();
+
+        localResourceComponent.newParticipantHasConnected(providerID);
+        const RequesterID requesterID(1);
+        EXPECT_CALL(communicationSystem, sendRequestResources(providerID, _));
+        localResourceComponent.requestResourceAsynchronouslyFromFramework({ hash1, hash2 }, requesterID, providerID);
+
+        // receiver does not hold base of first resource in chain, therefore full data is sent
+        ManagedResourceVector sentResources = transferResource(provider, providerID, hash1);
+        ASSERT_EQ(1u, sentResources.size());
+        ASSERT_EQ(EResourceType_DeltaUpdate, sentResources[0].getResourceObject()->getTypeID());
+        EXPECT_FALSE(sentResources[0].getResourceObject()->convertTo<DeltaUpdateResource>()->requiresBaseResource());
+        ManagedResourceVector arrivedResources = localResourceComponent.popArrivedResources(requesterID);
+        ASSERT_EQ(1u, arrivedResources.size());
+        EXPECT_EQ(hash1, arrivedResources[0].getResourceObject()->getHash());
+        arrivedResources.clear();
+
+        sentResources = transferResource(provider, providerID, hash2);
+        ASSERT_EQ(1u, sentResources.size());
+        ASSERT_EQ(EResourceType_DeltaUpdate, sentResources[0].getResourceObject()->getTypeID());
+        EXPECT_TRUE(sentResources[0].getResourceObject()->convertTo<DeltaUpdateResource>()->requiresBaseResource());
+        EXPECT_EQ(sizeof(Float), sentResources[0].getResourceObject()->getDecompressedDataSize());
+        arrivedResources = localResourceComponent.popArrivedResources(requesterID);
+        ASSERT_EQ(1u, arrivedResources.size());
+        ASSERT_EQ(EResourceType_VertexArray, arrivedResources[0].getResourceObject()->getTypeID());
+        ResourceSerializationTestHelper::CompareTypedResources(*resource2.getResourceObject()->convertTo<ArrayResource>(), *arrivedResources[0].getResourceObject()->convertTo<ArrayResource>());
+    }
+
+    TEST_F(AResourceComponentTest, RequestsFullResourceAgainIfDeltaUpdateCannotBeApplied)
+    {
+        const Guid providerID(true);
+        ResourceComponent provider(executor, providerID, communicationSystem, connectionStatusUpdateNotifier, statistics, frameworkLock);
+        const ManagedResource base = provider.manageResource(*CreateTestResource(0.f));
+        const ManagedResource resource1 = provider.manageResource(*CreateTestResourceAsDeltaOf(1.f, base));
+        const ManagedResource resource2 = provider.manageResource(*CreateTestResourceAsDeltaOf(2.f, resource1));
+        const ResourceContentHash hash2 = resource2.getResourceObject()->getHash();
+
+        // provider assumes receiver holds first resource, which never arrived
+        EXPECT_CALL(communicationSystem, sendResources(m_myID, _)).WillOnce(Return(true));
+        provider.handleRequestResources({ resource1.getResourceObject()->getHash() }, 0u, m_myID);
+
+        localResourceComponent.newParticipantHasConnected(providerID);
+        const RequesterID requesterID(1);
+        EXPECT_CALL(communicationSystem, sendRequestResources(providerID, ResourceContentHashVector{ hash2 })).Times(2);
+        localResourceComponent.requestResourceAsynchronouslyFromFramework({ hash2 }, requesterID, providerID);
+
+        ManagedResourceVector sentResources = transferResource(provider, providerID, hash2);
+        ASSERT_EQ(1u, sentResources.size());
+        EXPECT_TRUE(sentResources[0].getResourceObject()->convertTo<DeltaUpdateResource>()->requiresBaseResource());
+        EXPECT_TRUE(localResourceComponent.popArrivedResources(requesterID).empty());
+        EXPECT_TRUE(localResourceComponent.hasRequestForResource(hash2, requesterID));
+
+        sentResources = transferResource(provider, providerID, hash2);
+        ASSERT_EQ(1u, sentResources.size());
+        EXPECT_FALSE(sentResources[0].getResourceObject()->convertTo<DeltaUpdateResource>()->requiresBaseResource());
+        const ManagedResourceVector arrivedResources = localResourceComponent.popArrivedResources(requesterID);
+        ASSERT_EQ(1u, arrivedResources.size());
+        ResourceSerializationTestHelper::CompareTypedResources(*resource2.getResourceObject()->convertTo<ArrayResource>(), *arrivedResources[0].getResourceObject()->convertTo<ArrayResource>());
+    }
+
     TEST_F(AResourceComponentTest, SendsRemoteRequestToProviderIfAvailabilityUnknown)
     {
         Guid providerID(true);
@@ -294,4 +294,120 @@ namespace ramses_internal
         EXPECT_EQ(String("Some effect with a name"), loadedResource->getName());
         delete loadedResource;
     }
+
+    TEST(ResourcePersistation, writesCompressedResourcesAndResourceReferencedMultipleTimesOnlyOnce)
+    {
+        NiceMock<ManagedResourceDeleterCallbackMock> managedResourceDeleter;
+        ResourceDeleterCallingCallback dummyManagedResourceCallback(managedResourceDeleter);
+
+        // big enough to be compressed
+        const UInt32 vertexCount = 1000u;
+        Vector<Float> data(vertexCount * 3u);
+        for (UInt32 i = 0u; i < data.size(); ++i)
+        {
+            data[i] = static_cast<Float>(i % 10u);
+        }
+        ArrayResource res(EResourceType_VertexArray, vertexCount, EDataType_Vector3F, reinterpret_cast<const Byte*>(data.data()), ResourceCacheFlag(0u), "res1");
+        ArrayResource res2(EResourceType_IndexArray, vertexCount * 2u, EDataType_UInt16, reinterpret_cast<const Byte*>(data.data()), ResourceCacheFlag(0u), "res2");
+        ManagedResource managedRes(res, dummyManagedResourceCallback);
+        ManagedResource managedRes2(res2, dummyManagedResourceCallback);
+
+        ManagedResourceVector resources;
+        resources.push_back(managedRes);
+        resources.push_back(managedRes2);
+        resources.push_back(managedRes);
+
+        File tempFile("onDemandResourceFile");
+        {
+            BinaryFileOutputStream out(tempFile);
+            ResourcePersistation::WriteNamedResourcesWithTOCToStream(out, resources, true);
+        }
+        EXPECT_TRUE(res.isCompressedAvailable());
+        EXPECT_TRUE(res2.isCompressedAvailable());
+
+        ResourceTableOfContents loadedTOC;
+        BinaryFileInputStream instream(tempFile);
+        ASSERT_TRUE(loadedTOC.readTOCPosAndTOCFromStream(instream));
+        EXPECT_EQ(2u, loadedTOC.getFileContents().count());
+
+        const ResourceFileEntry& entry = loadedTOC.getEntryForHash(res.getHash());
+        const ResourceFileEntry& entry2 = loadedTOC.getEntryForHash(res2.getHash());
+        EXPECT_EQ(res.getCompressedDataSize(), entry.resourceInfo.compressedSize);
+        EXPECT_EQ(res2.getCompressedDataSize(), entry2.resourceInfo.compressedSize);
+
+        // resources are stored right after TOC and after each other
+        UInt offsetAfterTOC = 0u;
+        instream.getPos(offsetAfterTOC);
+        EXPECT_EQ(offsetAfterTOC, std::min(entry.offsetInBytes, entry2.offsetInBytes));
+        EXPECT_EQ(std::max(entry.offsetInBytes, entry2.offsetInBytes), std::min(entry.offsetInBytes, entry2.offsetInBytes) + (entry.offsetInBytes < entry2.offsetInBytes ? entry.sizeInBytes : entry2.sizeInBytes));
+
+        IResource* loadedResource = ResourcePersistation::RetrieveResourceFromStream(instream, entry);
+        loadedResource->decompress();
+        ASSERT_EQ(data.size() * sizeof(Float), loadedResource->getDecompressedDataSize());
+        EXPECT_EQ(0, PlatformMemory::Compare(data.data(), loadedResource->getResourceData()->getRawData(), data.size() * sizeof(Float)));
+        delete loadedResource;
+    }
+
+    TEST(ResourcePersistation, copiesResourcesToOtherResourceFileAsTheyAreStoredOrCompressesUncompressedOnesIfRequested)
+    {
+        NiceMock<ManagedResourceDeleterCallbackMock> managedResourceDeleter;
+        ResourceDeleterCallingCallback dummyManagedResourceCallback(managedResourceDeleter);
+
+        // big enough to be compressed
+        const UInt32 vertexCount = 1000u;
+        Vector<Float> data(vertexCount * 3u);
+        for (UInt32 i = 0u; i < data.size(); ++i)
+        {
+            data[i] = static_cast<Float>(i % 10u);
+        }
+        ArrayResource res(EResourceType_VertexArray, vertexCount, EDataType_Vector3F, reinterpret_cast<const Byte*>(data.data()), ResourceCacheFlag(0u), "res1");
+        ManagedResource managedRes(res, dummyManagedResourceCallback);
+        ManagedResourceVector resources;
+        resources.push_back(managedRes);
+
+        File inputFile("onDemandResourceFile");
+        {
+            BinaryFileOutputStream out(inputFile);
+            ResourcePersistation::WriteNamedResourcesWithTOCToStream(out, resources, false);
+        }
+        ResourceTableOfContents inputTOC;
+        BinaryFileInputStream instream(inputFile);
+        ASSERT_TRUE(inputTOC.readTOCPosAndTOCFromStream(instream));
+        const ResourceFileEntry& inputEntry = inputTOC.getEntryForHash(res.getHash());
+        ASSERT_EQ(0u, inputEntry.resourceInfo.compressedSize);
+
+        File copyFile("onDemandResourceFileCopy");
+        File compressedCopyFile("onDemandResourceFileCompressedCopy");
+        ResourceTableOfContents copyTOC;
+        ResourceTableOfContents compressedCopyTOC;
+        {
+            BinaryFileOutputStream out(copyFile);
+            BinaryFileOutputStream compressedOut(compressedCopyFile);
+            const UInt32 dummyHeader = 123u;
+            out << dummyHeader;
+            ResourcePersistation::CopyResourceToStream(instream, inputEntry, out, copyTOC, false);
+            ResourcePersistation::CopyResourceToStream(instream, inputEntry, compressedOut, compressedCopyTOC, true);
+        }
+
+        const ResourceFileEntry& copyEntry = copyTOC.getEntryForHash(res.getHash());
+        EXPECT_EQ(sizeof(UInt32), copyEntry.offsetInBytes);
+        EXPECT_EQ(inputEntry.sizeInBytes, copyEntry.sizeInBytes);
+        EXPECT_EQ(inputEntry.resourceInfo, copyEntry.resourceInfo);
+
+        const ResourceFileEntry& compressedCopyEntry = compressedCopyTOC.getEntryForHash(res.getHash());
+        EXPECT_EQ(0u, compressedCopyEntry.offsetInBytes);
+        EXPECT_NE(0u, compressedCopyEntry.resourceInfo.compressedSize);
+        EXPECT_LT(compressedCopyEntry.sizeInBytes, inputEntry.sizeInBytes);
+
+        for (const auto& copy : { std::make_pair(&copyFile, &copyEntry), std::make_pair(&compressedCopyFile, &compressedCopyEntry) })
+        {
+            BinaryFileInputStream copyInstream(*copy.first);
+            IResource* loadedResource = ResourcePersistation::RetrieveResourceFromStream(copyInstream, *copy.second);
+            loadedResource->decompress();
+            EXPECT_EQ(res.getHash(), loadedResource->getHash());
+            ASSERT_EQ(data.size() * sizeof(Float), loadedResource->getDecompressedDataSize());
+            EXPECT_EQ(0, PlatformMemory::Compare(data.data(), loadedResource->getResourceData()->getRawData(), data.size() * sizeof(Float)));
+            delete loadedResource;
+        }
+    }
 }
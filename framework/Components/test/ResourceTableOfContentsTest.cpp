@@ -83,6 +83,58 @@ namespace ramses_internal
         ASSERT_EQ(sizeInBytesB, loadedEntryB.sizeInBytes);
     }
 
+    TEST(AResourceTableOfContents, canWriteAndReadOffsetsBeyond32Bit)
+    {
+        File tempFile("onDemandResourceFile");
+
+        ResourceTableOfContents toc;
+        const ResourceContentHash hash(4711u, 0);
+        const ResourceInfo resourceInfo(EResourceType_IndexArray, hash, 22u, 11u);
+        const UInt64 offsetInBytes = 0x123456789ull;
+        toc.registerContents(resourceInfo, offsetInBytes, 456u);
+
+        {
+            BinaryFileOutputStream outstream(tempFile);
+            toc.writeTOCToStream(outstream);
+        }
+
+        BinaryFileInputStream instream(tempFile);
+        ResourceTableOfContents loadedTOC;
+        ASSERT_TRUE(loadedTOC.readTOCPosAndTOCFromStream(instream));
+        ASSERT_TRUE(loadedTOC.containsResource(hash));
+        EXPECT_EQ(offsetInBytes, loadedTOC.getEntryForHash(hash).offsetInBytes);
+        EXPECT_EQ(456u, loadedTOC.getEntryForHash(hash).sizeInBytes);
+    }
+
+    TEST(AResourceTableOfContents, canReadLegacyTableOfContentsWith32BitOffsets)
+    {
+        File tempFile("onDemandResourceFile");
+
+        const ResourceContentHash hashA(4711u, 0);
+        const ResourceContentHash hashB(234678u, 0);
+        {
+            BinaryFileOutputStream outstream(tempFile);
+            outstream << static_cast<uint32_t>(2u);
+            outstream << static_cast<UInt32>(EResourceType_IndexArray) << hashA << static_cast<UInt32>(22u) << static_cast<UInt32>(11u) << static_cast<UInt32>(123u) << static_cast<UInt32>(456u);
+            outstream << static_cast<UInt32>(EResourceType_Texture2D) << hashB << static_cast<UInt32>(44u) << static_cast<UInt32>(33u) << static_cast<UInt32>(987u) << static_cast<UInt32>(654u);
+        }
+
+        BinaryFileInputStream instream(tempFile);
+        ResourceTableOfContents loadedTOC;
+        ASSERT_TRUE(loadedTOC.readTOCPosAndTOCFromStream(instream));
+        ASSERT_EQ(2u, loadedTOC.getFileContents().count());
+
+        const ResourceFileEntry& loadedEntryA = loadedTOC.getEntryForHash(hashA);
+        EXPECT_EQ(ResourceInfo(EResourceType_IndexArray, hashA, 22u, 11u), loadedEntryA.resourceInfo);
+        EXPECT_EQ(123u, loadedEntryA.offsetInBytes);
+        EXPECT_EQ(456u, loadedEntryA.sizeInBytes);
+
+        const ResourceFileEntry& loadedEntryB = loadedTOC.getEntryForHash(hashB);
+        EXPECT_EQ(ResourceInfo(EResourceType_Texture2D, hashB, 44u, 33u), loadedEntryB.resourceInfo);
+        EXPECT_EQ(987u, loadedEntryB.offsetInBytes);
+        EXPECT_EQ(654u, loadedEntryB.sizeInBytes);
+    }
+
     TEST(AResourceTableOfContents, returnFalseIfReadingTableOfContentsWasNotSuccessfull)
     {
         File tempFile("EmptyOrWrongResourceFile");
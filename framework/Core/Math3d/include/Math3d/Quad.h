@@ -24,6 +24,8 @@ namespace ramses_internal
         bool operator!=(const Quad& q) const;
 
         Quad getBoundingQuad(const Quad& other) const;
+        Quad getIntersectingQuad(const Quad& other) const;
+        bool isEmpty() const;
         Int32 getArea() const;
 
         Int32 x = 0;
@@ -48,6 +48,24 @@ namespace ramses_internal
         return { minX, minY, maxX - minX, maxY - minY };
     }
 
+    Quad Quad::getIntersectingQuad(const Quad& other) const
+    {
+        const auto minX = std::max(x, other.x);
+        const auto minY = std::max(y, other.y);
+        const auto maxX = std::min(x + width, other.x + other.width);
+        const auto maxY = std::min(y + height, other.y + other.height);
+
+        if (maxX <= minX || maxY <= minY)
+            return {};
+
+        return { minX, minY, maxX - minX, maxY - minY };
+    }
+
+    bool Quad::isEmpty() const
+    {
+        return width <= 0 || height <= 0;
+    }
+
     Int32 Quad::getArea() const
     {
         return width * height;
@@ -128,4 +128,40 @@ namespace ramses_internal
         const auto result2 = quad2.getBoundingQuad(quad1);
         EXPECT_EQ(result, result2);
     }
+
+    TEST(QuadTest, IsEmptyIfWidthOrHeightIsZero)
+    {
+        EXPECT_TRUE(Quad().isEmpty());
+        EXPECT_TRUE(Quad(1, 2, 0, 4).isEmpty());
+        EXPECT_TRUE(Quad(1, 2, 3, 0).isEmpty());
+        EXPECT_FALSE(Quad(1, 2, 3, 4).isEmpty());
+    }
+
+    TEST(QuadTest, CanGetIntersectingQuad_OverlappingQuads)
+    {
+        const Quad quad1{ 1, 1, 3, 3 };
+        const Quad quad2{ 2, 0, 5, 2 };
+        const auto result = quad1.getIntersectingQuad(quad2);
+        EXPECT_EQ(Quad(2, 1, 2, 1), result);
+
+        const auto result2 = quad2.getIntersectingQuad(quad1);
+        EXPECT_EQ(result, result2);
+    }
+
+    TEST(QuadTest, CanGetIntersectingQuad_OneInsideOther)
+    {
+        const Quad quad1{ 1, 1, 2, 2 };
+        const Quad quad2{ 0, 0, 5, 5 };
+        EXPECT_EQ(quad1, quad1.getIntersectingQuad(quad2));
+        EXPECT_EQ(quad1, quad2.getIntersectingQuad(quad1));
+    }
+
+    TEST(QuadTest, IntersectingQuadOfNonOverlappingQuadsIsEmpty)
+    {
+        const Quad quad1{ 1, 1, 3, 3 };
+        const Quad quad2{ 4, 0, 5, 5 };
+        EXPECT_TRUE(quad1.getIntersectingQuad(quad2).isEmpty());
+        EXPECT_TRUE(quad2.getIntersectingQuad(quad1).isEmpty());
+        EXPECT_TRUE(quad1.getIntersectingQuad(Quad()).isEmpty());
+    }
 }
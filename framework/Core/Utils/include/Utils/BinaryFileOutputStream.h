@@ -25,6 +25,7 @@ namespace ramses_internal
 
         IOutputStream& write(const void* data, const UInt32 size) override;
 
+        EStatus seek(Int numberOfBytesToSeek, EFileSeekOrigin origin);
         EStatus getPos(UInt& position);
         EStatus getState() const;
 
@@ -58,6 +59,13 @@ namespace ramses_internal
         return *this;
     }
 
+    inline
+    ramses_internal::EStatus BinaryFileOutputStream::seek(Int numberOfBytesToSeek, EFileSeekOrigin origin)
+    {
+        m_state = m_file.seek(numberOfBytesToSeek, origin);
+        return m_state;
+    }
+
     inline
     ramses_internal::EStatus BinaryFileOutputStream::getPos(UInt& position)
     {
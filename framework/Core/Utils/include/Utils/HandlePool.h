@@ -12,15 +12,44 @@
 #include "Common/TypedMemoryHandle.h"
 #include "Collections/Vector.h"
 #include <limits>
+#include <algorithm>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 namespace ramses_internal
 {
+    // Occupancy of handles is kept as bitset, one bit per handle. Released handles are put on a free list
+    // and reused first, iteration over acquired handles skips whole words of free handles.
+    // Handles acquired explicitly while on the free list stay there as stale entries, the list is compacted
+    // once they make up half of it and a handle is never listed twice.
     template <typename HANDLE>
     class HandlePool
     {
     public:
         typedef HANDLE handle_type;
 
+        // iterates acquired handles in ascending order, releasing the current handle while iterating is allowed
+        class const_iterator
+        {
+        public:
+            HANDLE              operator*() const;
+            const_iterator&     operator++();
+            Bool                operator==(const const_iterator& other) const;
+            Bool                operator!=(const const_iterator& other) const;
+
+        private:
+            friend class HandlePool;
+            const_iterator(const UInt64* words, UInt32 wordCount, UInt32 wordIndex);
+            void skipFreeWords();
+
+            const UInt64* m_words;
+            UInt32        m_wordCount;
+            UInt32        m_wordIndex;
+            UInt64        m_remainingBits;
+        };
+
         explicit HandlePool(UInt32 size = 0);
 
         // Creation/Deletion
@@ -32,19 +61,38 @@ namespace ramses_internal
         UInt32                          size() const;
         void                            resize(UInt32 size);
 
+        const_iterator                  begin() const;
+        const_iterator                  end() const;
+
         static HANDLE                   InvalidMemoryHandle();
 
     protected:
         HANDLE acquireInternal(MemoryHandle handle);
+        MemoryHandle findFreeHandle() const;
+        UInt64 getValidBitsMask(UInt32 wordIndex) const;
+        Bool isOnFreeList(MemoryHandle handle) const;
+        void setOnFreeList(MemoryHandle handle, Bool onList);
+        void compactFreeList();
+
+        static UInt32 CountTrailingZeros(UInt64 bits);
+
+        static const UInt32 BitsPerWord = 64u;
 
-        Vector<UInt8> m_handlePool;
-        MemoryHandle  m_nextAvailableHint;
-        UInt32        m_numberOfAcquired;
+        Vector<UInt64>       m_occupancy;
+        Vector<UInt64>       m_freeListMembership;
+        Vector<MemoryHandle> m_freeHandles;
+        UInt32               m_staleFreeHandles;
+        UInt32               m_size;
+        MemoryHandle         m_nextAvailableHint;
+        UInt32               m_numberOfAcquired;
     };
 
     template <typename HANDLE>
     HandlePool<HANDLE>::HandlePool(UInt32 size)
-        : m_handlePool(size)
+        : m_occupancy((size + BitsPerWord - 1u) / BitsPerWord)
+        , m_freeListMembership((size + BitsPerWord - 1u) / BitsPerWord)
+        , m_staleFreeHandles(0u)
+        , m_size(size)
         , m_nextAvailableHint(0u)
         , m_numberOfAcquired(0u)
     {
@@ -53,62 +101,145 @@ namespace ramses_internal
     template <typename HANDLE>
     HANDLE HandlePool<HANDLE>::acquire(HANDLE handle)
     {
-        const UInt poolSize = m_handlePool.size();
         if (handle == InvalidMemoryHandle())
         {
-            if (m_numberOfAcquired < poolSize)
+            if (m_numberOfAcquired < m_size)
             {
-                // search for available handle
-                for (MemoryHandle i = m_nextAvailableHint; i < poolSize; ++i)
-                {
-                    if (m_handlePool[i] == 0)
-                    {
-                        return acquireInternal(i);
-                    }
-                }
-                for (MemoryHandle i = 0u; i < m_nextAvailableHint && i < poolSize; ++i)
+                // free list can contain handles which were acquired explicitly meanwhile
+                while (!m_freeHandles.empty())
                 {
-                    if (m_handlePool[i] == 0)
+                    const MemoryHandle freeHandle = m_freeHandles.back();
+                    m_freeHandles.pop_back();
+                    setOnFreeList(freeHandle, false);
+                    if (!isAcquired(HANDLE(freeHandle)))
                     {
-                        return acquireInternal(i);
+                        return acquireInternal(freeHandle);
                     }
+                    assert(m_staleFreeHandles > 0u);
+                    --m_staleFreeHandles;
                 }
+
+                // free handles which were never released, e.g. after resize
+                return acquireInternal(findFreeHandle());
             }
 
             // allocate and acquire new handle
-            const MemoryHandle newHandle = static_cast<MemoryHandle>(m_handlePool.size());
-            m_handlePool.resize(newHandle + 1u);
+            const MemoryHandle newHandle = m_size;
+            resize(newHandle + 1u);
             return acquireInternal(newHandle);
         }
 
         const MemoryHandle memoryHandle = AsMemoryHandle(handle);
-        if (memoryHandle >= poolSize)
+        if (memoryHandle >= m_size)
         {
             resize(memoryHandle + 1u);
         }
 
+        if (isOnFreeList(memoryHandle))
+        {
+            ++m_staleFreeHandles;
+            if (2u * m_staleFreeHandles >= m_freeHandles.size())
+            {
+                const HANDLE acquiredHandle = acquireInternal(memoryHandle);
+                compactFreeList();
+                return acquiredHandle;
+            }
+        }
+
         return acquireInternal(memoryHandle);
     }
 
+    template <typename HANDLE>
+    void HandlePool<HANDLE>::compactFreeList()
+    {
+        const auto newEnd = std::remove_if(m_freeHandles.begin(), m_freeHandles.end(), [this](MemoryHandle freeHandle)
+        {
+            if (!isAcquired(HANDLE(freeHandle)))
+            {
+                return false;
+            }
+            setOnFreeList(freeHandle, false);
+            return true;
+        });
+        m_freeHandles.resize(static_cast<std::size_t>(newEnd - m_freeHandles.begin()));
+        m_staleFreeHandles = 0u;
+    }
+
+    template <typename HANDLE>
+    Bool HandlePool<HANDLE>::isOnFreeList(MemoryHandle handle) const
+    {
+        return ((m_freeListMembership[handle / BitsPerWord] >> (handle % BitsPerWord)) & 1u) != 0u;
+    }
+
+    template <typename HANDLE>
+    void HandlePool<HANDLE>::setOnFreeList(MemoryHandle handle, Bool onList)
+    {
+        const UInt64 bit = UInt64(1u) << (handle % BitsPerWord);
+        if (onList)
+        {
+            m_freeListMembership[handle / BitsPerWord] |= bit;
+        }
+        else
+        {
+            m_freeListMembership[handle / BitsPerWord] &= ~bit;
+        }
+    }
+
     template <typename HANDLE>
     HANDLE HandlePool<HANDLE>::acquireInternal(MemoryHandle handle)
     {
-        assert(handle < m_handlePool.size());
-        assert(m_handlePool[handle] == 0);
+        assert(handle < m_size);
+        assert(!isAcquired(HANDLE(handle)));
         m_nextAvailableHint = handle + 1u;
-        m_handlePool[handle] = std::numeric_limits<UInt8>::max();
+        m_occupancy[handle / BitsPerWord] |= UInt64(1u) << (handle % BitsPerWord);
         ++m_numberOfAcquired;
         return HANDLE(handle);
     }
 
+    template <typename HANDLE>
+    MemoryHandle HandlePool<HANDLE>::findFreeHandle() const
+    {
+        const UInt32 wordCount = static_cast<UInt32>(m_occupancy.size());
+        const UInt32 startWord = (m_nextAvailableHint < m_size ? m_nextAvailableHint : 0u) / BitsPerWord;
+        for (UInt32 i = 0u; i < wordCount; ++i)
+        {
+            const UInt32 wordIndex = (startWord + i) % wordCount;
+            const UInt64 freeBits = ~m_occupancy[wordIndex] & getValidBitsMask(wordIndex);
+            if (freeBits != 0u)
+            {
+                return wordIndex * BitsPerWord + CountTrailingZeros(freeBits);
+            }
+        }
+
+        assert(false);
+        return m_size;
+    }
+
+    template <typename HANDLE>
+    UInt64 HandlePool<HANDLE>::getValidBitsMask(UInt32 wordIndex) const
+    {
+        const UInt32 bitsInWord = m_size - wordIndex * BitsPerWord;
+        return bitsInWord >= BitsPerWord ? std::numeric_limits<UInt64>::max() : (UInt64(1u) << bitsInWord) - 1u;
+    }
+
     template <typename HANDLE>
     void HandlePool<HANDLE>::release(HANDLE handle)
     {
         const MemoryHandle memoryHandle = AsMemoryHandle(handle);
-        assert(memoryHandle < m_handlePool.size());
-        assert(m_handlePool[memoryHandle] != 0);
-        m_handlePool[memoryHandle] = 0;
-        m_nextAvailableHint = memoryHandle;
+        assert(memoryHandle < m_size);
+        assert(isAcquired(handle));
+        m_occupancy[memoryHandle / BitsPerWord] &= ~(UInt64(1u) << (memoryHandle % BitsPerWord));
+        if (isOnFreeList(memoryHandle))
+        {
+            // stale entry becomes valid again
+            assert(m_staleFreeHandles > 0u);
+            --m_staleFreeHandles;
+        }
+        else
+        {
+            m_freeHandles.push_back(memoryHandle);
+            setOnFreeList(memoryHandle, true);
+        }
         assert(m_numberOfAcquired > 0u);
         --m_numberOfAcquired;
     }
@@ -117,7 +248,7 @@ namespace ramses_internal
     Bool HandlePool<HANDLE>::isAcquired(HANDLE handle) const
     {
         const MemoryHandle memoryHandle = AsMemoryHandle(handle);
-        return (memoryHandle < m_handlePool.size()) && (m_handlePool[memoryHandle] != 0);
+        return (memoryHandle < m_size) && ((m_occupancy[memoryHandle / BitsPerWord] >> (memoryHandle % BitsPerWord)) & 1u) != 0u;
     }
 
 
@@ -130,13 +261,30 @@ namespace ramses_internal
     template <typename HANDLE>
     UInt32 HandlePool<HANDLE>::size() const
     {
-        return static_cast<UInt32>(m_handlePool.size());
+        return m_size;
     }
 
     template <typename HANDLE>
     void HandlePool<HANDLE>::resize(UInt32 size)
     {
-        m_handlePool.resize(size);
+        // pools never shrink
+        assert(size >= m_size);
+        m_occupancy.resize((size + BitsPerWord - 1u) / BitsPerWord);
+        m_freeListMembership.resize(m_occupancy.size());
+        m_size = size;
+    }
+
+    template <typename HANDLE>
+    typename HandlePool<HANDLE>::const_iterator HandlePool<HANDLE>::begin() const
+    {
+        return const_iterator(m_occupancy.data(), static_cast<UInt32>(m_occupancy.size()), 0u);
+    }
+
+    template <typename HANDLE>
+    typename HandlePool<HANDLE>::const_iterator HandlePool<HANDLE>::end() const
+    {
+        const UInt32 wordCount = static_cast<UInt32>(m_occupancy.size());
+        return const_iterator(m_occupancy.data(), wordCount, wordCount);
     }
 
     template <typename HANDLE>
@@ -144,6 +292,67 @@ namespace ramses_internal
     {
         return std::numeric_limits<HANDLE>::max();
     }
+
+    template <typename HANDLE>
+    UInt32 HandlePool<HANDLE>::CountTrailingZeros(UInt64 bits)
+    {
+        assert(bits != 0u);
+#if defined(_MSC_VER)
+        unsigned long index = 0u;
+        _BitScanForward64(&index, bits);
+        return static_cast<UInt32>(index);
+#else
+        return static_cast<UInt32>(__builtin_ctzll(bits));
+#endif
+    }
+
+    template <typename HANDLE>
+    HandlePool<HANDLE>::const_iterator::const_iterator(const UInt64* words, UInt32 wordCount, UInt32 wordIndex)
+        : m_words(words)
+        , m_wordCount(wordCount)
+        , m_wordIndex(wordIndex)
+        , m_remainingBits(wordIndex < wordCount ? words[wordIndex] : 0u)
+    {
+        skipFreeWords();
+    }
+
+    template <typename HANDLE>
+    void HandlePool<HANDLE>::const_iterator::skipFreeWords()
+    {
+        while (m_remainingBits == 0u && m_wordIndex < m_wordCount)
+        {
+            ++m_wordIndex;
+            m_remainingBits = (m_wordIndex < m_wordCount ? m_words[m_wordIndex] : 0u);
+        }
+    }
+
+    template <typename HANDLE>
+    HANDLE HandlePool<HANDLE>::const_iterator::operator*() const
+    {
+        assert(m_remainingBits != 0u);
+        return HANDLE(m_wordIndex * BitsPerWord + CountTrailingZeros(m_remainingBits));
+    }
+
+    template <typename HANDLE>
+    typename HandlePool<HANDLE>::const_iterator& HandlePool<HANDLE>::const_iterator::operator++()
+    {
+        // clear lowest set bit
+        m_remainingBits &= m_remainingBits - 1u;
+        skipFreeWords();
+        return *this;
+    }
+
+    template <typename HANDLE>
+    Bool HandlePool<HANDLE>::const_iterator::operator==(const const_iterator& other) const
+    {
+        return m_wordIndex == other.m_wordIndex && m_remainingBits == other.m_remainingBits;
+    }
+
+    template <typename HANDLE>
+    Bool HandlePool<HANDLE>::const_iterator::operator!=(const const_iterator& other) const
+    {
+        return !(*this == other);
+    }
 }
 
 #endif
@@ -20,6 +20,7 @@ namespace ramses_internal
     public:
         typedef OBJECTTYPE object_type;
         typedef HANDLE handle_type;
+        typedef typename HandlePool<HANDLE>::const_iterator const_iterator;
 
         explicit MemoryPool(UInt32 size = 0);
 
@@ -32,6 +33,10 @@ namespace ramses_internal
         UInt32                          getActualCount() const;
         Bool                            isAllocated(HANDLE handle) const;
 
+        // Iteration over handles of allocated objects
+        const_iterator                  begin() const;
+        const_iterator                  end() const;
+
         // Access to actual memory
         OBJECTTYPE*                     getMemory(HANDLE handle);
         const OBJECTTYPE*               getMemory(HANDLE handle) const;
@@ -137,6 +142,20 @@ namespace ramses_internal
     {
         return m_handlePool.isAcquired(handle);
     }
+
+    template <typename OBJECTTYPE, typename HANDLE>
+    inline
+    typename MemoryPool<OBJECTTYPE, HANDLE>::const_iterator MemoryPool<OBJECTTYPE, HANDLE>::begin() const
+    {
+        return m_handlePool.begin();
+    }
+
+    template <typename OBJECTTYPE, typename HANDLE>
+    inline
+    typename MemoryPool<OBJECTTYPE, HANDLE>::const_iterator MemoryPool<OBJECTTYPE, HANDLE>::end() const
+    {
+        return m_handlePool.end();
+    }
 }
 
 #endif
@@ -9,9 +9,7 @@
 #ifndef RAMSES_MEMORYPOOLEXPLICIT_H
 #define RAMSES_MEMORYPOOLEXPLICIT_H
 
-#include "Common/TypedMemoryHandle.h"
-#include "Collections/Vector.h"
-#include <limits>
+#include "Utils/HandlePool.h"
 
 namespace ramses_internal
 {
@@ -21,6 +19,7 @@ namespace ramses_internal
     public:
         typedef OBJECTTYPE object_type;
         typedef HANDLE handle_type;
+        typedef typename HandlePool<HANDLE>::const_iterator const_iterator;
 
         explicit MemoryPoolExplicit(UInt32 size = 0);
 
@@ -32,6 +31,10 @@ namespace ramses_internal
         UInt32                          getTotalCount() const;
         Bool                            isAllocated(HANDLE handle) const;
 
+        // Iteration over handles of allocated objects
+        const_iterator                  begin() const;
+        const_iterator                  end() const;
+
         // Access to actual memory
         OBJECTTYPE*                     getMemory(HANDLE handle);
         const OBJECTTYPE*               getMemory(HANDLE handle) const;
@@ -41,7 +44,7 @@ namespace ramses_internal
         static_assert(std::is_move_constructible<OBJECTTYPE>::value && std::is_move_assignable<OBJECTTYPE>::value, "OBJECTTYPE must be movable");
     protected:
         Vector<OBJECTTYPE> m_memoryPool;
-        Vector<UInt8>      m_handlePool;
+        HandlePool<HANDLE> m_handlePool;
     };
 
     template <typename OBJECTTYPE, typename HANDLE>
@@ -68,10 +71,10 @@ namespace ramses_internal
     {
         const MemoryHandle memoryHandle = AsMemoryHandle(handle);
         assert(memoryHandle < m_memoryPool.size());
-        assert(m_handlePool[memoryHandle] == 0);
+        assert(!m_handlePool.isAcquired(handle));
 
         m_memoryPool[memoryHandle] = OBJECTTYPE();
-        m_handlePool[memoryHandle] = std::numeric_limits<UInt8>::max();
+        m_handlePool.acquire(handle);
 
         return handle;
     }
@@ -79,18 +82,15 @@ namespace ramses_internal
     template <typename OBJECTTYPE, typename HANDLE>
     inline void MemoryPoolExplicit<OBJECTTYPE, HANDLE>::release(HANDLE handle)
     {
-        const MemoryHandle memoryHandle = AsMemoryHandle(handle);
-        assert(memoryHandle < m_handlePool.size());
-        assert(m_handlePool[memoryHandle] != 0);
-        m_handlePool[memoryHandle] = 0;
+        assert(AsMemoryHandle(handle) < m_handlePool.size());
+        m_handlePool.release(handle);
     }
 
     template <typename OBJECTTYPE, typename HANDLE>
     inline Bool MemoryPoolExplicit<OBJECTTYPE, HANDLE>::isAllocated(HANDLE handle) const
     {
-        const MemoryHandle memoryHandle = AsMemoryHandle(handle);
-        assert(memoryHandle < m_handlePool.size());
-        return m_handlePool[memoryHandle] != 0;
+        assert(AsMemoryHandle(handle) < m_handlePool.size());
+        return m_handlePool.isAcquired(handle);
     }
 
     template <typename OBJECTTYPE, typename HANDLE>
@@ -98,7 +98,7 @@ namespace ramses_internal
     {
         const MemoryHandle memoryHandle = AsMemoryHandle(handle);
         assert(memoryHandle < m_memoryPool.size());
-        assert(m_handlePool[memoryHandle] != 0);
+        assert(m_handlePool.isAcquired(handle));
 
         return &m_memoryPool[memoryHandle];
     }
@@ -108,7 +108,7 @@ namespace ramses_internal
     {
         const MemoryHandle memoryHandle = AsMemoryHandle(handle);
         assert(memoryHandle < m_memoryPool.size());
-        assert(m_handlePool[memoryHandle] != 0);
+        assert(m_handlePool.isAcquired(handle));
 
         return &m_memoryPool[memoryHandle];
     }
@@ -118,6 +118,18 @@ namespace ramses_internal
     {
         return static_cast<UInt32>(m_memoryPool.size());
     }
+
+    template <typename OBJECTTYPE, typename HANDLE>
+    inline typename MemoryPoolExplicit<OBJECTTYPE, HANDLE>::const_iterator MemoryPoolExplicit<OBJECTTYPE, HANDLE>::begin() const
+    {
+        return m_handlePool.begin();
+    }
+
+    template <typename OBJECTTYPE, typename HANDLE>
+    inline typename MemoryPoolExplicit<OBJECTTYPE, HANDLE>::const_iterator MemoryPoolExplicit<OBJECTTYPE, HANDLE>::end() const
+    {
+        return m_handlePool.end();
+    }
 }
 
 #endif
@@ -0,0 +1,51 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_PARALLELJOBS_H
+#define RAMSES_PARALLELJOBS_H
+
+#include "PlatformAbstraction/PlatformTypes.h"
+#include <functional>
+#include <atomic>
+
+namespace ramses_internal
+{
+    // Executes independent jobs, identified by their index, on the calling thread and on worker threads which are
+    // started on first use and shared by all following calls. Jobs are taken by threads in any order, calls return
+    // after all jobs were executed. Calling thread always takes part in executing, therefore nested calls from
+    // within a job make progress even if all workers are busy.
+    class ParallelJobs
+    {
+    public:
+        class JobQueue
+        {
+        public:
+            explicit JobQueue(UInt32 jobCount);
+            JobQueue(const JobQueue&) = delete;
+            JobQueue& operator=(const JobQueue&) = delete;
+
+            // returns false if all jobs were taken already
+            Bool takeJob(UInt32& jobIndexOut);
+
+        private:
+            const UInt32 m_jobCount;
+            std::atomic<UInt32> m_nextJob;
+        };
+
+        using Job = std::function<void(UInt32 jobIndex)>;
+        using Worker = std::function<void(JobQueue& jobs)>;
+
+        // threadCount 0 uses all hardware threads, used thread count is limited by job count
+        static void Execute(UInt32 jobCount, const Job& job, UInt32 threadCount = 0u);
+
+        // worker is called at most once per participating thread and takes jobs itself, for jobs sharing per thread state
+        static void ExecuteWorkers(UInt32 jobCount, const Worker& worker, UInt32 threadCount = 0u);
+    };
+}
+
+#endif
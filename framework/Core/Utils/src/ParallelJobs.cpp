@@ -0,0 +1,189 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Utils/ParallelJobs.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <vector>
+#include <memory>
+#include <algorithm>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        class WorkerPool
+        {
+        public:
+            WorkerPool()
+            {
+                // calling thread of ParallelJobs takes part in executing, so one hardware thread less is needed
+                const UInt32 workerCount = std::max(std::thread::hardware_concurrency(), 1u) - 1u;
+                m_workers.reserve(workerCount);
+                for (UInt32 i = 0u; i < workerCount; ++i)
+                {
+                    m_workers.emplace_back(&WorkerPool::run, this);
+                }
+            }
+
+            ~WorkerPool()
+            {
+                {
+                    std::lock_guard<std::mutex> guard(m_lock);
+                    m_stopped = true;
+                }
+                m_tasksAvailable.notify_all();
+                for (auto& worker : m_workers)
+                {
+                    worker.join();
+                }
+            }
+
+            UInt32 getWorkerCount() const
+            {
+                return static_cast<UInt32>(m_workers.size());
+            }
+
+            void enqueue(const std::function<void()>& task, UInt32 count)
+            {
+                {
+                    std::lock_guard<std::mutex> guard(m_lock);
+                    m_tasks.insert(m_tasks.end(), count, task);
+                }
+                m_tasksAvailable.notify_all();
+            }
+
+        private:
+            void run()
+            {
+                std::unique_lock<std::mutex> guard(m_lock);
+                for (;;)
+                {
+                    m_tasksAvailable.wait(guard, [this]() { return m_stopped || !m_tasks.empty(); });
+                    if (m_stopped)
+                    {
+                        return;
+                    }
+
+                    const std::function<void()> task = std::move(m_tasks.front());
+                    m_tasks.pop_front();
+                    guard.unlock();
+                    task();
+                    guard.lock();
+                }
+            }
+
+            std::vector<std::thread> m_workers;
+            std::deque<std::function<void()>> m_tasks;
+            std::mutex m_lock;
+            std::condition_variable m_tasksAvailable;
+            Bool m_stopped = false;
+        };
+
+        WorkerPool& GetWorkerPool()
+        {
+            static WorkerPool pool;
+            return pool;
+        }
+
+        // shared with enqueued tasks which might be picked up by a worker only after call returned
+        struct WorkerCall
+        {
+            WorkerCall(UInt32 jobCount, const ParallelJobs::Worker& worker_)
+                : jobs(jobCount)
+                , worker(worker_)
+            {
+            }
+
+            ParallelJobs::JobQueue jobs;
+            const ParallelJobs::Worker& worker;
+            std::mutex lock;
+            std::condition_variable workersFinished;
+            UInt32 runningWorkers = 0u;
+            Bool finished = false;
+        };
+    }
+
+    ParallelJobs::JobQueue::JobQueue(UInt32 jobCount)
+        : m_jobCount(jobCount)
+        , m_nextJob(0u)
+    {
+    }
+
+    Bool ParallelJobs::JobQueue::takeJob(UInt32& jobIndexOut)
+    {
+        if (m_nextJob.load(std::memory_order_relaxed) >= m_jobCount)
+        {
+            return false;
+        }
+
+        jobIndexOut = m_nextJob++;
+        return jobIndexOut < m_jobCount;
+    }
+
+    void ParallelJobs::Execute(UInt32 jobCount, const Job& job, UInt32 threadCount)
+    {
+        ExecuteWorkers(jobCount, [&job](JobQueue& jobs)
+        {
+            UInt32 jobIndex = 0u;
+            while (jobs.takeJob(jobIndex))
+            {
+                job(jobIndex);
+            }
+        }, threadCount);
+    }
+
+    void ParallelJobs::ExecuteWorkers(UInt32 jobCount, const Worker& worker, UInt32 threadCount)
+    {
+        if (jobCount == 0u)
+        {
+            return;
+        }
+
+        const UInt32 requestedThreadCount = (threadCount == 0u) ? std::max(std::thread::hardware_concurrency(), 1u) : threadCount;
+        const UInt32 usedThreadCount = std::min(requestedThreadCount, jobCount);
+        if (usedThreadCount == 1u)
+        {
+            JobQueue jobs(jobCount);
+            worker(jobs);
+            return;
+        }
+
+        WorkerPool& pool = GetWorkerPool();
+        const UInt32 helperCount = std::min(usedThreadCount - 1u, pool.getWorkerCount());
+        const std::shared_ptr<WorkerCall> call = std::make_shared<WorkerCall>(jobCount, worker);
+        pool.enqueue([call]()
+        {
+            {
+                std::lock_guard<std::mutex> guard(call->lock);
+                if (call->finished)
+                {
+                    return;
+                }
+                ++call->runningWorkers;
+            }
+
+            call->worker(call->jobs);
+
+            std::lock_guard<std::mutex> guard(call->lock);
+            if (--call->runningWorkers == 0u)
+            {
+                call->workersFinished.notify_one();
+            }
+        }, helperCount);
+
+        worker(call->jobs);
+
+        // all jobs were taken, wait only for workers still executing one of them
+        std::unique_lock<std::mutex> guard(call->lock);
+        call->finished = true;
+        call->workersFinished.wait(guard, [&call]() { return call->runningWorkers == 0u; });
+    }
+}
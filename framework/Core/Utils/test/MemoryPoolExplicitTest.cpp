@@ -135,4 +135,22 @@ namespace ramses_internal
         pool.preallocateSize(3);
         EXPECT_EQ(9u, pool.getTotalCount());
     }
+
+    TYPED_TEST(AMemoryPoolExplicit, iteratesOnlyAllocatedHandles)
+    {
+        const typename TypeParam::handle_type otherObject = this->memoryPool.allocate(static_cast<typename TypeParam::handle_type>(this->InitialSize - 1u));
+
+        std::vector<typename TypeParam::handle_type> handles;
+        for (const auto handle : this->memoryPool)
+        {
+            handles.push_back(handle);
+        }
+
+        const std::vector<typename TypeParam::handle_type> expectedHandles = { this->allocatedObject, otherObject };
+        EXPECT_EQ(expectedHandles, handles);
+
+        this->memoryPool.release(this->allocatedObject);
+        this->memoryPool.release(otherObject);
+        EXPECT_TRUE(this->memoryPool.begin() == this->memoryPool.end());
+    }
 }
@@ -10,6 +10,7 @@
 #include "gtest/gtest.h"
 #include "Utils/MemoryPool.h"
 #include "ErrorTestUtils.h"
+#include <set>
 
 using namespace testing;
 
@@ -170,4 +171,128 @@ namespace ramses_internal
         EXPECT_EQ(6u, pool.getTotalCount());
         EXPECT_EQ(2u, pool.getActualCount());
     }
+
+    TYPED_TEST(AMemoryPool, reusesLastReleasedHandleFirst)
+    {
+        const typename TypeParam::handle_type handle1 = this->memoryPool.allocate();
+        const typename TypeParam::handle_type handle2 = this->memoryPool.allocate();
+        this->memoryPool.release(handle1);
+        this->memoryPool.release(handle2);
+
+        EXPECT_EQ(handle2, this->memoryPool.allocate());
+        EXPECT_EQ(handle1, this->memoryPool.allocate());
+    }
+
+    TYPED_TEST(AMemoryPool, doesNotReuseReleasedHandleWhichWasAllocatedExplicitlyMeanwhile)
+    {
+        const typename TypeParam::handle_type handle = this->memoryPool.allocate();
+        this->memoryPool.release(handle);
+        this->memoryPool.allocate(handle);
+
+        const typename TypeParam::handle_type otherHandle = this->memoryPool.allocate();
+        EXPECT_NE(handle, otherHandle);
+        EXPECT_TRUE(this->memoryPool.isAllocated(otherHandle));
+        EXPECT_EQ(3u, this->memoryPool.getActualCount());
+    }
+
+    TYPED_TEST(AMemoryPool, reusesReleasedHandleOnlyOnceAfterRepeatedExplicitReallocation)
+    {
+        const typename TypeParam::handle_type handle = this->memoryPool.allocate();
+        for (UInt32 i = 0u; i < 10u; ++i)
+        {
+            this->memoryPool.release(handle);
+            this->memoryPool.allocate(handle);
+        }
+        this->memoryPool.release(handle);
+
+        EXPECT_EQ(handle, this->memoryPool.allocate());
+        const typename TypeParam::handle_type otherHandle = this->memoryPool.allocate();
+        EXPECT_NE(handle, otherHandle);
+        EXPECT_TRUE(this->memoryPool.isAllocated(otherHandle));
+        EXPECT_EQ(3u, this->memoryPool.getActualCount());
+    }
+
+    class HandlePoolWithFreeList : public HandlePool<UInt32>
+    {
+    public:
+        explicit HandlePoolWithFreeList(UInt32 size)
+            : HandlePool<UInt32>(size)
+        {
+        }
+
+        UInt32 getFreeListSize() const
+        {
+            return static_cast<UInt32>(m_freeHandles.size());
+        }
+    };
+
+    TEST(AHandlePool, doesNotAccumulateStaleFreeListEntriesOnExplicitReallocation)
+    {
+        HandlePoolWithFreeList pool(16u);
+        for (UInt32 i = 0u; i < 16u; ++i)
+        {
+            pool.acquire();
+        }
+        for (UInt32 i = 0u; i < 16u; ++i)
+        {
+            pool.release(i);
+        }
+        EXPECT_EQ(16u, pool.getFreeListSize());
+
+        for (UInt32 round = 0u; round < 100u; ++round)
+        {
+            for (UInt32 i = 0u; i < 16u; ++i)
+            {
+                pool.acquire(i);
+            }
+            EXPECT_GE(8u, pool.getFreeListSize());
+            for (UInt32 i = 0u; i < 16u; ++i)
+            {
+                pool.release(i);
+            }
+            EXPECT_EQ(16u, pool.getFreeListSize());
+        }
+
+        std::set<UInt32> reacquiredHandles;
+        for (UInt32 i = 0u; i < 16u; ++i)
+        {
+            reacquiredHandles.insert(pool.acquire());
+        }
+        EXPECT_EQ(16u, reacquiredHandles.size());
+        EXPECT_EQ(16u, pool.size());
+    }
+
+    TYPED_TEST(AMemoryPool, iteratesOnlyAllocatedHandlesInAscendingOrder)
+    {
+        const typename TypeParam::handle_type handle1 = this->memoryPool.allocate(static_cast<typename TypeParam::handle_type>(63u));
+        const typename TypeParam::handle_type handle2 = this->memoryPool.allocate(static_cast<typename TypeParam::handle_type>(64u));
+        const typename TypeParam::handle_type handle3 = this->memoryPool.allocate(static_cast<typename TypeParam::handle_type>(this->InitialSize + 100u));
+
+        std::vector<typename TypeParam::handle_type> handles;
+        for (const auto handle : this->memoryPool)
+        {
+            handles.push_back(handle);
+        }
+
+        const std::vector<typename TypeParam::handle_type> expectedHandles = { this->allocatedObject, handle1, handle2, handle3 };
+        EXPECT_EQ(expectedHandles, handles);
+    }
+
+    TYPED_TEST(AMemoryPool, canReleaseCurrentHandleWhileIterating)
+    {
+        for (UInt32 i = 0u; i < this->InitialSize; ++i)
+        {
+            this->memoryPool.allocate();
+        }
+
+        UInt32 iterated = 0u;
+        for (const auto handle : this->memoryPool)
+        {
+            this->memoryPool.release(handle);
+            ++iterated;
+        }
+        EXPECT_EQ(this->InitialSize + 1u, iterated);
+        EXPECT_EQ(0u, this->memoryPool.getActualCount());
+        EXPECT_TRUE(this->memoryPool.begin() == this->memoryPool.end());
+    }
 }
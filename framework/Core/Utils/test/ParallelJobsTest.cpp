@@ -0,0 +1,87 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Utils/ParallelJobs.h"
+#include "gtest/gtest.h"
+#include <thread>
+#include <vector>
+
+namespace ramses_internal
+{
+    TEST(AParallelJobs, executesNothingWithoutJobs)
+    {
+        UInt32 calls = 0u;
+        ParallelJobs::Execute(0u, [&calls](UInt32) { ++calls; });
+        ParallelJobs::ExecuteWorkers(0u, [&calls](ParallelJobs::JobQueue&) { ++calls; });
+        EXPECT_EQ(0u, calls);
+    }
+
+    TEST(AParallelJobs, executesEveryJobExactlyOnce)
+    {
+        for (UInt32 threadCount : { 0u, 1u, 2u, 16u })
+        {
+            SCOPED_TRACE(threadCount);
+            std::vector<std::atomic<UInt32>> executions(1000u);
+            for (auto& count : executions)
+            {
+                count = 0u;
+            }
+
+            ParallelJobs::Execute(static_cast<UInt32>(executions.size()), [&executions](UInt32 jobIndex) { ++executions[jobIndex]; }, threadCount);
+
+            for (const auto& count : executions)
+            {
+                EXPECT_EQ(1u, count);
+            }
+        }
+    }
+
+    TEST(AParallelJobs, executesAllJobsOnCallingThreadIfSingleThreadRequested)
+    {
+        const std::thread::id callingThread = std::this_thread::get_id();
+        UInt32 jobsOnOtherThreads = 0u;
+        ParallelJobs::Execute(100u, [&](UInt32)
+        {
+            if (std::this_thread::get_id() != callingThread)
+            {
+                ++jobsOnOtherThreads;
+            }
+        }, 1u);
+        EXPECT_EQ(0u, jobsOnOtherThreads);
+    }
+
+    TEST(AParallelJobs, callsWorkerAtMostOncePerThreadAndWorkersTakeAllJobs)
+    {
+        const UInt32 threadCount = 4u;
+        std::atomic<UInt32> workerCalls(0u);
+        std::atomic<UInt32> executedJobs(0u);
+        ParallelJobs::ExecuteWorkers(1000u, [&](ParallelJobs::JobQueue& jobs)
+        {
+            ++workerCalls;
+            UInt32 jobIndex = 0u;
+            while (jobs.takeJob(jobIndex))
+            {
+                ++executedJobs;
+            }
+        }, threadCount);
+
+        EXPECT_GE(threadCount, workerCalls);
+        EXPECT_LE(1u, workerCalls);
+        EXPECT_EQ(1000u, executedJobs);
+    }
+
+    TEST(AParallelJobs, executesNestedJobs)
+    {
+        std::atomic<UInt32> executedJobs(0u);
+        ParallelJobs::Execute(16u, [&executedJobs](UInt32)
+        {
+            ParallelJobs::Execute(16u, [&executedJobs](UInt32) { ++executedJobs; });
+        });
+        EXPECT_EQ(256u, executedJobs);
+    }
+}
@@ -49,8 +49,19 @@ namespace ramses_internal
             return m_typeId;
         }
 
+        virtual const ResourceDeltaInfo& getDeltaInfo() const
+        {
+            return m_deltaInfo;
+        }
+
+        virtual UInt32 getChunkedHashingThreshold() const
+        {
+            return 0u;
+        }
+
         ResourceContentHash m_hash;
         EResourceType m_typeId;
+        ResourceDeltaInfo m_deltaInfo;
     };
 
     class ManagedResourceDeleterCallbackMock : public IManagedResourceDeleterCallback
@@ -0,0 +1,50 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_DELTAUPDATERESOURCE_H
+#define RAMSES_DELTAUPDATERESOURCE_H
+
+#include "Resource/ResourceBase.h"
+#include <vector>
+
+namespace ramses_internal
+{
+    // Transport only wrapper of a resource which was created as delta of a base resource (see ResourceDeltaInfo).
+    // Carries either only the changed data range of the target resource, to be applied on the base resource held by
+    // the receiver, or the full target data if the receiver is not known to hold the base resource. In both cases
+    // the receiver reconstructs the target resource from it. Has the hash of the target resource and the chunked
+    // hashing threshold it was calculated with, so the receiver can verify the reconstructed data.
+    class DeltaUpdateResource : public ResourceBase
+    {
+    public:
+        DeltaUpdateResource(const IResource& targetResource, Bool sendChangedDataOnly);
+
+        EResourceType getTargetTypeID() const;
+        UInt32 getTargetDataSize() const;
+        // changed data range covers whole target data if update carries full target data
+        const ResourceDeltaInfo& getTargetDeltaInfo() const;
+        Bool requiresBaseResource() const;
+        const std::vector<Byte>& getTargetMetadata() const;
+        UInt32 getTargetChunkedHashingThreshold() const;
+
+        virtual void serializeResourceMetadataToStream(IOutputStream& output) const override;
+        static IResource* CreateResourceFromMetadataStream(IInputStream& input, ResourceCacheFlag cacheFlag, const String& name);
+
+    private:
+        DeltaUpdateResource(EResourceType targetType, UInt32 targetDataSize, const ResourceDeltaInfo& targetDeltaInfo, std::vector<Byte>&& targetMetadata,
+            UInt32 targetChunkedHashingThreshold, ResourceCacheFlag cacheFlag, const String& name);
+
+        EResourceType m_targetType;
+        UInt32 m_targetDataSize;
+        ResourceDeltaInfo m_targetDeltaInfo;
+        std::vector<Byte> m_targetMetadata;
+        UInt32 m_targetChunkedHashingThreshold;
+    };
+}
+
+#endif
@@ -24,6 +24,7 @@ namespace ramses_internal
         EResourceType_Texture3D,
         EResourceType_TextureCube,
         EResourceType_Effect,
+        EResourceType_DeltaUpdate,
         EResourceType_NUMBER_OF_ELEMENTS
     };
 
@@ -35,7 +36,8 @@ namespace ramses_internal
         "EResourceType_Texture2D",
         "EResourceType_Texture3D",
         "EResourceType_TextureCube",
-        "EResourceType_Effect"
+        "EResourceType_Effect",
+        "EResourceType_DeltaUpdate"
     };
 
     ENUM_TO_STRING(EResourceType, ResourceTypeNames, EResourceType_NUMBER_OF_ELEMENTS);
@@ -29,7 +29,7 @@ namespace ramses_internal
     struct EffectInputInformation
     {
         inline EffectInputInformation();
-        inline EffectInputInformation(const String& inputName_, UInt32 elementCount_, EDataType dataType_, EFixedSemantics semantics_, EEffectInputTextureType textureType_);
+        inline EffectInputInformation(const String& inputName_, UInt32 elementCount_, EDataType dataType_, EFixedSemantics semantics_, EEffectInputTextureType textureType_, const String& uniformBlockName_ = String());
 
         inline friend bool operator==(const EffectInputInformation& a, const EffectInputInformation& b);
         inline friend bool operator!=(const EffectInputInformation& a, const EffectInputInformation& b);
@@ -40,7 +40,8 @@ namespace ramses_internal
         EFixedSemantics semantics;
         // TODO(violin/tobias) check if this can be merged into dataType
         EEffectInputTextureType textureType;
-
+        // name of the std140 uniform block the uniform is member of, empty for uniforms outside of blocks
+        String uniformBlockName;
     };
 
     typedef Vector<EffectInputInformation> EffectInputInformationVector;
@@ -52,15 +53,17 @@ namespace ramses_internal
         , dataType(EDataType_Invalid)
         , semantics(EFixedSemantics_Invalid)
         , textureType(EEffectInputTextureType_Invalid)
+        , uniformBlockName()
     {
     }
 
-    EffectInputInformation::EffectInputInformation(const String& inputName_, UInt32 elementCount_, EDataType dataType_, EFixedSemantics semantics_, EEffectInputTextureType textureType_)
+    EffectInputInformation::EffectInputInformation(const String& inputName_, UInt32 elementCount_, EDataType dataType_, EFixedSemantics semantics_, EEffectInputTextureType textureType_, const String& uniformBlockName_)
         : inputName(inputName_)
         , elementCount(elementCount_)
         , dataType(dataType_)
         , semantics(semantics_)
         , textureType(textureType_)
+        , uniformBlockName(uniformBlockName_)
     {
     }
 
@@ -70,7 +73,8 @@ namespace ramses_internal
             a.elementCount == b.elementCount &&
             a.dataType == b.dataType &&
             a.semantics == b.semantics &&
-            a.textureType == b.textureType;
+            a.textureType == b.textureType &&
+            a.uniformBlockName == b.uniformBlockName;
     }
 
     inline bool operator!=(const EffectInputInformation& a, const EffectInputInformation& b)
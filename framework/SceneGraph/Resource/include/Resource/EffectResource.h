@@ -40,6 +40,10 @@ namespace ramses_internal
         EffectResource(const EffectInputInformationVector& uniformInputs, const EffectInputInformationVector& attributeInputs,
             const String& name, UInt32 fragmentShaderOffset, ResourceCacheFlag cacheFlag);
 
+        // written instead of input count if inputs carry uniform block names, so that metadata (and hash) of effects
+        // without uniform blocks stays as it was before uniform blocks were supported
+        static const UInt32 InputVectorWithUniformBlocksMarker = 0xFFFFFFFFu;
+
         static void WriteInputVector(IOutputStream& stream, const EffectInputInformationVector& inputVector);
         static void ReadInputVector(IInputStream& stream, EffectInputInformationVector& inputVector);
 
@@ -13,6 +13,7 @@
 #include "SceneAPI/ResourceContentHash.h"
 #include "Collections/String.h"
 #include "EResourceType.h"
+#include "ResourceDeltaInfo.h"
 
 namespace ramses_internal
 {
@@ -51,6 +52,9 @@ namespace ramses_internal
         virtual Bool isDeCompressedAvailable() const = 0;
         virtual ResourceCacheFlag getCacheFlag() const = 0;
         virtual const String& getName() const = 0;
+        virtual const ResourceDeltaInfo& getDeltaInfo() const = 0;
+        // resource data of at least this size is hashed in chunks, 0 if hash is calculated without chunks
+        virtual UInt32 getChunkedHashingThreshold() const = 0;
 
         virtual void serializeResourceMetadataToStream(IOutputStream& output) const = 0;
 
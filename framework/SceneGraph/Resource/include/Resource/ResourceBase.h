@@ -145,6 +145,43 @@ namespace ramses_internal
             return m_name;
         }
 
+        const ResourceDeltaInfo& getDeltaInfo() const final override
+        {
+            return m_deltaInfo;
+        }
+
+        // marks resource as delta of given base resource, enables sending only the changed data to receivers holding the base
+        void setDeltaInfo(const ResourceDeltaInfo& deltaInfo)
+        {
+            m_deltaInfo = deltaInfo;
+        }
+
+        // Optionally data of at least threshold size is hashed in fixed size chunks on multiple threads and the chunk
+        // hashes are combined, smaller data is hashed at once. Result does not depend on number of threads, but differs
+        // from hash of data hashed at once. Disabled by default (threshold 0) so that hashes of existing resources stay
+        // the same. The threshold is kept per resource as it is part of how its hash was calculated, changing it
+        // invalidates a calculated hash.
+        static const UInt32 DefaultChunkedHashingThreshold = 4u * 1024u * 1024u;
+        static const UInt32 ChunkedHashingChunkSize = 1024u * 1024u;
+        void setChunkedHashingThreshold(UInt32 threshold)
+        {
+            if (threshold != m_chunkedHashingThreshold)
+            {
+                m_chunkedHashingThreshold = threshold;
+                if (m_data.get() != 0)
+                {
+                    m_hash = ResourceContentHash::Invalid();
+                }
+            }
+        }
+
+        UInt32 getChunkedHashingThreshold() const final override
+        {
+            return m_chunkedHashingThreshold;
+        }
+
+        static ResourceContentHash HashResourceData(const Byte* data, UInt32 size, UInt32 chunkedHashingThreshold, UInt32 threadCount = 0u);
+
     protected:
         void setHash(ResourceContentHash hash) const
         {
@@ -165,6 +202,8 @@ namespace ramses_internal
         mutable ResourceContentHash m_hash;
         ResourceCacheFlag m_cacheFlag;
         String m_name;
+        ResourceDeltaInfo m_deltaInfo;
+        UInt32 m_chunkedHashingThreshold = 0u;
     };
 }
 
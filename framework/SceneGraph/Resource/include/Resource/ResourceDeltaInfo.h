@@ -0,0 +1,44 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_RESOURCEDELTAINFO_H
+#define RAMSES_RESOURCEDELTAINFO_H
+
+#include "SceneAPI/ResourceContentHash.h"
+
+namespace ramses_internal
+{
+    // Describes a resource which equals its base resource except for a single range of its data.
+    // Both resources have the same data size, offset and size of the changed range are given in bytes.
+    struct ResourceDeltaInfo
+    {
+        ResourceDeltaInfo()
+            : changedDataOffset(0u)
+            , changedDataSize(0u)
+        {
+        }
+
+        ResourceDeltaInfo(const ResourceContentHash& baseHash_, UInt32 changedDataOffset_, UInt32 changedDataSize_)
+            : baseHash(baseHash_)
+            , changedDataOffset(changedDataOffset_)
+            , changedDataSize(changedDataSize_)
+        {
+        }
+
+        Bool isValid() const
+        {
+            return baseHash.isValid();
+        }
+
+        ResourceContentHash baseHash;
+        UInt32 changedDataOffset;
+        UInt32 changedDataSize;
+    };
+}
+
+#endif
@@ -0,0 +1,113 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Resource/DeltaUpdateResource.h"
+#include "Utils/BinaryOutputStream.h"
+
+namespace ramses_internal
+{
+    DeltaUpdateResource::DeltaUpdateResource(const IResource& targetResource, Bool sendChangedDataOnly)
+        : ResourceBase(EResourceType_DeltaUpdate, targetResource.getCacheFlag(), targetResource.getName())
+        , m_targetType(targetResource.getTypeID())
+        , m_targetDataSize(targetResource.getDecompressedDataSize())
+        , m_targetDeltaInfo(targetResource.getDeltaInfo())
+        , m_targetChunkedHashingThreshold(targetResource.getChunkedHashingThreshold())
+    {
+        assert(m_targetDeltaInfo.isValid());
+        assert(m_targetDeltaInfo.changedDataOffset + m_targetDeltaInfo.changedDataSize <= m_targetDataSize);
+        if (!sendChangedDataOnly)
+        {
+            m_targetDeltaInfo.changedDataOffset = 0u;
+            m_targetDeltaInfo.changedDataSize = m_targetDataSize;
+        }
+
+        BinaryOutputStream metadataStream;
+        targetResource.serializeResourceMetadataToStream(metadataStream);
+        m_targetMetadata.assign(metadataStream.getData(), metadataStream.getData() + metadataStream.getSize());
+
+        targetResource.decompress();
+        const Byte* targetData = targetResource.getResourceData()->getRawData();
+        setResourceData(SceneResourceData(new MemoryBlob(targetData + m_targetDeltaInfo.changedDataOffset, m_targetDeltaInfo.changedDataSize)), targetResource.getHash());
+    }
+
+    DeltaUpdateResource::DeltaUpdateResource(EResourceType targetType, UInt32 targetDataSize, const ResourceDeltaInfo& targetDeltaInfo, std::vector<Byte>&& targetMetadata,
+        UInt32 targetChunkedHashingThreshold, ResourceCacheFlag cacheFlag, const String& name)
+        : ResourceBase(EResourceType_DeltaUpdate, cacheFlag, name)
+        , m_targetType(targetType)
+        , m_targetDataSize(targetDataSize)
+        , m_targetDeltaInfo(targetDeltaInfo)
+        , m_targetMetadata(std::move(targetMetadata))
+        , m_targetChunkedHashingThreshold(targetChunkedHashingThreshold)
+    {
+    }
+
+    EResourceType DeltaUpdateResource::getTargetTypeID() const
+    {
+        return m_targetType;
+    }
+
+    UInt32 DeltaUpdateResource::getTargetDataSize() const
+    {
+        return m_targetDataSize;
+    }
+
+    const ResourceDeltaInfo& DeltaUpdateResource::getTargetDeltaInfo() const
+    {
+        return m_targetDeltaInfo;
+    }
+
+    Bool DeltaUpdateResource::requiresBaseResource() const
+    {
+        return m_targetDeltaInfo.changedDataSize < m_targetDataSize;
+    }
+
+    const std::vector<Byte>& DeltaUpdateResource::getTargetMetadata() const
+    {
+        return m_targetMetadata;
+    }
+
+    UInt32 DeltaUpdateResource::getTargetChunkedHashingThreshold() const
+    {
+        return m_targetChunkedHashingThreshold;
+    }
+
+    void DeltaUpdateResource::serializeResourceMetadataToStream(IOutputStream& output) const
+    {
+        output << static_cast<UInt32>(m_targetType);
+        output << m_targetDataSize;
+        output << m_targetDeltaInfo.baseHash;
+        output << m_targetDeltaInfo.changedDataOffset;
+        output << m_targetDeltaInfo.changedDataSize;
+        output << static_cast<UInt32>(m_targetMetadata.size());
+        output.write(m_targetMetadata.data(), static_cast<UInt32>(m_targetMetadata.size()));
+        output << m_targetChunkedHashingThreshold;
+    }
+
+    IResource* DeltaUpdateResource::CreateResourceFromMetadataStream(IInputStream& input, ResourceCacheFlag cacheFlag, const String& name)
+    {
+        UInt32 targetTypeAsUInt = 0;
+        UInt32 targetDataSize = 0;
+        ResourceDeltaInfo targetDeltaInfo;
+        UInt32 targetMetadataSize = 0;
+        UInt32 targetChunkedHashingThreshold = 0;
+
+        input >> targetTypeAsUInt;
+        input >> targetDataSize;
+        input >> targetDeltaInfo.baseHash;
+        input >> targetDeltaInfo.changedDataOffset;
+        input >> targetDeltaInfo.changedDataSize;
+        input >> targetMetadataSize;
+
+        std::vector<Byte> targetMetadata(targetMetadataSize);
+        input.read(reinterpret_cast<Char*>(targetMetadata.data()), targetMetadataSize);
+        input >> targetChunkedHashingThreshold;
+
+        // Data for resource will be filled later
+        return new DeltaUpdateResource(static_cast<EResourceType>(targetTypeAsUInt), targetDataSize, targetDeltaInfo, std::move(targetMetadata), targetChunkedHashingThreshold, cacheFlag, name);
+    }
+}
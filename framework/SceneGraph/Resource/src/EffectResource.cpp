@@ -10,6 +10,7 @@
 #include "PlatformAbstraction/PlatformMemory.h"
 #include "Utils/BinaryOutputStream.h"
 #include "Utils/BinaryInputStream.h"
+#include <algorithm>
 
 namespace ramses_internal
 {
@@ -104,12 +105,22 @@ namespace ramses_internal
 
     void EffectResource::WriteInputVector(IOutputStream& stream, const EffectInputInformationVector& inputVector)
     {
+        const Bool hasUniformBlockMembers = std::any_of(inputVector.cbegin(), inputVector.cend(), [](const EffectInputInformation& input) { return !input.uniformBlockName.empty(); });
+        if (hasUniformBlockMembers)
+        {
+            stream << InputVectorWithUniformBlocksMarker;
+        }
+
         UInt32 length = static_cast<UInt32>(inputVector.size());
         stream << length;
         for (UInt32 i = 0; i < length; ++i)
         {
             const EffectInputInformation& input = inputVector[i];
             stream << input.inputName << input.elementCount << static_cast<UInt32>(input.dataType) << static_cast<UInt32>(input.textureType) << static_cast<UInt32>(input.semantics);
+            if (hasUniformBlockMembers)
+            {
+                stream << input.uniformBlockName;
+            }
         }
     }
 
@@ -117,6 +128,12 @@ namespace ramses_internal
     {
         UInt32 length;
         stream >> length;
+        const Bool hasUniformBlockMembers = (length == InputVectorWithUniformBlocksMarker);
+        if (hasUniformBlockMembers)
+        {
+            stream >> length;
+        }
+
         inputVector.reserve(length);
         for (UInt32 i = 0; i < length; ++i)
         {
@@ -125,6 +142,10 @@ namespace ramses_internal
             UInt32 textureType;
             UInt32 semanticTmp;
             stream >> input.inputName >> input.elementCount >> typeTmp >> textureType >> semanticTmp;
+            if (hasUniformBlockMembers)
+            {
+                stream >> input.uniformBlockName;
+            }
             input.dataType = static_cast<EDataType>(typeTmp);
             input.textureType = static_cast<EEffectInputTextureType>(textureType);
             input.semantics = static_cast<EFixedSemantics>(semanticTmp);
@@ -8,10 +8,16 @@
 
 #include "Resource/ResourceBase.h"
 #include "Utils/BinaryOutputStream.h"
+#include "Utils/ParallelJobs.h"
 #include <city.h>
+#include <algorithm>
+#include <vector>
 
 namespace ramses_internal
 {
+    const UInt32 ResourceBase::DefaultChunkedHashingThreshold;
+    const UInt32 ResourceBase::ChunkedHashingChunkSize;
+
     void ResourceBase::updateHash() const
     {
         if (!m_data.get() || m_data->size() == 0)
@@ -24,19 +30,48 @@ namespace ramses_internal
         else
         {
             // hash blob
-            const char* blobToHash = reinterpret_cast<const char*>(m_data->getRawData());
-            const cityhash::uint128 cityHashBlob = cityhash::CityHash128(blobToHash, m_data->size());
+            const ResourceContentHash blobHash = HashResourceData(m_data->getRawData(), m_data->size(), m_chunkedHashingThreshold);
 
             // hash metadata
             BinaryOutputStream metaDataStream(1024);
             metaDataStream << static_cast<UInt32>(m_typeID);
             serializeResourceMetadataToStream(metaDataStream);
-            metaDataStream << cityhash::Uint128Low64(cityHashBlob);
-            metaDataStream << cityhash::Uint128High64(cityHashBlob);
+            metaDataStream << blobHash.lowPart;
+            metaDataStream << blobHash.highPart;
             const cityhash::uint128 cityHashMetadataAndBlob = cityhash::CityHash128(metaDataStream.getData(), metaDataStream.getSize());
 
             m_hash.lowPart = cityhash::Uint128Low64(cityHashMetadataAndBlob);
             m_hash.highPart = cityhash::Uint128High64(cityHashMetadataAndBlob);
         }
     }
+
+    ResourceContentHash ResourceBase::HashResourceData(const Byte* data, UInt32 size, UInt32 chunkedHashingThreshold, UInt32 threadCount)
+    {
+        const char* blobToHash = reinterpret_cast<const char*>(data);
+        if (chunkedHashingThreshold == 0u || size < chunkedHashingThreshold)
+        {
+            const cityhash::uint128 cityHashBlob = cityhash::CityHash128(blobToHash, size);
+            return ResourceContentHash(cityhash::Uint128Low64(cityHashBlob), cityhash::Uint128High64(cityHashBlob));
+        }
+
+        // chunk boundaries only depend on data size, threads take chunks in any order
+        const UInt32 chunkCount = (size + ChunkedHashingChunkSize - 1u) / ChunkedHashingChunkSize;
+        std::vector<cityhash::uint128> chunkHashes(chunkCount);
+        ParallelJobs::Execute(chunkCount, [blobToHash, size, &chunkHashes](UInt32 chunkIdx)
+        {
+            const UInt32 offset = chunkIdx * ChunkedHashingChunkSize;
+            chunkHashes[chunkIdx] = cityhash::CityHash128(blobToHash + offset, std::min(ChunkedHashingChunkSize, size - offset));
+        }, threadCount);
+
+        // combine chunk hashes in chunk order
+        BinaryOutputStream chunkHashStream(static_cast<UInt32>(chunkCount * 2u * sizeof(UInt64) + sizeof(UInt32)));
+        chunkHashStream << size;
+        for (const auto& chunkHash : chunkHashes)
+        {
+            chunkHashStream << cityhash::Uint128Low64(chunkHash);
+            chunkHashStream << cityhash::Uint128High64(chunkHash);
+        }
+        const cityhash::uint128 cityHashChunks = cityhash::CityHash128(chunkHashStream.getData(), chunkHashStream.getSize());
+        return ResourceContentHash(cityhash::Uint128Low64(cityHashChunks), cityhash::Uint128High64(cityHashChunks));
+    }
 }
@@ -25,6 +25,7 @@ namespace ramses_internal
             uniformInputs.push_back(uniformA);
             EffectInputInformation uniformB;
             uniformB.inputName = "uni B";
+            uniformB.uniformBlockName = "block";
             uniformInputs.push_back(uniformB);
 
             EffectInputInformation attributeA;
@@ -146,6 +147,46 @@ namespace ramses_internal
         EXPECT_EQ(effectBefore.getCacheFlag(), effectAfter->getCacheFlag());
     }
 
+    TEST_F(AEffectResource, differentUniformBlockOfUniformInputResultsInDifferentHash)
+    {
+        EffectInputInformationVector otherUniformInputs = uniformInputs;
+        otherUniformInputs[1].uniformBlockName = "otherBlock";
+
+        EffectResource effect1("asd", "def", uniformInputs, attributeInputs, "", ResourceCacheFlag(0u));
+        EffectResource effect2("asd", "def", otherUniformInputs, attributeInputs, "", ResourceCacheFlag(0u));
+        EXPECT_NE(effect1.getHash(), effect2.getHash());
+    }
+
+    TEST_F(AEffectResource, isEqualAfterSerializeAndDeserializeWithoutUniformBlocks)
+    {
+        uniformInputs[1].uniformBlockName = "";
+        EffectResource effectBefore("asd", "def", uniformInputs, attributeInputs, "", ResourceCacheFlag(0u));
+        ScopedPointer<EffectResource> effectAfter(serializeDeserialize(effectBefore, ""));
+        ASSERT_TRUE(effectAfter.get() != NULL);
+
+        EXPECT_EQ(effectBefore.getHash(), effectAfter->getHash());
+        EXPECT_EQ(effectBefore.getUniformInputs(), effectAfter->getUniformInputs());
+        EXPECT_EQ(effectBefore.getAttributeInputs(), effectAfter->getAttributeInputs());
+    }
+
+    TEST_F(AEffectResource, canReadMetadataWrittenWithoutUniformBlockNames)
+    {
+        // metadata layout of effects before uniform blocks were supported
+        BinaryOutputStream outStream;
+        outStream << UInt32(1u) << String("uni A") << UInt32(2u) << static_cast<UInt32>(EDataType_Float) << static_cast<UInt32>(EEffectInputTextureType_Invalid) << static_cast<UInt32>(EFixedSemantics_Invalid);
+        outStream << UInt32(0u);
+        outStream << UInt32(3u);
+
+        BinaryInputStream inStream(outStream.getData());
+        ScopedPointer<IResource> resource(EffectResource::CreateResourceFromMetadataStream(inStream, ResourceCacheFlag(0u), ""));
+        ASSERT_TRUE(resource.get() != NULL);
+
+        const EffectResource& effect = *resource->convertTo<EffectResource>();
+        ASSERT_EQ(1u, effect.getUniformInputs().size());
+        EXPECT_EQ(EffectInputInformation("uni A", 2u, EDataType_Float, EFixedSemantics_Invalid, EEffectInputTextureType_Invalid), effect.getUniformInputs()[0]);
+        EXPECT_TRUE(effect.getAttributeInputs().empty());
+    }
+
     TEST_F(AEffectResource, hasNameProvidedToSerializeAfterSerializeAndDeserialize)
     {
         EffectResource effectBefore("asd", "def", uniformInputs, attributeInputs, "some name", ResourceCacheFlag(0u));
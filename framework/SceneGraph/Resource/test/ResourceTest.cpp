@@ -9,6 +9,9 @@
 #include "framework_common_gmock_header.h"
 #include "gtest/gtest.h"
 #include "Resource/ResourceBase.h"
+#include "Utils/BinaryOutputStream.h"
+#include <city.h>
+#include <vector>
 
 namespace ramses_internal
 {
@@ -24,6 +27,30 @@ namespace ramses_internal
             virtual void serializeResourceMetadataToStream(IOutputStream&) const override {}
         };
 
+        std::vector<Byte> CreateTestData(UInt32 size)
+        {
+            std::vector<Byte> data(size);
+            UInt32 seed = 12345u;
+            for (auto& value : data)
+            {
+                seed = seed * 1103515245u + 12345u;
+                value = static_cast<Byte>(seed >> 16);
+            }
+            return data;
+        }
+
+        // hash as calculated before data was hashed in chunks
+        ResourceContentHash CalculateUnchunkedResourceHash(EResourceType typeID, const std::vector<Byte>& data)
+        {
+            const cityhash::uint128 cityHashBlob = cityhash::CityHash128(reinterpret_cast<const char*>(data.data()), data.size());
+            BinaryOutputStream metaDataStream(1024);
+            metaDataStream << static_cast<UInt32>(typeID);
+            metaDataStream << cityhash::Uint128Low64(cityHashBlob);
+            metaDataStream << cityhash::Uint128High64(cityHashBlob);
+            const cityhash::uint128 cityHashMetadataAndBlob = cityhash::CityHash128(metaDataStream.getData(), metaDataStream.getSize());
+            return ResourceContentHash(cityhash::Uint128Low64(cityHashMetadataAndBlob), cityhash::Uint128High64(cityHashMetadataAndBlob));
+        }
+
         class ResourceCompression : public ::testing::TestWithParam<IResource::CompressionLevel>
         {
         };
@@ -104,4 +131,104 @@ namespace ramses_internal
         EXPECT_EQ(noNameRes.getHash(), namedRes.getHash());
         EXPECT_EQ(noNameRes.getHash(), otherNamedRes.getHash());
     }
+
+    TEST(AResourceTest, givesUnchangedHashForLargeDataIfChunkedHashingIsNotEnabled)
+    {
+        const UInt32 dataSize = ResourceBase::DefaultChunkedHashingThreshold + ResourceBase::ChunkedHashingChunkSize;
+        const std::vector<Byte> data = CreateTestData(dataSize);
+        TestResource res(EResourceType_VertexArray, ResourceCacheFlag(0), String());
+        res.setResourceData(SceneResourceData(new MemoryBlob(data.data(), dataSize)));
+
+        EXPECT_EQ(0u, res.getChunkedHashingThreshold());
+        EXPECT_EQ(CalculateUnchunkedResourceHash(EResourceType_VertexArray, data), res.getHash());
+    }
+
+    TEST(AResourceTest, givesUnchangedHashForDataBelowChunkedHashingThreshold)
+    {
+        for (UInt32 dataSize : { 1u, 1000u, ResourceBase::DefaultChunkedHashingThreshold - 1u })
+        {
+            SCOPED_TRACE(dataSize);
+            const std::vector<Byte> data = CreateTestData(dataSize);
+            TestResource res(EResourceType_VertexArray, ResourceCacheFlag(0), String());
+            res.setChunkedHashingThreshold(ResourceBase::DefaultChunkedHashingThreshold);
+            res.setResourceData(SceneResourceData(new MemoryBlob(data.data(), dataSize)));
+
+            EXPECT_EQ(CalculateUnchunkedResourceHash(EResourceType_VertexArray, data), res.getHash());
+        }
+    }
+
+    TEST(AResourceTest, hashesDataAboveThresholdInChunksIfEnabled)
+    {
+        const UInt32 dataSize = ResourceBase::DefaultChunkedHashingThreshold;
+        const std::vector<Byte> data = CreateTestData(dataSize);
+        TestResource res(EResourceType_VertexArray, ResourceCacheFlag(0), String());
+        res.setChunkedHashingThreshold(ResourceBase::DefaultChunkedHashingThreshold);
+        res.setResourceData(SceneResourceData(new MemoryBlob(data.data(), dataSize)));
+
+        EXPECT_TRUE(res.getHash().isValid());
+        EXPECT_NE(CalculateUnchunkedResourceHash(EResourceType_VertexArray, data), res.getHash());
+    }
+
+    TEST(AResourceTest, recalculatesHashWhenChunkedHashingThresholdChanges)
+    {
+        const UInt32 dataSize = ResourceBase::DefaultChunkedHashingThreshold;
+        const std::vector<Byte> data = CreateTestData(dataSize);
+        TestResource res(EResourceType_VertexArray, ResourceCacheFlag(0), String());
+        res.setResourceData(SceneResourceData(new MemoryBlob(data.data(), dataSize)));
+        const ResourceContentHash unchunkedHash = res.getHash();
+
+        res.setChunkedHashingThreshold(ResourceBase::DefaultChunkedHashingThreshold);
+        const ResourceContentHash chunkedHash = res.getHash();
+        EXPECT_NE(unchunkedHash, chunkedHash);
+
+        TestResource otherRes(EResourceType_VertexArray, ResourceCacheFlag(0), String());
+        otherRes.setChunkedHashingThreshold(ResourceBase::DefaultChunkedHashingThreshold);
+        otherRes.setResourceData(SceneResourceData(new MemoryBlob(data.data(), dataSize)));
+        EXPECT_EQ(chunkedHash, otherRes.getHash());
+
+        res.setChunkedHashingThreshold(0u);
+        EXPECT_EQ(unchunkedHash, res.getHash());
+    }
+
+    TEST(AResourceTest, givesSameDataHashForAnyThreadCount)
+    {
+        // last chunk is only partially filled
+        const UInt32 threshold = ResourceBase::DefaultChunkedHashingThreshold;
+        const UInt32 dataSize = threshold + 3u * ResourceBase::ChunkedHashingChunkSize / 2u;
+        const std::vector<Byte> data = CreateTestData(dataSize);
+
+        const ResourceContentHash hash = ResourceBase::HashResourceData(data.data(), dataSize, threshold, 1u);
+        EXPECT_TRUE(hash.isValid());
+        for (UInt32 threadCount : { 0u, 2u, 3u, 4u, 16u })
+        {
+            SCOPED_TRACE(threadCount);
+            EXPECT_EQ(hash, ResourceBase::HashResourceData(data.data(), dataSize, threshold, threadCount));
+        }
+    }
+
+    TEST(AResourceTest, givesDifferentDataHashForChangeInAnyChunk)
+    {
+        const UInt32 threshold = ResourceBase::DefaultChunkedHashingThreshold;
+        const UInt32 dataSize = threshold + ResourceBase::ChunkedHashingChunkSize / 2u;
+        std::vector<Byte> data = CreateTestData(dataSize);
+        const ResourceContentHash hash = ResourceBase::HashResourceData(data.data(), dataSize, threshold, 4u);
+
+        for (UInt32 changedByte : { 0u, ResourceBase::ChunkedHashingChunkSize, dataSize - 1u })
+        {
+            SCOPED_TRACE(changedByte);
+            ++data[changedByte];
+            EXPECT_NE(hash, ResourceBase::HashResourceData(data.data(), dataSize, threshold, 4u));
+            --data[changedByte];
+        }
+        EXPECT_EQ(hash, ResourceBase::HashResourceData(data.data(), dataSize, threshold, 4u));
+    }
+
+    TEST(AResourceTest, givesDifferentDataHashForDifferentSizesWithSameChunkCount)
+    {
+        const UInt32 threshold = ResourceBase::DefaultChunkedHashingThreshold;
+        const UInt32 dataSize = threshold + ResourceBase::ChunkedHashingChunkSize / 2u;
+        const std::vector<Byte> data = CreateTestData(dataSize);
+
+        EXPECT_NE(ResourceBase::HashResourceData(data.data(), dataSize, threshold, 4u), ResourceBase::HashResourceData(data.data(), dataSize - 1u, threshold, 4u));
+    }
 }
@@ -21,6 +21,7 @@ namespace ramses_internal
 
         const SceneResourceChanges&         getResourceChanges() const;
         void                                clearResourceChanges();
+        void                                prefetchClientResource(const ResourceContentHash& hash);
 
         // Renderable allocation
         virtual void                        releaseRenderable(RenderableHandle renderableHandle) override;
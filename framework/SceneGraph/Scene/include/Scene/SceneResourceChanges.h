@@ -82,6 +82,8 @@ namespace ramses_internal
 
         ResourceContentHashVector m_addedClientResourceRefs;
         ResourceContentHashVector m_removedClientResourceRefs;
+        // client resources that are not used by scene yet but are expected to be used soon
+        ResourceContentHashVector m_prefetchedClientResources;
 
         SceneResourceActionVector m_sceneResourceActions;
     };
@@ -88,6 +88,15 @@ namespace ramses_internal
         m_changes.clear();
     }
 
+    void ResourceChangeCollectingScene::prefetchClientResource(const ResourceContentHash& hash)
+    {
+        // no need to prefetch resource already used by scene, it was already sent to renderer as resource reference
+        if (!m_clientResourcesUsageMap.contains(hash) && !m_changes.m_prefetchedClientResources.contains(hash))
+        {
+            m_changes.m_prefetchedClientResources.push_back(hash);
+        }
+    }
+
     void ResourceChangeCollectingScene::handleClientResourceReferenceChange(const ResourceContentHash& currentHash, const ResourceContentHash& newHash)
     {
         if (newHash != currentHash)
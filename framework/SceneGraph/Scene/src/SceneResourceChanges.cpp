@@ -16,6 +16,7 @@ namespace ramses_internal
     {
         m_addedClientResourceRefs.clear();
         m_removedClientResourceRefs.clear();
+        m_prefetchedClientResources.clear();
         m_sceneResourceActions.clear();
     }
 
@@ -23,6 +24,7 @@ namespace ramses_internal
     {
         return m_addedClientResourceRefs.empty()
             && m_removedClientResourceRefs.empty()
+            && m_prefetchedClientResources.empty()
             && m_sceneResourceActions.empty();
     }
 
@@ -67,6 +69,7 @@ namespace ramses_internal
     {
         putDataArray(action, m_addedClientResourceRefs);
         putDataArray(action, m_removedClientResourceRefs);
+        putDataArray(action, m_prefetchedClientResources);
         putDataArray(action, m_sceneResourceActions);
     }
 
@@ -74,6 +77,7 @@ namespace ramses_internal
     {
         getDataArray(action, m_addedClientResourceRefs);
         getDataArray(action, m_removedClientResourceRefs);
+        getDataArray(action, m_prefetchedClientResources);
         getDataArray(action, m_sceneResourceActions);
     }
 
@@ -81,6 +85,7 @@ namespace ramses_internal
     {
         return estimatePutDataArraySize(m_addedClientResourceRefs) +
             estimatePutDataArraySize(m_removedClientResourceRefs) +
+            estimatePutDataArraySize(m_prefetchedClientResources) +
             estimatePutDataArraySize(m_sceneResourceActions);
     }
 
@@ -121,6 +126,13 @@ namespace ramses_internal
         }
         str << "]";
 
+        str << "\n[ prefetched client resources:";
+        for (const auto& res : m_prefetchedClientResources)
+        {
+            str << " " << StringUtils::HexFromResourceContentHash(res);
+        }
+        str << "]";
+
         str << "\n[ scene resource actions:";
         for (const auto& res : m_sceneResourceActions)
         {
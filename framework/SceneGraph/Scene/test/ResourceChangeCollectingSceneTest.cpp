@@ -94,6 +94,7 @@ namespace ramses_internal
     {
         EXPECT_TRUE(resourceChanges.m_addedClientResourceRefs.empty());
         EXPECT_TRUE(resourceChanges.m_removedClientResourceRefs.empty());
+        EXPECT_TRUE(resourceChanges.m_prefetchedClientResources.empty());
         EXPECT_TRUE(resourceChanges.m_sceneResourceActions.empty());
 
         expectSameSceneResourceChangesWhenExtractedFromScene();
@@ -724,4 +725,32 @@ namespace ramses_internal
         EXPECT_EQ(0u, resourceChanges.m_addedClientResourceRefs.size());
         EXPECT_EQ(0u, resourceChanges.m_removedClientResourceRefs.size());
     }
+
+    TEST_F(AResourceChangeCollectingScene, collectsPrefetchedResourcesOnlyOnce)
+    {
+        const ResourceContentHash hash1(1234u, 0);
+        const ResourceContentHash hash2(5678u, 0);
+        scene.prefetchClientResource(hash1);
+        scene.prefetchClientResource(hash2);
+        scene.prefetchClientResource(hash1);
+
+        ASSERT_EQ(2u, resourceChanges.m_prefetchedClientResources.size());
+        EXPECT_EQ(hash1, resourceChanges.m_prefetchedClientResources[0]);
+        EXPECT_EQ(hash2, resourceChanges.m_prefetchedClientResources[1]);
+        EXPECT_TRUE(resourceChanges.m_addedClientResourceRefs.empty());
+        EXPECT_FALSE(resourceChanges.empty());
+
+        scene.clearResourceChanges();
+        EXPECT_TRUE(resourceChanges.m_prefetchedClientResources.empty());
+    }
+
+    TEST_F(AResourceChangeCollectingScene, doesNotCollectPrefetchedResourceAlreadyUsedByScene)
+    {
+        const ResourceContentHash hash(1234u, 0);
+        scene.allocateTextureSampler({ {}, hash });
+        scene.clearResourceChanges();
+
+        scene.prefetchClientResource(hash);
+        EXPECT_TRUE(resourceChanges.m_prefetchedClientResources.empty());
+    }
 }
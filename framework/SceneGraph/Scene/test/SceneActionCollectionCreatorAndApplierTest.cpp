@@ -110,6 +110,24 @@ namespace ramses_internal
         EXPECT_EQ(SceneSizeInformation(), sizeInfo);
     }
 
+    TEST_F(ASceneActionCollectionCreatorAndApplier, createsAndReadsResourceChanges)
+    {
+        SceneResourceChanges resourceChangesIn;
+        resourceChangesIn.m_addedClientResourceRefs.push_back(ResourceContentHash(1u, 2u));
+        resourceChangesIn.m_removedClientResourceRefs.push_back(ResourceContentHash(3u, 4u));
+        resourceChangesIn.m_prefetchedClientResources.push_back(ResourceContentHash(5u, 6u));
+        resourceChangesIn.m_prefetchedClientResources.push_back(ResourceContentHash(7u, 8u));
+        resourceChangesIn.m_sceneResourceActions.push_back(SceneResourceAction(MemoryHandle(9u), ESceneResourceAction_CreateRenderBuffer));
+
+        creator.flush(1u, false, false, SceneSizeInformation(), resourceChangesIn);
+        readFlushByIndex(0);
+
+        EXPECT_EQ(resourceChangesIn.m_addedClientResourceRefs, resourceChanges.m_addedClientResourceRefs);
+        EXPECT_EQ(resourceChangesIn.m_removedClientResourceRefs, resourceChanges.m_removedClientResourceRefs);
+        EXPECT_EQ(resourceChangesIn.m_prefetchedClientResources, resourceChanges.m_prefetchedClientResources);
+        EXPECT_EQ(resourceChangesIn.m_sceneResourceActions, resourceChanges.m_sceneResourceActions);
+    }
+
     TEST_F(ASceneActionCollectionCreatorAndApplier, canPassNullptrForTimestamps)
     {
         creator.flush(1u, false, false, SceneSizeInformation(), SceneResourceChanges(), {}, {1, 2, 3});
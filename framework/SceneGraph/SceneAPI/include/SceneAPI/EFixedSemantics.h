@@ -57,6 +57,9 @@ namespace ramses_internal
 
         EFixedSemantics_Invalid,
 
+        // Instancing, added after EFixedSemantics_Invalid to keep values of semantics stored in effect resources
+        EFixedSemantics_InstanceWorldMatrixAttribute,
+
         EFixedSemantics_Count // must be last, used for checking for dynamic semantics
     };
 
@@ -116,6 +119,8 @@ namespace ramses_internal
             return "EFixedSemantics_TextTextureCoordinatesAttribute";
         case EFixedSemantics_TextTextureUniform:
             return "EFixedSemantics_TextTextureUniform";
+        case EFixedSemantics_InstanceWorldMatrixAttribute:
+            return "EFixedSemantics_InstanceWorldMatrixAttribute";
         default:
             return "UNKNOWN_SEMANTICS";
         }
@@ -133,6 +138,7 @@ namespace ramses_internal
         case EFixedSemantics_ModelViewMatrix:
         case EFixedSemantics_ModelViewProjectionMatrix:
         case EFixedSemantics_NormalMatrix:
+        case EFixedSemantics_InstanceWorldMatrixAttribute:
             return dataType == EDataType_Matrix44F;
         case EFixedSemantics_ModelViewMatrix33:
             return dataType == EDataType_Matrix33F;
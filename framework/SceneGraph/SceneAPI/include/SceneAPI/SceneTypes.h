@@ -41,6 +41,7 @@ namespace ramses_internal
     using DataBufferHandleVector     =  Vector<DataBufferHandle>;
     using TextureBufferHandleVector  =  Vector<TextureBufferHandle>;
     using TextureSamplerHandleVector =  Vector<TextureSamplerHandle>;
+    using DataInstanceHandleVector   =  Vector<DataInstanceHandle>;
 }
 
 #endif
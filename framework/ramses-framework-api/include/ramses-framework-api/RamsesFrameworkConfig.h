@@ -118,6 +118,23 @@ namespace ramses
         */
         void setMaximumTotalBytesAllowedForAsyncResourceLoading(uint32_t maximumTotalBytesForAsynResourceLoading);
 
+        /**
+        * @brief Enables hashing of large resource data in chunks on multiple threads
+        *
+        * Resources created by clients of this framework instance with data of at least the given size are hashed
+        * in 1MB chunks in parallel, which speeds up creation of large textures and arrays. Such resources get a different
+        * resource hash than with regular hashing, so resource files and renderer caches holding them by their
+        * regular hash do not match anymore. The setting applies only to this framework instance. Other participants
+        * can use a different setting, as the hash of a resource is always taken over from its creator, but then
+        * equal resources created by participants with different settings are not recognized as equal.
+        *
+        * The default value is 0, which disables chunked hashing. The setting can also be given by
+        * command line argument --chunked-hashing-threshold.
+        *
+        * @param[in] thresholdInBytes Minimum resource data size in bytes to be hashed in chunks, 0 to disable
+        */
+        void setChunkedHashingThreshold(uint32_t thresholdInBytes);
+
         /**
         * @brief Enables or disables the periodic log messages provided by the Ramses framework
         *
@@ -154,6 +171,19 @@ namespace ramses
         */
         void setDaemonPortForTCPCommunication(uint16_t port);
 
+        /**
+        * @brief Limits the bandwidth used for sending resources to other participants
+        * The value is only evaluated if SOME/IP is not used. This communication type is intended for prototype use-cases only.
+        *
+        * Resource data is sent in chunks which are interleaved between receivers and never delay other
+        * messages like scene updates. The limit applies to all resource data sent by this participant.
+        *
+        * The default value is 0, which means unlimited.
+        *
+        * @param[in] bytesPerSecond Maximum bytes per second to send resource data with, 0 for unlimited
+        */
+        void setResourceTransferBandwidthLimitForTCPCommunication(uint32_t bytesPerSecond);
+
         /**
         * Stores internal data for implementation specifics of RamsesFrameworkConfig
         */
@@ -158,6 +158,9 @@ namespace ramses
 
     /**
     * @brief Cache flag value used for passing a strong-typed flag value to a renderer.
+    *
+    * The renderer also uses the flag as upload priority hint: resources with lower flag value
+    * are uploaded before resources with higher flag value, resources with ResourceCacheFlag_DoNotCache last.
     */
     typedef StronglyTypedValue<uint32_t, resourceCacheFlagTag> resourceCacheFlag_t;
 
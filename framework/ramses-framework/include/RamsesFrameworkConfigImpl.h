@@ -43,6 +43,8 @@ namespace ramses
 
         void setMaximumTotalBytesAllowedForAsyncResourceLoading(uint32_t maximumTotalBytesForAsynResourceLoading);
         uint32_t getMaximumTotalBytesForAsyncResourceLoading() const;
+        void setChunkedHashingThreshold(uint32_t thresholdInBytes);
+        uint32_t getChunkedHashingThreshold() const;
         ramses_internal::EConnectionProtocol getUsedProtocol() const;
         uint32_t getWatchdogNotificationInterval(ERamsesThreadIdentifier thread) const;
         IThreadWatchdogNotification* getWatchdogNotificationCallback() const;
@@ -65,6 +67,7 @@ namespace ramses
         ramses_internal::String m_dltAppDescription;
         uint32_t m_maximumTotalBytesForAsyncResourceLoading;
         bool m_enableProtocolVersionOffset;
+        uint32_t m_chunkedHashingThreshold;
         ramses_internal::Guid m_userProvidedGuid;
     };
 }
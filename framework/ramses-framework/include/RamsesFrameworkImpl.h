@@ -55,6 +55,7 @@ namespace ramses
         ramses_internal::ITaskQueue& getTaskQueue();
         ramses_internal::PeriodicLogger& getPeriodicLogger();
         ramses_internal::StatisticCollectionFramework& getStatisticCollection();
+        uint32_t getChunkedHashingThreshold() const;
 
     private:
         RamsesFrameworkImpl(const RamsesFrameworkConfigImpl& config, const ramses_internal::ParticipantIdentifier& participantAddress);
@@ -76,6 +77,7 @@ namespace ramses
         ramses_internal::ResourceComponent resourceComponent;
         ramses_internal::SceneGraphComponent scenegraphComponent;
         ramses_internal::LogConnectionInfo m_ramshCommandLogConnectionInformation;
+        const uint32_t m_chunkedHashingThreshold;
     };
 }
 
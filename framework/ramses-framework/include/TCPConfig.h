@@ -23,11 +23,13 @@ namespace ramses
         const ramses_internal::String& getIPAddress() const;
         uint16_t getDaemonPort() const;
         const ramses_internal::String& getDaemonIPAddress() const;
+        uint32_t getResourceTransferBandwidthLimit() const;
 
         void setPort(uint16_t port);
         void setIPAddress(const ramses_internal::String& ipAddress);
         void setDaemonPort(uint16_t port);
         void setDaemonIPAddress(const ramses_internal::String& ipAddress);
+        void setResourceTransferBandwidthLimit(uint32_t bytesPerSecond);
 
     private:
         static const uint16_t DefaultPort;
@@ -38,6 +40,7 @@ namespace ramses
         ramses_internal::String m_ipAddress;
         uint16_t m_daemonPort;
         ramses_internal::String m_daemonIP;
+        uint32_t m_resourceTransferBandwidthLimit;
     };
 }
 
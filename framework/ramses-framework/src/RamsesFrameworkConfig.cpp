@@ -68,6 +68,11 @@ namespace ramses
         impl.setMaximumTotalBytesAllowedForAsyncResourceLoading(maximumTotalBytesForAsynResourceLoading);
     }
 
+    void RamsesFrameworkConfig::setChunkedHashingThreshold(uint32_t thresholdInBytes)
+    {
+        impl.setChunkedHashingThreshold(thresholdInBytes);
+    }
+
     void RamsesFrameworkConfig::setPeriodicLogsEnabled(bool enabled)
     {
         impl.setPeriodicLogsEnabled(enabled);
@@ -87,4 +92,9 @@ namespace ramses
     {
         impl.m_tcpConfig.setDaemonPort(port);
     }
+
+    void RamsesFrameworkConfig::setResourceTransferBandwidthLimitForTCPCommunication(uint32_t bytesPerSecond)
+    {
+        impl.m_tcpConfig.setResourceTransferBandwidthLimit(bytesPerSecond);
+    }
 }
@@ -24,6 +24,12 @@ namespace ramses
     static bool gHasTCPComm = false;
 #endif
 
+#if defined(HAS_SHARED_MEMORY_COMM)
+    static bool gHasSharedMemoryComm = true;
+#else
+    static bool gHasSharedMemoryComm = false;
+#endif
+
     RamsesFrameworkConfigImpl::RamsesFrameworkConfigImpl(int32_t argc, char const* const* argv)
         : StatusObjectImpl()
         , m_shellType(ERamsesShellType_Default)
@@ -34,6 +40,7 @@ namespace ramses
         , m_dltAppDescription("RAMS-DESC")
         , m_maximumTotalBytesForAsyncResourceLoading(MAXIMUM_BYTES_FOR_ASYNC_RESOURCE_LOADING)
         , m_enableProtocolVersionOffset(false)
+        , m_chunkedHashingThreshold(0u)
     {
         parseCommandLine();
     }
@@ -112,10 +119,13 @@ namespace ramses
     void RamsesFrameworkConfigImpl::parseCommandLine()
     {
         const ArgumentBool useFakeConnection( m_parser, "fakeConnection", "fakeConnection", false);
+        const ArgumentBool useSharedMemory(   m_parser, "shm", "sharedMemory", false);
         const ArgumentBool isRamshEnabled(    m_parser, "ramsh", "ramsh", false);
         const ArgumentBool enableOffsetPlatformProtocolVersion(m_parser, "pvo", "protocolVersionOffset", false);
         const ArgumentBool disablePeriodicLogs(m_parser, "disablePeriodicLogs", "disablePeriodicLogs", false);
         const ArgumentString userProvidedGuid(m_parser, "guid", "guid", "");
+        // resource data of at least this size is hashed in chunks on multiple threads, changes hashes of such resources
+        const ArgumentUInt32 chunkedHashingThreshold(m_parser, "cht", "chunked-hashing-threshold", 0u);
 
         if (enableOffsetPlatformProtocolVersion)
         {
@@ -131,13 +141,15 @@ namespace ramses
             m_periodicLogsEnabled = false;
         }
 
+        m_chunkedHashingThreshold = chunkedHashingThreshold;
+
         if (useFakeConnection || !gHasTCPComm)
         {
             m_usedProtocol = EConnectionProtocol_Fake;
         }
         else
         {
-            m_usedProtocol = EConnectionProtocol_TCP;
+            m_usedProtocol = (useSharedMemory && gHasSharedMemoryComm) ? EConnectionProtocol_SharedMemory : EConnectionProtocol_TCP;
             ArgumentUInt16 port(m_parser, "myport", "myportnumber", m_tcpConfig.getPort());
             if( port.wasDefined() )
             {
@@ -147,6 +159,7 @@ namespace ramses
             m_tcpConfig.setIPAddress(ArgumentString(m_parser, "myip", "myipaddress", m_tcpConfig.getIPAddress()));
             m_tcpConfig.setDaemonIPAddress(ArgumentString(m_parser, "i", "daemon-ip", m_tcpConfig.getDaemonIPAddress()));
             m_tcpConfig.setDaemonPort(ArgumentUInt16(m_parser, "p", "daemon-port", m_tcpConfig.getDaemonPort()));
+            m_tcpConfig.setResourceTransferBandwidthLimit(ArgumentUInt32(m_parser, "rtbw", "resource-transfer-bandwidth", m_tcpConfig.getResourceTransferBandwidthLimit()));
         }
 
         if (userProvidedGuid.hasValue())
@@ -181,6 +194,16 @@ namespace ramses
         return m_maximumTotalBytesForAsyncResourceLoading;
     }
 
+    void RamsesFrameworkConfigImpl::setChunkedHashingThreshold(uint32_t thresholdInBytes)
+    {
+        m_chunkedHashingThreshold = thresholdInBytes;
+    }
+
+    uint32_t RamsesFrameworkConfigImpl::getChunkedHashingThreshold() const
+    {
+        return m_chunkedHashingThreshold;
+    }
+
     void RamsesFrameworkConfigImpl::setMaximumTotalBytesAllowedForAsyncResourceLoading(uint32_t maximumTotalBytesForAsyncResourceLoading)
     {
         m_maximumTotalBytesForAsyncResourceLoading = maximumTotalBytesForAsyncResourceLoading;
@@ -39,6 +39,7 @@ namespace ramses
             m_statisticCollection, m_frameworkLock, config.getMaximumTotalBytesForAsyncResourceLoading())
         , scenegraphComponent(m_participantAddress.getParticipantId(), *m_communicationSystem, m_communicationSystem->getConnectionStatusUpdateNotifier(), m_frameworkLock)
         , m_ramshCommandLogConnectionInformation(*m_communicationSystem)
+        , m_chunkedHashingThreshold(config.getChunkedHashingThreshold())
     {
         m_ramsh->start();
         m_ramsh->add(m_ramshCommandLogConnectionInformation);
@@ -95,6 +96,11 @@ namespace ramses
         return m_statisticCollection;
     }
 
+    uint32_t RamsesFrameworkImpl::getChunkedHashingThreshold() const
+    {
+        return m_chunkedHashingThreshold;
+    }
+
     RamsesFrameworkImpl::~RamsesFrameworkImpl()
     {
         LOG_INFO(CONTEXT_CLIENT, "RamsesFramework::~RamsesFramework: guid " << m_participantAddress.getParticipantId() << ", wasConnected " << m_connected);
@@ -227,6 +233,10 @@ namespace ramses
         {
             participantName += "TCP";
         }
+        else if (config.impl.getUsedProtocol() == EConnectionProtocol_SharedMemory)
+        {
+            participantName += "SHM";
+        }
         else
         {
             participantName += "UnknownComm";
@@ -19,6 +19,7 @@ namespace ramses
         , m_ipAddress("127.0.0.1")
         , m_daemonPort(DefaultDaemonPort)
         , m_daemonIP("127.0.0.1")
+        , m_resourceTransferBandwidthLimit(0u)
     {
     }
 
@@ -42,6 +43,11 @@ namespace ramses
         return m_daemonIP;
     }
 
+    uint32_t TCPConfig::getResourceTransferBandwidthLimit() const
+    {
+        return m_resourceTransferBandwidthLimit;
+    }
+
 
     void TCPConfig::setPort(uint16_t port)
     {
@@ -63,4 +69,9 @@ namespace ramses
     {
         m_daemonIP = ipAddress;
     }
+
+    void TCPConfig::setResourceTransferBandwidthLimit(uint32_t bytesPerSecond)
+    {
+        m_resourceTransferBandwidthLimit = bytesPerSecond;
+    }
 }
@@ -0,0 +1,86 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "GlyphAtlasPerformanceTest.h"
+
+GlyphAtlasPerformanceTest::GlyphAtlasPerformanceTest(ramses_internal::String testName, uint32_t testState)
+    : PerformanceTestBase(testName, testState)
+{
+}
+
+void GlyphAtlasPerformanceTest::initTest(ramses::RamsesClient& client, ramses::Scene& scene)
+{
+    UNUSED(client);
+    m_scene = &scene;
+
+    // deterministic pseudo random glyph sizes, so that all runs pack the same sequence
+    uint32_t seed = 12345u;
+    const ramses::FontInstanceId fontInstance(1u);
+    ramses::GlyphMetricsVector line;
+    for (uint32_t i = 0u; i < NumGlyphs; ++i)
+    {
+        uint32_t width = 10u;
+        uint32_t height = 14u;
+        if (m_testState != GlyphAtlasPerformanceTest_MapUniformGlyphs)
+        {
+            seed = seed * 1103515245u + 12345u;
+            width = 2u + (seed >> 16) % 30u;
+            seed = seed * 1103515245u + 12345u;
+            height = 2u + (seed >> 16) % 30u;
+        }
+
+        line.push_back({ ramses::GlyphKey(ramses::GlyphId(i), fontInstance), width, height, 0, 0, 0 });
+        if (line.size() == GlyphsPerLine)
+        {
+            m_lines.push_back(line);
+            line.clear();
+        }
+    }
+}
+
+void GlyphAtlasPerformanceTest::preUpdate()
+{
+    // start every iteration with empty atlas, glyph registration is not part of measurement
+    m_atlas.reset();
+    m_atlas.reset(new ramses::GlyphTextureAtlas(*m_scene, ramses::QuadSize(PageSize, PageSize)));
+    for (const auto& line : m_lines)
+    {
+        for (const auto& glyph : line)
+            m_atlas->registerGlyph(glyph.key, ramses::QuadSize(glyph.width, glyph.height), ramses::GlyphData(glyph.width * glyph.height));
+    }
+}
+
+void GlyphAtlasPerformanceTest::update()
+{
+    switch (m_testState)
+    {
+    case GlyphAtlasPerformanceTest_MapUniformGlyphs:
+    case GlyphAtlasPerformanceTest_MapMixedSizeGlyphs:
+    {
+        for (const auto& line : m_lines)
+            m_atlas->mapGlyphsAndCreateGeometry(line);
+        break;
+    }
+    case GlyphAtlasPerformanceTest_MapAndUnmapMixedSizeGlyphs:
+    {
+        // unmapping every other line fragments free space which has to be merged and reused
+        for (size_t i = 0u; i < m_lines.size(); ++i)
+        {
+            const ramses::GlyphGeometry geometry = m_atlas->mapGlyphsAndCreateGeometry(m_lines[i]);
+            if (i % 2u == 1u)
+                m_atlas->unmapGlyphsFromPage(m_lines[i], geometry.atlasPage);
+        }
+        break;
+    }
+    default:
+    {
+        assert(false);
+        break;
+    }
+    }
+}
@@ -0,0 +1,43 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_GLYPHATLASPERFORMANCETEST_H
+#define RAMSES_GLYPHATLASPERFORMANCETEST_H
+
+#include "PerformanceTestBase.h"
+#include "ramses-text/GlyphTextureAtlas.h"
+#include <memory>
+#include <vector>
+
+class GlyphAtlasPerformanceTest : public PerformanceTestBase
+{
+public:
+    enum
+    {
+        GlyphAtlasPerformanceTest_MapUniformGlyphs = 0,
+        GlyphAtlasPerformanceTest_MapMixedSizeGlyphs,
+        GlyphAtlasPerformanceTest_MapAndUnmapMixedSizeGlyphs
+    };
+
+    GlyphAtlasPerformanceTest(ramses_internal::String testName, uint32_t testState);
+
+    virtual void initTest(ramses::RamsesClient& client, ramses::Scene& scene) override;
+    virtual void preUpdate() override;
+    virtual void update() override;
+
+private:
+    static const uint32_t NumGlyphs = 20000u;
+    static const uint32_t GlyphsPerLine = 16u;
+    static const uint32_t PageSize = 1024u;
+
+    ramses::Scene* m_scene = nullptr;
+    std::unique_ptr<ramses::GlyphTextureAtlas> m_atlas;
+    std::vector<ramses::GlyphMetricsVector> m_lines;
+};
+
+#endif
@@ -0,0 +1,310 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LocalTransportPerformanceTest.h"
+#include "Utils/LogMacros.h"
+#include <cstring>
+
+#if defined(HAS_SHARED_MEMORY_COMM)
+#include "TransportSharedMemory/SharedMemoryUtilities.h"
+#include <poll.h>
+#endif
+
+using namespace ramses_internal;
+
+LocalTransportPerformanceTest::LocalTransportPerformanceTest(ramses_internal::String testName, uint32_t testState)
+    : PerformanceTestBase(testName, testState)
+    , m_acknowledge(sizeof(uint32_t))
+    , m_stopPeer(false)
+{
+    switch (m_testState)
+    {
+    case LocalTransportPerformanceTest_Tcp_SmallMessage:
+    case LocalTransportPerformanceTest_SharedMemory_SmallMessage:
+        m_message.resize(SmallMessageSize);
+        break;
+    case LocalTransportPerformanceTest_Tcp_ResourceChunk:
+    case LocalTransportPerformanceTest_SharedMemory_ResourceChunk:
+        m_message.resize(ResourceChunkSize);
+        break;
+    default:
+        m_message.resize(LargeMessageSize);
+        break;
+    }
+
+    for (size_t i = 0u; i < m_message.size(); ++i)
+    {
+        m_message[i] = static_cast<Byte>(i);
+    }
+}
+
+LocalTransportPerformanceTest::~LocalTransportPerformanceTest()
+{
+    m_stopPeer = true;
+    // closing own end lets the peer thread leave its blocking receive
+    if (m_socket)
+    {
+        m_socket->close();
+    }
+    if (m_peerThread.joinable())
+    {
+        m_peerThread.join();
+    }
+    m_serverSocket.close();
+}
+
+bool LocalTransportPerformanceTest::usesSharedMemory() const
+{
+    return m_testState >= LocalTransportPerformanceTest_SharedMemory_SmallMessage;
+}
+
+void LocalTransportPerformanceTest::initTest(ramses::RamsesClient& client, ramses::Scene& scene)
+{
+    UNUSED(client);
+    UNUSED(scene);
+
+    if (usesSharedMemory())
+    {
+#if defined(HAS_SHARED_MEMORY_COMM)
+        initSharedMemory();
+#endif
+    }
+    else
+    {
+        initTcp();
+    }
+}
+
+void LocalTransportPerformanceTest::update()
+{
+    if (usesSharedMemory())
+    {
+#if defined(HAS_SHARED_MEMORY_COMM)
+        sendSharedMemory();
+#endif
+    }
+    else
+    {
+        sendTcp();
+    }
+}
+
+void LocalTransportPerformanceTest::initTcp()
+{
+    if (m_serverSocket.bind(0u, "127.0.0.1") != EStatus_RAMSES_OK || m_serverSocket.listen(1u) != EStatus_RAMSES_OK)
+    {
+        LOG_ERROR(CONTEXT_FRAMEWORK, "LocalTransportPerformanceTest::initTcp: could not listen on loopback");
+        return;
+    }
+
+    m_socket.reset(new PlatformSocket());
+    if (m_socket->connect("127.0.0.1", m_serverSocket.getPort()) != EStatus_RAMSES_OK)
+    {
+        LOG_ERROR(CONTEXT_FRAMEWORK, "LocalTransportPerformanceTest::initTcp: could not connect on loopback");
+        m_socket.reset();
+        return;
+    }
+    m_peerSocket.reset(m_serverSocket.accept(1000u));
+    if (!m_peerSocket)
+    {
+        LOG_ERROR(CONTEXT_FRAMEWORK, "LocalTransportPerformanceTest::initTcp: could not accept on loopback");
+        m_socket.reset();
+        return;
+    }
+
+    // same socket options as the TCP transport
+    m_socket->setNoDelay(true);
+    m_peerSocket->setNoDelay(true);
+    m_peerThread = std::thread(&LocalTransportPerformanceTest::runTcpPeer, this);
+}
+
+void LocalTransportPerformanceTest::runTcpPeer()
+{
+    std::vector<Byte> message;
+    while (!m_stopPeer)
+    {
+        uint32_t size = 0u;
+        if (!ReceiveAll(*m_peerSocket, reinterpret_cast<Byte*>(&size), sizeof(size)))
+        {
+            break;
+        }
+        message.resize(size);
+        if (!ReceiveAll(*m_peerSocket, message.data(), size) ||
+            !SendAll(*m_peerSocket, m_acknowledge.data(), static_cast<uint32_t>(m_acknowledge.size())))
+        {
+            break;
+        }
+    }
+}
+
+void LocalTransportPerformanceTest::sendTcp()
+{
+    if (!m_socket)
+    {
+        return;
+    }
+
+    const uint32_t size = static_cast<uint32_t>(m_message.size());
+    uint32_t acknowledge = 0u;
+    if (!SendAll(*m_socket, reinterpret_cast<const Byte*>(&size), sizeof(size)) ||
+        !SendAll(*m_socket, m_message.data(), size) ||
+        !ReceiveAll(*m_socket, reinterpret_cast<Byte*>(&acknowledge), sizeof(acknowledge)))
+    {
+        LOG_ERROR(CONTEXT_FRAMEWORK, "LocalTransportPerformanceTest::sendTcp: transfer failed");
+    }
+}
+
+bool LocalTransportPerformanceTest::SendAll(PlatformSocket& socket, const Byte* data, uint32_t size)
+{
+    uint32_t sent = 0u;
+    while (sent < size)
+    {
+        Int32 bytes = 0;
+        if (socket.send(reinterpret_cast<const Char*>(data + sent), static_cast<Int32>(size - sent), bytes) != EStatus_RAMSES_OK || bytes <= 0)
+        {
+            return false;
+        }
+        sent += static_cast<uint32_t>(bytes);
+    }
+    return true;
+}
+
+bool LocalTransportPerformanceTest::ReceiveAll(PlatformSocket& socket, Byte* data, uint32_t size)
+{
+    uint32_t received = 0u;
+    while (received < size)
+    {
+        Int32 bytes = 0;
+        if (socket.receive(reinterpret_cast<Char*>(data + received), static_cast<Int32>(size - received), bytes) != EStatus_RAMSES_OK || bytes <= 0)
+        {
+            return false;
+        }
+        received += static_cast<uint32_t>(bytes);
+    }
+    return true;
+}
+
+#if defined(HAS_SHARED_MEMORY_COMM)
+void LocalTransportPerformanceTest::initSharedMemory()
+{
+    const Guid localId(true);
+    const Guid peerId(true);
+    int listener = SharedMemoryChannel::CreateListener(peerId);
+    if (listener < 0)
+    {
+        LOG_ERROR(CONTEXT_FRAMEWORK, "LocalTransportPerformanceTest::initSharedMemory: could not create listener");
+        return;
+    }
+
+    // both ends are driven from here, every step only needs the message the other side sent before
+    std::unique_ptr<SharedMemoryHandshake> initiator = SharedMemoryHandshake::Connect(localId, peerId);
+    std::unique_ptr<SharedMemoryHandshake> acceptor;
+    pollfd pollInfo = { listener, POLLIN, 0 };
+    if (initiator && poll(&pollInfo, 1, static_cast<int>(SharedMemoryChannel::HandshakeTimeoutMs)) == 1)
+    {
+        acceptor = SharedMemoryHandshake::Accept(listener, peerId);
+    }
+    SharedMemoryUtilities::CloseFileDescriptor(listener);
+
+    if (acceptor &&
+        acceptor->continueHandshake() == ESharedMemoryHandshakeState_InProgress &&
+        initiator->continueHandshake() == ESharedMemoryHandshakeState_Complete &&
+        acceptor->continueHandshake() == ESharedMemoryHandshakeState_Complete)
+    {
+        m_channel = initiator->takeChannel();
+        m_peerChannel = acceptor->takeChannel();
+    }
+
+    if (!m_channel || !m_peerChannel)
+    {
+        LOG_ERROR(CONTEXT_FRAMEWORK, "LocalTransportPerformanceTest::initSharedMemory: could not connect channel");
+        m_channel.reset();
+        m_peerChannel.reset();
+        return;
+    }
+    m_peerThread = std::thread(&LocalTransportPerformanceTest::runSharedMemoryPeer, this);
+}
+
+void LocalTransportPerformanceTest::runSharedMemoryPeer()
+{
+    std::vector<Byte> message;
+    while (!m_stopPeer)
+    {
+        // short timeout to notice the end of the test
+        if (WaitForMessage(*m_peerChannel, message, 100u) &&
+            !SendMessage(*m_peerChannel, m_acknowledge, TransferTimeoutMs))
+        {
+            break;
+        }
+    }
+}
+
+void LocalTransportPerformanceTest::sendSharedMemory()
+{
+    if (!m_channel)
+    {
+        return;
+    }
+
+    std::vector<Byte> acknowledge;
+    if (!SendMessage(*m_channel, m_message, TransferTimeoutMs) ||
+        !WaitForMessage(*m_channel, acknowledge, TransferTimeoutMs))
+    {
+        LOG_ERROR(CONTEXT_FRAMEWORK, "LocalTransportPerformanceTest::sendSharedMemory: transfer failed");
+    }
+}
+
+bool LocalTransportPerformanceTest::SendMessage(SharedMemoryChannel& channel, const std::vector<Byte>& data, uint32_t timeoutMs)
+{
+    if (channel.send(0u, data.data(), static_cast<UInt32>(data.size())) == ESharedMemorySendResult_Error)
+    {
+        return false;
+    }
+
+    // receiver signals back once it made space for a queued message
+    while (channel.hasQueuedMessages())
+    {
+        if (!WaitForSignal(channel, timeoutMs))
+        {
+            return false;
+        }
+        channel.clearSignal();
+        if (!channel.sendQueuedMessages())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool LocalTransportPerformanceTest::WaitForMessage(SharedMemoryChannel& channel, std::vector<Byte>& data, uint32_t timeoutMs)
+{
+    const auto handler = [&data](UInt32, const Byte* messageData, UInt32 size) {
+        data.assign(messageData, messageData + size);
+    };
+
+    // message may already be in the ring from a signal consumed earlier
+    ESharedMemoryReceiveResult result = channel.receive(handler);
+    while (result == ESharedMemoryReceiveResult_NoMessage)
+    {
+        if (!WaitForSignal(channel, timeoutMs))
+        {
+            return false;
+        }
+        channel.clearSignal();
+        result = channel.receive(handler);
+    }
+    return result == ESharedMemoryReceiveResult_Message;
+}
+
+bool LocalTransportPerformanceTest::WaitForSignal(const SharedMemoryChannel& channel, uint32_t timeoutMs)
+{
+    pollfd pollInfo = { channel.getSignalFileDescriptor(), POLLIN, 0 };
+    return poll(&pollInfo, 1, static_cast<int>(timeoutMs)) == 1;
+}
+#endif
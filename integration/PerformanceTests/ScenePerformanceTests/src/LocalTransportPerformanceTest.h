@@ -0,0 +1,83 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_LOCALTRANSPORTPERFORMANCETEST_H
+#define RAMSES_LOCALTRANSPORTPERFORMANCETEST_H
+
+#include "PerformanceTestBase.h"
+#include "PlatformAbstraction/PlatformServerSocket.h"
+#include "PlatformAbstraction/PlatformSocket.h"
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#if defined(HAS_SHARED_MEMORY_COMM)
+#include "TransportSharedMemory/SharedMemoryChannel.h"
+#endif
+
+// Round trip of one message to a peer thread on the same host which acknowledges every received message.
+// Small messages correspond to a scene flush, resource chunks have the size resources are split into by
+// the TCP transport and large messages the size of big unsplit scene action lists.
+class LocalTransportPerformanceTest : public PerformanceTestBase
+{
+public:
+    enum
+    {
+        LocalTransportPerformanceTest_Tcp_SmallMessage = 0,
+        LocalTransportPerformanceTest_Tcp_ResourceChunk,
+        LocalTransportPerformanceTest_Tcp_LargeMessage,
+        LocalTransportPerformanceTest_SharedMemory_SmallMessage,
+        LocalTransportPerformanceTest_SharedMemory_ResourceChunk,
+        LocalTransportPerformanceTest_SharedMemory_LargeMessage
+    };
+
+    LocalTransportPerformanceTest(ramses_internal::String testName, uint32_t testState);
+    virtual ~LocalTransportPerformanceTest();
+
+    virtual void initTest(ramses::RamsesClient& client, ramses::Scene& scene) override;
+    virtual void update() override;
+
+private:
+    static const uint32_t SmallMessageSize = 1024u;
+    static const uint32_t ResourceChunkSize = 1300000u;
+    static const uint32_t LargeMessageSize = 8u * 1024u * 1024u;
+    static const uint32_t TransferTimeoutMs = 2000u;
+
+    bool usesSharedMemory() const;
+
+    void initTcp();
+    void runTcpPeer();
+    void sendTcp();
+    static bool SendAll(ramses_internal::PlatformSocket& socket, const ramses_internal::Byte* data, uint32_t size);
+    static bool ReceiveAll(ramses_internal::PlatformSocket& socket, ramses_internal::Byte* data, uint32_t size);
+
+#if defined(HAS_SHARED_MEMORY_COMM)
+    void initSharedMemory();
+    void runSharedMemoryPeer();
+    void sendSharedMemory();
+    static bool SendMessage(ramses_internal::SharedMemoryChannel& channel, const std::vector<ramses_internal::Byte>& data, uint32_t timeoutMs);
+    static bool WaitForMessage(ramses_internal::SharedMemoryChannel& channel, std::vector<ramses_internal::Byte>& data, uint32_t timeoutMs);
+    static bool WaitForSignal(const ramses_internal::SharedMemoryChannel& channel, uint32_t timeoutMs);
+
+    std::unique_ptr<ramses_internal::SharedMemoryChannel> m_channel;
+    std::unique_ptr<ramses_internal::SharedMemoryChannel> m_peerChannel;
+#endif
+
+    std::vector<ramses_internal::Byte> m_message;
+    std::vector<ramses_internal::Byte> m_acknowledge;
+
+    ramses_internal::PlatformServerSocket m_serverSocket;
+    std::unique_ptr<ramses_internal::PlatformSocket> m_socket;
+    std::unique_ptr<ramses_internal::PlatformSocket> m_peerSocket;
+
+    std::thread m_peerThread;
+    std::atomic<bool> m_stopPeer;
+};
+
+#endif
@@ -0,0 +1,79 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "MipMapGenerationPerformanceTest.h"
+#include "ramses-utils.h"
+#include "ramses-client-api/MipLevelData.h"
+
+MipMapGenerationPerformanceTest::MipMapGenerationPerformanceTest(ramses_internal::String testName, uint32_t testState)
+    : PerformanceTestBase(testName, testState)
+{
+}
+
+void MipMapGenerationPerformanceTest::initTest(ramses::RamsesClient& client, ramses::Scene& scene)
+{
+    UNUSED(client);
+    UNUSED(scene);
+
+    switch (m_testState)
+    {
+    case MipMapGenerationPerformanceTest_R8_1024:
+        m_size = 1024u;
+        m_bytesPerPixel = 1u;
+        break;
+    case MipMapGenerationPerformanceTest_RGB8_1024:
+        m_size = 1024u;
+        m_bytesPerPixel = 3u;
+        break;
+    case MipMapGenerationPerformanceTest_RGBA8_1024:
+        m_size = 1024u;
+        m_bytesPerPixel = 4u;
+        break;
+    case MipMapGenerationPerformanceTest_RGBA8_2048:
+        m_size = 2048u;
+        m_bytesPerPixel = 4u;
+        break;
+    case MipMapGenerationPerformanceTest_RGBA8_2048_SRGB:
+        m_size = 2048u;
+        m_bytesPerPixel = 4u;
+        m_sRGB = true;
+        break;
+    case MipMapGenerationPerformanceTest_CubeRGBA8_512:
+        m_size = 512u;
+        m_bytesPerPixel = 4u;
+        m_cube = true;
+        break;
+    default:
+        assert(false);
+        break;
+    }
+
+    // deterministic content, so that all runs filter the same data
+    m_data.resize(m_size * m_size * m_bytesPerPixel * (m_cube ? 6u : 1u));
+    uint32_t seed = 12345u;
+    for (auto& value : m_data)
+    {
+        seed = seed * 1103515245u + 12345u;
+        value = static_cast<uint8_t>(seed >> 16);
+    }
+}
+
+void MipMapGenerationPerformanceTest::update()
+{
+    uint32_t mipMapCount = 0u;
+    if (m_cube)
+    {
+        ramses::CubeMipLevelData* mipData = ramses::RamsesUtils::GenerateMipMapsTextureCube(m_size, m_size, m_bytesPerPixel, m_data.data(), mipMapCount, m_sRGB);
+        ramses::RamsesUtils::DeleteGeneratedMipMaps(mipData, mipMapCount);
+    }
+    else
+    {
+        ramses::MipLevelData* mipData = ramses::RamsesUtils::GenerateMipMapsTexture2D(m_size, m_size, m_bytesPerPixel, m_data.data(), mipMapCount, m_sRGB);
+        ramses::RamsesUtils::DeleteGeneratedMipMaps(mipData, mipMapCount);
+    }
+}
@@ -0,0 +1,41 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_MIPMAPGENERATIONPERFORMANCETEST_H
+#define RAMSES_MIPMAPGENERATIONPERFORMANCETEST_H
+
+#include "PerformanceTestBase.h"
+#include <vector>
+
+class MipMapGenerationPerformanceTest : public PerformanceTestBase
+{
+public:
+    enum
+    {
+        MipMapGenerationPerformanceTest_R8_1024 = 0,
+        MipMapGenerationPerformanceTest_RGB8_1024,
+        MipMapGenerationPerformanceTest_RGBA8_1024,
+        MipMapGenerationPerformanceTest_RGBA8_2048,
+        MipMapGenerationPerformanceTest_RGBA8_2048_SRGB,
+        MipMapGenerationPerformanceTest_CubeRGBA8_512
+    };
+
+    MipMapGenerationPerformanceTest(ramses_internal::String testName, uint32_t testState);
+
+    virtual void initTest(ramses::RamsesClient& client, ramses::Scene& scene) override;
+    virtual void update() override;
+
+private:
+    uint32_t m_size = 0u;
+    uint8_t m_bytesPerPixel = 0u;
+    bool m_cube = false;
+    bool m_sRGB = false;
+    std::vector<uint8_t> m_data;
+};
+
+#endif
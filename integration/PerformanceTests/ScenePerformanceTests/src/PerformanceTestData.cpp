@@ -20,6 +20,11 @@
 #include "MemoryPoolTest.h"
 #include "NodeTopologyTest.h"
 #include "StringLayoutingPerformanceTest.h"
+#include "GlyphAtlasPerformanceTest.h"
+#include "LocalTransportPerformanceTest.h"
+#include "MipMapGenerationPerformanceTest.h"
+#include "ResourceHashingPerformanceTest.h"
+#include <thread>
 
 namespace ramses_internal {
 
@@ -140,6 +145,53 @@ void PerformanceTestData::init()
 
     {
         createTest<StringLayoutingPerformanceTest>("StringLayoutingPerformanceTest_LayoutBigString", StringLayoutingPerformanceTest::StringLayoutingPerformanceTest_LayoutBigString);
+        PerformanceTestBase* textLinesTest = createTest<StringLayoutingPerformanceTest>("StringLayoutingPerformanceTest_LayoutToTextLines", StringLayoutingPerformanceTest::StringLayoutingPerformanceTest_LayoutToTextLines);
+        PerformanceTestBase* batchedTextLinesTest = createTest<StringLayoutingPerformanceTest>("StringLayoutingPerformanceTest_LayoutToBatchedTextLines", StringLayoutingPerformanceTest::StringLayoutingPerformanceTest_LayoutToBatchedTextLines);
+
+        createAssert(batchedTextLinesTest).isFasterThan(textLinesTest);
+    }
+
+    {
+        createTest<GlyphAtlasPerformanceTest>("GlyphAtlasPerformanceTest_MapUniformGlyphs", GlyphAtlasPerformanceTest::GlyphAtlasPerformanceTest_MapUniformGlyphs);
+        createTest<GlyphAtlasPerformanceTest>("GlyphAtlasPerformanceTest_MapMixedSizeGlyphs", GlyphAtlasPerformanceTest::GlyphAtlasPerformanceTest_MapMixedSizeGlyphs);
+        createTest<GlyphAtlasPerformanceTest>("GlyphAtlasPerformanceTest_MapAndUnmapMixedSizeGlyphs", GlyphAtlasPerformanceTest::GlyphAtlasPerformanceTest_MapAndUnmapMixedSizeGlyphs);
+    }
+
+    {
+        createTest<MipMapGenerationPerformanceTest>("MipMapGenerationPerformanceTest_R8_1024", MipMapGenerationPerformanceTest::MipMapGenerationPerformanceTest_R8_1024);
+        createTest<MipMapGenerationPerformanceTest>("MipMapGenerationPerformanceTest_RGB8_1024", MipMapGenerationPerformanceTest::MipMapGenerationPerformanceTest_RGB8_1024);
+        createTest<MipMapGenerationPerformanceTest>("MipMapGenerationPerformanceTest_RGBA8_1024", MipMapGenerationPerformanceTest::MipMapGenerationPerformanceTest_RGBA8_1024);
+        createTest<MipMapGenerationPerformanceTest>("MipMapGenerationPerformanceTest_RGBA8_2048", MipMapGenerationPerformanceTest::MipMapGenerationPerformanceTest_RGBA8_2048);
+        createTest<MipMapGenerationPerformanceTest>("MipMapGenerationPerformanceTest_RGBA8_2048_SRGB", MipMapGenerationPerformanceTest::MipMapGenerationPerformanceTest_RGBA8_2048_SRGB);
+        createTest<MipMapGenerationPerformanceTest>("MipMapGenerationPerformanceTest_CubeRGBA8_512", MipMapGenerationPerformanceTest::MipMapGenerationPerformanceTest_CubeRGBA8_512);
+    }
+
+    {
+        createTest<ResourceHashingPerformanceTest>("ResourceHashingPerformanceTest_BelowThreshold", ResourceHashingPerformanceTest::ResourceHashingPerformanceTest_BelowThreshold);
+        PerformanceTestBase* singleThread = createTest<ResourceHashingPerformanceTest>("ResourceHashingPerformanceTest_Chunked_16MB_SingleThread", ResourceHashingPerformanceTest::ResourceHashingPerformanceTest_Chunked_16MB_SingleThread);
+        PerformanceTestBase* allThreads = createTest<ResourceHashingPerformanceTest>("ResourceHashingPerformanceTest_Chunked_16MB", ResourceHashingPerformanceTest::ResourceHashingPerformanceTest_Chunked_16MB);
+
+        if (std::thread::hardware_concurrency() > 1u)
+        {
+            createAssert(allThreads).isFasterThan(singleThread);
+        }
+    }
+
+    {
+        PerformanceTestBase* tcpSmall = createTest<LocalTransportPerformanceTest>("LocalTransportPerformanceTest_Tcp_SmallMessage", LocalTransportPerformanceTest::LocalTransportPerformanceTest_Tcp_SmallMessage);
+        PerformanceTestBase* tcpChunk = createTest<LocalTransportPerformanceTest>("LocalTransportPerformanceTest_Tcp_ResourceChunk", LocalTransportPerformanceTest::LocalTransportPerformanceTest_Tcp_ResourceChunk);
+        createTest<LocalTransportPerformanceTest>("LocalTransportPerformanceTest_Tcp_LargeMessage", LocalTransportPerformanceTest::LocalTransportPerformanceTest_Tcp_LargeMessage);
+        UNUSED(tcpSmall);
+        UNUSED(tcpChunk);
+#if defined(HAS_SHARED_MEMORY_COMM)
+        PerformanceTestBase* shmSmall = createTest<LocalTransportPerformanceTest>("LocalTransportPerformanceTest_SharedMemory_SmallMessage", LocalTransportPerformanceTest::LocalTransportPerformanceTest_SharedMemory_SmallMessage);
+        PerformanceTestBase* shmChunk = createTest<LocalTransportPerformanceTest>("LocalTransportPerformanceTest_SharedMemory_ResourceChunk", LocalTransportPerformanceTest::LocalTransportPerformanceTest_SharedMemory_ResourceChunk);
+        // passed as memory file, no assert since allocating its pages costs about as much as the copies of TCP
+        createTest<LocalTransportPerformanceTest>("LocalTransportPerformanceTest_SharedMemory_LargeMessage", LocalTransportPerformanceTest::LocalTransportPerformanceTest_SharedMemory_LargeMessage);
+
+        createAssert(shmSmall).isFasterThan(tcpSmall);
+        createAssert(shmChunk).isFasterThan(tcpChunk);
+#endif
     }
 }
 
@@ -0,0 +1,55 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "ResourceHashingPerformanceTest.h"
+#include "Resource/ResourceBase.h"
+#include <thread>
+
+using namespace ramses_internal;
+
+ResourceHashingPerformanceTest::ResourceHashingPerformanceTest(ramses_internal::String testName, uint32_t testState)
+    : PerformanceTestBase(testName, testState)
+{
+}
+
+void ResourceHashingPerformanceTest::initTest(ramses::RamsesClient& client, ramses::Scene& scene)
+{
+    UNUSED(client);
+    UNUSED(scene);
+
+    switch (m_testState)
+    {
+    case ResourceHashingPerformanceTest_BelowThreshold:
+        m_data.resize(ResourceBase::DefaultChunkedHashingThreshold - 1u);
+        break;
+    case ResourceHashingPerformanceTest_Chunked_16MB_SingleThread:
+        m_data.resize(16u * 1024u * 1024u);
+        break;
+    case ResourceHashingPerformanceTest_Chunked_16MB:
+        m_data.resize(16u * 1024u * 1024u);
+        m_threadCount = std::thread::hardware_concurrency();
+        break;
+    default:
+        assert(false);
+        break;
+    }
+
+    // deterministic content, so that all runs hash the same data
+    uint32_t seed = 12345u;
+    for (auto& value : m_data)
+    {
+        seed = seed * 1103515245u + 12345u;
+        value = static_cast<Byte>(seed >> 16);
+    }
+}
+
+void ResourceHashingPerformanceTest::update()
+{
+    const ResourceContentHash hash = ResourceBase::HashResourceData(m_data.data(), static_cast<UInt32>(m_data.size()), ResourceBase::DefaultChunkedHashingThreshold, m_threadCount);
+    UNUSED(hash);
+}
@@ -0,0 +1,37 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_RESOURCEHASHINGPERFORMANCETEST_H
+#define RAMSES_RESOURCEHASHINGPERFORMANCETEST_H
+
+#include "PerformanceTestBase.h"
+#include <vector>
+
+// Hashing of resource data as done when a resource is created. Data below the chunked hashing threshold is
+// hashed at once, larger data in chunks on one or all available threads.
+class ResourceHashingPerformanceTest : public PerformanceTestBase
+{
+public:
+    enum
+    {
+        ResourceHashingPerformanceTest_BelowThreshold = 0,
+        ResourceHashingPerformanceTest_Chunked_16MB_SingleThread,
+        ResourceHashingPerformanceTest_Chunked_16MB
+    };
+
+    ResourceHashingPerformanceTest(ramses_internal::String testName, uint32_t testState);
+
+    virtual void initTest(ramses::RamsesClient& client, ramses::Scene& scene) override;
+    virtual void update() override;
+
+private:
+    uint32_t m_threadCount = 1u;
+    std::vector<ramses_internal::Byte> m_data;
+};
+
+#endif
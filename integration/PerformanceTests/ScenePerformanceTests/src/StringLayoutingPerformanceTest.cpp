@@ -9,7 +9,8 @@
 #include "StringLayoutingPerformanceTest.h"
 #include "ramses-text-api/UtfUtils.h"
 #include "ramses-text-api/LayoutUtils.h"
-#include "ramses-text-api/TextCache.h"
+#include "ramses-client-api/UniformInput.h"
+#include "ramses-utils.h"
 #include <fstream>
 
 StringLayoutingPerformanceTest::StringLayoutingPerformanceTest(ramses_internal::String testName, uint32_t testState)
@@ -17,7 +18,7 @@ StringLayoutingPerformanceTest::StringLayoutingPerformanceTest(ramses_internal::
 {
 };
 
-void StringLayoutingPerformanceTest::initTest(ramses::RamsesClient&, ramses::Scene& scene)
+void StringLayoutingPerformanceTest::initTest(ramses::RamsesClient& client, ramses::Scene& scene)
 {
     std::ifstream input("res/BigString.txt", std::ios::binary);
     const std::string fileContents{ std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>() };
@@ -29,15 +30,76 @@ void StringLayoutingPerformanceTest::initTest(ramses::RamsesClient&, ramses::Sce
     const auto fontId = m_fontRegistry.createFreetype2Font("res/ramses-test-client-Roboto-Regular.ttf");
     const auto fontInstId = m_fontRegistry.createFreetype2FontInstance(fontId, 24u);
 
-    ramses::TextCache textCache{ scene, m_fontRegistry, 16u, 16u };
-    m_glyphs = textCache.getPositionedGlyphs(m_string, fontInstId);
+    if (m_testState == StringLayoutingPerformanceTest_LayoutBigString)
+    {
+        ramses::TextCache textCache{ scene, m_fontRegistry, 16u, 16u };
+        m_glyphs = textCache.getPositionedGlyphs(m_string, fontInstId);
+    }
+    else
+    {
+        m_textCache.reset(new ramses::TextCache{ scene, m_fontRegistry, 1024u, 1024u });
+        m_glyphs = m_textCache->getPositionedGlyphs(m_string, fontInstId);
+
+        ramses::UniformInput colorInput;
+        m_textEffect = ramses::RamsesUtils::CreateStandardTextEffect(client, colorInput);
+        assert(m_textEffect != nullptr);
+        m_textLines.resize(NumTextLines, ramses::InvalidTextLineId);
+    }
     assert(!m_glyphs.empty());
     m_currentIter = m_glyphs.cbegin();
 }
 
 void StringLayoutingPerformanceTest::update()
 {
-    m_currentIter = ramses::LayoutUtils::FindFittingSubstring(m_currentIter, m_glyphs.cend(), 800u);
-    if (m_currentIter == m_glyphs.cend())
+    switch (m_testState)
+    {
+    case StringLayoutingPerformanceTest_LayoutBigString:
+    {
+        m_currentIter = ramses::LayoutUtils::FindFittingSubstring(m_currentIter, m_glyphs.cend(), 800u);
+        if (m_currentIter == m_glyphs.cend())
+            m_currentIter = m_glyphs.cbegin();
+        break;
+    }
+    case StringLayoutingPerformanceTest_LayoutToTextLines:
+    case StringLayoutingPerformanceTest_LayoutToBatchedTextLines:
+    {
+        layoutNextTextLine();
+        break;
+    }
+    default:
+    {
+        assert(false);
+        break;
+    }
+    }
+}
+
+void StringLayoutingPerformanceTest::layoutNextTextLine()
+{
+    // lay out next line of text and replace the oldest text line in scene with it
+    auto lineEnd = ramses::LayoutUtils::FindFittingSubstring(m_currentIter, m_glyphs.cend(), 800u);
+    if (lineEnd == m_currentIter)
+    {
         m_currentIter = m_glyphs.cbegin();
+        lineEnd = ramses::LayoutUtils::FindFittingSubstring(m_currentIter, m_glyphs.cend(), 800u);
+    }
+    const ramses::GlyphMetricsVector lineGlyphs{ m_currentIter, lineEnd };
+    m_currentIter = (lineEnd == m_glyphs.cend() ? m_glyphs.cbegin() : lineEnd);
+
+    ramses::TextLineId& textLine = m_textLines[m_nextTextLine];
+    if (m_testState == StringLayoutingPerformanceTest_LayoutToBatchedTextLines)
+    {
+        if (textLine == ramses::InvalidTextLineId)
+            textLine = m_textCache->createBatchedTextLine(lineGlyphs, *m_textEffect, 0.f, 30.f * m_nextTextLine);
+        else
+            m_textCache->updateTextLine(textLine, lineGlyphs);
+    }
+    else
+    {
+        if (textLine != ramses::InvalidTextLineId)
+            m_textCache->deleteTextLine(textLine);
+        textLine = m_textCache->createTextLine(lineGlyphs, *m_textEffect);
+    }
+
+    m_nextTextLine = (m_nextTextLine + 1u) % NumTextLines;
 }
@@ -12,7 +12,10 @@
 #include "PerformanceTestBase.h"
 #include "ramses-text-api/FontRegistry.h"
 #include "ramses-text-api/GlyphMetrics.h"
+#include "ramses-text-api/TextCache.h"
 #include <string>
+#include <vector>
+#include <memory>
 
 class StringLayoutingPerformanceTest : public PerformanceTestBase
 {
@@ -20,6 +23,8 @@ public:
     enum
     {
         StringLayoutingPerformanceTest_LayoutBigString = 0,
+        StringLayoutingPerformanceTest_LayoutToTextLines,
+        StringLayoutingPerformanceTest_LayoutToBatchedTextLines,
     };
 
     StringLayoutingPerformanceTest(ramses_internal::String testName, uint32_t testState);
@@ -28,9 +33,19 @@ public:
     virtual void update() override;
 
 private:
+    void layoutNextTextLine();
+
+    // number of text lines alive at a time, cycled through on every update
+    static const uint32_t NumTextLines = 200u;
+
     std::u32string m_string;
     ramses::GlyphMetricsVector m_glyphs;
     ramses::FontRegistry m_fontRegistry;
     ramses::GlyphMetricsVector::const_iterator m_currentIter;
+
+    std::unique_ptr<ramses::TextCache> m_textCache;
+    const ramses::Effect* m_textEffect = nullptr;
+    std::vector<ramses::TextLineId> m_textLines;
+    uint32_t m_nextTextLine = 0u;
 };
 #endif
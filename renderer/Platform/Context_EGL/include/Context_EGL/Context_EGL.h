@@ -57,6 +57,7 @@ namespace ramses_internal
         Bool disable();
 
         void* getProcAddress(const char* name) const override;
+        UInt32 getBufferAge() const override;
 
     private:
         EglSurfaceData m_eglSurfaceData;
@@ -66,6 +67,7 @@ namespace ramses_internal
         const EGLint* m_surfaceAttributes;
         const EGLint* m_windowSurfaceAttributes;
         const EGLint m_swapInterval;
+        Bool m_bufferAgeSupported = false;
     };
 
 }
@@ -9,6 +9,10 @@
 #include "Context_EGL/Context_EGL.h"
 #include "Utils/LogMacros.h"
 
+#ifndef EGL_BUFFER_AGE_EXT
+#define EGL_BUFFER_AGE_EXT 0x313D
+#endif
+
 namespace ramses_internal
 {
     Context_EGL::Context_EGL(EGLNativeDisplayType eglDisplay, Generic_EGLNativeWindowType eglWindow, const EGLint* contextAttributes, const EGLint* surfaceAttributes, const EGLint* windowSurfaceAttributes, EGLint swapInterval, Context_EGL* sharedContext /*= 0*/)
@@ -51,6 +55,7 @@ namespace ramses_internal
         {
             LOG_INFO(CONTEXT_RENDERER, "Context_EGL::init(): EGL extensions: " << contextExtensionsNativeString);
             parseContextExtensions(contextExtensionsNativeString);
+            m_bufferAgeSupported = isContextExtensionAvailable("buffer_age");
         }
         else
         {
@@ -204,4 +209,14 @@ namespace ramses_internal
     {
         return reinterpret_cast<void*>(eglGetProcAddress(name));
     }
+
+    UInt32 Context_EGL::getBufferAge() const
+    {
+        EGLint bufferAge = 0;
+        if (m_bufferAgeSupported && eglQuerySurface(m_eglSurfaceData.eglDisplay, m_eglSurfaceData.eglSurface, EGL_BUFFER_AGE_EXT, &bufferAge) && bufferAge > 0)
+        {
+            return static_cast<UInt32>(bufferAge);
+        }
+        return 0u;
+    }
 }
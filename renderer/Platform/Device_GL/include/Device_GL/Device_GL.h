@@ -11,6 +11,7 @@
 
 #include "Platform_Base/Device_Base.h"
 #include "Platform_Base/DeviceResourceMapper.h"
+#include "Platform_Base/UniformBufferData.h"
 #include "Types_GL.h"
 #include "DebugOutput.h"
 
@@ -65,6 +66,7 @@ namespace ramses_internal
         virtual void setConstant(DataFieldHandle field, UInt32 count, const Matrix22f*  value) override;
         virtual void setConstant(DataFieldHandle field, UInt32 count, const Matrix33f*  value) override;
         virtual void setConstant(DataFieldHandle field, UInt32 count, const Matrix44f*  value) override;
+        virtual void setInstanceWorldMatrices(DataFieldHandle field, UInt32 count, const Matrix44f* matrices) override;
 
         virtual void readPixels(UInt8* buffer, UInt32 x, UInt32 y, UInt32 width, UInt32 height) override;
 
@@ -78,6 +80,10 @@ namespace ramses_internal
         virtual void                    deleteIndexBuffer     (DeviceResourceHandle handle) override;
         virtual void                    activateIndexBuffer   (DeviceResourceHandle handle) override;
 
+        virtual DeviceResourceHandle    allocateVertexArray   (const VertexArrayInfo& vertexArrayInfo) override;
+        virtual void                    activateVertexArray   (DeviceResourceHandle handle) override;
+        virtual void                    deleteVertexArray     (DeviceResourceHandle handle) override;
+
         virtual DeviceResourceHandle    uploadShader        (const EffectResource& shader) override;
         virtual DeviceResourceHandle    uploadBinaryShader  (const EffectResource& shader, const UInt8* binaryShaderData, UInt32 binaryShaderDataSize, UInt32 binaryShaderFormat) override;
         virtual Bool                    getBinaryShader     (DeviceResourceHandle handleconst, UInt8Vector& binaryShader, UInt32& binaryShaderFormat) override;
@@ -89,6 +95,7 @@ namespace ramses_internal
         virtual DeviceResourceHandle    allocateTextureCube (UInt32 faceSize, ETextureFormat textureFormat, UInt32 mipLevelCount, UInt32 totalSizeInBytes) override;
         virtual void                    bindTexture         (DeviceResourceHandle handle) override;
         virtual void                    generateMipmaps     (DeviceResourceHandle handle) override;
+        virtual void                    setTextureBaseMipLevel(DeviceResourceHandle handle, UInt32 baseMipLevel) override;
         virtual void                    uploadTextureData   (DeviceResourceHandle handle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 z, UInt32 width, UInt32 height, UInt32 depth, const Byte* data, UInt32 dataSize) override;
         virtual DeviceResourceHandle    uploadStreamTexture2D(DeviceResourceHandle handle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8* data) override;
         virtual void                    deleteTexture       (DeviceResourceHandle handle) override;
@@ -134,8 +141,29 @@ namespace ramses_internal
 
         Vector<RenderTargetPair> m_pairedRenderTargets;
 
+        // Every block value set used in a frame goes to its own slot of a ring buffer and is bound with its range,
+        // so that draws sharing a shader but using different data instances do not rewrite storage of previous draws
+        static const UInt32 UniformBufferSlotCount = 64u;
+        struct UniformBuffer_GL
+        {
+            UniformBufferData data;
+            GLHandle          bufferHandle;
+            UInt32            slotSize;
+            UInt32            currentSlot;
+        };
+        typedef Vector<UniformBuffer_GL> UniformBufferVector;
+
+        // std140 uniform blocks of shaders, index of buffer in vector is binding point of its block
+        HashMap<DeviceResourceHandle, UniformBufferVector> m_uniformBuffers;
+        UInt32                      m_uniformBufferOffsetAlignment;
+
+        // stream buffer for world matrices of instances drawn in one batch, re-specified for every batch
+        GLHandle                    m_instanceWorldMatrixBuffer;
+
         // Active states for upcoming draw call(s)
         const ShaderGPUResource_GL* m_activeShader;
+        DeviceResourceHandle        m_activeShaderHandle;
+        DeviceResourceHandle        m_activeVertexArray;
         EDrawMode                   m_activePrimitiveDrawMode;
         UInt32                      m_activeIndexArrayElementSizeBytes;
 
@@ -146,7 +174,14 @@ namespace ramses_internal
         StringSet                   m_apiExtensions;
 
         Bool getUniformLocation(DataFieldHandle field, GLInputLocation& location) const;
+        template <typename T>
+        void setUniformBufferMember(DataFieldHandle field, UInt32 count, const T* value);
+        Bool areUniformBlocksSupported(const EffectResource& effect) const;
+        void createUniformBuffers(DeviceResourceHandle shaderHandle, const EffectResource& effect);
+        void deleteUniformBuffers(DeviceResourceHandle shaderHandle);
+        void uploadAndBindUniformBuffers();
         Bool getAttributeLocation(DataFieldHandle field, GLInputLocation& location) const;
+        void deactivateVertexArray();
 
         Bool allBuffersHaveTheSameSize(const DeviceHandleVector& renderBuffers) const;
         void bindRenderBufferToRenderTarget(const RenderBufferGPUResource& renderBufferGpuResource, const UInt32 colorBufferSlot);
@@ -60,6 +60,7 @@
 #define glVertexAttrib3fv(...)          glVertexAttrib3fvNative(__VA_ARGS__)
 #define glVertexAttrib4fv(...)          glVertexAttrib4fvNative(__VA_ARGS__)
 #define glEnableVertexAttribArray(...)  glEnableVertexAttribArrayNative(__VA_ARGS__)
+#define glDisableVertexAttribArray(...) glDisableVertexAttribArrayNative(__VA_ARGS__)
 #define glBindAttribLocation(...)       glBindAttribLocationNative(__VA_ARGS__)
 #define glGetActiveUniform(...)         glGetActiveUniformNative(__VA_ARGS__)
 #define glGetActiveAttrib(...)          glGetActiveAttribNative(__VA_ARGS__)
@@ -71,6 +72,7 @@
 #define glGetShaderiv(...)              glGetShaderivNative(__VA_ARGS__)
 #define glGenVertexArrays(...)          glGenVertexArraysNative(__VA_ARGS__)
 #define glBindVertexArray(...)          glBindVertexArrayNative(__VA_ARGS__)
+#define glDeleteVertexArrays(...)       glDeleteVertexArraysNative(__VA_ARGS__)
 #define glGenBuffers(...)               glGenBuffersNative(__VA_ARGS__)
 #define glBindBuffer(...)               glBindBufferNative(__VA_ARGS__)
 #define glBufferData(...)               glBufferDataNative(__VA_ARGS__)
@@ -109,6 +111,10 @@
 #define glTexSubImage3D(...)            glTexSubImage3DNative(__VA_ARGS__)
 #define glCompressedTexSubImage2D(...)  glCompressedTexSubImage2DNative(__VA_ARGS__)
 #define glCompressedTexSubImage3D(...)  glCompressedTexSubImage3DNative(__VA_ARGS__)
+#define glBufferSubData(...)            glBufferSubDataNative(__VA_ARGS__)
+#define glGetUniformBlockIndex(...)     glGetUniformBlockIndexNative(__VA_ARGS__)
+#define glUniformBlockBinding(...)      glUniformBlockBindingNative(__VA_ARGS__)
+#define glBindBufferRange(...)          glBindBufferRangeNative(__VA_ARGS__)
 
 #define DECLARE_ALL_API_PROCS                                                                   \
 DECLARE_API_PROC(PFNGLGETSTRINGIPROC, glGetStringi);                                            \
@@ -143,6 +149,7 @@ DECLARE_API_PROC(PFNGLVERTEXATTRIB2FVPROC, glVertexAttrib2fv);
 DECLARE_API_PROC(PFNGLVERTEXATTRIB3FVPROC, glVertexAttrib3fv);                                  \
 DECLARE_API_PROC(PFNGLVERTEXATTRIB4FVPROC, glVertexAttrib4fv);                                  \
 DECLARE_API_PROC(PFNGLENABLEVERTEXATTRIBARRAYPROC, glEnableVertexAttribArray);                  \
+DECLARE_API_PROC(PFNGLDISABLEVERTEXATTRIBARRAYPROC, glDisableVertexAttribArray);                \
 DECLARE_API_PROC(PFNGLBINDATTRIBLOCATIONPROC, glBindAttribLocation);                            \
 DECLARE_API_PROC(PFNGLGETACTIVEUNIFORMPROC, glGetActiveUniform);                                \
 DECLARE_API_PROC(PFNGLGETACTIVEATTRIBPROC, glGetActiveAttrib);                                  \
@@ -154,6 +161,7 @@ DECLARE_API_PROC(PFNGLCOMPILESHADERPROC, glCompileShader);
 DECLARE_API_PROC(PFNGLGETSHADERIVPROC, glGetShaderiv);                                          \
 DECLARE_API_PROC(PFNGLGENVERTEXARRAYSPROC, glGenVertexArrays);                                  \
 DECLARE_API_PROC(PFNGLBINDVERTEXARRAYPROC, glBindVertexArray);                                  \
+DECLARE_API_PROC(PFNGLDELETEVERTEXARRAYSPROC, glDeleteVertexArrays);                            \
 DECLARE_API_PROC(PFNGLGENBUFFERSPROC, glGenBuffers);                                            \
 DECLARE_API_PROC(PFNGLBINDBUFFERPROC, glBindBuffer);                                            \
 DECLARE_API_PROC(PFNGLBUFFERDATAPROC, glBufferData);                                            \
@@ -192,6 +200,10 @@ DECLARE_API_PROC(PFNGLTEXSTORAGE3DPROC, glTexStorage3D);
 DECLARE_API_PROC(PFNGLTEXSUBIMAGE3DPROC, glTexSubImage3D);                                      \
 DECLARE_API_PROC(PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, glCompressedTexSubImage2D);                  \
 DECLARE_API_PROC(PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, glCompressedTexSubImage3D);                  \
+DECLARE_API_PROC(PFNGLBUFFERSUBDATAPROC, glBufferSubData);                                      \
+DECLARE_API_PROC(PFNGLGETUNIFORMBLOCKINDEXPROC, glGetUniformBlockIndex);                        \
+DECLARE_API_PROC(PFNGLUNIFORMBLOCKBINDINGPROC, glUniformBlockBinding);                          \
+DECLARE_API_PROC(PFNGLBINDBUFFERRANGEPROC, glBindBufferRange);                                  \
 
 #define LOAD_ALL_API_PROCS                                                                          \
 LOAD_API_PROC(m_context, PFNGLGETSTRINGIPROC, glGetStringi);                                        \
@@ -226,6 +238,7 @@ LOAD_API_PROC(m_context, PFNGLVERTEXATTRIB2FVPROC, glVertexAttrib2fv);
 LOAD_API_PROC(m_context, PFNGLVERTEXATTRIB3FVPROC, glVertexAttrib3fv);                              \
 LOAD_API_PROC(m_context, PFNGLVERTEXATTRIB4FVPROC, glVertexAttrib4fv);                              \
 LOAD_API_PROC(m_context, PFNGLENABLEVERTEXATTRIBARRAYPROC, glEnableVertexAttribArray);              \
+LOAD_API_PROC(m_context, PFNGLDISABLEVERTEXATTRIBARRAYPROC, glDisableVertexAttribArray);            \
 LOAD_API_PROC(m_context, PFNGLBINDATTRIBLOCATIONPROC, glBindAttribLocation);                        \
 LOAD_API_PROC(m_context, PFNGLGETACTIVEUNIFORMPROC, glGetActiveUniform);                            \
 LOAD_API_PROC(m_context, PFNGLGETACTIVEATTRIBPROC, glGetActiveAttrib);                              \
@@ -237,6 +250,7 @@ LOAD_API_PROC(m_context, PFNGLCOMPILESHADERPROC, glCompileShader);
 LOAD_API_PROC(m_context, PFNGLGETSHADERIVPROC, glGetShaderiv);                                      \
 LOAD_API_PROC(m_context, PFNGLGENVERTEXARRAYSPROC, glGenVertexArrays);                              \
 LOAD_API_PROC(m_context, PFNGLBINDVERTEXARRAYPROC, glBindVertexArray);                              \
+LOAD_API_PROC(m_context, PFNGLDELETEVERTEXARRAYSPROC, glDeleteVertexArrays);                        \
 LOAD_API_PROC(m_context, PFNGLGENBUFFERSPROC, glGenBuffers);                                        \
 LOAD_API_PROC(m_context, PFNGLBINDBUFFERPROC, glBindBuffer);                                        \
 LOAD_API_PROC(m_context, PFNGLBUFFERDATAPROC, glBufferData);                                        \
@@ -276,6 +290,10 @@ LOAD_API_PROC(m_context, PFNGLTEXSTORAGE3DPROC, glTexStorage3D);
 LOAD_API_PROC(m_context, PFNGLTEXSUBIMAGE3DPROC, glTexSubImage3D);                                  \
 LOAD_API_PROC(m_context, PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, glCompressedTexSubImage2D);              \
 LOAD_API_PROC(m_context, PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, glCompressedTexSubImage3D);              \
+LOAD_API_PROC(m_context, PFNGLBUFFERSUBDATAPROC, glBufferSubData);                                  \
+LOAD_API_PROC(m_context, PFNGLGETUNIFORMBLOCKINDEXPROC, glGetUniformBlockIndex);                    \
+LOAD_API_PROC(m_context, PFNGLUNIFORMBLOCKBINDINGPROC, glUniformBlockBinding);                      \
+LOAD_API_PROC(m_context, PFNGLBINDBUFFERRANGEPROC, glBindBufferRange);                              \
 
 //In WGL (Windows), all api procs are static and need explicit definition in a source file
 #define DEFINE_ALL_API_PROCS                                                                   \
@@ -311,6 +329,7 @@ DEFINE_API_PROC(PFNGLVERTEXATTRIB2FVPROC, glVertexAttrib2fv);
 DEFINE_API_PROC(PFNGLVERTEXATTRIB3FVPROC, glVertexAttrib3fv);                                  \
 DEFINE_API_PROC(PFNGLVERTEXATTRIB4FVPROC, glVertexAttrib4fv);                                  \
 DEFINE_API_PROC(PFNGLENABLEVERTEXATTRIBARRAYPROC, glEnableVertexAttribArray);                  \
+DEFINE_API_PROC(PFNGLDISABLEVERTEXATTRIBARRAYPROC, glDisableVertexAttribArray);                \
 DEFINE_API_PROC(PFNGLBINDATTRIBLOCATIONPROC, glBindAttribLocation);                            \
 DEFINE_API_PROC(PFNGLGETACTIVEUNIFORMPROC, glGetActiveUniform);                                \
 DEFINE_API_PROC(PFNGLGETACTIVEATTRIBPROC, glGetActiveAttrib);                                  \
@@ -322,6 +341,7 @@ DEFINE_API_PROC(PFNGLCOMPILESHADERPROC, glCompileShader);
 DEFINE_API_PROC(PFNGLGETSHADERIVPROC, glGetShaderiv);                                          \
 DEFINE_API_PROC(PFNGLGENVERTEXARRAYSPROC, glGenVertexArrays);                                  \
 DEFINE_API_PROC(PFNGLBINDVERTEXARRAYPROC, glBindVertexArray);                                  \
+DEFINE_API_PROC(PFNGLDELETEVERTEXARRAYSPROC, glDeleteVertexArrays);                            \
 DEFINE_API_PROC(PFNGLGENBUFFERSPROC, glGenBuffers);                                            \
 DEFINE_API_PROC(PFNGLBINDBUFFERPROC, glBindBuffer);                                            \
 DEFINE_API_PROC(PFNGLBUFFERDATAPROC, glBufferData);                                            \
@@ -360,5 +380,9 @@ DEFINE_API_PROC(PFNGLTEXSTORAGE3DPROC, glTexStorage3D);
 DEFINE_API_PROC(PFNGLTEXSUBIMAGE3DPROC, glTexSubImage3D);                                      \
 DEFINE_API_PROC(PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, glCompressedTexSubImage2D);                  \
 DEFINE_API_PROC(PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, glCompressedTexSubImage3D);                  \
+DEFINE_API_PROC(PFNGLBUFFERSUBDATAPROC, glBufferSubData);                                      \
+DEFINE_API_PROC(PFNGLGETUNIFORMBLOCKINDEXPROC, glGetUniformBlockIndex);                        \
+DEFINE_API_PROC(PFNGLUNIFORMBLOCKBINDINGPROC, glUniformBlockBinding);                          \
+DEFINE_API_PROC(PFNGLBINDBUFFERRANGEPROC, glBindBufferRange);                                  \
 
 #endif
@@ -11,6 +11,7 @@
 
 #include "Platform_Base/ShaderGPUResource.h"
 #include "Device_GL/ShaderProgramInfo.h"
+#include "Platform_Base/UniformBufferData.h"
 #include "Resource/EffectResource.h"
 #include "Utils/LogMacros.h"
 
@@ -44,6 +45,7 @@ namespace ramses_internal
         void                preloadVariableLocations(const EffectResource& effect);
         GLInputLocation     loadUniformLocation(const EffectResource& effect, const EffectInputInformation& input) const;
         GLInputLocation     loadAttributeLocation(const EffectResource& effect, const EffectInputInformation& input) const;
+        void                bindUniformBlocks(const EffectResource& effect) const;
 
         ShaderProgramInfo m_shaderProgramInfo;
 
@@ -139,9 +141,35 @@ namespace ramses_internal
                 m_bufferSlots.put(DataFieldHandle(i), bufferSlot);
             }
 
+            // members of uniform blocks have no location, their values are set through uniform buffer
+            if (input.uniformBlockName.getLength() != 0u)
+            {
+                m_uniformLocationMap[i] = GLInputLocationInvalid;
+                continue;
+            }
+
             const GLInputLocation location = loadUniformLocation(effect, input);
             m_uniformLocationMap[i] = location;
         }
+
+        bindUniformBlocks(effect);
+    }
+
+    inline void ShaderGPUResource_GL::bindUniformBlocks(const EffectResource& effect) const
+    {
+        const Vector<String> uniformBlockNames = UniformBufferData::GetUniformBlockNames(effect.getUniformInputs());
+        for (UInt32 bindingPoint = 0u; bindingPoint < uniformBlockNames.size(); ++bindingPoint)
+        {
+            const Char* blockName = uniformBlockNames[bindingPoint].c_str();
+            const GLuint blockIndex = glGetUniformBlockIndex(m_shaderProgramInfo.shaderProgramHandle, blockName);
+            if (blockIndex == GL_INVALID_INDEX)
+            {
+                LOG_WARN(CONTEXT_RENDERER, "ShaderGPUResource_GL::bindUniformBlocks:  glGetUniformBlockIndex for effect '" << effect.getName() << "' for uniform block '" << blockName << "' failed");
+                continue;
+            }
+
+            glUniformBlockBinding(m_shaderProgramInfo.shaderProgramHandle, blockIndex, bindingPoint);
+        }
     }
 
     inline GLInputLocation ShaderGPUResource_GL::loadAttributeLocation(const EffectResource& effect, const EffectInputInformation& input) const
@@ -12,6 +12,7 @@
 #include "Platform_Base/RenderBufferGPUResource.h"
 #include "Platform_Base/IndexBufferGPUResource.h"
 #include "Platform_Base/VertexBufferGPUResource.h"
+#include "Platform_Base/VertexArrayGPUResource.h"
 #include "Platform_Base/TextureSamplerGPUResource.h"
 
 #include "Device_GL/Device_GL_platform.h"
@@ -71,7 +72,11 @@ namespace ramses_internal
         : Device_Base()
         , m_context(context)
         , m_resourceMapper(context.getResources())
+        , m_uniformBufferOffsetAlignment(256u)
+        , m_instanceWorldMatrixBuffer(InvalidGLHandle)
         , m_activeShader(0)
+        , m_activeShaderHandle()
+        , m_activeVertexArray()
         , m_activePrimitiveDrawMode(EDrawMode::Triangles)
         , m_activeIndexArrayElementSizeBytes(2u)
         , m_majorApiVersion(majorApiVersion)
@@ -118,6 +123,8 @@ namespace ramses_internal
 
     Device_GL::~Device_GL()
     {
+        if (m_instanceWorldMatrixBuffer != InvalidGLHandle)
+            glDeleteBuffers(1, &m_instanceWorldMatrixBuffer);
         m_resourceMapper.deleteResource(m_framebufferRenderTarget);
     }
 
@@ -178,6 +185,8 @@ namespace ramses_internal
         const UInt startOffsetAddressAsUInt = startOffset * m_activeIndexArrayElementSizeBytes;
         const GLvoid* startOffsetAddress = reinterpret_cast<void*>(startOffsetAddressAsUInt);
 
+        uploadAndBindUniformBuffers();
+
         const GLenum drawModeGL = TypesConversion_GL::GetDrawMode(m_activePrimitiveDrawMode);
         const GLenum elementTypeGL = TypesConversion_GL::GetIndexElementType(m_activeIndexArrayElementSizeBytes);
         if (instanceCount > 1u)
@@ -195,6 +204,8 @@ namespace ramses_internal
 
     void Device_GL::drawTriangles(Int32 startOffset, Int32 elementCount, UInt32 instanceCount)
     {
+        uploadAndBindUniformBuffers();
+
         const GLenum drawModeGL = TypesConversion_GL::GetDrawMode(m_activePrimitiveDrawMode);
         if (instanceCount > 1u)
         {
@@ -412,6 +423,106 @@ namespace ramses_internal
         return location != GLInputLocationInvalid;
     }
 
+    template <typename T>
+    void Device_GL::setUniformBufferMember(DataFieldHandle field, UInt32 count, const T* value)
+    {
+        UniformBufferVector* uniformBuffers = m_uniformBuffers.get(m_activeShaderHandle);
+        if (uniformBuffers == nullptr)
+        {
+            return;
+        }
+
+        assert(0 != value);
+        for (auto& uniformBuffer : *uniformBuffers)
+        {
+            if (uniformBuffer.data.hasMember(field))
+            {
+                uniformBuffer.data.setMemberValue(field, count, reinterpret_cast<const Byte*>(value));
+                return;
+            }
+        }
+    }
+
+    void Device_GL::uploadAndBindUniformBuffers()
+    {
+        UniformBufferVector* uniformBuffers = m_uniformBuffers.get(m_activeShaderHandle);
+        if (uniformBuffers == nullptr)
+        {
+            return;
+        }
+
+        for (UInt32 bindingPoint = 0u; bindingPoint < uniformBuffers->size(); ++bindingPoint)
+        {
+            UniformBuffer_GL& uniformBuffer = (*uniformBuffers)[bindingPoint];
+            if (uniformBuffer.data.isModified())
+            {
+                uniformBuffer.currentSlot = (uniformBuffer.currentSlot + 1u) % UniformBufferSlotCount;
+                glBindBuffer(GL_UNIFORM_BUFFER, uniformBuffer.bufferHandle);
+                if (uniformBuffer.currentSlot == 0u)
+                {
+                    // all slots used, orphan storage instead of waiting for draws still reading from it
+                    glBufferData(GL_UNIFORM_BUFFER, uniformBuffer.slotSize * UniformBufferSlotCount, nullptr, GL_DYNAMIC_DRAW);
+                }
+                glBufferSubData(GL_UNIFORM_BUFFER, uniformBuffer.currentSlot * uniformBuffer.slotSize, uniformBuffer.data.getSize(), uniformBuffer.data.getData());
+                uniformBuffer.data.resetModified();
+            }
+            glBindBufferRange(GL_UNIFORM_BUFFER, bindingPoint, uniformBuffer.bufferHandle, uniformBuffer.currentSlot * uniformBuffer.slotSize, uniformBuffer.data.getSize());
+        }
+    }
+
+    Bool Device_GL::areUniformBlocksSupported(const EffectResource& effect) const
+    {
+        const UInt32 uniformBlockCount = static_cast<UInt32>(UniformBufferData::GetUniformBlockNames(effect.getUniformInputs()).size());
+        if (uniformBlockCount > m_limits.getMaximumUniformBufferBindings())
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "Device_GL::areUniformBlocksSupported: effect " << effect.getName() << " uses " << uniformBlockCount
+                << " uniform blocks, device supports " << m_limits.getMaximumUniformBufferBindings() << " uniform buffer bindings");
+            return false;
+        }
+        return true;
+    }
+
+    void Device_GL::createUniformBuffers(DeviceResourceHandle shaderHandle, const EffectResource& effect)
+    {
+        const Vector<String> uniformBlockNames = UniformBufferData::GetUniformBlockNames(effect.getUniformInputs());
+        if (uniformBlockNames.empty())
+        {
+            return;
+        }
+
+        UniformBufferVector uniformBuffers;
+        for (const auto& blockName : uniformBlockNames)
+        {
+            UniformBuffer_GL uniformBuffer = { UniformBufferData(blockName, effect.getUniformInputs()), InvalidGLHandle, 0u, 0u };
+            const UInt32 dataSize = uniformBuffer.data.getSize();
+            uniformBuffer.slotSize = ((dataSize + m_uniformBufferOffsetAlignment - 1u) / m_uniformBufferOffsetAlignment) * m_uniformBufferOffsetAlignment;
+            glGenBuffers(1, &uniformBuffer.bufferHandle);
+            assert(uniformBuffer.bufferHandle != InvalidGLHandle);
+
+            glBindBuffer(GL_UNIFORM_BUFFER, uniformBuffer.bufferHandle);
+            glBufferData(GL_UNIFORM_BUFFER, uniformBuffer.slotSize * UniformBufferSlotCount, nullptr, GL_DYNAMIC_DRAW);
+            glBufferSubData(GL_UNIFORM_BUFFER, 0, dataSize, uniformBuffer.data.getData());
+            uniformBuffer.data.resetModified();
+            uniformBuffers.push_back(uniformBuffer);
+        }
+        m_uniformBuffers.put(shaderHandle, uniformBuffers);
+    }
+
+    void Device_GL::deleteUniformBuffers(DeviceResourceHandle shaderHandle)
+    {
+        UniformBufferVector* uniformBuffers = m_uniformBuffers.get(shaderHandle);
+        if (uniformBuffers == nullptr)
+        {
+            return;
+        }
+
+        for (const auto& uniformBuffer : *uniformBuffers)
+        {
+            glDeleteBuffers(1, &uniformBuffer.bufferHandle);
+        }
+        m_uniformBuffers.remove(shaderHandle);
+    }
+
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Float* value)
     {
         GLInputLocation uniformLocation;
@@ -420,6 +531,10 @@ namespace ramses_internal
             assert(0 != value);
             glUniform1fv(uniformLocation.getValue(), count, value);
         }
+        else
+        {
+            setUniformBufferMember(field, count, value);
+        }
     }
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Vector2* value)
@@ -430,6 +545,10 @@ namespace ramses_internal
             assert(0 != value);
             glUniform2fv(uniformLocation.getValue(), count, value[0].data);
         }
+        else
+        {
+            setUniformBufferMember(field, count, value);
+        }
     }
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Vector3* value)
@@ -440,6 +559,10 @@ namespace ramses_internal
             assert(0 != value);
             glUniform3fv(uniformLocation.getValue(), count, value[0].data);
         }
+        else
+        {
+            setUniformBufferMember(field, count, value);
+        }
     }
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Vector4* value)
@@ -450,6 +573,10 @@ namespace ramses_internal
             assert(0 != value);
             glUniform4fv(uniformLocation.getValue(), count, value[0].data);
         }
+        else
+        {
+            setUniformBufferMember(field, count, value);
+        }
     }
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Int32* value)
@@ -460,6 +587,10 @@ namespace ramses_internal
             assert(0 != value);
             glUniform1iv(uniformLocation.getValue(), count, value);
         }
+        else
+        {
+            setUniformBufferMember(field, count, value);
+        }
     }
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Vector2i* value)
@@ -470,6 +601,10 @@ namespace ramses_internal
             assert(0 != value);
             glUniform2iv(uniformLocation.getValue(), count, value[0].data);
         }
+        else
+        {
+            setUniformBufferMember(field, count, value);
+        }
     }
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Vector3i* value)
@@ -480,6 +615,10 @@ namespace ramses_internal
             assert(0 != value);
             glUniform3iv(uniformLocation.getValue(), count, value[0].data);
         }
+        else
+        {
+            setUniformBufferMember(field, count, value);
+        }
     }
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Vector4i* value)
@@ -490,6 +629,10 @@ namespace ramses_internal
             assert(0 != value);
             glUniform4iv(uniformLocation.getValue(), count, value[0].data);
         }
+        else
+        {
+            setUniformBufferMember(field, count, value);
+        }
     }
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Matrix22f* value)
@@ -500,6 +643,10 @@ namespace ramses_internal
             assert(0 != value);
             glUniformMatrix2fv(uniformLocation.getValue(), count, false, value[0].getRawData());
         }
+        else
+        {
+            setUniformBufferMember(field, count, value);
+        }
     }
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Matrix33f* value)
@@ -510,6 +657,10 @@ namespace ramses_internal
             assert(0 != value);
             glUniformMatrix3fv(uniformLocation.getValue(), count, false, value[0].getRawData());
         }
+        else
+        {
+            setUniformBufferMember(field, count, value);
+        }
     }
 
     void Device_GL::setConstant(DataFieldHandle field, UInt32 count, const Matrix44f* value)
@@ -520,6 +671,49 @@ namespace ramses_internal
             assert(0 != value);
             glUniformMatrix4fv(uniformLocation.getValue(), count, false, value[0].getRawData());
         }
+        else
+        {
+            setUniformBufferMember(field, count, value);
+        }
+    }
+
+    void Device_GL::setInstanceWorldMatrices(DataFieldHandle field, UInt32 count, const Matrix44f* matrices)
+    {
+        GLInputLocation attributeLocation;
+        if (!getAttributeLocation(field, attributeLocation))
+            return;
+
+        assert(0 != matrices);
+        assert(count > 0u);
+        // attribute state is part of bound vertex array, renderables with instance world matrices use the default one
+        deactivateVertexArray();
+
+        // mat4 attribute occupies 4 consecutive locations, one per column
+        const UInt32 columnCount = 4u;
+        const UInt32 columnSize = 4u * sizeof(Float);
+        if (count == 1u)
+        {
+            // generic attribute value applies to all vertices and instances of draw call
+            for (UInt32 column = 0u; column < columnCount; ++column)
+            {
+                glDisableVertexAttribArray(attributeLocation.getValue() + column);
+                glVertexAttrib4fv(attributeLocation.getValue() + column, matrices[0].getRawData() + column * 4u);
+            }
+            return;
+        }
+
+        if (m_instanceWorldMatrixBuffer == InvalidGLHandle)
+            glGenBuffers(1, &m_instanceWorldMatrixBuffer);
+
+        // re-specifying whole buffer lets driver orphan storage still used by previous draw calls instead of synchronizing
+        glBindBuffer(GL_ARRAY_BUFFER, m_instanceWorldMatrixBuffer);
+        glBufferData(GL_ARRAY_BUFFER, count * sizeof(Matrix44f), matrices[0].getRawData(), GL_STREAM_DRAW);
+        for (UInt32 column = 0u; column < columnCount; ++column)
+        {
+            glEnableVertexAttribArray(attributeLocation.getValue() + column);
+            glVertexAttribPointer(attributeLocation.getValue() + column, 4, GL_FLOAT, GL_FALSE, sizeof(Matrix44f), reinterpret_cast<const void*>(static_cast<UInt>(column * columnSize)));
+            glVertexAttribDivisor(attributeLocation.getValue() + column, 1u);
+        }
     }
 
     DeviceResourceHandle Device_GL::allocateTexture2D(UInt32 width, UInt32 height, ETextureFormat textureFormat, UInt32 mipLevelCount, UInt32 totalSizeInBytes)
@@ -567,6 +761,13 @@ namespace ramses_internal
         glGenerateMipmap(gpuResource.m_textureInfo.target);
     }
 
+    void Device_GL::setTextureBaseMipLevel(DeviceResourceHandle handle, UInt32 baseMipLevel)
+    {
+        const TextureGPUResource_GL& gpuResource = m_resourceMapper.getResourceAs<TextureGPUResource_GL>(handle);
+        glBindTexture(gpuResource.m_textureInfo.target, gpuResource.getGPUAddress());
+        glTexParameteri(gpuResource.m_textureInfo.target, GL_TEXTURE_BASE_LEVEL, static_cast<GLint>(baseMipLevel));
+    }
+
     void Device_GL::uploadTextureData(DeviceResourceHandle handle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 z, UInt32 width, UInt32 height, UInt32 depth, const Byte* data, UInt32 dataSize)
     {
         const TextureGPUResource_GL& gpuResource = m_resourceMapper.getResourceAs<TextureGPUResource_GL>(handle);
@@ -1039,6 +1240,8 @@ namespace ramses_internal
 
     void Device_GL::activateVertexBuffer(DeviceResourceHandle handle, DataFieldHandle field, UInt32 instancingDivisor)
     {
+        deactivateVertexArray();
+
         GLInputLocation vertexInputAddress;
         if (getAttributeLocation(field, vertexInputAddress))
         {
@@ -1069,6 +1272,7 @@ namespace ramses_internal
         const auto& indexBuffer = m_resourceMapper.getResource(handle);
         assert(dataSize <= indexBuffer.getTotalSizeInBytes());
 
+        deactivateVertexArray();
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer.getGPUAddress());
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, dataSize, data, GL_STATIC_DRAW);
     }
@@ -1084,14 +1288,93 @@ namespace ramses_internal
     {
         const IndexBufferGPUResource& indexBufferGPUResource = m_resourceMapper.getResourceAs<IndexBufferGPUResource>(handle);
         const GLHandle resourceAddress = indexBufferGPUResource.getGPUAddress();
+        deactivateVertexArray();
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, resourceAddress);
 
         m_activeIndexArrayElementSizeBytes = indexBufferGPUResource.getElementSizeInBytes();
         assert(m_activeIndexArrayElementSizeBytes == 2 || m_activeIndexArrayElementSizeBytes == 4);
     }
 
+    DeviceResourceHandle Device_GL::allocateVertexArray(const VertexArrayInfo& vertexArrayInfo)
+    {
+        const ShaderGPUResource_GL& shader = m_resourceMapper.getResourceAs<ShaderGPUResource_GL>(vertexArrayInfo.shader);
+
+        GLHandle glAddress = InvalidGLHandle;
+        glGenVertexArrays(1, &glAddress);
+        assert(glAddress != InvalidGLHandle);
+        glBindVertexArray(glAddress);
+
+        for (const auto& vertexBuffer : vertexArrayInfo.vertexBuffers)
+        {
+            const GLInputLocation vertexInputAddress = shader.getAttributeLocation(vertexBuffer.field);
+            if (vertexInputAddress != GLInputLocationInvalid)
+            {
+                const VertexBufferGPUResource& arrayResource = m_resourceMapper.getResourceAs<VertexBufferGPUResource>(vertexBuffer.deviceHandle);
+
+                glBindBuffer(GL_ARRAY_BUFFER, arrayResource.getGPUAddress());
+                glEnableVertexAttribArray(vertexInputAddress.getValue());
+                glVertexAttribPointer(vertexInputAddress.getValue(), arrayResource.getNumComponentsPerElement(), GL_FLOAT, GL_FALSE, 0, NULL);
+                glVertexAttribDivisor(vertexInputAddress.getValue(), vertexBuffer.instancingDivisor);
+            }
+        }
+
+        UInt32 indexElementSizeInBytes = 0u;
+        if (vertexArrayInfo.indexBuffer.isValid())
+        {
+            const IndexBufferGPUResource& indexBufferGPUResource = m_resourceMapper.getResourceAs<IndexBufferGPUResource>(vertexArrayInfo.indexBuffer);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBufferGPUResource.getGPUAddress());
+            indexElementSizeInBytes = indexBufferGPUResource.getElementSizeInBytes();
+        }
+
+        // unbind right away so that the captured state cannot be modified by buffer bindings outside of vertex arrays
+        glBindVertexArray(0);
+        m_activeVertexArray = DeviceResourceHandle::Invalid();
+
+        return m_resourceMapper.registerResource(*new VertexArrayGPUResource(glAddress, indexElementSizeInBytes));
+    }
+
+    void Device_GL::activateVertexArray(DeviceResourceHandle handle)
+    {
+        const VertexArrayGPUResource& vertexArrayGPUResource = m_resourceMapper.getResourceAs<VertexArrayGPUResource>(handle);
+        glBindVertexArray(vertexArrayGPUResource.getGPUAddress());
+        m_activeVertexArray = handle;
+
+        if (vertexArrayGPUResource.getIndexElementSizeInBytes() != 0u)
+        {
+            m_activeIndexArrayElementSizeBytes = vertexArrayGPUResource.getIndexElementSizeInBytes();
+            assert(m_activeIndexArrayElementSizeBytes == 2 || m_activeIndexArrayElementSizeBytes == 4);
+        }
+    }
+
+    void Device_GL::deleteVertexArray(DeviceResourceHandle handle)
+    {
+        if (m_activeVertexArray == handle)
+        {
+            deactivateVertexArray();
+        }
+
+        const GLHandle resourceAddress = m_resourceMapper.getResource(handle).getGPUAddress();
+        glDeleteVertexArrays(1, &resourceAddress);
+        m_resourceMapper.deleteResource(handle);
+    }
+
+    void Device_GL::deactivateVertexArray()
+    {
+        // buffers activated one by one are stored in default vertex array
+        if (m_activeVertexArray.isValid())
+        {
+            glBindVertexArray(0);
+            m_activeVertexArray = DeviceResourceHandle::Invalid();
+        }
+    }
+
     DeviceResourceHandle Device_GL::uploadShader(const EffectResource& effect)
     {
+        if (!areUniformBlocksSupported(effect))
+        {
+            return DeviceResourceHandle::Invalid();
+        }
+
         ShaderProgramInfo programInfo;
         String debugErrorLog;
         const Bool uploadSuccessful = ShaderUploader_GL::UploadShaderProgramFromSource(effect, programInfo, debugErrorLog);
@@ -1099,7 +1382,9 @@ namespace ramses_internal
         if (uploadSuccessful)
         {
             const ShaderGPUResource_GL& shaderGpuResource = *new ShaderGPUResource_GL(effect, programInfo);
-            return m_resourceMapper.registerResource(shaderGpuResource);
+            const DeviceResourceHandle shaderHandle = m_resourceMapper.registerResource(shaderGpuResource);
+            createUniformBuffers(shaderHandle, effect);
+            return shaderHandle;
         }
         else
         {
@@ -1110,6 +1395,11 @@ namespace ramses_internal
 
     DeviceResourceHandle Device_GL::uploadBinaryShader(const EffectResource& effect, const UInt8* binaryShaderData, UInt32 binaryShaderDataSize, UInt32 binaryShaderFormat)
     {
+        if (!areUniformBlocksSupported(effect))
+        {
+            return DeviceResourceHandle::Invalid();
+        }
+
         ShaderProgramInfo programInfo;
         String debugErrorLog;
         const Bool uploadSuccessful = ShaderUploader_GL::UploadShaderProgramFromBinary(binaryShaderData, binaryShaderDataSize, binaryShaderFormat, programInfo, debugErrorLog);
@@ -1118,7 +1408,9 @@ namespace ramses_internal
         {
             LOG_INFO(CONTEXT_SMOKETEST, "Device_GL::uploadShader: renderer successfully uploaded binary shader for effect " << effect.getName());
             const ShaderGPUResource_GL& shaderGpuResource = *new ShaderGPUResource_GL(effect, programInfo);
-            return m_resourceMapper.registerResource(shaderGpuResource);
+            const DeviceResourceHandle shaderHandle = m_resourceMapper.registerResource(shaderGpuResource);
+            createUniformBuffers(shaderHandle, effect);
+            return shaderHandle;
         }
         else
         {
@@ -1142,8 +1434,10 @@ namespace ramses_internal
         if (m_activeShader == &shaderProgramGL)
         {
             m_activeShader = NULL;
+            m_activeShaderHandle = DeviceResourceHandle::Invalid();
         }
 
+        deleteUniformBuffers(handle);
         m_resourceMapper.deleteResource(handle);
     }
 
@@ -1152,6 +1446,7 @@ namespace ramses_internal
         const ShaderGPUResource_GL& shaderProgramGL = m_resourceMapper.getResourceAs<ShaderGPUResource_GL>(handle);
         glUseProgram(shaderProgramGL.getGPUAddress());
         m_activeShader = &shaderProgramGL;
+        m_activeShaderHandle = handle;
     }
 
     void Device_GL::deleteTexture(DeviceResourceHandle handle)
@@ -1268,6 +1563,26 @@ namespace ramses_internal
         glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &max_textures);
         m_limits.setMaximumTextureUnits(max_textures);
 
+        // uniform buffers are core since ES 3.0 and desktop GL 3.1, without them effects using uniform blocks are rejected on upload
+        const Bool uniformBuffersAvailable = m_isEmbedded ? (m_majorApiVersion >= 3) : (m_majorApiVersion > 3 || (m_majorApiVersion == 3 && m_minorApiVersion >= 1));
+        if (uniformBuffersAvailable)
+        {
+            GLint maxUniformBufferBindings(0);
+            glGetIntegerv(GL_MAX_UNIFORM_BUFFER_BINDINGS, &maxUniformBufferBindings);
+            m_limits.setMaximumUniformBufferBindings(maxUniformBufferBindings);
+
+            GLint uniformBufferOffsetAlignment(0);
+            glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniformBufferOffsetAlignment);
+            if (uniformBufferOffsetAlignment > 0)
+            {
+                m_uniformBufferOffsetAlignment = static_cast<UInt32>(uniformBufferOffsetAlignment);
+            }
+        }
+        else
+        {
+            LOG_WARN(CONTEXT_RENDERER, "Device_GL::loadExtensionDependentFeatures:  uniform buffers not available on this device, effects with uniform blocks cannot be uploaded");
+        }
+
         GLint numCompressedTextureFormats(0);
         glGetIntegerv(GL_NUM_COMPRESSED_TEXTURE_FORMATS, &numCompressedTextureFormats);
         Vector<GLint> compressedTextureFormats(numCompressedTextureFormats);
@@ -24,6 +24,7 @@ namespace ramses_internal
         Context_Base();
 
         DeviceResourceMapper& getResources() override;
+        UInt32 getBufferAge() const override;
 
         // TODO Violin this is not beautiful, but is needed because windows parses
         // extensions non-conform to EGL standard (read up about WGL on the net,
@@ -27,6 +27,9 @@ namespace ramses_internal
         UInt32  getMaximumAnisotropy() const;
         void    setMaximumAnisotropy(UInt32 anisotropy);
 
+        UInt32  getMaximumUniformBufferBindings() const;
+        void    setMaximumUniformBufferBindings(UInt32 count);
+
         // Texture formats
         Bool    isTextureFormatAvailable(ETextureFormat format) const;
         void    addTextureFormat(ETextureFormat format);
@@ -36,6 +39,7 @@ namespace ramses_internal
     private:
         UInt32 m_maximumTextureUnits;
         UInt32 m_maximumAnisotropy;
+        UInt32 m_maximumUniformBufferBindings;
         HashSet<ETextureFormat> m_availableTextureFormats;
     };
 }
@@ -0,0 +1,64 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_UNIFORMBUFFERDATA_H
+#define RAMSES_UNIFORMBUFFERDATA_H
+
+#include "Resource/EffectInputInformation.h"
+#include "SceneAPI/Handles.h"
+#include "Collections/HashMap.h"
+#include "Collections/Vector.h"
+#include "Collections/String.h"
+
+namespace ramses_internal
+{
+    // CPU side copy of the content of a std140 uniform block. Members are identified by the data field of the uniform input
+    // they represent and their values are packed using std140 offsets and strides.
+    // The data is marked as modified only if a set value differs from the one already stored, so that the buffer
+    // on GPU needs to be uploaded only when its content really changed.
+    class UniformBufferData
+    {
+    public:
+        UniformBufferData(const String& blockName, const EffectInputInformationVector& uniformInputs);
+
+        const String& getBlockName() const;
+        Bool hasMember(DataFieldHandle field) const;
+        UInt32 getMemberOffset(DataFieldHandle field) const;
+        // values are expected tightly packed, same as when passed to IDevice::setConstant
+        void setMemberValue(DataFieldHandle field, UInt32 elementCount, const Byte* value);
+
+        const Byte* getData() const;
+        UInt32 getSize() const;
+
+        Bool isModified() const;
+        void resetModified();
+
+        // names of uniform blocks in order of their first member, index of a block in the list is used as its binding point
+        static Vector<String> GetUniformBlockNames(const EffectInputInformationVector& uniformInputs);
+
+    private:
+        struct Member
+        {
+            UInt32 offset;
+            UInt32 elementCount;
+            UInt32 elementStride;
+            UInt32 columnCount;
+            UInt32 columnSize;
+            UInt32 columnStride;
+        };
+
+        static Member CreateStd140Member(EDataType dataType, UInt32 elementCount, UInt32& currentOffset);
+
+        String                           m_blockName;
+        HashMap<DataFieldHandle, Member> m_members;
+        Vector<Byte>                     m_data;
+        Bool                             m_modified = true;
+    };
+}
+
+#endif
@@ -0,0 +1,36 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_VERTEXARRAYGPURESOURCE_H
+#define RAMSES_VERTEXARRAYGPURESOURCE_H
+
+#include "Platform_Base/GpuResource.h"
+
+namespace ramses_internal
+{
+    class VertexArrayGPUResource : public GPUResource
+    {
+    public:
+        VertexArrayGPUResource(UInt32 gpuAddress, UInt32 indexElementSizeInBytes)
+            : GPUResource(gpuAddress, 0u)
+            , m_indexElementSizeInBytes(indexElementSizeInBytes)
+        {
+        }
+
+        // zero if no index buffer is part of the vertex array
+        UInt32 getIndexElementSizeInBytes() const
+        {
+            return m_indexElementSizeInBytes;
+        }
+
+    private:
+        const UInt32 m_indexElementSizeInBytes;
+    };
+}
+
+#endif
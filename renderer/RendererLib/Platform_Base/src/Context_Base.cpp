@@ -21,6 +21,11 @@ namespace ramses_internal
         return m_resources;
     }
 
+    UInt32 Context_Base::getBufferAge() const
+    {
+        return 0u;
+    }
+
     void Context_Base::ParseContextExtensionsHelper(const Char* extensionNativeString, StringSet& extensionsOut)
     {
         LOG_DEBUG(CONTEXT_RENDERER, "Context_Base::ParseContextExtensionsHelper:  parsing context extensions");
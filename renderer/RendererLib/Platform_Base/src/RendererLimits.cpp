@@ -14,6 +14,7 @@ namespace ramses_internal
     RendererLimits::RendererLimits()
         : m_maximumTextureUnits(1u)
         , m_maximumAnisotropy(1u)
+        , m_maximumUniformBufferBindings(0u)
     {
     }
 
@@ -37,6 +38,16 @@ namespace ramses_internal
         m_maximumAnisotropy = anisotropy;
     }
 
+    UInt32 RendererLimits::getMaximumUniformBufferBindings() const
+    {
+        return m_maximumUniformBufferBindings;
+    }
+
+    void RendererLimits::setMaximumUniformBufferBindings(UInt32 count)
+    {
+        m_maximumUniformBufferBindings = count;
+    }
+
     Bool RendererLimits::isTextureFormatAvailable(ETextureFormat format) const
     {
         return m_availableTextureFormats.hasElement(format);
@@ -52,6 +63,7 @@ namespace ramses_internal
         LOG_DEBUG(CONTEXT_RENDERER, "Device features and limits:");
         LOG_DEBUG(CONTEXT_RENDERER, "  - maximum number of texture units:            " << m_maximumTextureUnits);
         LOG_DEBUG(CONTEXT_RENDERER, "  - maximum number of anisotropy samples:       " << m_maximumAnisotropy);
+        LOG_DEBUG(CONTEXT_RENDERER, "  - maximum number of uniform buffer bindings:  " << m_maximumUniformBufferBindings);
 
         LOG_DEBUG(CONTEXT_RENDERER, "  - supported texture formats:");
         for(const auto& texture : m_availableTextureFormats)
@@ -0,0 +1,153 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Platform_Base/UniformBufferData.h"
+#include "PlatformAbstraction/PlatformMemory.h"
+#include <algorithm>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        // std140: arrays and matrix columns are aligned to and strided by size of vec4
+        const UInt32 Std140Vec4Size = 16u;
+
+        UInt32 AlignUp(UInt32 offset, UInt32 alignment)
+        {
+            return (offset + alignment - 1u) / alignment * alignment;
+        }
+
+        UInt32 GetMatrixColumnCount(EDataType dataType)
+        {
+            switch (dataType)
+            {
+            case EDataType_Matrix22F:
+                return 2u;
+            case EDataType_Matrix33F:
+                return 3u;
+            case EDataType_Matrix44F:
+                return 4u;
+            default:
+                return 1u;
+            }
+        }
+    }
+
+    UniformBufferData::UniformBufferData(const String& blockName, const EffectInputInformationVector& uniformInputs)
+        : m_blockName(blockName)
+    {
+        UInt32 currentOffset = 0u;
+        for (UInt32 i = 0u; i < uniformInputs.size(); ++i)
+        {
+            const EffectInputInformation& input = uniformInputs[i];
+            if (input.uniformBlockName == blockName)
+                m_members.put(DataFieldHandle(i), CreateStd140Member(input.dataType, input.elementCount, currentOffset));
+        }
+
+        // size of block is rounded up to multiple of vec4 as if it was a structure
+        m_data.resize(AlignUp(currentOffset, Std140Vec4Size));
+    }
+
+    UniformBufferData::Member UniformBufferData::CreateStd140Member(EDataType dataType, UInt32 elementCount, UInt32& currentOffset)
+    {
+        Member member;
+        member.elementCount = elementCount;
+        member.columnCount = GetMatrixColumnCount(dataType);
+        member.columnSize = EnumToSize(dataType) / member.columnCount;
+
+        const Bool isMatrix = member.columnCount > 1u;
+        const Bool isArray = elementCount > 1u;
+        if (isMatrix || isArray)
+        {
+            member.columnStride = Std140Vec4Size;
+            member.elementStride = member.columnCount * Std140Vec4Size;
+            member.offset = AlignUp(currentOffset, Std140Vec4Size);
+            currentOffset = member.offset + elementCount * member.elementStride;
+        }
+        else
+        {
+            // scalars and vectors are aligned to their size, except vec3 which is aligned as vec4
+            const UInt32 alignment = (member.columnSize == 3u * sizeof(Float) ? Std140Vec4Size : member.columnSize);
+            member.columnStride = member.columnSize;
+            member.elementStride = member.columnSize;
+            member.offset = AlignUp(currentOffset, alignment);
+            currentOffset = member.offset + member.columnSize;
+        }
+
+        return member;
+    }
+
+    const String& UniformBufferData::getBlockName() const
+    {
+        return m_blockName;
+    }
+
+    Bool UniformBufferData::hasMember(DataFieldHandle field) const
+    {
+        return m_members.contains(field);
+    }
+
+    UInt32 UniformBufferData::getMemberOffset(DataFieldHandle field) const
+    {
+        const Member* member = m_members.get(field);
+        assert(member != nullptr);
+        return member->offset;
+    }
+
+    void UniformBufferData::setMemberValue(DataFieldHandle field, UInt32 elementCount, const Byte* value)
+    {
+        const Member* member = m_members.get(field);
+        assert(member != nullptr);
+        assert(elementCount <= member->elementCount);
+
+        for (UInt32 element = 0u; element < elementCount; ++element)
+        {
+            for (UInt32 column = 0u; column < member->columnCount; ++column)
+            {
+                Byte* target = m_data.data() + member->offset + element * member->elementStride + column * member->columnStride;
+                const Byte* source = value + (element * member->columnCount + column) * member->columnSize;
+                if (PlatformMemory::Compare(target, source, member->columnSize) != 0)
+                {
+                    PlatformMemory::Copy(target, source, member->columnSize);
+                    m_modified = true;
+                }
+            }
+        }
+    }
+
+    const Byte* UniformBufferData::getData() const
+    {
+        return m_data.data();
+    }
+
+    UInt32 UniformBufferData::getSize() const
+    {
+        return static_cast<UInt32>(m_data.size());
+    }
+
+    Bool UniformBufferData::isModified() const
+    {
+        return m_modified;
+    }
+
+    void UniformBufferData::resetModified()
+    {
+        m_modified = false;
+    }
+
+    Vector<String> UniformBufferData::GetUniformBlockNames(const EffectInputInformationVector& uniformInputs)
+    {
+        Vector<String> blockNames;
+        for (const auto& input : uniformInputs)
+        {
+            if (input.uniformBlockName.getLength() != 0u && std::find(blockNames.begin(), blockNames.end(), input.uniformBlockName) == blockNames.end())
+                blockNames.push_back(input.uniformBlockName);
+        }
+        return blockNames;
+    }
+}
@@ -22,6 +22,9 @@ namespace ramses_internal
 
         virtual DeviceResourceMapper& getResources() = 0;
 
+        // Number of frames since the current back buffer content was rendered, 0 if the content is undefined
+        virtual UInt32 getBufferAge() const = 0;
+
         // TODO Violin this should be removed - provides access to platform-specific data
         virtual void* getProcAddress(const Char* name) const = 0;
     };
@@ -59,6 +59,9 @@ namespace ramses_internal
         virtual void setConstant(DataFieldHandle field, UInt32 count, const Matrix22f*  value) = 0;
         virtual void setConstant(DataFieldHandle field, UInt32 count, const Matrix33f*  value) = 0;
         virtual void setConstant(DataFieldHandle field, UInt32 count, const Matrix44f*  value) = 0;
+        // world matrices of instances for attribute with EFixedSemantics_InstanceWorldMatrixAttribute, streamed to device owned buffer,
+        // single matrix is used for all instances drawn
+        virtual void setInstanceWorldMatrices(DataFieldHandle field, UInt32 count, const Matrix44f* matrices) = 0;
 
         //draw calls
         virtual void clear               (UInt32 clearFlags) = 0;
@@ -95,6 +98,10 @@ namespace ramses_internal
         virtual void                    deleteIndexBuffer           (DeviceResourceHandle handle) = 0;
         virtual void                    activateIndexBuffer         (DeviceResourceHandle handle) = 0;
 
+        virtual DeviceResourceHandle    allocateVertexArray         (const VertexArrayInfo& vertexArrayInfo) = 0;
+        virtual void                    activateVertexArray         (DeviceResourceHandle handle) = 0;
+        virtual void                    deleteVertexArray           (DeviceResourceHandle handle) = 0;
+
         virtual DeviceResourceHandle    uploadShader                (const EffectResource& effect) = 0;
         virtual DeviceResourceHandle    uploadBinaryShader          (const EffectResource& effect, const UInt8* binaryShaderData, UInt32 binaryShaderDataSize, UInt32 binaryShaderFormat) = 0;
         virtual Bool                    getBinaryShader             (DeviceResourceHandle handle, UInt8Vector& binaryShader, UInt32& binaryShaderFormat) = 0;
@@ -106,6 +113,8 @@ namespace ramses_internal
         virtual DeviceResourceHandle    allocateTextureCube         (UInt32 faceSize, ETextureFormat textureFormat, UInt32 mipLevelCount, UInt32 totalSizeInBytes) = 0;
         virtual void                    bindTexture                 (DeviceResourceHandle handle) = 0;
         virtual void                    generateMipmaps             (DeviceResourceHandle handle) = 0;
+        // texture is sampled only from base mip level and smaller ones, used while larger levels are not uploaded yet
+        virtual void                    setTextureBaseMipLevel      (DeviceResourceHandle handle, UInt32 baseMipLevel) = 0;
         virtual void                    uploadTextureData           (DeviceResourceHandle handle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 z, UInt32 width, UInt32 height, UInt32 depth, const Byte* data, UInt32 dataSize) = 0;
         virtual DeviceResourceHandle    uploadStreamTexture2D       (DeviceResourceHandle handle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8* data) = 0;
         virtual void                    deleteTexture               (DeviceResourceHandle handle) = 0;
@@ -56,6 +56,7 @@ namespace ramses_internal
         virtual Bool                    readPixels(UInt32 x, UInt32 y, UInt32 width, UInt32 height, Vector<UInt8>& dataOut) = 0;
         virtual Bool                    isWarpingEnabled() const = 0;
         virtual void                    setWarpingMeshData(const WarpingMeshData& warpingMeshData) = 0;
+        virtual void                    setInstancedDrawBatchingEnabled(Bool enabled) = 0;
 
         virtual void                    validateRenderingStatusHealthy() const = 0;
     };
@@ -92,6 +92,21 @@ namespace ramses_internal
         UInt8Vector   pixelData;
     };
     typedef Vector<ScreenshotInfo> ScreenshotInfoVector;
+
+    // Geometry buffers and attribute inputs of a shader to be captured in one vertex array object
+    struct VertexArrayInfo
+    {
+        struct VertexBuffer
+        {
+            DeviceResourceHandle deviceHandle;
+            DataFieldHandle      field;
+            UInt32               instancingDivisor;
+        };
+
+        DeviceResourceHandle shader;
+        DeviceResourceHandle indexBuffer;
+        Vector<VertexBuffer> vertexBuffers;
+    };
 }
 
 #endif
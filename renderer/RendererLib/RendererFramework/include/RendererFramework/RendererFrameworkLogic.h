@@ -26,6 +26,7 @@ namespace ramses_internal
     class IResourceConsumerComponent;
     class RendererCommandBuffer;
     class IConnectionStatusUpdateNotifier;
+    class SceneFlushRecorder;
 
     class RendererFrameworkLogic
         : public ISceneRendererServiceHandler
@@ -41,6 +42,9 @@ namespace ramses_internal
             PlatformLock& frameworkLock);
         virtual ~RendererFrameworkLogic();
 
+        // optional, records everything passed to renderer for later replay
+        void setSceneFlushRecorder(SceneFlushRecorder* recorder);
+
         // ISceneRendererServiceHandler
         virtual void handleInitializeScene(const SceneInfo& sceneInfo, const Guid& providerID) override;
         virtual void handleSceneNotAvailable(const SceneId& sceneId, const Guid& providerID) override;
@@ -63,6 +67,7 @@ namespace ramses_internal
         ISceneGraphConsumerComponent& m_sceneGraphConsumerComponent;
         IResourceConsumerComponent&   m_resourceComponent;
         RendererCommandBuffer&        m_rendererCommands;
+        SceneFlushRecorder*           m_sceneFlushRecorder = nullptr;
 
         HashMap<SceneId, Pair<Guid, String> > m_sceneClients;
         std::unordered_map<SceneId, SceneActionCollection>   m_bufferedSceneActionsPerScene;
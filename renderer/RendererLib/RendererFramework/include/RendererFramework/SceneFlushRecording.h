@@ -0,0 +1,84 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_SCENEFLUSHRECORDING_H
+#define RAMSES_SCENEFLUSHRECORDING_H
+
+#include "Scene/SceneActionCollection.h"
+#include "SceneAPI/SceneId.h"
+#include "Components/ManagedResource.h"
+#include "Collections/HashSet.h"
+#include "PlatformAbstraction/PlatformLock.h"
+#include "Utils/File.h"
+#include "Utils/BinaryFileOutputStream.h"
+#include "Utils/BinaryFileInputStream.h"
+
+namespace ramses_internal
+{
+    enum ESceneFlushRecordType
+    {
+        ESceneFlushRecordType_ScenePublished = 0,
+        ESceneFlushRecordType_SceneReceived,
+        ESceneFlushRecordType_SceneActions,
+        ESceneFlushRecordType_Resource,
+        ESceneFlushRecordType_NUMBER_OF_ELEMENTS
+    };
+
+    // One entry of a flush recording, only the members matching the type are valid.
+    // Time stamp is relative to the start of the recording.
+    struct SceneFlushRecord
+    {
+        ESceneFlushRecordType type = ESceneFlushRecordType_NUMBER_OF_ELEMENTS;
+        UInt64                timeStampUs = 0u;
+        SceneInfo             sceneInfo;
+        SceneActionCollection actions;
+        ManagedResource       resource;
+    };
+
+    // Writes everything the renderer receives from the framework (publications, scene subscriptions,
+    // complete flushes and arrived resources) to a file, so that the exact same sequence can be replayed
+    // without the client side. Each resource is written only once.
+    class SceneFlushRecorder
+    {
+    public:
+        explicit SceneFlushRecorder(const String& filename);
+
+        Bool isOpen() const;
+
+        void recordScenePublished(const SceneInfo& sceneInfo);
+        void recordSceneReceived(const SceneInfo& sceneInfo);
+        void recordSceneActions(const SceneId& sceneId, const SceneActionCollection& actions);
+        void recordResources(const ManagedResourceVector& resources);
+
+    private:
+        void writeRecordHeader(ESceneFlushRecordType type);
+        void writeSceneInfo(const SceneInfo& sceneInfo);
+
+        PlatformLock              m_lock;
+        File                      m_file;
+        BinaryFileOutputStream    m_stream;
+        UInt64                    m_startTimeUs;
+        HashSet<ResourceContentHash> m_recordedResources;
+    };
+
+    class SceneFlushRecordReader
+    {
+    public:
+        explicit SceneFlushRecordReader(const String& filename);
+
+        Bool isOpen() const;
+        Bool readNextRecord(SceneFlushRecord& record);
+
+    private:
+        File                  m_file;
+        BinaryFileInputStream m_stream;
+        Bool                  m_valid;
+    };
+}
+
+#endif
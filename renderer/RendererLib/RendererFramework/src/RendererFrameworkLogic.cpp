@@ -16,6 +16,7 @@
 #include "TransportCommon/IConnectionStatusUpdateNotifier.h"
 #include "Components/ManagedResource.h"
 #include "Components/SceneGraphComponent.h"
+#include "RendererFramework/SceneFlushRecording.h"
 
 namespace ramses_internal
 {
@@ -41,6 +42,11 @@ namespace ramses_internal
         m_sceneGraphConsumerComponent.setSceneRendererServiceHandler(NULL);
     }
 
+    void RendererFrameworkLogic::setSceneFlushRecorder(SceneFlushRecorder* recorder)
+    {
+        m_sceneFlushRecorder = recorder;
+    }
+
     void RendererFrameworkLogic::handleNewScenesAvailable(const SceneInfoVector& newScenes, const Guid& providerID, EScenePublicationMode mode)
     {
         for(const auto& newScene : newScenes)
@@ -49,6 +55,10 @@ namespace ramses_internal
             {
                 LOG_INFO(CONTEXT_RENDERER, "RendererFrameworkLogic::handleNewScenesAvailable: scene published: " << newScene.sceneID.getValue() << " @ " << providerID << " name:" << newScene.friendlyName << " publicationmode: " << EnumToString(newScene.publicationMode));
 
+                if (m_sceneFlushRecorder)
+                {
+                    m_sceneFlushRecorder->recordScenePublished(SceneInfo(newScene.sceneID, newScene.friendlyName, mode));
+                }
                 m_rendererCommands.publishScene(newScene.sceneID, providerID, mode);
                 m_sceneClients.put(newScene.sceneID, MakePair(providerID, newScene.friendlyName));
             }
@@ -88,6 +98,10 @@ namespace ramses_internal
         m_lastReceivedListCounter.erase(sceneInfo.sceneID);
         m_bufferedSceneActionsPerScene.erase(sceneInfo.sceneID);
 
+        if (m_sceneFlushRecorder)
+        {
+            m_sceneFlushRecorder->recordSceneReceived(sceneInfo);
+        }
         m_rendererCommands.receiveScene(sceneInfo);
     }
 
@@ -125,7 +139,12 @@ namespace ramses_internal
     ManagedResourceVector RendererFrameworkLogic::popArrivedResources(const RequesterID& requesterID)
     {
         PlatformGuard guard(m_frameworkLock);
-        return m_resourceComponent.popArrivedResources(requesterID);
+        ManagedResourceVector resources = m_resourceComponent.popArrivedResources(requesterID);
+        if (m_sceneFlushRecorder)
+        {
+            m_sceneFlushRecorder->recordResources(resources);
+        }
+        return resources;
     }
 
     void RendererFrameworkLogic::handleSceneActionList(const SceneId& sceneId, SceneActionCollection&& actions, const uint64_t& counter, const Guid& providerID)
@@ -156,6 +175,10 @@ namespace ramses_internal
         if (!hasBufferedActions && actionsHaveTrailingFlush)
         {
             // no need for buffering, fully received flush
+            if (m_sceneFlushRecorder)
+            {
+                m_sceneFlushRecorder->recordSceneActions(sceneId, actions);
+            }
             m_rendererCommands.enqueueActionsForScene(sceneId, std::move(actions));
         }
         else
@@ -170,6 +193,10 @@ namespace ramses_internal
 
                 if (actionsHaveTrailingFlush)
                 {
+                    if (m_sceneFlushRecorder)
+                    {
+                        m_sceneFlushRecorder->recordSceneActions(sceneId, bufferedActionsId->second);
+                    }
                     m_rendererCommands.enqueueActionsForScene(sceneId, std::move(bufferedActionsId->second));
                     m_bufferedSceneActionsPerScene.erase(bufferedActionsId);
                 }
@@ -0,0 +1,217 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererFramework/SceneFlushRecording.h"
+#include "Components/ResourcePersistation.h"
+#include "PlatformAbstraction/PlatformGuard.h"
+#include "PlatformAbstraction/PlatformTime.h"
+#include "Utils/LogMacros.h"
+
+namespace ramses_internal
+{
+    static const UInt32 gSceneFlushRecordingMarker = 0x52464c53; // 'SLFR'
+    static const UInt32 gSceneFlushRecordingVersion = 1u;
+
+    SceneFlushRecorder::SceneFlushRecorder(const String& filename)
+        : m_file(filename)
+        , m_stream(m_file)
+        , m_startTimeUs(PlatformTime::GetMicrosecondsMonotonic())
+    {
+        if (isOpen())
+        {
+            m_stream << gSceneFlushRecordingMarker;
+            m_stream << gSceneFlushRecordingVersion;
+            LOG_INFO(CONTEXT_RENDERER, "SceneFlushRecorder: recording scene flushes to " << filename);
+        }
+        else
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "SceneFlushRecorder: failed to open " << filename << " for recording");
+        }
+    }
+
+    Bool SceneFlushRecorder::isOpen() const
+    {
+        return m_stream.getState() == EStatus_RAMSES_OK;
+    }
+
+    void SceneFlushRecorder::recordScenePublished(const SceneInfo& sceneInfo)
+    {
+        PlatformGuard guard(m_lock);
+        writeRecordHeader(ESceneFlushRecordType_ScenePublished);
+        writeSceneInfo(sceneInfo);
+    }
+
+    void SceneFlushRecorder::recordSceneReceived(const SceneInfo& sceneInfo)
+    {
+        PlatformGuard guard(m_lock);
+        writeRecordHeader(ESceneFlushRecordType_SceneReceived);
+        writeSceneInfo(sceneInfo);
+    }
+
+    void SceneFlushRecorder::recordSceneActions(const SceneId& sceneId, const SceneActionCollection& actions)
+    {
+        PlatformGuard guard(m_lock);
+        writeRecordHeader(ESceneFlushRecordType_SceneActions);
+
+        const Vector<Byte>& actionData = actions.collectionData();
+        m_stream << sceneId.getValue();
+        m_stream << static_cast<UInt32>(actions.numberOfActions());
+        m_stream << static_cast<UInt32>(actionData.size());
+        m_stream.write(actionData.data(), static_cast<UInt32>(actionData.size()));
+        for (const auto& reader : actions)
+        {
+            m_stream << static_cast<UInt32>(reader.type());
+            m_stream << static_cast<UInt32>(reader.offsetInCollection());
+        }
+    }
+
+    void SceneFlushRecorder::recordResources(const ManagedResourceVector& resources)
+    {
+        PlatformGuard guard(m_lock);
+        for (const auto& resource : resources)
+        {
+            const IResource* resourceObject = resource.getResourceObject();
+            if (resourceObject == nullptr || m_recordedResources.hasElement(resourceObject->getHash()))
+            {
+                continue;
+            }
+
+            m_recordedResources.put(resourceObject->getHash());
+            writeRecordHeader(ESceneFlushRecordType_Resource);
+            m_stream << resourceObject->getHash();
+            ResourcePersistation::WriteOneResourceToStream(m_stream, resource);
+        }
+    }
+
+    void SceneFlushRecorder::writeRecordHeader(ESceneFlushRecordType type)
+    {
+        m_stream << static_cast<UInt32>(type);
+        m_stream << PlatformTime::GetMicrosecondsMonotonic() - m_startTimeUs;
+    }
+
+    void SceneFlushRecorder::writeSceneInfo(const SceneInfo& sceneInfo)
+    {
+        m_stream << sceneInfo.sceneID.getValue();
+        m_stream << sceneInfo.friendlyName;
+        m_stream << static_cast<UInt32>(sceneInfo.publicationMode);
+    }
+
+    SceneFlushRecordReader::SceneFlushRecordReader(const String& filename)
+        : m_file(filename)
+        , m_stream(m_file)
+        , m_valid(false)
+    {
+        if (m_stream.getState() != EStatus_RAMSES_OK)
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "SceneFlushRecordReader: failed to open " << filename);
+            return;
+        }
+
+        UInt32 marker = 0u;
+        UInt32 version = 0u;
+        m_stream >> marker;
+        m_stream >> version;
+        if (marker != gSceneFlushRecordingMarker || version != gSceneFlushRecordingVersion)
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "SceneFlushRecordReader: " << filename << " is not a scene flush recording of version " << gSceneFlushRecordingVersion);
+            return;
+        }
+        m_valid = true;
+    }
+
+    Bool SceneFlushRecordReader::isOpen() const
+    {
+        return m_valid;
+    }
+
+    Bool SceneFlushRecordReader::readNextRecord(SceneFlushRecord& record)
+    {
+        if (!m_valid)
+        {
+            return false;
+        }
+
+        UInt32 type = ESceneFlushRecordType_NUMBER_OF_ELEMENTS;
+        m_stream >> type;
+        m_stream >> record.timeStampUs;
+        if (m_stream.getState() != EStatus_RAMSES_OK || type >= ESceneFlushRecordType_NUMBER_OF_ELEMENTS)
+        {
+            // regular end of recording or truncated file
+            m_valid = false;
+            return false;
+        }
+        record.type = static_cast<ESceneFlushRecordType>(type);
+
+        switch (record.type)
+        {
+        case ESceneFlushRecordType_ScenePublished:
+        case ESceneFlushRecordType_SceneReceived:
+        {
+            UInt64 sceneId = 0u;
+            UInt32 publicationMode = 0u;
+            m_stream >> sceneId;
+            m_stream >> record.sceneInfo.friendlyName;
+            m_stream >> publicationMode;
+            record.sceneInfo.sceneID = SceneId(sceneId);
+            record.sceneInfo.publicationMode = static_cast<EScenePublicationMode>(publicationMode);
+            break;
+        }
+        case ESceneFlushRecordType_SceneActions:
+        {
+            UInt64 sceneId = 0u;
+            UInt32 numberOfActions = 0u;
+            UInt32 dataSize = 0u;
+            m_stream >> sceneId;
+            m_stream >> numberOfActions;
+            m_stream >> dataSize;
+            record.sceneInfo = SceneInfo(SceneId(sceneId));
+
+            SceneActionCollection actions(0u, numberOfActions);
+            Vector<Byte>& rawActionData = actions.getRawDataForDirectWriting();
+            rawActionData.resize(dataSize);
+            m_stream.read(reinterpret_cast<Char*>(rawActionData.data()), dataSize);
+            for (UInt32 i = 0u; i < numberOfActions; ++i)
+            {
+                UInt32 actionType = 0u;
+                UInt32 offsetInCollection = 0u;
+                m_stream >> actionType;
+                m_stream >> offsetInCollection;
+                actions.addRawSceneActionInformation(static_cast<ESceneActionId>(actionType), offsetInCollection);
+            }
+            record.actions = std::move(actions);
+            break;
+        }
+        case ESceneFlushRecordType_Resource:
+        {
+            ResourceContentHash hash;
+            m_stream >> hash;
+            IResource* resource = ResourcePersistation::ReadOneResourceFromStream(m_stream, hash);
+            if (resource == nullptr)
+            {
+                LOG_ERROR(CONTEXT_RENDERER, "SceneFlushRecordReader::readNextRecord: failed to read resource " << hash);
+                m_valid = false;
+                return false;
+            }
+            ResourceDeleterCallingCallback deleter;
+            record.resource = ManagedResource(*resource, deleter);
+            break;
+        }
+        case ESceneFlushRecordType_NUMBER_OF_ELEMENTS:
+            assert(false);
+            break;
+        }
+
+        if (m_stream.getState() != EStatus_RAMSES_OK)
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "SceneFlushRecordReader::readNextRecord: recording is truncated");
+            m_valid = false;
+            return false;
+        }
+        return true;
+    }
+}
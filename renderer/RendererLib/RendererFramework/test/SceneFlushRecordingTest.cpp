@@ -0,0 +1,124 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "RendererFramework/SceneFlushRecording.h"
+#include "Resource/ArrayResource.h"
+#include "Scene/SceneActionCollectionCreator.h"
+
+namespace ramses_internal
+{
+    class ASceneFlushRecording : public ::testing::Test
+    {
+    public:
+        ASceneFlushRecording()
+            : filename("SceneFlushRecordingTest.rec")
+            , sceneInfo(SceneId(12u), "recordedScene", EScenePublicationMode_LocalOnly)
+        {
+        }
+
+        ~ASceneFlushRecording()
+        {
+            File(filename).remove();
+        }
+
+        static ManagedResource CreateResource(ResourceDeleterCallingCallback& deleter, UInt16 value)
+        {
+            const UInt16 indices[] = { value, value, value };
+            return ManagedResource(*new ArrayResource(EResourceType_IndexArray, 3u, EDataType_UInt16, reinterpret_cast<const Byte*>(indices), ResourceCacheFlag(0u), "indices"), deleter);
+        }
+
+        const String filename;
+        const SceneInfo sceneInfo;
+        ResourceDeleterCallingCallback deleter;
+    };
+
+    TEST_F(ASceneFlushRecording, readsBackRecordsInRecordedOrder)
+    {
+        SceneActionCollection actions;
+        SceneActionCollectionCreator creator(actions);
+        creator.allocateNode(3u, NodeHandle(5u));
+        creator.flush(1u, false, false);
+
+        const ManagedResource resource = CreateResource(deleter, 7u);
+        {
+            SceneFlushRecorder recorder(filename);
+            ASSERT_TRUE(recorder.isOpen());
+            recorder.recordScenePublished(sceneInfo);
+            recorder.recordSceneReceived(sceneInfo);
+            recorder.recordResources({ resource });
+            recorder.recordSceneActions(sceneInfo.sceneID, actions);
+        }
+
+        SceneFlushRecordReader reader(filename);
+        ASSERT_TRUE(reader.isOpen());
+        SceneFlushRecord record;
+
+        ASSERT_TRUE(reader.readNextRecord(record));
+        EXPECT_EQ(ESceneFlushRecordType_ScenePublished, record.type);
+        EXPECT_EQ(sceneInfo, record.sceneInfo);
+        EXPECT_EQ(EScenePublicationMode_LocalOnly, record.sceneInfo.publicationMode);
+        const UInt64 publishTime = record.timeStampUs;
+
+        ASSERT_TRUE(reader.readNextRecord(record));
+        EXPECT_EQ(ESceneFlushRecordType_SceneReceived, record.type);
+        EXPECT_EQ(sceneInfo, record.sceneInfo);
+
+        ASSERT_TRUE(reader.readNextRecord(record));
+        EXPECT_EQ(ESceneFlushRecordType_Resource, record.type);
+        ASSERT_TRUE(record.resource.getResourceObject() != nullptr);
+        EXPECT_EQ(resource.getResourceObject()->getHash(), record.resource.getResourceObject()->getHash());
+
+        ASSERT_TRUE(reader.readNextRecord(record));
+        EXPECT_EQ(ESceneFlushRecordType_SceneActions, record.type);
+        EXPECT_EQ(sceneInfo.sceneID, record.sceneInfo.sceneID);
+        EXPECT_EQ(actions, record.actions);
+        EXPECT_GE(record.timeStampUs, publishTime);
+
+        EXPECT_FALSE(reader.readNextRecord(record));
+    }
+
+    TEST_F(ASceneFlushRecording, recordsEachResourceOnlyOnce)
+    {
+        const ManagedResource resource1 = CreateResource(deleter, 1u);
+        const ManagedResource resource2 = CreateResource(deleter, 2u);
+        {
+            SceneFlushRecorder recorder(filename);
+            recorder.recordResources({ resource1 });
+            recorder.recordResources({ resource1, resource2 });
+        }
+
+        SceneFlushRecordReader reader(filename);
+        SceneFlushRecord record;
+        ASSERT_TRUE(reader.readNextRecord(record));
+        EXPECT_EQ(resource1.getResourceObject()->getHash(), record.resource.getResourceObject()->getHash());
+        ASSERT_TRUE(reader.readNextRecord(record));
+        EXPECT_EQ(resource2.getResourceObject()->getHash(), record.resource.getResourceObject()->getHash());
+        EXPECT_FALSE(reader.readNextRecord(record));
+    }
+
+    TEST_F(ASceneFlushRecording, failsToReadFileWhichIsNoRecording)
+    {
+        {
+            File file(filename);
+            BinaryFileOutputStream stream(file);
+            stream << UInt32(1u) << UInt32(2u);
+        }
+
+        SceneFlushRecordReader reader(filename);
+        EXPECT_FALSE(reader.isOpen());
+        SceneFlushRecord record;
+        EXPECT_FALSE(reader.readNextRecord(record));
+    }
+
+    TEST_F(ASceneFlushRecording, failsToReadMissingFile)
+    {
+        SceneFlushRecordReader reader("notExistingSceneFlushRecording.rec");
+        EXPECT_FALSE(reader.isOpen());
+    }
+}
@@ -12,6 +12,7 @@
 #include "RenderExecutorInternalState.h"
 #include "SceneAPI/EDataType.h"
 #include "SceneAPI/EFixedSemantics.h"
+#include "SceneAPI/SceneTypes.h"
 
 namespace ramses_internal
 {
@@ -22,7 +23,7 @@ namespace ramses_internal
     class RenderExecutor
     {
     public:
-        RenderExecutor(IDevice& device, const FrameBufferInfo& frameBuffer, const SceneRenderExecutionIterator& renderFrom = {}, const FrameTimer* frameTimer = nullptr);
+        RenderExecutor(IDevice& device, const FrameBufferInfo& frameBuffer, const SceneRenderExecutionIterator& renderFrom = {}, const FrameTimer* frameTimer = nullptr, Bool instancedDrawBatching = false);
 
         SceneRenderExecutionIterator executeScene(const RendererCachedScene& scene, const Matrix44f& rendererViewMatrix) const;
 
@@ -32,6 +33,8 @@ namespace ramses_internal
 
     protected:
         mutable RenderExecutorInternalState m_state;
+        // consecutive renderables differing only in world matrix are drawn with single instanced draw call
+        const Bool                          m_instancedDrawBatching;
 
         void executeRenderable      () const;
         void executeRenderTarget    (RenderTargetHandle renderTarget) const;
@@ -50,7 +53,12 @@ namespace ramses_internal
         void executeCamera(CameraHandle camera) const;
 
     private:
+        template <typename T>
+        void setConstant(DataFieldHandle field, UInt32 elementCount, const T* value) const;
+
         Bool executeRenderPass(const RendererCachedScene& scene, const RenderPassHandle pass) const;
+        UInt32 collectInstancingBatch(const RendererCachedScene& scene, const RenderableVector& orderedRenderables, UInt32 firstRenderableIdx) const;
+        static Bool CanBeDrawnInInstancingBatch(const RendererCachedScene& scene, RenderableHandle renderableHandle);
         void executeBlitPass(const RendererCachedScene& scene, const BlitPassHandle pass) const;
     };
 
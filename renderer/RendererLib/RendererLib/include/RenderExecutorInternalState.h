@@ -16,6 +16,8 @@
 #include "RendererLib/FrameTimer.h"
 #include "RenderExecutorInternalRenderStates.h"
 #include "FrameBufferInfo.h"
+#include "Collections/HashMap.h"
+#include "Collections/Vector.h"
 
 namespace ramses_internal
 {
@@ -85,6 +87,14 @@ namespace ramses_internal
         void                       setRenderable(RenderableHandle renderable);
         RenderableHandle           getRenderable() const;
 
+        // Shadow copies of uniform values set to shader programs during this execution, copies are kept per program
+        // as the values stay in the program when switching to another one. Only valid within one execution, because
+        // other parts of renderer set uniforms as well and device handles of deleted shaders get re-used.
+        void                       setUniformShadowProgram(DeviceResourceHandle shader);
+        // returns false if program of last set shader already holds the given value, otherwise updates shadow copy
+        Bool                       updateUniformShadowCopy(DataFieldHandle field, const void* data, UInt32 dataSize);
+        UInt32                     getSkippedUniformCount() const;
+
         Bool hasExceededTimeBudgetForRendering() const
         {
             return m_frameTimer != nullptr ? m_frameTimer->isTimeBudgetExceededForSection(EFrameTimerSectionBudget::OffscreenBufferRender) : false;
@@ -92,6 +102,7 @@ namespace ramses_internal
 
         CachedState < DeviceResourceHandle >    shaderDeviceHandle;
         CachedState < DeviceResourceHandle >    indexBufferDeviceHandle;
+        CachedState < DeviceResourceHandle >    vertexArrayDeviceHandle;
         CachedState < DepthStencilState >       depthStencilState;
         CachedState < BlendState >              blendState;
         CachedState < RasterizerState >         rasterizerState;
@@ -101,6 +112,9 @@ namespace ramses_internal
 
         SceneRenderExecutionIterator            m_currentRenderIterator;
 
+        // world matrices of renderables drawn together by current draw call, empty if current renderable is not batched
+        Vector<Matrix44f>                       instancingBatchWorldMatrices;
+
     private:
         IDevice&                    m_device;
         const RendererCachedScene*  m_scene;
@@ -119,6 +133,19 @@ namespace ramses_internal
 
         CachedState < CameraHandle >       m_camera;
 
+        struct UniformShadowCopy
+        {
+            UInt32 offset;
+            UInt32 size;
+        };
+        using ProgramUniformShadowCopies = Vector<UniformShadowCopy>;
+
+        HashMap<DeviceResourceHandle, ProgramUniformShadowCopies> m_uniformShadowCopies;
+        ProgramUniformShadowCopies* m_currentProgramUniforms;
+        // values of all shadow copies, updated in place if size did not change
+        Vector<Byte>                       m_uniformShadowData;
+        UInt32                             m_skippedUniformCount;
+
         const FrameTimer* const            m_frameTimer;
     };
 }
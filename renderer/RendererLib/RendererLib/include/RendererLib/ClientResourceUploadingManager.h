@@ -12,6 +12,9 @@
 #include "RendererLib/ResourceDescriptor.h"
 #include "Transfer/ResourceTypes.h"
 #include "Collections/HashMap.h"
+#include "Collections/HashSet.h"
+#include "Collections/Vector.h"
+#include "Math3d/Vector3.h"
 
 namespace ramses_internal
 {
@@ -21,6 +24,7 @@ namespace ramses_internal
     struct RenderBuffer;
     class FrameTimer;
     class RendererStatistics;
+    class TextureResource;
 
     class ClientResourceUploadingManager
     {
@@ -32,12 +36,26 @@ namespace ramses_internal
             Bool keepEffects,
             const FrameTimer& frameTimer,
             RendererStatistics& stats,
-            UInt64 clientResourceCacheSize);
+            UInt64 clientResourceCacheSize,
+            Bool computeVertexArrayBounds = false);
         ~ClientResourceUploadingManager();
 
         Bool hasAnythingToUpload() const;
         void uploadAndUnloadPendingResources();
 
+        // Provided resources are uploaded in order of priority:
+        // resources used by priority scenes (scenes being mapped, i.e. waiting for their resources to be shown) first,
+        // then resources with lower cache flag value (application hint), then smaller resources before larger ones.
+        void setPriorityScenes(const SceneIdVector& sceneIds);
+
+        // Scenes using textures which got a larger mip level uploaded since last call, they have to be rendered again
+        // even if they were not modified otherwise
+        void collectScenesUsingUpdatedResources(HashSet<SceneId>& scenesOut);
+
+        // Axis aligned bounds of uploaded vertex arrays with 2, 3 or 4 float components per vertex,
+        // only available if enabled at construction because every vertex has to be visited on upload
+        Bool getVertexArrayBounds(const ResourceContentHash& hash, Vector3& minOut, Vector3& maxOut) const;
+
         static const UInt32 NumResourcesToUploadInBetweenTimeBudgetChecks = 10u;
         static const UInt32 LargeResourceByteSizeThreshold = 250000u;
 
@@ -45,23 +63,48 @@ namespace ramses_internal
         void unloadClientResources(const ResourceContentHashVector& resourcesToUnload);
         void uploadClientResources(const ResourceContentHashVector& resourcesToUpload);
         void uploadClientResource(const ResourceDescriptor& rd);
+        DeviceResourceHandle uploadTextureProgressively(const ResourceDescriptor& rd, const TextureResource& texture);
+        void continueProgressiveTextureUploads();
         void unloadClientResource(const ResourceDescriptor& rd);
         void getClientResourcesToUnloadNext(ResourceContentHashVector& resourcesToUnload, Bool keepEffects, UInt64 sizeToBeFreed) const;
         void getAndPrepareClientResourcesToUploadNext(ResourceContentHashVector& resourcesToUpload, UInt64& totalSize) const;
         UInt64 getAmountOfMemoryToBeFreedForNewResources(UInt64 sizeToUpload) const;
+        void storeVertexArrayBounds(const ResourceContentHash& hash, const IResource& resource);
 
         RendererClientResourceRegistry& m_clientResources;
         IResourceUploader&              m_uploader;
         IRenderBackend&                 m_renderBackend;
 
         const Bool   m_keepEffects;
+        const Bool   m_computeVertexArrayBounds;
         const FrameTimer& m_frameTimer;
 
+        SceneIdVector m_priorityScenes;
+
         using SizeMap = HashMap<ResourceContentHash, UInt32>;
         SizeMap       m_clientResourceSizes;
         UInt64        m_clientResourceTotalUploadedSize = 0u;
         const UInt64  m_clientResourceCacheSize = 0u;
 
+        struct VertexArrayBounds
+        {
+            Vector3 min;
+            Vector3 max;
+        };
+        HashMap<ResourceContentHash, VertexArrayBounds> m_vertexArrayBounds;
+
+        // Large textures with provided mip chain get only their smallest levels uploaded at first,
+        // larger levels follow one per time budget check in next frames. Resource data is kept until level 0 is uploaded.
+        struct ProgressiveTextureUpload
+        {
+            ResourceContentHash hash;
+            ManagedResource resource;
+            DeviceResourceHandle deviceHandle;
+            UInt32 nextMipLevel;
+        };
+        Vector<ProgressiveTextureUpload> m_progressiveTextureUploads;
+        HashSet<SceneId> m_scenesUsingUpdatedResources;
+
         RendererStatistics& m_stats;
     };
 }
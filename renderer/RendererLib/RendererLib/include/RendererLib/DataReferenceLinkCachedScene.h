@@ -37,14 +37,26 @@ namespace ramses_internal
         virtual void                    setDataMatrix44fArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Matrix44f* data) override;
 
         void restoreFallbackValue(DataInstanceHandle containerHandle, DataFieldHandle field);
-        void setValueWithoutUpdatingFallbackValue(DataInstanceHandle containerHandle, DataFieldHandle field, const Variant& value);
+        void setValueWithoutUpdatingFallbackValue(DataInstanceHandle containerHandle, DataFieldHandle field, const Variant& value, UInt32 providerVersion);
+
+        // Provider data references get a new version whenever their value changes,
+        // consumers remember the provider version they got their value from.
+        // Links only need to be resolved if those two versions differ.
+        UInt32 getProviderDataVersion(DataInstanceHandle providerDataRef) const;
+        UInt32 getConsumerPropagatedDataVersion(DataInstanceHandle consumerDataRef) const;
+
+        static const UInt32 InvalidDataVersion = 0u;
 
     private:
         template <typename T>
-        void updateFallbackValue(DataInstanceHandle containerHandle, const T* data);
+        void updateDataReferenceState(DataInstanceHandle containerHandle, const T* data);
 
         typedef MemoryPool<Variant, DataInstanceHandle> FallbackValuePool;
         FallbackValuePool m_fallbackValues;
+
+        typedef MemoryPool<UInt32, DataInstanceHandle> DataVersionPool;
+        DataVersionPool m_providerDataVersions;
+        DataVersionPool m_consumerPropagatedDataVersions;
     };
 }
 
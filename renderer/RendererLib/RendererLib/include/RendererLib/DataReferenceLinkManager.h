@@ -26,7 +26,14 @@ namespace ramses_internal
         Bool createDataLink(SceneId providerSceneId, DataSlotHandle providerSlotHandle, SceneId consumerSceneId, DataSlotHandle consumerSlotHandle);
         Bool removeDataLink(SceneId consumerSceneId, DataSlotHandle consumerSlotHandle);
 
-        void resolveLinksForConsumerScene(DataReferenceLinkCachedScene& consumerScene) const;
+        struct ResolveStatistics
+        {
+            UInt32 checkedLinks = 0u;
+            UInt32 propagatedLinks = 0u;
+        };
+
+        // propagates only values of providers which changed since last resolve or consumers which were overwritten meanwhile
+        ResolveStatistics resolveLinksForConsumerScene(DataReferenceLinkCachedScene& consumerScene) const;
         void updateFallbackValue(SceneId consumerSceneId, DataInstanceHandle dataInstance) const;
 
         using LinkManagerBase::getDependencyChecker;
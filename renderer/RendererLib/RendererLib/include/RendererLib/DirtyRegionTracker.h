@@ -0,0 +1,89 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_DIRTYREGIONTRACKER_H
+#define RAMSES_DIRTYREGIONTRACKER_H
+
+#include "SceneAPI/SceneId.h"
+#include "SceneAPI/Handles.h"
+#include "Math3d/Quad.h"
+#include "Math3d/Matrix44f.h"
+#include "Collections/HashMap.h"
+#include "Collections/Vector.h"
+
+namespace ramses_internal
+{
+    class RendererCachedScene;
+    class IRendererResourceManager;
+    class ProjectionParams;
+    class Vector3;
+
+    // Finds the screen region of the framebuffer which changed when a scene was modified. For every renderable
+    // rendered into the framebuffer the tracker keeps the state which influences its rendering together with
+    // its screen bounds, the region of a changed renderable is the union of its old and new screen bounds.
+    // Screen bounds are computed from the vertex position bounds and world matrix if the effect uses
+    // the model-view-projection semantics, otherwise the viewport of the renderable's camera is used.
+    // Vertex shaders are not analyzed: a shader which moves vertices further than the transformation by
+    // these matrices (e.g. displacement along normals or vertex animation) can draw outside its screen bounds
+    // and leave stale pixels there, such content must not be used with partial redraw.
+    // Additionally the tracker keeps history of changed regions of last frames to support buffer age.
+    class DirtyRegionTracker
+    {
+    public:
+        Quad updateSceneAndGetDirtyRegion(const RendererCachedScene& scene, const IRendererResourceManager& resourceManager, const Quad& bufferRegion, const Matrix44f& rendererViewMatrix, const ProjectionParams& rendererProjectionParams);
+        void untrackScene(SceneId sceneId);
+
+        Quad getRegionToRedraw(const Quad& frameRegion, UInt32 bufferAge, const Quad& bufferRegion) const;
+        void frameRendered(const Quad& frameRegion);
+
+        // partial redraw uses scissor test which would also apply when rendering into render targets
+        static Bool RendersIntoOffscreenTargets(const RendererCachedScene& scene);
+        static Quad GetScreenBounds(const Matrix44f& modelViewProjectionMatrix, const Vector3& minPosition, const Vector3& maxPosition, const Quad& viewport);
+
+        static const UInt32 MaxBufferAge = 4u;
+
+    private:
+        struct RenderableState
+        {
+            UInt32       orderIndex;
+            UInt64       lastUpdate;
+            Vector<Byte> state;
+            Quad         screenBounds;
+        };
+        using RenderableStates = HashMap<RenderableHandle, RenderableState>;
+
+        struct PassState
+        {
+            Vector<Byte>     state;
+            RenderableStates renderables;
+        };
+        using SceneState = Vector<PassState>;
+
+        struct PassCameraInfo
+        {
+            Matrix44f viewProjectionMatrix;
+            Quad      viewport;
+        };
+
+        void collectPassStates(const RendererCachedScene& scene, const Quad& bufferRegion, const Matrix44f& rendererViewMatrix, const ProjectionParams& rendererProjectionParams);
+        Bool collectRenderableState(const RendererCachedScene& scene, RenderableHandle renderable, Vector<Byte>& stateOut) const;
+        Quad computeScreenBounds(const RendererCachedScene& scene, const IRendererResourceManager& resourceManager, RenderableHandle renderable, const PassCameraInfo& camera) const;
+
+        HashMap<SceneId, SceneState> m_sceneStates;
+        Vector<Quad>                 m_frameRegionHistory;
+        UInt64                       m_updateCounter = 0u;
+
+        // temporary containers kept to avoid re-allocations
+        Vector<Vector<Byte>>   m_tempPassStates;
+        Vector<PassCameraInfo> m_tempPassCameras;
+        Vector<Byte>           m_tempRenderableState;
+        Vector<RenderableHandle> m_tempRemovedRenderables;
+    };
+}
+
+#endif
@@ -83,6 +83,12 @@ namespace ramses_internal
         Bool isResizable() const;
         void setResizable(Bool resizable);
 
+        Bool isPartialRedrawEnabled() const;
+        void setPartialRedrawEnabled(Bool enabled);
+
+        Bool isInstancedDrawBatchingEnabled() const;
+        void setInstancedDrawBatchingEnabled(Bool enabled);
+
         UInt64 getGPUMemoryCacheSize() const;
         void setGPUMemoryCacheSize(UInt64 size);
 
@@ -101,6 +107,8 @@ namespace ramses_internal
         Bool m_warpingEnabled = false;
         Bool m_resizable = false;
         Bool m_stereoDisplay = false;
+        Bool m_partialRedrawEnabled = false;
+        Bool m_instancedDrawBatchingEnabled = false;
 
         UInt32 m_desiredWindowWidth = 1280;
         UInt32 m_desiredWindowHeight = 480;
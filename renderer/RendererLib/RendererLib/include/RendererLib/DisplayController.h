@@ -59,6 +59,8 @@ namespace ramses_internal
         virtual Bool                    readPixels(UInt32 x, UInt32 y, UInt32 width, UInt32 height, Vector<UInt8>& dataOut) override;
         virtual Bool                    isWarpingEnabled() const override;
         virtual void                    setWarpingMeshData(const WarpingMeshData& warpingMeshData) override;
+        virtual void                    setInstancedDrawBatchingEnabled(Bool enabled) override;
+        Bool                            isInstancedDrawBatchingEnabled() const;
 
         virtual void validateRenderingStatusHealthy() const override;
 
@@ -76,6 +78,7 @@ namespace ramses_internal
 
         const UInt32            m_displayWidth;
         const UInt32            m_displayHeight;
+        Bool                    m_instancedDrawBatchingEnabled = false;
 
         std::unique_ptr<Postprocessing> m_postProcessing;
     };
@@ -13,6 +13,7 @@
 #include "SceneAPI/SceneId.h"
 #include "SceneAPI/Viewport.h"
 #include "Math3d/Vector4.h"
+#include "Math3d/Quad.h"
 #include "Collections/Vector.h"
 #include <map>
 
@@ -34,6 +35,8 @@ namespace ramses_internal
         Vector4 clearColor;
         MappedScenes mappedScenes;
         Bool needsRerender;
+        // region which changed since last render if the buffer does not need to be fully re-rendered
+        Quad partialRerenderRegion;
     };
     using DisplayBuffersMap = std::map<DeviceResourceHandle, DisplayBufferInfo>;
 
@@ -46,6 +49,7 @@ namespace ramses_internal
         const DisplayBufferInfo& getDisplayBuffer(DeviceResourceHandle displayBuffer) const;
 
         void setDisplayBufferToBeRerendered(DeviceResourceHandle displayBuffer, Bool rerender);
+        void addDisplayBufferRegionToBeRerendered(DeviceResourceHandle displayBuffer, const Quad& region);
 
         void                 mapSceneToDisplayBuffer(SceneId sceneId, DeviceResourceHandle displayBuffer, Int32 sceneOrder);
         void                 unmapScene(SceneId sceneId);
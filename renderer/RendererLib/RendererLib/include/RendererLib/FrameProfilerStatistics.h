@@ -64,6 +64,9 @@ namespace ramses_internal
             DrawCalls = 0,
             AppliedSceneActions,
             UsedGPUMemory,
+            ActiveAnimationSystems,
+            CheckedDataLinks,
+            PropagatedDataLinks,
             Count
         };
 
@@ -103,6 +106,10 @@ namespace ramses_internal
         void markFrameFinished(std::chrono::microseconds sleepTime);
         UInt32 getCurrentFrameId() const;
 
+        // region times of frames since last reset, NumberOfRegions entries per frame, last entries belong to frame in progress
+        using FrameTimings = Vector<UInt>;
+        const FrameTimings& getFrameTimings() const;
+
         void writeLongestFrameTimingsToStream(StringOutputStream& str) const;
         void resetFrameTimings();
 
@@ -120,7 +127,7 @@ namespace ramses_internal
 
         // region measurements for periodic logging
         // these are reset every period
-        Vector<UInt> m_frameTimings;
+        FrameTimings m_frameTimings;
 
         using Counters = Vector<CounterValues>;
         Counters m_counters;
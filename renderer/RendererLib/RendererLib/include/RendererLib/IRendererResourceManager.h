@@ -16,10 +16,12 @@
 #include "SceneAPI/SceneTypes.h"
 #include "SceneAPI/TextureSamplerStates.h"
 #include "Resource/EResourceType.h"
+#include "Collections/HashSet.h"
 
 namespace ramses_internal
 {
     struct RenderTarget;
+    class Vector3;
     class RendererLogContext;
     class IRendererResourceCache;
     enum class EDataBufferType : UInt8;
@@ -30,6 +32,7 @@ namespace ramses_internal
         // Client resources
         virtual EResourceStatus  getClientResourceStatus(const ResourceContentHash& hash) const = 0;
         virtual EResourceType    getClientResourceType(const ResourceContentHash& hash) const = 0;
+        virtual Bool             getClientResourceVertexBounds(const ResourceContentHash& hash, Vector3& minOut, Vector3& maxOut) const = 0;
 
         virtual void             referenceClientResourcesForScene     (SceneId sceneId, const ResourceContentHashVector& resources) = 0;
         virtual void             unreferenceClientResourcesForScene   (SceneId sceneId, const ResourceContentHashVector& resources) = 0;
@@ -39,6 +42,15 @@ namespace ramses_internal
         virtual void             processArrivedClientResources(IRendererResourceCache* cache) = 0;
         virtual Bool             hasClientResourcesToBeUploaded() const = 0;
         virtual void             uploadAndUnloadPendingClientResources() = 0;
+        // scenes using client resources updated on device by previous upload, e.g. larger mip levels of progressively uploaded textures
+        virtual void             collectScenesUsingUpdatedClientResources(HashSet<SceneId>& scenesOut) = 0;
+        // client resources used by given scenes are uploaded before any other client resources
+        virtual void             setClientResourceUploadPriorityScenes(const SceneIdVector& sceneIds) = 0;
+        // client resources expected to be used by given scene soon are requested right away and kept until referenced by a scene
+        virtual void             prefetchClientResources(SceneId sceneId, const ResourceContentHashVector& resources) = 0;
+        virtual void             releasePrefetchedClientResources(SceneId sceneId) = 0;
+        // arrived prefetched resources are decompressed as long as time budget for client resources upload allows it
+        virtual void             decompressPrefetchedClientResources() = 0;
 
         // Scene resources
         virtual void             uploadRenderTargetBuffer(RenderBufferHandle renderBufferHandle, SceneId sceneId, const RenderBuffer& renderBuffer) = 0;
@@ -63,6 +75,9 @@ namespace ramses_internal
         virtual void             unloadTextureBuffer(TextureBufferHandle textureBufferHandle, SceneId sceneId) = 0;
         virtual void             updateTextureBuffer(TextureBufferHandle textureBufferHandle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 width, UInt32 height, const Byte* data, SceneId sceneId) = 0;
 
+        virtual void             uploadVertexArray(DataInstanceHandle geometryInstance, const VertexArrayInfo& vertexArrayInfo, SceneId sceneId) = 0;
+        virtual void             unloadVertexArray(DataInstanceHandle geometryInstance, DeviceResourceHandle shader, SceneId sceneId) = 0;
+
         virtual void             unloadAllSceneResourcesForScene(SceneId sceneId) = 0;
         virtual void             unreferenceAllClientResourcesForScene(SceneId sceneId) = 0;
 
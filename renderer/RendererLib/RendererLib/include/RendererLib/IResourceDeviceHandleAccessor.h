@@ -31,6 +31,7 @@ namespace ramses_internal
         virtual DeviceResourceHandle getDataBufferDeviceHandle(DataBufferHandle dataBufferHandle, SceneId sceneId) const = 0;
         virtual DeviceResourceHandle getTextureBufferDeviceHandle(TextureBufferHandle textureBufferHandle, SceneId sceneId) const = 0;
         virtual DeviceResourceHandle getTextureSamplerDeviceHandle(TextureSamplerHandle textureSamplerHandle, SceneId sceneId) const = 0;
+        virtual DeviceResourceHandle getVertexArrayDeviceHandle(DataInstanceHandle geometryInstance, DeviceResourceHandle shader, SceneId sceneId) const = 0;
     };
 }
 #endif
@@ -18,6 +18,7 @@ namespace ramses_internal
 {
     class IResource;
     class IRenderBackend;
+    class TextureResource;
 
     class IResourceUploader
     {
@@ -26,6 +27,11 @@ namespace ramses_internal
 
         virtual DeviceResourceHandle uploadResource(IRenderBackend& renderBackend, ManagedResource resourceObject) = 0;
         virtual void                 unloadResource(IRenderBackend& renderBackend, EResourceType type, ResourceContentHash hash, DeviceResourceHandle handle) = 0;
+
+        // Progressive texture upload: storage of all mip levels is allocated first and levels are uploaded one by one later,
+        // starting with the smallest one. Texture is sampled only from the last uploaded level on.
+        virtual DeviceResourceHandle allocateTexture(IRenderBackend& renderBackend, const TextureResource& texture) = 0;
+        virtual void                 uploadTextureMipLevel(IRenderBackend& renderBackend, DeviceResourceHandle textureHandle, const TextureResource& texture, UInt32 mipLevel) = 0;
     };
 }
 
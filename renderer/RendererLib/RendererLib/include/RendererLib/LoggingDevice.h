@@ -34,6 +34,7 @@ namespace ramses_internal
         virtual void setConstant(DataFieldHandle field, UInt32 count, const Matrix22f* value) override;
         virtual void setConstant(DataFieldHandle field, UInt32 count, const Matrix33f* value) override;
         virtual void setConstant(DataFieldHandle field, UInt32 count, const Matrix44f* value) override;
+        virtual void setInstanceWorldMatrices(DataFieldHandle field, UInt32 count, const Matrix44f* matrices) override;
 
         virtual void colorMask(Bool r, Bool g, Bool b, Bool a) override;
         virtual void clearColor(const Vector4& clearColor) override;
@@ -58,6 +59,9 @@ namespace ramses_internal
         virtual void uploadIndexBufferData(DeviceResourceHandle handle, const Byte* data, UInt32 dataSize) override;
         virtual void deleteIndexBuffer(DeviceResourceHandle handle) override;
         virtual void activateIndexBuffer(DeviceResourceHandle handle) override;
+        virtual DeviceResourceHandle allocateVertexArray(const VertexArrayInfo& vertexArrayInfo) override;
+        virtual void activateVertexArray(DeviceResourceHandle handle) override;
+        virtual void deleteVertexArray(DeviceResourceHandle handle) override;
         virtual DeviceResourceHandle uploadShader(const EffectResource& effect) override;
         virtual DeviceResourceHandle uploadBinaryShader(const EffectResource& effect, const UInt8* binaryShaderData = NULL, UInt32 binaryShaderDataSize = 0, UInt32 binaryShaderFormat = 0) override;
         virtual Bool getBinaryShader(DeviceResourceHandle handle, UInt8Vector& binaryShader, UInt32& binaryShaderFormat) override;
@@ -68,6 +72,7 @@ namespace ramses_internal
         virtual DeviceResourceHandle allocateTextureCube(UInt32 faceSize, ETextureFormat textureFormat, UInt32 mipLevelCount, UInt32 dataSize) override;
         virtual void                 bindTexture(DeviceResourceHandle handle) override;
         virtual void                 generateMipmaps(DeviceResourceHandle handle) override;
+        virtual void                 setTextureBaseMipLevel(DeviceResourceHandle handle, UInt32 baseMipLevel) override;
         virtual void                 uploadTextureData(DeviceResourceHandle handle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 z, UInt32 width, UInt32 height, UInt32 depth, const Byte* data, UInt32 dataSize) override;
         virtual DeviceResourceHandle uploadStreamTexture2D(DeviceResourceHandle handle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8* data) override;
         virtual void deleteTexture(DeviceResourceHandle handle) override;
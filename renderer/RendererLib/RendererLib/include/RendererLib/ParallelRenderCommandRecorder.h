@@ -0,0 +1,81 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_PARALLELRENDERCOMMANDRECORDER_H
+#define RAMSES_PARALLELRENDERCOMMANDRECORDER_H
+
+#include "RendererLib/RenderCommandList.h"
+#include "FrameBufferInfo.h"
+#include "SceneAPI/SceneId.h"
+#include "Math3d/Matrix44f.h"
+#include "Collections/Vector.h"
+#include "Collections/HashMap.h"
+#include "TaskFramework/ThreadedTaskExecutor.h"
+#include "PlatformAbstraction/PlatformLock.h"
+#include "PlatformAbstraction/PlatformConditionVariable.h"
+#include <memory>
+#include <atomic>
+
+namespace ramses_internal
+{
+    class RendererCachedScene;
+
+    // Records render commands of multiple scenes into command lists, one list per scene. Scenes are recorded in parallel
+    // by worker threads and the calling thread, the calling thread is blocked until all scenes are recorded.
+    // The recorded lists are then replayed on the thread owning the graphics context.
+    // Every scene can be added only once per recording, as recording also writes semantic uniforms into the scene.
+    // Scenes consuming transformation links update matrix caches of their provider scenes when recording, therefore they
+    // are recorded one after another on the calling thread before any other scene is recorded in parallel.
+    class ParallelRenderCommandRecorder
+    {
+    public:
+        explicit ParallelRenderCommandRecorder(UInt16 workerThreadCount);
+        ~ParallelRenderCommandRecorder();
+
+        void addScene(const RendererCachedScene& scene, const FrameBufferInfo& frameBuffer, const Matrix44f& rendererViewMatrix, Bool instancedDrawBatching = false);
+        void recordScenes();
+        // returns nullptr if scene was not recorded
+        const RenderCommandList* getRecordedCommands(SceneId sceneId) const;
+        void reset();
+
+        UInt32 getSceneCount() const;
+
+    private:
+        class RecordingTask;
+
+        struct SceneToRecord
+        {
+            const RendererCachedScene* scene;
+            FrameBufferInfo            frameBuffer;
+            Matrix44f                  rendererViewMatrix;
+            Bool                       instancedDrawBatching;
+            Bool                       recordSequentially;
+        };
+
+        void recordScenesOnCurrentThread();
+        void recordScene(UInt sceneIdx);
+        void onTaskFinished();
+
+        Vector<SceneToRecord>                      m_scenesToRecord;
+        HashMap<SceneId, UInt>                     m_sceneIndices;
+        // lists are kept over multiple recordings to re-use their memory
+        Vector<std::unique_ptr<RenderCommandList>> m_commandLists;
+        UInt                                       m_sequentialSceneCount = 0u;
+        std::atomic<UInt>                          m_nextSceneToRecord;
+
+        PlatformLightweightLock                    m_lock;
+        PlatformConditionVariable                  m_tasksFinished;
+        UInt                                       m_runningTasks = 0u;
+
+        Vector<std::unique_ptr<RecordingTask>>     m_tasks;
+        // declared last so that worker threads are stopped before anything they use is destroyed
+        ThreadedTaskExecutor                       m_executor;
+    };
+}
+
+#endif
@@ -0,0 +1,145 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_RENDERCOMMANDLIST_H
+#define RAMSES_RENDERCOMMANDLIST_H
+
+#include "RendererAPI/IDevice.h"
+#include "Collections/Vector.h"
+
+namespace ramses_internal
+{
+    // Device which does not render but records all render commands (states, constants, activations, draw calls, blits)
+    // into a device independent list, which can be replayed later on a real device.
+    // Recording does not need a graphics context, so scenes can be recorded on other threads than the one owning the context.
+    // Constant values are copied when recorded, the list does not reference any scene data.
+    // Resource management, read back and statistics are not render commands and must not be called on the list.
+    class RenderCommandList final : public IDevice
+    {
+    public:
+        void replay(IDevice& device) const;
+        void clearCommands();
+        UInt32 getCommandCount() const;
+
+        virtual EDeviceTypeId getDeviceTypeId() const override;
+
+        virtual void setConstant(DataFieldHandle field, UInt32 count, const Float*      value) override;
+        virtual void setConstant(DataFieldHandle field, UInt32 count, const Vector2*    value) override;
+        virtual void setConstant(DataFieldHandle field, UInt32 count, const Vector3*    value) override;
+        virtual void setConstant(DataFieldHandle field, UInt32 count, const Vector4*    value) override;
+        virtual void setConstant(DataFieldHandle field, UInt32 count, const Int32*      value) override;
+        virtual void setConstant(DataFieldHandle field, UInt32 count, const Vector2i*   value) override;
+        virtual void setConstant(DataFieldHandle field, UInt32 count, const Vector3i*   value) override;
+        virtual void setConstant(DataFieldHandle field, UInt32 count, const Vector4i*   value) override;
+        virtual void setConstant(DataFieldHandle field, UInt32 count, const Matrix22f*  value) override;
+        virtual void setConstant(DataFieldHandle field, UInt32 count, const Matrix33f*  value) override;
+        virtual void setConstant(DataFieldHandle field, UInt32 count, const Matrix44f*  value) override;
+        virtual void setInstanceWorldMatrices(DataFieldHandle field, UInt32 count, const Matrix44f* matrices) override;
+
+        virtual void clear               (UInt32 clearFlags) override;
+        virtual void drawIndexedTriangles(Int32 startOffset, Int32 elementCount, UInt32 instanceCount) override;
+        virtual void drawTriangles       (Int32 startOffset, Int32 elementCount, UInt32 instanceCount) override;
+        virtual void finish              () override;
+
+        virtual void colorMask           (Bool r, Bool g, Bool b, Bool a) override;
+        virtual void clearColor          (const Vector4& clearColor) override;
+        virtual void clearDepth          (Float d) override;
+        virtual void clearStencil        (Int32 s) override;
+        virtual void blendFactors        (EBlendFactor sourceColor, EBlendFactor destinationColor, EBlendFactor sourceAlpha, EBlendFactor destinationAlpha) override;
+        virtual void blendOperations     (EBlendOperation operationColor, EBlendOperation operationAlpha) override;
+        virtual void cullMode            (ECullMode mode) override;
+        virtual void depthFunc           (EDepthFunc func) override;
+        virtual void depthWrite          (EDepthWrite flag) override;
+        virtual void stencilFunc         (EStencilFunc func, UInt8 ref, UInt8 mask) override;
+        virtual void stencilOp           (EStencilOp sfail, EStencilOp dpfail, EStencilOp dppass) override;
+        virtual void drawMode            (EDrawMode mode) override;
+        virtual void setViewport         (UInt32 x, UInt32 y, UInt32 width, UInt32 height) override;
+        virtual void enableScissorTest   (Bool flag) override;
+        virtual void setScissorRegion    (UInt32 x, UInt32 y, UInt32 width, UInt32 height) override;
+        virtual void setTextureSampling  (DataFieldHandle field, EWrapMethod wrapU, EWrapMethod wrapV, EWrapMethod wrapR, ESamplingMethod sampling, UInt32 anisotropyLevel) override;
+
+        virtual DeviceResourceHandle    allocateVertexBuffer        (EDataType dataType, UInt32 sizeInBytes) override;
+        virtual void                    uploadVertexBufferData      (DeviceResourceHandle handle, const Byte* data, UInt32 dataSize) override;
+        virtual void                    deleteVertexBuffer          (DeviceResourceHandle handle) override;
+        virtual void                    activateVertexBuffer        (DeviceResourceHandle handle, DataFieldHandle field, UInt32 instancingDivisor) override;
+
+        virtual DeviceResourceHandle    allocateIndexBuffer         (EDataType dataType, UInt32 sizeInBytes) override;
+        virtual void                    uploadIndexBufferData       (DeviceResourceHandle handle, const Byte* data, UInt32 dataSize) override;
+        virtual void                    deleteIndexBuffer           (DeviceResourceHandle handle) override;
+        virtual void                    activateIndexBuffer         (DeviceResourceHandle handle) override;
+
+        virtual DeviceResourceHandle    allocateVertexArray         (const VertexArrayInfo& vertexArrayInfo) override;
+        virtual void                    activateVertexArray         (DeviceResourceHandle handle) override;
+        virtual void                    deleteVertexArray           (DeviceResourceHandle handle) override;
+
+        virtual DeviceResourceHandle    uploadShader                (const EffectResource& effect) override;
+        virtual DeviceResourceHandle    uploadBinaryShader          (const EffectResource& effect, const UInt8* binaryShaderData, UInt32 binaryShaderDataSize, UInt32 binaryShaderFormat) override;
+        virtual Bool                    getBinaryShader             (DeviceResourceHandle handle, UInt8Vector& binaryShader, UInt32& binaryShaderFormat) override;
+        virtual void                    deleteShader                (DeviceResourceHandle handle) override;
+        virtual void                    activateShader              (DeviceResourceHandle handle) override;
+
+        virtual DeviceResourceHandle    allocateTexture2D           (UInt32 width, UInt32 height, ETextureFormat textureFormat, UInt32 mipLevelCount, UInt32 totalSizeInBytes) override;
+        virtual DeviceResourceHandle    allocateTexture3D           (UInt32 width, UInt32 height, UInt32 depth, ETextureFormat textureFormat, UInt32 mipLevelCount, UInt32 totalSizeInBytes) override;
+        virtual DeviceResourceHandle    allocateTextureCube         (UInt32 faceSize, ETextureFormat textureFormat, UInt32 mipLevelCount, UInt32 totalSizeInBytes) override;
+        virtual void                    bindTexture                 (DeviceResourceHandle handle) override;
+        virtual void                    generateMipmaps             (DeviceResourceHandle handle) override;
+        virtual void                    setTextureBaseMipLevel      (DeviceResourceHandle handle, UInt32 baseMipLevel) override;
+        virtual void                    uploadTextureData           (DeviceResourceHandle handle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 z, UInt32 width, UInt32 height, UInt32 depth, const Byte* data, UInt32 dataSize) override;
+        virtual DeviceResourceHandle    uploadStreamTexture2D       (DeviceResourceHandle handle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8* data) override;
+        virtual void                    deleteTexture               (DeviceResourceHandle handle) override;
+        virtual void                    activateTexture             (DeviceResourceHandle handle, DataFieldHandle field) override;
+
+        virtual DeviceResourceHandle    uploadRenderBuffer          (const RenderBuffer& renderBuffer) override;
+        virtual void                    deleteRenderBuffer          (DeviceResourceHandle handle) override;
+
+        virtual DeviceResourceHandle    uploadTextureSampler        (EWrapMethod wrapU, EWrapMethod wrapV, EWrapMethod wrapR, ESamplingMethod sampling, UInt32 anisotropyLevel) override;
+        virtual void                    deleteTextureSampler        (DeviceResourceHandle handle) override;
+        virtual void                    activateTextureSampler      (DeviceResourceHandle handle, DataFieldHandle field) override;
+
+        virtual DeviceResourceHandle    getFramebufferRenderTarget  () const override;
+        virtual DeviceResourceHandle    uploadRenderTarget          (const DeviceHandleVector& renderBuffers) override;
+        virtual void                    activateRenderTarget        (DeviceResourceHandle handle) override;
+        virtual void                    deleteRenderTarget          (DeviceResourceHandle handle) override;
+
+        virtual void                    pairRenderTargetsForDoubleBuffering (DeviceResourceHandle renderTargets[2], DeviceResourceHandle colorBuffers[2]) override;
+        virtual void                    unpairRenderTargets               (DeviceResourceHandle renderTarget) override;
+        virtual void                    swapDoubleBufferedRenderTarget    (DeviceResourceHandle renderTarget) override;
+
+        virtual void                    blitRenderTargets           (DeviceResourceHandle rtSrc, DeviceResourceHandle rtDst, const PixelRectangle& srcRect, const PixelRectangle& dstRect, Bool colorOnly) override;
+
+        virtual void readPixels(UInt8* buffer, UInt32 x, UInt32 y, UInt32 width, UInt32 height) override;
+
+        virtual UInt32  getTotalGpuMemoryUsageInKB() const override;
+        virtual UInt32  getDrawCallCount() const override;
+        virtual void    resetDrawCallCount() override;
+
+        virtual void    validateDeviceStatusHealthy() const override;
+        virtual Bool    isDeviceStatusHealthy() const override;
+
+        virtual int getTextureAddress(DeviceResourceHandle handle) const override;
+
+    private:
+        enum class ECommand : UInt8;
+
+        void addCommand(ECommand command);
+        template <typename T>
+        void write(const T& value);
+        template <typename T>
+        void writeConstant(DataFieldHandle field, UInt32 count, const T* values);
+        template <typename T>
+        T read(UInt& offset) const;
+        template <typename T>
+        void replayConstant(IDevice& device, UInt& offset) const;
+
+        // commands with their parameters, constant values are stored aligned to their type
+        Vector<Byte> m_data;
+        UInt32       m_commandCount = 0u;
+    };
+}
+
+#endif
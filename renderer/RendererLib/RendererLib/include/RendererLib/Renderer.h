@@ -17,16 +17,19 @@
 #include "RendererLib/DisplayEventHandlerManager.h"
 #include "RendererLib/RendererInterruptState.h"
 #include "RendererLib/DisplaySetup.h"
+#include "RendererLib/DirtyRegionTracker.h"
+#include "RendererLib/ParallelRenderCommandRecorder.h"
+#include "RendererLib/RendererCachedScene.h"
 #include "FrameProfileRenderer.h"
 #include "MemoryStatistics.h"
 #include "Collections/Vector.h"
 #include "Collections/HashMap.h"
+#include "Utils/ScopedPointer.h"
 #include <map>
 
 namespace ramses_internal
 {
     class IDisplayController;
-    class RendererCachedScene;
     class ISystemCompositorController;
     class DisplayConfig;
     class IPlatformFactory;
@@ -38,6 +41,7 @@ namespace ramses_internal
     class FrameTimer;
     class SceneExpirationMonitor;
     class WarpingMeshData;
+    class IRendererResourceManager;
 
     class Renderer
     {
@@ -61,7 +65,10 @@ namespace ramses_internal
         void                        setSceneShown               (SceneId sceneId, Bool show);
 
         void                        markBufferWithMappedSceneAsModified(SceneId sceneId);
+        void                        markBufferWithMappedSceneAsModified(SceneId sceneId, const IRendererResourceManager& resourceManager);
         void                        setSkippingOfUnmodifiedBuffers(Bool enable);
+        // 0 disables parallel recording, scenes are then rendered directly on renderer thread
+        void                        setParallelCommandRecording(UInt16 workerThreadCount);
 
         virtual void                createDisplayContext(const DisplayConfig& displayConfig, DisplayHandle display);
         virtual void                destroyDisplayContext(DisplayHandle display);
@@ -69,6 +76,7 @@ namespace ramses_internal
         IDisplayController&         getDisplayController(DisplayHandle display);
         UInt32                      getDisplayControllerCount() const;
         Bool                        hasDisplayController(DisplayHandle display) const;
+        Bool                        isPartialRedrawUsed(DisplayHandle display) const;
 
         DisplayEventHandler&        getDisplayEventHandler(DisplayHandle display);
         void                        setWarpingMeshData(DisplayHandle display, const WarpingMeshData& meshData);
@@ -107,8 +115,12 @@ namespace ramses_internal
     private:
         void handleDisplayEvents(DisplayHandle displayHandle);
         void renderToFramebuffer(DisplayHandle displayHandle, DisplayHandle& activeDisplay);
+        Quad getFramebufferRegionToRedraw(DisplayHandle displayHandle, const Quad& bufferRegion);
         void renderToOffscreenBuffers(DisplayHandle displayHandle, DisplayHandle& activeDisplay);
         void renderToInterruptibleOffscreenBuffers(DisplayHandle displayHandle, DisplayHandle& activeDisplay, Bool& interrupted);
+        void recordScenesInParallel();
+        void addScenesToRecord(const IDisplayController& display, const DisplayBufferInfo& displayBufferInfo, DeviceResourceHandle buffer, Bool instancedDrawBatching);
+        void renderSceneToBuffer(IDisplayController& display, const RendererCachedScene& scene, DeviceResourceHandle buffer, const Viewport& viewport);
         IDisplayController* createDisplayControllerFromConfig(const DisplayConfig& config, DisplayEventHandler& displayEventHandler);
         void processScheduledScreenshots(DisplayHandle display, IDisplayController& controller, DisplayHandle& activeDisplay);
         Bool hasAnyOffscreenBufferToRerender(DisplayHandle display, Bool interruptible) const;
@@ -123,6 +135,11 @@ namespace ramses_internal
             Bool                 couldRenderLastFrame;
             DeviceResourceHandle frameBufferDeviceHandle;
             DisplaySetup         buffersSetup;
+            // only created if partial redraw of framebuffer is enabled
+            ScopedPointer<DirtyRegionTracker> dirtyRegionTracker;
+            // stereo display renders every scene once per eye into its own buffers with view updated when enabling context
+            Bool                 supportsCommandRecording = true;
+            Bool                 instancedDrawBatching = false;
         };
         using Displays = std::map<DisplayHandle, DisplayInfo>;
 
@@ -140,6 +157,7 @@ namespace ramses_internal
         MemoryStatistics                       m_memoryStatistics;
 
         Bool                                   m_skipUnmodifiedBuffers = true;
+        ScopedPointer<ParallelRenderCommandRecorder> m_commandRecorder;
         RendererInterruptState                 m_rendererInterruptState;
         const FrameTimer&                      m_frameTimer;
         SceneExpirationMonitor&                        m_expirationMonitor;
@@ -154,6 +172,7 @@ namespace ramses_internal
         Vector<DisplayHandle> m_tempDisplaysToRender; // used in RendererLogger - adapt if changing behavior
         Vector<DisplayHandle> m_tempDisplaysToSwapBuffers;
         Vector<SceneId> m_tempScenesRendered;
+        RendererCachedScene::RenderPassBatchingResults m_tempRenderPassBatching;
     };
 }
 
@@ -53,6 +53,23 @@ namespace ramses_internal
         const RenderableVector&             getOrderedRenderablesForPass    (RenderPassHandle pass) const;
         const Matrix44f&                    getRenderableWorldMatrix        (RenderableHandle renderable) const;
 
+        // render passes executed with instanced draw batching are reported by render executor and collected by renderer
+        // once scene was rendered, one execution of a pass can be reported in several parts if rendering got interrupted
+        struct RenderPassBatchingResult
+        {
+            RenderPassHandle pass;
+            UInt32           numRenderables;
+            UInt32           numDrawCalls;
+        };
+        using RenderPassBatchingResults = Vector<RenderPassBatchingResult>;
+        void                                reportRenderPassBatching        (RenderPassHandle pass, UInt32 numRenderables, UInt32 numDrawCalls) const;
+        void                                collectRenderPassBatching       (RenderPassBatchingResults& resultsOut) const;
+
+        // uniforms not set to device because the shader program already held the same value,
+        // reported by render executor and collected by renderer once scene was rendered
+        void                                reportSkippedUniforms           (UInt32 numSkippedUniforms) const;
+        UInt32                              collectSkippedUniforms          () const;
+
     private:
         void updatePassRenderableSorting();
         void updateRenderablesInPass(RenderPassHandle passHandle);
@@ -69,6 +86,9 @@ namespace ramses_internal
 
         using RenderPasses = HashSet<RenderPassHandle>;
         mutable RenderPasses m_renderOncePassesToRender;
+
+        mutable RenderPassBatchingResults m_renderPassBatchingResults;
+        mutable UInt32                    m_skippedUniforms = 0u;
     };
 }
 
@@ -35,9 +35,16 @@ namespace ramses_internal
         const String& getKPIFileName() const;
         void setKPIFileName(const String& filename);
 
+        const String& getSceneFlushRecordingFileName() const;
+        void setSceneFlushRecordingFileName(const String& filename);
+
         std::chrono::microseconds getFrameCallbackMaxPollTime() const;
         void setFrameCallbackMaxPollTime(std::chrono::microseconds pollTime);
 
+        // 0 records and renders scenes sequentially on renderer thread
+        UInt32 getParallelCommandRecordingThreadCount() const;
+        void setParallelCommandRecordingThreadCount(UInt32 threadCount);
+
     private:
         String m_waylandSocketEmbedded;
         String m_waylandSocketEmbeddedGroupName;
@@ -45,7 +52,9 @@ namespace ramses_internal
         String m_waylandDisplayForSystemCompositorController;
         Bool m_systemCompositorEnabled = false;
         String m_kpiFilename;
+        String m_sceneFlushRecordingFilename;
         std::chrono::microseconds m_frameCallbackMaxPollTime{10000u};
+        UInt32 m_parallelCommandRecordingThreadCount = 0u;
     };
 }
 
@@ -31,6 +31,9 @@ namespace ramses_internal
     class RendererResourceManager : public IRendererResourceManager
     {
     public:
+        // arrived prefetched resources not used by any scene yet are evicted oldest first above this size
+        static const UInt64 DefaultPrefetchedClientResourcesSizeLimit = 32u * 1024u * 1024u;
+
         RendererResourceManager(
             IResourceProvider& resourceProvider,
             IResourceUploader& uploader,
@@ -40,7 +43,9 @@ namespace ramses_internal
             Bool keepEffects,
             const FrameTimer& frameTimer,
             RendererStatistics& stats,
-            UInt64 clientResourceCacheSize = 0u);
+            UInt64 clientResourceCacheSize = 0u,
+            Bool computeVertexArrayBounds = false,
+            UInt64 prefetchedClientResourcesSizeLimit = DefaultPrefetchedClientResourcesSizeLimit);
         virtual ~RendererResourceManager();
 
         // Client resources
@@ -52,10 +57,16 @@ namespace ramses_internal
         virtual void                 processArrivedClientResources(IRendererResourceCache* cache) override;
         virtual Bool                 hasClientResourcesToBeUploaded() const override;
         virtual void                 uploadAndUnloadPendingClientResources() override;
+        virtual void                 collectScenesUsingUpdatedClientResources(HashSet<SceneId>& scenesOut) override;
+        virtual void                 setClientResourceUploadPriorityScenes(const SceneIdVector& sceneIds) override;
+        virtual void                 prefetchClientResources(SceneId sceneId, const ResourceContentHashVector& resources) override;
+        virtual void                 releasePrefetchedClientResources(SceneId sceneId) override;
+        virtual void                 decompressPrefetchedClientResources() override;
 
         virtual DeviceResourceHandle getClientResourceDeviceHandle(const ResourceContentHash& hash) const override;
         virtual EResourceStatus      getClientResourceStatus(const ResourceContentHash& hash) const override;
         virtual EResourceType        getClientResourceType(const ResourceContentHash& hash) const override;
+        virtual Bool                 getClientResourceVertexBounds(const ResourceContentHash& hash, Vector3& minOut, Vector3& maxOut) const override;
 
         // Scene resources
         virtual DeviceResourceHandle getRenderTargetDeviceHandle(RenderTargetHandle, SceneId sceneId) const override;
@@ -75,6 +86,10 @@ namespace ramses_internal
         virtual void                 unloadTextureSampler(TextureSamplerHandle handle, SceneId sceneId) override;
         virtual DeviceResourceHandle getTextureSamplerDeviceHandle(TextureSamplerHandle textureBufferHandle, SceneId sceneId) const override;
 
+        virtual void                 uploadVertexArray(DataInstanceHandle geometryInstance, const VertexArrayInfo& vertexArrayInfo, SceneId sceneId) override;
+        virtual void                 unloadVertexArray(DataInstanceHandle geometryInstance, DeviceResourceHandle shader, SceneId sceneId) override;
+        virtual DeviceResourceHandle getVertexArrayDeviceHandle(DataInstanceHandle geometryInstance, DeviceResourceHandle shader, SceneId sceneId) const override;
+
         virtual void                 uploadStreamTexture(StreamTextureHandle handle, StreamTextureSourceId source, SceneId sceneId) override;
         virtual void                 unloadStreamTexture(StreamTextureHandle handle, SceneId sceneId) override;
 
@@ -105,6 +120,17 @@ namespace ramses_internal
         typedef HashMap<SceneId, ResourceContentHashVector> ResourcesPerSceneMap;
         typedef HashMap<SceneId, RendererSceneResourceRegistry> SceneResourceRegistryMap;
 
+        struct PrefetchedClientResource
+        {
+            SceneId sceneId;
+            // stays empty until prefetched resource arrives
+            ManagedResource resource;
+        };
+        typedef HashMap<ResourceContentHash, PrefetchedClientResource> PrefetchedClientResourceMap;
+
+        void removePrefetchedClientResource(const ResourceContentHash& hash);
+        void evictPrefetchedClientResourcesAboveSizeLimit();
+
         void groupResourcesBySceneId(const ResourceContentHashVector& resources, ResourcesPerSceneMap& resourcesPerScene) const;
         void requestResourcesFromProvider(const ResourceContentHashVector& resources);
         RendererSceneResourceRegistry& getSceneResourceRegistry(SceneId sceneId);
@@ -128,9 +154,16 @@ namespace ramses_internal
         OffscreenBufferMap             m_offscreenBuffers;
         RendererClientResourceRegistry m_clientResourceRegistry;
         SceneResourceRegistryMap       m_sceneResourceRegistryMap;
+        PrefetchedClientResourceMap    m_prefetchedClientResources;
         ClientResourceUploadingManager m_resourceUploadingManager;
         RendererStatistics&            m_stats;
 
+        // prefetched resources which arrived and are not used by any scene yet, in order of arrival
+        ResourceContentHashVector      m_arrivedPrefetchedClientResources;
+        UInt64                         m_arrivedPrefetchedClientResourcesSize = 0u;
+        const UInt64                   m_prefetchedClientResourcesSizeLimit;
+        const FrameTimer&              m_frameTimer;
+
         const UInt64 m_numberOfFramesToRerequestResource = 60u;
         UInt64 m_frameCounter = 0u;
         UInt64 m_numberOfArrivedResourcesInWrongStatus = 0u;
@@ -14,11 +14,16 @@
 #include "SceneAPI/SceneTypes.h"
 #include "SceneAPI/TextureEnums.h"
 #include "Collections/HashMap.h"
+#include "Collections/Pair.h"
 
 namespace ramses_internal
 {
     enum class EDataBufferType : UInt8;
 
+    // vertex array is built for a geometry data instance together with the shader it is rendered with
+    using VertexArrayKey = Pair<DataInstanceHandle, DeviceResourceHandle>;
+    using VertexArrayKeyVector = Vector<VertexArrayKey>;
+
     enum ESceneResourceType
     {
         ESceneResourceType_RenderBuffer_WriteOnly = 0,
@@ -72,6 +77,11 @@ namespace ramses_internal
         DeviceResourceHandle            getTextureSamplerDeviceHandle(TextureSamplerHandle handle) const;
         void                            getAllTextureSamplers        (TextureSamplerHandleVector& textureSamplers) const;
 
+        void                            addVertexArray               (DataInstanceHandle geometryInstance, DeviceResourceHandle shader, DeviceResourceHandle deviceHandle);
+        void                            removeVertexArray            (DataInstanceHandle geometryInstance, DeviceResourceHandle shader);
+        DeviceResourceHandle            getVertexArrayDeviceHandle   (DataInstanceHandle geometryInstance, DeviceResourceHandle shader) const;
+        void                            getAllVertexArrays           (VertexArrayKeyVector& vertexArrays) const;
+
         UInt32                          getSceneResourceMemoryUsage(ESceneResourceType resourceType) const;
 
     private:
@@ -97,6 +107,11 @@ namespace ramses_internal
             DeviceResourceHandle deviceHandle;
         };
 
+        struct VertexArrayEntry
+        {
+            DeviceResourceHandle deviceHandle;
+        };
+
         struct RenderBufferEntry
         {
             DeviceResourceHandle deviceHandle;
@@ -124,6 +139,7 @@ namespace ramses_internal
         using DataBufferMap          = HashMap<DataBufferHandle,     DataBufferEntry>;
         using TextureBufferMap       = HashMap<TextureBufferHandle,  TextureBufferEntry>;
         using TextureSamplerMap      = HashMap<TextureSamplerHandle, TextureSamplerEntry>;
+        using VertexArrayMap         = HashMap<VertexArrayKey,       VertexArrayEntry>;
 
         RenderBufferMap        m_renderBuffers;
         RenderTargetMap        m_renderTargets;
@@ -132,6 +148,7 @@ namespace ramses_internal
         DataBufferMap          m_dataBuffers;
         TextureBufferMap       m_textureBuffers;
         TextureSamplerMap      m_textureSamplers;
+        VertexArrayMap         m_vertexArrays;
     };
 }
 
@@ -14,6 +14,7 @@
 #include "SceneAPI/DataSlot.h"
 #include "Collections/HashMap.h"
 #include "Animation/AnimationSystemFactory.h"
+#include "AnimationAPI/IAnimationSystemActivityListener.h"
 #include "RendererLib/EResourceStatus.h"
 #include "RendererLib/StagingInfo.h"
 #include "RendererLib/OffscreenBufferLinks.h"
@@ -39,7 +40,7 @@ namespace ramses_internal
     class TransformationLinkManager;
     class TextureLinkManager;
 
-    class RendererSceneUpdater
+    class RendererSceneUpdater : public IAnimationSystemActivityListener
     {
         friend class RendererLogger;
         //TODO (Violin) remove this after KPI Monitor is reworked
@@ -78,6 +79,11 @@ namespace ramses_internal
 
         void setLimitFlushesForceApply(UInt limitForPendingFlushesForceApply);
         void setLimitFlushesForceUnsubscribe(UInt limitForPendingFlushesForceUnsubscribe);
+
+        // IAnimationSystemActivityListener
+        virtual void onAnimationSystemActivated(IAnimationSystem& animationSystem) override;
+        virtual void onAnimationSystemDeactivated(IAnimationSystem& animationSystem) override;
+
     private:
         void destroyScene(SceneId sceneID);
         void unloadSceneResourcesAndUnrefSceneResources(SceneId sceneId);
@@ -96,13 +102,15 @@ namespace ramses_internal
         void consolidatePendingSceneActions();
         void consolidatePendingSceneActions(SceneId sceneID, SceneActionCollection& actionsForScene);
         void consolidateResourceChanges(PendingFlush& flushInfo, const PendingFlushes& pendingFlushes, const SceneResourceChanges& resourceChanges, ResourceContentHashVector& newlyNeededClientResources) const;
+        void prefetchClientResources(SceneId sceneId, const ResourceContentHashVector& resources);
         void requestAndUploadAndUnloadResources(DisplayHandle& activeDisplay);
         void updateEmbeddedCompositingResources(DisplayHandle& activeDisplay);
         void tryToApplyPendingFlushes();
         void processStagedResourceChangesFromAppliedFlushes(DisplayHandle& activeDisplay);
         void updateSceneStreamTexturesDirtiness();
-        void updateScenesResourceCache();
+        void updateScenesResourceCache(DisplayHandle& activeDisplay);
         void updateScenesRealTimeAnimationSystems();
+        void registerActivatedAnimationSystems(SceneId sceneId);
         void updateScenesTransformationCache();
         void updateScenesDataLinks();
         void updateScenesStates();
@@ -124,6 +132,12 @@ namespace ramses_internal
         IRendererResourceCache*                           m_rendererResourceCache;
 
         AnimationSystemFactory                            m_animationSystemFactory;
+        // only real time animation systems with active or pending animations need to be updated every frame
+        std::unordered_map<IAnimationSystem*, SceneId>    m_activeRealTimeAnimationSystems;
+        // animation systems get activated by scene actions, they are assigned to the scene once its actions are applied
+        Vector<IAnimationSystem*>                         m_activatedAnimationSystems;
+        // extracted from RendererSceneUpdater::updateScenesRealTimeAnimationSystems to avoid per frame allocation
+        Vector<std::pair<IAnimationSystem*, SceneId>>     m_animationSystemsToUpdate;
 
         HashMap<DisplayHandle, IRendererResourceManager*> m_displayResourceManagers;
 
@@ -144,6 +158,8 @@ namespace ramses_internal
         HashSet<SceneId> m_modifiedScenesToRerender;
         //used as caches for algorithms that mark scenes as modified
         Vector<SceneId> m_offscreeenBufferModifiedScenesVisitingCache;
+        // extracted from RendererSceneUpdater::requestAndUploadAndUnloadResources to avoid per frame allocation
+        SceneIdVector m_scenesMappingAndUploadingCache;
         OffscreenBufferLinkVector m_offscreenBufferConsumerSceneLinksCache;
 
         UInt m_maximumPendingFlushes = 60u;
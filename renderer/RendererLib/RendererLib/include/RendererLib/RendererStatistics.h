@@ -10,6 +10,7 @@
 #define RAMSES_RENDERERSTATISTICS_H
 
 #include "SceneAPI/SceneId.h"
+#include "SceneAPI/Handles.h"
 #include "RendererAPI/Types.h"
 #include "Utils/StatisticCollection.h"
 #include "PlatformAbstraction/PlatformTime.h"
@@ -25,7 +26,10 @@ namespace ramses_internal
         Float  getFps() const;
         UInt32 getDrawCallsPerFrame() const;
 
+        void sceneMapRequested(SceneId sceneId);
         void sceneRendered(SceneId sceneId);
+        void renderPassBatched(SceneId sceneId, RenderPassHandle pass, UInt numRenderables, UInt numDrawCalls);
+        void uniformsSkipped(SceneId sceneId, UInt numSkippedUniforms);
         void trackArrivedFlush(SceneId sceneId, UInt numSceneActions, UInt numAddedClientResources, UInt numRemovedClientResources, UInt numSceneResourceActions);
         void flushApplied(SceneId sceneId);
         void flushBlocked(SceneId sceneId);
@@ -34,11 +38,16 @@ namespace ramses_internal
         void offscreenBufferSwapped(DisplayHandle displayHandle, DeviceResourceHandle offscreenBuffer, bool isInterruptible);
         void offscreenBufferInterrupted(DisplayHandle displayHandle, DeviceResourceHandle offscreenBuffer);
         void framebufferSwapped(DisplayHandle display);
+        void framebufferRedrawn(DisplayHandle display, UInt numPixelsRedrawn, UInt numPixelsTotal);
 
         void clientResourceUploaded(UInt byteSize);
+        void clientResourcePrefetched(SceneId sceneId, UInt byteSize);
+        void prefetchedClientResourceUsed(SceneId sceneId);
         void sceneResourceUploaded(SceneId sceneId, UInt byteSize);
         void streamTextureUpdated(StreamTextureSourceId sourceId, UInt numUpdates);
         void shaderCompiled();
+        void vertexArrayCacheHit(UInt numHits);
+        void vertexArrayInvalidated();
 
         void untrackScene(SceneId sceneId);
         void untrackOffscreenBuffer(DisplayHandle displayHandle, DeviceResourceHandle offscreenBuffer);
@@ -59,6 +68,8 @@ namespace ramses_internal
         UInt m_clientResourcesUploaded = 0u;
         UInt m_clientResourcesBytesUploaded = 0u;
         UInt m_shadersCompiled = 0u;
+        UInt m_vertexArrayCacheHits = 0u;
+        UInt m_vertexArraysInvalidated = 0u;
 
         struct SceneStatistics
         {
@@ -83,7 +94,23 @@ namespace ramses_internal
             UInt sceneResourcesUploaded = 0u;
             UInt sceneResourcesBytesUploaded = 0u;
 
+            UInt clientResourcesPrefetched = 0u;
+            UInt clientResourcesBytesPrefetched = 0u;
+            UInt prefetchedClientResourcesUsed = 0u;
+
             UInt numRendered = 0u;
+            UInt numUniformsSkipped = 0u;
+
+            // time to first frame is measured from map request until scene is rendered for first time
+            UInt64 mapRequestTime = 0u;
+            Int64 timeToFirstFrame = -1;
+
+            struct RenderPassBatchingStatistics
+            {
+                UInt numRenderables = 0u;
+                UInt numDrawCalls = 0u;
+            };
+            std::map<RenderPassHandle, RenderPassBatchingStatistics> renderPassBatchingStatistics;
         };
 
         struct OffscreenBufferStatistics
@@ -96,6 +123,8 @@ namespace ramses_internal
         struct DisplayStatistics
         {
             UInt numFrameBufferSwapped = 0;
+            UInt numFrameBufferPixelsRedrawn = 0u;
+            UInt numFrameBufferPixelsTotal = 0u;
             std::map<DeviceResourceHandle, OffscreenBufferStatistics> offscreenBufferStatistics;
         };
 
@@ -15,7 +15,9 @@
 namespace ramses_internal
 {
     class IResourceDeviceHandleAccessor;
+    class IRendererResourceManager;
     class IEmbeddedCompositingManager;
+    class RendererStatistics;
 
     typedef Vector<DeviceHandleVector> DeviceHandleCache;
 
@@ -56,11 +58,18 @@ namespace ramses_internal
         const DeviceHandleVector&           getCachedHandlesForTextureSamplers() const;
         const DeviceHandleVector&           getCachedHandlesForRenderTargets() const;
         const DeviceHandleVector&           getCachedHandlesForBlitPassRenderTargets() const;
+        // invalid if there is no vertex array yet for the renderable's geometry and shader
+        DeviceResourceHandle                getRenderableVertexArrayDeviceHandle(RenderableHandle renderable) const;
+        // attribute input of effect receiving world matrices of instances, invalid if geometry does not have it
+        DataFieldHandle                     getInstanceWorldMatrixAttributeField(DataInstanceHandle geometryInstance) const;
 
         void updateRenderableResources(const IResourceDeviceHandleAccessor& resourceAccessor, const IEmbeddedCompositingManager& embeddedCompositingManager);
         void updateRenderablesResourcesDirtiness();
         void setRenderableResourcesDirtyByTextureSampler(TextureSamplerHandle textureSamplerHandle) const;
         void setRenderableResourcesDirtyByStreamTexture(StreamTextureHandle streamTextureHandle) const;
+        // vertex arrays have to be updated after renderable resources, dirty vertex arrays might need device access
+        Bool hasDirtyVertexArrays() const;
+        void updateVertexArrays(IRendererResourceManager& resourceManager, RendererStatistics& statistics);
 
     protected:
         Bool resolveTextureSamplerResourceDeviceHandle(const IResourceDeviceHandleAccessor& resourceAccessor, TextureSamplerHandle sampler, DeviceResourceHandle& deviceHandleInOut);
@@ -82,6 +91,11 @@ namespace ramses_internal
         Bool checkAndUpdateGeometryResources(const IResourceDeviceHandleAccessor& resourceAccessor, RenderableHandle renderable);
         void checkAndUpdateRenderTargetResources(const IResourceDeviceHandleAccessor& resourceAccessor);
         void checkAndUpdateBlitPassResources(const IResourceDeviceHandleAccessor& resourceAccessor);
+        void setVertexArrayDirty(DataInstanceHandle geometryInstance);
+        Bool usesVertexArray(RenderableHandle renderable) const;
+        Bool vertexArrayNeedsUpdate(RenderableHandle renderable) const;
+        DeviceResourceHandle findVertexArray(DataInstanceHandle geometryInstance, DeviceResourceHandle shader) const;
+        void uploadVertexArray(IRendererResourceManager& resourceManager, DataInstanceHandle geometryInstance, DeviceResourceHandle shader);
 
         Bool updateTextureSamplerResource(const IResourceDeviceHandleAccessor& resourceAccessor, const IEmbeddedCompositingManager& embeddedCompositingManager, TextureSamplerHandle sampler);
         Bool updateTextureSamplerResourceAsRenderBuffer(const IResourceDeviceHandleAccessor& resourceAccessor, const RenderBufferHandle bufferHandle, DeviceResourceHandle& deviceHandleOut);
@@ -94,6 +108,22 @@ namespace ramses_internal
         DeviceHandleVector         m_renderTargetCache;
         DeviceHandleVector         m_blitPassCache;
 
+        // vertex arrays per geometry data instance, one for each shader of renderables using the geometry,
+        // dirty geometry has all its vertex arrays unloaded and recreated on next update
+        struct VertexArrayCacheEntry
+        {
+            DeviceResourceHandle shader;
+            DeviceResourceHandle deviceHandle;
+        };
+        struct GeometryVertexArrays
+        {
+            Vector<VertexArrayCacheEntry> vertexArrays;
+            Bool                          dirty = true;
+        };
+        Vector<GeometryVertexArrays>  m_vertexArrayCache;
+        Vector<DataFieldHandle>       m_instanceWorldMatrixAttributeFields;
+        mutable Bool                  m_vertexArraysDirty;
+
         mutable Bool       m_renderableResourcesDirtinessNeedsUpdate;
         mutable BoolVector m_renderableResourcesDirty;
         mutable BoolVector m_dataInstancesDirty;
@@ -28,8 +28,13 @@ namespace ramses_internal
         virtual DeviceResourceHandle uploadResource(IRenderBackend& renderBackend, ManagedResource resourceObject) override;
         virtual void                 unloadResource(IRenderBackend& renderBackend, EResourceType type, ResourceContentHash hash, DeviceResourceHandle handle) override;
 
+        virtual DeviceResourceHandle allocateTexture(IRenderBackend& renderBackend, const TextureResource& texture) override;
+        virtual void                 uploadTextureMipLevel(IRenderBackend& renderBackend, DeviceResourceHandle textureHandle, const TextureResource& texture, UInt32 mipLevel) override;
+
     private:
         DeviceResourceHandle uploadTexture(IDevice& device, const TextureResource& texture);
+        static DeviceResourceHandle AllocateTexture(IDevice& device, const TextureResource& texture, UInt32 numMipLevelsToAllocate);
+        static void UploadTextureMipLevel(IDevice& device, DeviceResourceHandle textureHandle, const TextureResource& texture, UInt32 mipLevel);
         DeviceResourceHandle queryBinaryShaderCacheAndUploadEffect(IRenderBackend& renderBackend, const EffectResource& effect, ResourceContentHash hash);
 
         static UInt32 EstimateGPUAllocatedSizeOfTexture(const TextureResource& texture, UInt32 numMipLevelsToAllocate);
@@ -36,6 +36,9 @@ namespace ramses_internal
         Bool                       hasLinkedProvider(SceneId consumerSceneId, DataSlotHandle consumerSlotHandle) const;
         void                       getLinkedProviders(SceneId consumerSceneId, SceneLinkVector& links) const;
         const SceneLink&           getLinkedProvider(SceneId consumerSceneId, DataSlotHandle consumerSlotHandle) const;
+        // visits links of consumer without collecting them into vector, used for per frame link resolving
+        template <typename VISITOR>
+        void                       visitLinkedProviders(SceneId consumerSceneId, VISITOR visitor) const;
 
         Bool                       hasLinkedConsumers(SceneId providerSceneId, DataSlotHandle providerSlotHandle) const;
         void                       getLinkedConsumers(SceneId providerSceneId, SceneLinkVector& links) const;
@@ -46,6 +49,18 @@ namespace ramses_internal
         // in case of larger amount of links, storing of links in hashmaps in both directions might be better
         SceneLinkVector m_links;
     };
+
+    template <typename VISITOR>
+    void SceneLinks::visitLinkedProviders(SceneId consumerSceneId, VISITOR visitor) const
+    {
+        for(const auto& link : m_links)
+        {
+            if (link.consumerSceneId == consumerSceneId)
+            {
+                visitor(link);
+            }
+        }
+    }
 }
 
 #endif
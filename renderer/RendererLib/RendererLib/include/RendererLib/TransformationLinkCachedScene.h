@@ -29,6 +29,8 @@ namespace ramses_internal
         virtual void                    releaseDataSlot(DataSlotHandle handle) override;
         Matrix44f updateMatrixCacheWithLinks(ETransformationMatrixType matrixType, NodeHandle node) const;
         void      propagateDirtyToConsumers(NodeHandle node) const;
+        // if true, updating matrix cache also updates matrix caches of provider scenes
+        Bool      consumesLinkedTransformations() const;
 
     private:
         void getMatrixForNode(ETransformationMatrixType matrixType, NodeHandle node, Matrix44f& chainMatrix) const;
@@ -14,8 +14,11 @@
 #include "RendererAPI/IRenderBackend.h"
 #include "RendererAPI/IEmbeddedCompositingManager.h"
 #include "RendererAPI/IDevice.h"
+#include "Resource/ArrayResource.h"
+#include "Resource/TextureResource.h"
 #include "Utils/LogMacros.h"
 #include "PlatformAbstraction/PlatformTime.h"
+#include <algorithm>
 
 namespace ramses_internal
 {
@@ -26,11 +29,13 @@ namespace ramses_internal
         Bool keepEffects,
         const FrameTimer& frameTimer,
         RendererStatistics& stats,
-        UInt64 clientResourceCacheSize)
+        UInt64 clientResourceCacheSize,
+        Bool computeVertexArrayBounds)
         : m_clientResources(resources)
         , m_uploader(uploader)
         , m_renderBackend(renderBackend)
         , m_keepEffects(keepEffects)
+        , m_computeVertexArrayBounds(computeVertexArrayBounds)
         , m_frameTimer(frameTimer)
         , m_clientResourceCacheSize(clientResourceCacheSize)
         , m_stats(stats)
@@ -55,7 +60,7 @@ namespace ramses_internal
 
     Bool ClientResourceUploadingManager::hasAnythingToUpload() const
     {
-        return !m_clientResources.getAllProvidedResources().empty();
+        return !m_clientResources.getAllProvidedResources().empty() || !m_progressiveTextureUploads.empty();
     }
 
     void ClientResourceUploadingManager::uploadAndUnloadPendingResources()
@@ -70,6 +75,21 @@ namespace ramses_internal
 
         unloadClientResources(resourcesToUnload);
         uploadClientResources(resourcesToUpload);
+        continueProgressiveTextureUploads();
+    }
+
+    void ClientResourceUploadingManager::setPriorityScenes(const SceneIdVector& sceneIds)
+    {
+        m_priorityScenes = sceneIds;
+    }
+
+    void ClientResourceUploadingManager::collectScenesUsingUpdatedResources(HashSet<SceneId>& scenesOut)
+    {
+        for (const auto sceneId : m_scenesUsingUpdatedResources)
+        {
+            scenesOut.put(sceneId);
+        }
+        m_scenesUsingUpdatedResources.clear();
     }
 
     void ClientResourceUploadingManager::unloadClientResources(const ResourceContentHashVector& resourcesToUnload)
@@ -109,13 +129,18 @@ namespace ramses_internal
         assert(pResource->isDeCompressedAvailable());
 
         const UInt32 resourceSize = pResource->getDecompressedDataSize();
-        const DeviceResourceHandle deviceHandle = m_uploader.uploadResource(m_renderBackend, rd.resource);
+        const Bool isTexture = (rd.type == EResourceType_Texture2D || rd.type == EResourceType_Texture3D || rd.type == EResourceType_TextureCube);
+        const TextureResource* texture = isTexture ? pResource->convertTo<TextureResource>() : nullptr;
+        const Bool uploadProgressively = isTexture && !texture->getGenerateMipChainFlag() && texture->getMipDataSizes().size() > 1u && resourceSize > LargeResourceByteSizeThreshold;
+        const DeviceResourceHandle deviceHandle = uploadProgressively ? uploadTextureProgressively(rd, *texture) : m_uploader.uploadResource(m_renderBackend, rd.resource);
         m_clientResources.setResourceData(rd.hash, ManagedResource(), deviceHandle, pResource->getTypeID());
         if (deviceHandle.isValid())
         {
             m_clientResourceSizes.put(rd.hash, resourceSize);
             m_clientResourceTotalUploadedSize += resourceSize;
             m_clientResources.setResourceStatus(rd.hash, EResourceStatus_Uploaded);
+            if (m_computeVertexArrayBounds && rd.type == EResourceType_VertexArray)
+                storeVertexArrayBounds(rd.hash, *pResource);
         }
         else
         {
@@ -124,6 +149,65 @@ namespace ramses_internal
         }
     }
 
+    DeviceResourceHandle ClientResourceUploadingManager::uploadTextureProgressively(const ResourceDescriptor& rd, const TextureResource& texture)
+    {
+        const DeviceResourceHandle deviceHandle = m_uploader.allocateTexture(m_renderBackend, texture);
+        if (!deviceHandle.isValid())
+        {
+            return deviceHandle;
+        }
+
+        // upload smallest levels right away as long as they fit into size of a large resource, always at least the smallest one,
+        // so that texture can be sampled in this frame already
+        const auto& mipDataSizes = texture.getMipDataSizes();
+        UInt32 mipLevel = static_cast<UInt32>(mipDataSizes.size());
+        UInt32 uploadedSize = 0u;
+        do
+        {
+            --mipLevel;
+            m_uploader.uploadTextureMipLevel(m_renderBackend, deviceHandle, texture, mipLevel);
+            uploadedSize += mipDataSizes[mipLevel];
+        } while (mipLevel > 0u && uploadedSize + mipDataSizes[mipLevel - 1u] <= LargeResourceByteSizeThreshold);
+
+        if (mipLevel > 0u)
+        {
+            m_progressiveTextureUploads.push_back({ rd.hash, rd.resource, deviceHandle, mipLevel - 1u });
+        }
+
+        return deviceHandle;
+    }
+
+    void ClientResourceUploadingManager::continueProgressiveTextureUploads()
+    {
+        // larger levels are uploaded in order of textures being uploaded first, one level at a time followed by time budget check,
+        // so that at least one level is uploaded every frame
+        while (!m_progressiveTextureUploads.empty())
+        {
+            ProgressiveTextureUpload& pendingUpload = m_progressiveTextureUploads.front();
+            const TextureResource* texture = pendingUpload.resource.getResourceObject()->convertTo<TextureResource>();
+            m_uploader.uploadTextureMipLevel(m_renderBackend, pendingUpload.deviceHandle, *texture, pendingUpload.nextMipLevel);
+            for (const auto sceneId : m_clientResources.getResourceDescriptor(pendingUpload.hash).sceneUsage)
+            {
+                m_scenesUsingUpdatedResources.put(sceneId);
+            }
+
+            if (pendingUpload.nextMipLevel == 0u)
+            {
+                m_progressiveTextureUploads.erase(m_progressiveTextureUploads.begin());
+            }
+            else
+            {
+                --pendingUpload.nextMipLevel;
+            }
+
+            if (m_frameTimer.isTimeBudgetExceededForSection(EFrameTimerSectionBudget::ClientResourcesUpload))
+            {
+                LOG_INFO(CONTEXT_RENDERER, "ClientResourceUploadingManager::continueProgressiveTextureUploads: Interrupt: Exceeded time for client resource upload");
+                break;
+            }
+        }
+    }
+
     void ClientResourceUploadingManager::unloadClientResource(const ResourceDescriptor& rd)
     {
         assert(rd.sceneUsage.empty());
@@ -138,6 +222,13 @@ namespace ramses_internal
         assert(m_clientResourceTotalUploadedSize >= resSizeIt->value);
         m_clientResourceTotalUploadedSize -= resSizeIt->value;
         m_clientResourceSizes.remove(resSizeIt);
+        m_vertexArrayBounds.remove(rd.hash);
+        const auto pendingUploadIt = std::find_if(m_progressiveTextureUploads.begin(), m_progressiveTextureUploads.end(),
+            [&rd](const ProgressiveTextureUpload& pendingUpload) { return pendingUpload.hash == rd.hash; });
+        if (pendingUploadIt != m_progressiveTextureUploads.end())
+        {
+            m_progressiveTextureUploads.erase(pendingUploadIt);
+        }
 
         LOG_TRACE(CONTEXT_RENDERER, "ResourceUploadingManager::unloadResource Removing resource descriptor for resource #" << rd.hash);
         m_clientResources.unregisterResource(rd.hash);
@@ -177,8 +268,18 @@ namespace ramses_internal
     {
         assert(resourcesToUpload.empty());
 
+        struct UploadPriority
+        {
+            Bool usedByPriorityScene;
+            ResourceCacheFlag cacheFlag;
+            UInt32 size;
+            ResourceContentHash hash;
+        };
+        Vector<UploadPriority> uploadPriorities;
+
         totalSize = 0u;
         const ResourceContentHashVector& providedResources = m_clientResources.getAllProvidedResources();
+        uploadPriorities.reserve(providedResources.size());
         for(const auto& resource : providedResources)
         {
             const ResourceDescriptor& rd = m_clientResources.getResourceDescriptor(resource);
@@ -186,9 +287,28 @@ namespace ramses_internal
             assert(rd.resource.getResourceObject() != NULL);
             const IResource* resourceObj = rd.resource.getResourceObject();
             resourceObj->decompress();
-            totalSize += resourceObj->getDecompressedDataSize();
+            const UInt32 resourceSize = resourceObj->getDecompressedDataSize();
+            totalSize += resourceSize;
 
-            resourcesToUpload.push_back(resource);
+            const Bool usedByPriorityScene = std::any_of(rd.sceneUsage.cbegin(), rd.sceneUsage.cend(),
+                [this](SceneId sceneId) { return m_priorityScenes.contains(sceneId); });
+            uploadPriorities.push_back({ usedByPriorityScene, resourceObj->getCacheFlag(), resourceSize, resource });
+        }
+
+        // stable sort keeps order in which resources were provided for resources of same priority
+        std::stable_sort(uploadPriorities.begin(), uploadPriorities.end(), [](const UploadPriority& a, const UploadPriority& b)
+        {
+            if (a.usedByPriorityScene != b.usedByPriorityScene)
+                return a.usedByPriorityScene;
+            if (a.cacheFlag != b.cacheFlag)
+                return a.cacheFlag.getValue() < b.cacheFlag.getValue();
+            return a.size < b.size;
+        });
+
+        resourcesToUpload.reserve(uploadPriorities.size());
+        for (const auto& uploadPriority : uploadPriorities)
+        {
+            resourcesToUpload.push_back(uploadPriority.hash);
         }
     }
 
@@ -218,4 +338,60 @@ namespace ramses_internal
             return sizeToUpload + m_clientResourceTotalUploadedSize - m_clientResourceCacheSize;
         }
     }
+
+    Bool ClientResourceUploadingManager::getVertexArrayBounds(const ResourceContentHash& hash, Vector3& minOut, Vector3& maxOut) const
+    {
+        const VertexArrayBounds* bounds = m_vertexArrayBounds.get(hash);
+        if (bounds == nullptr)
+            return false;
+
+        minOut = bounds->min;
+        maxOut = bounds->max;
+        return true;
+    }
+
+    void ClientResourceUploadingManager::storeVertexArrayBounds(const ResourceContentHash& hash, const IResource& resource)
+    {
+        const ArrayResource* vertexArray = resource.convertTo<ArrayResource>();
+        UInt32 numComponents = 0u;
+        switch (vertexArray->getElementType())
+        {
+        case EDataType_Vector2F:
+            numComponents = 2u;
+            break;
+        case EDataType_Vector3F:
+            numComponents = 3u;
+            break;
+        case EDataType_Vector4F:
+            numComponents = 4u;
+            break;
+        default:
+            return;
+        }
+
+        const UInt32 numVertices = vertexArray->getElementCount();
+        if (numVertices == 0u)
+            return;
+
+        // 4th component is not used for bounds, 2D positions get z = 0
+        const UInt32 numBoundsComponents = std::min(numComponents, 3u);
+        const Float* vertexData = reinterpret_cast<const Float*>(vertexArray->getResourceData()->getRawData());
+        VertexArrayBounds bounds{ Vector3(0.f), Vector3(0.f) };
+        for (UInt32 c = 0u; c < numBoundsComponents; ++c)
+        {
+            bounds.min[c] = vertexData[c];
+            bounds.max[c] = vertexData[c];
+        }
+        for (UInt32 v = 1u; v < numVertices; ++v)
+        {
+            const Float* vertex = vertexData + v * numComponents;
+            for (UInt32 c = 0u; c < numBoundsComponents; ++c)
+            {
+                bounds.min[c] = std::min(bounds.min[c], vertex[c]);
+                bounds.max[c] = std::max(bounds.max[c], vertex[c]);
+            }
+        }
+
+        m_vertexArrayBounds.put(hash, bounds);
+    }
 }
@@ -12,6 +12,8 @@
 
 namespace ramses_internal
 {
+    const UInt32 DataReferenceLinkCachedScene::InvalidDataVersion;
+
     DataReferenceLinkCachedScene::DataReferenceLinkCachedScene(SceneLinksManager& sceneLinksManager, const SceneInfo& sceneInfo)
         : TransformationLinkCachedScene(sceneLinksManager, sceneInfo)
     {
@@ -26,6 +28,13 @@ namespace ramses_internal
             assert(dataSlot.attachedDataReference.isValid());
             m_fallbackValues.allocate(dataSlot.attachedDataReference);
             DataInstanceHelper::GetInstanceFieldData(*this, dataSlot.attachedDataReference, DataFieldHandle(0u), *m_fallbackValues.getMemory(dataSlot.attachedDataReference));
+            m_consumerPropagatedDataVersions.allocate(dataSlot.attachedDataReference);
+        }
+        else if (dataSlot.type == EDataSlotType_DataProvider)
+        {
+            assert(dataSlot.attachedDataReference.isValid());
+            m_providerDataVersions.allocate(dataSlot.attachedDataReference);
+            *m_providerDataVersions.getMemory(dataSlot.attachedDataReference) = InvalidDataVersion + 1u;
         }
 
         return actualHandle;
@@ -38,73 +47,78 @@ namespace ramses_internal
         if (m_fallbackValues.isAllocated(dataRef))
         {
             m_fallbackValues.release(dataRef);
+            m_consumerPropagatedDataVersions.release(dataRef);
+        }
+        if (m_providerDataVersions.isAllocated(dataRef))
+        {
+            m_providerDataVersions.release(dataRef);
         }
     }
 
     void DataReferenceLinkCachedScene::setDataFloatArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Float* data)
     {
         TransformationLinkCachedScene::setDataFloatArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        updateDataReferenceState(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataVector2fArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector2* data)
     {
         TransformationLinkCachedScene::setDataVector2fArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        updateDataReferenceState(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataVector3fArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector3* data)
     {
         TransformationLinkCachedScene::setDataVector3fArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        updateDataReferenceState(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataVector4fArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector4* data)
     {
         TransformationLinkCachedScene::setDataVector4fArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        updateDataReferenceState(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataIntegerArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Int32* data)
     {
         TransformationLinkCachedScene::setDataIntegerArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        updateDataReferenceState(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataVector2iArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector2i* data)
     {
         TransformationLinkCachedScene::setDataVector2iArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        updateDataReferenceState(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataVector3iArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector3i* data)
     {
         TransformationLinkCachedScene::setDataVector3iArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        updateDataReferenceState(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataVector4iArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Vector4i* data)
     {
         TransformationLinkCachedScene::setDataVector4iArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        updateDataReferenceState(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataMatrix22fArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Matrix22f* data)
     {
         TransformationLinkCachedScene::setDataMatrix22fArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        updateDataReferenceState(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataMatrix33fArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Matrix33f* data)
     {
         TransformationLinkCachedScene::setDataMatrix33fArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        updateDataReferenceState(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataMatrix44fArray(DataInstanceHandle containerHandle, DataFieldHandle field, UInt32 elementCount, const Matrix44f* data)
     {
         TransformationLinkCachedScene::setDataMatrix44fArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        updateDataReferenceState(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::restoreFallbackValue(DataInstanceHandle containerHandle, DataFieldHandle field)
@@ -113,7 +127,7 @@ namespace ramses_internal
         DataInstanceHelper::SetInstanceFieldData(*this, containerHandle, field, *m_fallbackValues.getMemory(containerHandle));
     }
 
-    void DataReferenceLinkCachedScene::setValueWithoutUpdatingFallbackValue(DataInstanceHandle containerHandle, DataFieldHandle field, const Variant& value)
+    void DataReferenceLinkCachedScene::setValueWithoutUpdatingFallbackValue(DataInstanceHandle containerHandle, DataFieldHandle field, const Variant& value, UInt32 providerVersion)
     {
         // store current fallback value
         // setting new value will update fallback value to the value we set
@@ -123,14 +137,34 @@ namespace ramses_internal
 
         // put fallback value back
         *m_fallbackValues.getMemory(containerHandle) = fallbackValue;
+        *m_consumerPropagatedDataVersions.getMemory(containerHandle) = providerVersion;
+    }
+
+    UInt32 DataReferenceLinkCachedScene::getProviderDataVersion(DataInstanceHandle providerDataRef) const
+    {
+        return *m_providerDataVersions.getMemory(providerDataRef);
+    }
+
+    UInt32 DataReferenceLinkCachedScene::getConsumerPropagatedDataVersion(DataInstanceHandle consumerDataRef) const
+    {
+        return *m_consumerPropagatedDataVersions.getMemory(consumerDataRef);
     }
 
     template <typename T>
-    void DataReferenceLinkCachedScene::updateFallbackValue(DataInstanceHandle containerHandle, const T* data)
+    void DataReferenceLinkCachedScene::updateDataReferenceState(DataInstanceHandle containerHandle, const T* data)
     {
         if (m_fallbackValues.isAllocated(containerHandle))
         {
             m_fallbackValues.getMemory(containerHandle)->setValue(data[0]);
+            // consumer value was overwritten, linked value has to be propagated again
+            *m_consumerPropagatedDataVersions.getMemory(containerHandle) = InvalidDataVersion;
+        }
+
+        if (m_providerDataVersions.isAllocated(containerHandle))
+        {
+            UInt32& version = *m_providerDataVersions.getMemory(containerHandle);
+            if (++version == InvalidDataVersion)
+                ++version;
         }
     }
 }
@@ -64,23 +64,33 @@ namespace ramses_internal
         return true;
     }
 
-    void DataReferenceLinkManager::resolveLinksForConsumerScene(DataReferenceLinkCachedScene& consumerScene) const
+    DataReferenceLinkManager::ResolveStatistics DataReferenceLinkManager::resolveLinksForConsumerScene(DataReferenceLinkCachedScene& consumerScene) const
     {
         const SceneId consumerSceneId = consumerScene.getSceneId();
-        SceneLinkVector links;
-        getSceneLinks().getLinkedProviders(consumerSceneId, links);
+        ResolveStatistics statistics;
 
-        for(const auto& link : links)
+        getSceneLinks().visitLinkedProviders(consumerSceneId, [&](const SceneLink& link)
         {
             assert(link.consumerSceneId == consumerSceneId);
+            ++statistics.checkedLinks;
+
             const DataInstanceHandle consumerDataRef = consumerScene.getDataSlot(link.consumerSlot).attachedDataReference;
 
-            const IScene& providerScene = m_scenes.getScene(link.providerSceneId);
+            const DataReferenceLinkCachedScene& providerScene = m_scenes.getScene(link.providerSceneId);
             const DataInstanceHandle providerDataRef = providerScene.getDataSlot(link.providerSlot).attachedDataReference;
 
+            const UInt32 providerVersion = providerScene.getProviderDataVersion(providerDataRef);
+            if (providerVersion == consumerScene.getConsumerPropagatedDataVersion(consumerDataRef))
+            {
+                return;
+            }
+
             Variant value;
             DataInstanceHelper::GetInstanceFieldData(providerScene, providerDataRef, DataFieldHandle(0u), value);
-            consumerScene.setValueWithoutUpdatingFallbackValue(consumerDataRef, DataFieldHandle(0u), value);
-        }
+            consumerScene.setValueWithoutUpdatingFallbackValue(consumerDataRef, DataFieldHandle(0u), value, providerVersion);
+            ++statistics.propagatedLinks;
+        });
+
+        return statistics;
     }
 }
@@ -0,0 +1,373 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/DirtyRegionTracker.h"
+#include "RendererLib/RendererCachedScene.h"
+#include "RendererLib/IRendererResourceManager.h"
+#include "Math3d/CameraMatrixHelper.h"
+#include "Math3d/Vector3.h"
+#include "Math3d/Vector4.h"
+#include <cmath>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        template <typename T>
+        void AppendToState(Vector<Byte>& state, const T& value)
+        {
+            const Byte* valueBytes = reinterpret_cast<const Byte*>(&value);
+            state.insert(state.end(), valueBytes, valueBytes + sizeof(T));
+        }
+
+        void AppendDataInstanceToState(Vector<Byte>& state, const IScene& scene, DataInstanceHandle dataInstance)
+        {
+            const DataLayout& layout = scene.getDataLayout(scene.getLayoutOfDataInstance(dataInstance));
+            if (layout.getFieldCount() == 0u)
+                return;
+
+            // fields of data instance are stored in one contiguous memory block starting with first field
+            const Byte* data = reinterpret_cast<const Byte*>(scene.getDataFloatArray(dataInstance, DataFieldHandle(0u)));
+            state.insert(state.end(), data, data + layout.getTotalSize());
+        }
+
+        Bool HasModelViewProjectionSemantics(const DataLayout& uniformLayout)
+        {
+            Bool hasModel = false;
+            Bool hasView = false;
+            Bool hasModelView = false;
+            Bool hasProjection = false;
+            for (const auto& field : uniformLayout.getDataFields())
+            {
+                switch (field.semantics)
+                {
+                case EFixedSemantics_ModelViewProjectionMatrix:
+                    return true;
+                case EFixedSemantics_ModelMatrix:
+                    hasModel = true;
+                    break;
+                case EFixedSemantics_ViewMatrix:
+                    hasView = true;
+                    break;
+                case EFixedSemantics_ModelViewMatrix:
+                    hasModelView = true;
+                    break;
+                case EFixedSemantics_ProjectionMatrix:
+                    hasProjection = true;
+                    break;
+                default:
+                    break;
+                }
+            }
+
+            return hasProjection && (hasModelView || (hasModel && hasView));
+        }
+    }
+
+    Quad DirtyRegionTracker::updateSceneAndGetDirtyRegion(const RendererCachedScene& scene, const IRendererResourceManager& resourceManager, const Quad& bufferRegion, const Matrix44f& rendererViewMatrix, const ProjectionParams& rendererProjectionParams)
+    {
+        ++m_updateCounter;
+        const SceneId sceneId = scene.getSceneId();
+        if (RendersIntoOffscreenTargets(scene))
+        {
+            untrackScene(sceneId);
+            return bufferRegion;
+        }
+
+        collectPassStates(scene, bufferRegion, rendererViewMatrix, rendererProjectionParams);
+
+        SceneState* sceneState = m_sceneStates.get(sceneId);
+        Bool passesChanged = (sceneState == nullptr || sceneState->size() != m_tempPassStates.size());
+        if (sceneState == nullptr)
+        {
+            m_sceneStates.put(sceneId, SceneState());
+            sceneState = m_sceneStates.get(sceneId);
+        }
+        for (UInt32 i = 0u; !passesChanged && i < m_tempPassStates.size(); ++i)
+            passesChanged = ((*sceneState)[i].state != m_tempPassStates[i]);
+
+        if (passesChanged)
+        {
+            // camera or render pass setup changed, track everything from scratch
+            sceneState->clear();
+            sceneState->resize(m_tempPassStates.size());
+        }
+
+        const RenderingPassInfoVector& passes = scene.getSortedRenderingPasses();
+        Quad dirtyRegion;
+        for (UInt32 passIdx = 0u; passIdx < passes.size(); ++passIdx)
+        {
+            PassState& passState = (*sceneState)[passIdx];
+            passState.state.swap(m_tempPassStates[passIdx]);
+
+            // a renderable which moved in front of a renderable it was behind before is treated as changed,
+            // this covers the overlapping area of any pair of renderables which swapped their order
+            UInt32 maxOrderIndex = 0u;
+            const RenderableVector& renderables = scene.getOrderedRenderablesForPass(passes[passIdx].getRenderPassHandle());
+            for (UInt32 renderableIdx = 0u; renderableIdx < renderables.size(); ++renderableIdx)
+            {
+                const RenderableHandle renderable = renderables[renderableIdx];
+                const Bool isDynamic = collectRenderableState(scene, renderable, m_tempRenderableState);
+
+                RenderableState* renderableState = passState.renderables.get(renderable);
+                if (renderableState == nullptr)
+                {
+                    const Quad screenBounds = computeScreenBounds(scene, resourceManager, renderable, m_tempPassCameras[passIdx]);
+                    passState.renderables.put(renderable, { renderableIdx, m_updateCounter, m_tempRenderableState, screenBounds });
+                    dirtyRegion = dirtyRegion.getBoundingQuad(screenBounds);
+                    continue;
+                }
+
+                const Bool orderChanged = renderableState->orderIndex < maxOrderIndex;
+                maxOrderIndex = std::max(maxOrderIndex, renderableState->orderIndex);
+                if (isDynamic || orderChanged || renderableState->state != m_tempRenderableState)
+                {
+                    const Quad screenBounds = computeScreenBounds(scene, resourceManager, renderable, m_tempPassCameras[passIdx]);
+                    dirtyRegion = dirtyRegion.getBoundingQuad(renderableState->screenBounds).getBoundingQuad(screenBounds);
+                    renderableState->state.swap(m_tempRenderableState);
+                    renderableState->screenBounds = screenBounds;
+                }
+                renderableState->orderIndex = renderableIdx;
+                renderableState->lastUpdate = m_updateCounter;
+            }
+
+            // renderables which are not rendered anymore
+            m_tempRemovedRenderables.clear();
+            for (const auto& renderableState : passState.renderables)
+            {
+                if (renderableState.value.lastUpdate != m_updateCounter)
+                {
+                    dirtyRegion = dirtyRegion.getBoundingQuad(renderableState.value.screenBounds);
+                    m_tempRemovedRenderables.push_back(renderableState.key);
+                }
+            }
+            for (const auto renderable : m_tempRemovedRenderables)
+                passState.renderables.remove(renderable);
+        }
+
+        if (passesChanged)
+            return bufferRegion;
+
+        return dirtyRegion.getIntersectingQuad(bufferRegion);
+    }
+
+    void DirtyRegionTracker::untrackScene(SceneId sceneId)
+    {
+        m_sceneStates.remove(sceneId);
+    }
+
+    Quad DirtyRegionTracker::getRegionToRedraw(const Quad& frameRegion, UInt32 bufferAge, const Quad& bufferRegion) const
+    {
+        // buffer age 0 means undefined content, age N means content is from N frames ago,
+        // so changes of the last N-1 frames and of the current frame have to be redrawn
+        if (bufferAge == 0u || bufferAge > m_frameRegionHistory.size() + 1u)
+            return bufferRegion;
+
+        Quad region = frameRegion;
+        for (UInt32 i = 0u; i + 1u < bufferAge; ++i)
+            region = region.getBoundingQuad(m_frameRegionHistory[i]);
+
+        return region.getIntersectingQuad(bufferRegion);
+    }
+
+    void DirtyRegionTracker::frameRendered(const Quad& frameRegion)
+    {
+        m_frameRegionHistory.insert(m_frameRegionHistory.begin(), frameRegion);
+        if (m_frameRegionHistory.size() > MaxBufferAge)
+            m_frameRegionHistory.pop_back();
+    }
+
+    Bool DirtyRegionTracker::RendersIntoOffscreenTargets(const RendererCachedScene& scene)
+    {
+        for (const auto& passInfo : scene.getSortedRenderingPasses())
+        {
+            if (passInfo.getType() != ERenderingPassType::RenderPass || scene.getRenderPass(passInfo.getRenderPassHandle()).renderTarget.isValid())
+                return true;
+        }
+
+        return false;
+    }
+
+    Quad DirtyRegionTracker::GetScreenBounds(const Matrix44f& modelViewProjectionMatrix, const Vector3& minPosition, const Vector3& maxPosition, const Quad& viewport)
+    {
+        Float minX = 1.f;
+        Float minY = 1.f;
+        Float maxX = -1.f;
+        Float maxY = -1.f;
+        for (UInt32 corner = 0u; corner < 8u; ++corner)
+        {
+            const Vector4 position(
+                (corner & 1u) ? maxPosition.x : minPosition.x,
+                (corner & 2u) ? maxPosition.y : minPosition.y,
+                (corner & 4u) ? maxPosition.z : minPosition.z,
+                1.f);
+            const Vector4 clipPosition = modelViewProjectionMatrix * position;
+
+            // bounds reaching behind camera cannot be projected
+            if (clipPosition.w <= std::numeric_limits<Float>::epsilon())
+                return viewport;
+
+            const Float ndcX = clipPosition.x / clipPosition.w;
+            const Float ndcY = clipPosition.y / clipPosition.w;
+            minX = std::min(minX, ndcX);
+            minY = std::min(minY, ndcY);
+            maxX = std::max(maxX, ndcX);
+            maxY = std::max(maxY, ndcY);
+        }
+
+        // clamp to viewport before conversion to integer, add one pixel border for rasterization and multisampling
+        auto toWindowX = [&viewport](Float ndc) { return viewport.x + (std::min(std::max(ndc, -1.f), 1.f) * 0.5f + 0.5f) * viewport.width; };
+        auto toWindowY = [&viewport](Float ndc) { return viewport.y + (std::min(std::max(ndc, -1.f), 1.f) * 0.5f + 0.5f) * viewport.height; };
+        const Int32 x0 = static_cast<Int32>(std::floor(toWindowX(minX))) - 1;
+        const Int32 y0 = static_cast<Int32>(std::floor(toWindowY(minY))) - 1;
+        const Int32 x1 = static_cast<Int32>(std::ceil(toWindowX(maxX))) + 1;
+        const Int32 y1 = static_cast<Int32>(std::ceil(toWindowY(maxY))) + 1;
+
+        return Quad(x0, y0, x1 - x0, y1 - y0).getIntersectingQuad(viewport);
+    }
+
+    void DirtyRegionTracker::collectPassStates(const RendererCachedScene& scene, const Quad& bufferRegion, const Matrix44f& rendererViewMatrix, const ProjectionParams& rendererProjectionParams)
+    {
+        const RenderingPassInfoVector& passes = scene.getSortedRenderingPasses();
+        m_tempPassStates.resize(passes.size());
+        m_tempPassCameras.resize(passes.size());
+
+        for (UInt32 passIdx = 0u; passIdx < passes.size(); ++passIdx)
+        {
+            const RenderPassHandle pass = passes[passIdx].getRenderPassHandle();
+            const Camera& camera = scene.getCamera(scene.getRenderPass(pass).camera);
+            const Matrix44f viewMatrix = rendererViewMatrix * scene.updateMatrixCacheWithLinks(ETransformationMatrixType_Object, camera.node);
+
+            PassCameraInfo& cameraInfo = m_tempPassCameras[passIdx];
+            if (camera.projectionType == ECameraProjectionType_Renderer)
+            {
+                cameraInfo.viewport = bufferRegion;
+                cameraInfo.viewProjectionMatrix = CameraMatrixHelper::ProjectionMatrix(rendererProjectionParams) * viewMatrix;
+            }
+            else
+            {
+                cameraInfo.viewport = Quad(camera.viewport.posX, camera.viewport.posY, camera.viewport.width, camera.viewport.height);
+                cameraInfo.viewProjectionMatrix = CameraMatrixHelper::ProjectionMatrix(ProjectionParams::Frustum(
+                    camera.projectionType,
+                    camera.frustum.leftPlane,
+                    camera.frustum.rightPlane,
+                    camera.frustum.bottomPlane,
+                    camera.frustum.topPlane,
+                    camera.frustum.nearPlane,
+                    camera.frustum.farPlane)) * viewMatrix;
+            }
+
+            Vector<Byte>& passState = m_tempPassStates[passIdx];
+            passState.clear();
+            AppendToState(passState, pass);
+            AppendToState(passState, cameraInfo.viewport);
+            AppendToState(passState, cameraInfo.viewProjectionMatrix);
+            // camera world position and other view dependent semantics
+            AppendToState(passState, viewMatrix);
+            AppendToState(passState, bufferRegion);
+        }
+    }
+
+    Bool DirtyRegionTracker::collectRenderableState(const RendererCachedScene& scene, RenderableHandle renderable, Vector<Byte>& stateOut) const
+    {
+        stateOut.clear();
+        Bool isDynamic = false;
+
+        const Renderable& renderableData = scene.getRenderable(renderable);
+        AppendToState(stateOut, renderableData.effectResource);
+        AppendToState(stateOut, renderableData.startIndex);
+        AppendToState(stateOut, renderableData.indexCount);
+        AppendToState(stateOut, renderableData.instanceCount);
+        AppendToState(stateOut, renderableData.renderState);
+        if (renderableData.renderState.isValid())
+            AppendToState(stateOut, scene.getRenderState(renderableData.renderState));
+        AppendToState(stateOut, scene.getRenderableWorldMatrix(renderable));
+
+        for (const auto dataInstance : renderableData.dataInstances)
+        {
+            AppendToState(stateOut, dataInstance);
+            if (!dataInstance.isValid())
+                continue;
+            AppendDataInstanceToState(stateOut, scene, dataInstance);
+
+            // content which is referenced from data instance and can change without changing the data instance itself
+            const DataLayout& layout = scene.getDataLayout(scene.getLayoutOfDataInstance(dataInstance));
+            for (UInt32 fieldIdx = 0u; fieldIdx < layout.getFieldCount(); ++fieldIdx)
+            {
+                const DataFieldHandle field(fieldIdx);
+                switch (layout.getField(field).dataType)
+                {
+                case EDataType_DataReference:
+                    AppendDataInstanceToState(stateOut, scene, scene.getDataReference(dataInstance, field));
+                    break;
+                case EDataType_TextureSampler:
+                {
+                    const TextureSamplerHandle samplerHandle = scene.getDataTextureSamplerHandle(dataInstance, field);
+                    const TextureSampler& sampler = scene.getTextureSampler(samplerHandle);
+                    AppendToState(stateOut, sampler.states.m_addressModeU);
+                    AppendToState(stateOut, sampler.states.m_addressModeV);
+                    AppendToState(stateOut, sampler.states.m_addressModeR);
+                    AppendToState(stateOut, sampler.states.m_samplingMode);
+                    AppendToState(stateOut, sampler.states.m_anisotropyLevel);
+                    AppendToState(stateOut, sampler.contentType);
+                    AppendToState(stateOut, sampler.textureResource);
+                    AppendToState(stateOut, sampler.contentHandle);
+                    // render buffers, stream textures, texture buffers and offscreen buffers change their content without scene change
+                    isDynamic |= (sampler.contentType != TextureSampler::ContentType::ClientTexture && sampler.contentType != TextureSampler::ContentType::None);
+                    break;
+                }
+                case EDataType_Indices:
+                case EDataType_UInt16Buffer:
+                case EDataType_FloatBuffer:
+                case EDataType_Vector2Buffer:
+                case EDataType_Vector3Buffer:
+                case EDataType_Vector4Buffer:
+                    // data buffers can be updated without scene change
+                    isDynamic |= scene.getDataResource(dataInstance, field).dataBuffer.isValid();
+                    break;
+                default:
+                    break;
+                }
+            }
+        }
+
+        return isDynamic;
+    }
+
+    Quad DirtyRegionTracker::computeScreenBounds(const RendererCachedScene& scene, const IRendererResourceManager& resourceManager, RenderableHandle renderable, const PassCameraInfo& camera) const
+    {
+        const Renderable& renderableData = scene.getRenderable(renderable);
+        const DataInstanceHandle uniforms = renderableData.dataInstances[ERenderableDataSlotType_Uniforms];
+        const DataInstanceHandle geometry = renderableData.dataInstances[ERenderableDataSlotType_Geometry];
+        if (renderableData.instanceCount != 1u || !uniforms.isValid() || !geometry.isValid())
+            return camera.viewport;
+
+        if (!HasModelViewProjectionSemantics(scene.getDataLayout(scene.getLayoutOfDataInstance(uniforms))))
+            return camera.viewport;
+
+        const DataLayout& geometryLayout = scene.getDataLayout(scene.getLayoutOfDataInstance(geometry));
+        for (UInt32 fieldIdx = 0u; fieldIdx < geometryLayout.getFieldCount(); ++fieldIdx)
+        {
+            const DataFieldHandle field(fieldIdx);
+            const EFixedSemantics semantics = geometryLayout.getField(field).semantics;
+            if (semantics != EFixedSemantics_VertexPositionAttribute && semantics != EFixedSemantics_TextPositionsAttribute)
+                continue;
+
+            const ResourceField& positions = scene.getDataResource(geometry, field);
+            Vector3 minPosition;
+            Vector3 maxPosition;
+            if (positions.dataBuffer.isValid() || !resourceManager.getClientResourceVertexBounds(positions.hash, minPosition, maxPosition))
+                return camera.viewport;
+
+            // only valid if the vertex shader does not displace vertices beyond the model-view-projection transformation
+            return GetScreenBounds(camera.viewProjectionMatrix * scene.getRenderableWorldMatrix(renderable), minPosition, maxPosition, camera.viewport);
+        }
+
+        return camera.viewport;
+    }
+}
@@ -204,6 +204,26 @@ namespace ramses_internal
         m_resizable = resizable;
     }
 
+    Bool DisplayConfig::isPartialRedrawEnabled() const
+    {
+        return m_partialRedrawEnabled;
+    }
+
+    void DisplayConfig::setPartialRedrawEnabled(Bool enabled)
+    {
+        m_partialRedrawEnabled = enabled;
+    }
+
+    Bool DisplayConfig::isInstancedDrawBatchingEnabled() const
+    {
+        return m_instancedDrawBatchingEnabled;
+    }
+
+    void DisplayConfig::setInstancedDrawBatchingEnabled(Bool enabled)
+    {
+        m_instancedDrawBatchingEnabled = enabled;
+    }
+
     UInt64 DisplayConfig::getGPUMemoryCacheSize() const
     {
         return m_gpuMemoryCacheSize;
@@ -275,6 +295,8 @@ namespace ramses_internal
             m_integrityRGLDeviceUnit     == other.m_integrityRGLDeviceUnit &&
             m_startVisibleIvi            == other.m_startVisibleIvi &&
             m_resizable                  == other.m_resizable &&
+            m_partialRedrawEnabled       == other.m_partialRedrawEnabled &&
+            m_instancedDrawBatchingEnabled == other.m_instancedDrawBatchingEnabled &&
             m_gpuMemoryCacheSize         == other.m_gpuMemoryCacheSize &&
             m_clearColor                 == other.m_clearColor &&
             m_offscreen                  == other.m_offscreen &&
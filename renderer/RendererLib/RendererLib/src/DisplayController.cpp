@@ -59,7 +59,7 @@ namespace ramses_internal
     SceneRenderExecutionIterator DisplayController::renderScene(const RendererCachedScene& scene, DeviceResourceHandle buffer, const Viewport& viewport, const SceneRenderExecutionIterator& renderFrom, const FrameTimer* frameTimer)
     {
         const FrameBufferInfo fbInfo(buffer, m_projectionParams, viewport);
-        RenderExecutor executor(m_renderBackend.getDevice(), fbInfo, renderFrom, frameTimer);
+        RenderExecutor executor(m_renderBackend.getDevice(), fbInfo, renderFrom, frameTimer, m_instancedDrawBatchingEnabled);
 
         return executor.executeScene(scene, getViewMatrix());
     }
@@ -164,6 +164,16 @@ namespace ramses_internal
         m_postProcessing->setWarpingMeshData(warpingMeshData);
     }
 
+    void DisplayController::setInstancedDrawBatchingEnabled(Bool enabled)
+    {
+        m_instancedDrawBatchingEnabled = enabled;
+    }
+
+    Bool DisplayController::isInstancedDrawBatchingEnabled() const
+    {
+        return m_instancedDrawBatchingEnabled;
+    }
+
     void DisplayController::resetView() const
     {
     }
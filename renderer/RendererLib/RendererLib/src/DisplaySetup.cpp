@@ -15,7 +15,7 @@ namespace ramses_internal
         assert(!isInterruptible || isOffscreenBuffer);
         assert(m_displayBuffers.find(displayBuffer) == m_displayBuffers.cend());
 
-        DisplayBufferInfo bufferInfo{ isOffscreenBuffer, isInterruptible, viewport, clearColor, {}, true };
+        DisplayBufferInfo bufferInfo{ isOffscreenBuffer, isInterruptible, viewport, clearColor, {}, true, Quad() };
         m_displayBuffers.emplace(displayBuffer, std::move(bufferInfo));
     }
 
@@ -34,7 +34,16 @@ namespace ramses_internal
 
     void DisplaySetup::setDisplayBufferToBeRerendered(DeviceResourceHandle displayBuffer, Bool rerender)
     {
-        getDisplayBufferInternal(displayBuffer).needsRerender = rerender;
+        auto& bufferInfo = getDisplayBufferInternal(displayBuffer);
+        bufferInfo.needsRerender = rerender;
+        if (!rerender)
+            bufferInfo.partialRerenderRegion = Quad();
+    }
+
+    void DisplaySetup::addDisplayBufferRegionToBeRerendered(DeviceResourceHandle displayBuffer, const Quad& region)
+    {
+        auto& bufferInfo = getDisplayBufferInternal(displayBuffer);
+        bufferInfo.partialRerenderRegion = bufferInfo.partialRerenderRegion.getBoundingQuad(region);
     }
 
     void DisplaySetup::mapSceneToDisplayBuffer(SceneId sceneId, DeviceResourceHandle displayBuffer, Int32 sceneOrder)
@@ -481,6 +481,7 @@ namespace ramses_internal
         const Vector4 blackColor(0.0f, 0.0f, 0.0f, 0.5f);
         const Vector4 violetColor(1.0f, 0.0f, 1.0f, 0.5f);
         const Vector4 cyanColor(0.0f, 1.0f, 1.0f, 0.5f);
+        const Vector4 yellowColor(1.0f, 1.0f, 0.0f, 0.5f);
 
         // timing graphs
         const Float VerticalTimingScale(TimingGridlinePixelDistance / (m_timingGraphHeight * 1000)); // convert into microseconds
@@ -504,6 +505,9 @@ namespace ramses_internal
         addGraphRenderableForCounter(graphLook, greenColor, counterTranslation, counterScale, FrameProfilerStatistics::ECounter::DrawCalls);
         addGraphRenderableForCounter(graphLook, blueColor, counterTranslation, counterScale, FrameProfilerStatistics::ECounter::AppliedSceneActions);
         addGraphRenderableForCounter(graphLook, violetColor, counterTranslation, counterScale, FrameProfilerStatistics::ECounter::UsedGPUMemory);
+        addGraphRenderableForCounter(graphLook, cyanColor, counterTranslation, counterScale, FrameProfilerStatistics::ECounter::ActiveAnimationSystems);
+        addGraphRenderableForCounter(graphLook, yellowColor, counterTranslation, counterScale, FrameProfilerStatistics::ECounter::CheckedDataLinks);
+        addGraphRenderableForCounter(graphLook, redColor, counterTranslation, counterScale, FrameProfilerStatistics::ECounter::PropagatedDataLinks);
         addDynamicRenderable(m_verticalLineGeometry, singleColorLook, blackColor, counterTranslation, Vector2(1.f, CounterAreaHeight));
 
         m_initialized = true;
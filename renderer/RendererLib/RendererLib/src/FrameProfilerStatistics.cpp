@@ -129,6 +129,11 @@ namespace ramses_internal
         return m_currentFrameId;
     }
 
+    const FrameProfilerStatistics::FrameTimings& FrameProfilerStatistics::getFrameTimings() const
+    {
+        return m_frameTimings;
+    }
+
     void FrameProfilerStatistics::writeLongestFrameTimingsToStream(StringOutputStream& str) const
     {
         assert(!m_frameTimings.empty());
@@ -50,12 +50,9 @@ namespace ramses_internal
                     sceneResourceUsage.getSceneResourceMemoryUsage(ESceneResourceType_StreamTexture));
             }
 
-            for (OffscreenBufferHandle i(0); i < resourceManager->m_offscreenBuffers.getTotalCount(); ++i)
+            for (const auto handle : resourceManager->m_offscreenBuffers)
             {
-                if (resourceManager->m_offscreenBuffers.isAllocated(i))
-                {
-                    increaseMemUsageForOffscreenBuffer(resourceManager->m_offscreenBuffers.getMemory(i)->m_estimatedVRAMUsage);
-                }
+                increaseMemUsageForOffscreenBuffer(resourceManager->m_offscreenBuffers.getMemory(handle)->m_estimatedVRAMUsage);
             }
         }
     }
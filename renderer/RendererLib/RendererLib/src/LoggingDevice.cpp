@@ -39,6 +39,12 @@ namespace ramses_internal
         ConstantLogger::LogValueArray(field, value, count, m_logContext);
     }
 
+    void LoggingDevice::setInstanceWorldMatrices(DataFieldHandle field, UInt32 count, const Matrix44f* matrices)
+    {
+        m_logContext << "instance world matrices [field: " << field << " count: " << count << "]" << RendererLogContext::NewLine;
+        ConstantLogger::LogValueArray(field, matrices, count, m_logContext);
+    }
+
     void LoggingDevice::setConstant(DataFieldHandle field, UInt32 count, const Vector4i* value)
     {
         ConstantLogger::LogValueArray(field, value, count, m_logContext);
@@ -231,6 +237,22 @@ namespace ramses_internal
         logResourceActivation("index buffer", handle, DataFieldHandle::Invalid());
     }
 
+    DeviceResourceHandle LoggingDevice::allocateVertexArray(const VertexArrayInfo& vertexArrayInfo)
+    {
+        m_logContext << "allocate vertex array [shader: " << vertexArrayInfo.shader << " index buffer: " << vertexArrayInfo.indexBuffer << " vertex buffers: " << vertexArrayInfo.vertexBuffers.size() << "]" << RendererLogContext::NewLine;
+        return DeviceResourceHandle::Invalid();
+    }
+
+    void LoggingDevice::activateVertexArray(DeviceResourceHandle handle)
+    {
+        logResourceActivation("vertex array", handle, DataFieldHandle::Invalid());
+    }
+
+    void LoggingDevice::deleteVertexArray(DeviceResourceHandle handle)
+    {
+        m_logContext << "delete vertex array [handle: " << handle << "]" << RendererLogContext::NewLine;
+    }
+
     DeviceResourceHandle LoggingDevice::uploadShader(const EffectResource& effect)
     {
         m_logContext << "upload shader " << effect.getName() << RendererLogContext::NewLine;
@@ -292,6 +314,11 @@ namespace ramses_internal
         m_logContext << "generate mipmaps for texture [handle:" << handle << "]" << RendererLogContext::NewLine;
     }
 
+    void LoggingDevice::setTextureBaseMipLevel(DeviceResourceHandle handle, UInt32 baseMipLevel)
+    {
+        m_logContext << "set base mip level of texture [handle:" << handle << " baseMipLevel:" << baseMipLevel << "]" << RendererLogContext::NewLine;
+    }
+
     void LoggingDevice::uploadTextureData(DeviceResourceHandle handle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 z, UInt32 width, UInt32 height, UInt32 depth, const Byte*, UInt32 dataSize)
     {
         m_logContext << "update texture data [handle:" << handle << " mipLevel:" << mipLevel << " (x,y,z):(" << x << "," << y << "," << z << ") (w,h,d):(" << width << "," << height << "," << depth << ") dataSize:" << dataSize << "]" << RendererLogContext::NewLine;
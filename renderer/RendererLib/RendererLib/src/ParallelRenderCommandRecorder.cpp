@@ -0,0 +1,135 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/ParallelRenderCommandRecorder.h"
+#include "RendererLib/RendererCachedScene.h"
+#include "PlatformAbstraction/PlatformGuard.h"
+#include "RenderExecutor.h"
+
+namespace ramses_internal
+{
+    class ParallelRenderCommandRecorder::RecordingTask : public ITask
+    {
+    public:
+        explicit RecordingTask(ParallelRenderCommandRecorder& recorder)
+            : m_recorder(recorder)
+        {
+        }
+
+        virtual void execute() override
+        {
+            m_recorder.recordScenesOnCurrentThread();
+            m_recorder.onTaskFinished();
+        }
+
+    private:
+        ParallelRenderCommandRecorder& m_recorder;
+    };
+
+    ParallelRenderCommandRecorder::ParallelRenderCommandRecorder(UInt16 workerThreadCount)
+        : m_nextSceneToRecord(0u)
+        , m_executor(workerThreadCount)
+    {
+        assert(workerThreadCount > 0u);
+        for (UInt16 i = 0u; i < workerThreadCount; ++i)
+            m_tasks.push_back(std::unique_ptr<RecordingTask>(new RecordingTask(*this)));
+        m_executor.start();
+    }
+
+    ParallelRenderCommandRecorder::~ParallelRenderCommandRecorder()
+    {
+    }
+
+    void ParallelRenderCommandRecorder::addScene(const RendererCachedScene& scene, const FrameBufferInfo& frameBuffer, const Matrix44f& rendererViewMatrix, Bool instancedDrawBatching)
+    {
+        assert(!m_sceneIndices.contains(scene.getSceneId()));
+        m_sceneIndices.put(scene.getSceneId(), m_scenesToRecord.size());
+        const Bool recordSequentially = scene.consumesLinkedTransformations();
+        if (recordSequentially)
+            ++m_sequentialSceneCount;
+        m_scenesToRecord.push_back({ &scene, frameBuffer, rendererViewMatrix, instancedDrawBatching, recordSequentially });
+        if (m_commandLists.size() < m_scenesToRecord.size())
+            m_commandLists.push_back(std::unique_ptr<RenderCommandList>(new RenderCommandList));
+    }
+
+    void ParallelRenderCommandRecorder::recordScenes()
+    {
+        for (UInt sceneIdx = 0u; sceneIdx < m_scenesToRecord.size(); ++sceneIdx)
+        {
+            if (m_scenesToRecord[sceneIdx].recordSequentially)
+                recordScene(sceneIdx);
+        }
+
+        m_nextSceneToRecord = 0u;
+
+        // calling thread records as well, so no task is needed for the last scene
+        const UInt scenesToRecordInParallel = m_scenesToRecord.size() - m_sequentialSceneCount;
+        const UInt scenesLeftForWorkers = (scenesToRecordInParallel == 0u) ? 0u : scenesToRecordInParallel - 1u;
+        const UInt tasksToRun = std::min<UInt>(m_tasks.size(), scenesLeftForWorkers);
+        {
+            PlatformLightweightGuard guard(m_lock);
+            m_runningTasks = tasksToRun;
+        }
+        for (UInt i = 0u; i < tasksToRun; ++i)
+            m_executor.enqueue(*m_tasks[i]);
+
+        recordScenesOnCurrentThread();
+
+        PlatformLightweightGuard guard(m_lock);
+        while (m_runningTasks > 0u)
+            m_tasksFinished.wait(&m_lock);
+    }
+
+    void ParallelRenderCommandRecorder::recordScenesOnCurrentThread()
+    {
+        for (UInt sceneIdx = m_nextSceneToRecord++; sceneIdx < m_scenesToRecord.size(); sceneIdx = m_nextSceneToRecord++)
+        {
+            if (!m_scenesToRecord[sceneIdx].recordSequentially)
+                recordScene(sceneIdx);
+        }
+    }
+
+    void ParallelRenderCommandRecorder::recordScene(UInt sceneIdx)
+    {
+        const SceneToRecord& sceneToRecord = m_scenesToRecord[sceneIdx];
+        RenderCommandList& commands = *m_commandLists[sceneIdx];
+        commands.clearCommands();
+
+        const RenderExecutor executor(commands, sceneToRecord.frameBuffer, {}, nullptr, sceneToRecord.instancedDrawBatching);
+        executor.executeScene(*sceneToRecord.scene, sceneToRecord.rendererViewMatrix);
+    }
+
+    void ParallelRenderCommandRecorder::onTaskFinished()
+    {
+        PlatformLightweightGuard guard(m_lock);
+        assert(m_runningTasks > 0u);
+        if (--m_runningTasks == 0u)
+            m_tasksFinished.broadcast();
+    }
+
+    const RenderCommandList* ParallelRenderCommandRecorder::getRecordedCommands(SceneId sceneId) const
+    {
+        const UInt* sceneIdx = m_sceneIndices.get(sceneId);
+        if (sceneIdx == nullptr)
+            return nullptr;
+
+        return m_commandLists[*sceneIdx].get();
+    }
+
+    void ParallelRenderCommandRecorder::reset()
+    {
+        m_scenesToRecord.clear();
+        m_sceneIndices.clear();
+        m_sequentialSceneCount = 0u;
+    }
+
+    UInt32 ParallelRenderCommandRecorder::getSceneCount() const
+    {
+        return static_cast<UInt32>(m_scenesToRecord.size());
+    }
+}
@@ -0,0 +1,826 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/RenderCommandList.h"
+#include "SceneAPI/PixelRectangle.h"
+#include "Math3d/Vector2.h"
+#include "Math3d/Vector3.h"
+#include "Math3d/Vector4.h"
+#include "Math3d/Vector2i.h"
+#include "Math3d/Vector3i.h"
+#include "Math3d/Vector4i.h"
+#include "Math3d/Matrix22f.h"
+#include "Math3d/Matrix33f.h"
+#include "Math3d/Matrix44f.h"
+#include "PlatformAbstraction/PlatformMemory.h"
+
+namespace ramses_internal
+{
+    enum class RenderCommandList::ECommand : UInt8
+    {
+        SetConstantFloat = 0,
+        SetConstantVector2,
+        SetConstantVector3,
+        SetConstantVector4,
+        SetConstantInt32,
+        SetConstantVector2i,
+        SetConstantVector3i,
+        SetConstantVector4i,
+        SetConstantMatrix22f,
+        SetConstantMatrix33f,
+        SetConstantMatrix44f,
+        SetInstanceWorldMatrices,
+        Clear,
+        DrawIndexedTriangles,
+        DrawTriangles,
+        ColorMask,
+        ClearColor,
+        ClearDepth,
+        ClearStencil,
+        BlendFactors,
+        BlendOperations,
+        CullMode,
+        DepthFunc,
+        DepthWrite,
+        StencilFunc,
+        StencilOp,
+        DrawMode,
+        SetViewport,
+        EnableScissorTest,
+        SetScissorRegion,
+        SetTextureSampling,
+        ActivateVertexBuffer,
+        ActivateIndexBuffer,
+        ActivateVertexArray,
+        ActivateShader,
+        ActivateTexture,
+        ActivateTextureSampler,
+        ActivateRenderTarget,
+        BlitRenderTargets
+    };
+
+    namespace
+    {
+        UInt AlignOffset(UInt offset, UInt alignment)
+        {
+            return (offset + alignment - 1u) / alignment * alignment;
+        }
+    }
+
+    void RenderCommandList::addCommand(ECommand command)
+    {
+        write(command);
+        ++m_commandCount;
+    }
+
+    template <typename T>
+    void RenderCommandList::write(const T& value)
+    {
+        const UInt offset = m_data.size();
+        m_data.resize(offset + sizeof(T));
+        PlatformMemory::Copy(m_data.data() + offset, &value, sizeof(T));
+    }
+
+    template <typename T>
+    void RenderCommandList::writeConstant(DataFieldHandle field, UInt32 count, const T* values)
+    {
+        write(field.asMemoryHandle());
+        write(count);
+        // values are aligned so that replay can pass pointer into the list directly to device
+        const UInt offset = AlignOffset(m_data.size(), alignof(T));
+        m_data.resize(offset + count * sizeof(T));
+        PlatformMemory::Copy(m_data.data() + offset, values, count * sizeof(T));
+    }
+
+    template <typename T>
+    T RenderCommandList::read(UInt& offset) const
+    {
+        assert(offset + sizeof(T) <= m_data.size());
+        T value;
+        PlatformMemory::Copy(&value, m_data.data() + offset, sizeof(T));
+        offset += sizeof(T);
+        return value;
+    }
+
+    template <typename T>
+    void RenderCommandList::replayConstant(IDevice& device, UInt& offset) const
+    {
+        const DataFieldHandle field(read<MemoryHandle>(offset));
+        const UInt32 count = read<UInt32>(offset);
+        offset = AlignOffset(offset, alignof(T));
+        device.setConstant(field, count, reinterpret_cast<const T*>(m_data.data() + offset));
+        offset += count * sizeof(T);
+    }
+
+    void RenderCommandList::replay(IDevice& device) const
+    {
+        UInt offset = 0u;
+        while (offset < m_data.size())
+        {
+            const ECommand command = read<ECommand>(offset);
+            switch (command)
+            {
+            case ECommand::SetConstantFloat:
+                replayConstant<Float>(device, offset);
+                break;
+            case ECommand::SetConstantVector2:
+                replayConstant<Vector2>(device, offset);
+                break;
+            case ECommand::SetConstantVector3:
+                replayConstant<Vector3>(device, offset);
+                break;
+            case ECommand::SetConstantVector4:
+                replayConstant<Vector4>(device, offset);
+                break;
+            case ECommand::SetConstantInt32:
+                replayConstant<Int32>(device, offset);
+                break;
+            case ECommand::SetConstantVector2i:
+                replayConstant<Vector2i>(device, offset);
+                break;
+            case ECommand::SetConstantVector3i:
+                replayConstant<Vector3i>(device, offset);
+                break;
+            case ECommand::SetConstantVector4i:
+                replayConstant<Vector4i>(device, offset);
+                break;
+            case ECommand::SetConstantMatrix22f:
+                replayConstant<Matrix22f>(device, offset);
+                break;
+            case ECommand::SetConstantMatrix33f:
+                replayConstant<Matrix33f>(device, offset);
+                break;
+            case ECommand::SetConstantMatrix44f:
+                replayConstant<Matrix44f>(device, offset);
+                break;
+            case ECommand::SetInstanceWorldMatrices:
+            {
+                const DataFieldHandle field(read<MemoryHandle>(offset));
+                const UInt32 count = read<UInt32>(offset);
+                offset = AlignOffset(offset, alignof(Matrix44f));
+                device.setInstanceWorldMatrices(field, count, reinterpret_cast<const Matrix44f*>(m_data.data() + offset));
+                offset += count * sizeof(Matrix44f);
+                break;
+            }
+            case ECommand::Clear:
+                device.clear(read<UInt32>(offset));
+                break;
+            case ECommand::DrawIndexedTriangles:
+            case ECommand::DrawTriangles:
+            {
+                const Int32 startOffset = read<Int32>(offset);
+                const Int32 elementCount = read<Int32>(offset);
+                const UInt32 instanceCount = read<UInt32>(offset);
+                if (command == ECommand::DrawIndexedTriangles)
+                    device.drawIndexedTriangles(startOffset, elementCount, instanceCount);
+                else
+                    device.drawTriangles(startOffset, elementCount, instanceCount);
+                break;
+            }
+            case ECommand::ColorMask:
+            {
+                const Bool r = read<Bool>(offset);
+                const Bool g = read<Bool>(offset);
+                const Bool b = read<Bool>(offset);
+                const Bool a = read<Bool>(offset);
+                device.colorMask(r, g, b, a);
+                break;
+            }
+            case ECommand::ClearColor:
+            {
+                const Float r = read<Float>(offset);
+                const Float g = read<Float>(offset);
+                const Float b = read<Float>(offset);
+                const Float a = read<Float>(offset);
+                device.clearColor(Vector4(r, g, b, a));
+                break;
+            }
+            case ECommand::ClearDepth:
+                device.clearDepth(read<Float>(offset));
+                break;
+            case ECommand::ClearStencil:
+                device.clearStencil(read<Int32>(offset));
+                break;
+            case ECommand::BlendFactors:
+            {
+                const EBlendFactor sourceColor = read<EBlendFactor>(offset);
+                const EBlendFactor destinationColor = read<EBlendFactor>(offset);
+                const EBlendFactor sourceAlpha = read<EBlendFactor>(offset);
+                const EBlendFactor destinationAlpha = read<EBlendFactor>(offset);
+                device.blendFactors(sourceColor, destinationColor, sourceAlpha, destinationAlpha);
+                break;
+            }
+            case ECommand::BlendOperations:
+            {
+                const EBlendOperation operationColor = read<EBlendOperation>(offset);
+                const EBlendOperation operationAlpha = read<EBlendOperation>(offset);
+                device.blendOperations(operationColor, operationAlpha);
+                break;
+            }
+            case ECommand::CullMode:
+                device.cullMode(read<ECullMode>(offset));
+                break;
+            case ECommand::DepthFunc:
+                device.depthFunc(read<EDepthFunc>(offset));
+                break;
+            case ECommand::DepthWrite:
+                device.depthWrite(read<EDepthWrite>(offset));
+                break;
+            case ECommand::StencilFunc:
+            {
+                const EStencilFunc func = read<EStencilFunc>(offset);
+                const UInt8 ref = read<UInt8>(offset);
+                const UInt8 mask = read<UInt8>(offset);
+                device.stencilFunc(func, ref, mask);
+                break;
+            }
+            case ECommand::StencilOp:
+            {
+                const EStencilOp sfail = read<EStencilOp>(offset);
+                const EStencilOp dpfail = read<EStencilOp>(offset);
+                const EStencilOp dppass = read<EStencilOp>(offset);
+                device.stencilOp(sfail, dpfail, dppass);
+                break;
+            }
+            case ECommand::DrawMode:
+                device.drawMode(read<EDrawMode>(offset));
+                break;
+            case ECommand::SetViewport:
+            case ECommand::SetScissorRegion:
+            {
+                const UInt32 x = read<UInt32>(offset);
+                const UInt32 y = read<UInt32>(offset);
+                const UInt32 width = read<UInt32>(offset);
+                const UInt32 height = read<UInt32>(offset);
+                if (command == ECommand::SetViewport)
+                    device.setViewport(x, y, width, height);
+                else
+                    device.setScissorRegion(x, y, width, height);
+                break;
+            }
+            case ECommand::EnableScissorTest:
+                device.enableScissorTest(read<Bool>(offset));
+                break;
+            case ECommand::SetTextureSampling:
+            {
+                const DataFieldHandle field(read<MemoryHandle>(offset));
+                const EWrapMethod wrapU = read<EWrapMethod>(offset);
+                const EWrapMethod wrapV = read<EWrapMethod>(offset);
+                const EWrapMethod wrapR = read<EWrapMethod>(offset);
+                const ESamplingMethod sampling = read<ESamplingMethod>(offset);
+                const UInt32 anisotropyLevel = read<UInt32>(offset);
+                device.setTextureSampling(field, wrapU, wrapV, wrapR, sampling, anisotropyLevel);
+                break;
+            }
+            case ECommand::ActivateVertexBuffer:
+            {
+                const DeviceResourceHandle handle(read<MemoryHandle>(offset));
+                const DataFieldHandle field(read<MemoryHandle>(offset));
+                const UInt32 instancingDivisor = read<UInt32>(offset);
+                device.activateVertexBuffer(handle, field, instancingDivisor);
+                break;
+            }
+            case ECommand::ActivateIndexBuffer:
+                device.activateIndexBuffer(DeviceResourceHandle(read<MemoryHandle>(offset)));
+                break;
+            case ECommand::ActivateVertexArray:
+                device.activateVertexArray(DeviceResourceHandle(read<MemoryHandle>(offset)));
+                break;
+            case ECommand::ActivateShader:
+                device.activateShader(DeviceResourceHandle(read<MemoryHandle>(offset)));
+                break;
+            case ECommand::ActivateTexture:
+            case ECommand::ActivateTextureSampler:
+            {
+                const DeviceResourceHandle handle(read<MemoryHandle>(offset));
+                const DataFieldHandle field(read<MemoryHandle>(offset));
+                if (command == ECommand::ActivateTexture)
+                    device.activateTexture(handle, field);
+                else
+                    device.activateTextureSampler(handle, field);
+                break;
+            }
+            case ECommand::ActivateRenderTarget:
+                device.activateRenderTarget(DeviceResourceHandle(read<MemoryHandle>(offset)));
+                break;
+            case ECommand::BlitRenderTargets:
+            {
+                const DeviceResourceHandle rtSrc(read<MemoryHandle>(offset));
+                const DeviceResourceHandle rtDst(read<MemoryHandle>(offset));
+                const PixelRectangle srcRect = read<PixelRectangle>(offset);
+                const PixelRectangle dstRect = read<PixelRectangle>(offset);
+                const Bool colorOnly = read<Bool>(offset);
+                device.blitRenderTargets(rtSrc, rtDst, srcRect, dstRect, colorOnly);
+                break;
+            }
+            default:
+                assert(false && "Unknown render command");
+                return;
+            }
+        }
+    }
+
+    void RenderCommandList::clearCommands()
+    {
+        // keeps allocated memory, lists are meant to be re-recorded every frame
+        m_data.clear();
+        m_commandCount = 0u;
+    }
+
+    UInt32 RenderCommandList::getCommandCount() const
+    {
+        return m_commandCount;
+    }
+
+    EDeviceTypeId RenderCommandList::getDeviceTypeId() const
+    {
+        return EDeviceTypeId_INVALID;
+    }
+
+    void RenderCommandList::setConstant(DataFieldHandle field, UInt32 count, const Float* value)
+    {
+        addCommand(ECommand::SetConstantFloat);
+        writeConstant(field, count, value);
+    }
+
+    void RenderCommandList::setConstant(DataFieldHandle field, UInt32 count, const Vector2* value)
+    {
+        addCommand(ECommand::SetConstantVector2);
+        writeConstant(field, count, value);
+    }
+
+    void RenderCommandList::setConstant(DataFieldHandle field, UInt32 count, const Vector3* value)
+    {
+        addCommand(ECommand::SetConstantVector3);
+        writeConstant(field, count, value);
+    }
+
+    void RenderCommandList::setConstant(DataFieldHandle field, UInt32 count, const Vector4* value)
+    {
+        addCommand(ECommand::SetConstantVector4);
+        writeConstant(field, count, value);
+    }
+
+    void RenderCommandList::setConstant(DataFieldHandle field, UInt32 count, const Int32* value)
+    {
+        addCommand(ECommand::SetConstantInt32);
+        writeConstant(field, count, value);
+    }
+
+    void RenderCommandList::setConstant(DataFieldHandle field, UInt32 count, const Vector2i* value)
+    {
+        addCommand(ECommand::SetConstantVector2i);
+        writeConstant(field, count, value);
+    }
+
+    void RenderCommandList::setConstant(DataFieldHandle field, UInt32 count, const Vector3i* value)
+    {
+        addCommand(ECommand::SetConstantVector3i);
+        writeConstant(field, count, value);
+    }
+
+    void RenderCommandList::setConstant(DataFieldHandle field, UInt32 count, const Vector4i* value)
+    {
+        addCommand(ECommand::SetConstantVector4i);
+        writeConstant(field, count, value);
+    }
+
+    void RenderCommandList::setConstant(DataFieldHandle field, UInt32 count, const Matrix22f* value)
+    {
+        addCommand(ECommand::SetConstantMatrix22f);
+        writeConstant(field, count, value);
+    }
+
+    void RenderCommandList::setConstant(DataFieldHandle field, UInt32 count, const Matrix33f* value)
+    {
+        addCommand(ECommand::SetConstantMatrix33f);
+        writeConstant(field, count, value);
+    }
+
+    void RenderCommandList::setConstant(DataFieldHandle field, UInt32 count, const Matrix44f* value)
+    {
+        addCommand(ECommand::SetConstantMatrix44f);
+        writeConstant(field, count, value);
+    }
+
+    void RenderCommandList::setInstanceWorldMatrices(DataFieldHandle field, UInt32 count, const Matrix44f* matrices)
+    {
+        addCommand(ECommand::SetInstanceWorldMatrices);
+        writeConstant(field, count, matrices);
+    }
+
+    void RenderCommandList::clear(UInt32 clearFlags)
+    {
+        addCommand(ECommand::Clear);
+        write(clearFlags);
+    }
+
+    void RenderCommandList::drawIndexedTriangles(Int32 startOffset, Int32 elementCount, UInt32 instanceCount)
+    {
+        addCommand(ECommand::DrawIndexedTriangles);
+        write(startOffset);
+        write(elementCount);
+        write(instanceCount);
+    }
+
+    void RenderCommandList::drawTriangles(Int32 startOffset, Int32 elementCount, UInt32 instanceCount)
+    {
+        addCommand(ECommand::DrawTriangles);
+        write(startOffset);
+        write(elementCount);
+        write(instanceCount);
+    }
+
+    void RenderCommandList::finish()
+    {
+        assert(false && "RenderCommandList cannot record finish");
+    }
+
+    void RenderCommandList::colorMask(Bool r, Bool g, Bool b, Bool a)
+    {
+        addCommand(ECommand::ColorMask);
+        write(r);
+        write(g);
+        write(b);
+        write(a);
+    }
+
+    void RenderCommandList::clearColor(const Vector4& clearColor)
+    {
+        addCommand(ECommand::ClearColor);
+        write(clearColor.x);
+        write(clearColor.y);
+        write(clearColor.z);
+        write(clearColor.w);
+    }
+
+    void RenderCommandList::clearDepth(Float d)
+    {
+        addCommand(ECommand::ClearDepth);
+        write(d);
+    }
+
+    void RenderCommandList::clearStencil(Int32 s)
+    {
+        addCommand(ECommand::ClearStencil);
+        write(s);
+    }
+
+    void RenderCommandList::blendFactors(EBlendFactor sourceColor, EBlendFactor destinationColor, EBlendFactor sourceAlpha, EBlendFactor destinationAlpha)
+    {
+        addCommand(ECommand::BlendFactors);
+        write(sourceColor);
+        write(destinationColor);
+        write(sourceAlpha);
+        write(destinationAlpha);
+    }
+
+    void RenderCommandList::blendOperations(EBlendOperation operationColor, EBlendOperation operationAlpha)
+    {
+        addCommand(ECommand::BlendOperations);
+        write(operationColor);
+        write(operationAlpha);
+    }
+
+    void RenderCommandList::cullMode(ECullMode mode)
+    {
+        addCommand(ECommand::CullMode);
+        write(mode);
+    }
+
+    void RenderCommandList::depthFunc(EDepthFunc func)
+    {
+        addCommand(ECommand::DepthFunc);
+        write(func);
+    }
+
+    void RenderCommandList::depthWrite(EDepthWrite flag)
+    {
+        addCommand(ECommand::DepthWrite);
+        write(flag);
+    }
+
+    void RenderCommandList::stencilFunc(EStencilFunc func, UInt8 ref, UInt8 mask)
+    {
+        addCommand(ECommand::StencilFunc);
+        write(func);
+        write(ref);
+        write(mask);
+    }
+
+    void RenderCommandList::stencilOp(EStencilOp sfail, EStencilOp dpfail, EStencilOp dppass)
+    {
+        addCommand(ECommand::StencilOp);
+        write(sfail);
+        write(dpfail);
+        write(dppass);
+    }
+
+    void RenderCommandList::drawMode(EDrawMode mode)
+    {
+        addCommand(ECommand::DrawMode);
+        write(mode);
+    }
+
+    void RenderCommandList::setViewport(UInt32 x, UInt32 y, UInt32 width, UInt32 height)
+    {
+        addCommand(ECommand::SetViewport);
+        write(x);
+        write(y);
+        write(width);
+        write(height);
+    }
+
+    void RenderCommandList::enableScissorTest(Bool flag)
+    {
+        addCommand(ECommand::EnableScissorTest);
+        write(flag);
+    }
+
+    void RenderCommandList::setScissorRegion(UInt32 x, UInt32 y, UInt32 width, UInt32 height)
+    {
+        addCommand(ECommand::SetScissorRegion);
+        write(x);
+        write(y);
+        write(width);
+        write(height);
+    }
+
+    void RenderCommandList::setTextureSampling(DataFieldHandle field, EWrapMethod wrapU, EWrapMethod wrapV, EWrapMethod wrapR, ESamplingMethod sampling, UInt32 anisotropyLevel)
+    {
+        addCommand(ECommand::SetTextureSampling);
+        write(field.asMemoryHandle());
+        write(wrapU);
+        write(wrapV);
+        write(wrapR);
+        write(sampling);
+        write(anisotropyLevel);
+    }
+
+    DeviceResourceHandle RenderCommandList::allocateVertexBuffer(EDataType, UInt32)
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    void RenderCommandList::uploadVertexBufferData(DeviceResourceHandle, const Byte*, UInt32)
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+    }
+
+    void RenderCommandList::deleteVertexBuffer(DeviceResourceHandle)
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+    }
+
+    void RenderCommandList::activateVertexBuffer(DeviceResourceHandle handle, DataFieldHandle field, UInt32 instancingDivisor)
+    {
+        addCommand(ECommand::ActivateVertexBuffer);
+        write(handle.asMemoryHandle());
+        write(field.asMemoryHandle());
+        write(instancingDivisor);
+    }
+
+    DeviceResourceHandle RenderCommandList::allocateIndexBuffer(EDataType, UInt32)
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    void RenderCommandList::uploadIndexBufferData(DeviceResourceHandle, const Byte*, UInt32)
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+    }
+
+    void RenderCommandList::deleteIndexBuffer(DeviceResourceHandle)
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+    }
+
+    void RenderCommandList::activateIndexBuffer(DeviceResourceHandle handle)
+    {
+        addCommand(ECommand::ActivateIndexBuffer);
+        write(handle.asMemoryHandle());
+    }
+
+    DeviceResourceHandle RenderCommandList::allocateVertexArray(const VertexArrayInfo&)
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    void RenderCommandList::activateVertexArray(DeviceResourceHandle handle)
+    {
+        addCommand(ECommand::ActivateVertexArray);
+        write(handle.asMemoryHandle());
+    }
+
+    void RenderCommandList::deleteVertexArray(DeviceResourceHandle)
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+    }
+
+    DeviceResourceHandle RenderCommandList::uploadShader(const EffectResource&)
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    DeviceResourceHandle RenderCommandList::uploadBinaryShader(const EffectResource&, const UInt8*, UInt32, UInt32)
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    Bool RenderCommandList::getBinaryShader(DeviceResourceHandle, UInt8Vector&, UInt32&)
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+        return false;
+    }
+
+    void RenderCommandList::deleteShader(DeviceResourceHandle)
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+    }
+
+    void RenderCommandList::activateShader(DeviceResourceHandle handle)
+    {
+        addCommand(ECommand::ActivateShader);
+        write(handle.asMemoryHandle());
+    }
+
+    DeviceResourceHandle RenderCommandList::allocateTexture2D(UInt32, UInt32, ETextureFormat, UInt32, UInt32)
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    DeviceResourceHandle RenderCommandList::allocateTexture3D(UInt32, UInt32, UInt32, ETextureFormat, UInt32, UInt32)
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    DeviceResourceHandle RenderCommandList::allocateTextureCube(UInt32, ETextureFormat, UInt32, UInt32)
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    void RenderCommandList::bindTexture(DeviceResourceHandle)
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+    }
+
+    void RenderCommandList::generateMipmaps(DeviceResourceHandle)
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+    }
+
+    void RenderCommandList::setTextureBaseMipLevel(DeviceResourceHandle, UInt32)
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+    }
+
+    void RenderCommandList::uploadTextureData(DeviceResourceHandle, UInt32, UInt32, UInt32, UInt32, UInt32, UInt32, UInt32, const Byte*, UInt32)
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+    }
+
+    DeviceResourceHandle RenderCommandList::uploadStreamTexture2D(DeviceResourceHandle, UInt32, UInt32, ETextureFormat, const UInt8*)
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    void RenderCommandList::deleteTexture(DeviceResourceHandle)
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+    }
+
+    void RenderCommandList::activateTexture(DeviceResourceHandle handle, DataFieldHandle field)
+    {
+        addCommand(ECommand::ActivateTexture);
+        write(handle.asMemoryHandle());
+        write(field.asMemoryHandle());
+    }
+
+    DeviceResourceHandle RenderCommandList::uploadRenderBuffer(const RenderBuffer&)
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    void RenderCommandList::deleteRenderBuffer(DeviceResourceHandle)
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+    }
+
+    DeviceResourceHandle RenderCommandList::uploadTextureSampler(EWrapMethod, EWrapMethod, EWrapMethod, ESamplingMethod, UInt32)
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    void RenderCommandList::deleteTextureSampler(DeviceResourceHandle)
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+    }
+
+    void RenderCommandList::activateTextureSampler(DeviceResourceHandle handle, DataFieldHandle field)
+    {
+        addCommand(ECommand::ActivateTextureSampler);
+        write(handle.asMemoryHandle());
+        write(field.asMemoryHandle());
+    }
+
+    DeviceResourceHandle RenderCommandList::getFramebufferRenderTarget() const
+    {
+        assert(false && "RenderCommandList cannot query device");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    DeviceResourceHandle RenderCommandList::uploadRenderTarget(const DeviceHandleVector&)
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+        return DeviceResourceHandle::Invalid();
+    }
+
+    void RenderCommandList::activateRenderTarget(DeviceResourceHandle handle)
+    {
+        addCommand(ECommand::ActivateRenderTarget);
+        write(handle.asMemoryHandle());
+    }
+
+    void RenderCommandList::deleteRenderTarget(DeviceResourceHandle)
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+    }
+
+    void RenderCommandList::pairRenderTargetsForDoubleBuffering(DeviceResourceHandle[2], DeviceResourceHandle[2])
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+    }
+
+    void RenderCommandList::unpairRenderTargets(DeviceResourceHandle)
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+    }
+
+    void RenderCommandList::swapDoubleBufferedRenderTarget(DeviceResourceHandle)
+    {
+        assert(false && "RenderCommandList cannot record resource management");
+    }
+
+    void RenderCommandList::blitRenderTargets(DeviceResourceHandle rtSrc, DeviceResourceHandle rtDst, const PixelRectangle& srcRect, const PixelRectangle& dstRect, Bool colorOnly)
+    {
+        addCommand(ECommand::BlitRenderTargets);
+        write(rtSrc.asMemoryHandle());
+        write(rtDst.asMemoryHandle());
+        write(srcRect);
+        write(dstRect);
+        write(colorOnly);
+    }
+
+    void RenderCommandList::readPixels(UInt8*, UInt32, UInt32, UInt32, UInt32)
+    {
+        assert(false && "RenderCommandList cannot read back data");
+    }
+
+    UInt32 RenderCommandList::getTotalGpuMemoryUsageInKB() const
+    {
+        assert(false && "RenderCommandList cannot query device");
+        return 0u;
+    }
+
+    UInt32 RenderCommandList::getDrawCallCount() const
+    {
+        assert(false && "RenderCommandList cannot query device");
+        return 0u;
+    }
+
+    void RenderCommandList::resetDrawCallCount()
+    {
+        assert(false && "RenderCommandList cannot query device");
+    }
+
+    void RenderCommandList::validateDeviceStatusHealthy() const
+    {
+    }
+
+    Bool RenderCommandList::isDeviceStatusHealthy() const
+    {
+        return true;
+    }
+
+    int RenderCommandList::getTextureAddress(DeviceResourceHandle) const
+    {
+        assert(false && "RenderCommandList cannot query device");
+        return 0;
+    }
+}
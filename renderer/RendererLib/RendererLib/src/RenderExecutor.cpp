@@ -15,8 +15,9 @@ namespace ramses_internal
 {
     UInt32 RenderExecutor::NumRenderablesToRenderInBetweenTimeBudgetChecks = RenderExecutor::DefaultNumRenderablesToRenderInBetweenTimeBudgetChecks;
 
-    RenderExecutor::RenderExecutor(IDevice& device, const FrameBufferInfo& frameBuffer, const SceneRenderExecutionIterator& renderFrom, const FrameTimer* frameTimer)
+    RenderExecutor::RenderExecutor(IDevice& device, const FrameBufferInfo& frameBuffer, const SceneRenderExecutionIterator& renderFrom, const FrameTimer* frameTimer, Bool instancedDrawBatching)
         : m_state(device, frameBuffer, renderFrom, frameTimer)
+        , m_instancedDrawBatching(instancedDrawBatching)
     {
     }
 
@@ -34,6 +35,7 @@ namespace ramses_internal
                 if (!executeRenderPass(scene, passInfo.getRenderPassHandle()))
                 {
                     assert(m_state.m_currentRenderIterator.getFlattenedRenderableIdx() > 0);
+                    scene.reportSkippedUniforms(m_state.getSkippedUniformCount());
                     return m_state.m_currentRenderIterator;
                 }
                 break;
@@ -45,6 +47,7 @@ namespace ramses_internal
             }
         }
 
+        scene.reportSkippedUniforms(m_state.getSkippedUniformCount());
         return {};
     }
 
@@ -79,19 +82,105 @@ namespace ramses_internal
         }
 
         const RenderableVector& orderedRenderables = scene.getOrderedRenderablesForPass(pass);
+        UInt32 numRenderablesDrawn = 0u;
+        UInt32 numDrawCalls = 0u;
         while (m_state.m_currentRenderIterator.getRenderableIdx() < orderedRenderables.size())
         {
             const RenderableHandle renderableHandle = orderedRenderables[m_state.m_currentRenderIterator.getRenderableIdx()];
+            UInt32 numRenderablesToDraw = 1u;
             if (!scene.renderableResourcesDirty(renderableHandle))
             {
+                if (m_instancedDrawBatching)
+                    numRenderablesToDraw = collectInstancingBatch(scene, orderedRenderables, m_state.m_currentRenderIterator.getRenderableIdx());
                 setRenderableInternalStates(renderableHandle);
                 setSemanticDataFields();
                 executeRenderable();
+                numRenderablesDrawn += numRenderablesToDraw;
+                ++numDrawCalls;
             }
-            m_state.m_currentRenderIterator.incrementRenderableIdx();
 
-            if ((m_state.m_currentRenderIterator.getFlattenedRenderableIdx() % NumRenderablesToRenderInBetweenTimeBudgetChecks == 0u) && m_state.hasExceededTimeBudgetForRendering())
+            Bool timeBudgetCheckDue = false;
+            for (UInt32 i = 0u; i < numRenderablesToDraw; ++i)
+            {
+                m_state.m_currentRenderIterator.incrementRenderableIdx();
+                timeBudgetCheckDue |= (m_state.m_currentRenderIterator.getFlattenedRenderableIdx() % NumRenderablesToRenderInBetweenTimeBudgetChecks == 0u);
+            }
+
+            if (timeBudgetCheckDue && m_state.hasExceededTimeBudgetForRendering())
+            {
+                if (m_instancedDrawBatching)
+                    scene.reportRenderPassBatching(pass, numRenderablesDrawn, numDrawCalls);
                 return false;
+            }
+        }
+
+        if (m_instancedDrawBatching)
+            scene.reportRenderPassBatching(pass, numRenderablesDrawn, numDrawCalls);
+        return true;
+    }
+
+    UInt32 RenderExecutor::collectInstancingBatch(const RendererCachedScene& scene, const RenderableVector& orderedRenderables, UInt32 firstRenderableIdx) const
+    {
+        Vector<Matrix44f>& worldMatrices = m_state.instancingBatchWorldMatrices;
+        worldMatrices.clear();
+
+        const RenderableHandle firstRenderableHandle = orderedRenderables[firstRenderableIdx];
+        if (!CanBeDrawnInInstancingBatch(scene, firstRenderableHandle))
+            return 1u;
+
+        // renderables can be drawn together if they differ in nothing else but their world matrix
+        const Renderable& firstRenderable = scene.getRenderable(firstRenderableHandle);
+        const DeviceResourceHandle effectDeviceHandle = scene.getRenderableEffectDeviceHandle(firstRenderableHandle);
+        UInt32 idx = firstRenderableIdx + 1u;
+        for (; idx < orderedRenderables.size(); ++idx)
+        {
+            const RenderableHandle renderableHandle = orderedRenderables[idx];
+            const Renderable& renderable = scene.getRenderable(renderableHandle);
+            if (scene.renderableResourcesDirty(renderableHandle) ||
+                scene.getRenderableEffectDeviceHandle(renderableHandle) != effectDeviceHandle ||
+                renderable.dataInstances[ERenderableDataSlotType_Geometry] != firstRenderable.dataInstances[ERenderableDataSlotType_Geometry] ||
+                renderable.dataInstances[ERenderableDataSlotType_Uniforms] != firstRenderable.dataInstances[ERenderableDataSlotType_Uniforms] ||
+                renderable.renderState != firstRenderable.renderState ||
+                renderable.startIndex != firstRenderable.startIndex ||
+                renderable.indexCount != firstRenderable.indexCount ||
+                renderable.instanceCount != 1u)
+            {
+                break;
+            }
+        }
+
+        const UInt32 batchSize = idx - firstRenderableIdx;
+        if (batchSize > 1u)
+        {
+            worldMatrices.reserve(batchSize);
+            for (UInt32 i = firstRenderableIdx; i < idx; ++i)
+                worldMatrices.push_back(scene.getRenderableWorldMatrix(orderedRenderables[i]));
+        }
+
+        return batchSize;
+    }
+
+    Bool RenderExecutor::CanBeDrawnInInstancingBatch(const RendererCachedScene& scene, RenderableHandle renderableHandle)
+    {
+        const Renderable& renderable = scene.getRenderable(renderableHandle);
+        if (renderable.instanceCount != 1u || !scene.getInstanceWorldMatrixAttributeField(renderable.dataInstances[ERenderableDataSlotType_Geometry]).isValid())
+            return false;
+
+        // uniforms derived from world matrix would differ per renderable
+        const DataLayout& uniformLayout = scene.getDataLayout(scene.getLayoutOfDataInstance(renderable.dataInstances[ERenderableDataSlotType_Uniforms]));
+        for (DataFieldHandle field(0u); field < uniformLayout.getFieldCount(); ++field)
+        {
+            switch (uniformLayout.getField(field).semantics)
+            {
+            case EFixedSemantics_ModelMatrix:
+            case EFixedSemantics_ModelViewMatrix:
+            case EFixedSemantics_ModelViewMatrix33:
+            case EFixedSemantics_ModelViewProjectionMatrix:
+            case EFixedSemantics_NormalMatrix:
+                return false;
+            default:
+                break;
+            }
         }
 
         return true;
@@ -172,17 +261,30 @@ namespace ramses_internal
         if (m_state.shaderDeviceHandle.hasChanged())
         {
             device.activateShader(m_state.shaderDeviceHandle.getState());
+            m_state.setUniformShadowProgram(m_state.shaderDeviceHandle.getState());
         }
 
-        const DeviceHandleVector& geometryDeviceHandles = renderScene.getCachedHandlesForVertexAttributes()[vertexData.asMemoryHandle()];
-        // Vertex attributes cache contains indices as first element, therefore the vertex attributes are shifted by 1 when accessing them
-        const UInt attributesCount = geometryDeviceHandles.size() - 1u;
-        for (DataFieldHandle attributeField(0u); attributeField < attributesCount; ++attributeField)
+        if (m_state.vertexArrayDeviceHandle.getState().isValid())
+        {
+            if (m_state.vertexArrayDeviceHandle.hasChanged())
+            {
+                device.activateVertexArray(m_state.vertexArrayDeviceHandle.getState());
+            }
+        }
+        else
         {
-            const DeviceResourceHandle geometryBufferHandle = geometryDeviceHandles[attributeField.asMemoryHandle() + 1u];
-            assert(geometryBufferHandle.isValid());
-            const UInt32 instancingDivisor = renderScene.getDataResource(vertexData, attributeField + 1u).instancingDivisor;
-            device.activateVertexBuffer(geometryBufferHandle, attributeField, instancingDivisor);
+            const DeviceHandleVector& geometryDeviceHandles = renderScene.getCachedHandlesForVertexAttributes()[vertexData.asMemoryHandle()];
+            // Vertex attributes cache contains indices as first element, therefore the vertex attributes are shifted by 1 when accessing them
+            const UInt attributesCount = geometryDeviceHandles.size() - 1u;
+            for (DataFieldHandle attributeField(0u); attributeField < attributesCount; ++attributeField)
+            {
+                const DeviceResourceHandle geometryBufferHandle = geometryDeviceHandles[attributeField.asMemoryHandle() + 1u];
+                // instance world matrix attribute has no vertex buffer, it is set separately before draw call
+                if (!geometryBufferHandle.isValid())
+                    continue;
+                const UInt32 instancingDivisor = renderScene.getDataResource(vertexData, attributeField + 1u).instancingDivisor;
+                device.activateVertexBuffer(geometryBufferHandle, attributeField, instancingDivisor);
+            }
         }
 
         const DataLayoutHandle dataLayoutHandle = renderScene.getLayoutOfDataInstance(uniformData);
@@ -205,6 +307,13 @@ namespace ramses_internal
         }
     }
 
+    template <typename T>
+    void RenderExecutor::setConstant(DataFieldHandle field, UInt32 elementCount, const T* value) const
+    {
+        if (m_state.updateUniformShadowCopy(field, value, elementCount * sizeof(T)))
+            m_state.getDevice().setConstant(field, elementCount, value);
+    }
+
     void RenderExecutor::executeConstant(EDataType dataType, UInt32 elementCount, DataInstanceHandle dataInstance, DataFieldHandle dataInstancefield, DataFieldHandle uniformInputField) const
     {
         IDevice& device = m_state.getDevice();
@@ -215,77 +324,77 @@ namespace ramses_internal
         case EDataType_Float:
         {
             const Float* value = renderScene.getDataFloatArray(dataInstance, dataInstancefield);
-            device.setConstant(uniformInputField, elementCount, value);
+            setConstant(uniformInputField, elementCount, value);
             break;
         }
 
         case EDataType_Vector2F:
         {
             const Vector2* value = renderScene.getDataVector2fArray(dataInstance, dataInstancefield);
-            device.setConstant(uniformInputField, elementCount, value);
+            setConstant(uniformInputField, elementCount, value);
             break;
         }
 
         case EDataType_Vector3F:
         {
             const Vector3* value = renderScene.getDataVector3fArray(dataInstance, dataInstancefield);
-            device.setConstant(uniformInputField, elementCount, value);
+            setConstant(uniformInputField, elementCount, value);
             break;
         }
 
         case EDataType_Vector4F:
         {
             const Vector4* value = renderScene.getDataVector4fArray(dataInstance, dataInstancefield);
-            device.setConstant(uniformInputField, elementCount, value);
+            setConstant(uniformInputField, elementCount, value);
             break;
         }
 
         case EDataType_Matrix22F:
         {
             const Matrix22f* value = renderScene.getDataMatrix22fArray(dataInstance, dataInstancefield);
-            device.setConstant(uniformInputField, elementCount, value);
+            setConstant(uniformInputField, elementCount, value);
             break;
         }
 
         case EDataType_Matrix33F:
         {
             const Matrix33f* value = renderScene.getDataMatrix33fArray(dataInstance, dataInstancefield);
-            device.setConstant(uniformInputField, elementCount, value);
+            setConstant(uniformInputField, elementCount, value);
             break;
         }
 
         case EDataType_Matrix44F:
         {
             const Matrix44f* value = renderScene.getDataMatrix44fArray(dataInstance, dataInstancefield);
-            device.setConstant(uniformInputField, elementCount, value);
+            setConstant(uniformInputField, elementCount, value);
             break;
         }
 
         case EDataType_Int32:
         {
             const Int32* value = renderScene.getDataIntegerArray(dataInstance, dataInstancefield);
-            device.setConstant(uniformInputField, elementCount, value);
+            setConstant(uniformInputField, elementCount, value);
             break;
         }
 
         case EDataType_Vector2I:
         {
             const Vector2i* value = renderScene.getDataVector2iArray(dataInstance, dataInstancefield);
-            device.setConstant(uniformInputField, elementCount, value);
+            setConstant(uniformInputField, elementCount, value);
             break;
         }
 
         case EDataType_Vector3I:
         {
             const Vector3i* value = renderScene.getDataVector3iArray(dataInstance, dataInstancefield);
-            device.setConstant(uniformInputField, elementCount, value);
+            setConstant(uniformInputField, elementCount, value);
             break;
         }
 
         case EDataType_Vector4I:
         {
             const Vector4i* value = renderScene.getDataVector4iArray(dataInstance, dataInstancefield);
-            device.setConstant(uniformInputField, elementCount, value);
+            setConstant(uniformInputField, elementCount, value);
             break;
         }
 
@@ -321,23 +430,42 @@ namespace ramses_internal
     void RenderExecutor::executeDrawCall() const
     {
         IDevice& device = m_state.getDevice();
-        const IScene& renderScene = m_state.getScene();
+        const ResourceCachedScene& renderScene = m_state.getScene();
         const Renderable& renderable = renderScene.getRenderable(m_state.getRenderable());
 
         const bool hasIndexArray = m_state.indexBufferDeviceHandle.getState() != DeviceResourceHandle::Invalid();
+        // index buffer is part of vertex array, otherwise it has to be activated again after leaving a vertex array
+        const bool usesVertexArray = m_state.vertexArrayDeviceHandle.getState().isValid();
+        const bool indexBufferNeedsActivation = m_state.indexBufferDeviceHandle.hasChanged() || m_state.vertexArrayDeviceHandle.hasChanged();
 
-        if (hasIndexArray && m_state.indexBufferDeviceHandle.hasChanged())
+        if (hasIndexArray && !usesVertexArray && indexBufferNeedsActivation)
         {
             device.activateIndexBuffer(m_state.indexBufferDeviceHandle.getState());
         }
 
+        UInt32 instanceCount = renderable.instanceCount;
+        const DataFieldHandle instanceWorldMatrixField = renderScene.getInstanceWorldMatrixAttributeField(renderable.dataInstances[ERenderableDataSlotType_Geometry]);
+        if (instanceWorldMatrixField.isValid())
+        {
+            const Vector<Matrix44f>& batchWorldMatrices = m_state.instancingBatchWorldMatrices;
+            if (batchWorldMatrices.empty())
+            {
+                device.setInstanceWorldMatrices(instanceWorldMatrixField, 1u, &m_state.getModelMatrix());
+            }
+            else
+            {
+                instanceCount = static_cast<UInt32>(batchWorldMatrices.size());
+                device.setInstanceWorldMatrices(instanceWorldMatrixField, instanceCount, batchWorldMatrices.data());
+            }
+        }
+
         if (hasIndexArray)
         {
-            device.drawIndexedTriangles(renderable.startIndex, renderable.indexCount, renderable.instanceCount);
+            device.drawIndexedTriangles(renderable.startIndex, renderable.indexCount, instanceCount);
         }
         else
         {
-            device.drawTriangles(renderable.startIndex, renderable.indexCount, renderable.instanceCount);
+            device.drawTriangles(renderable.startIndex, renderable.indexCount, instanceCount);
         }
     }
 
@@ -360,6 +488,7 @@ namespace ramses_internal
         const DataInstanceHandle vertexData = renderable.dataInstances[ERenderableDataSlotType_Geometry];
         const DeviceHandleVector& geometryDeviceHandles = renderScene.getCachedHandlesForVertexAttributes()[vertexData.asMemoryHandle()];
         m_state.indexBufferDeviceHandle.setState(geometryDeviceHandles.front());
+        m_state.vertexArrayDeviceHandle.setState(renderScene.getRenderableVertexArrayDeviceHandle(renderableHandle));
 
         const RenderState& renderState = renderScene.getRenderState(renderable.renderState);
 
@@ -8,6 +8,7 @@
 
 #include "RenderExecutorInternalState.h"
 #include "RendererLib/RendererCachedScene.h"
+#include "PlatformAbstraction/PlatformMemory.h"
 
 namespace ramses_internal
 {
@@ -21,6 +22,8 @@ namespace ramses_internal
         , m_projectionMatrix(Matrix44f::Identity)
         , m_cameraWorldPosition(0.0f)
         , m_frameTimer(frameTimer)
+        , m_currentProgramUniforms(nullptr)
+        , m_skippedUniformCount(0u)
     {
         // Currently framebuffer is default render target and invalid RT handle is used to refer to it.
         // For that reason the cached state here needs to be set to another 'invalid' so it can properly
@@ -146,4 +149,41 @@ namespace ramses_internal
     {
         return m_renderable;
     }
+
+    void RenderExecutorInternalState::setUniformShadowProgram(DeviceResourceHandle shader)
+    {
+        m_currentProgramUniforms = &m_uniformShadowCopies[shader];
+    }
+
+    Bool RenderExecutorInternalState::updateUniformShadowCopy(DataFieldHandle field, const void* data, UInt32 dataSize)
+    {
+        assert(m_currentProgramUniforms != nullptr);
+        ProgramUniformShadowCopies& programUniforms = *m_currentProgramUniforms;
+        if (programUniforms.size() <= field.asMemoryHandle())
+            programUniforms.resize(field.asMemoryHandle() + 1u);
+
+        UniformShadowCopy& shadowCopy = programUniforms[field.asMemoryHandle()];
+        if (shadowCopy.size == dataSize && dataSize > 0u)
+        {
+            if (PlatformMemory::Compare(&m_uniformShadowData[shadowCopy.offset], data, dataSize) == 0)
+            {
+                ++m_skippedUniformCount;
+                return false;
+            }
+        }
+        else
+        {
+            shadowCopy.offset = static_cast<UInt32>(m_uniformShadowData.size());
+            shadowCopy.size = dataSize;
+            m_uniformShadowData.resize(m_uniformShadowData.size() + dataSize);
+        }
+
+        PlatformMemory::Copy(m_uniformShadowData.data() + shadowCopy.offset, data, dataSize);
+        return true;
+    }
+
+    UInt32 RenderExecutorInternalState::getSkippedUniformCount() const
+    {
+        return m_skippedUniformCount;
+    }
 }
@@ -11,6 +11,7 @@
 #include "RendererAPI/ISystemCompositorController.h"
 #include "RendererAPI/IEmbeddedCompositor.h"
 #include "RendererAPI/ISurface.h"
+#include "RendererAPI/IContext.h"
 #include "RendererAPI/IWindow.h"
 #include "RendererAPI/IDevice.h"
 #include "RendererAPI/IWindowEventsPollingManager.h"
@@ -131,6 +132,17 @@ namespace ramses_internal
         addDisplayController(*displayController, display);
         setClearColor(display, displayConfig.getClearColor());
 
+        if (displayConfig.isPartialRedrawEnabled())
+        {
+            // warping and stereo render scenes into intermediate buffers which are then fully redrawn to framebuffer
+            if (displayConfig.isWarpingEnabled() || displayConfig.isStereoDisplay())
+                LOG_WARN(CONTEXT_RENDERER, "RamsesRenderer::createDisplayContext: partial redraw is not supported with warping or stereo display, will always redraw whole framebuffer");
+            else
+                m_displays.find(display)->second.dirtyRegionTracker.reset(new DirtyRegionTracker);
+        }
+        m_displays.find(display)->second.supportsCommandRecording = !displayConfig.isStereoDisplay();
+        m_displays.find(display)->second.instancedDrawBatching = displayConfig.isInstancedDrawBatchingEnabled();
+
         LOG_TRACE(CONTEXT_PROFILING, "RamsesRenderer::createDisplayContext finished creating display");
     }
 
@@ -176,6 +188,12 @@ namespace ramses_internal
         return m_displays.find(display) != m_displays.cend();
     }
 
+    Bool Renderer::isPartialRedrawUsed(DisplayHandle display) const
+    {
+        const auto it = m_displays.find(display);
+        return it != m_displays.cend() && it->second.dirtyRegionTracker.get() != nullptr;
+    }
+
     void Renderer::systemCompositorListIviSurfaces() const
     {
         if(0 != m_systemCompositorController)
@@ -312,7 +330,7 @@ namespace ramses_internal
         assert(displayInfo.couldRenderLastFrame);
         IDisplayController& display = *displayInfo.displayController;
         const DisplayBufferInfo& displayBufferInfo = displayInfo.buffersSetup.getDisplayBuffer(displayInfo.frameBufferDeviceHandle);
-        if (!displayBufferInfo.needsRerender)
+        if (!displayBufferInfo.needsRerender && displayBufferInfo.partialRerenderRegion.isEmpty())
         {
             // notify clients even if nothing rendered but frame was consumed
             display.getEmbeddedCompositingManager().notifyClients();
@@ -321,6 +339,17 @@ namespace ramses_internal
 
         ActivateDisplayContext(displayHandle, activeDisplay, display);
 
+        const Viewport& viewport = displayBufferInfo.viewport;
+        const Quad bufferRegion(viewport.posX, viewport.posY, viewport.width, viewport.height);
+        const Quad regionToRedraw = getFramebufferRegionToRedraw(displayHandle, bufferRegion);
+        const Bool partialRedraw = !(regionToRedraw == bufferRegion);
+        if (partialRedraw)
+        {
+            IDevice& device = display.getRenderBackend().getDevice();
+            device.setScissorRegion(static_cast<UInt32>(regionToRedraw.x), static_cast<UInt32>(regionToRedraw.y), static_cast<UInt32>(regionToRedraw.width), static_cast<UInt32>(regionToRedraw.height));
+            device.enableScissorTest(true);
+        }
+
         display.clearBuffer(displayInfo.frameBufferDeviceHandle, displayBufferInfo.clearColor);
 
         m_tempScenesRendered.clear();
@@ -330,7 +359,7 @@ namespace ramses_internal
             if (sceneInfo.shown)
             {
                 const RendererCachedScene& scene = m_rendererScenes.getScene(sceneInfo.sceneId);
-                display.renderScene(scene, displayInfo.frameBufferDeviceHandle, displayBufferInfo.viewport);
+                renderSceneToBuffer(display, scene, displayInfo.frameBufferDeviceHandle, displayBufferInfo.viewport);
                 onSceneWasRendered(scene);
                 m_tempScenesRendered.push_back(sceneInfo.sceneId);
             }
@@ -342,6 +371,10 @@ namespace ramses_internal
                 logStream << " " << sceneId;
         }));
 
+        if (partialRedraw)
+            display.getRenderBackend().getDevice().enableScissorTest(false);
+        m_statistics.framebufferRedrawn(displayHandle, static_cast<UInt>(regionToRedraw.width) * regionToRedraw.height, static_cast<UInt>(bufferRegion.width) * bufferRegion.height);
+
         display.executePostProcessing();
 
         auto profileRenderer = *m_frameProfileRenderer.get(displayHandle);
@@ -353,6 +386,30 @@ namespace ramses_internal
         displayInfo.buffersSetup.setDisplayBufferToBeRerendered(displayInfo.frameBufferDeviceHandle, false);
     }
 
+    Quad Renderer::getFramebufferRegionToRedraw(DisplayHandle displayHandle, const Quad& bufferRegion)
+    {
+        const auto& displayInfo = m_displays.find(displayHandle)->second;
+        const DisplayBufferInfo& displayBufferInfo = displayInfo.buffersSetup.getDisplayBuffer(displayInfo.frameBufferDeviceHandle);
+        DirtyRegionTracker* dirtyRegionTracker = displayInfo.dirtyRegionTracker.get();
+        if (!dirtyRegionTracker)
+            return bufferRegion;
+
+        // frame profiler is drawn over whole framebuffer and scissor test would also apply to render targets
+        Bool canRedrawPartially = !displayBufferInfo.needsRerender && !(*m_frameProfileRenderer.get(displayHandle))->isEnabled();
+        for (const auto& sceneInfo : displayBufferInfo.mappedScenes)
+        {
+            if (sceneInfo.shown)
+                canRedrawPartially &= !DirtyRegionTracker::RendersIntoOffscreenTargets(m_rendererScenes.getScene(sceneInfo.sceneId));
+        }
+
+        const Quad frameRegion = canRedrawPartially ? displayBufferInfo.partialRerenderRegion : bufferRegion;
+        const UInt32 bufferAge = displayInfo.displayController->getRenderBackend().getSurface().getContext().getBufferAge();
+        const Quad regionToRedraw = dirtyRegionTracker->getRegionToRedraw(frameRegion, bufferAge, bufferRegion);
+        dirtyRegionTracker->frameRendered(frameRegion);
+
+        return regionToRedraw;
+    }
+
     void Renderer::renderToOffscreenBuffers(DisplayHandle displayHandle, DisplayHandle& activeDisplay)
     {
         auto& displayInfo = m_displays.find(displayHandle)->second;
@@ -377,7 +434,7 @@ namespace ramses_internal
                 if (sceneInfo.shown)
                 {
                     const RendererCachedScene& scene = m_rendererScenes.getScene(sceneInfo.sceneId);
-                    display.renderScene(scene, displayBuffer, displayBufferInfo.viewport);
+                    renderSceneToBuffer(display, scene, displayBuffer, displayBufferInfo.viewport);
                     onSceneWasRendered(scene);
                     m_tempScenesRendered.push_back(sceneInfo.sceneId);
                 }
@@ -492,6 +549,9 @@ namespace ramses_internal
         m_profilerStatistics.endRegion(FrameProfilerStatistics::ERegion::HandleDisplayEvents);
 
         m_profilerStatistics.startRegion(FrameProfilerStatistics::ERegion::DrawScenes);
+        if (m_commandRecorder)
+            recordScenesInParallel();
+
         // FRAMEBUFFER AND OFFSCREEN BUFFERS
         for (auto displayHandle : m_tempDisplaysToRender)
         {
@@ -539,11 +599,63 @@ namespace ramses_internal
         LOG_TRACE(CONTEXT_PROFILING, "Renderer::doOneRenderLoop end");
     }
 
+    void Renderer::recordScenesInParallel()
+    {
+        // collects same scenes as rendered to framebuffers and non-interruptible offscreen buffers in this frame,
+        // interruptible offscreen buffers are rendered within time budget and are therefore always rendered directly
+        m_commandRecorder->reset();
+        for (auto displayHandle : m_tempDisplaysToRender)
+        {
+            const auto& displayInfo = m_displays.find(displayHandle)->second;
+            if (!displayInfo.supportsCommandRecording)
+                continue;
+
+            const IDisplayController& display = *displayInfo.displayController;
+            for (const auto displayBuffer : displayInfo.buffersSetup.getNonInterruptibleOffscreenBuffersToRender())
+                addScenesToRecord(display, displayInfo.buffersSetup.getDisplayBuffer(displayBuffer), displayBuffer, displayInfo.instancedDrawBatching);
+
+            const DisplayBufferInfo& frameBufferInfo = displayInfo.buffersSetup.getDisplayBuffer(displayInfo.frameBufferDeviceHandle);
+            if (frameBufferInfo.needsRerender || !frameBufferInfo.partialRerenderRegion.isEmpty())
+                addScenesToRecord(display, frameBufferInfo, displayInfo.frameBufferDeviceHandle, displayInfo.instancedDrawBatching);
+        }
+
+        // recording single scene would only add overhead compared to rendering it directly
+        if (m_commandRecorder->getSceneCount() > 1u)
+            m_commandRecorder->recordScenes();
+        else
+            m_commandRecorder->reset();
+    }
+
+    void Renderer::addScenesToRecord(const IDisplayController& display, const DisplayBufferInfo& displayBufferInfo, DeviceResourceHandle buffer, Bool instancedDrawBatching)
+    {
+        // same frame buffer info and view as used by display controller when rendering scene directly
+        const FrameBufferInfo frameBuffer(buffer, display.getProjectionParams(), displayBufferInfo.viewport);
+        for (const auto& sceneInfo : displayBufferInfo.mappedScenes)
+        {
+            if (sceneInfo.shown)
+                m_commandRecorder->addScene(m_rendererScenes.getScene(sceneInfo.sceneId), frameBuffer, display.getViewMatrix(), instancedDrawBatching);
+        }
+    }
+
+    void Renderer::renderSceneToBuffer(IDisplayController& display, const RendererCachedScene& scene, DeviceResourceHandle buffer, const Viewport& viewport)
+    {
+        const RenderCommandList* recordedCommands = m_commandRecorder ? m_commandRecorder->getRecordedCommands(scene.getSceneId()) : nullptr;
+        if (recordedCommands)
+            recordedCommands->replay(display.getRenderBackend().getDevice());
+        else
+            display.renderScene(scene, buffer, viewport);
+    }
+
     void Renderer::onSceneWasRendered(const RendererCachedScene& scene)
     {
         scene.markAllRenderOncePassesAsRendered();
         m_expirationMonitor.onRendered(scene.getSceneId());
         m_statistics.sceneRendered(scene.getSceneId());
+
+        scene.collectRenderPassBatching(m_tempRenderPassBatching);
+        for (const auto& batching : m_tempRenderPassBatching)
+            m_statistics.renderPassBatched(scene.getSceneId(), batching.pass, batching.numRenderables, batching.numDrawCalls);
+        m_statistics.uniformsSkipped(scene.getSceneId(), scene.collectSkippedUniforms());
     }
 
     void Renderer::ActivateDisplayContext(DisplayHandle displayToActivate, DisplayHandle& activeDisplay, IDisplayController& dispController)
@@ -598,6 +710,8 @@ namespace ramses_internal
         assert(displayHandle.isValid());
         auto& displayInfo = m_displays.find(displayHandle)->second;
         displayInfo.buffersSetup.unmapScene(sceneId);
+        if (displayInfo.dirtyRegionTracker)
+            displayInfo.dirtyRegionTracker->untrackScene(sceneId);
     }
 
     void Renderer::setSceneShown(SceneId sceneId, Bool show)
@@ -621,11 +735,36 @@ namespace ramses_internal
         displayInfo.buffersSetup.setDisplayBufferToBeRerendered(displayBuffer, true);
     }
 
+    void Renderer::markBufferWithMappedSceneAsModified(SceneId sceneId, const IRendererResourceManager& resourceManager)
+    {
+        DisplayHandle displayHandle;
+        const auto displayBuffer = getBufferSceneIsMappedTo(sceneId, &displayHandle);
+        assert(displayHandle.isValid());
+        assert(displayBuffer.isValid());
+        auto& displayInfo = m_displays.find(displayHandle)->second;
+        if (!displayInfo.dirtyRegionTracker || displayBuffer != displayInfo.frameBufferDeviceHandle)
+        {
+            displayInfo.buffersSetup.setDisplayBufferToBeRerendered(displayBuffer, true);
+            return;
+        }
+
+        const IDisplayController& display = *displayInfo.displayController;
+        const Viewport& viewport = displayInfo.buffersSetup.getDisplayBuffer(displayBuffer).viewport;
+        const Quad bufferRegion(viewport.posX, viewport.posY, viewport.width, viewport.height);
+        const Quad dirtyRegion = displayInfo.dirtyRegionTracker->updateSceneAndGetDirtyRegion(m_rendererScenes.getScene(sceneId), resourceManager, bufferRegion, display.getViewMatrix(), display.getProjectionParams());
+        displayInfo.buffersSetup.addDisplayBufferRegionToBeRerendered(displayBuffer, dirtyRegion);
+    }
+
     void Renderer::setSkippingOfUnmodifiedBuffers(Bool enable)
     {
         m_skipUnmodifiedBuffers = enable;
     }
 
+    void Renderer::setParallelCommandRecording(UInt16 workerThreadCount)
+    {
+        m_commandRecorder.reset(workerThreadCount > 0u ? new ParallelRenderCommandRecorder(workerThreadCount) : nullptr);
+    }
+
     DisplayHandle Renderer::getDisplaySceneIsMappedTo(SceneId sceneId) const
     {
         DisplayHandle display;
@@ -738,6 +877,7 @@ namespace ramses_internal
 
         const ProjectionParams& params = config.getProjectionParams();
         displayController->setProjectionParams(params);
+        displayController->setInstancedDrawBatchingEnabled(config.isInstancedDrawBatchingEnabled());
 
         return displayController;
     }
@@ -216,6 +216,29 @@ namespace ramses_internal
         return m_renderableMatrices[renderable.asMemoryHandle()];
     }
 
+    void RendererCachedScene::reportRenderPassBatching(RenderPassHandle pass, UInt32 numRenderables, UInt32 numDrawCalls) const
+    {
+        m_renderPassBatchingResults.push_back({ pass, numRenderables, numDrawCalls });
+    }
+
+    void RendererCachedScene::collectRenderPassBatching(RenderPassBatchingResults& resultsOut) const
+    {
+        resultsOut.clear();
+        resultsOut.swap(m_renderPassBatchingResults);
+    }
+
+    void RendererCachedScene::reportSkippedUniforms(UInt32 numSkippedUniforms) const
+    {
+        m_skippedUniforms += numSkippedUniforms;
+    }
+
+    UInt32 RendererCachedScene::collectSkippedUniforms() const
+    {
+        const UInt32 numSkippedUniforms = m_skippedUniforms;
+        m_skippedUniforms = 0u;
+        return numSkippedUniforms;
+    }
+
     void RendererCachedScene::updateRenderablesInPass(RenderPassHandle passHandle)
     {
         RenderableVector& orderedRenderables = m_passRenderableOrder[passHandle.asMemoryHandle()];
@@ -51,6 +51,16 @@ namespace ramses_internal
         return m_kpiFilename;
     }
 
+    void RendererConfig::setSceneFlushRecordingFileName(const String& filename)
+    {
+        m_sceneFlushRecordingFilename = filename;
+    }
+
+    const String& RendererConfig::getSceneFlushRecordingFileName() const
+    {
+        return m_sceneFlushRecordingFilename;
+    }
+
     void RendererConfig::enableSystemCompositorControl()
     {
         m_systemCompositorEnabled = true;
@@ -71,6 +81,16 @@ namespace ramses_internal
         m_frameCallbackMaxPollTime = pollTime;
     }
 
+    UInt32 RendererConfig::getParallelCommandRecordingThreadCount() const
+    {
+        return m_parallelCommandRecordingThreadCount;
+    }
+
+    void RendererConfig::setParallelCommandRecordingThreadCount(UInt32 threadCount)
+    {
+        m_parallelCommandRecordingThreadCount = threadCount;
+    }
+
     void RendererConfig::setWaylandDisplayForSystemCompositorController(const String& wd)
     {
         m_waylandDisplayForSystemCompositorController = wd;
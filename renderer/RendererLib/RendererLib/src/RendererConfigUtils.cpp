@@ -24,6 +24,8 @@ namespace ramses_internal
             , waylandSocketEmbeddedGroup("wsegn"        , "wayland-socket-embedded-groupname" , config.getWaylandSocketEmbeddedGroup(), "groupname for permissions of embedded compositing socket")
             , systemCompositorControllerEnabled("scc"   , "enable-system-compositor-controller", false                      , "enable system compositor controller")
             , kpiFilename               ("kpi"          , "kpioutputfile"           , config.getKPIFileName()               , "KPI filename")
+            , flushRecordingFilename    ("rec"          , "record-scene-flushes"    , config.getSceneFlushRecordingFileName(), "record received scenes, flushes and resources to file for replay")
+            , commandRecordingThreads   ("pcr"          , "parallel-command-recording-threads", config.getParallelCommandRecordingThreadCount(), "number of worker threads recording render commands of scenes in parallel (0 renders scenes sequentially)")
         {
         }
 
@@ -31,6 +33,8 @@ namespace ramses_internal
         ArgumentString waylandSocketEmbeddedGroup;
         ArgumentBool   systemCompositorControllerEnabled;
         ArgumentString kpiFilename;
+        ArgumentString flushRecordingFilename;
+        ArgumentUInt32 commandRecordingThreads;
 
         void print()
         {
@@ -40,6 +44,8 @@ namespace ramses_internal
                         sos << waylandSocketEmbedded.getHelpString();
                         sos << waylandSocketEmbeddedGroup.getHelpString();
                         sos << kpiFilename.getHelpString();
+                        sos << flushRecordingFilename.getHelpString();
+                        sos << commandRecordingThreads.getHelpString();
                         sos << systemCompositorControllerEnabled.getHelpString();
                     }));
 
@@ -71,6 +77,8 @@ namespace ramses_internal
             , borderless("bl", "borderless", config.getBorderlessState(), "disable window borders")
             , enableWarping("warp", "enable-warping", config.isWarpingEnabled(), "enable warping")
             , disableEffectDeletion("ded", "no-effect-delete", config.isEffectDeletionDisabled(), "disable effect deletion")
+            , partialRedraw("pr", "partial-redraw", config.isPartialRedrawEnabled(), "redraw only changed regions of framebuffer (assumes vertex shaders do not move vertices outside of their model-view-projection transformed bounds)")
+            , instancedDrawBatching("idb", "instanced-draw-batching", config.isInstancedDrawBatchingEnabled(), "draw consecutive meshes differing only in world matrix with single instanced draw call (effects must use instance world matrix attribute semantic)")
             , antialiasingMethod("aa", "antialiasing-method", "", "set antialiasing method (options: MSAA,  FXAA)")
             , antialiasingSampleCount("as", "aa-samples", config.getAntialiasingSampleCount(), "set antialiasing sample count")
             , waylandIviLayerId("lid", "waylandIviLayerId", config.getWaylandIviLayerID().getValue(), "set id of IVI layer the display surface will be added to")
@@ -109,6 +117,8 @@ namespace ramses_internal
 
         ArgumentBool enableWarping;
         ArgumentBool disableEffectDeletion;
+        ArgumentBool partialRedraw;
+        ArgumentBool instancedDrawBatching;
         ArgumentString antialiasingMethod;
         ArgumentUInt32 antialiasingSampleCount;
         ArgumentUInt32 waylandIviLayerId;
@@ -161,6 +171,8 @@ namespace ramses_internal
                         {
                             sos << enableWarping.getHelpString();
                             sos << disableEffectDeletion.getHelpString();
+                            sos << partialRedraw.getHelpString();
+                            sos << instancedDrawBatching.getHelpString();
                             sos << antialiasingMethod.getHelpString();
                             sos << antialiasingSampleCount.getHelpString();
                         }
@@ -174,6 +186,8 @@ namespace ramses_internal
         config.setWaylandSocketEmbedded(rendererArgs.waylandSocketEmbedded.parseValueFromCmdLine(parser));
         config.setWaylandSocketEmbeddedGroup(rendererArgs.waylandSocketEmbeddedGroup.parseValueFromCmdLine(parser));
         config.setKPIFileName(rendererArgs.kpiFilename.parseValueFromCmdLine(parser));
+        config.setSceneFlushRecordingFileName(rendererArgs.flushRecordingFilename.parseValueFromCmdLine(parser));
+        config.setParallelCommandRecordingThreadCount(rendererArgs.commandRecordingThreads.parseValueFromCmdLine(parser));
 
         if(rendererArgs.systemCompositorControllerEnabled.parseValueFromCmdLine(parser))
         {
@@ -189,6 +203,8 @@ namespace ramses_internal
         config.setBorderlessState(rendererArgs.borderless.parseValueFromCmdLine(parser));
         config.setWarpingEnabled(rendererArgs.enableWarping.parseValueFromCmdLine(parser));
         config.setEffectDeletionDisabled(rendererArgs.disableEffectDeletion.parseValueFromCmdLine(parser));
+        config.setPartialRedrawEnabled(rendererArgs.partialRedraw.parseValueFromCmdLine(parser));
+        config.setInstancedDrawBatchingEnabled(rendererArgs.instancedDrawBatching.parseValueFromCmdLine(parser));
         config.setDesiredWindowWidth(rendererArgs.windowWidth.parseValueFromCmdLine(parser));
         config.setDesiredWindowHeight(rendererArgs.windowHeight.parseValueFromCmdLine(parser));
         config.setWindowPositionX(rendererArgs.windowPositionX.parseValueFromCmdLine(parser));
@@ -23,6 +23,7 @@
 #include "Utils/LogMacros.h"
 #include "Utils/TextureMathUtils.h"
 #include "Math3d/Vector4.h"
+#include <algorithm>
 
 namespace ramses_internal
 {
@@ -35,13 +36,17 @@ namespace ramses_internal
         Bool keepEffects,
         const FrameTimer& frameTimer,
         RendererStatistics& stats,
-        UInt64 clientResourceCacheSize)
+        UInt64 clientResourceCacheSize,
+        Bool computeVertexArrayBounds,
+        UInt64 prefetchedClientResourcesSizeLimit)
         : m_id(requesterId)
         , m_resourceProvider(resourceProvider)
         , m_renderBackend(renderBackend)
         , m_embeddedCompositingManager(embeddedCompositingManager)
-        , m_resourceUploadingManager(m_clientResourceRegistry, uploader, renderBackend, keepEffects, frameTimer, stats, clientResourceCacheSize)
+        , m_resourceUploadingManager(m_clientResourceRegistry, uploader, renderBackend, keepEffects, frameTimer, stats, clientResourceCacheSize, computeVertexArrayBounds)
         , m_stats(stats)
+        , m_prefetchedClientResourcesSizeLimit(prefetchedClientResourcesSizeLimit)
+        , m_frameTimer(frameTimer)
     {
     }
 
@@ -50,10 +55,9 @@ namespace ramses_internal
         assert(m_sceneResourceRegistryMap.count() == 0u);
 
         LOG_TRACE(CONTEXT_RENDERER, "RendererResourceManager[" << m_id << "]::~RendererResourceManager Destroying offscreen buffers");
-        for (OffscreenBufferHandle handle(0u); handle < m_offscreenBuffers.getTotalCount(); ++handle)
+        for (const auto handle : m_offscreenBuffers)
         {
-            if (m_offscreenBuffers.isAllocated(handle))
-                unloadOffscreenBuffer(handle);
+            unloadOffscreenBuffer(handle);
         }
 
         for(const auto& resDesc : m_clientResourceRegistry.getAllResourceDescriptors())
@@ -61,6 +65,14 @@ namespace ramses_internal
             UNUSED(resDesc);
             assert(resDesc.value.sceneUsage.empty());
         }
+
+        for (const auto& prefetchedResource : m_prefetchedClientResources)
+        {
+            if (prefetchedResource.value.resource.getResourceObject() == nullptr)
+            {
+                m_resourceProvider.cancelResourceRequest(prefetchedResource.key, m_id);
+            }
+        }
     }
 
     const RequesterID& RendererResourceManager::getRequesterID() const
@@ -140,6 +152,12 @@ namespace ramses_internal
 
         for (auto res : resourcesToBeRequested)
         {
+            // prefetched resources are taken over in requestAndUnrequestPendingClientResources
+            if (m_prefetchedClientResources.contains(res))
+            {
+                continue;
+            }
+
             UInt32 resourceSize = 0;
             if (cache->hasResource(res, resourceSize))
             {
@@ -183,9 +201,31 @@ namespace ramses_internal
             }
         }
 
-        // add newly registered resources
-        const ResourceContentHashVector& registeredResources = m_clientResourceRegistry.getAllRegisteredResources();
-        resourcesToBeRequested.insert(resourcesToBeRequested.end(), registeredResources.begin(), registeredResources.end());
+        // add newly registered resources, unless they were prefetched
+        const ResourceContentHashVector registeredResources = m_clientResourceRegistry.getAllRegisteredResources();
+        for (const auto& hash : registeredResources)
+        {
+            const PrefetchedClientResource* prefetchedResource = m_prefetchedClientResources.get(hash);
+            if (prefetchedResource == nullptr)
+            {
+                resourcesToBeRequested.push_back(hash);
+                continue;
+            }
+
+            // Mimic the same state changes as if the resource had been requested and received over network.
+            // If the prefetched resource did not arrive yet it stays requested and is processed as any other requested resource once it arrives.
+            m_clientResourceRegistry.setResourceStatus(hash, EResourceStatus_Requested, m_frameCounter);
+            const ManagedResource& resource = prefetchedResource->resource;
+            if (resource.getResourceObject() != nullptr)
+            {
+                m_clientResourceRegistry.setResourceData(hash, resource, DeviceResourceHandle::Invalid(), resource.getResourceObject()->getTypeID());
+                m_clientResourceRegistry.setResourceStatus(hash, EResourceStatus_Provided);
+                // prefetch was useful only if it saved waiting for the resource
+                m_stats.prefetchedClientResourceUsed(prefetchedResource->sceneId);
+            }
+            removePrefetchedClientResource(hash);
+        }
+
         if (!resourcesToBeRequested.empty())
         {
             requestResourcesFromProvider(resourcesToBeRequested);
@@ -220,6 +260,13 @@ namespace ramses_internal
         {
             RendererSceneResourceRegistry& sceneResources = *m_sceneResourceRegistryMap.get(sceneId);
 
+            VertexArrayKeyVector vertexArrays;
+            sceneResources.getAllVertexArrays(vertexArrays);
+            for (const auto& va : vertexArrays)
+            {
+                unloadVertexArray(va.first, va.second, sceneId);
+            }
+
             RenderBufferHandleVector renderBuffers;
             sceneResources.getAllRenderBuffers(renderBuffers);
             for(const auto& rb : renderBuffers)
@@ -321,18 +368,32 @@ namespace ramses_internal
                              "; numberWrongStatus: " << m_numberOfArrivedResourcesInWrongStatus << "; sumSizeWrongStatus: " << m_sizeOfArrivedResourcesInWrongStatus);
                 }
             }
-            else
+            else if (m_prefetchedClientResources.contains(resHash))
             {
-                // This can be useful for resource prefetching when client sends them ahead of scene.
-                // Slight conceptual change would be required that would allow to manage a resource
-                // without being used by any scene. If the resource is never actually used, it will become
-                // a zombie that is only released at destruction time.
+                PrefetchedClientResource& prefetchedResource = *m_prefetchedClientResources.get(resHash);
+                if (prefetchedResource.resource.getResourceObject() == nullptr)
+                {
+                    // decompression is deferred to decompressPrefetchedClientResources, where it is limited by time budget
+                    prefetchedResource.resource = current;
+                    m_arrivedPrefetchedClientResources.push_back(resHash);
+                    m_arrivedPrefetchedClientResourcesSize += resourceObject->getDecompressedDataSize();
+                    m_stats.clientResourcePrefetched(prefetchedResource.sceneId, resourceObject->getDecompressedDataSize());
 
-                // This indicates error - resource either arrived before the scene itself (or was prefetches)
+                    if (cache)
+                    {
+                        RendererResourceManagerUtils::StoreResource(cache, resourceObject, prefetchedResource.sceneId);
+                    }
+                }
+            }
+            else
+            {
+                // This indicates error - resource either arrived before the scene itself
                 // OR resource was unrequested, but still arrived from network
                 LOG_ERROR(CONTEXT_RENDERER, "RendererResourceManager[" << m_id << "]::checkForArrivedResources Descriptor for arrived resource " << StringUtils::HexFromResourceContentHash(resHash) << " does not exist");
             }
         }
+
+        evictPrefetchedClientResourcesAboveSizeLimit();
     }
 
     Bool RendererResourceManager::hasClientResourcesToBeUploaded() const
@@ -345,6 +406,95 @@ namespace ramses_internal
         m_resourceUploadingManager.uploadAndUnloadPendingResources();
     }
 
+    void RendererResourceManager::collectScenesUsingUpdatedClientResources(HashSet<SceneId>& scenesOut)
+    {
+        m_resourceUploadingManager.collectScenesUsingUpdatedResources(scenesOut);
+    }
+
+    void RendererResourceManager::setClientResourceUploadPriorityScenes(const SceneIdVector& sceneIds)
+    {
+        m_resourceUploadingManager.setPriorityScenes(sceneIds);
+    }
+
+    void RendererResourceManager::prefetchClientResources(SceneId sceneId, const ResourceContentHashVector& resources)
+    {
+        ResourceContentHashVector resourcesToBeRequested;
+        for (const auto& resHash : resources)
+        {
+            // resource already managed for any scene is requested or provided anyway
+            if (!m_clientResourceRegistry.containsResource(resHash) && !m_prefetchedClientResources.contains(resHash))
+            {
+                m_prefetchedClientResources.put(resHash, { sceneId, ManagedResource() });
+                resourcesToBeRequested.push_back(resHash);
+            }
+        }
+
+        if (!resourcesToBeRequested.empty())
+        {
+            LOG_TRACE(CONTEXT_RENDERER, "RendererResourceManager[" << m_id << "]::prefetchClientResources Requesting " << resourcesToBeRequested.size() << " resources prefetched by scene " << sceneId.getValue());
+            m_resourceProvider.requestResourceAsyncronouslyFromFramework(resourcesToBeRequested, m_id, sceneId);
+        }
+    }
+
+    void RendererResourceManager::releasePrefetchedClientResources(SceneId sceneId)
+    {
+        ResourceContentHashVector resourcesToBeReleased;
+        for (const auto& prefetchedResource : m_prefetchedClientResources)
+        {
+            if (prefetchedResource.value.sceneId == sceneId)
+            {
+                resourcesToBeReleased.push_back(prefetchedResource.key);
+            }
+        }
+
+        for (const auto& resHash : resourcesToBeReleased)
+        {
+            if (m_prefetchedClientResources.get(resHash)->resource.getResourceObject() == nullptr)
+            {
+                m_resourceProvider.cancelResourceRequest(resHash, m_id);
+            }
+            removePrefetchedClientResource(resHash);
+        }
+    }
+
+    void RendererResourceManager::decompressPrefetchedClientResources()
+    {
+        for (const auto& resHash : m_arrivedPrefetchedClientResources)
+        {
+            if (m_frameTimer.isTimeBudgetExceededForSection(EFrameTimerSectionBudget::ClientResourcesUpload))
+            {
+                return;
+            }
+
+            const IResource* resourceObject = m_prefetchedClientResources.get(resHash)->resource.getResourceObject();
+            if (!resourceObject->isDeCompressedAvailable())
+            {
+                resourceObject->decompress();
+            }
+        }
+    }
+
+    void RendererResourceManager::removePrefetchedClientResource(const ResourceContentHash& hash)
+    {
+        const IResource* resourceObject = m_prefetchedClientResources.get(hash)->resource.getResourceObject();
+        if (resourceObject != nullptr)
+        {
+            m_arrivedPrefetchedClientResources.erase(std::find(m_arrivedPrefetchedClientResources.begin(), m_arrivedPrefetchedClientResources.end(), hash));
+            m_arrivedPrefetchedClientResourcesSize -= resourceObject->getDecompressedDataSize();
+        }
+        m_prefetchedClientResources.remove(hash);
+    }
+
+    void RendererResourceManager::evictPrefetchedClientResourcesAboveSizeLimit()
+    {
+        while (m_arrivedPrefetchedClientResourcesSize > m_prefetchedClientResourcesSizeLimit)
+        {
+            const ResourceContentHash oldestResource = m_arrivedPrefetchedClientResources.front();
+            LOG_TRACE(CONTEXT_RENDERER, "RendererResourceManager[" << m_id << "]::evictPrefetchedClientResourcesAboveSizeLimit Evicting prefetched resource #" << StringUtils::HexFromResourceContentHash(oldestResource) << " not used by any scene");
+            removePrefetchedClientResource(oldestResource);
+        }
+    }
+
     EResourceStatus RendererResourceManager::getClientResourceStatus(const ResourceContentHash& hash) const
     {
         return m_clientResourceRegistry.getResourceStatus(hash);
@@ -355,6 +505,11 @@ namespace ramses_internal
         return m_clientResourceRegistry.getResourceDescriptor(hash).type;
     }
 
+    Bool RendererResourceManager::getClientResourceVertexBounds(const ResourceContentHash& hash, Vector3& minOut, Vector3& maxOut) const
+    {
+        return m_resourceUploadingManager.getVertexArrayBounds(hash, minOut, maxOut);
+    }
+
     DeviceResourceHandle RendererResourceManager::getClientResourceDeviceHandle(const ResourceContentHash& hash) const
     {
         return m_clientResourceRegistry.getResourceDescriptor(hash).deviceHandle;
@@ -398,9 +553,9 @@ namespace ramses_internal
 
     OffscreenBufferHandle RendererResourceManager::getOffscreenBufferHandle(DeviceResourceHandle bufferDeviceHandle) const
     {
-        for (OffscreenBufferHandle handle(0u); handle < m_offscreenBuffers.getTotalCount(); ++handle)
+        for (const auto handle : m_offscreenBuffers)
         {
-            if (m_offscreenBuffers.isAllocated(handle) && m_offscreenBuffers.getMemory(handle)->m_renderTargetHandle[0] == bufferDeviceHandle)
+            if (m_offscreenBuffers.getMemory(handle)->m_renderTargetHandle[0] == bufferDeviceHandle)
                 return handle;
         }
 
@@ -769,4 +924,39 @@ namespace ramses_internal
 
         return sceneResources.getTextureSamplerDeviceHandle(handle);
     }
+
+    void RendererResourceManager::uploadVertexArray(DataInstanceHandle geometryInstance, const VertexArrayInfo& vertexArrayInfo, SceneId sceneId)
+    {
+        assert(geometryInstance.isValid());
+        RendererSceneResourceRegistry& sceneResources = getSceneResourceRegistry(sceneId);
+
+        IDevice& device = m_renderBackend.getDevice();
+        const DeviceResourceHandle deviceHandle = device.allocateVertexArray(vertexArrayInfo);
+        assert(deviceHandle.isValid());
+
+        sceneResources.addVertexArray(geometryInstance, vertexArrayInfo.shader, deviceHandle);
+    }
+
+    void RendererResourceManager::unloadVertexArray(DataInstanceHandle geometryInstance, DeviceResourceHandle shader, SceneId sceneId)
+    {
+        assert(geometryInstance.isValid());
+        assert(m_sceneResourceRegistryMap.contains(sceneId));
+        RendererSceneResourceRegistry& sceneResources = *m_sceneResourceRegistryMap.get(sceneId);
+
+        const DeviceResourceHandle deviceHandle = sceneResources.getVertexArrayDeviceHandle(geometryInstance, shader);
+        assert(deviceHandle.isValid());
+
+        IDevice& device = m_renderBackend.getDevice();
+        device.deleteVertexArray(deviceHandle);
+        sceneResources.removeVertexArray(geometryInstance, shader);
+    }
+
+    DeviceResourceHandle RendererResourceManager::getVertexArrayDeviceHandle(DataInstanceHandle geometryInstance, DeviceResourceHandle shader, SceneId sceneId) const
+    {
+        assert(geometryInstance.isValid());
+        assert(m_sceneResourceRegistryMap.contains(sceneId));
+        const RendererSceneResourceRegistry& sceneResources = *m_sceneResourceRegistryMap.get(sceneId);
+
+        return sceneResources.getVertexArrayDeviceHandle(geometryInstance, shader);
+    }
 }
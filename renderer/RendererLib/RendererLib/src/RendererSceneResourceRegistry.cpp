@@ -236,6 +236,37 @@ namespace ramses_internal
         }
     }
 
+    void RendererSceneResourceRegistry::addVertexArray(DataInstanceHandle geometryInstance, DeviceResourceHandle shader, DeviceResourceHandle deviceHandle)
+    {
+        const VertexArrayKey key(geometryInstance, shader);
+        assert(!m_vertexArrays.contains(key));
+        m_vertexArrays.put(key, { deviceHandle });
+    }
+
+    void RendererSceneResourceRegistry::removeVertexArray(DataInstanceHandle geometryInstance, DeviceResourceHandle shader)
+    {
+        const VertexArrayKey key(geometryInstance, shader);
+        assert(m_vertexArrays.contains(key));
+        m_vertexArrays.remove(key);
+    }
+
+    DeviceResourceHandle RendererSceneResourceRegistry::getVertexArrayDeviceHandle(DataInstanceHandle geometryInstance, DeviceResourceHandle shader) const
+    {
+        const VertexArrayKey key(geometryInstance, shader);
+        assert(m_vertexArrays.contains(key));
+        return m_vertexArrays.get(key)->deviceHandle;
+    }
+
+    void RendererSceneResourceRegistry::getAllVertexArrays(VertexArrayKeyVector& vertexArrays) const
+    {
+        assert(vertexArrays.empty());
+        vertexArrays.reserve(m_vertexArrays.count());
+        for (const auto& va : m_vertexArrays)
+        {
+            vertexArrays.push_back(va.key);
+        }
+    }
+
     UInt32 RendererSceneResourceRegistry::getSceneResourceMemoryUsage(ESceneResourceType resourceType) const
     {
         UInt32 result = 0;
@@ -33,6 +33,7 @@
 #include "Components/FlushTimeInformation.h"
 #include "Utils/LogMacros.h"
 #include "PlatformAbstraction/PlatformTime.h"
+#include <algorithm>
 
 namespace ramses_internal
 {
@@ -44,7 +45,7 @@ namespace ramses_internal
         , m_frameTimer(frameTimer)
         , m_expirationMonitor(expirationMonitor)
         , m_rendererResourceCache(rendererResourceCache)
-        , m_animationSystemFactory(EAnimationSystemOwner_Renderer)
+        , m_animationSystemFactory(EAnimationSystemOwner_Renderer, NULL, this)
     {
     }
 
@@ -115,8 +116,9 @@ namespace ramses_internal
             IRenderBackend& renderBackend = displayController.getRenderBackend();
             IEmbeddedCompositingManager& embeddedCompositingManager = displayController.getEmbeddedCompositingManager();
 
-            // ownership of uploadStrategy is transferred into RendererResourceManager
-            RendererResourceManager* resourceManager = new RendererResourceManager(resourceProvider, resourceUploader, renderBackend, embeddedCompositingManager, RequesterID(handle.asMemoryHandle()), displayConfig.isEffectDeletionDisabled(), m_frameTimer, m_renderer.getStatistics(), displayConfig.getGPUMemoryCacheSize());
+            // ownership of uploadStrategy is transferred into RendererResourceManager,
+            // vertex bounds are only needed for screen bounds of renderables when redrawing changed regions
+            RendererResourceManager* resourceManager = new RendererResourceManager(resourceProvider, resourceUploader, renderBackend, embeddedCompositingManager, RequesterID(handle.asMemoryHandle()), displayConfig.isEffectDeletionDisabled(), m_frameTimer, m_renderer.getStatistics(), displayConfig.getGPUMemoryCacheSize(), m_renderer.isPartialRedrawUsed(handle));
             m_displayResourceManagers.put(handle, resourceManager);
             m_rendererEventCollector.addEvent(ERendererEventType_DisplayCreated, handle);
 
@@ -235,7 +237,7 @@ namespace ramses_internal
         {
             LOG_TRACE(CONTEXT_PROFILING, "    RendererSceneUpdater::updateScenes update scenes resource cache");
             FRAME_PROFILER_REGION(FrameProfilerStatistics::ERegion::UpdateResourceCache);
-            updateScenesResourceCache();
+            updateScenesResourceCache(activeDisplay);
         }
 
         {
@@ -259,7 +261,11 @@ namespace ramses_internal
         for (const auto scene : m_modifiedScenesToRerender)
         {
             if (m_sceneStateExecutor.getSceneState(scene) == ESceneState_Rendered)
-                m_renderer.markBufferWithMappedSceneAsModified(scene);
+            {
+                const DisplayHandle displayHandle = m_renderer.getDisplaySceneIsMappedTo(scene);
+                assert(displayHandle.isValid());
+                m_renderer.markBufferWithMappedSceneAsModified(scene, **m_displayResourceManagers.get(displayHandle));
+            }
         }
     }
 
@@ -353,6 +359,11 @@ namespace ramses_internal
         ResourceContentHashVector newlyNeededClientResources;
         consolidateResourceChanges(flushInfo, pendingFlushes, resourceChanges, newlyNeededClientResources);
 
+        if (!resourceChanges.m_prefetchedClientResources.empty())
+        {
+            prefetchClientResources(sceneID, resourceChanges.m_prefetchedClientResources);
+        }
+
         // add references to newly needed client resources right away
         if (!newlyNeededClientResources.empty())
         {
@@ -396,6 +407,25 @@ namespace ramses_internal
         flushInfo.sceneResourceActions = PendingSceneResourcesUtils::ConsolidateSceneResourceActions(resourceChanges.m_sceneResourceActions, pendingSceneResources);
     }
 
+    void RendererSceneUpdater::prefetchClientResources(SceneId sceneId, const ResourceContentHashVector& resources)
+    {
+        // resources are prefetched to display the scene is mapped (or being mapped) to,
+        // if scene is not assigned to any display yet they are prefetched to all displays
+        DisplayHandle displayHandle = m_renderer.getDisplaySceneIsMappedTo(sceneId);
+        if (!displayHandle.isValid() && m_scenesToBeMapped.contains(sceneId))
+        {
+            displayHandle = m_scenesToBeMapped.get(sceneId)->display;
+        }
+
+        for (const auto& it : m_displayResourceManagers)
+        {
+            if (!displayHandle.isValid() || it.key == displayHandle)
+            {
+                it.value->prefetchClientResources(sceneId, resources);
+            }
+        }
+    }
+
     void RendererSceneUpdater::requestAndUploadAndUnloadResources(DisplayHandle& activeDisplay)
     {
         // request newly referenced resources
@@ -411,9 +441,22 @@ namespace ramses_internal
 
             if (resourceManager.hasClientResourcesToBeUploaded())
             {
+                // resources of scenes waiting for them to get mapped are uploaded first, to minimize time to first frame of those scenes
+                m_scenesMappingAndUploadingCache.clear();
+                for (const auto& mapRequest : m_scenesToBeMapped)
+                {
+                    if (mapRequest.value.display == displayHandle && m_sceneStateExecutor.getSceneState(mapRequest.key) == ESceneState_MappingAndUploading)
+                        m_scenesMappingAndUploadingCache.push_back(mapRequest.key);
+                }
+                resourceManager.setClientResourceUploadPriorityScenes(m_scenesMappingAndUploadingCache);
+
                 activateDisplayContext(activeDisplay, displayHandle);
                 resourceManager.uploadAndUnloadPendingClientResources();
+                resourceManager.collectScenesUsingUpdatedClientResources(m_modifiedScenesToRerender);
             }
+
+            // prefetched resources are prepared for upload only with time left after uploading resources already needed
+            resourceManager.decompressPrefetchedClientResources();
         }
     }
 
@@ -683,7 +726,7 @@ namespace ramses_internal
         }
     }
 
-    void RendererSceneUpdater::updateScenesResourceCache()
+    void RendererSceneUpdater::updateScenesResourceCache(DisplayHandle& activeDisplay)
     {
         // update renderer scenes renderables and resource cache
         for (const auto sceneIt : m_rendererScenes)
@@ -694,10 +737,16 @@ namespace ramses_internal
             {
                 const DisplayHandle displayHandle = m_renderer.getDisplaySceneIsMappedTo(sceneId);
                 assert(displayHandle.isValid());
-                const IRendererResourceManager& resourceManager = **m_displayResourceManagers.get(displayHandle);
+                IRendererResourceManager& resourceManager = **m_displayResourceManagers.get(displayHandle);
                 const IEmbeddedCompositingManager& embeddedCompositingManager = m_renderer.getDisplayController(displayHandle).getEmbeddedCompositingManager();
                 RendererCachedScene& rendererScene = *sceneIt.value.scene;
                 rendererScene.updateRenderablesAndResourceCache(resourceManager, embeddedCompositingManager);
+
+                if (rendererScene.hasDirtyVertexArrays())
+                {
+                    activateDisplayContext(activeDisplay, displayHandle);
+                }
+                rendererScene.updateVertexArrays(resourceManager, m_renderer.getStatistics());
             }
         }
     }
@@ -821,6 +870,7 @@ namespace ramses_internal
         SceneActionApplier::ResourceVector possiblePushResources;
         SceneActionApplier::ApplyActionRangeOnScene(scene, actionsForScene, flushInfo.sceneActionsIt, numActions, &m_animationSystemFactory, &possiblePushResources);
         flushInfo.sceneActionsIt = numActions;
+        registerActivatedAnimationSystems(scene.getSceneId());
 
         LOG_TRACE(CONTEXT_PROFILING, "    RendererSceneUpdater::applySceneActions finished applying scene actions for scene with id " << scene.getSceneId().getValue());
     }
@@ -843,6 +893,7 @@ namespace ramses_internal
             SceneActionApplier::ApplyActionRangeOnScene(scene, flushInfo.sceneActions, flushInfo.sceneActionsIt, chunkEnd, &m_animationSystemFactory, &possiblePushResources);
             flushInfo.sceneActionsIt = chunkEnd;
         }
+        registerActivatedAnimationSystems(scene.getSceneId());
 
         if (flushInfo.sceneActionsIt == sceneActionsCount)
         {
@@ -887,6 +938,11 @@ namespace ramses_internal
             m_scenesToBeShown.remove(sceneID);
         }
 
+        for (const auto& it : m_displayResourceManagers)
+        {
+            it.value->releasePrefetchedClientResources(sceneID);
+        }
+
         m_pendingSceneActions.erase(sceneID);
         m_expirationMonitor.stopMonitoringScene(sceneID);
     }
@@ -988,6 +1044,7 @@ namespace ramses_internal
             m_sceneStateExecutor.setMapRequested(sceneId, handle);
             assert(!m_scenesToBeMapped.contains(sceneId));
             m_scenesToBeMapped.put(sceneId, { handle, sceneRenderOrder });
+            m_renderer.getStatistics().sceneMapRequested(sceneId);
         }
     }
 
@@ -1282,28 +1339,51 @@ namespace ramses_internal
     {
         const UInt64 systemTime = PlatformTime::GetMillisecondsAbsolute();
 
-        for (const auto& scene : m_rendererScenes)
+        // collect first, animation systems deactivate themselves when setting time makes their last animation finish
+        m_animationSystemsToUpdate.clear();
+        for (const auto& activeAnimationSystem : m_activeRealTimeAnimationSystems)
         {
-            const SceneId sceneID = scene.key;
-            if (m_sceneStateExecutor.getSceneState(sceneID) == ESceneState_Rendered)
+            if (m_sceneStateExecutor.getSceneState(activeAnimationSystem.second) == ESceneState_Rendered)
             {
-                RendererCachedScene& renderScene = m_rendererScenes.getScene(sceneID);
-                for (auto handle = AnimationSystemHandle(0); handle < renderScene.getAnimationSystemCount(); ++handle)
-                {
-                    if (renderScene.isAnimationSystemAllocated(handle))
-                    {
-                        IAnimationSystem* animationSystem = renderScene.getAnimationSystem(handle);
-                        if (animationSystem->isRealTime())
-                        {
-                            animationSystem->setTime(systemTime);
+                m_animationSystemsToUpdate.push_back(activeAnimationSystem);
+            }
+        }
 
-                            if (animationSystem->hasActiveAnimations())
-                                m_modifiedScenesToRerender.put(sceneID);
-                        }
-                    }
-                }
+        for (const auto& animationSystemToUpdate : m_animationSystemsToUpdate)
+        {
+            IAnimationSystem* animationSystem = animationSystemToUpdate.first;
+            animationSystem->setTime(systemTime);
+
+            if (animationSystem->hasActiveAnimations())
+                m_modifiedScenesToRerender.put(animationSystemToUpdate.second);
+        }
+
+        m_renderer.getProfilerStatistics().setCounterValue(FrameProfilerStatistics::ECounter::ActiveAnimationSystems, static_cast<UInt32>(m_animationSystemsToUpdate.size()));
+    }
+
+    void RendererSceneUpdater::registerActivatedAnimationSystems(SceneId sceneId)
+    {
+        for (const auto animationSystem : m_activatedAnimationSystems)
+        {
+            if (animationSystem->isRealTime())
+            {
+                m_activeRealTimeAnimationSystems[animationSystem] = sceneId;
             }
         }
+        m_activatedAnimationSystems.clear();
+    }
+
+    void RendererSceneUpdater::onAnimationSystemActivated(IAnimationSystem& animationSystem)
+    {
+        m_activatedAnimationSystems.push_back(&animationSystem);
+    }
+
+    void RendererSceneUpdater::onAnimationSystemDeactivated(IAnimationSystem& animationSystem)
+    {
+        m_activeRealTimeAnimationSystems.erase(&animationSystem);
+        const auto activatedIt = std::find(m_activatedAnimationSystems.begin(), m_activatedAnimationSystems.end(), &animationSystem);
+        if (activatedIt != m_activatedAnimationSystems.end())
+            m_activatedAnimationSystems.erase(activatedIt);
     }
 
     void RendererSceneUpdater::updateScenesTransformationCache()
@@ -1351,6 +1431,8 @@ namespace ramses_internal
 
     void RendererSceneUpdater::resolveDataLinksForConsumerScenes(const DataReferenceLinkManager& dataRefLinkManager)
     {
+        UInt32 checkedLinks = 0u;
+        UInt32 propagatedLinks = 0u;
         for(const auto& rendererScene : m_rendererScenes)
         {
             const SceneId sceneID = rendererScene.key;
@@ -1359,10 +1441,15 @@ namespace ramses_internal
                 if (m_sceneStateExecutor.getSceneState(sceneID) == ESceneState_Rendered)
                 {
                     DataReferenceLinkCachedScene& scene = m_rendererScenes.getScene(sceneID);
-                    dataRefLinkManager.resolveLinksForConsumerScene(scene);
+                    const DataReferenceLinkManager::ResolveStatistics statistics = dataRefLinkManager.resolveLinksForConsumerScene(scene);
+                    checkedLinks += statistics.checkedLinks;
+                    propagatedLinks += statistics.propagatedLinks;
                 }
             }
         }
+
+        m_renderer.getProfilerStatistics().setCounterValue(FrameProfilerStatistics::ECounter::CheckedDataLinks, checkedLinks);
+        m_renderer.getProfilerStatistics().setCounterValue(FrameProfilerStatistics::ECounter::PropagatedDataLinks, propagatedLinks);
     }
     void RendererSceneUpdater::markScenesDependantOnModifiedConsumersAsModified(const DataReferenceLinkManager& dataRefLinkManager, const TransformationLinkManager& transfLinkManager, const TextureLinkManager& texLinkManager)
     {
@@ -26,9 +26,20 @@ namespace ramses_internal
         return m_frameNumber <= 0 ? 0u : m_drawCalls / m_frameNumber;
     }
 
+    void RendererStatistics::sceneMapRequested(SceneId sceneId)
+    {
+        m_sceneStatistics[sceneId].mapRequestTime = PlatformTime::GetMillisecondsMonotonic();
+    }
+
     void RendererStatistics::sceneRendered(SceneId sceneId)
     {
-        m_sceneStatistics[sceneId].numRendered++;
+        auto& sceneStats = m_sceneStatistics[sceneId];
+        sceneStats.numRendered++;
+        if (sceneStats.mapRequestTime != 0u)
+        {
+            sceneStats.timeToFirstFrame = static_cast<Int64>(PlatformTime::GetMillisecondsMonotonic() - sceneStats.mapRequestTime);
+            sceneStats.mapRequestTime = 0u;
+        }
     }
 
     void RendererStatistics::offscreenBufferSwapped(DisplayHandle displayHandle, DeviceResourceHandle offscreenBuffer, bool isInterruptible)
@@ -50,12 +61,43 @@ namespace ramses_internal
         m_displayStatistics[display].numFrameBufferSwapped++;
     }
 
+    void RendererStatistics::renderPassBatched(SceneId sceneId, RenderPassHandle pass, UInt numRenderables, UInt numDrawCalls)
+    {
+        auto& passStats = m_sceneStatistics[sceneId].renderPassBatchingStatistics[pass];
+        passStats.numRenderables += numRenderables;
+        passStats.numDrawCalls += numDrawCalls;
+    }
+
+    void RendererStatistics::uniformsSkipped(SceneId sceneId, UInt numSkippedUniforms)
+    {
+        m_sceneStatistics[sceneId].numUniformsSkipped += numSkippedUniforms;
+    }
+
+    void RendererStatistics::framebufferRedrawn(DisplayHandle display, UInt numPixelsRedrawn, UInt numPixelsTotal)
+    {
+        auto& displayStats = m_displayStatistics[display];
+        displayStats.numFrameBufferPixelsRedrawn += numPixelsRedrawn;
+        displayStats.numFrameBufferPixelsTotal += numPixelsTotal;
+    }
+
     void RendererStatistics::clientResourceUploaded(UInt byteSize)
     {
         m_clientResourcesUploaded++;
         m_clientResourcesBytesUploaded += byteSize;
     }
 
+    void RendererStatistics::clientResourcePrefetched(SceneId sceneId, UInt byteSize)
+    {
+        auto& sceneStats = m_sceneStatistics[sceneId];
+        sceneStats.clientResourcesPrefetched++;
+        sceneStats.clientResourcesBytesPrefetched += byteSize;
+    }
+
+    void RendererStatistics::prefetchedClientResourceUsed(SceneId sceneId)
+    {
+        m_sceneStatistics[sceneId].prefetchedClientResourcesUsed++;
+    }
+
     void RendererStatistics::sceneResourceUploaded(SceneId sceneId, UInt byteSize)
     {
         auto& sceneStats = m_sceneStatistics[sceneId];
@@ -80,6 +122,16 @@ namespace ramses_internal
         m_shadersCompiled++;
     }
 
+    void RendererStatistics::vertexArrayCacheHit(UInt numHits)
+    {
+        m_vertexArrayCacheHits += numHits;
+    }
+
+    void RendererStatistics::vertexArrayInvalidated()
+    {
+        m_vertexArraysInvalidated++;
+    }
+
     void RendererStatistics::trackArrivedFlush(SceneId sceneId, UInt numSceneActions, UInt numAddedClientResources, UInt numRemovedClientResources, UInt numSceneResourceActions)
     {
         auto& sceneStats = m_sceneStatistics[sceneId];
@@ -180,6 +232,8 @@ namespace ramses_internal
         m_clientResourcesUploaded = 0u;
         m_clientResourcesBytesUploaded = 0u;
         m_shadersCompiled = 0u;
+        m_vertexArrayCacheHits = 0u;
+        m_vertexArraysInvalidated = 0u;
 
         for (auto& sceneStatIt : m_sceneStatistics)
         {
@@ -201,12 +255,20 @@ namespace ramses_internal
             sceneStat.numSceneResourceActionsPerFlush.reset();
             sceneStat.sceneResourcesUploaded = 0u;
             sceneStat.sceneResourcesBytesUploaded = 0u;
+            sceneStat.clientResourcesPrefetched = 0u;
+            sceneStat.clientResourcesBytesPrefetched = 0u;
+            sceneStat.prefetchedClientResourcesUsed = 0u;
             sceneStat.numRendered = 0u;
+            sceneStat.numUniformsSkipped = 0u;
+            sceneStat.timeToFirstFrame = -1;
+            sceneStat.renderPassBatchingStatistics.clear();
         }
 
         for (auto& dispStat : m_displayStatistics)
         {
             dispStat.second.numFrameBufferSwapped = 0u;
+            dispStat.second.numFrameBufferPixelsRedrawn = 0u;
+            dispStat.second.numFrameBufferPixelsTotal = 0u;
             for (auto& obStat : dispStat.second.offscreenBufferStatistics)
             {
                 obStat.second.numSwapped = 0u;
@@ -238,11 +300,17 @@ namespace ramses_internal
             str << ", clientResUploaded " << m_clientResourcesUploaded << " (" << m_clientResourcesBytesUploaded << " B)";
         if (m_shadersCompiled > 0u)
             str << ", shadersCompiled " << m_shadersCompiled;
+        if (m_vertexArrayCacheHits > 0u)
+            str << ", vertexArrayCacheHits " << m_vertexArrayCacheHits;
+        if (m_vertexArraysInvalidated > 0u)
+            str << ", vertexArraysInvalidated " << m_vertexArraysInvalidated;
         str << "\n";
 
         for (const auto& dbStat : m_displayStatistics)
         {
             str << "FB" << dbStat.first << ": " << dbStat.second.numFrameBufferSwapped;
+            if (dbStat.second.numFrameBufferPixelsRedrawn < dbStat.second.numFrameBufferPixelsTotal)
+                str << " (redrawn pixels: " << dbStat.second.numFrameBufferPixelsRedrawn * 100u / dbStat.second.numFrameBufferPixelsTotal << "%)";
             for (const auto& obStat : dbStat.second.offscreenBufferStatistics)
             {
                 str << "; OB" << obStat.first << ": " << obStat.second.numSwapped;
@@ -280,6 +348,19 @@ namespace ramses_internal
             }
             if (sceneStats.sceneResourcesUploaded > 0u)
                 str << ", RSUploaded " << sceneStats.sceneResourcesUploaded << " (" << sceneStats.sceneResourcesBytesUploaded << " B)";
+            if (sceneStats.clientResourcesPrefetched > 0u)
+                str << ", RCPrefetched " << sceneStats.clientResourcesPrefetched << " (" << sceneStats.clientResourcesBytesPrefetched << " B)";
+            if (sceneStats.prefetchedClientResourcesUsed > 0u)
+                str << ", RCPrefetchHits " << sceneStats.prefetchedClientResourcesUsed;
+            if (sceneStats.numUniformsSkipped > 0u)
+                str << ", uniformsSkipped " << sceneStats.numUniformsSkipped;
+            if (sceneStats.timeToFirstFrame >= 0)
+                str << ", timeToFirstFrame " << sceneStats.timeToFirstFrame << "ms";
+            for (const auto& passStats : sceneStats.renderPassBatchingStatistics)
+            {
+                if (passStats.second.numRenderables > 0u)
+                    str << ", RP" << passStats.first << " batched " << passStats.second.numRenderables << " renderables into " << passStats.second.numDrawCalls << " drawcalls";
+            }
             str << "\n";
         }
 
@@ -8,13 +8,17 @@
 
 #include "RendererLib/ResourceCachedScene.h"
 #include "RendererLib/IResourceDeviceHandleAccessor.h"
+#include "RendererLib/IRendererResourceManager.h"
+#include "RendererLib/RendererStatistics.h"
 #include "RendererAPI/IEmbeddedCompositingManager.h"
 #include "Utils/LogMacros.h"
+#include <algorithm>
 
 namespace ramses_internal
 {
     ResourceCachedScene::ResourceCachedScene(SceneLinksManager& sceneLinksManager, const SceneInfo& sceneInfo)
         : DataReferenceLinkCachedScene(sceneLinksManager, sceneInfo)
+        , m_vertexArraysDirty(false)
         , m_renderableResourcesDirtinessNeedsUpdate(false)
         , m_renderTargetsDirty(false)
         , m_blitPassesDirty(false)
@@ -39,6 +43,8 @@ namespace ramses_internal
         resizeContainerIfSmaller(m_textureSamplersDirty, sizeInfo.textureSamplerCount);
         resizeContainerIfSmaller(m_effectDeviceHandleCache, sizeInfo.renderableCount);
         resizeContainerIfSmaller(m_deviceHandleCacheForVertexAttributes, sizeInfo.datainstanceCount);
+        resizeContainerIfSmaller(m_vertexArrayCache, sizeInfo.datainstanceCount);
+        resizeContainerIfSmaller(m_instanceWorldMatrixAttributeFields, sizeInfo.datainstanceCount);
         resizeContainerIfSmaller(m_deviceHandleCacheForTextures, sizeInfo.textureSamplerCount);
         resizeContainerIfSmaller(m_renderTargetCache, sizeInfo.renderTargetCount);
         resizeContainerIfSmaller(m_blitPassCache, sizeInfo.blitPassCount * 2u);
@@ -57,6 +63,7 @@ namespace ramses_internal
 
     void ResourceCachedScene::releaseRenderable(RenderableHandle renderableHandle)
     {
+        setVertexArrayDirty(getRenderable(renderableHandle).dataInstances[ERenderableDataSlotType_Geometry]);
         DataReferenceLinkCachedScene::releaseRenderable(renderableHandle);
         setRenderableResourcesDirtyFlag(renderableHandle, false);
     }
@@ -75,6 +82,16 @@ namespace ramses_internal
             {
                 m_deviceHandleCacheForVertexAttributes[indexIntoCache][i] = DeviceResourceHandle::Invalid();
             }
+            setVertexArrayDirty(dataInstance);
+
+            // geometry layout contains indices as first field, therefore attribute inputs are shifted by 1
+            assert(indexIntoCache < m_instanceWorldMatrixAttributeFields.size());
+            m_instanceWorldMatrixAttributeFields[indexIntoCache] = DataFieldHandle::Invalid();
+            for (DataFieldHandle field(1u); field < fieldCount; ++field)
+            {
+                if (layout.getField(field).semantics == EFixedSemantics_InstanceWorldMatrixAttribute)
+                    m_instanceWorldMatrixAttributeFields[indexIntoCache] = field - 1u;
+            }
         }
 
         setDataInstanceDirtyFlag(dataInstance, true);
@@ -86,6 +103,7 @@ namespace ramses_internal
     {
         DataReferenceLinkCachedScene::releaseDataInstance(dataInstanceHandle);
         setDataInstanceDirtyFlag(dataInstanceHandle, true);
+        setVertexArrayDirty(dataInstanceHandle);
     }
 
     TextureSamplerHandle ResourceCachedScene::allocateTextureSampler(const TextureSampler& sampler, TextureSamplerHandle handle)
@@ -119,12 +137,18 @@ namespace ramses_internal
         const UInt32 indexIntoCache = renderableHandle.asMemoryHandle();
         assert(indexIntoCache < m_effectDeviceHandleCache.size());
         m_effectDeviceHandleCache[indexIntoCache] = DeviceResourceHandle::Invalid();
+        // device handle of previous effect might get reused by another effect, vertex arrays built for it must not be found for that one
+        setVertexArrayDirty(getRenderable(renderableHandle).dataInstances[ERenderableDataSlotType_Geometry]);
 
         setRenderableResourcesDirtyFlag(renderableHandle, true);
     }
 
     void ResourceCachedScene::setRenderableDataInstance(RenderableHandle renderableHandle, ERenderableDataSlotType slot, DataInstanceHandle newDataInstance)
     {
+        if (slot == ERenderableDataSlotType_Geometry)
+        {
+            setVertexArrayDirty(getRenderable(renderableHandle).dataInstances[ERenderableDataSlotType_Geometry]);
+        }
         DataReferenceLinkCachedScene::setRenderableDataInstance(renderableHandle, slot, newDataInstance);
         setRenderableResourcesDirtyFlag(renderableHandle, true);
     }
@@ -142,6 +166,7 @@ namespace ramses_internal
         assert(indexIntoBufferCache < instanceDeviceCache.size());
         instanceDeviceCache[indexIntoBufferCache] = DeviceResourceHandle::Invalid();
         setDataInstanceDirtyFlag(dataInstanceHandle, true);
+        setVertexArrayDirty(dataInstanceHandle);
     }
 
     void ResourceCachedScene::setDataTextureSamplerHandle(DataInstanceHandle dataInstanceHandle, DataFieldHandle field, TextureSamplerHandle samplerHandle)
@@ -207,6 +232,12 @@ namespace ramses_internal
         return m_effectDeviceHandleCache[renderableAsIndex];
     }
 
+    DataFieldHandle ResourceCachedScene::getInstanceWorldMatrixAttributeField(DataInstanceHandle geometryInstance) const
+    {
+        assert(geometryInstance.asMemoryHandle() < m_instanceWorldMatrixAttributeFields.size());
+        return m_instanceWorldMatrixAttributeFields[geometryInstance.asMemoryHandle()];
+    }
+
     const DeviceHandleCache& ResourceCachedScene::getCachedHandlesForVertexAttributes() const
     {
         return m_deviceHandleCacheForVertexAttributes;
@@ -227,6 +258,17 @@ namespace ramses_internal
         return m_blitPassCache;
     }
 
+    DeviceResourceHandle ResourceCachedScene::getRenderableVertexArrayDeviceHandle(RenderableHandle renderable) const
+    {
+        if (!usesVertexArray(renderable) || vertexArrayNeedsUpdate(renderable))
+        {
+            return DeviceResourceHandle::Invalid();
+        }
+
+        const DataInstanceHandle geometryInstance = getRenderable(renderable).dataInstances[ERenderableDataSlotType_Geometry];
+        return findVertexArray(geometryInstance, m_effectDeviceHandleCache[renderable.asMemoryHandle()]);
+    }
+
     Bool ResourceCachedScene::CheckAndUpdateDeviceHandle(const IResourceDeviceHandleAccessor& resourceAccessor, DeviceResourceHandle& deviceHandleInOut, const ResourceContentHash& resourceHash)
     {
         if (!deviceHandleInOut.isValid())
@@ -327,6 +369,10 @@ namespace ramses_internal
         const SceneId sceneId = getSceneId();
         for (DataFieldHandle attributeField = indicesDataField; attributeField < numberOfGeometryFields; ++attributeField)
         {
+            // world matrices of instances are provided by renderer when drawing, device handle for this field stays invalid
+            if (geometryLayout.getField(attributeField).semantics == EFixedSemantics_InstanceWorldMatrixAttribute)
+                continue;
+
             assert(IsBufferDataType(geometryLayout.getField(attributeField).dataType));
             const ResourceField& dataResource = getDataResource(dataInstance, attributeField);
 
@@ -498,6 +544,142 @@ namespace ramses_internal
         checkAndUpdateBlitPassResources(resourceAccessor);
     }
 
+    Bool ResourceCachedScene::hasDirtyVertexArrays() const
+    {
+        // dirty flag is set on any change of renderable resources, check if some vertex array really has to be unloaded or (re)created
+        if (m_vertexArraysDirty)
+        {
+            for (const auto& geometryVertexArrays : m_vertexArrayCache)
+            {
+                if (geometryVertexArrays.dirty && !geometryVertexArrays.vertexArrays.empty())
+                {
+                    return true;
+                }
+            }
+
+            const UInt32 renderableCount = getRenderableCount();
+            for (RenderableHandle renderable(0); renderable < renderableCount; ++renderable)
+            {
+                if (isRenderableAllocated(renderable) && !m_renderableResourcesDirty[renderable.asMemoryHandle()] && usesVertexArray(renderable) && vertexArrayNeedsUpdate(renderable))
+                {
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    void ResourceCachedScene::updateVertexArrays(IRendererResourceManager& resourceManager, RendererStatistics& statistics)
+    {
+        if (!m_vertexArraysDirty)
+        {
+            return;
+        }
+
+        // vertex arrays of changed or released geometry are unloaded for all shaders, they are recreated below if still used
+        for (UInt32 geometryIdx = 0u; geometryIdx < m_vertexArrayCache.size(); ++geometryIdx)
+        {
+            GeometryVertexArrays& geometryVertexArrays = m_vertexArrayCache[geometryIdx];
+            if (!geometryVertexArrays.dirty)
+            {
+                continue;
+            }
+
+            for (const auto& vertexArray : geometryVertexArrays.vertexArrays)
+            {
+                resourceManager.unloadVertexArray(DataInstanceHandle(geometryIdx), vertexArray.shader, getSceneId());
+                statistics.vertexArrayInvalidated();
+            }
+            geometryVertexArrays.vertexArrays.clear();
+            geometryVertexArrays.dirty = false;
+        }
+
+        // cache hit is a renderable whose vertex array did not have to be created again after some change in the scene
+        UInt numCacheHits = 0u;
+        const UInt32 renderableCount = getRenderableCount();
+        for (RenderableHandle renderable(0); renderable < renderableCount; ++renderable)
+        {
+            if (!isRenderableAllocated(renderable) || m_renderableResourcesDirty[renderable.asMemoryHandle()] || !usesVertexArray(renderable))
+            {
+                continue;
+            }
+
+            if (!vertexArrayNeedsUpdate(renderable))
+            {
+                ++numCacheHits;
+                continue;
+            }
+
+            const DataInstanceHandle geometryInstance = getRenderable(renderable).dataInstances[ERenderableDataSlotType_Geometry];
+            uploadVertexArray(resourceManager, geometryInstance, m_effectDeviceHandleCache[renderable.asMemoryHandle()]);
+        }
+
+        m_vertexArraysDirty = false;
+        statistics.vertexArrayCacheHit(numCacheHits);
+    }
+
+    Bool ResourceCachedScene::usesVertexArray(RenderableHandle renderable) const
+    {
+        // instance world matrices are set as attributes right before draw call, they must not modify the cached vertex array state
+        // which is shared by all renderables using the geometry, such renderables activate their vertex buffers one by one instead
+        const DataInstanceHandle geometryInstance = getRenderable(renderable).dataInstances[ERenderableDataSlotType_Geometry];
+        return !getInstanceWorldMatrixAttributeField(geometryInstance).isValid();
+    }
+
+    Bool ResourceCachedScene::vertexArrayNeedsUpdate(RenderableHandle renderable) const
+    {
+        const DataInstanceHandle geometryInstance = getRenderable(renderable).dataInstances[ERenderableDataSlotType_Geometry];
+        assert(geometryInstance.asMemoryHandle() < m_vertexArrayCache.size());
+        return m_vertexArrayCache[geometryInstance.asMemoryHandle()].dirty || !findVertexArray(geometryInstance, m_effectDeviceHandleCache[renderable.asMemoryHandle()]).isValid();
+    }
+
+    DeviceResourceHandle ResourceCachedScene::findVertexArray(DataInstanceHandle geometryInstance, DeviceResourceHandle shader) const
+    {
+        // geometry is used with few different shaders only, therefore searched linearly
+        const auto& vertexArrays = m_vertexArrayCache[geometryInstance.asMemoryHandle()].vertexArrays;
+        const auto it = std::find_if(vertexArrays.cbegin(), vertexArrays.cend(), [shader](const VertexArrayCacheEntry& entry) { return entry.shader == shader; });
+        return it != vertexArrays.cend() ? it->deviceHandle : DeviceResourceHandle::Invalid();
+    }
+
+    void ResourceCachedScene::uploadVertexArray(IRendererResourceManager& resourceManager, DataInstanceHandle geometryInstance, DeviceResourceHandle shader)
+    {
+        const DeviceHandleVector& vertexAttributesCache = m_deviceHandleCacheForVertexAttributes[geometryInstance.asMemoryHandle()];
+
+        // Vertex attributes cache contains indices as first element, therefore the vertex attributes are shifted by 1 when accessing them
+        VertexArrayInfo vertexArrayInfo;
+        vertexArrayInfo.shader = shader;
+        vertexArrayInfo.indexBuffer = vertexAttributesCache.front();
+        const UInt32 attributesCount = static_cast<UInt32>(vertexAttributesCache.size()) - 1u;
+        for (DataFieldHandle attributeField(0u); attributeField < attributesCount; ++attributeField)
+        {
+            const DeviceResourceHandle vertexBuffer = vertexAttributesCache[attributeField.asMemoryHandle() + 1u];
+            // instance world matrix attribute has no vertex buffer
+            if (!vertexBuffer.isValid())
+                continue;
+            const UInt32 instancingDivisor = getDataResource(geometryInstance, attributeField + 1u).instancingDivisor;
+            vertexArrayInfo.vertexBuffers.push_back({ vertexBuffer, attributeField, instancingDivisor });
+        }
+
+        resourceManager.uploadVertexArray(geometryInstance, vertexArrayInfo, getSceneId());
+
+        const DeviceResourceHandle deviceHandle = resourceManager.getVertexArrayDeviceHandle(geometryInstance, shader, getSceneId());
+        m_vertexArrayCache[geometryInstance.asMemoryHandle()].vertexArrays.push_back({ shader, deviceHandle });
+    }
+
+    void ResourceCachedScene::setVertexArrayDirty(DataInstanceHandle geometryInstance)
+    {
+        if (!geometryInstance.isValid())
+        {
+            return;
+        }
+
+        const UInt32 indexIntoCache = geometryInstance.asMemoryHandle();
+        assert(indexIntoCache < m_vertexArrayCache.size());
+        m_vertexArrayCache[indexIntoCache].dirty = true;
+        m_vertexArraysDirty = true;
+    }
+
     void ResourceCachedScene::updateRenderablesResourcesDirtiness()
     {
         if (m_renderableResourcesDirtinessNeedsUpdate)
@@ -540,6 +722,7 @@ namespace ramses_internal
         const UInt32 indexIntoCache = handle.asMemoryHandle();
         assert(indexIntoCache < m_renderableResourcesDirty.size());
         m_renderableResourcesDirty[indexIntoCache] = dirty;
+        m_vertexArraysDirty = true;
     }
 
     void ResourceCachedScene::setDataInstanceDirtyFlag(DataInstanceHandle handle, Bool dirty) const
@@ -672,6 +855,10 @@ namespace ramses_internal
             std::fill(it.begin(), it.end(), DeviceResourceHandle::Invalid());
         }
 
+        // vertex arrays are unloaded together with all other scene resources
+        std::fill(m_vertexArrayCache.begin(), m_vertexArrayCache.end(), GeometryVertexArrays());
+        m_vertexArraysDirty = true;
+
         m_renderTargetsDirty = !m_renderTargetCache.empty();
         m_blitPassesDirty = !m_blitPassCache.empty();
     }
@@ -86,16 +86,46 @@ namespace ramses_internal
         }
     }
 
+    DeviceResourceHandle ResourceUploader::allocateTexture(IRenderBackend& renderBackend, const TextureResource& texture)
+    {
+        assert(!texture.getGenerateMipChainFlag());
+        return AllocateTexture(renderBackend.getDevice(), texture, static_cast<UInt32>(texture.getMipDataSizes().size()));
+    }
+
+    void ResourceUploader::uploadTextureMipLevel(IRenderBackend& renderBackend, DeviceResourceHandle textureHandle, const TextureResource& texture, UInt32 mipLevel)
+    {
+        IDevice& device = renderBackend.getDevice();
+        // texture is not bound anymore if its levels are uploaded in later frames than it was allocated
+        device.bindTexture(textureHandle);
+        UploadTextureMipLevel(device, textureHandle, texture, mipLevel);
+        device.setTextureBaseMipLevel(textureHandle, mipLevel);
+    }
+
     DeviceResourceHandle ResourceUploader::uploadTexture(IDevice& device, const TextureResource& texture)
     {
         const Bool generateMipsFlag = texture.getGenerateMipChainFlag();
-        const auto& mipDataSizes = texture.getMipDataSizes();
-        const UInt32 numProvidedMipLevels = static_cast<UInt32>(mipDataSizes.size());
+        const UInt32 numProvidedMipLevels = static_cast<UInt32>(texture.getMipDataSizes().size());
         assert(numProvidedMipLevels == 1u || !generateMipsFlag);
         const UInt32 numMipLevelsToAllocate = generateMipsFlag ? TextureMathUtils::GetMipLevelCount(texture.getWidth(), texture.getHeight(), texture.getDepth()) : numProvidedMipLevels;
+
+        const DeviceResourceHandle textureDeviceHandle = AllocateTexture(device, texture, numMipLevelsToAllocate);
+        for (UInt32 mipLevel = 0u; mipLevel < numProvidedMipLevels; ++mipLevel)
+        {
+            UploadTextureMipLevel(device, textureDeviceHandle, texture, mipLevel);
+        }
+
+        if (generateMipsFlag)
+        {
+            device.generateMipmaps(textureDeviceHandle);
+        }
+
+        return textureDeviceHandle;
+    }
+
+    DeviceResourceHandle ResourceUploader::AllocateTexture(IDevice& device, const TextureResource& texture, UInt32 numMipLevelsToAllocate)
+    {
         const UInt32 totalSizeInBytes = EstimateGPUAllocatedSizeOfTexture(texture, numMipLevelsToAllocate);
 
-        // allocate texture
         DeviceResourceHandle textureDeviceHandle;
         switch (texture.getTypeID())
         {
@@ -113,44 +143,53 @@ namespace ramses_internal
         }
         assert(textureDeviceHandle.isValid());
 
-        // upload texture data
-        const Byte* pData = reinterpret_cast<const Byte*>(texture.getData());
+        return textureDeviceHandle;
+    }
+
+    void ResourceUploader::UploadTextureMipLevel(IDevice& device, DeviceResourceHandle textureHandle, const TextureResource& texture, UInt32 mipLevel)
+    {
+        const auto& mipDataSizes = texture.getMipDataSizes();
+        assert(mipLevel < mipDataSizes.size());
+
+        // data of levels is stored one after another, for cube textures all levels of one face are followed by levels of next face
+        UInt32 mipLevelOffset = 0u;
+        for (UInt32 level = 0u; level < mipLevel; ++level)
+        {
+            mipLevelOffset += mipDataSizes[level];
+        }
+        const Byte* pData = reinterpret_cast<const Byte*>(texture.getData()) + mipLevelOffset;
+
         switch (texture.getTypeID())
         {
         case EResourceType_Texture2D:
         case EResourceType_Texture3D:
-            for (UInt32 mipLevel = 0u; mipLevel < mipDataSizes.size(); ++mipLevel)
-            {
-                const UInt32 width = TextureMathUtils::GetMipSize(mipLevel, texture.getWidth());
-                const UInt32 height = TextureMathUtils::GetMipSize(mipLevel, texture.getHeight());
-                const UInt32 depth = TextureMathUtils::GetMipSize(mipLevel, texture.getDepth());
-                device.uploadTextureData(textureDeviceHandle, mipLevel, 0u, 0u, 0u, width, height, depth, pData, mipDataSizes[mipLevel]);
-                pData += mipDataSizes[mipLevel];
-            }
+        {
+            const UInt32 width = TextureMathUtils::GetMipSize(mipLevel, texture.getWidth());
+            const UInt32 height = TextureMathUtils::GetMipSize(mipLevel, texture.getHeight());
+            const UInt32 depth = TextureMathUtils::GetMipSize(mipLevel, texture.getDepth());
+            device.uploadTextureData(textureHandle, mipLevel, 0u, 0u, 0u, width, height, depth, pData, mipDataSizes[mipLevel]);
             break;
+        }
         case EResourceType_TextureCube:
+        {
+            UInt32 faceDataSize = 0u;
+            for (const auto mipDataSize : mipDataSizes)
+            {
+                faceDataSize += mipDataSize;
+            }
+
+            const UInt32 faceSize = TextureMathUtils::GetMipSize(mipLevel, texture.getWidth());
             for (UInt32 i = 0; i < 6u; ++i)
             {
                 const ETextureCubeFace faceId = static_cast<ETextureCubeFace>(i);
-                for (UInt32 mipLevel = 0u; mipLevel < mipDataSizes.size(); ++mipLevel)
-                {
-                    const UInt32 faceSize = TextureMathUtils::GetMipSize(mipLevel, texture.getWidth());
-                    // texture faceID is encoded in Z offset
-                    device.uploadTextureData(textureDeviceHandle, mipLevel, 0u, 0u, faceId, faceSize, faceSize, 1u, pData, mipDataSizes[mipLevel]);
-                    pData += mipDataSizes[mipLevel];
-                }
+                // texture faceID is encoded in Z offset
+                device.uploadTextureData(textureHandle, mipLevel, 0u, 0u, faceId, faceSize, faceSize, 1u, pData + i * faceDataSize, mipDataSizes[mipLevel]);
             }
             break;
+        }
         default:
             assert(false);
         }
-
-        if (generateMipsFlag)
-        {
-            device.generateMipmaps(textureDeviceHandle);
-        }
-
-        return textureDeviceHandle;
     }
 
     ramses_internal::DeviceResourceHandle ResourceUploader::queryBinaryShaderCacheAndUploadEffect(IRenderBackend& renderBackend, const EffectResource& effect, ResourceContentHash hash)
@@ -72,7 +72,7 @@ namespace ramses_internal
         // Stereo Rendering, one pass for left and one for right eye
         for (UInt32 eyeIndex = 0; eyeIndex < 2; eyeIndex++)
         {
-            const RenderExecutor executor(getRenderBackend().getDevice(), m_viewInfo[eyeIndex].m_fbInfo, renderFrom);
+            const RenderExecutor executor(getRenderBackend().getDevice(), m_viewInfo[eyeIndex].m_fbInfo, renderFrom, nullptr, isInstancedDrawBatchingEnabled());
             executor.executeScene(scene, m_viewInfo[eyeIndex].m_viewMatrix);
         }
 
@@ -86,7 +86,7 @@ namespace ramses_internal
 
     Matrix44f TransformationLinkCachedScene::updateMatrixCacheWithLinks(ETransformationMatrixType matrixType, NodeHandle node) const
     {
-        if (!m_sceneLinksManager.getTransformationLinkManager().getDependencyChecker().hasDependencyAsConsumer(getSceneId()))
+        if (!consumesLinkedTransformations())
         {
             // early out, if no links need to be resolved fall back to standard transformation scene
             return SceneLinkScene::updateMatrixCache(matrixType, node);
@@ -105,6 +105,11 @@ namespace ramses_internal
         return chainMatrix;
     }
 
+    Bool TransformationLinkCachedScene::consumesLinkedTransformations() const
+    {
+        return m_sceneLinksManager.getTransformationLinkManager().getDependencyChecker().hasDependencyAsConsumer(getSceneId());
+    }
+
     void TransformationLinkCachedScene::getMatrixForNode(ETransformationMatrixType matrixType, NodeHandle node, Matrix44f& chainMatrix) const
     {
         if (m_sceneLinksManager.getTransformationLinkManager().nodeHasDataLinkToProvider(getSceneId(), node))
@@ -13,6 +13,7 @@
 #include "RendererLib/RendererStatistics.h"
 #include "Resource/ArrayResource.h"
 #include "Resource/EffectResource.h"
+#include "Resource/TextureResource.h"
 #include "ResourceProviderMock.h"
 #include "ResourceUploaderMock.h"
 #include "RenderBackendMock.h"
@@ -23,13 +24,13 @@ namespace ramses_internal{
 class AClientResourceUploadingManager : public ::testing::Test
 {
 public:
-    AClientResourceUploadingManager(bool keepEffects = false, UInt64 clientResourceCacheSize = 0u)
+    AClientResourceUploadingManager(bool keepEffects = false, UInt64 clientResourceCacheSize = 0u, bool computeVertexArrayBounds = false)
         : dummyResource(EResourceType_IndexArray, 5, EDataType_UInt16, reinterpret_cast<const Byte*>(m_dummyData), ResourceCacheFlag_DoNotCache, String())
         , dummyEffectResource("", "", EffectInputInformationVector(), EffectInputInformationVector(), "", ResourceCacheFlag_DoNotCache)
         , dummyManagedResourceCallback(managedResourceDeleter)
         , sceneId(66u)
         , frameTimer()
-        , rendererResourceUploader(resourceRegistry, uploader, rendererBackend, keepEffects, frameTimer, stats, clientResourceCacheSize)
+        , rendererResourceUploader(resourceRegistry, uploader, rendererBackend, keepEffects, frameTimer, stats, clientResourceCacheSize, computeVertexArrayBounds)
     {
     }
 
@@ -48,7 +49,7 @@ public:
         else
         {
             ManagedResource managedRes((nullptr != resource? *resource : dummyResource) , dummyManagedResourceCallback);
-            resourceRegistry.setResourceData(hash, managedRes, DeviceResourceHandle::Invalid(), EResourceType_IndexArray);
+            resourceRegistry.setResourceData(hash, managedRes, DeviceResourceHandle::Invalid(), managedRes.getResourceObject()->getTypeID());
         }
 
         ASSERT_TRUE(resourceRegistry.getAllProvidedResources().contains(hash));
@@ -139,6 +140,15 @@ public:
     }
 };
 
+class AClientResourceUploadingManager_ComputingVertexArrayBounds : public AClientResourceUploadingManager
+{
+public:
+    AClientResourceUploadingManager_ComputingVertexArrayBounds()
+        : AClientResourceUploadingManager(false, 0u, true)
+    {
+    }
+};
+
 TEST_F(AClientResourceUploadingManager, hasNothingToUploadUnloadInitially)
 {
     EXPECT_FALSE(rendererResourceUploader.hasAnythingToUpload());
@@ -407,6 +417,185 @@ TEST_F(AClientResourceUploadingManager, checksTimeBudgetForEachEffectWhenUploadi
     EXPECT_CALL(uploader, unloadResource(_, _, _, _)).Times(2);
 }
 
+TEST_F(AClientResourceUploadingManager, uploadsLargeTextureWithMipChainProgressivelyStartingWithSmallestLevels)
+{
+    const ResourceContentHash res(1234u, 0u);
+
+    // levels 3 and 2 fit together into size of large resource, then levels 1 and 0 follow one per update
+    const UInt32 levelSize = ClientResourceUploadingManager::LargeResourceByteSizeThreshold / 2u;
+    const TextureMetaInfo texDesc(4u, 4u, 1u, ETextureFormat_R8, false, { 4u * levelSize, 2u * levelSize, levelSize, levelSize });
+    const TextureResource texture(EResourceType_Texture2D, texDesc, ResourceCacheFlag_DoNotCache, String());
+    registerAndProvideResource(res, false, &texture);
+
+    frameTimer.startFrame();
+    frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::ClientResourcesUpload, 0u);
+    {
+        InSequence seq;
+        EXPECT_CALL(uploader, allocateTexture(_, Ref(texture)));
+        EXPECT_CALL(uploader, uploadTextureMipLevel(_, ResourceUploaderMock::FakeResourceDeviceHandle, Ref(texture), 3u));
+        EXPECT_CALL(uploader, uploadTextureMipLevel(_, ResourceUploaderMock::FakeResourceDeviceHandle, Ref(texture), 2u));
+        EXPECT_CALL(uploader, uploadTextureMipLevel(_, ResourceUploaderMock::FakeResourceDeviceHandle, Ref(texture), 1u));
+    }
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUploaded(res);
+    EXPECT_TRUE(rendererResourceUploader.hasAnythingToUpload());
+    Mock::VerifyAndClearExpectations(&uploader);
+
+    EXPECT_CALL(uploader, uploadTextureMipLevel(_, ResourceUploaderMock::FakeResourceDeviceHandle, Ref(texture), 0u));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    EXPECT_FALSE(rendererResourceUploader.hasAnythingToUpload());
+    Mock::VerifyAndClearExpectations(&uploader);
+
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+
+    makeResourceUnused(res);
+    EXPECT_CALL(uploader, unloadResource(_, EResourceType_Texture2D, res, ResourceUploaderMock::FakeResourceDeviceHandle));
+}
+
+TEST_F(AClientResourceUploadingManager, reportsScenesUsingProgressivelyUploadedTextureAfterEveryLargerLevel)
+{
+    const ResourceContentHash res(1234u, 0u);
+
+    const UInt32 largeLevelSize = ClientResourceUploadingManager::LargeResourceByteSizeThreshold;
+    const TextureMetaInfo texDesc(4u, 4u, 1u, ETextureFormat_R8, false, { largeLevelSize, largeLevelSize, largeLevelSize });
+    const TextureResource texture(EResourceType_Texture2D, texDesc, ResourceCacheFlag_DoNotCache, String());
+    registerAndProvideResource(res, false, &texture);
+
+    frameTimer.startFrame();
+    frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::ClientResourcesUpload, 0u);
+    EXPECT_CALL(uploader, allocateTexture(_, Ref(texture)));
+    EXPECT_CALL(uploader, uploadTextureMipLevel(_, _, Ref(texture), 2u));
+    EXPECT_CALL(uploader, uploadTextureMipLevel(_, _, Ref(texture), 1u));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    Mock::VerifyAndClearExpectations(&uploader);
+
+    // scene has to be rendered again with larger level even if it does not change otherwise
+    HashSet<SceneId> scenes;
+    rendererResourceUploader.collectScenesUsingUpdatedResources(scenes);
+    EXPECT_EQ(1u, scenes.count());
+    EXPECT_TRUE(scenes.hasElement(sceneId));
+
+    scenes.clear();
+    rendererResourceUploader.collectScenesUsingUpdatedResources(scenes);
+    EXPECT_EQ(0u, scenes.count());
+
+    EXPECT_CALL(uploader, uploadTextureMipLevel(_, _, Ref(texture), 0u));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    Mock::VerifyAndClearExpectations(&uploader);
+    rendererResourceUploader.collectScenesUsingUpdatedResources(scenes);
+    EXPECT_EQ(1u, scenes.count());
+    EXPECT_TRUE(scenes.hasElement(sceneId));
+
+    scenes.clear();
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    rendererResourceUploader.collectScenesUsingUpdatedResources(scenes);
+    EXPECT_EQ(0u, scenes.count());
+
+    makeResourceUnused(res);
+    EXPECT_CALL(uploader, unloadResource(_, EResourceType_Texture2D, res, _));
+}
+
+TEST_F(AClientResourceUploadingManager, stopsProgressiveTextureUploadWhenTextureUnloaded)
+{
+    const ResourceContentHash res(1234u, 0u);
+
+    const UInt32 largeLevelSize = ClientResourceUploadingManager::LargeResourceByteSizeThreshold;
+    const TextureMetaInfo texDesc(4u, 4u, 1u, ETextureFormat_R8, false, { largeLevelSize, largeLevelSize, largeLevelSize });
+    const TextureResource texture(EResourceType_Texture2D, texDesc, ResourceCacheFlag_DoNotCache, String());
+    registerAndProvideResource(res, false, &texture);
+
+    frameTimer.startFrame();
+    frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::ClientResourcesUpload, 0u);
+    EXPECT_CALL(uploader, allocateTexture(_, Ref(texture)));
+    EXPECT_CALL(uploader, uploadTextureMipLevel(_, _, Ref(texture), 2u));
+    EXPECT_CALL(uploader, uploadTextureMipLevel(_, _, Ref(texture), 1u));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    Mock::VerifyAndClearExpectations(&uploader);
+
+    makeResourceUnused(res);
+    EXPECT_CALL(uploader, unloadResource(_, EResourceType_Texture2D, res, _));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUnloaded(res);
+    EXPECT_FALSE(rendererResourceUploader.hasAnythingToUpload());
+}
+
+TEST_F(AClientResourceUploadingManager, uploadsSmallerResourcesBeforeLargerOnes)
+{
+    const ResourceContentHash res1(1234u, 0u);
+    const ResourceContentHash res2(1235u, 0u);
+
+    const Vector<UInt32> dummyData(ClientResourceUploadingManager::LargeResourceByteSizeThreshold / 4 + 1, 0u);
+    const ArrayResource largeResource(EResourceType_IndexArray, static_cast<UInt32>(dummyData.size()), EDataType_UInt32, reinterpret_cast<const Byte*>(dummyData.data()), ResourceCacheFlag_DoNotCache, "");
+    registerAndProvideResource(res1, false, &largeResource);
+    registerAndProvideResource(res2);
+
+    {
+        InSequence seq;
+        EXPECT_CALL(uploader, uploadResource(_, Property(&ManagedResource::getResourceObject, &dummyResource)));
+        EXPECT_CALL(uploader, uploadResource(_, Property(&ManagedResource::getResourceObject, &largeResource)));
+    }
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUploaded(res1);
+    expectResourceUploaded(res2);
+
+    makeResourceUnused(res1);
+    makeResourceUnused(res2);
+    EXPECT_CALL(uploader, unloadResource(_, _, _, _)).Times(2);
+}
+
+TEST_F(AClientResourceUploadingManager, uploadsResourcesWithLowerCacheFlagFirst)
+{
+    const ResourceContentHash res1(1234u, 0u);
+    const ResourceContentHash res2(1235u, 0u);
+    const ResourceContentHash res3(1236u, 0u);
+
+    const ArrayResource resourceWithFlag2(EResourceType_IndexArray, 5, EDataType_UInt16, reinterpret_cast<const Byte*>(m_dummyData), ResourceCacheFlag(2u), String());
+    const ArrayResource resourceWithFlag1(EResourceType_IndexArray, 5, EDataType_UInt16, reinterpret_cast<const Byte*>(m_dummyData), ResourceCacheFlag(1u), String());
+    registerAndProvideResource(res1);
+    registerAndProvideResource(res2, false, &resourceWithFlag2);
+    registerAndProvideResource(res3, false, &resourceWithFlag1);
+
+    {
+        InSequence seq;
+        EXPECT_CALL(uploader, uploadResource(_, Property(&ManagedResource::getResourceObject, &resourceWithFlag1)));
+        EXPECT_CALL(uploader, uploadResource(_, Property(&ManagedResource::getResourceObject, &resourceWithFlag2)));
+        EXPECT_CALL(uploader, uploadResource(_, Property(&ManagedResource::getResourceObject, &dummyResource)));
+    }
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+
+    makeResourceUnused(res1);
+    makeResourceUnused(res2);
+    makeResourceUnused(res3);
+    EXPECT_CALL(uploader, unloadResource(_, _, _, _)).Times(3);
+}
+
+TEST_F(AClientResourceUploadingManager, uploadsResourcesOfPriorityScenesFirst)
+{
+    const ResourceContentHash res1(1234u, 0u);
+    const ResourceContentHash res2(1235u, 0u);
+    const SceneId prioritySceneId(67u);
+
+    const Vector<UInt32> dummyData(ClientResourceUploadingManager::LargeResourceByteSizeThreshold / 4 + 1, 0u);
+    const ArrayResource largeResource(EResourceType_IndexArray, static_cast<UInt32>(dummyData.size()), EDataType_UInt32, reinterpret_cast<const Byte*>(dummyData.data()), ResourceCacheFlag_DoNotCache, "");
+    registerAndProvideResource(res1);
+    registerAndProvideResource(res2, false, &largeResource);
+    resourceRegistry.addResourceRef(res2, prioritySceneId);
+
+    rendererResourceUploader.setPriorityScenes({ prioritySceneId });
+    frameTimer.startFrame();
+    frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::ClientResourcesUpload, 0u);
+    EXPECT_CALL(uploader, uploadResource(_, Property(&ManagedResource::getResourceObject, &largeResource)));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUploaded(res2);
+    // only first resource uploaded because out of time budget
+    expectResourceStatus(res1, EResourceStatus_Provided);
+
+    resourceRegistry.removeResourceRef(res2, prioritySceneId);
+    makeResourceUnused(res2);
+    unregisterResource(res1);
+    EXPECT_CALL(uploader, unloadResource(_, _, _, _));
+}
+
 TEST_F(AClientResourceUploadingManager, uploadsOnlyResourcesFittingIntoTimeBudgetInOneUpdate)
 {
     // using effect resources so that time budget checks happen on every resources, not just once per batch
@@ -672,4 +861,41 @@ TEST_F(AClientResourceUploadingManager_WithVRAMCache, willUnloadResourcesOfSameO
     // destructor will unload kept resources
     EXPECT_CALL(uploader, unloadResource(_, _, _, _)).Times(3u);
 }
+TEST_F(AClientResourceUploadingManager, doesNotComputeVertexArrayBoundsIfNotEnabled)
+{
+    const Float vertexData[] = { -1.f, 2.f, 3.f, 4.f, -5.f, 6.f };
+    const ArrayResource vertexArray(EResourceType_VertexArray, 2u, EDataType_Vector3F, reinterpret_cast<const Byte*>(vertexData), ResourceCacheFlag_DoNotCache, String());
+    const ResourceContentHash res(1234u, 0u);
+    registerAndProvideResource(res, false, &vertexArray);
+
+    EXPECT_CALL(uploader, uploadResource(_, _));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUploaded(res);
+
+    Vector3 minBounds;
+    Vector3 maxBounds;
+    EXPECT_FALSE(rendererResourceUploader.getVertexArrayBounds(res, minBounds, maxBounds));
+
+    unregisterResource(res);
+}
+
+TEST_F(AClientResourceUploadingManager_ComputingVertexArrayBounds, computesBoundsOfUploadedVertexArray)
+{
+    const Float vertexData[] = { -1.f, 2.f, 3.f, 4.f, -5.f, 6.f };
+    const ArrayResource vertexArray(EResourceType_VertexArray, 2u, EDataType_Vector3F, reinterpret_cast<const Byte*>(vertexData), ResourceCacheFlag_DoNotCache, String());
+    const ResourceContentHash res(1234u, 0u);
+    registerAndProvideResource(res, false, &vertexArray);
+
+    EXPECT_CALL(uploader, uploadResource(_, _));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUploaded(res);
+
+    Vector3 minBounds;
+    Vector3 maxBounds;
+    ASSERT_TRUE(rendererResourceUploader.getVertexArrayBounds(res, minBounds, maxBounds));
+    EXPECT_EQ(Vector3(-1.f, -5.f, 3.f), minBounds);
+    EXPECT_EQ(Vector3(4.f, 2.f, 6.f), maxBounds);
+
+    unregisterResource(res);
+}
 }
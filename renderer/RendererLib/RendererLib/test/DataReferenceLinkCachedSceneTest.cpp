@@ -50,7 +50,7 @@ TEST_F(ADataReferenceLinkCachedScene, canSetValueDirectlyWithoutUpdatingFallback
 {
     Variant value;
     value.setValue(33);
-    scene.setValueWithoutUpdatingFallbackValue(dataRef, DataFieldHandle(0u), value);
+    scene.setValueWithoutUpdatingFallbackValue(dataRef, DataFieldHandle(0u), value, 1u);
     EXPECT_EQ(33, scene.getDataSingleInteger(dataRef, DataFieldHandle(0u)));
 }
 
@@ -60,7 +60,7 @@ TEST_F(ADataReferenceLinkCachedScene, canRestoreFallbackValue)
 
     Variant value;
     value.setValue(33);
-    scene.setValueWithoutUpdatingFallbackValue(dataRef, DataFieldHandle(0u), value);
+    scene.setValueWithoutUpdatingFallbackValue(dataRef, DataFieldHandle(0u), value, 1u);
 
     scene.restoreFallbackValue(dataRef, DataFieldHandle(0u));
     EXPECT_EQ(13, scene.getDataSingleInteger(dataRef, DataFieldHandle(0u)));
@@ -77,3 +77,34 @@ TEST_F(ADataReferenceLinkCachedScene, storesFallbackValueWhenSlotAllocated)
     scene.restoreFallbackValue(dataRef, DataFieldHandle(0u));
     EXPECT_EQ(13, scene.getDataSingleInteger(dataRef, DataFieldHandle(0u)));
 }
+
+TEST_F(ADataReferenceLinkCachedScene, consumerRemembersPropagatedProviderVersionUntilValueOverwritten)
+{
+    EXPECT_EQ(DataReferenceLinkCachedScene::InvalidDataVersion, scene.getConsumerPropagatedDataVersion(dataRef));
+
+    Variant value;
+    value.setValue(33);
+    scene.setValueWithoutUpdatingFallbackValue(dataRef, DataFieldHandle(0u), value, 7u);
+    EXPECT_EQ(7u, scene.getConsumerPropagatedDataVersion(dataRef));
+
+    scene.setDataSingleInteger(dataRef, DataFieldHandle(0u), 13);
+    EXPECT_EQ(DataReferenceLinkCachedScene::InvalidDataVersion, scene.getConsumerPropagatedDataVersion(dataRef));
+}
+
+TEST_F(ADataReferenceLinkCachedScene, providerVersionChangesWithEveryValueChange)
+{
+    const DataLayoutHandle layout = sceneAllocator.allocateDataLayout({ DataFieldInfo(EDataType_Int32) });
+    const DataInstanceHandle providerDataRef = sceneAllocator.allocateDataInstance(layout);
+    sceneAllocator.allocateDataSlot({ EDataSlotType_DataProvider, DataSlotId(2u), NodeHandle(), providerDataRef, ResourceContentHash::Invalid(), TextureSamplerHandle() });
+
+    const UInt32 version1 = scene.getProviderDataVersion(providerDataRef);
+    EXPECT_NE(DataReferenceLinkCachedScene::InvalidDataVersion, version1);
+
+    scene.setDataSingleInteger(providerDataRef, DataFieldHandle(0u), 13);
+    const UInt32 version2 = scene.getProviderDataVersion(providerDataRef);
+    EXPECT_NE(version1, version2);
+    EXPECT_NE(DataReferenceLinkCachedScene::InvalidDataVersion, version2);
+
+    scene.setDataSingleInteger(providerDataRef, DataFieldHandle(0u), 14);
+    EXPECT_NE(version2, scene.getProviderDataVersion(providerDataRef));
+}
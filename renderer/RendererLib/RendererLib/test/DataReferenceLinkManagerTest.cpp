@@ -312,6 +312,67 @@ TEST_F(ADataReferenceLinkManager, confidenceTest_createTwoLinksChangeValueAndUnl
     expectDataValue(providerDataRef, providerScene, 123.f);
 }
 
+TEST_F(ADataReferenceLinkManager, propagatesOnlyChangedProviderValues)
+{
+    setDataValue(providerDataRef, providerScene, 666.f);
+    setDataValue(consumerDataRef, consumerScene, -1.f);
+
+    sceneLinksManager.createDataLink(providerSceneId, providerId, consumerSceneId, consumerId);
+    expectRendererEvent(ERendererEventType_SceneDataLinked, providerSceneId, providerId, consumerSceneId, consumerId);
+
+    DataReferenceLinkManager::ResolveStatistics statistics = dataReferenceLinkManager.resolveLinksForConsumerScene(consumerScene);
+    EXPECT_EQ(1u, statistics.checkedLinks);
+    EXPECT_EQ(1u, statistics.propagatedLinks);
+    expectDataValue(consumerDataRef, consumerScene, 666.f);
+
+    statistics = dataReferenceLinkManager.resolveLinksForConsumerScene(consumerScene);
+    EXPECT_EQ(1u, statistics.checkedLinks);
+    EXPECT_EQ(0u, statistics.propagatedLinks);
+    expectDataValue(consumerDataRef, consumerScene, 666.f);
+
+    setDataValue(providerDataRef, providerScene, 123.f);
+    statistics = dataReferenceLinkManager.resolveLinksForConsumerScene(consumerScene);
+    EXPECT_EQ(1u, statistics.checkedLinks);
+    EXPECT_EQ(1u, statistics.propagatedLinks);
+    expectDataValue(consumerDataRef, consumerScene, 123.f);
+}
+
+TEST_F(ADataReferenceLinkManager, propagatesUnchangedProviderValueAgainIfConsumerValueOverwritten)
+{
+    setDataValue(providerDataRef, providerScene, 666.f);
+    setDataValue(consumerDataRef, consumerScene, -1.f);
+
+    sceneLinksManager.createDataLink(providerSceneId, providerId, consumerSceneId, consumerId);
+    expectRendererEvent(ERendererEventType_SceneDataLinked, providerSceneId, providerId, consumerSceneId, consumerId);
+
+    dataReferenceLinkManager.resolveLinksForConsumerScene(consumerScene);
+    expectDataValue(consumerDataRef, consumerScene, 666.f);
+
+    setDataValue(consumerDataRef, consumerScene, -333.f);
+    const DataReferenceLinkManager::ResolveStatistics statistics = dataReferenceLinkManager.resolveLinksForConsumerScene(consumerScene);
+    EXPECT_EQ(1u, statistics.propagatedLinks);
+    expectDataValue(consumerDataRef, consumerScene, 666.f);
+}
+
+TEST_F(ADataReferenceLinkManager, propagatesUnchangedProviderValueAfterRelink)
+{
+    setDataValue(providerDataRef, providerScene, 666.f);
+    setDataValue(consumerDataRef, consumerScene, -1.f);
+
+    sceneLinksManager.createDataLink(providerSceneId, providerId, consumerSceneId, consumerId);
+    expectRendererEvent(ERendererEventType_SceneDataLinked, providerSceneId, providerId, consumerSceneId, consumerId);
+    dataReferenceLinkManager.resolveLinksForConsumerScene(consumerScene);
+
+    sceneLinksManager.removeDataLink(consumerSceneId, consumerId);
+    expectRendererEvent(ERendererEventType_SceneDataUnlinked, consumerSceneId, consumerId);
+    expectDataValue(consumerDataRef, consumerScene, -1.f);
+
+    sceneLinksManager.createDataLink(providerSceneId, providerId, consumerSceneId, consumerId);
+    expectRendererEvent(ERendererEventType_SceneDataLinked, providerSceneId, providerId, consumerSceneId, consumerId);
+    dataReferenceLinkManager.resolveLinksForConsumerScene(consumerScene);
+    expectDataValue(consumerDataRef, consumerScene, 666.f);
+}
+
 template <typename T>
 class ADataReferenceLinkManagerTyped : public ADataReferenceLinkManager
 {
@@ -0,0 +1,263 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "renderer_common_gmock_header.h"
+#include "RendererLib/DirtyRegionTracker.h"
+#include "RendererLib/RendererCachedScene.h"
+#include "RendererLib/RendererScenes.h"
+#include "RendererEventCollector.h"
+#include "RendererResourceManagerMock.h"
+#include "EmbeddedCompositingManagerMock.h"
+#include "SceneAllocateHelper.h"
+#include "SceneAPI/Camera.h"
+#include "Math3d/CameraMatrixHelper.h"
+
+namespace ramses_internal
+{
+    using namespace testing;
+
+    class ADirtyRegionTracker : public ::testing::Test
+    {
+    public:
+        ADirtyRegionTracker()
+            : rendererScenes(rendererEventCollector)
+            , scene(rendererScenes.createScene(SceneInfo()))
+            , sceneAllocator(scene)
+        {
+            DataFieldInfoVector geometryDataFields(2u);
+            geometryDataFields[indicesField.asMemoryHandle()] = DataFieldInfo(EDataType_Indices, 1u, EFixedSemantics_Indices);
+            geometryDataFields[positionsField.asMemoryHandle()] = DataFieldInfo(EDataType_Vector3Buffer, 1u, EFixedSemantics_VertexPositionAttribute);
+            geometryLayout = sceneAllocator.allocateDataLayout(geometryDataFields);
+
+            DataFieldInfoVector uniformDataFields(2u);
+            uniformDataFields[colorField.asMemoryHandle()] = DataFieldInfo(EDataType_Float);
+            uniformDataFields[mvpField.asMemoryHandle()] = DataFieldInfo(EDataType_Matrix44F, 1u, EFixedSemantics_ModelViewProjectionMatrix);
+            uniformLayout = sceneAllocator.allocateDataLayout(uniformDataFields);
+
+            DataFieldInfoVector uniformWithoutMvpDataFields(1u);
+            uniformWithoutMvpDataFields[colorField.asMemoryHandle()] = DataFieldInfo(EDataType_Float);
+            uniformWithoutMvpLayout = sceneAllocator.allocateDataLayout(uniformWithoutMvpDataFields);
+
+            pass = sceneAllocator.allocateRenderPass();
+            camera = sceneAllocator.allocateCamera(ECameraProjectionType_Orthographic, sceneAllocator.allocateNode());
+            scene.setCameraViewport(camera, cameraViewport);
+            scene.setCameraFrustum(camera, Frustum(-1.f, 1.f, -1.f, 1.f, 0.1f, 10.f));
+            scene.setRenderPassCamera(pass, camera);
+            renderGroup = sceneAllocator.allocateRenderGroup();
+            scene.addRenderGroupToRenderPass(pass, renderGroup, 0);
+
+            ON_CALL(resourceManager, getClientResourceVertexBounds(verticesHash, _, _)).WillByDefault(DoAll(SetArgReferee<1>(Vector3(-0.5f, -0.5f, -1.f)), SetArgReferee<2>(Vector3(0.f, 0.f, -1.f)), Return(true)));
+        }
+
+    protected:
+        RenderableHandle createRenderable(DataLayoutHandle uniforms, Int32 order = 0)
+        {
+            const NodeHandle node = sceneAllocator.allocateNode();
+            const RenderableHandle renderable = sceneAllocator.allocateRenderable(node);
+            transforms.put(renderable, sceneAllocator.allocateTransform(node));
+            scene.addRenderableToRenderGroup(renderGroup, renderable, order);
+            scene.setRenderableEffect(renderable, ResourceContentHash(1u, 0u));
+
+            const DataInstanceHandle geometry = sceneAllocator.allocateDataInstance(geometryLayout);
+            scene.setDataResource(geometry, indicesField, ResourceContentHash(2u, 0u), DataBufferHandle::Invalid(), 0u);
+            scene.setDataResource(geometry, positionsField, verticesHash, DataBufferHandle::Invalid(), 0u);
+            scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Geometry, geometry);
+            scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Uniforms, sceneAllocator.allocateDataInstance(uniforms));
+
+            return renderable;
+        }
+
+        Quad update()
+        {
+            scene.updateRenderablesAndResourceCache(resourceManager, embeddedCompositingManager);
+            scene.updateRenderableWorldMatrices();
+            return tracker.updateSceneAndGetDirtyRegion(scene, resourceManager, bufferRegion, Matrix44f::Identity, ProjectionParams::Frustum(ECameraProjectionType_Perspective, -1.f, 1.f, -1.f, 1.f, 1.f, 10.f));
+        }
+
+        RendererEventCollector rendererEventCollector;
+        RendererScenes rendererScenes;
+        RendererCachedScene& scene;
+        SceneAllocateHelper sceneAllocator;
+        NiceMock<RendererResourceManagerMock> resourceManager;
+        NiceMock<EmbeddedCompositingManagerMock> embeddedCompositingManager;
+        DirtyRegionTracker tracker;
+
+        const DataFieldHandle indicesField{ 0u };
+        const DataFieldHandle positionsField{ 1u };
+        const DataFieldHandle colorField{ 0u };
+        const DataFieldHandle mvpField{ 1u };
+        const ResourceContentHash verticesHash{ 3u, 0u };
+        const Viewport cameraViewport{ 0, 0, 100u, 100u };
+        const Quad bufferRegion{ 0, 0, 200, 200 };
+        // bounds of vertices from resource manager projected by camera to the viewport of camera
+        const Quad renderableScreenBounds{ 24, 24, 27, 27 };
+
+        DataLayoutHandle geometryLayout;
+        DataLayoutHandle uniformLayout;
+        DataLayoutHandle uniformWithoutMvpLayout;
+        RenderPassHandle pass;
+        CameraHandle camera;
+        RenderGroupHandle renderGroup;
+        HashMap<RenderableHandle, TransformHandle> transforms;
+    };
+
+    TEST_F(ADirtyRegionTracker, projectsBoundsToViewportWithOnePixelBorder)
+    {
+        const Quad viewport(10, 20, 100, 100);
+        EXPECT_EQ(Quad(34, 44, 27, 27), DirtyRegionTracker::GetScreenBounds(Matrix44f::Identity, Vector3(-0.5f, -0.5f, 0.f), Vector3(0.f, 0.f, 0.f), viewport));
+        EXPECT_EQ(Quad(10, 20, 26, 100), DirtyRegionTracker::GetScreenBounds(Matrix44f::Identity, Vector3(-3.f, -3.f, 0.f), Vector3(-0.5f, 3.f, 0.f), viewport));
+    }
+
+    TEST_F(ADirtyRegionTracker, usesViewportForBoundsReachingBehindCamera)
+    {
+        const Quad viewport(10, 20, 100, 100);
+        const Matrix44f projection = CameraMatrixHelper::ProjectionMatrix(ProjectionParams::Frustum(ECameraProjectionType_Perspective, -1.f, 1.f, -1.f, 1.f, 1.f, 10.f));
+        EXPECT_EQ(viewport, DirtyRegionTracker::GetScreenBounds(projection, Vector3(-0.5f, -0.5f, -2.f), Vector3(0.f, 0.f, 1.f), viewport));
+    }
+
+    TEST_F(ADirtyRegionTracker, returnsWholeBufferForNewlyTrackedScene)
+    {
+        createRenderable(uniformLayout);
+        EXPECT_EQ(bufferRegion, update());
+    }
+
+    TEST_F(ADirtyRegionTracker, returnsEmptyRegionIfNothingChanged)
+    {
+        createRenderable(uniformLayout);
+        update();
+        EXPECT_TRUE(update().isEmpty());
+    }
+
+    TEST_F(ADirtyRegionTracker, returnsScreenBoundsOfAddedRenderable)
+    {
+        createRenderable(uniformLayout);
+        update();
+
+        createRenderable(uniformLayout);
+        EXPECT_EQ(renderableScreenBounds, update());
+    }
+
+    TEST_F(ADirtyRegionTracker, returnsOldAndNewScreenBoundsOfMovedRenderable)
+    {
+        const RenderableHandle renderable = createRenderable(uniformLayout);
+        update();
+
+        scene.setTranslation(*transforms.get(renderable), Vector3(0.5f, 0.f, 0.f));
+        EXPECT_EQ(Quad(24, 24, 52, 27), update());
+    }
+
+    TEST_F(ADirtyRegionTracker, returnsScreenBoundsOfRenderableWithChangedUniform)
+    {
+        const RenderableHandle renderable = createRenderable(uniformLayout);
+        update();
+
+        scene.setDataSingleFloat(scene.getRenderable(renderable).dataInstances[ERenderableDataSlotType_Uniforms], colorField, 0.5f);
+        EXPECT_EQ(renderableScreenBounds, update());
+    }
+
+    TEST_F(ADirtyRegionTracker, returnsCameraViewportForChangedRenderableWithoutModelViewProjectionSemantics)
+    {
+        const RenderableHandle renderable = createRenderable(uniformWithoutMvpLayout);
+        update();
+
+        scene.setDataSingleFloat(scene.getRenderable(renderable).dataInstances[ERenderableDataSlotType_Uniforms], colorField, 0.5f);
+        EXPECT_EQ(Quad(0, 0, 100, 100), update());
+    }
+
+    TEST_F(ADirtyRegionTracker, returnsCameraViewportForChangedRenderableWithUnknownVertexBounds)
+    {
+        const RenderableHandle renderable = createRenderable(uniformLayout);
+        update();
+
+        EXPECT_CALL(resourceManager, getClientResourceVertexBounds(verticesHash, _, _)).WillOnce(Return(false));
+        scene.setDataSingleFloat(scene.getRenderable(renderable).dataInstances[ERenderableDataSlotType_Uniforms], colorField, 0.5f);
+        EXPECT_EQ(Quad(0, 0, 100, 100), update());
+    }
+
+    TEST_F(ADirtyRegionTracker, returnsScreenBoundsOfHiddenRenderable)
+    {
+        createRenderable(uniformLayout);
+        const RenderableHandle renderable = createRenderable(uniformLayout);
+        scene.setTranslation(*transforms.get(renderable), Vector3(0.5f, 0.f, 0.f));
+        update();
+
+        scene.setRenderableVisibility(renderable, false);
+        EXPECT_EQ(Quad(49, 24, 27, 27), update());
+    }
+
+    TEST_F(ADirtyRegionTracker, returnsScreenBoundsOfRenderablesWhichChangedOrder)
+    {
+        const RenderableHandle renderable1 = createRenderable(uniformLayout, 0);
+        const RenderableHandle renderable2 = createRenderable(uniformLayout, 1);
+        createRenderable(uniformLayout, 2);
+        scene.setTranslation(*transforms.get(renderable2), Vector3(0.5f, 0.f, 0.f));
+        update();
+
+        scene.removeRenderableFromRenderGroup(renderGroup, renderable1);
+        scene.addRenderableToRenderGroup(renderGroup, renderable1, 3);
+        EXPECT_EQ(renderableScreenBounds, update());
+    }
+
+    TEST_F(ADirtyRegionTracker, returnsWholeBufferIfCameraChanged)
+    {
+        createRenderable(uniformLayout);
+        update();
+
+        scene.setCameraViewport(camera, { 0, 0, 50u, 50u });
+        EXPECT_EQ(bufferRegion, update());
+        EXPECT_TRUE(update().isEmpty());
+    }
+
+    TEST_F(ADirtyRegionTracker, returnsWholeBufferForSceneRenderingIntoRenderTarget)
+    {
+        createRenderable(uniformLayout);
+        update();
+
+        const RenderTargetHandle renderTarget = sceneAllocator.allocateRenderTarget();
+        scene.setRenderPassRenderTarget(pass, renderTarget);
+        EXPECT_TRUE(DirtyRegionTracker::RendersIntoOffscreenTargets(scene));
+        EXPECT_EQ(bufferRegion, update());
+        EXPECT_EQ(bufferRegion, update());
+    }
+
+    TEST_F(ADirtyRegionTracker, returnsWholeBufferForSceneWhichWasUntracked)
+    {
+        createRenderable(uniformLayout);
+        update();
+
+        tracker.untrackScene(scene.getSceneId());
+        EXPECT_EQ(bufferRegion, update());
+    }
+
+    TEST_F(ADirtyRegionTracker, redrawsWholeBufferIfBufferAgeUnknown)
+    {
+        EXPECT_EQ(bufferRegion, tracker.getRegionToRedraw(Quad(1, 1, 1, 1), 0u, bufferRegion));
+        tracker.frameRendered(Quad(1, 1, 1, 1));
+        EXPECT_EQ(bufferRegion, tracker.getRegionToRedraw(Quad(1, 1, 1, 1), 0u, bufferRegion));
+    }
+
+    TEST_F(ADirtyRegionTracker, redrawsRegionsChangedSinceFrameInBuffer)
+    {
+        tracker.frameRendered(Quad(10, 10, 10, 10));
+        tracker.frameRendered(Quad(0, 0, 5, 5));
+
+        EXPECT_EQ(Quad(50, 50, 10, 10), tracker.getRegionToRedraw(Quad(50, 50, 10, 10), 1u, bufferRegion));
+        EXPECT_EQ(Quad(0, 0, 60, 60), tracker.getRegionToRedraw(Quad(50, 50, 10, 10), 2u, bufferRegion));
+        EXPECT_EQ(Quad(0, 0, 60, 60), tracker.getRegionToRedraw(Quad(50, 50, 10, 10), 3u, bufferRegion));
+        EXPECT_EQ(bufferRegion, tracker.getRegionToRedraw(Quad(50, 50, 10, 10), 4u, bufferRegion));
+    }
+
+    TEST_F(ADirtyRegionTracker, keepsHistoryOfLimitedNumberOfFrames)
+    {
+        for (UInt32 i = 0u; i < DirtyRegionTracker::MaxBufferAge + 1u; ++i)
+            tracker.frameRendered(Quad(0, 0, 1, 1));
+
+        EXPECT_EQ(Quad(0, 0, 1, 1), tracker.getRegionToRedraw(Quad(0, 0, 1, 1), DirtyRegionTracker::MaxBufferAge + 1u, bufferRegion));
+        EXPECT_EQ(bufferRegion, tracker.getRegionToRedraw(Quad(0, 0, 1, 1), DirtyRegionTracker::MaxBufferAge + 2u, bufferRegion));
+    }
+}
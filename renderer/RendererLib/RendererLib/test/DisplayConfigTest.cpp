@@ -38,6 +38,8 @@ TEST_F(AInternalDisplayConfig, hasDefaultValues)
     EXPECT_TRUE(ramses_internal::InvalidIntegrityRGLDeviceUnit == m_config.getIntegrityRGLDeviceUnit());
     EXPECT_FALSE(m_config.getStartVisibleIvi());
     EXPECT_FALSE(m_config.isResizable());
+    EXPECT_FALSE(m_config.isPartialRedrawEnabled());
+    EXPECT_FALSE(m_config.isInstancedDrawBatchingEnabled());
     EXPECT_EQ(ramses_internal::ProjectionParams::Perspective(19.0f, 1280.f / 480.f, 0.1f, 1500.f), m_config.getProjectionParams());
     EXPECT_EQ(0u, m_config.getGPUMemoryCacheSize());
     EXPECT_EQ(ramses_internal::Vector4(0.f,0.f,0.f,1.f), m_config.getClearColor());
@@ -104,6 +106,12 @@ TEST_F(AInternalDisplayConfig, setAndGetValues)
     m_config.setResizable(false);
     EXPECT_FALSE(m_config.isResizable());
 
+    m_config.setPartialRedrawEnabled(true);
+    EXPECT_TRUE(m_config.isPartialRedrawEnabled());
+
+    m_config.setInstancedDrawBatchingEnabled(true);
+    EXPECT_TRUE(m_config.isInstancedDrawBatchingEnabled());
+
     ramses_internal::ProjectionParams projParams = ramses_internal::ProjectionParams::Frustum(ramses_internal::ECameraProjectionType_Orthographic,
         0.1f, 0.2f, 0.3f, 0.4f, 0.5f, 0.6f);
     m_config.setProjectionParams(projParams);
@@ -146,6 +154,8 @@ TEST_F(AInternalDisplayConfig, getsValuesAssignedFromCommandLine)
         "-bl",
         "-warp",
         "-ded",
+        "-pr",
+        "-idb",
         "-aa", "MSAA",
         "-as", "4",
         "-lid", "101",
@@ -195,6 +205,8 @@ TEST_F(AInternalDisplayConfig, getsValuesAssignedFromCommandLine)
     EXPECT_TRUE(config.getStartVisibleIvi());
     EXPECT_TRUE(config.isWarpingEnabled());
     EXPECT_TRUE(config.isEffectDeletionDisabled());
+    EXPECT_TRUE(config.isPartialRedrawEnabled());
+    EXPECT_TRUE(config.isInstancedDrawBatchingEnabled());
     EXPECT_TRUE(config.isResizable());
     EXPECT_TRUE(config.getOffscreen());
 }
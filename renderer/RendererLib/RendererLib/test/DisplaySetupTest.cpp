@@ -173,6 +173,22 @@ TEST_F(ADisplaySetup, canSetRerenderFlagOfABuffer)
     EXPECT_EQ(DeviceHandleVector{ bufferHandleOBint }, displaySetup.getInterruptibleOffscreenBuffersToRender(DeviceResourceHandle::Invalid()));
 }
 
+TEST_F(ADisplaySetup, accumulatesRegionToBeRerenderedUntilBufferIsRendered)
+{
+    const DeviceResourceHandle bufferHandleFB(33u);
+    displaySetup.registerDisplayBuffer(bufferHandleFB, viewport, clearColor, false, false);
+    displaySetup.setDisplayBufferToBeRerendered(bufferHandleFB, false);
+    EXPECT_TRUE(displaySetup.getDisplayBuffer(bufferHandleFB).partialRerenderRegion.isEmpty());
+
+    displaySetup.addDisplayBufferRegionToBeRerendered(bufferHandleFB, Quad(10, 10, 5, 5));
+    displaySetup.addDisplayBufferRegionToBeRerendered(bufferHandleFB, Quad(20, 0, 5, 5));
+    EXPECT_EQ(Quad(10, 0, 15, 15), displaySetup.getDisplayBuffer(bufferHandleFB).partialRerenderRegion);
+    EXPECT_FALSE(displaySetup.getDisplayBuffer(bufferHandleFB).needsRerender);
+
+    displaySetup.setDisplayBufferToBeRerendered(bufferHandleFB, false);
+    EXPECT_TRUE(displaySetup.getDisplayBuffer(bufferHandleFB).partialRerenderRegion.isEmpty());
+}
+
 TEST_F(ADisplaySetup, canMapAndUnmapSceneToBuffer)
 {
     const SceneId scene1(12u);
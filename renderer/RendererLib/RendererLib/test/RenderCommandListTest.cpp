@@ -0,0 +1,276 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "renderer_common_gmock_header.h"
+#include "RendererLib/RenderCommandList.h"
+#include "RendererLib/ParallelRenderCommandRecorder.h"
+#include "RendererLib/RendererCachedScene.h"
+#include "RendererLib/RendererScenes.h"
+#include "RendererLib/LoggingDevice.h"
+#include "RendererLib/RendererLogContext.h"
+#include "RendererEventCollector.h"
+#include "RendererResourceManagerMock.h"
+#include "EmbeddedCompositingManagerMock.h"
+#include "ResourceProviderMock.h"
+#include "DeviceMock.h"
+#include "SceneAllocateHelper.h"
+#include "RenderExecutor.h"
+
+namespace ramses_internal
+{
+    using namespace testing;
+
+    class ARenderCommandList : public ::testing::Test
+    {
+    protected:
+        StrictMock<DeviceMock> device;
+        RenderCommandList commands;
+    };
+
+    TEST_F(ARenderCommandList, isEmptyInitially)
+    {
+        EXPECT_EQ(0u, commands.getCommandCount());
+        commands.replay(device);
+    }
+
+    TEST_F(ARenderCommandList, replaysRecordedCommandsInOrder)
+    {
+        const DataFieldHandle field(3u);
+        const Vector4 color(0.1f, 0.2f, 0.3f, 0.4f);
+        const Matrix44f matrix = Matrix44f::RotationEulerZYX(Vector3(10.f, 20.f, 30.f));
+        const PixelRectangle srcRect{ 1u, 2u, 3, 4 };
+        const PixelRectangle dstRect{ 5u, 6u, 7, 8 };
+
+        commands.activateRenderTarget(DeviceMock::FakeRenderTargetDeviceHandle);
+        commands.setViewport(1u, 2u, 3u, 4u);
+        commands.clearColor(color);
+        commands.clear(EClearFlags_Color | EClearFlags_Depth);
+        commands.depthWrite(EDepthWrite::Disabled);
+        commands.stencilFunc(EStencilFunc::Equal, 5u, 0xf0);
+        commands.activateShader(DeviceMock::FakeShaderDeviceHandle);
+        commands.setConstant(field, 1u, &matrix);
+        commands.activateIndexBuffer(DeviceMock::FakeIndexBufferDeviceHandle);
+        commands.activateVertexBuffer(DeviceMock::FakeVertexBufferDeviceHandle, field, 2u);
+        commands.activateVertexArray(DeviceMock::FakeVertexArrayDeviceHandle);
+        commands.activateTexture(DeviceMock::FakeTextureDeviceHandle, field);
+        commands.setTextureSampling(field, EWrapMethod_Clamp, EWrapMethod_Repeat, EWrapMethod_RepeatMirrored, ESamplingMethod_Bilinear, 4u);
+        commands.setInstanceWorldMatrices(field, 1u, &matrix);
+        commands.drawIndexedTriangles(1, 2, 3u);
+        commands.blitRenderTargets(DeviceMock::FakeRenderTargetDeviceHandle, DeviceMock::FakeBlitPassRenderTargetDeviceHandle, srcRect, dstRect, true);
+        EXPECT_EQ(16u, commands.getCommandCount());
+
+        InSequence seq;
+        EXPECT_CALL(device, activateRenderTarget(DeviceMock::FakeRenderTargetDeviceHandle));
+        EXPECT_CALL(device, setViewport(1u, 2u, 3u, 4u));
+        EXPECT_CALL(device, clearColor(color));
+        EXPECT_CALL(device, clear(EClearFlags_Color | EClearFlags_Depth));
+        EXPECT_CALL(device, depthWrite(EDepthWrite::Disabled));
+        EXPECT_CALL(device, stencilFunc(EStencilFunc::Equal, 5u, 0xf0));
+        EXPECT_CALL(device, activateShader(DeviceMock::FakeShaderDeviceHandle));
+        EXPECT_CALL(device, setConstant(field, 1u, Matcher<const Matrix44f*>(Pointee(matrix))));
+        EXPECT_CALL(device, activateIndexBuffer(DeviceMock::FakeIndexBufferDeviceHandle));
+        EXPECT_CALL(device, activateVertexBuffer(DeviceMock::FakeVertexBufferDeviceHandle, field, 2u));
+        EXPECT_CALL(device, activateVertexArray(DeviceMock::FakeVertexArrayDeviceHandle));
+        EXPECT_CALL(device, activateTexture(DeviceMock::FakeTextureDeviceHandle, field));
+        EXPECT_CALL(device, setTextureSampling(field, EWrapMethod_Clamp, EWrapMethod_Repeat, EWrapMethod_RepeatMirrored, ESamplingMethod_Bilinear, 4u));
+        EXPECT_CALL(device, setInstanceWorldMatrices(field, 1u, Pointee(matrix)));
+        EXPECT_CALL(device, drawIndexedTriangles(1, 2, 3u));
+        EXPECT_CALL(device, blitRenderTargets(DeviceMock::FakeRenderTargetDeviceHandle, DeviceMock::FakeBlitPassRenderTargetDeviceHandle, Field(&PixelRectangle::width, 3), Field(&PixelRectangle::height, 8), true));
+        commands.replay(device);
+    }
+
+    TEST_F(ARenderCommandList, canBeReplayedMultipleTimes)
+    {
+        commands.drawTriangles(1, 2, 3u);
+
+        EXPECT_CALL(device, drawTriangles(1, 2, 3u)).Times(2u);
+        commands.replay(device);
+        commands.replay(device);
+    }
+
+    TEST_F(ARenderCommandList, copiesConstantValuesWhenRecorded)
+    {
+        const DataFieldHandle field(1u);
+        Float values[] = { 1.f, 2.f, 3.f };
+        commands.setConstant(field, 3u, values);
+        values[0] = 100.f;
+        values[2] = 300.f;
+
+        EXPECT_CALL(device, setConstant(field, 3u, Matcher<const Float*>(_))).WillOnce(Invoke([](DataFieldHandle, UInt32, const Float* replayedValues)
+        {
+            EXPECT_EQ(1.f, replayedValues[0]);
+            EXPECT_EQ(2.f, replayedValues[1]);
+            EXPECT_EQ(3.f, replayedValues[2]);
+        }));
+        commands.replay(device);
+    }
+
+    TEST_F(ARenderCommandList, replaysNothingAfterClearingCommands)
+    {
+        commands.drawTriangles(1, 2, 3u);
+        commands.clearCommands();
+        EXPECT_EQ(0u, commands.getCommandCount());
+        commands.replay(device);
+
+        commands.drawMode(EDrawMode::Lines);
+        EXPECT_EQ(1u, commands.getCommandCount());
+        EXPECT_CALL(device, drawMode(EDrawMode::Lines));
+        commands.replay(device);
+    }
+
+    class ARenderCommandListRecordingScenes : public ::testing::Test
+    {
+    public:
+        ARenderCommandListRecordingScenes()
+            : rendererScenes(rendererEventCollector)
+        {
+        }
+
+    protected:
+        RendererCachedScene& createScene(SceneId sceneId, Float color)
+        {
+            RendererCachedScene& scene = rendererScenes.createScene(SceneInfo(sceneId));
+            SceneAllocateHelper sceneAllocator(scene);
+
+            DataFieldInfoVector geometryDataFields(2u);
+            geometryDataFields[indicesField.asMemoryHandle()] = DataFieldInfo(EDataType_Indices, 1u, EFixedSemantics_Indices);
+            geometryDataFields[positionsField.asMemoryHandle()] = DataFieldInfo(EDataType_Vector3Buffer, 1u, EFixedSemantics_VertexPositionAttribute);
+            const DataLayoutHandle geometryLayout = sceneAllocator.allocateDataLayout(geometryDataFields);
+
+            DataFieldInfoVector uniformDataFields(2u);
+            uniformDataFields[colorField.asMemoryHandle()] = DataFieldInfo(EDataType_Float);
+            uniformDataFields[mvpField.asMemoryHandle()] = DataFieldInfo(EDataType_Matrix44F, 1u, EFixedSemantics_ModelViewProjectionMatrix);
+            const DataLayoutHandle uniformLayout = sceneAllocator.allocateDataLayout(uniformDataFields);
+
+            const RenderPassHandle pass = sceneAllocator.allocateRenderPass();
+            const CameraHandle camera = sceneAllocator.allocateCamera(ECameraProjectionType_Orthographic, sceneAllocator.allocateNode());
+            scene.setCameraViewport(camera, Viewport(0, 0, 100u, 100u));
+            scene.setCameraFrustum(camera, Frustum(-1.f, 1.f, -1.f, 1.f, 0.1f, 10.f));
+            scene.setRenderPassCamera(pass, camera);
+            scene.setRenderPassClearFlag(pass, EClearFlags_Color);
+            const RenderGroupHandle renderGroup = sceneAllocator.allocateRenderGroup();
+            scene.addRenderGroupToRenderPass(pass, renderGroup, 0);
+
+            for (Int32 i = 0; i < 3; ++i)
+            {
+                const NodeHandle node = sceneAllocator.allocateNode();
+                const TransformHandle transform = sceneAllocator.allocateTransform(node);
+                scene.setTranslation(transform, Vector3(Float(i), 0.f, -1.f));
+
+                const RenderableHandle renderable = sceneAllocator.allocateRenderable(node);
+                scene.addRenderableToRenderGroup(renderGroup, renderable, i);
+                scene.setRenderableRenderState(renderable, sceneAllocator.allocateRenderState());
+                scene.setRenderableEffect(renderable, ResourceProviderMock::FakeEffectHash);
+                scene.setRenderableIndexCount(renderable, 6u + i);
+
+                const DataInstanceHandle geometry = sceneAllocator.allocateDataInstance(geometryLayout);
+                scene.setDataResource(geometry, indicesField, ResourceProviderMock::FakeIndexArrayHash, DataBufferHandle::Invalid(), 0u);
+                scene.setDataResource(geometry, positionsField, ResourceProviderMock::FakeVertArrayHash, DataBufferHandle::Invalid(), 0u);
+                scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Geometry, geometry);
+
+                const DataInstanceHandle uniforms = sceneAllocator.allocateDataInstance(uniformLayout);
+                scene.setDataSingleFloat(uniforms, colorField, color + Float(i));
+                scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Uniforms, uniforms);
+            }
+
+            scene.updateRenderablesAndResourceCache(resourceManager, embeddedCompositingManager);
+            scene.updateRenderableWorldMatrices();
+
+            return scene;
+        }
+
+        String renderDirectly(const RendererCachedScene& scene)
+        {
+            RendererLogContext logContext(ERendererLogLevelFlag_Details);
+            LoggingDevice loggingDevice(delegateDevice, logContext);
+            const RenderExecutor executor(loggingDevice, frameBuffer);
+            executor.executeScene(scene, rendererViewMatrix);
+            return logContext.getStream().c_str();
+        }
+
+        String replay(const RenderCommandList& recordedCommands)
+        {
+            RendererLogContext logContext(ERendererLogLevelFlag_Details);
+            LoggingDevice loggingDevice(delegateDevice, logContext);
+            recordedCommands.replay(loggingDevice);
+            return logContext.getStream().c_str();
+        }
+
+        RendererEventCollector rendererEventCollector;
+        RendererScenes rendererScenes;
+        NiceMock<RendererResourceManagerMock> resourceManager;
+        NiceMock<EmbeddedCompositingManagerMock> embeddedCompositingManager;
+        NiceMock<DeviceMock> delegateDevice;
+
+        const FrameBufferInfo frameBuffer{ DeviceMock::FakeFrameBufferRenderTargetDeviceHandle, ProjectionParams::Perspective(19.f, 1.f, 0.1f, 100.f), Viewport(0, 0, 200u, 200u) };
+        const Matrix44f rendererViewMatrix = Matrix44f::Translation(Vector3(1.f, 2.f, 3.f));
+
+        const DataFieldHandle indicesField{ 0u };
+        const DataFieldHandle positionsField{ 1u };
+        const DataFieldHandle colorField{ 0u };
+        const DataFieldHandle mvpField{ 1u };
+    };
+
+    TEST_F(ARenderCommandListRecordingScenes, replaysSameCommandsAsSceneRenderedDirectly)
+    {
+        const RendererCachedScene& scene = createScene(SceneId(1u), 0.5f);
+        const String expectedLog = renderDirectly(scene);
+        EXPECT_NE(String(), expectedLog);
+
+        RenderCommandList recordedCommands;
+        const RenderExecutor executor(recordedCommands, frameBuffer);
+        executor.executeScene(scene, rendererViewMatrix);
+        EXPECT_LT(0u, recordedCommands.getCommandCount());
+
+        EXPECT_EQ(expectedLog, replay(recordedCommands));
+    }
+
+    TEST_F(ARenderCommandListRecordingScenes, recordsMultipleScenesInParallel)
+    {
+        std::vector<const RendererCachedScene*> scenes;
+        std::vector<String> expectedLogs;
+        for (UInt32 i = 0u; i < 5u; ++i)
+        {
+            scenes.push_back(&createScene(SceneId(i + 1u), Float(i)));
+            expectedLogs.push_back(renderDirectly(*scenes.back()));
+        }
+
+        ParallelRenderCommandRecorder recorder(2u);
+        for (UInt32 frame = 0u; frame < 3u; ++frame)
+        {
+            recorder.reset();
+            for (const auto scene : scenes)
+                recorder.addScene(*scene, frameBuffer, rendererViewMatrix);
+            EXPECT_EQ(5u, recorder.getSceneCount());
+            recorder.recordScenes();
+
+            for (UInt32 i = 0u; i < 5u; ++i)
+            {
+                const RenderCommandList* recordedCommands = recorder.getRecordedCommands(SceneId(i + 1u));
+                ASSERT_TRUE(recordedCommands != nullptr);
+                EXPECT_EQ(expectedLogs[i], replay(*recordedCommands));
+            }
+        }
+    }
+
+    TEST_F(ARenderCommandListRecordingScenes, providesNoCommandsForSceneNotAddedToRecording)
+    {
+        const RendererCachedScene& scene = createScene(SceneId(1u), 0.5f);
+        createScene(SceneId(2u), 0.5f);
+
+        ParallelRenderCommandRecorder recorder(1u);
+        recorder.addScene(scene, frameBuffer, rendererViewMatrix);
+        recorder.recordScenes();
+        EXPECT_TRUE(recorder.getRecordedCommands(SceneId(1u)) != nullptr);
+        EXPECT_TRUE(recorder.getRecordedCommands(SceneId(2u)) == nullptr);
+
+        recorder.reset();
+        EXPECT_EQ(0u, recorder.getSceneCount());
+        EXPECT_TRUE(recorder.getRecordedCommands(SceneId(1u)) == nullptr);
+    }
+}
@@ -15,6 +15,7 @@
 #include "RendererLib/RendererCachedScene.h"
 #include "RendererLib/Renderer.h"
 #include "RendererLib/RendererScenes.h"
+#include "RendererLib/RendererStatistics.h"
 #include "SceneUtils/DataLayoutCreationHelper.h"
 #include "RendererEventCollector.h"
 #include "SceneAllocateHelper.h"
@@ -254,6 +255,25 @@ protected:
         return dataInstances;
     }
 
+    // uniforms do not depend on model matrix, world matrix is provided as instanced attribute instead
+    DataInstances createBatchableTestDataInstance()
+    {
+        DataFieldInfoVector uniformFields(1u);
+        uniformFields[0u] = DataFieldInfo(EDataType_Float);
+        DataFieldInfoVector geometryFields(3u);
+        geometryFields[0u] = DataFieldInfo(EDataType_Indices, 1u, EFixedSemantics_Indices);
+        geometryFields[1u] = DataFieldInfo(EDataType_Vector3Buffer, 1u, EFixedSemantics_VertexPositionAttribute);
+        geometryFields[2u] = DataFieldInfo(EDataType_Matrix44F, 1u, EFixedSemantics_InstanceWorldMatrixAttribute);
+
+        DataInstances dataInstances;
+        dataInstances.first = sceneAllocator.allocateDataInstance(sceneAllocator.allocateDataLayout(uniformFields));
+        dataInstances.second = sceneAllocator.allocateDataInstance(sceneAllocator.allocateDataLayout(geometryFields));
+        scene.setDataResource(dataInstances.second, DataFieldHandle(0u), ResourceProviderMock::FakeIndexArrayHash, DataBufferHandle::Invalid(), 0u);
+        scene.setDataResource(dataInstances.second, DataFieldHandle(1u), ResourceProviderMock::FakeVertArrayHash, DataBufferHandle::Invalid(), 0u);
+
+        return dataInstances;
+    }
+
     RenderGroupHandle createRenderGroup(RenderPassHandle pass)
     {
         const RenderGroupHandle renderGroup = sceneAllocator.allocateRenderGroup();
@@ -329,6 +349,18 @@ protected:
         expectFrameRenderCommands(renderable, expectedModelMatrix, expectedRendererViewMatrix, expectedCameraViewMatrix, projMatrix);
     }
 
+    // uniforms expected to be set to device, shader program skips values it already holds from previous renderable
+    enum ExpectedUniforms : UInt32
+    {
+        ExpectedUniforms_None               = 0u,
+        ExpectedUniforms_Data               = BIT(0),
+        ExpectedUniforms_ModelMatrix        = BIT(1),
+        ExpectedUniforms_RendererViewMatrix = BIT(2),
+        ExpectedUniforms_CameraViewMatrix   = BIT(3),
+        ExpectedUniforms_ProjectionMatrix   = BIT(4),
+        ExpectedUniforms_All                = 0xffffffff
+    };
+
     void expectFrameRenderCommands(RenderableHandle /*renderable*/,
         Matrix44f expectedModelMatrix = Matrix44f::Identity,
         Matrix44f expectedRendererViewMatrix = Matrix44f::Identity,
@@ -338,7 +370,10 @@ protected:
         bool expectRenderStateChanges = true,
         bool expectIndexBufferActivation = true,
         UInt32 instanceCount = 1u,
-        bool expectIndexedRendering = true)
+        bool expectIndexedRendering = true,
+        UInt32 expectedUniforms = ExpectedUniforms_All,
+        bool usesVertexArray = false,
+        bool expectVertexArrayActivation = true)
     {
         // TODO violin this is not entirely needed, only need to check that draw call is at the end of the commands
         InSequence seq;
@@ -366,17 +401,32 @@ protected:
         {
             EXPECT_CALL(device, activateShader(FakeShaderDeviceHandle))                                                                           .RetiresOnSaturation();
         }
-        EXPECT_CALL(device, activateVertexBuffer(FakeVertexBufferDeviceHandle, fakeEffectInputs.vertPosField, 3u))                                                                 .RetiresOnSaturation();
-        EXPECT_CALL(device, activateVertexBuffer(FakeVertexBufferDeviceHandle, fakeEffectInputs.vertTexcoordField, 4u))                                                            .RetiresOnSaturation();
-        EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefField1, 1, Matcher<const Float*>(Pointee(Eq(0.1f)))))                                             .RetiresOnSaturation();
-        EXPECT_CALL(device, setConstant(fieldModelMatrix, 1, Matcher<const Matrix44f*>(Pointee(PermissiveMatrixEq(expectedModelMatrix)))))                  .RetiresOnSaturation();
-        EXPECT_CALL(device, setConstant(fieldRendererViewMatrix, 1, Matcher<const Matrix44f*>(Pointee(PermissiveMatrixEq(expectedRendererViewMatrix)))))    .RetiresOnSaturation();
-        EXPECT_CALL(device, setConstant(fieldCameraViewMatrix, 1, Matcher<const Matrix44f*>(Pointee(PermissiveMatrixEq(expectedCameraViewMatrix)))))        .RetiresOnSaturation();
-        EXPECT_CALL(device, setConstant(fieldProjMatrix, 1, Matcher<const Matrix44f*>(Pointee(PermissiveMatrixEq(expectedProjMatrix)))))                    .RetiresOnSaturation();
+        if (!usesVertexArray)
+        {
+            EXPECT_CALL(device, activateVertexBuffer(FakeVertexBufferDeviceHandle, fakeEffectInputs.vertPosField, 3u))                                                             .RetiresOnSaturation();
+            EXPECT_CALL(device, activateVertexBuffer(FakeVertexBufferDeviceHandle, fakeEffectInputs.vertTexcoordField, 4u))                                                        .RetiresOnSaturation();
+        }
+        else if (expectVertexArrayActivation)
+        {
+            EXPECT_CALL(device, activateVertexArray(DeviceMock::FakeVertexArrayDeviceHandle))                                                                     .RetiresOnSaturation();
+        }
+        if (expectedUniforms & ExpectedUniforms_Data)
+            EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefField1, 1, Matcher<const Float*>(Pointee(Eq(0.1f)))))                                         .RetiresOnSaturation();
+        if (expectedUniforms & ExpectedUniforms_ModelMatrix)
+            EXPECT_CALL(device, setConstant(fieldModelMatrix, 1, Matcher<const Matrix44f*>(Pointee(PermissiveMatrixEq(expectedModelMatrix)))))              .RetiresOnSaturation();
+        if (expectedUniforms & ExpectedUniforms_RendererViewMatrix)
+            EXPECT_CALL(device, setConstant(fieldRendererViewMatrix, 1, Matcher<const Matrix44f*>(Pointee(PermissiveMatrixEq(expectedRendererViewMatrix))))).RetiresOnSaturation();
+        if (expectedUniforms & ExpectedUniforms_CameraViewMatrix)
+            EXPECT_CALL(device, setConstant(fieldCameraViewMatrix, 1, Matcher<const Matrix44f*>(Pointee(PermissiveMatrixEq(expectedCameraViewMatrix)))))    .RetiresOnSaturation();
+        if (expectedUniforms & ExpectedUniforms_ProjectionMatrix)
+            EXPECT_CALL(device, setConstant(fieldProjMatrix, 1, Matcher<const Matrix44f*>(Pointee(PermissiveMatrixEq(expectedProjMatrix)))))                .RetiresOnSaturation();
         EXPECT_CALL(device, activateTexture(FakeTextureDeviceHandle, textureField))                                                                         .RetiresOnSaturation();
         EXPECT_CALL(device, setTextureSampling(textureField, EWrapMethod_Clamp, EWrapMethod_Repeat, EWrapMethod_RepeatMirrored, ESamplingMethod_NearestWithMipmaps, 2u)).RetiresOnSaturation();
-        EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefField2, 1, Matcher<const Float*>(Pointee(Eq(-666.f)))))                                           .RetiresOnSaturation();
-        EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefFieldMatrix22f, 1, Matcher<const Matrix22f*>(Pointee(Eq(Matrix22f(1,2,3,4))))))                   .RetiresOnSaturation();
+        if (expectedUniforms & ExpectedUniforms_Data)
+        {
+            EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefField2, 1, Matcher<const Float*>(Pointee(Eq(-666.f)))))                                       .RetiresOnSaturation();
+            EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefFieldMatrix22f, 1, Matcher<const Matrix22f*>(Pointee(Eq(Matrix22f(1,2,3,4))))))               .RetiresOnSaturation();
+        }
         if (expectIndexBufferActivation)
         {
             EXPECT_CALL(device, activateIndexBuffer(FakeIndexBufferDeviceHandle))                                                                           .RetiresOnSaturation();
@@ -447,6 +497,13 @@ protected:
 
         return executor.executeScene(scene, Matrix44f::Identity);
     }
+
+    void executeSceneOnDevice(IDevice& targetDevice, Bool instancedDrawBatching)
+    {
+        const FrameBufferInfo fbInfo(DeviceMock::FakeFrameBufferRenderTargetDeviceHandle, projectionParams, Viewport(fakeViewportX, fakeViewportY, fakeViewportWidth, fakeViewportHeight));
+        const RenderExecutor executor(targetDevice, fbInfo, {}, nullptr, instancedDrawBatching);
+        executor.executeScene(scene, Matrix44f::Identity);
+    }
 };
 
 TEST(CustomMatrixPrinter, PrintsMatrixValuesNotAByteString)
@@ -503,6 +560,31 @@ TEST_F(ARenderExecutor, RenderRenderableWithoutIndexArray)
     executeScene();
 }
 
+TEST_F(ARenderExecutor, ActivatesCachedVertexArrayInsteadOfVertexAndIndexBuffers)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera();
+    const RenderGroupHandle renderGroup = createRenderGroup(pass);
+    const RenderableHandle renderable1 = createTestRenderable(createTestDataInstance(), renderGroup);
+    const RenderableHandle renderable2 = createTestRenderable(createTestDataInstance(), renderGroup);
+    scene.setRenderPassClearFlag(pass, ramses_internal::EClearFlags::EClearFlags_None);
+    const Matrix44f expectedProjectionMatrix = CameraMatrixHelper::ProjectionMatrix(projectionParams);
+
+    updateScenes();
+    RendererStatistics statistics;
+    scene.updateVertexArrays(resourceManager, statistics);
+
+    {
+        InSequence seq;
+
+        // both renderables get same fake vertex array from resource manager, so it is activated only once
+        expectActivateFramebufferRenderTarget();
+        expectFrameRenderCommands(renderable1, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix, true, true, false, 1u, true, ExpectedUniforms_All, true);
+        expectFrameRenderCommands(renderable2, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix, false, false, false, 1u, true, ExpectedUniforms_None, true, false);
+    }
+
+    executeScene();
+}
+
 TEST_F(ARenderExecutor, RenderMultipleConsecutiveRenderPassesIntoOneRenderTarget)
 {
     const RenderPassHandle pass1 = createRenderPassWithCamera(ECameraProjectionType_Perspective);
@@ -531,7 +613,7 @@ TEST_F(ARenderExecutor, RenderMultipleConsecutiveRenderPassesIntoOneRenderTarget
         expectActivateRenderTarget(renderTargetDeviceHandle);
         expectClearRenderTarget();
         expectFrameRenderCommands(renderable1, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix);
-        expectFrameRenderCommands(renderable2, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix, false, false, false);
+        expectFrameRenderCommands(renderable2, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix, false, false, false, 1u, true, ExpectedUniforms_None);
     }
 
     executeScene();
@@ -570,7 +652,7 @@ TEST_F(ARenderExecutor, RenderMultipleRenderPassesIntoMultipleRenderTargets)
         expectFrameRenderCommands(renderable1, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix1);
         expectActivateRenderTarget(renderTargetDeviceHandle2, true, fakeVp2);
         expectClearRenderTarget();
-        expectFrameRenderCommands(renderable2, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix2, false, false, false);
+        expectFrameRenderCommands(renderable2, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix2, false, false, false, 1u, true, ExpectedUniforms_None);
     }
 
     executeScene();
@@ -768,7 +850,7 @@ TEST_F(ARenderExecutor, RendersRenderableInTwoPassesUsingTheSameCamera)
     // reversed order because of google mock convention
     expectActivateFramebufferRenderTarget();
     const Matrix44f projMatrix = CameraMatrixHelper::ProjectionMatrix(projectionParams);
-    expectFrameRenderCommands(renderable2, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Translation(Vector3(-4.f, -5.f, -6.f)), projMatrix, false, false, false);
+    expectFrameRenderCommands(renderable2, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Translation(Vector3(-4.f, -5.f, -6.f)), projMatrix, false, false, false, 1u, true, ExpectedUniforms_CameraViewMatrix);
     expectFrameRenderCommands(renderable1, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Translation(Vector3(-1.f, -2.f, -3.f)), projMatrix);
     executeScene();
     Mock::VerifyAndClearExpectations(&device);
@@ -786,7 +868,7 @@ TEST_F(ARenderExecutor, RenderStatesAppliedOnceIfSameForMultipleRenderables)
     const Matrix44f projMatrix = CameraMatrixHelper::ProjectionMatrix(projectionParams);
     // reversed order because of google mock convention
     expectActivateFramebufferRenderTarget();
-    expectFrameRenderCommands(renderable2, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, projMatrix, false, false, false);
+    expectFrameRenderCommands(renderable2, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, projMatrix, false, false, false, 1u, true, ExpectedUniforms_None);
     expectFrameRenderCommands(renderable1, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, projMatrix);
 
     executeScene();
@@ -815,11 +897,130 @@ TEST_F(ARenderExecutor, RenderStatesAppliedForEachRenderableIfDifferent)
     const Matrix44f projMatrix = CameraMatrixHelper::ProjectionMatrix(projectionParams);
     // reversed order because of google mock convention
     expectActivateFramebufferRenderTarget();
-    expectFrameRenderCommands(renderable2, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, projMatrix, false, true, false);
+    expectFrameRenderCommands(renderable2, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, projMatrix, false, true, false, 1u, true, ExpectedUniforms_None);
+    expectFrameRenderCommands(renderable1, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, projMatrix);
+
+    executeScene();
+    Mock::VerifyAndClearExpectations(&device);
+}
+
+TEST_F(ARenderExecutor, SetsOnlyUniformsWithValueNotHeldByShaderProgramYet)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera();
+    const RenderGroupHandle group = createRenderGroup(pass);
+    const DataInstances dataInstances = createTestDataInstance();
+    const RenderableHandle renderable1 = createTestRenderable(dataInstances, group);
+    const RenderableHandle renderable2 = createTestRenderable(dataInstances, group);
+    addTransformToRenderable(renderable2);
+    scene.setTranslation(findTransformForNode(scene.getRenderable(renderable2).node), Vector3(1.f, 2.f, 3.f));
+    updateScenes();
+
+    const Matrix44f projMatrix = CameraMatrixHelper::ProjectionMatrix(projectionParams);
+    // reversed order because of google mock convention
+    expectActivateFramebufferRenderTarget();
+    expectFrameRenderCommands(renderable2, Matrix44f::Translation(Vector3(1.f, 2.f, 3.f)), Matrix44f::Identity, Matrix44f::Identity, projMatrix, false, false, false, 1u, true, ExpectedUniforms_ModelMatrix);
     expectFrameRenderCommands(renderable1, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, projMatrix);
 
+    executeScene();
+    // three data references, renderer view, camera view and projection matrices
+    EXPECT_EQ(6u, scene.collectSkippedUniforms());
+    EXPECT_EQ(0u, scene.collectSkippedUniforms());
+    Mock::VerifyAndClearExpectations(&device);
+}
+
+TEST_F(ARenderExecutor, SetsAllUniformsAgainInNextExecution)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera();
+    const RenderableHandle renderable = createTestRenderable(createTestDataInstance(), createRenderGroup(pass));
+    updateScenes();
+
+    const Matrix44f projMatrix = CameraMatrixHelper::ProjectionMatrix(projectionParams);
+    expectActivateFramebufferRenderTarget();
+    expectFrameRenderCommands(renderable, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, projMatrix);
     executeScene();
     Mock::VerifyAndClearExpectations(&device);
+
+    // shader program might have been changed outside of executor, e.g. by other scene or by deleting and re-uploading it
+    expectActivateFramebufferRenderTarget();
+    expectFrameRenderCommands(renderable, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, projMatrix);
+    executeScene();
+    Mock::VerifyAndClearExpectations(&device);
+}
+
+TEST_F(ARenderExecutor, BatchesRenderablesDifferingOnlyInWorldMatrixIntoSingleInstancedDrawCall)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera();
+    const RenderGroupHandle group = createRenderGroup(pass);
+    const DataInstances dataInstances = createBatchableTestDataInstance();
+    const RenderableHandle renderable1 = createTestRenderable(dataInstances, group);
+    const RenderableHandle renderable2 = createTestRenderable(dataInstances, group);
+    const RenderableHandle renderable3 = createTestRenderable(dataInstances, group);
+    scene.setRenderableRenderState(renderable2, scene.getRenderable(renderable1).renderState);
+    scene.setRenderableRenderState(renderable3, scene.getRenderable(renderable1).renderState);
+    scene.setTranslation(addTransformToRenderable(renderable2), Vector3(1.f, 2.f, 3.f));
+    scene.setTranslation(addTransformToRenderable(renderable3), Vector3(4.f, 5.f, 6.f));
+    updateScenes();
+
+    NiceMock<DeviceMock> batchingDevice;
+    std::vector<Matrix44f> worldMatrices;
+    EXPECT_CALL(batchingDevice, setInstanceWorldMatrices(DataFieldHandle(1u), 3u, _)).WillOnce(Invoke([&](DataFieldHandle, UInt32 count, const Matrix44f* matrices)
+    {
+        worldMatrices.assign(matrices, matrices + count);
+    }));
+    EXPECT_CALL(batchingDevice, drawIndexedTriangles(startIndex, indexCount, 3u));
+    executeSceneOnDevice(batchingDevice, true);
+
+    EXPECT_THAT(worldMatrices, UnorderedElementsAre(Matrix44f::Identity, Matrix44f::Translation(Vector3(1.f, 2.f, 3.f)), Matrix44f::Translation(Vector3(4.f, 5.f, 6.f))));
+
+    RendererCachedScene::RenderPassBatchingResults batchingResults;
+    scene.collectRenderPassBatching(batchingResults);
+    ASSERT_EQ(1u, batchingResults.size());
+    EXPECT_EQ(pass, batchingResults[0].pass);
+    EXPECT_EQ(3u, batchingResults[0].numRenderables);
+    EXPECT_EQ(1u, batchingResults[0].numDrawCalls);
+}
+
+TEST_F(ARenderExecutor, DoesNotBatchRenderablesWithDifferentRenderStates)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera();
+    const RenderGroupHandle group = createRenderGroup(pass);
+    const DataInstances dataInstances = createBatchableTestDataInstance();
+    createTestRenderable(dataInstances, group);
+    createTestRenderable(dataInstances, group);
+    updateScenes();
+
+    NiceMock<DeviceMock> batchingDevice;
+    EXPECT_CALL(batchingDevice, setInstanceWorldMatrices(DataFieldHandle(1u), 1u, _)).Times(2);
+    EXPECT_CALL(batchingDevice, drawIndexedTriangles(startIndex, indexCount, 1u)).Times(2);
+    executeSceneOnDevice(batchingDevice, true);
+
+    RendererCachedScene::RenderPassBatchingResults batchingResults;
+    scene.collectRenderPassBatching(batchingResults);
+    ASSERT_EQ(1u, batchingResults.size());
+    EXPECT_EQ(2u, batchingResults[0].numRenderables);
+    EXPECT_EQ(2u, batchingResults[0].numDrawCalls);
+}
+
+TEST_F(ARenderExecutor, ProvidesWorldMatrixOfEachRenderableAsAttributeIfBatchingDisabled)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera();
+    const RenderGroupHandle group = createRenderGroup(pass);
+    const DataInstances dataInstances = createBatchableTestDataInstance();
+    const RenderableHandle renderable1 = createTestRenderable(dataInstances, group);
+    const RenderableHandle renderable2 = createTestRenderable(dataInstances, group);
+    scene.setRenderableRenderState(renderable2, scene.getRenderable(renderable1).renderState);
+    scene.setTranslation(addTransformToRenderable(renderable2), Vector3(1.f, 2.f, 3.f));
+    updateScenes();
+
+    NiceMock<DeviceMock> batchingDevice;
+    EXPECT_CALL(batchingDevice, setInstanceWorldMatrices(DataFieldHandle(1u), 1u, Pointee(Matrix44f::Identity)));
+    EXPECT_CALL(batchingDevice, setInstanceWorldMatrices(DataFieldHandle(1u), 1u, Pointee(Matrix44f::Translation(Vector3(1.f, 2.f, 3.f)))));
+    EXPECT_CALL(batchingDevice, drawIndexedTriangles(startIndex, indexCount, 1u)).Times(2);
+    executeSceneOnDevice(batchingDevice, false);
+
+    RendererCachedScene::RenderPassBatchingResults batchingResults;
+    scene.collectRenderPassBatching(batchingResults);
+    EXPECT_TRUE(batchingResults.empty());
 }
 
 // ############################
@@ -874,7 +1075,7 @@ TEST_F(ARenderExecutor, AppliesParentTransformationToBothChildNodes)
     const Matrix44f projMatrix = CameraMatrixHelper::ProjectionMatrix(projectionParams);
     // reversed order because of google mock convention
     expectActivateFramebufferRenderTarget();
-    expectFrameRenderCommands(renderable2, Matrix44f::Translation(Vector3(0.30f)), Matrix44f::Identity, Matrix44f::Identity, projMatrix, false, false, false);
+    expectFrameRenderCommands(renderable2, Matrix44f::Translation(Vector3(0.30f)), Matrix44f::Identity, Matrix44f::Identity, projMatrix, false, false, false, 1u, true, ExpectedUniforms_ModelMatrix);
     expectFrameRenderCommands(renderable1, Matrix44f::Translation(Vector3(0.40f)), Matrix44f::Identity, Matrix44f::Identity, projMatrix);
     executeScene();
 
@@ -885,7 +1086,7 @@ TEST_F(ARenderExecutor, AppliesParentTransformationToBothChildNodes)
 
     // reversed order because of google mock convention
     expectActivateFramebufferRenderTarget();
-    expectFrameRenderCommands(renderable2, Matrix44f::Translation(Vector3(0.05f)), Matrix44f::Identity, Matrix44f::Identity, projMatrix, false, false, false);
+    expectFrameRenderCommands(renderable2, Matrix44f::Translation(Vector3(0.05f)), Matrix44f::Identity, Matrix44f::Identity, projMatrix, false, false, false, 1u, true, ExpectedUniforms_ModelMatrix);
     expectFrameRenderCommands(renderable1, Matrix44f::Translation(Vector3(0.15f)), Matrix44f::Identity, Matrix44f::Identity, projMatrix);
     executeScene();
 
@@ -965,11 +1166,11 @@ TEST_F(ARenderExecutor, willRenderAllRenderablesIfWithinTimeBudget)
         expectActivateRenderTarget(renderTargetDeviceHandle);
         expectClearRenderTarget();
         expectFrameRenderCommands(renderable1, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix);
-        expectFrameRenderCommands(renderable2, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix, false, false, false);
+        expectFrameRenderCommands(renderable2, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix, false, false, false, 1u, true, ExpectedUniforms_None);
 
         expectActivateFramebufferRenderTarget(false);
-        expectFrameRenderCommands(renderable3, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix, false, false, false);
-        expectFrameRenderCommands(renderable4, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix, false, false, false);
+        expectFrameRenderCommands(renderable3, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix, false, false, false, 1u, true, ExpectedUniforms_None);
+        expectFrameRenderCommands(renderable4, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix, false, false, false, 1u, true, ExpectedUniforms_None);
     }
 
     FrameTimer frameTimer;
@@ -1002,7 +1203,7 @@ TEST_F(ARenderExecutor, willRenderAtLeastOneRenderableBatchIfExceededTimeBudget)
         // one batch of renderables is rendered, first sets states
         expectFrameRenderCommands(batchRenderables.front(), Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix);
         for (auto it = batchRenderables.cbegin() + 1; it != batchRenderables.cend(); ++it)
-            expectFrameRenderCommands(*it, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix, false, false, false);
+            expectFrameRenderCommands(*it, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix, false, false, false, 1u, true, ExpectedUniforms_None);
 
         // otherRenderable is not rendered
         UNUSED(renderableOutOfBudget);
@@ -1056,7 +1257,7 @@ TEST_F(ARenderExecutor, willContinueRenderingWhereLeftOffLastRenderWhenInterrupt
         expectClearRenderTarget();
         expectFrameRenderCommands(batchRenderables1.front(), Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix);
         for (auto it = batchRenderables1.cbegin() + 1; it != batchRenderables1.cend(); ++it)
-            expectFrameRenderCommands(*it, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix, false, false, false);
+            expectFrameRenderCommands(*it, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix, false, false, false, 1u, true, ExpectedUniforms_None);
     }
     SceneRenderExecutionIterator renderIterator = executeScene({}, &frameTimer);
     EXPECT_EQ(0u, renderIterator.getRenderPassIdx());
@@ -1068,7 +1269,7 @@ TEST_F(ARenderExecutor, willContinueRenderingWhereLeftOffLastRenderWhenInterrupt
         expectActivateRenderTarget(renderTargetDeviceHandle); // no clear
         expectFrameRenderCommands(batchRenderables2.front(), Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix);
         for (auto it = batchRenderables2.cbegin() + 1; it != batchRenderables2.cend(); ++it)
-            expectFrameRenderCommands(*it, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix, false, false, false);
+            expectFrameRenderCommands(*it, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix, false, false, false, 1u, true, ExpectedUniforms_None);
     }
     renderIterator = executeScene(renderIterator, &frameTimer);
     EXPECT_EQ(0u, renderIterator.getRenderPassIdx());
@@ -1083,7 +1284,7 @@ TEST_F(ARenderExecutor, willContinueRenderingWhereLeftOffLastRenderWhenInterrupt
         expectActivateFramebufferRenderTarget(false);
         expectFrameRenderCommands(batchRenderables3.front(), Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix);
         for (auto it = batchRenderables3.cbegin() + 1; it != batchRenderables3.cend(); ++it)
-            expectFrameRenderCommands(*it, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix, false, false, false);
+            expectFrameRenderCommands(*it, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix, false, false, false, 1u, true, ExpectedUniforms_None);
     }
     renderIterator = executeScene(renderIterator, &frameTimer);
     EXPECT_EQ(1u, renderIterator.getRenderPassIdx());
@@ -1095,7 +1296,7 @@ TEST_F(ARenderExecutor, willContinueRenderingWhereLeftOffLastRenderWhenInterrupt
         expectActivateFramebufferRenderTarget();
         expectFrameRenderCommands(batchRenderables4.front(), Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix);
         for (auto it = batchRenderables4.cbegin() + 1; it != batchRenderables4.cend(); ++it)
-            expectFrameRenderCommands(*it, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix, false, false, false);
+            expectFrameRenderCommands(*it, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, expectedProjectionMatrix, false, false, false, 1u, true, ExpectedUniforms_None);
     }
     renderIterator = executeScene(renderIterator, &frameTimer);
     EXPECT_EQ(1u, renderIterator.getRenderPassIdx());
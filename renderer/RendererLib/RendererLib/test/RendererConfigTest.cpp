@@ -22,6 +22,7 @@ TEST(AInternalRendererConfig, hasDefaultValues)
     EXPECT_STREQ("", config.getKPIFileName().c_str());
     EXPECT_EQ(std::chrono::microseconds{10000u}, config.getFrameCallbackMaxPollTime());
     EXPECT_STREQ("", config.getWaylandDisplayForSystemCompositorController().c_str());
+    EXPECT_EQ(0u, config.getParallelCommandRecordingThreadCount());
 }
 
 TEST(AInternalRendererConfig, canEnableSystemCompositorControl)
@@ -79,6 +80,14 @@ TEST(AInternalRendererConfig, canSetGetWaylandDisplayForSystemCompositorControll
     EXPECT_STREQ("ramses wd", config.getWaylandDisplayForSystemCompositorController().c_str());
 }
 
+TEST(AInternalRendererConfig, canSetGetParallelCommandRecordingThreadCount)
+{
+    ramses_internal::RendererConfig config;
+
+    config.setParallelCommandRecordingThreadCount(3u);
+    EXPECT_EQ(3u, config.getParallelCommandRecordingThreadCount());
+}
+
 TEST(AInternalRendererConfig, getsValuesAssignedFromCommandLine)
 {
     static const ramses_internal::Char* args[] =
@@ -86,7 +95,8 @@ TEST(AInternalRendererConfig, getsValuesAssignedFromCommandLine)
         "app",
         "-wse", "wse",
         "-wsegn", "wsegn",
-        "-kpi", "filename"
+        "-kpi", "filename",
+        "-pcr", "3"
     };
     ramses_internal::CommandLineParser parser(sizeof(args) / sizeof(ramses_internal::Char*), args);
 
@@ -96,4 +106,5 @@ TEST(AInternalRendererConfig, getsValuesAssignedFromCommandLine)
     EXPECT_STREQ("wse", config.getWaylandSocketEmbedded().c_str());
     EXPECT_STREQ("wsegn", config.getWaylandSocketEmbeddedGroup().c_str());
     EXPECT_STREQ("filename", config.getKPIFileName().c_str());
+    EXPECT_EQ(3u, config.getParallelCommandRecordingThreadCount());
 }
@@ -18,6 +18,8 @@
 #include "RendererResourceCacheFake.h"
 #include "RenderBackendMock.h"
 #include "EmbeddedCompositingManagerMock.h"
+#include "Utils/LogMacros.h"
+#include <limits>
 
 namespace ramses_internal {
 using namespace testing;
@@ -25,11 +27,11 @@ using namespace testing;
 class ARendererResourceManager : public ::testing::Test
 {
 public:
-    ARendererResourceManager(bool disableEffectDeletion = false)
+    ARendererResourceManager(bool disableEffectDeletion = false, UInt64 prefetchedClientResourcesSizeLimit = RendererResourceManager::DefaultPrefetchedClientResourcesSizeLimit)
         : fakeSceneId(66u)
         , resUploader(stats)
         , frameTimer()
-        , resourceManager(resourceProvider, resUploader, renderer, embeddedCompositingManager, RequesterID(1), disableEffectDeletion, frameTimer, stats)
+        , resourceManager(resourceProvider, resUploader, renderer, embeddedCompositingManager, RequesterID(1), disableEffectDeletion, frameTimer, stats, 0u, false, prefetchedClientResourcesSizeLimit)
     {
     }
 
@@ -69,6 +71,15 @@ public:
         resourceManager.processArrivedClientResources(cache);
     }
 
+    bool statisticsContain(const String& str)
+    {
+        // statistics are written only once some frame finished
+        stats.frameFinished(0u);
+        StringOutputStream strstr;
+        stats.writeStatsToStream(strstr);
+        return strstr.release().find(str) >= 0;
+    }
+
 protected:
     StrictMock<ResourceProviderMock> resourceProvider;
     StrictMock<RenderBackendStrictMock> renderer;
@@ -430,6 +441,48 @@ TEST_F(ARendererResourceManager, canUploadAndUnloadTextureSampler)
     resourceManager.unloadTextureSampler(textureSampler, fakeSceneId);
 }
 
+TEST_F(ARendererResourceManager, canUploadAndUnloadVertexArray)
+{
+    const DataInstanceHandle geometryInstance(3u);
+    VertexArrayInfo vertexArrayInfo;
+    vertexArrayInfo.shader = DeviceMock::FakeShaderDeviceHandle;
+    vertexArrayInfo.indexBuffer = DeviceMock::FakeIndexBufferDeviceHandle;
+    vertexArrayInfo.vertexBuffers.push_back({ DeviceMock::FakeVertexBufferDeviceHandle, DataFieldHandle(0u), 0u });
+
+    EXPECT_CALL(renderer.deviceMock, allocateVertexArray(_));
+    resourceManager.uploadVertexArray(geometryInstance, vertexArrayInfo, fakeSceneId);
+
+    EXPECT_EQ(DeviceMock::FakeVertexArrayDeviceHandle, resourceManager.getVertexArrayDeviceHandle(geometryInstance, DeviceMock::FakeShaderDeviceHandle, fakeSceneId));
+
+    EXPECT_CALL(renderer.deviceMock, deleteVertexArray(DeviceMock::FakeVertexArrayDeviceHandle));
+    resourceManager.unloadVertexArray(geometryInstance, DeviceMock::FakeShaderDeviceHandle, fakeSceneId);
+}
+
+TEST_F(ARendererResourceManager, keepsVertexArraysOfGeometryForEachShader)
+{
+    const DataInstanceHandle geometryInstance(3u);
+    const DeviceResourceHandle otherShader(DeviceMock::FakeShaderDeviceHandle.asMemoryHandle() + 1u);
+    const DeviceResourceHandle otherVertexArray(DeviceMock::FakeVertexArrayDeviceHandle.asMemoryHandle() + 1u);
+    VertexArrayInfo vertexArrayInfo;
+    vertexArrayInfo.shader = DeviceMock::FakeShaderDeviceHandle;
+    vertexArrayInfo.indexBuffer = DeviceMock::FakeIndexBufferDeviceHandle;
+
+    EXPECT_CALL(renderer.deviceMock, allocateVertexArray(_)).WillOnce(Return(DeviceMock::FakeVertexArrayDeviceHandle)).WillOnce(Return(otherVertexArray));
+    resourceManager.uploadVertexArray(geometryInstance, vertexArrayInfo, fakeSceneId);
+    vertexArrayInfo.shader = otherShader;
+    resourceManager.uploadVertexArray(geometryInstance, vertexArrayInfo, fakeSceneId);
+
+    EXPECT_EQ(DeviceMock::FakeVertexArrayDeviceHandle, resourceManager.getVertexArrayDeviceHandle(geometryInstance, DeviceMock::FakeShaderDeviceHandle, fakeSceneId));
+    EXPECT_EQ(otherVertexArray, resourceManager.getVertexArrayDeviceHandle(geometryInstance, otherShader, fakeSceneId));
+
+    EXPECT_CALL(renderer.deviceMock, deleteVertexArray(otherVertexArray));
+    resourceManager.unloadVertexArray(geometryInstance, otherShader, fakeSceneId);
+    EXPECT_EQ(DeviceMock::FakeVertexArrayDeviceHandle, resourceManager.getVertexArrayDeviceHandle(geometryInstance, DeviceMock::FakeShaderDeviceHandle, fakeSceneId));
+
+    EXPECT_CALL(renderer.deviceMock, deleteVertexArray(DeviceMock::FakeVertexArrayDeviceHandle));
+    resourceManager.unloadVertexArray(geometryInstance, DeviceMock::FakeShaderDeviceHandle, fakeSceneId);
+}
+
 TEST_F(ARendererResourceManager, canUploadAndUnloadRenderTargetBuffer)
 {
     RenderBufferHandle bufferHandle(1u);
@@ -860,7 +913,12 @@ TEST_F(ARendererResourceManager, unloadsAllSceneResources)
     EXPECT_CALL(renderer.deviceMock, allocateTexture2D(_, _, _, _, _));
     resourceManager.uploadTextureBuffer(textureBufferHandle, 1u, 2u, ETextureFormat_RGBA8, 1u, fakeSceneId);
 
+    //upload vertex array
+    EXPECT_CALL(renderer.deviceMock, allocateVertexArray(_));
+    resourceManager.uploadVertexArray(DataInstanceHandle(3u), VertexArrayInfo(), fakeSceneId);
+
     // unload all scene resources
+    EXPECT_CALL(renderer.deviceMock, deleteVertexArray(DeviceMock::FakeVertexArrayDeviceHandle));
     EXPECT_CALL(renderer.deviceMock, deleteRenderBuffer(_)).Times(2);
     EXPECT_CALL(renderer.deviceMock, deleteRenderTarget(_)).Times(3);
     EXPECT_CALL(embeddedCompositingManager, deleteStreamTexture(streamTextureHandle, source, fakeSceneId));
@@ -975,4 +1033,167 @@ TEST_F(ARendererResourceManager, canUnreferenceAllResourcesUsedByAScene)
 
     resourceManager.unreferenceAllClientResourcesForScene(fakeSceneId2);
 }
+
+TEST_F(ARendererResourceManager, providesPrefetchedResourceWithoutRequestingItAgainWhenReferencedByScene)
+{
+    const ResourceContentHash resource = ResourceProviderMock::FakeVertArrayHash;
+    const ResourceContentHashVector resources(1u, resource);
+
+    EXPECT_CALL(resourceProvider, requestResourceAsyncronouslyFromFramework(resources, resourceManager.getRequesterID(), fakeSceneId));
+    resourceManager.prefetchClientResources(fakeSceneId, resources);
+    resourceManager.processArrivedClientResources(nullptr);
+    // prefetched resource is not managed until used by a scene
+    EXPECT_FALSE(resourceManager.hasClientResourcesToBeUploaded());
+
+    resourceManager.referenceClientResourcesForScene(fakeSceneId, resources);
+    resourceManager.requestAndUnrequestPendingClientResources();
+    EXPECT_EQ(EResourceStatus_Provided, resourceManager.getClientResourceStatus(resource));
+    EXPECT_TRUE(resourceManager.hasClientResourcesToBeUploaded());
+
+    unrequestResource(resource, fakeSceneId);
+}
+
+TEST_F(ARendererResourceManager, doesNotRequestPrefetchedResourceAgainIfItDidNotArriveYetWhenReferencedByScene)
+{
+    const ResourceContentHash resource = ResourceProviderMock::FakeIndexArrayHash;
+    const ResourceContentHashVector resources(1u, resource);
+
+    resourceProvider.setIndexArrayAvailability(false);
+    EXPECT_CALL(resourceProvider, requestResourceAsyncronouslyFromFramework(resources, resourceManager.getRequesterID(), fakeSceneId));
+    resourceManager.prefetchClientResources(fakeSceneId, resources);
+    resourceManager.processArrivedClientResources(nullptr);
+
+    resourceManager.referenceClientResourcesForScene(fakeSceneId, resources);
+    resourceManager.requestAndUnrequestPendingClientResources();
+    EXPECT_EQ(EResourceStatus_Requested, resourceManager.getClientResourceStatus(resource));
+
+    resourceProvider.setIndexArrayAvailability(true);
+    resourceManager.processArrivedClientResources(nullptr);
+    EXPECT_EQ(EResourceStatus_Provided, resourceManager.getClientResourceStatus(resource));
+
+    unrequestResource(resource, fakeSceneId);
+}
+
+TEST_F(ARendererResourceManager, doesNotPrefetchResourceAlreadyUsedByScene)
+{
+    const ResourceContentHash resource = ResourceProviderMock::FakeVertArrayHash;
+    requestResource(resource, fakeSceneId);
+
+    resourceManager.prefetchClientResources(fakeSceneId, ResourceContentHashVector(1u, resource));
+    EXPECT_EQ(EResourceStatus_Requested, resourceManager.getClientResourceStatus(resource));
+
+    EXPECT_CALL(resourceProvider, cancelResourceRequest(resource, _));
+    unrequestResource(resource, fakeSceneId);
+}
+
+TEST_F(ARendererResourceManager, cancelsRequestsOfPrefetchedResourcesWhichDidNotArriveWhenReleased)
+{
+    const SceneId fakeSceneId2(fakeSceneId.getValue() + 1u);
+    const ResourceContentHashVector resources1{ ResourceProviderMock::FakeVertArrayHash, ResourceProviderMock::FakeIndexArrayHash };
+    const ResourceContentHashVector resources2{ ResourceProviderMock::FakeTextureHash };
+
+    resourceProvider.setIndexArrayAvailability(false);
+    EXPECT_CALL(resourceProvider, requestResourceAsyncronouslyFromFramework(resources1, resourceManager.getRequesterID(), fakeSceneId));
+    EXPECT_CALL(resourceProvider, requestResourceAsyncronouslyFromFramework(resources2, resourceManager.getRequesterID(), fakeSceneId2));
+    resourceManager.prefetchClientResources(fakeSceneId, resources1);
+    resourceManager.prefetchClientResources(fakeSceneId2, resources2);
+    resourceManager.processArrivedClientResources(nullptr);
+
+    // only request of index array which did not arrive is canceled
+    EXPECT_CALL(resourceProvider, cancelResourceRequest(ResourceProviderMock::FakeIndexArrayHash, resourceManager.getRequesterID()));
+    resourceManager.releasePrefetchedClientResources(fakeSceneId);
+
+    // released resource has to be requested when used
+    requestResource(ResourceProviderMock::FakeVertArrayHash, fakeSceneId);
+    EXPECT_CALL(resourceProvider, cancelResourceRequest(ResourceProviderMock::FakeVertArrayHash, _));
+    unrequestResource(ResourceProviderMock::FakeVertArrayHash, fakeSceneId);
+
+    resourceManager.releasePrefetchedClientResources(fakeSceneId2);
+}
+
+TEST_F(ARendererResourceManager, countsPrefetchHitOnlyIfPrefetchedResourceArrivedBeforeUsedByScene)
+{
+    const ResourceContentHashVector indexArray(1u, ResourceProviderMock::FakeIndexArrayHash);
+    const ResourceContentHashVector vertexArray(1u, ResourceProviderMock::FakeVertArrayHash);
+
+    resourceProvider.setIndexArrayAvailability(false);
+    EXPECT_CALL(resourceProvider, requestResourceAsyncronouslyFromFramework(indexArray, resourceManager.getRequesterID(), fakeSceneId));
+    resourceManager.prefetchClientResources(fakeSceneId, indexArray);
+    resourceManager.processArrivedClientResources(nullptr);
+
+    // scene had to wait for resource anyway
+    resourceManager.referenceClientResourcesForScene(fakeSceneId, indexArray);
+    resourceManager.requestAndUnrequestPendingClientResources();
+    EXPECT_FALSE(statisticsContain("RCPrefetchHits"));
+
+    EXPECT_CALL(resourceProvider, requestResourceAsyncronouslyFromFramework(vertexArray, resourceManager.getRequesterID(), fakeSceneId));
+    resourceManager.prefetchClientResources(fakeSceneId, vertexArray);
+    resourceManager.processArrivedClientResources(nullptr);
+    resourceManager.referenceClientResourcesForScene(fakeSceneId, vertexArray);
+    resourceManager.requestAndUnrequestPendingClientResources();
+    EXPECT_TRUE(statisticsContain("RCPrefetchHits 1"));
+
+    EXPECT_CALL(resourceProvider, cancelResourceRequest(ResourceProviderMock::FakeIndexArrayHash, _));
+    unrequestResource(ResourceProviderMock::FakeIndexArrayHash, fakeSceneId);
+    unrequestResource(ResourceProviderMock::FakeVertArrayHash, fakeSceneId);
+}
+
+TEST_F(ARendererResourceManager, decompressesArrivedPrefetchedResourceOnlyWithinTimeBudget)
+{
+    const ResourceContentHashVector resources(1u, ResourceProviderMock::FakeVertArrayHash);
+    resourceProvider.setVertexArrayCompressed();
+
+    EXPECT_CALL(resourceProvider, requestResourceAsyncronouslyFromFramework(resources, resourceManager.getRequesterID(), fakeSceneId));
+    resourceManager.prefetchClientResources(fakeSceneId, resources);
+    resourceManager.processArrivedClientResources(nullptr);
+    EXPECT_FALSE(resourceProvider.isVertexArrayDecompressed());
+
+    frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::ClientResourcesUpload, 0u);
+    frameTimer.startFrame();
+    resourceManager.decompressPrefetchedClientResources();
+    EXPECT_FALSE(resourceProvider.isVertexArrayDecompressed());
+
+    frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::ClientResourcesUpload, std::numeric_limits<UInt64>::max());
+    resourceManager.decompressPrefetchedClientResources();
+    EXPECT_TRUE(resourceProvider.isVertexArrayDecompressed());
+
+    resourceManager.releasePrefetchedClientResources(fakeSceneId);
+}
+
+class ARendererResourceManagerWithPrefetchSizeLimit : public ARendererResourceManager
+{
+public:
+    // fake resources have 1 byte of data each
+    ARendererResourceManagerWithPrefetchSizeLimit()
+        : ARendererResourceManager(false, 2u)
+    {
+    }
+
+    void prefetchAndReceive(const ResourceContentHash& hash)
+    {
+        const ResourceContentHashVector resources(1u, hash);
+        EXPECT_CALL(resourceProvider, requestResourceAsyncronouslyFromFramework(resources, resourceManager.getRequesterID(), fakeSceneId));
+        resourceManager.prefetchClientResources(fakeSceneId, resources);
+        resourceManager.processArrivedClientResources(nullptr);
+    }
+};
+
+TEST_F(ARendererResourceManagerWithPrefetchSizeLimit, evictsOldestArrivedPrefetchedResourcesAboveSizeLimit)
+{
+    prefetchAndReceive(ResourceProviderMock::FakeVertArrayHash);
+    prefetchAndReceive(ResourceProviderMock::FakeIndexArrayHash);
+    prefetchAndReceive(ResourceProviderMock::FakeTextureHash);
+
+    // evicted resource has to be requested when used
+    requestResource(ResourceProviderMock::FakeVertArrayHash, fakeSceneId);
+    EXPECT_EQ(EResourceStatus_Requested, resourceManager.getClientResourceStatus(ResourceProviderMock::FakeVertArrayHash));
+
+    requestResource(ResourceProviderMock::FakeIndexArrayHash, fakeSceneId, false);
+    EXPECT_EQ(EResourceStatus_Provided, resourceManager.getClientResourceStatus(ResourceProviderMock::FakeIndexArrayHash));
+
+    EXPECT_CALL(resourceProvider, cancelResourceRequest(ResourceProviderMock::FakeVertArrayHash, _));
+    unrequestResource(ResourceProviderMock::FakeVertArrayHash, fakeSceneId);
+    unrequestResource(ResourceProviderMock::FakeIndexArrayHash, fakeSceneId);
+    resourceManager.releasePrefetchedClientResources(fakeSceneId);
+}
 }
@@ -8,6 +8,7 @@
 
 #include "renderer_common_gmock_header.h"
 #include "gtest/gtest.h"
+#include "gmock/gmock.h"
 #include "RendererLib/RendererSceneResourceRegistry.h"
 #include "SceneAPI/EDataBufferType.h"
 
@@ -30,6 +31,7 @@ TEST_F(ARendererSceneResourceRegistry, doesNotContainAnythingInitially)
     DataBufferHandleVector dbs;
     TextureBufferHandleVector tbs;
     TextureSamplerHandleVector tss;
+    VertexArrayKeyVector vas;
 
     registry.getAllRenderBuffers(rbs);
     registry.getAllRenderTargets(rts);
@@ -38,6 +40,7 @@ TEST_F(ARendererSceneResourceRegistry, doesNotContainAnythingInitially)
     registry.getAllDataBuffers(dbs);
     registry.getAllTextureBuffers(tbs);
     registry.getAllTextureSamplers(tss);
+    registry.getAllVertexArrays(vas);
 
 
     EXPECT_TRUE(rbs.empty());
@@ -47,6 +50,7 @@ TEST_F(ARendererSceneResourceRegistry, doesNotContainAnythingInitially)
     EXPECT_TRUE(dbs.empty());
     EXPECT_TRUE(tbs.empty());
     EXPECT_TRUE(tss.empty());
+    EXPECT_TRUE(vas.empty());
 }
 
 TEST_F(ARendererSceneResourceRegistry, canAddAndRemoveRenderBuffer)
@@ -231,3 +235,39 @@ TEST_F(ARendererSceneResourceRegistry, canGetTextureSamplerDeviceHandle)
     EXPECT_EQ(deviceHandle, registry.getTextureSamplerDeviceHandle(ts));
     registry.removeTextureSampler(ts);
 }
+
+TEST_F(ARendererSceneResourceRegistry, canAddAndRemoveVertexArrays)
+{
+    const DataInstanceHandle geometry(13u);
+    const DeviceResourceHandle shader(12u);
+    const DeviceResourceHandle otherShader(14u);
+    const DeviceResourceHandle deviceHandle(123u);
+    registry.addVertexArray(geometry, shader, deviceHandle);
+    registry.addVertexArray(geometry, otherShader, deviceHandle);
+
+    VertexArrayKeyVector vas;
+    registry.getAllVertexArrays(vas);
+    EXPECT_THAT(vas, UnorderedElementsAre(VertexArrayKey(geometry, shader), VertexArrayKey(geometry, otherShader)));
+    vas.clear();
+
+    registry.removeVertexArray(geometry, shader);
+    registry.getAllVertexArrays(vas);
+    ASSERT_EQ(1u, vas.size());
+    EXPECT_EQ(VertexArrayKey(geometry, otherShader), vas[0]);
+    vas.clear();
+
+    registry.removeVertexArray(geometry, otherShader);
+    registry.getAllVertexArrays(vas);
+    EXPECT_TRUE(vas.empty());
+}
+
+TEST_F(ARendererSceneResourceRegistry, canGetVertexArrayDeviceHandle)
+{
+    const DataInstanceHandle geometry(13u);
+    const DeviceResourceHandle deviceHandle(123u);
+    const DeviceResourceHandle shader(12u);
+    registry.addVertexArray(geometry, shader, deviceHandle);
+
+    EXPECT_EQ(deviceHandle, registry.getVertexArrayDeviceHandle(geometry, shader));
+    registry.removeVertexArray(geometry, shader);
+}
@@ -250,10 +250,18 @@ TEST_F(ARendererSceneUpdater, updateScenesWillUpdateRealTimeAnimationSystems)
 
     IScene& scene = *stagingScene[0u];
     AnimationSystem& animSystem = *new AnimationSystem(EAnimationSystemFlags_Default, AnimationSystemSizeInformation());
-    AnimationSystem& animSystemReal = *new AnimationSystem(EAnimationSystemFlags_RealTime, AnimationSystemSizeInformation());
+    AnimationSystem& animSystemReal = *new ActionCollectingAnimationSystem(EAnimationSystemFlags_RealTime, stagingScene[0u]->getSceneActionCollection(), AnimationSystemSizeInformation());
 
     auto hdl1 = scene.addAnimationSystem(&animSystem);
     auto hdl2 = scene.addAnimationSystem(&animSystemReal);
+
+    // pending animation makes the real time animation system active, changes must be collected to be sent to renderer
+    const SplineHandle spline = animSystemReal.allocateSpline(ESplineKeyType_Basic, EDataTypeID_Float);
+    const AnimationInstanceHandle animInst = animSystemReal.allocateAnimationInstance(spline, EInterpolationType_Linear, EVectorComponent_All);
+    const AnimationHandle animation = animSystemReal.allocateAnimation(animInst);
+    animSystemReal.setAnimationStartTime(animation, PlatformTime::GetMillisecondsAbsolute() + 100000u);
+    animSystemReal.setAnimationStopTime(animation, PlatformTime::GetMillisecondsAbsolute() + 200000u);
+
     performFlush();
     update();
 
@@ -280,6 +288,34 @@ TEST_F(ARendererSceneUpdater, updateScenesWillUpdateRealTimeAnimationSystems)
     destroyDisplay();
 }
 
+TEST_F(ARendererSceneUpdater, updateScenesSkipsIdleRealTimeAnimationSystems)
+{
+    createDisplayAndExpectSuccess();
+    createPublishAndSubscribeScene();
+    mapScene();
+    showScene();
+
+    IScene& scene = *stagingScene[0u];
+    AnimationSystem& animSystemReal = *new AnimationSystem(EAnimationSystemFlags_RealTime, AnimationSystemSizeInformation());
+    auto hdl = scene.addAnimationSystem(&animSystemReal);
+    performFlush();
+    update();
+
+    const IAnimationSystem* rendAnimSystemReal = rendererScenes.getScene(getSceneId()).getAnimationSystem(hdl);
+    ASSERT_TRUE(rendAnimSystemReal != NULL);
+
+    const AnimationTime time1real = rendAnimSystemReal->getTime();
+    PlatformThread::Sleep(2u);
+    update();
+    EXPECT_TRUE(time1real == rendAnimSystemReal->getTime());
+
+    hideScene();
+    expectContextEnable();
+    unmapScene();
+
+    destroyDisplay();
+}
+
 TEST_F(ARendererSceneUpdater, renderOncePassesAreRetriggeredWhenSceneMapped)
 {
     createDisplayAndExpectSuccess();
@@ -3371,7 +3407,8 @@ TEST_F(ARendererSceneUpdater, resetsInterruptedRenderingIfMaximumNumberOfPending
     mapScene(scene);
     mapScene(sceneInterrupted);
 
-    showAndInitiateInterruptedRendering(scene, sceneInterrupted);
+    // context is enabled second time to create vertex array once scene is rendered
+    showAndInitiateInterruptedRendering(scene, sceneInterrupted, 2u);
     EXPECT_TRUE(renderer.hasAnyBufferWithInterruptedRendering());
 
     // add blocking sync flush so that upcoming flushes are queuing up
@@ -3385,6 +3422,8 @@ TEST_F(ARendererSceneUpdater, resetsInterruptedRenderingIfMaximumNumberOfPending
     update();
     EXPECT_TRUE(renderer.hasAnyBufferWithInterruptedRendering());
 
+    // vertex array referencing the replaced index array is unloaded once the flushes are force applied
+    expectContextEnable();
     for (UInt i = 0u; i < ForceApplyFlushesLimit + 1u; ++i)
     {
         performFlush(sceneInterrupted, true);
@@ -308,6 +308,10 @@ protected:
         rendererSceneUpdater->createDisplayContext(displayConfig, (displayHandle == DisplayHandle1 ? resourceProvider1 : resourceProvider2), resourceUploader, displayHandle);
         EXPECT_TRUE(renderer.hasDisplayController(displayHandle));
         expectEvent(ERendererEventType_DisplayCreated);
+
+        // vertex arrays are created and deleted whenever renderable resources change, tests checking them explicitly override this
+        EXPECT_CALL(renderer.getDisplayMock(displayHandle).m_renderBackend->deviceMock, allocateVertexArray(_)).Times(AnyNumber());
+        EXPECT_CALL(renderer.getDisplayMock(displayHandle).m_renderBackend->deviceMock, deleteVertexArray(_)).Times(AnyNumber());
     }
 
     void destroyDisplay(DisplayHandle displayHandle = DisplayHandle1, bool expectFail = false)
@@ -826,11 +830,11 @@ protected:
         return DataSlotId(dataSlotIdForDataLinking.getReference()++);
     }
 
-    OffscreenBufferHandle showAndInitiateInterruptedRendering(UInt32 sceneIdx, UInt32 interruptedSceneIdx)
+    OffscreenBufferHandle showAndInitiateInterruptedRendering(UInt32 sceneIdx, UInt32 interruptedSceneIdx, UInt32 expectedContextEnables = 1u)
     {
         // assign scene to double buffered OB
         const OffscreenBufferHandle buffer(111u);
-        expectContextEnable();
+        expectContextEnable(DisplayHandle1, expectedContextEnables);
         expectRenderTargetUploaded(DisplayHandle1, true, DeviceMock::FakeRenderTargetDeviceHandle, true);
         EXPECT_TRUE(rendererSceneUpdater->handleBufferCreateRequest(buffer, DisplayHandle1, 1u, 1u, true));
         EXPECT_TRUE(assignSceneToOffscreenBuffer(interruptedSceneIdx, buffer));
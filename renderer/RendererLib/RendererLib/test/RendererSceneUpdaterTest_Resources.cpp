@@ -384,6 +384,37 @@ TEST_F(ARendererSceneUpdater, updatesDirtynessOfRenderedSceneResources)
     destroyDisplay();
 }
 
+TEST_F(ARendererSceneUpdater, createsVertexArrayOnceRenderableOfRenderedSceneIsReadyAndDeletesItWhenSceneUnmapped)
+{
+    createDisplayAndExpectSuccess();
+    createPublishAndSubscribeScene();
+    mapScene();
+    showScene();
+
+    createRenderable();
+    setRenderableResources();
+
+    DeviceMock& deviceMock = renderer.getDisplayMock(DisplayHandle1).m_renderBackend->deviceMock;
+    expectResourceRequest();
+    expectContextEnable();
+    expectRenderableResourcesUploaded();
+    EXPECT_CALL(deviceMock, allocateVertexArray(_));
+    update();
+    EXPECT_TRUE(lastFlushWasAppliedOnRendererScene());
+
+    // vertex array is reused as long as nothing changes
+    EXPECT_CALL(deviceMock, allocateVertexArray(_)).Times(0u);
+    update();
+    update();
+
+    hideScene();
+    expectContextEnable();
+    expectRenderableResourcesDeleted();
+    EXPECT_CALL(deviceMock, deleteVertexArray(DeviceMock::FakeVertexArrayDeviceHandle));
+    unmapScene();
+    destroyDisplay();
+}
+
 TEST_F(ARendererSceneUpdater, syncFlush_appliesPendingFlushesAlwaysIfSceneNotMapped)
 {
     createDisplayAndExpectSuccess();
@@ -1188,8 +1219,9 @@ TEST_F(ARendererSceneUpdater, confidenceTest_syncFlush_twoDisplaysEachWithSceneA
     setRenderableResources(1u);
     expectResourceRequest();
     expectResourceRequest(DisplayHandle2, 1u);
-    expectContextEnable(DisplayHandle1, 1u);
-    expectContextEnable(DisplayHandle2, 1u);
+    // contexts are enabled again to create vertex arrays after resources of both displays were uploaded
+    expectContextEnable(DisplayHandle1, 2u);
+    expectContextEnable(DisplayHandle2, 2u);
     expectRenderableResourcesUploaded(DisplayHandle1, false, true);
     expectRenderableResourcesUploaded(DisplayHandle2, false, true);
     update();
@@ -1258,6 +1290,51 @@ TEST_F(ARendererSceneUpdater, syncFlush_waitingForResourceAndUnmapWillRequestTha
     destroyDisplay();
 }
 
+TEST_F(ARendererSceneUpdater, requestsPrefetchedResourcesOnFlushAndDoesNotRequestThemAgainWhenUsedByScene)
+{
+    createDisplayAndExpectSuccess();
+    createPublishAndSubscribeScene();
+    mapScene();
+
+    stagingScene[0]->prefetchClientResource(ResourceProviderMock::FakeEffectHash);
+    stagingScene[0]->prefetchClientResource(ResourceProviderMock::FakeIndexArrayHash);
+    const ResourceContentHashVector prefetchedResources{ ResourceProviderMock::FakeEffectHash, ResourceProviderMock::FakeIndexArrayHash };
+    EXPECT_CALL(resourceProvider1, requestResourceAsyncronouslyFromFramework(prefetchedResources, _, getSceneId()));
+    performFlush();
+    update();
+
+    // prefetched resources already arrived, they are uploaded without being requested again
+    createRenderable();
+    setRenderableResources();
+    expectContextEnable();
+    expectRenderableResourcesUploaded();
+    update();
+    EXPECT_TRUE(lastFlushWasAppliedOnRendererScene());
+
+    expectContextEnable();
+    expectRenderableResourcesDeleted();
+    unmapScene();
+    destroyDisplay();
+}
+
+TEST_F(ARendererSceneUpdater, cancelsRequestsOfPrefetchedResourcesWhenSceneIsDestroyed)
+{
+    createDisplayAndExpectSuccess();
+    createPublishAndSubscribeScene();
+    mapScene();
+
+    resourceProvider1.setIndexArrayAvailability(false);
+    stagingScene[0]->prefetchClientResource(ResourceProviderMock::FakeIndexArrayHash);
+    expectResourceRequest();
+    performFlush();
+    update();
+
+    expectContextEnable();
+    expectResourceRequestCancel(ResourceProviderMock::FakeIndexArrayHash);
+    unpublishMappedScene();
+    destroyDisplay();
+}
+
 TEST_F(ARendererSceneUpdater, canDestroyDisplayIfThereArePendingUploadsDueToLimitedUploadTimeBudget)
 {
     //set upload budget to Zero so it always succeeds to upload only 1 resource
@@ -1271,16 +1348,16 @@ TEST_F(ARendererSceneUpdater, canDestroyDisplayIfThereArePendingUploadsDueToLimi
     setRenderableResources();
     setRenderableVertexArray();
 
-    // expect effect uploaded
+    // expect index array uploaded as it is the smallest resource
     expectResourceRequest();
     expectContextEnable();
-    expectRenderableResourcesUploaded(DisplayHandle1, true, false, false);
+    expectRenderableResourcesUploaded(DisplayHandle1, false, true, false);
     update();
 
     // rest of resources are pending to be uploaded
 
     expectContextEnable();
-    expectRenderableResourcesDeleted(DisplayHandle1, true, false, false);
+    expectRenderableResourcesDeleted(DisplayHandle1, false, true, false);
     unmapScene();
     destroyDisplay();
 }
@@ -1681,7 +1758,8 @@ TEST_F(ARendererSceneUpdater, renderTargetIsUploadedInCorrectOrderAfterSceneMapp
     update();
     EXPECT_EQ(ESceneState_Mapped, sceneStateExecutor.getSceneState(getSceneId()));
     expectEvent(ERendererEventType_SceneMapped);
-    // request show scene
+    // request show scene, vertex array is created once scene is rendered
+    expectContextEnable();
     showScene();
 
     // if render target (or any other scene resources) is not uploaded, this would crash/assert
@@ -2209,6 +2287,8 @@ TEST_F(ARendererSceneUpdater, applyingPendingFlushesAfterMaximumNumberOfPendingF
     expectRenderableResourcesUploaded();
     mapScene(0u);
     mapScene(1u);
+    // vertex arrays are created once scenes are rendered
+    expectContextEnable(DisplayHandle1, 2u);
     showScene(0u);
     showScene(1u);
 
@@ -2226,6 +2306,8 @@ TEST_F(ARendererSceneUpdater, applyingPendingFlushesAfterMaximumNumberOfPendingF
         update();
         expectNoEvent();
 
+        // vertex array referencing the replaced index array is unloaded once the flushes are force applied
+        expectContextEnable();
         for (UInt i = 0u; i < ForceApplyFlushesLimit + 1u; ++i)
         {
             performFlush(1u, true);
@@ -2242,6 +2324,7 @@ TEST_F(ARendererSceneUpdater, applyingPendingFlushesAfterMaximumNumberOfPendingF
         EXPECT_EQ(pendingFlushTag1, events.front().sceneVersionTag);
 
         // repeat for scene 0
+        expectContextEnable();
         for (UInt i = 0u; i < ForceApplyFlushesLimit + 1u; ++i)
         {
             performFlush(0u, true);
@@ -2681,6 +2764,8 @@ TEST_F(ARendererSceneUpdater, forceUnsubscribesSceneIfSceneResourcesUploadExceed
     expectContextEnable();
     expectRenderableResourcesUploaded();
     update();
+    // vertex array is created once scene is rendered
+    expectContextEnable();
     showScene(sceneIdx1);
 
     // next one is malicious scene with too many scene resources
@@ -207,6 +207,23 @@ TEST_F(ARendererStatistics, tracksFramebufferAndOffscreenBufferSwapCounts)
     EXPECT_TRUE(logOutputContains("FB2: 1; OB22: 1; OB33: 1"));
 }
 
+TEST_F(ARendererStatistics, tracksRatioOfRedrawnFramebufferPixels)
+{
+    stats.framebufferRedrawn(disp1, 100u, 100u);
+    stats.framebufferRedrawn(disp2, 100u, 100u);
+    stats.framebufferSwapped(disp1);
+    stats.framebufferSwapped(disp2);
+    stats.frameFinished(0u);
+
+    stats.framebufferRedrawn(disp1, 0u, 100u);
+    stats.framebufferRedrawn(disp1, 20u, 100u);
+    stats.framebufferSwapped(disp1);
+    stats.frameFinished(0u);
+
+    EXPECT_TRUE(logOutputContains("FB1: 2 (redrawn pixels: 40%)"));
+    EXPECT_TRUE(logOutputContains("FB2: 1\n"));
+}
+
 TEST_F(ARendererStatistics, tracksInterruptibleOffscreenBuffer)
 {
     stats.offscreenBufferInterrupted(disp1, ob1);
@@ -349,6 +366,84 @@ TEST_F(ARendererStatistics, tracksShaderCompilation)
     EXPECT_FALSE(logOutputContains("shadersCompiled"));
 }
 
+TEST_F(ARendererStatistics, tracksVertexArrayCacheHitsAndInvalidations)
+{
+    stats.vertexArrayCacheHit(5u);
+    stats.vertexArrayCacheHit(2u);
+    stats.vertexArrayInvalidated();
+    stats.frameFinished(0u);
+    EXPECT_TRUE(logOutputContains("vertexArrayCacheHits 7"));
+    EXPECT_TRUE(logOutputContains("vertexArraysInvalidated 1"));
+
+    stats.reset();
+    EXPECT_FALSE(logOutputContains("vertexArrayCacheHits"));
+    EXPECT_FALSE(logOutputContains("vertexArraysInvalidated"));
+
+    stats.vertexArrayCacheHit(3u);
+    stats.frameFinished(0u);
+    EXPECT_TRUE(logOutputContains("vertexArrayCacheHits 3"));
+    EXPECT_FALSE(logOutputContains("vertexArraysInvalidated"));
+}
+
+TEST_F(ARendererStatistics, tracksPrefetchedClientResourcesAndPrefetchHits)
+{
+    stats.clientResourcePrefetched(sceneId1, 2u);
+    stats.clientResourcePrefetched(sceneId1, 77u);
+    stats.clientResourcePrefetched(sceneId2, 100u);
+    stats.prefetchedClientResourceUsed(sceneId1);
+    stats.frameFinished(0u);
+    EXPECT_TRUE(logOutputContains("RCPrefetched 2 (79 B), RCPrefetchHits 1")); //scene1
+    EXPECT_TRUE(logOutputContains("RCPrefetched 1 (100 B)")); //scene2
+
+    stats.reset();
+    EXPECT_FALSE(logOutputContains("RCPrefetched"));
+    EXPECT_FALSE(logOutputContains("RCPrefetchHits"));
+}
+
+TEST_F(ARendererStatistics, tracksDrawCallReductionOfBatchedRenderPasses)
+{
+    stats.renderPassBatched(sceneId1, RenderPassHandle(2u), 10u, 3u);
+    stats.renderPassBatched(sceneId1, RenderPassHandle(2u), 10u, 2u);
+    stats.renderPassBatched(sceneId1, RenderPassHandle(5u), 4u, 4u);
+    stats.renderPassBatched(sceneId2, RenderPassHandle(2u), 7u, 1u);
+    stats.frameFinished(0u);
+    EXPECT_TRUE(logOutputContains("RP2 batched 20 renderables into 5 drawcalls, RP5 batched 4 renderables into 4 drawcalls")); //scene1
+    EXPECT_TRUE(logOutputContains("RP2 batched 7 renderables into 1 drawcalls")); //scene2
+
+    stats.reset();
+    EXPECT_FALSE(logOutputContains("batched"));
+}
+
+TEST_F(ARendererStatistics, tracksSkippedUniformsPerScene)
+{
+    stats.uniformsSkipped(sceneId1, 6u);
+    stats.uniformsSkipped(sceneId1, 4u);
+    stats.uniformsSkipped(sceneId2, 0u);
+    stats.frameFinished(0u);
+    EXPECT_TRUE(logOutputContains("uniformsSkipped 10")); //scene1
+    EXPECT_FALSE(logOutputContains("uniformsSkipped 0")); //scene2
+
+    stats.reset();
+    EXPECT_FALSE(logOutputContains("uniformsSkipped"));
+}
+
+TEST_F(ARendererStatistics, tracksTimeToFirstFrameFromMapRequest)
+{
+    stats.sceneMapRequested(sceneId1);
+    stats.sceneRendered(sceneId2);
+    stats.frameFinished(0u);
+    EXPECT_FALSE(logOutputContains("timeToFirstFrame"));
+
+    stats.sceneRendered(sceneId1);
+    stats.frameFinished(0u);
+    EXPECT_TRUE(logOutputContains("timeToFirstFrame "));
+
+    stats.reset();
+    stats.sceneRendered(sceneId1);
+    stats.frameFinished(0u);
+    EXPECT_FALSE(logOutputContains("timeToFirstFrame"));
+}
+
 TEST_F(ARendererStatistics, confidenceTest_fullLogOutput)
 {
     for (size_t period = 0u; period < 2u; ++period)
@@ -10,6 +10,7 @@
 #include "RendererLib/ResourceCachedScene.h"
 #include "RendererLib/RendererResourceManager.h"
 #include "RendererLib/RendererScenes.h"
+#include "RendererLib/RendererStatistics.h"
 #include "RendererEventCollector.h"
 #include "SceneAllocateHelper.h"
 #include <array>
@@ -75,6 +76,27 @@ namespace ramses_internal
             EXPECT_TRUE(scene.renderableResourcesDirty(renderable));
         }
 
+        RenderableHandle createRenderableWithAllResources()
+        {
+            const RenderableHandle renderable = sceneHelper.createRenderable();
+            sceneHelper.createAndAssignUniformDataInstance(renderable, sceneHelper.createTextureSamplerWithFakeClientTexture());
+            sceneHelper.createAndAssignVertexDataInstance(renderable);
+            sceneHelper.setResourcesToRenderable(renderable);
+            scene.updateRenderableResources(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+            expectRenderableResourcesClean(renderable);
+
+            return renderable;
+        }
+
+        bool statisticsLogContains(const String& str)
+        {
+            rendererStatistics.frameFinished(0u);
+            StringOutputStream stream;
+            rendererStatistics.writeStatsToStream(stream);
+            rendererStatistics.reset();
+            return stream.release().find(str) >= 0;
+        }
+
         void updateRenderableResources(bool withStreamTexture = false)
         {
             if (withStreamTexture)
@@ -114,6 +136,7 @@ namespace ramses_internal
 
     protected:
         RendererEventCollector rendererEventCollector;
+        RendererStatistics rendererStatistics;
         RendererScenes rendererScenes;
         ResourceCachedScene& scene;
         SceneAllocateHelper sceneAllocator;
@@ -553,6 +576,7 @@ namespace ramses_internal
         EXPECT_TRUE(scene.renderableResourcesDirty(renderable));
 
         EXPECT_FALSE(scene.getRenderableEffectDeviceHandle(renderable).isValid());
+        EXPECT_FALSE(scene.getRenderableVertexArrayDeviceHandle(renderable).isValid());
         EXPECT_FALSE(scene.getCachedHandlesForVertexAttributes()[vertexData.asMemoryHandle()][sceneHelper.vertAttribField.asMemoryHandle()].isValid());
         EXPECT_FALSE(scene.getCachedHandlesForVertexAttributes()[vertexData.asMemoryHandle()][sceneHelper.indicesField.asMemoryHandle()].isValid());
         EXPECT_FALSE(scene.getCachedHandlesForRenderTargets()[sceneHelper.renderTarget.asMemoryHandle()].isValid());
@@ -1016,4 +1040,182 @@ namespace ramses_internal
         const DeviceResourceHandle deviceHandle = scene.getCachedHandlesForTextureSamplers()[samplerRes.asMemoryHandle()];
         EXPECT_EQ(DeviceMock::FakeTextureDeviceHandle, deviceHandle);
     }
+
+    //vertex arrays
+    TEST_F(AResourceCachedScene, UploadsVertexArrayForRenderableWithAllResources)
+    {
+        const RenderableHandle renderable = createRenderableWithAllResources();
+        const DataInstanceHandle vertexData = scene.getRenderable(renderable).dataInstances[ERenderableDataSlotType_Geometry];
+        EXPECT_FALSE(scene.getRenderableVertexArrayDeviceHandle(renderable).isValid());
+        EXPECT_TRUE(scene.hasDirtyVertexArrays());
+
+        VertexArrayInfo vertexArrayInfo;
+        EXPECT_CALL(sceneHelper.resourceManager, uploadVertexArray(vertexData, _, scene.getSceneId())).WillOnce(SaveArg<1>(&vertexArrayInfo));
+        scene.updateVertexArrays(sceneHelper.resourceManager, rendererStatistics);
+
+        EXPECT_FALSE(scene.hasDirtyVertexArrays());
+        EXPECT_EQ(DeviceMock::FakeVertexArrayDeviceHandle, scene.getRenderableVertexArrayDeviceHandle(renderable));
+        EXPECT_EQ(DeviceMock::FakeShaderDeviceHandle, vertexArrayInfo.shader);
+        EXPECT_EQ(DeviceMock::FakeIndexBufferDeviceHandle, vertexArrayInfo.indexBuffer);
+        ASSERT_EQ(1u, vertexArrayInfo.vertexBuffers.size());
+        EXPECT_EQ(DeviceMock::FakeVertexBufferDeviceHandle, vertexArrayInfo.vertexBuffers[0].deviceHandle);
+        EXPECT_EQ(DataFieldHandle(0u), vertexArrayInfo.vertexBuffers[0].field);
+    }
+
+    TEST_F(AResourceCachedScene, DoesNotUploadVertexArrayForRenderableWithMissingResources)
+    {
+        const RenderableHandle renderable = sceneHelper.createRenderable();
+        sceneHelper.createAndAssignUniformDataInstance(renderable, sceneHelper.createTextureSamplerWithFakeClientTexture());
+        sceneHelper.createAndAssignVertexDataInstance(renderable);
+        sceneHelper.setResourcesToRenderable(renderable, true, false, true);
+        scene.updateRenderableResources(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectRenderableResourcesDirty(renderable);
+
+        EXPECT_FALSE(scene.hasDirtyVertexArrays());
+        scene.updateVertexArrays(sceneHelper.resourceManager, rendererStatistics);
+        EXPECT_FALSE(scene.getRenderableVertexArrayDeviceHandle(renderable).isValid());
+    }
+
+    TEST_F(AResourceCachedScene, DoesNotUploadVertexArrayForRenderableWithInstanceWorldMatrixAttribute)
+    {
+        DataFieldInfoVector geometryFields(3u);
+        geometryFields[0u] = DataFieldInfo(EDataType_Indices, 1u, EFixedSemantics_Indices);
+        geometryFields[1u] = DataFieldInfo(EDataType_Vector3Buffer, 1u, EFixedSemantics_VertexPositionAttribute);
+        geometryFields[2u] = DataFieldInfo(EDataType_Matrix44F, 1u, EFixedSemantics_InstanceWorldMatrixAttribute);
+        const DataInstanceHandle vertexData = sceneAllocator.allocateDataInstance(sceneAllocator.allocateDataLayout(geometryFields));
+
+        const RenderableHandle renderable = sceneHelper.createRenderable();
+        sceneHelper.createAndAssignUniformDataInstance(renderable, sceneHelper.createTextureSamplerWithFakeClientTexture());
+        scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Geometry, vertexData);
+        sceneHelper.setResourcesToRenderable(renderable);
+        scene.updateRenderableResources(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectRenderableResourcesClean(renderable);
+
+        EXPECT_FALSE(scene.hasDirtyVertexArrays());
+        scene.updateVertexArrays(sceneHelper.resourceManager, rendererStatistics);
+        EXPECT_FALSE(scene.getRenderableVertexArrayDeviceHandle(renderable).isValid());
+    }
+
+    TEST_F(AResourceCachedScene, ReportsVertexArrayCacheHitsOnlyForVertexArraysKeptAfterSceneChange)
+    {
+        const RenderableHandle renderable = createRenderableWithAllResources();
+        EXPECT_CALL(sceneHelper.resourceManager, uploadVertexArray(_, _, _));
+        scene.updateVertexArrays(sceneHelper.resourceManager, rendererStatistics);
+        EXPECT_FALSE(statisticsLogContains("vertexArrayCacheHits"));
+
+        // nothing changed, vertex arrays are not even checked
+        scene.updateVertexArrays(sceneHelper.resourceManager, rendererStatistics);
+        EXPECT_FALSE(statisticsLogContains("vertexArrayCacheHits"));
+
+        const DataInstanceHandle uniformData = scene.getRenderable(renderable).dataInstances[ERenderableDataSlotType_Uniforms];
+        scene.setDataTextureSamplerHandle(uniformData, sceneHelper.samplerField, sceneHelper.createTextureSamplerWithFakeClientTexture());
+        scene.updateRenderableResources(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectRenderableResourcesClean(renderable);
+        EXPECT_FALSE(scene.hasDirtyVertexArrays());
+        scene.updateVertexArrays(sceneHelper.resourceManager, rendererStatistics);
+        EXPECT_TRUE(statisticsLogContains("vertexArrayCacheHits 1"));
+        EXPECT_EQ(DeviceMock::FakeVertexArrayDeviceHandle, scene.getRenderableVertexArrayDeviceHandle(renderable));
+    }
+
+    TEST_F(AResourceCachedScene, RecreatesVertexArrayIfVertexDataResourceChanges)
+    {
+        const RenderableHandle renderable = createRenderableWithAllResources();
+        const DataInstanceHandle vertexData = scene.getRenderable(renderable).dataInstances[ERenderableDataSlotType_Geometry];
+        EXPECT_CALL(sceneHelper.resourceManager, uploadVertexArray(vertexData, _, _));
+        scene.updateVertexArrays(sceneHelper.resourceManager, rendererStatistics);
+
+        scene.setDataResource(vertexData, sceneHelper.vertAttribField, ResourceContentHash::Invalid(), verticesDataBuffer, 0u);
+        scene.updateRenderableResources(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        EXPECT_FALSE(scene.renderableResourcesDirty(renderable));
+        EXPECT_FALSE(scene.getRenderableVertexArrayDeviceHandle(renderable).isValid());
+        EXPECT_TRUE(scene.hasDirtyVertexArrays());
+
+        VertexArrayInfo vertexArrayInfo;
+        {
+            InSequence seq;
+            EXPECT_CALL(sceneHelper.resourceManager, unloadVertexArray(vertexData, DeviceMock::FakeShaderDeviceHandle, scene.getSceneId()));
+            EXPECT_CALL(sceneHelper.resourceManager, uploadVertexArray(vertexData, _, scene.getSceneId())).WillOnce(SaveArg<1>(&vertexArrayInfo));
+        }
+        scene.updateVertexArrays(sceneHelper.resourceManager, rendererStatistics);
+
+        EXPECT_EQ(DeviceMock::FakeVertexArrayDeviceHandle, scene.getRenderableVertexArrayDeviceHandle(renderable));
+        ASSERT_EQ(1u, vertexArrayInfo.vertexBuffers.size());
+        EXPECT_EQ(vertexDataBufferDeviceHandle, vertexArrayInfo.vertexBuffers[0].deviceHandle);
+        EXPECT_TRUE(statisticsLogContains("vertexArraysInvalidated 1"));
+    }
+
+    TEST_F(AResourceCachedScene, RecreatesVertexArrayIfGeometryIsUsedWithAnotherEffect)
+    {
+        const RenderableHandle renderable = createRenderableWithAllResources();
+        const DataInstanceHandle vertexData = scene.getRenderable(renderable).dataInstances[ERenderableDataSlotType_Geometry];
+        EXPECT_CALL(sceneHelper.resourceManager, uploadVertexArray(vertexData, _, _));
+        scene.updateVertexArrays(sceneHelper.resourceManager, rendererStatistics);
+
+        const DeviceResourceHandle otherShaderDeviceHandle(4448u);
+        ON_CALL(sceneHelper.resourceManager, getClientResourceDeviceHandle(resourceNotUploadedToDevice)).WillByDefault(Return(otherShaderDeviceHandle));
+        scene.setRenderableEffect(renderable, resourceNotUploadedToDevice);
+        scene.updateRenderableResources(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        EXPECT_FALSE(scene.renderableResourcesDirty(renderable));
+        EXPECT_FALSE(scene.getRenderableVertexArrayDeviceHandle(renderable).isValid());
+
+        VertexArrayInfo vertexArrayInfo;
+        EXPECT_CALL(sceneHelper.resourceManager, unloadVertexArray(vertexData, DeviceMock::FakeShaderDeviceHandle, _));
+        EXPECT_CALL(sceneHelper.resourceManager, uploadVertexArray(vertexData, _, _)).WillOnce(SaveArg<1>(&vertexArrayInfo));
+        scene.updateVertexArrays(sceneHelper.resourceManager, rendererStatistics);
+
+        EXPECT_EQ(otherShaderDeviceHandle, vertexArrayInfo.shader);
+        EXPECT_EQ(DeviceMock::FakeVertexArrayDeviceHandle, scene.getRenderableVertexArrayDeviceHandle(renderable));
+    }
+
+    TEST_F(AResourceCachedScene, KeepsVertexArraysOfGeometrySharedByRenderablesWithDifferentEffects)
+    {
+        const RenderableHandle renderable1 = sceneHelper.createRenderable();
+        const DataInstanceHandle uniformData = sceneHelper.createAndAssignUniformDataInstance(renderable1, sceneHelper.createTextureSamplerWithFakeClientTexture());
+        const DataInstanceHandle vertexData = sceneHelper.createAndAssignVertexDataInstance(renderable1);
+        sceneHelper.setResourcesToRenderable(renderable1);
+
+        const DeviceResourceHandle otherShaderDeviceHandle(4448u);
+        const DeviceResourceHandle otherVertexArrayDeviceHandle(4449u);
+        ON_CALL(sceneHelper.resourceManager, getClientResourceDeviceHandle(resourceNotUploadedToDevice)).WillByDefault(Return(otherShaderDeviceHandle));
+        ON_CALL(sceneHelper.resourceManager, getVertexArrayDeviceHandle(vertexData, otherShaderDeviceHandle, _)).WillByDefault(Return(otherVertexArrayDeviceHandle));
+        const RenderableHandle renderable2 = sceneHelper.createRenderable();
+        scene.setRenderableDataInstance(renderable2, ERenderableDataSlotType_Uniforms, uniformData);
+        scene.setRenderableDataInstance(renderable2, ERenderableDataSlotType_Geometry, vertexData);
+        scene.setRenderableEffect(renderable2, resourceNotUploadedToDevice);
+        scene.updateRenderableResources(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        EXPECT_FALSE(scene.renderableResourcesDirty(renderable1));
+        EXPECT_FALSE(scene.renderableResourcesDirty(renderable2));
+
+        EXPECT_CALL(sceneHelper.resourceManager, uploadVertexArray(vertexData, Field(&VertexArrayInfo::shader, DeviceMock::FakeShaderDeviceHandle), _));
+        EXPECT_CALL(sceneHelper.resourceManager, uploadVertexArray(vertexData, Field(&VertexArrayInfo::shader, otherShaderDeviceHandle), _));
+        scene.updateVertexArrays(sceneHelper.resourceManager, rendererStatistics);
+        EXPECT_EQ(DeviceMock::FakeVertexArrayDeviceHandle, scene.getRenderableVertexArrayDeviceHandle(renderable1));
+        EXPECT_EQ(otherVertexArrayDeviceHandle, scene.getRenderableVertexArrayDeviceHandle(renderable2));
+        EXPECT_FALSE(statisticsLogContains("vertexArrayCacheHits"));
+
+        // unrelated change does not make renderables rebuild vertex arrays of each other
+        scene.setDataTextureSamplerHandle(uniformData, sceneHelper.samplerField, sceneHelper.createTextureSamplerWithFakeClientTexture());
+        scene.updateRenderableResources(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        EXPECT_FALSE(scene.hasDirtyVertexArrays());
+        scene.updateVertexArrays(sceneHelper.resourceManager, rendererStatistics);
+        EXPECT_TRUE(statisticsLogContains("vertexArrayCacheHits 2"));
+        EXPECT_FALSE(statisticsLogContains("vertexArraysInvalidated"));
+    }
+
+    TEST_F(AResourceCachedScene, UnloadsVertexArrayOfReleasedGeometry)
+    {
+        const RenderableHandle renderable = createRenderableWithAllResources();
+        const DataInstanceHandle vertexData = scene.getRenderable(renderable).dataInstances[ERenderableDataSlotType_Geometry];
+        EXPECT_CALL(sceneHelper.resourceManager, uploadVertexArray(vertexData, _, _));
+        scene.updateVertexArrays(sceneHelper.resourceManager, rendererStatistics);
+
+        scene.releaseRenderable(renderable);
+        scene.releaseDataInstance(vertexData);
+        EXPECT_TRUE(scene.hasDirtyVertexArrays());
+
+        EXPECT_CALL(sceneHelper.resourceManager, unloadVertexArray(vertexData, DeviceMock::FakeShaderDeviceHandle, scene.getSceneId()));
+        scene.updateVertexArrays(sceneHelper.resourceManager, rendererStatistics);
+        EXPECT_FALSE(scene.hasDirtyVertexArrays());
+        EXPECT_TRUE(statisticsLogContains("vertexArraysInvalidated 1"));
+    }
 }
@@ -188,6 +188,9 @@ TEST_F(AResourceUploader, uploadsTextureCubeResource)
     for (UInt32 i = 0u; i < 6u; ++i)
     {
         EXPECT_CALL(renderer.deviceMock, uploadTextureData(DeviceResourceHandle(123), 0u, 0u, 0u, i, 2u, 2u, 1u, _, _));
+    }
+    for (UInt32 i = 0u; i < 6u; ++i)
+    {
         EXPECT_CALL(renderer.deviceMock, uploadTextureData(DeviceResourceHandle(123), 1u, 0u, 0u, i, 1u, 1u, 1u, _, _));
     }
     EXPECT_EQ(123u, uploader.uploadResource(renderer, managedRes));
@@ -210,6 +213,45 @@ TEST_F(AResourceUploader, uploadsTextureCubeResourceWithMipGen)
     EXPECT_EQ(123u, uploader.uploadResource(renderer, managedRes));
 }
 
+TEST_F(AResourceUploader, allocatesTextureWithAllProvidedMipLevelsWithoutUploadingData)
+{
+    const TextureMetaInfo texDesc(4u, 4u, 1u, ETextureFormat_R8, false, { 16u, 4u, 1u });
+    TextureResource res(EResourceType_Texture2D, texDesc, ResourceCacheFlag_DoNotCache, String());
+
+    EXPECT_CALL(renderer.deviceMock, allocateTexture2D(4u, 4u, _, 3u, 21u)).WillOnce(Return(DeviceResourceHandle(123)));
+    EXPECT_CALL(renderer.deviceMock, uploadTextureData(_, _, _, _, _, _, _, _, _, _)).Times(0);
+    EXPECT_EQ(123u, uploader.allocateTexture(renderer, res));
+}
+
+TEST_F(AResourceUploader, uploadsSingleTextureMipLevelAndRestrictsSamplingToIt)
+{
+    const TextureMetaInfo texDesc(4u, 4u, 1u, ETextureFormat_R8, false, { 16u, 4u, 1u });
+    TextureResource res(EResourceType_Texture2D, texDesc, ResourceCacheFlag_DoNotCache, String());
+    const Byte* data = res.getResourceData()->getRawData();
+
+    InSequence seq;
+    EXPECT_CALL(renderer.deviceMock, bindTexture(DeviceResourceHandle(123)));
+    EXPECT_CALL(renderer.deviceMock, uploadTextureData(DeviceResourceHandle(123), 1u, 0u, 0u, 0u, 2u, 2u, 1u, data + 16u, 4u));
+    EXPECT_CALL(renderer.deviceMock, setTextureBaseMipLevel(DeviceResourceHandle(123), 1u));
+    uploader.uploadTextureMipLevel(renderer, DeviceResourceHandle(123), res, 1u);
+}
+
+TEST_F(AResourceUploader, uploadsSingleTextureCubeMipLevelForAllFaces)
+{
+    const TextureMetaInfo texDesc(2u, 1u, 1u, ETextureFormat_R8, false, { 4u, 1u });
+    TextureResource res(EResourceType_TextureCube, texDesc, ResourceCacheFlag_DoNotCache, String());
+    const Byte* data = res.getResourceData()->getRawData();
+
+    InSequence seq;
+    EXPECT_CALL(renderer.deviceMock, bindTexture(DeviceResourceHandle(123)));
+    for (UInt32 i = 0u; i < 6u; ++i)
+    {
+        EXPECT_CALL(renderer.deviceMock, uploadTextureData(DeviceResourceHandle(123), 1u, 0u, 0u, i, 1u, 1u, 1u, data + i * 5u + 4u, 1u));
+    }
+    EXPECT_CALL(renderer.deviceMock, setTextureBaseMipLevel(DeviceResourceHandle(123), 1u));
+    uploader.uploadTextureMipLevel(renderer, DeviceResourceHandle(123), res, 1u);
+}
+
 TEST_F(AResourceUploader, uploadsEffectResourceWithoutBinaryShaderCache)
 {
     EffectResource res("", "", EffectInputInformationVector(), EffectInputInformationVector(), "", ResourceCacheFlag_DoNotCache);
@@ -243,6 +243,14 @@ namespace ramses_internal
         const DataSlotId consumerWithoutTransformsSceneConsumerId;
     };
 
+    TEST_F(ATransformationLinkCachedScene, consumesLinkedTransformationsOnlyIfLinkedAsConsumer)
+    {
+        linkConsumer1SceneToProviderScene();
+        EXPECT_TRUE(consumer1Scene.consumesLinkedTransformations());
+        EXPECT_FALSE(providerScene.consumesLinkedTransformations());
+        EXPECT_FALSE(consumer2Scene.consumesLinkedTransformations());
+    }
+
     TEST_F(ATransformationLinkCachedScene, resolvesSingleDataDependency)
     {
         linkConsumer1SceneToProviderScene();
@@ -0,0 +1,168 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "renderer_common_gmock_header.h"
+#include "gtest/gtest.h"
+#include "Platform_Base/UniformBufferData.h"
+#include "Math3d/Vector3.h"
+#include "Math3d/Vector4.h"
+#include "Math3d/Matrix33f.h"
+#include "PlatformAbstraction/PlatformMemory.h"
+
+namespace ramses_internal
+{
+    class AUniformBufferData : public ::testing::Test
+    {
+    public:
+        AUniformBufferData()
+        {
+            uniformInputs.push_back(EffectInputInformation("Material.factor", 1u, EDataType_Float, EFixedSemantics_Invalid, EEffectInputTextureType_Invalid, "Material"));
+            uniformInputs.push_back(EffectInputInformation("Material.color", 1u, EDataType_Vector3F, EFixedSemantics_Invalid, EEffectInputTextureType_Invalid, "Material"));
+            uniformInputs.push_back(EffectInputInformation("notInBlock", 1u, EDataType_Vector4F, EFixedSemantics_Invalid, EEffectInputTextureType_Invalid));
+            uniformInputs.push_back(EffectInputInformation("Material.count", 1u, EDataType_Int32, EFixedSemantics_Invalid, EEffectInputTextureType_Invalid, "Material"));
+            uniformInputs.push_back(EffectInputInformation("Material.weights", 3u, EDataType_Float, EFixedSemantics_Invalid, EEffectInputTextureType_Invalid, "Material"));
+            uniformInputs.push_back(EffectInputInformation("Material.rotation", 1u, EDataType_Matrix33F, EFixedSemantics_Invalid, EEffectInputTextureType_Invalid, "Material"));
+            uniformInputs.push_back(EffectInputInformation("lightColor", 1u, EDataType_Vector4F, EFixedSemantics_Invalid, EEffectInputTextureType_Invalid, "Light"));
+        }
+
+    protected:
+        template <typename T>
+        void setValue(UniformBufferData& buffer, DataFieldHandle field, UInt32 elementCount, const T* value)
+        {
+            buffer.setMemberValue(field, elementCount, reinterpret_cast<const Byte*>(value));
+        }
+
+        template <typename T>
+        T getValue(const UniformBufferData& buffer, UInt32 offset)
+        {
+            T value;
+            PlatformMemory::Copy(&value, buffer.getData() + offset, sizeof(T));
+            return value;
+        }
+
+        EffectInputInformationVector uniformInputs;
+    };
+
+    TEST_F(AUniformBufferData, collectsUniformBlockNamesInOrderOfFirstMember)
+    {
+        const Vector<String> blockNames = UniformBufferData::GetUniformBlockNames(uniformInputs);
+        ASSERT_EQ(2u, blockNames.size());
+        EXPECT_EQ(String("Material"), blockNames[0]);
+        EXPECT_EQ(String("Light"), blockNames[1]);
+    }
+
+    TEST_F(AUniformBufferData, hasOnlyMembersOfItsBlock)
+    {
+        const UniformBufferData buffer("Material", uniformInputs);
+        EXPECT_EQ(String("Material"), buffer.getBlockName());
+        EXPECT_TRUE(buffer.hasMember(DataFieldHandle(0u)));
+        EXPECT_TRUE(buffer.hasMember(DataFieldHandle(1u)));
+        EXPECT_FALSE(buffer.hasMember(DataFieldHandle(2u)));
+        EXPECT_TRUE(buffer.hasMember(DataFieldHandle(3u)));
+        EXPECT_TRUE(buffer.hasMember(DataFieldHandle(4u)));
+        EXPECT_TRUE(buffer.hasMember(DataFieldHandle(5u)));
+        EXPECT_FALSE(buffer.hasMember(DataFieldHandle(6u)));
+    }
+
+    TEST_F(AUniformBufferData, computesStd140Offsets)
+    {
+        const UniformBufferData buffer("Material", uniformInputs);
+        EXPECT_EQ(0u, buffer.getMemberOffset(DataFieldHandle(0u)));   // float
+        EXPECT_EQ(16u, buffer.getMemberOffset(DataFieldHandle(1u)));  // vec3 aligned to 16
+        EXPECT_EQ(28u, buffer.getMemberOffset(DataFieldHandle(3u)));  // int fits right after vec3
+        EXPECT_EQ(32u, buffer.getMemberOffset(DataFieldHandle(4u)));  // float[3], each element strided by 16
+        EXPECT_EQ(80u, buffer.getMemberOffset(DataFieldHandle(5u)));  // mat3, each column strided by 16
+        EXPECT_EQ(128u, buffer.getSize());
+
+        const UniformBufferData lightBuffer("Light", uniformInputs);
+        EXPECT_EQ(0u, lightBuffer.getMemberOffset(DataFieldHandle(6u)));
+        EXPECT_EQ(16u, lightBuffer.getSize());
+    }
+
+    TEST_F(AUniformBufferData, roundsBlockSizeUpToVec4)
+    {
+        EffectInputInformationVector inputs;
+        inputs.push_back(EffectInputInformation("a", 1u, EDataType_Float, EFixedSemantics_Invalid, EEffectInputTextureType_Invalid, "Block"));
+        inputs.push_back(EffectInputInformation("b", 1u, EDataType_Vector2F, EFixedSemantics_Invalid, EEffectInputTextureType_Invalid, "Block"));
+        const UniformBufferData buffer("Block", inputs);
+
+        EXPECT_EQ(8u, buffer.getMemberOffset(DataFieldHandle(1u)));
+        EXPECT_EQ(16u, buffer.getSize());
+    }
+
+    TEST_F(AUniformBufferData, isModifiedInitiallyAndAfterReset)
+    {
+        UniformBufferData buffer("Material", uniformInputs);
+        EXPECT_TRUE(buffer.isModified());
+        buffer.resetModified();
+        EXPECT_FALSE(buffer.isModified());
+    }
+
+    TEST_F(AUniformBufferData, packsValuesWithStd140Strides)
+    {
+        UniformBufferData buffer("Material", uniformInputs);
+
+        const Float factor = 0.5f;
+        const Vector3 color(1.f, 2.f, 3.f);
+        const Int32 count = 7;
+        const Float weights[] = { 10.f, 20.f, 30.f };
+        const Matrix33f rotation(1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f);
+        setValue(buffer, DataFieldHandle(0u), 1u, &factor);
+        setValue(buffer, DataFieldHandle(1u), 1u, &color);
+        setValue(buffer, DataFieldHandle(3u), 1u, &count);
+        setValue(buffer, DataFieldHandle(4u), 3u, weights);
+        setValue(buffer, DataFieldHandle(5u), 1u, &rotation);
+
+        EXPECT_EQ(factor, getValue<Float>(buffer, 0u));
+        EXPECT_EQ(color, getValue<Vector3>(buffer, 16u));
+        EXPECT_EQ(count, getValue<Int32>(buffer, 28u));
+        EXPECT_EQ(weights[0], getValue<Float>(buffer, 32u));
+        EXPECT_EQ(weights[1], getValue<Float>(buffer, 48u));
+        EXPECT_EQ(weights[2], getValue<Float>(buffer, 64u));
+
+        const Float* rotationData = rotation.getRawData();
+        for (UInt32 column = 0u; column < 3u; ++column)
+        {
+            EXPECT_EQ(rotationData[column * 3u + 0u], getValue<Float>(buffer, 80u + column * 16u));
+            EXPECT_EQ(rotationData[column * 3u + 1u], getValue<Float>(buffer, 84u + column * 16u));
+            EXPECT_EQ(rotationData[column * 3u + 2u], getValue<Float>(buffer, 88u + column * 16u));
+        }
+    }
+
+    TEST_F(AUniformBufferData, isModifiedWhenDifferentValueSet)
+    {
+        UniformBufferData buffer("Light", uniformInputs);
+        buffer.resetModified();
+
+        const Vector4 color(1.f, 0.f, 0.f, 1.f);
+        setValue(buffer, DataFieldHandle(6u), 1u, &color);
+        EXPECT_TRUE(buffer.isModified());
+        EXPECT_EQ(color, getValue<Vector4>(buffer, 0u));
+    }
+
+    TEST_F(AUniformBufferData, isNotModifiedWhenSameValueSetAgain)
+    {
+        UniformBufferData buffer("Light", uniformInputs);
+        const Vector4 color(1.f, 0.f, 0.f, 1.f);
+        setValue(buffer, DataFieldHandle(6u), 1u, &color);
+        buffer.resetModified();
+
+        setValue(buffer, DataFieldHandle(6u), 1u, &color);
+        EXPECT_FALSE(buffer.isModified());
+    }
+
+    TEST_F(AUniformBufferData, isNotModifiedWhenZeroSetToInitialBuffer)
+    {
+        UniformBufferData buffer("Material", uniformInputs);
+        buffer.resetModified();
+
+        const Float zeros[] = { 0.f, 0.f, 0.f };
+        setValue(buffer, DataFieldHandle(4u), 3u, zeros);
+        EXPECT_FALSE(buffer.isModified());
+    }
+}
@@ -26,6 +26,7 @@ namespace ramses_internal
         MOCK_METHOD0(init, Bool()); // Does not exist in IContext, needed for only for testing
         MOCK_METHOD0(getResources, DeviceResourceMapper&());
         MOCK_CONST_METHOD1(getProcAddress, void*(const Char*));
+        MOCK_CONST_METHOD0(getBufferAge, UInt32());
     };
 
 
@@ -45,6 +45,7 @@ namespace ramses_internal
         MOCK_METHOD3(setConstant, void(DataFieldHandle, UInt32, const Matrix22f*));
         MOCK_METHOD3(setConstant, void(DataFieldHandle, UInt32, const Matrix33f*));
         MOCK_METHOD3(setConstant, void(DataFieldHandle, UInt32, const Matrix44f*));
+        MOCK_METHOD3(setInstanceWorldMatrices, void(DataFieldHandle, UInt32, const Matrix44f*));
 
         MOCK_METHOD3(drawIndexedTriangles, void(Int32, Int32, UInt32));
         MOCK_METHOD3(drawTriangles, void(Int32, Int32, UInt32));
@@ -75,6 +76,10 @@ namespace ramses_internal
         MOCK_METHOD1(deleteIndexBuffer, void(DeviceResourceHandle));
         MOCK_METHOD1(activateIndexBuffer, void(DeviceResourceHandle));
 
+        MOCK_METHOD1(allocateVertexArray, DeviceResourceHandle(const VertexArrayInfo&));
+        MOCK_METHOD1(activateVertexArray, void(DeviceResourceHandle));
+        MOCK_METHOD1(deleteVertexArray, void(DeviceResourceHandle));
+
         MOCK_METHOD1(uploadShader, DeviceResourceHandle(const EffectResource&));
         MOCK_METHOD4(uploadBinaryShader, DeviceResourceHandle(const EffectResource&, const UInt8* binaryShaderData, UInt32 binaryShaderDataSize, UInt32 binaryShaderFormat));
         MOCK_METHOD3(getBinaryShader, Bool(DeviceResourceHandle, UInt8Vector&, UInt32&));
@@ -86,6 +91,7 @@ namespace ramses_internal
         MOCK_METHOD4(allocateTextureCube, DeviceResourceHandle(UInt32 faceSize, ETextureFormat textureFormat, UInt32 mipLevelCount, UInt32 totalSizeInBytes));
         MOCK_METHOD1(bindTexture, void(DeviceResourceHandle handle));
         MOCK_METHOD1(generateMipmaps, void(DeviceResourceHandle handle));
+        MOCK_METHOD2(setTextureBaseMipLevel, void(DeviceResourceHandle handle, UInt32 baseMipLevel));
         MOCK_METHOD10(uploadTextureData, void(DeviceResourceHandle handle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 z, UInt32 width, UInt32 height, UInt32 depth, const Byte* data, UInt32 dataSize));
         MOCK_METHOD5(uploadStreamTexture2D, DeviceResourceHandle(DeviceResourceHandle handle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8* data));
         MOCK_METHOD1(deleteTexture, void(DeviceResourceHandle));
@@ -131,6 +137,7 @@ namespace ramses_internal
         static const DeviceResourceHandle FakeRenderBufferDeviceHandle           ;
         static const DeviceResourceHandle FakeTextureSamplerDeviceHandle         ;
         static const DeviceResourceHandle FakeBlitPassRenderTargetDeviceHandle   ;
+        static const DeviceResourceHandle FakeVertexArrayDeviceHandle            ;
 
     private:
         void createDefaultMockCalls();
@@ -43,6 +43,7 @@ public:
     MOCK_METHOD1(setProjectionParams, void(const ProjectionParams& params));
     MOCK_CONST_METHOD0(isWarpingEnabled, bool());
     MOCK_METHOD1(setWarpingMeshData, void(const WarpingMeshData& meshData));
+    MOCK_METHOD1(setInstancedDrawBatchingEnabled, void(ramses_internal::Bool enabled));
     MOCK_CONST_METHOD0(getProjectionParams, const ProjectionParams&());
     MOCK_METHOD1(setViewPosition, void(const Vector3& position));
     MOCK_METHOD1(setViewRotation, void(const Vector3& rotation));
@@ -16,6 +16,7 @@
 #include "RendererLib/IRendererResourceManager.h"
 #include "RendererLib/RendererLogContext.h"
 #include "RendererLib/EResourceStatus.h"
+#include "Math3d/Vector3.h"
 
 namespace ramses_internal{
 
@@ -35,10 +36,12 @@ public:
     MOCK_CONST_METHOD2(getDataBufferDeviceHandle, DeviceResourceHandle(DataBufferHandle, SceneId));
     MOCK_CONST_METHOD2(getTextureBufferDeviceHandle, DeviceResourceHandle(TextureBufferHandle, SceneId));
     MOCK_CONST_METHOD2(getTextureSamplerDeviceHandle, DeviceResourceHandle(TextureSamplerHandle, SceneId));
+    MOCK_CONST_METHOD3(getVertexArrayDeviceHandle, DeviceResourceHandle(DataInstanceHandle, DeviceResourceHandle, SceneId));
 
     // IRendererResourceManager
     MOCK_CONST_METHOD1(getClientResourceStatus, EResourceStatus(const ResourceContentHash& hash));
     MOCK_CONST_METHOD1(getClientResourceType, EResourceType(const ResourceContentHash& hash));
+    MOCK_CONST_METHOD3(getClientResourceVertexBounds, Bool(const ResourceContentHash& hash, Vector3& minOut, Vector3& maxOut));
     MOCK_METHOD2(referenceClientResourcesForScene, void(SceneId sceneId, const ResourceContentHashVector& resources));
     MOCK_METHOD2(unreferenceClientResourcesForScene, void(SceneId sceneId, const ResourceContentHashVector& resources));
     MOCK_METHOD1(getRequestedResourcesAlreadyInCache, void(const IRendererResourceCache* cache));
@@ -48,6 +51,11 @@ public:
     MOCK_METHOD1(processArrivedClientResources, void(IRendererResourceCache* cache));
     MOCK_CONST_METHOD0(hasClientResourcesToBeUploaded, bool());
     MOCK_METHOD0(uploadAndUnloadPendingClientResources, void());
+    MOCK_METHOD1(collectScenesUsingUpdatedClientResources, void(HashSet<SceneId>& scenesOut));
+    MOCK_METHOD1(setClientResourceUploadPriorityScenes, void(const SceneIdVector& sceneIds));
+    MOCK_METHOD2(prefetchClientResources, void(SceneId sceneId, const ResourceContentHashVector& resources));
+    MOCK_METHOD1(releasePrefetchedClientResources, void(SceneId sceneId));
+    MOCK_METHOD0(decompressPrefetchedClientResources, void());
     MOCK_CONST_METHOD1(logResources, void(RendererLogContext& context));
     MOCK_METHOD3(uploadRenderTargetBuffer, void(RenderBufferHandle renderBufferHandle, SceneId sceneId, const RenderBuffer& renderBuffer));
     MOCK_METHOD2(unloadRenderTargetBuffer, void(RenderBufferHandle renderBufferHandle, SceneId sceneId));
@@ -68,6 +76,9 @@ public:
     MOCK_METHOD6(uploadTextureBuffer, void(TextureBufferHandle textureBufferHandle, UInt32 width, UInt32 height, ETextureFormat textureFormat, UInt32 mipLevelCount, SceneId sceneId));
     MOCK_METHOD2(unloadTextureBuffer, void(TextureBufferHandle textureBufferHandle, SceneId sceneId));
     MOCK_METHOD8(updateTextureBuffer, void(TextureBufferHandle textureBufferHandle, UInt32 mipLevel, UInt32 x, UInt32 y, UInt32 width, UInt32 height, const Byte* data, SceneId sceneId));
+
+    MOCK_METHOD3(uploadVertexArray, void(DataInstanceHandle geometryInstance, const VertexArrayInfo& vertexArrayInfo, SceneId sceneId));
+    MOCK_METHOD3(unloadVertexArray, void(DataInstanceHandle geometryInstance, DeviceResourceHandle shader, SceneId sceneId));
 };
 }
 #endif
@@ -98,6 +98,21 @@ public:
         indexArrayIsAvailable = available;
     }
 
+    // vertex array arrives with compressed data only, as if received from network
+    void setVertexArrayCompressed()
+    {
+        const std::vector<Byte> data(1024u, 0u);
+        vertArrayResource.setResourceData(SceneResourceData(new MemoryBlob(data.data(), static_cast<UInt32>(data.size()))), FakeVertArrayHash);
+        vertArrayResource.compress(IResource::CompressionLevel::REALTIME);
+        const CompressedSceneResourceData compressedData = vertArrayResource.getCompressedResourceData();
+        vertArrayResource.setCompressedResourceData(compressedData, FakeVertArrayHash);
+    }
+
+    ramses_internal::Bool isVertexArrayDecompressed() const
+    {
+        return vertArrayResource.isDeCompressedAvailable();
+    }
+
 private:
     ArrayResource vertArrayResource;
     ArrayResource vertArrayResource2;
@@ -128,6 +143,7 @@ public:
     MOCK_CONST_METHOD2(getDataBufferDeviceHandle, DeviceResourceHandle(DataBufferHandle dataBufferHandle, SceneId sceneId));
     MOCK_CONST_METHOD2(getTextureBufferDeviceHandle, DeviceResourceHandle(TextureBufferHandle textureBufferHandle, SceneId sceneId));
     MOCK_CONST_METHOD2(getTextureSamplerDeviceHandle, DeviceResourceHandle(TextureSamplerHandle textureSamplerHandle, SceneId sceneId));
+    MOCK_CONST_METHOD3(getVertexArrayDeviceHandle, DeviceResourceHandle(DataInstanceHandle geometryInstance, DeviceResourceHandle shader, SceneId sceneId));
 };
 }
 #endif
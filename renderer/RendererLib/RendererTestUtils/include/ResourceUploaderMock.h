@@ -23,6 +23,8 @@ namespace ramses_internal
 
         MOCK_METHOD2(uploadResource, DeviceResourceHandle(IRenderBackend&, ManagedResource));
         MOCK_METHOD4(unloadResource, void(IRenderBackend&, EResourceType, ResourceContentHash, DeviceResourceHandle));
+        MOCK_METHOD2(allocateTexture, DeviceResourceHandle(IRenderBackend&, const TextureResource&));
+        MOCK_METHOD4(uploadTextureMipLevel, void(IRenderBackend&, DeviceResourceHandle, const TextureResource&, UInt32));
 
         static const DeviceResourceHandle FakeResourceDeviceHandle;
     };
@@ -21,6 +21,7 @@ namespace ramses_internal
     const DeviceResourceHandle DeviceMock::FakeRenderBufferDeviceHandle(7777u);
     const DeviceResourceHandle DeviceMock::FakeTextureSamplerDeviceHandle(8888u);
     const DeviceResourceHandle DeviceMock::FakeBlitPassRenderTargetDeviceHandle(9999u);
+    const DeviceResourceHandle DeviceMock::FakeVertexArrayDeviceHandle(1212u);
 
     DeviceMock::DeviceMock()
     {
@@ -50,6 +51,7 @@ namespace ramses_internal
         // fake uploads
         ON_CALL(*this, allocateVertexBuffer(_, _)).WillByDefault(Return(FakeVertexBufferDeviceHandle));
         ON_CALL(*this, allocateIndexBuffer(_, _)).WillByDefault(Return(FakeIndexBufferDeviceHandle));
+        ON_CALL(*this, allocateVertexArray(_)).WillByDefault(Return(FakeVertexArrayDeviceHandle));
         ON_CALL(*this, uploadShader(_)).WillByDefault(Return(FakeShaderDeviceHandle));
         ON_CALL(*this, uploadBinaryShader(_, _, _, _)).WillByDefault(Return(FakeShaderDeviceHandle));
         ON_CALL(*this, allocateTexture2D(_, _, _, _, _)).WillByDefault(Return(FakeTextureDeviceHandle));
@@ -27,6 +27,7 @@ RendererResourceManagerMock::RendererResourceManagerMock()
     ON_CALL(*this, getOffscreenBufferColorBufferDeviceHandle(_)).WillByDefault(Return(DeviceMock::FakeRenderBufferDeviceHandle));
 
     ON_CALL(*this, getBlitPassRenderTargetsDeviceHandle(_, _, _, _)).WillByDefault(DoAll(SetArgReferee<2>(DeviceMock::FakeBlitPassRenderTargetDeviceHandle), SetArgReferee<3>(DeviceMock::FakeBlitPassRenderTargetDeviceHandle)));
+    ON_CALL(*this, getVertexArrayDeviceHandle(_, _, _)).WillByDefault(Return(DeviceMock::FakeVertexArrayDeviceHandle));
 
     // no need to strictly test getters
     EXPECT_CALL(*this, getClientResourceDeviceHandle(_)).Times(AnyNumber());
@@ -36,5 +37,6 @@ RendererResourceManagerMock::RendererResourceManagerMock()
     EXPECT_CALL(*this, getRenderTargetBufferDeviceHandle(_, _)).Times(AnyNumber());
     EXPECT_CALL(*this, getBlitPassRenderTargetsDeviceHandle(_, _, _, _)).Times(AnyNumber());
     EXPECT_CALL(*this, getOffscreenBufferColorBufferDeviceHandle(_)).Times(AnyNumber());
+    EXPECT_CALL(*this, getVertexArrayDeviceHandle(_, _, _)).Times(AnyNumber());
 }
 }
@@ -14,6 +14,7 @@
 #include "RendererLib/WindowedRenderer.h"
 #include "RendererLib/ResourceUploader.h"
 #include "RendererFramework/RendererFrameworkLogic.h"
+#include "RendererFramework/SceneFlushRecording.h"
 #include "RendererLib/RendererConfig.h"
 #include "Watchdog/PlatformWatchdog.h"
 #include "Utils/ScopedPointer.h"
@@ -113,6 +114,7 @@ namespace ramses
 
         ramses_internal::RendererCommands                                           m_pendingRendererCommands;
         ramses_internal::RendererCommandBuffer                                      m_rendererCommandBuffer;
+        ramses_internal::ScopedPointer<ramses_internal::SceneFlushRecorder>         m_sceneFlushRecorder; //must be destructed after the RendererFrameworkLogic!
         ramses_internal::RendererFrameworkLogic                                     m_rendererFrameworkLogic;
         ramses_internal::ScopedPointer<ramses_internal::IPlatformFactory>           m_platformFactory;
         ramses_internal::ResourceUploader                                           m_resourceUploader;
@@ -34,6 +34,7 @@ namespace ramses
         , m_binaryShaderCache(config.impl.getBinaryShaderCache() ? new BinaryShaderCacheProxy(*(config.impl.getBinaryShaderCache())) : NULL)
         , m_rendererResourceCache(config.impl.getRendererResourceCache() ? new RendererResourceCacheProxy(*(config.impl.getRendererResourceCache())) : nullptr)
         , m_pendingRendererCommands()
+        , m_sceneFlushRecorder(m_internalConfig.getSceneFlushRecordingFileName().empty() ? nullptr : new ramses_internal::SceneFlushRecorder(m_internalConfig.getSceneFlushRecordingFileName()))
         , m_rendererFrameworkLogic(framework.impl.getConnectionStatusUpdateNotifier(), framework.impl.getResourceComponent(), framework.impl.getScenegraphComponent(), m_rendererCommandBuffer, framework.impl.getFrameworkLock())
         , m_platformFactory(platformFactory != NULL ? platformFactory : ramses_internal::PlatformFactory_Base::CreatePlatformFactory(m_internalConfig))
         , m_resourceUploader(m_rendererStatistics, m_binaryShaderCache.get())
@@ -53,6 +54,13 @@ namespace ramses
             LOG_ERROR(ramses_internal::CONTEXT_RENDERER, "RamsesRenderer::RamsesRenderer creating a RamsesRenderer with framework which is already connected - this may lead to further issues! Please first create RamsesRenderer, then call connect() on RamsesFramework");
         }
 
+        if (m_sceneFlushRecorder && m_sceneFlushRecorder->isOpen())
+        {
+            m_rendererFrameworkLogic.setSceneFlushRecorder(m_sceneFlushRecorder.get());
+        }
+
+        m_renderer->getRenderer().setParallelCommandRecording(static_cast<ramses_internal::UInt16>(m_internalConfig.getParallelCommandRecordingThreadCount()));
+
         { //Add ramsh commands to ramsh, independent of whether it is enabled or not.
 
             m_renderer->registerRamshCommands(framework.impl.getRamsh());
@@ -0,0 +1,318 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "SceneFlushReplay.h"
+#include "RendererLib/WindowedRenderer.h"
+#include "RendererLib/RendererCommandBuffer.h"
+#include "RendererLib/RendererConfig.h"
+#include "RendererLib/RendererConfigUtils.h"
+#include "RendererLib/DisplayConfig.h"
+#include "RendererLib/ResourceUploader.h"
+#include "RendererLib/RendererStatistics.h"
+#include "Platform_Base/PlatformFactory_Base.h"
+#include "PlatformAbstraction/PlatformTime.h"
+#include "Utils/LogMacros.h"
+#include "Utils/RamsesLogger.h"
+#include <algorithm>
+#include <memory>
+
+namespace ramses_internal
+{
+    void ReplayResourceProvider::addResource(const ManagedResource& resource)
+    {
+        m_resources.put(resource.getResourceObject()->getHash(), resource);
+    }
+
+    void ReplayResourceProvider::requestResourceAsyncronouslyFromFramework(const ResourceContentHashVector& ids, const RequesterID& requesterID, const SceneId& sceneId)
+    {
+        ManagedResourceVector& arrivedResources = m_arrivedResources[requesterID];
+        for (const auto& id : ids)
+        {
+            const ManagedResource* resource = m_resources.get(id);
+            if (resource != nullptr)
+            {
+                arrivedResources.push_back(*resource);
+            }
+            else
+            {
+                LOG_WARN(CONTEXT_RENDERER, "ReplayResourceProvider: resource " << id << " requested for scene " << sceneId << " is not part of recording");
+            }
+        }
+    }
+
+    void ReplayResourceProvider::cancelResourceRequest(const ResourceContentHash& resourceHash, const RequesterID& requesterID)
+    {
+        ManagedResourceVector* arrivedResources = m_arrivedResources.get(requesterID);
+        if (arrivedResources != nullptr)
+        {
+            auto it = std::find_if(arrivedResources->begin(), arrivedResources->end(), [&resourceHash](const ManagedResource& resource) {
+                return resource.getResourceObject()->getHash() == resourceHash;
+            });
+            if (it != arrivedResources->end())
+            {
+                arrivedResources->erase(it);
+            }
+        }
+    }
+
+    ManagedResourceVector ReplayResourceProvider::popArrivedResources(const RequesterID& requesterID)
+    {
+        ManagedResourceVector resources;
+        ManagedResourceVector* arrivedResources = m_arrivedResources.get(requesterID);
+        if (arrivedResources != nullptr)
+        {
+            resources.swap(*arrivedResources);
+        }
+        return resources;
+    }
+
+    void ReplaySceneGraphConsumer::setSceneRendererServiceHandler(ISceneRendererServiceHandler*)
+    {
+    }
+
+    void ReplaySceneGraphConsumer::subscribeScene(const Guid&, SceneId sceneId)
+    {
+        m_subscriptionRequests.put(sceneId);
+    }
+
+    void ReplaySceneGraphConsumer::unsubscribeScene(const Guid&, SceneId sceneId)
+    {
+        m_subscriptionRequests.remove(sceneId);
+    }
+
+    Bool ReplaySceneGraphConsumer::takeSubscriptionRequest(SceneId sceneId)
+    {
+        return m_subscriptionRequests.remove(sceneId) == EStatus_RAMSES_OK;
+    }
+
+    SceneFlushReplay::SceneFlushReplay(int argc, char* argv[])
+        : m_parser(argc, argv)
+        , m_helpArgument(m_parser, "help", "help", false, "Print this help")
+        , m_recordingFileArgument(m_parser, "rec", "recording", String(), "Scene flush recording made with renderer option -rec")
+        , m_realTimeArgument(m_parser, "rt", "realtime", false, "Feed flushes with recorded timing instead of one flush per frame")
+        , m_noDisplayArgument(m_parser, "nodisp", "no-display", false, "Only apply flushes to scenes, no display is created and no GPU needed")
+        , m_providerId(true)
+    {
+        GetRamsesLogger().initialize(m_parser, String(), String(), false);
+    }
+
+    void SceneFlushReplay::printUsage() const
+    {
+        const String argumentHelpString = m_helpArgument.getHelpString() + m_recordingFileArgument.getHelpString() + m_realTimeArgument.getHelpString() + m_noDisplayArgument.getHelpString();
+
+        LOG_INFO(CONTEXT_RENDERER,
+            "\nUsage: " << m_parser.getProgramName() << " [options] -rec <recordingFile>\n"
+            "Replays scene flushes recorded by a renderer and reports the time spent per frame profiler region\n"
+            "Arguments:\n" << argumentHelpString);
+
+        RendererConfigUtils::PrintCommandLineOptions();
+    }
+
+    int SceneFlushReplay::run()
+    {
+        if (m_helpArgument)
+        {
+            printUsage();
+            return 0;
+        }
+
+        const String recordingFile = m_recordingFileArgument;
+        if (recordingFile.empty())
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "A recording file has to be specified by option " << m_recordingFileArgument.getHelpString());
+            return 1;
+        }
+        if (!loadRecording(recordingFile))
+        {
+            return 1;
+        }
+
+        RendererConfig rendererConfig;
+        RendererConfigUtils::ApplyValuesFromCommandLine(m_parser, rendererConfig);
+
+        RendererStatistics rendererStatistics;
+        RendererCommandBuffer commandBuffer;
+        std::unique_ptr<IPlatformFactory> platformFactory(PlatformFactory_Base::CreatePlatformFactory(rendererConfig));
+        ResourceUploader resourceUploader(rendererStatistics);
+        WindowedRenderer renderer(commandBuffer, m_sceneGraphConsumer, *platformFactory, rendererStatistics);
+
+        const Bool useDisplay = !m_noDisplayArgument;
+        if (useDisplay)
+        {
+            DisplayConfig displayConfig;
+            RendererConfigUtils::ApplyValuesFromCommandLine(m_parser, displayConfig);
+            commandBuffer.createDisplay(displayConfig, m_resourceProvider, resourceUploader, DisplayHandle(0u));
+        }
+
+        const UInt64 replayStartTimeUs = PlatformTime::GetMicrosecondsMonotonic();
+        UInt32 remainingTrailingFrames = TrailingFrames;
+        while (m_nextRecord < m_records.size() || remainingTrailingFrames-- > 0u)
+        {
+            feedRecords(commandBuffer, PlatformTime::GetMicrosecondsMonotonic() - replayStartTimeUs);
+
+            renderer.update();
+            if (useDisplay)
+            {
+                renderer.render();
+            }
+            renderer.finishFrameStatistics(std::chrono::microseconds{ 0u });
+
+            RendererEventVector events;
+            renderer.dispatchRendererEvents(events);
+            handleRendererEvents(commandBuffer, events);
+            collectFrameTimings(renderer.getRenderer().getProfilerStatistics());
+        }
+
+        printReport(PlatformTime::GetMicrosecondsMonotonic() - replayStartTimeUs);
+        return 0;
+    }
+
+    Bool SceneFlushReplay::loadRecording(const String& filename)
+    {
+        SceneFlushRecordReader reader(filename);
+        if (!reader.isOpen())
+        {
+            return false;
+        }
+
+        SceneFlushRecord record;
+        while (reader.readNextRecord(record))
+        {
+            if (record.type == ESceneFlushRecordType_Resource)
+            {
+                m_resourceProvider.addResource(record.resource);
+            }
+            else
+            {
+                m_records.push_back(std::move(record));
+            }
+            record = SceneFlushRecord();
+        }
+
+        LOG_INFO(CONTEXT_RENDERER, "SceneFlushReplay: loaded " << m_records.size() << " scene records from " << filename);
+        return true;
+    }
+
+    void SceneFlushReplay::feedRecords(RendererCommandBuffer& commandBuffer, UInt64 replayTimeUs)
+    {
+        // recording usually starts long before first scene gets published
+        const UInt64 recordingStartTimeUs = m_records.empty() ? 0u : m_records.front().timeStampUs;
+
+        while (m_nextRecord < m_records.size())
+        {
+            SceneFlushRecord& record = m_records[m_nextRecord];
+            if (m_realTimeArgument && record.timeStampUs - recordingStartTimeUs > replayTimeUs)
+            {
+                return;
+            }
+
+            const SceneId sceneId = record.sceneInfo.sceneID;
+            switch (record.type)
+            {
+            case ESceneFlushRecordType_ScenePublished:
+                commandBuffer.publishScene(sceneId, m_providerId, record.sceneInfo.publicationMode);
+                commandBuffer.subscribeScene(sceneId);
+                break;
+            case ESceneFlushRecordType_SceneReceived:
+                if (m_receivedScenes.hasElement(sceneId))
+                {
+                    LOG_WARN(CONTEXT_RENDERER, "SceneFlushReplay::feedRecords: ignoring repeated subscription of scene " << sceneId);
+                }
+                else if (m_sceneGraphConsumer.takeSubscriptionRequest(sceneId))
+                {
+                    m_receivedScenes.put(sceneId);
+                    commandBuffer.receiveScene(record.sceneInfo);
+                }
+                else if (++m_framesWaitingForSubscription < MaxFramesWaitingForSubscription)
+                {
+                    // renderer requests subscription within next update
+                    return;
+                }
+                else
+                {
+                    LOG_ERROR(CONTEXT_RENDERER, "SceneFlushReplay::feedRecords: renderer did not subscribe scene " << sceneId << ", skipping it");
+                }
+                m_framesWaitingForSubscription = 0u;
+                break;
+            case ESceneFlushRecordType_SceneActions:
+                ++m_nextRecord;
+                commandBuffer.enqueueActionsForScene(sceneId, std::move(record.actions));
+                if (!m_realTimeArgument)
+                {
+                    return;
+                }
+                continue;
+            case ESceneFlushRecordType_Resource:
+            case ESceneFlushRecordType_NUMBER_OF_ELEMENTS:
+                assert(false);
+                break;
+            }
+            ++m_nextRecord;
+        }
+    }
+
+    void SceneFlushReplay::handleRendererEvents(RendererCommandBuffer& commandBuffer, const RendererEventVector& events)
+    {
+        for (const auto& event : events)
+        {
+            switch (event.eventType)
+            {
+            case ERendererEventType_DisplayCreateFailed:
+                LOG_ERROR(CONTEXT_RENDERER, "SceneFlushReplay: failed to create display, use option " << m_noDisplayArgument.getHelpString());
+                break;
+            case ERendererEventType_SceneSubscribed:
+                if (!m_noDisplayArgument)
+                {
+                    commandBuffer.mapSceneToDisplay(event.sceneId, DisplayHandle(0u), m_nextSceneRenderOrder++);
+                }
+                break;
+            case ERendererEventType_SceneMapped:
+                commandBuffer.showScene(event.sceneId);
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    void SceneFlushReplay::collectFrameTimings(FrameProfilerStatistics& statistics)
+    {
+        const UInt numberOfRegions = FrameProfilerStatistics::NumberOfRegions;
+        const FrameProfilerStatistics::FrameTimings& timings = statistics.getFrameTimings();
+        assert(timings.size() >= 2u * numberOfRegions);
+
+        // last entries belong to frame in progress, the ones before to just finished frame
+        const UInt finishedFrameOffset = timings.size() - 2u * numberOfRegions;
+        for (UInt region = 0u; region < numberOfRegions; ++region)
+        {
+            const UInt regionTime = timings[finishedFrameOffset + region];
+            m_regionTotalTimes[region] += regionTime;
+            m_regionMaxTimes[region] = std::max(m_regionMaxTimes[region], regionTime);
+        }
+
+        const UInt32 finishedFrameId = (statistics.getCurrentFrameId() + FrameProfilerStatistics::NumberOfFrames - 1u) % FrameProfilerStatistics::NumberOfFrames;
+        m_appliedSceneActions += static_cast<UInt64>(statistics.getCounterValues(FrameProfilerStatistics::ECounter::AppliedSceneActions)[finishedFrameId]);
+        ++m_frameCount;
+
+        statistics.resetFrameTimings();
+    }
+
+    void SceneFlushReplay::printReport(UInt64 replayTimeUs) const
+    {
+        LOG_INFO_F(CONTEXT_RENDERER, ([&](StringOutputStream& sos) {
+            sos << "SceneFlushReplay: replayed " << m_records.size() << " scene records in " << m_frameCount << " frames, "
+                << replayTimeUs / 1000u << " ms, applied scene actions: " << m_appliedSceneActions << "\n";
+            sos << "Region timings(us) [avg/max per frame]:\n";
+            for (UInt region = 0u; region < FrameProfilerStatistics::NumberOfRegions; ++region)
+            {
+                const UInt64 average = m_frameCount > 0u ? m_regionTotalTimes[region] / m_frameCount : 0u;
+                sos << "  " << EnumToString(FrameProfilerStatistics::ERegion(region)) << ": " << average << "/" << m_regionMaxTimes[region] << "\n";
+            }
+        }));
+    }
+}
@@ -0,0 +1,98 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_RENDERER_REPLAY_SCENEFLUSHREPLAY_H
+#define RAMSES_RENDERER_REPLAY_SCENEFLUSHREPLAY_H
+
+#include "RendererFramework/SceneFlushRecording.h"
+#include "RendererFramework/IResourceProvider.h"
+#include "RendererLib/FrameProfilerStatistics.h"
+#include "RendererEventCollector.h"
+#include "Components/ISceneGraphConsumerComponent.h"
+#include "Collections/HashMap.h"
+#include "Collections/HashSet.h"
+#include "Utils/CommandLineParser.h"
+#include "Utils/Argument.h"
+#include <vector>
+
+namespace ramses_internal
+{
+    class RendererCommandBuffer;
+
+    // Provides recorded resources as soon as renderer requests them
+    class ReplayResourceProvider : public IResourceProvider
+    {
+    public:
+        void addResource(const ManagedResource& resource);
+
+        virtual void requestResourceAsyncronouslyFromFramework(const ResourceContentHashVector& ids, const RequesterID& requesterID, const SceneId& sceneId) override;
+        virtual void cancelResourceRequest(const ResourceContentHash& resourceHash, const RequesterID& requesterID) override;
+        virtual ManagedResourceVector popArrivedResources(const RequesterID& requesterID) override;
+
+    private:
+        HashMap<ResourceContentHash, ManagedResource> m_resources;
+        HashMap<RequesterID, ManagedResourceVector> m_arrivedResources;
+    };
+
+    // Collects subscription requests of renderer, replay answers them with the recorded scene
+    class ReplaySceneGraphConsumer : public ISceneGraphConsumerComponent
+    {
+    public:
+        virtual void setSceneRendererServiceHandler(ISceneRendererServiceHandler* sceneRendererHandler) override;
+        virtual void subscribeScene(const Guid& to, SceneId sceneId) override;
+        virtual void unsubscribeScene(const Guid& to, SceneId sceneId) override;
+
+        Bool takeSubscriptionRequest(SceneId sceneId);
+
+    private:
+        HashSet<SceneId> m_subscriptionRequests;
+    };
+
+    // Feeds a scene flush recording into the renderer and reports the frame profiler region timings.
+    // By default one flush is fed per frame which makes replays comparable, optionally the recorded timing is kept.
+    class SceneFlushReplay
+    {
+    public:
+        SceneFlushReplay(int argc, char* argv[]);
+
+        int run();
+
+    private:
+        static const UInt32 TrailingFrames = 60u;
+        static const UInt32 MaxFramesWaitingForSubscription = 100u;
+
+        void printUsage() const;
+        Bool loadRecording(const String& filename);
+        void feedRecords(RendererCommandBuffer& commandBuffer, UInt64 replayTimeUs);
+        void handleRendererEvents(RendererCommandBuffer& commandBuffer, const RendererEventVector& events);
+        void collectFrameTimings(FrameProfilerStatistics& statistics);
+        void printReport(UInt64 replayTimeUs) const;
+
+        CommandLineParser m_parser;
+        ArgumentBool      m_helpArgument;
+        ArgumentString    m_recordingFileArgument;
+        ArgumentBool      m_realTimeArgument;
+        ArgumentBool      m_noDisplayArgument;
+
+        std::vector<SceneFlushRecord> m_records;
+        UInt                          m_nextRecord = 0u;
+        UInt32                        m_framesWaitingForSubscription = 0u;
+        HashSet<SceneId>              m_receivedScenes;
+        Int32                         m_nextSceneRenderOrder = 0;
+        const Guid                    m_providerId;
+        ReplayResourceProvider        m_resourceProvider;
+        ReplaySceneGraphConsumer      m_sceneGraphConsumer;
+
+        UInt32 m_frameCount = 0u;
+        UInt64 m_appliedSceneActions = 0u;
+        UInt64 m_regionTotalTimes[FrameProfilerStatistics::NumberOfRegions] = {};
+        UInt   m_regionMaxTimes[FrameProfilerStatistics::NumberOfRegions] = {};
+    };
+}
+
+#endif
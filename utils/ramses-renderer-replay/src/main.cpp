@@ -0,0 +1,15 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "SceneFlushReplay.h"
+
+int main(int argc, char* argv[])
+{
+    ramses_internal::SceneFlushReplay replay(argc, argv);
+    return replay.run();
+}
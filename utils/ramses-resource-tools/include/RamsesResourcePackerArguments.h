@@ -26,6 +26,7 @@ public:
     const ramses_internal::String& getOutputResourceFile() const;
 
     bool getUseCompression() const;
+    bool getAppendToOutputResourceFile() const;
 
     virtual void printUsage() const override;
 
@@ -35,6 +36,7 @@ private:
     FilePathsConfig m_inputFiles;
     ramses_internal::String m_outputFile;
     bool m_outCompression;
+    bool m_outAppend;
 };
 
 #endif
@@ -0,0 +1,44 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_RESOURCE_TOOLS_RAMSESTEXTUREENCODERARGUMENTS_H
+#define RAMSES_RESOURCE_TOOLS_RAMSESTEXTUREENCODERARGUMENTS_H
+
+#include "Arguments.h"
+#include "ramses-client-api/TextureEnums.h"
+
+namespace ramses_internal
+{
+    class CommandLineParser;
+}
+
+class RamsesTextureEncoderArguments : public Arguments
+{
+public:
+    virtual bool parseArguments(int argc, char const*const* argv) override;
+
+    const ramses_internal::String& getInputPngFile() const;
+    const ramses_internal::String& getOutputResourceFile() const;
+    ramses::ETextureFormat getTextureFormat() const;
+
+    bool getGenerateMipMaps() const;
+    bool getUseCompression() const;
+
+    virtual void printUsage() const override;
+
+private:
+    bool loadTextureFormat(const ramses_internal::CommandLineParser& parser);
+
+    ramses_internal::String m_inputFile;
+    ramses_internal::String m_outputFile;
+    ramses::ETextureFormat m_textureFormat;
+    bool m_generateMipMaps;
+    bool m_outCompression;
+};
+
+#endif
@@ -0,0 +1,50 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_RESOURCE_TOOLS_TEXTUREBLOCKENCODER_H
+#define RAMSES_RESOURCE_TOOLS_TEXTUREBLOCKENCODER_H
+
+#include "ramses-client-api/TextureEnums.h"
+#include <vector>
+#include <stdint.h>
+
+// Encodes RGBA8 texture data on CPU to block compressed formats, which can be uploaded to GPU as they are.
+// Only a subset of the modes of each format is used by the encoder, which is enough for good quality and
+// is supported by every decoder:
+//  - ETC2 RGB: ETC1 compatible individual and differential modes
+//  - ETC2 RGBA: EAC alpha block followed by ETC2 RGB block
+//  - ASTC 4x4: single partition, RGB direct endpoints for opaque blocks and RGBA direct endpoints otherwise
+// Blocks are 4x4 pixels, block pixels are given and returned row by row.
+class TextureBlockEncoder
+{
+public:
+    typedef std::vector<uint8_t> LevelData;
+
+    struct Statistics
+    {
+        // peak signal to noise ratio of decoded against original data over all levels, infinite if lossless
+        double psnr = 0.0;
+        double megaPixelsPerSecond = 0.0;
+    };
+
+    static bool IsFormatSupported(ramses::ETextureFormat format);
+    static uint32_t GetBlockSize(ramses::ETextureFormat format);
+    static uint32_t GetEncodedLevelSize(ramses::ETextureFormat format, uint32_t width, uint32_t height);
+
+    // Encodes all levels of a mip chain, level i is expected to have size max(1, width >> i) x max(1, height >> i).
+    // Block rows of all levels are encoded in parallel.
+    static std::vector<LevelData> EncodeMipChain(ramses::ETextureFormat format, uint32_t width, uint32_t height, const std::vector<LevelData>& rgba8Levels, Statistics& statistics);
+
+    static void EncodeBlock(ramses::ETextureFormat format, const uint8_t* rgba8Pixels, uint8_t* encodedBlock);
+    static void DecodeBlock(ramses::ETextureFormat format, const uint8_t* encodedBlock, uint8_t* rgba8Pixels);
+
+    static const uint32_t BlockDimension = 4u;
+    static const uint32_t BlockPixelCount = BlockDimension * BlockDimension;
+};
+
+#endif
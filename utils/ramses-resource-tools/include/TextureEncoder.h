@@ -0,0 +1,20 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_RESOURCE_TOOLS_TEXTUREENCODER_H
+#define RAMSES_RESOURCE_TOOLS_TEXTUREENCODER_H
+
+class RamsesTextureEncoderArguments;
+
+class TextureEncoder
+{
+public:
+    static bool Encode(const RamsesTextureEncoderArguments& arguments);
+};
+
+#endif
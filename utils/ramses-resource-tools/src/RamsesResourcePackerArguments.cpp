@@ -21,6 +21,9 @@ namespace
 
     const char* OUT_COMPRESSION = "out-compression";
     const char* OUT_COMPRESSION_SHORT = "oc";
+
+    const char* OUT_APPEND = "out-append";
+    const char* OUT_APPEND_SHORT = "oa";
 }
 
 bool RamsesResourcePackerArguments::parseArguments(int argc, char const*const* argv)
@@ -37,6 +40,7 @@ bool RamsesResourcePackerArguments::parseArguments(int argc, char const*const* a
     }
 
     m_outCompression = ramses_internal::ArgumentBool(parser, OUT_COMPRESSION_SHORT, OUT_COMPRESSION, false);
+    m_outAppend = ramses_internal::ArgumentBool(parser, OUT_APPEND_SHORT, OUT_APPEND, false);
 
     return true;
 }
@@ -51,15 +55,22 @@ bool RamsesResourcePackerArguments::getUseCompression() const
     return m_outCompression;
 }
 
+bool RamsesResourcePackerArguments::getAppendToOutputResourceFile() const
+{
+    return m_outAppend;
+}
+
 void RamsesResourcePackerArguments::printUsage() const
 {
     PRINT_HINT( "usage: program\n"
                 "--%s (-%s) <filename>\n"
                 "--%s (-%s) <filename>\n"
+                "--%s (-%s) {optional}\n"
                 "--%s (-%s) {optional}\n\n",
                 IN_RESOURCE_FILES_CONFIG_NAME, IN_RESOURCE_FILES_CONFIG_SHORT_NAME,
                 OUT_RESOURCE_FILE_NAME, OUT_RESOURCE_FILE_SHORT_NAME,
-                OUT_COMPRESSION, OUT_COMPRESSION_SHORT);
+                OUT_COMPRESSION, OUT_COMPRESSION_SHORT,
+                OUT_APPEND, OUT_APPEND_SHORT);
 }
 
 bool RamsesResourcePackerArguments::loadInputResourceFiles(const ramses_internal::CommandLineParser& parser)
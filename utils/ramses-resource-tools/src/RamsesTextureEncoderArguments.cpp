@@ -0,0 +1,144 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RamsesTextureEncoderArguments.h"
+#include "TextureBlockEncoder.h"
+#include "ConsoleUtils.h"
+#include "Utils/CommandLineParser.h"
+#include "Utils/Argument.h"
+#include <cstring>
+#include <assert.h>
+
+namespace
+{
+    const char* IN_PNG_FILE_NAME = "in-png-file";
+    const char* IN_PNG_FILE_SHORT_NAME = "ip";
+
+    const char* OUT_RESOURCE_FILE_NAME = "out-resource-file";
+    const char* OUT_RESOURCE_FILE_SHORT_NAME = "or";
+
+    const char* TEXTURE_FORMAT_NAME = "texture-format";
+    const char* TEXTURE_FORMAT_SHORT_NAME = "tf";
+
+    const char* GENERATE_MIPMAPS = "generate-mipmaps";
+    const char* GENERATE_MIPMAPS_SHORT = "gm";
+
+    const char* OUT_COMPRESSION = "out-compression";
+    const char* OUT_COMPRESSION_SHORT = "oc";
+
+    const char* TEXTURE_FORMAT_NAME_PREFIX = "ETextureFormat_";
+
+    const ramses::ETextureFormat EncodableTextureFormats[] =
+    {
+        ramses::ETextureFormat_ETC2RGB,
+        ramses::ETextureFormat_ETC2RGBA,
+        ramses::ETextureFormat_ASTC_RGBA_4x4,
+        ramses::ETextureFormat_ASTC_SRGBA_4x4
+    };
+
+    const char* GetTextureFormatShortName(ramses::ETextureFormat format)
+    {
+        return ramses::getTextureFormatString(format) + std::strlen(TEXTURE_FORMAT_NAME_PREFIX);
+    }
+}
+
+bool RamsesTextureEncoderArguments::parseArguments(int argc, char const*const* argv)
+{
+    ramses_internal::CommandLineParser parser(argc, argv);
+    if (!LoadMandatoryExistingFileArgument(parser, IN_PNG_FILE_NAME, IN_PNG_FILE_SHORT_NAME, m_inputFile))
+    {
+        return false;
+    }
+
+    if (!LoadMandatoryArgument(parser, OUT_RESOURCE_FILE_NAME, OUT_RESOURCE_FILE_SHORT_NAME, m_outputFile))
+    {
+        return false;
+    }
+
+    if (!loadTextureFormat(parser))
+    {
+        return false;
+    }
+
+    m_generateMipMaps = ramses_internal::ArgumentBool(parser, GENERATE_MIPMAPS_SHORT, GENERATE_MIPMAPS, false);
+    m_outCompression = ramses_internal::ArgumentBool(parser, OUT_COMPRESSION_SHORT, OUT_COMPRESSION, false);
+
+    return true;
+}
+
+const ramses_internal::String& RamsesTextureEncoderArguments::getInputPngFile() const
+{
+    return m_inputFile;
+}
+
+const ramses_internal::String& RamsesTextureEncoderArguments::getOutputResourceFile() const
+{
+    return m_outputFile;
+}
+
+ramses::ETextureFormat RamsesTextureEncoderArguments::getTextureFormat() const
+{
+    return m_textureFormat;
+}
+
+bool RamsesTextureEncoderArguments::getGenerateMipMaps() const
+{
+    return m_generateMipMaps;
+}
+
+bool RamsesTextureEncoderArguments::getUseCompression() const
+{
+    return m_outCompression;
+}
+
+void RamsesTextureEncoderArguments::printUsage() const
+{
+    ramses_internal::String formatNames;
+    for (const auto format : EncodableTextureFormats)
+    {
+        if (formatNames.getLength() > 0u)
+        {
+            formatNames += "|";
+        }
+        formatNames += GetTextureFormatShortName(format);
+    }
+
+    PRINT_HINT( "usage: program\n"
+                "--%s (-%s) <filename>\n"
+                "--%s (-%s) <filename>\n"
+                "--%s (-%s) <%s>\n"
+                "--%s (-%s) {optional}\n"
+                "--%s (-%s) {optional}\n\n",
+                IN_PNG_FILE_NAME, IN_PNG_FILE_SHORT_NAME,
+                OUT_RESOURCE_FILE_NAME, OUT_RESOURCE_FILE_SHORT_NAME,
+                TEXTURE_FORMAT_NAME, TEXTURE_FORMAT_SHORT_NAME, formatNames.c_str(),
+                GENERATE_MIPMAPS, GENERATE_MIPMAPS_SHORT,
+                OUT_COMPRESSION, OUT_COMPRESSION_SHORT);
+}
+
+bool RamsesTextureEncoderArguments::loadTextureFormat(const ramses_internal::CommandLineParser& parser)
+{
+    ramses_internal::String formatName;
+    if (!LoadMandatoryArgument(parser, TEXTURE_FORMAT_NAME, TEXTURE_FORMAT_SHORT_NAME, formatName))
+    {
+        return false;
+    }
+
+    for (const auto format : EncodableTextureFormats)
+    {
+        assert(TextureBlockEncoder::IsFormatSupported(format));
+        if (formatName == GetTextureFormatShortName(format) || formatName == ramses::getTextureFormatString(format))
+        {
+            m_textureFormat = format;
+            return true;
+        }
+    }
+
+    PRINT_ERROR("texture format \"%s\" can not be encoded\n", formatName.c_str());
+    return false;
+}
@@ -11,12 +11,8 @@
 #include "ConsoleUtils.h"
 
 #include "ramses-client-api/RamsesClient.h"
-#include "ramses-client-api/ResourceFileDescription.h"
-#include "ramses-client-api/ResourceFileDescriptionSet.h"
 #include "ramses-framework-api/RamsesFramework.h"
 #include "RamsesClientImpl.h"
-#include "ResourceFileDescriptionImpl.h"
-#include "RamsesObjectTypeUtils.h"
 
 bool ResourcePacker::Pack(const RamsesResourcePackerArguments& arguments)
 {
@@ -29,28 +25,17 @@ bool ResourcePacker::Pack(const RamsesResourcePackerArguments& arguments)
     ramses::RamsesFramework framework;
     ramses::RamsesClient ramsesClient("ramses client", framework);
 
-    for(const auto& file : inputFiles)
+    // resources are copied from input files as they are stored there, without decompressing and compressing them again
+    ramses_internal::Vector<ramses_internal::String> inputFilenames;
+    for (const auto& file : inputFiles)
     {
-        ramses::ResourceFileDescription fileDescription(file.c_str());
-        if (ramses::StatusOK != ramsesClient.loadResources(fileDescription))
-        {
-            PRINT_ERROR("ramses fail to load input resource file:\"%s\".\n", file.c_str());
-            return false;
-        }
+        inputFilenames.push_back(file);
     }
 
-    ramses::ResourceFileDescription outputFile(arguments.getOutputResourceFile().c_str());
-    const ramses::RamsesObjectVector resourceObjects = ramsesClient.impl.getListOfResourceObjects();
-    for(const auto& resObj : resourceObjects)
+    const ramses::status_t packingStatus = ramsesClient.impl.packResourceFiles(inputFilenames, arguments.getOutputResourceFile(), arguments.getUseCompression(), arguments.getAppendToOutputResourceFile());
+    if (ramses::StatusOK != packingStatus)
     {
-        const ramses::Resource& resource = ramses::RamsesObjectTypeUtils::ConvertTo<ramses::Resource>(*resObj);
-        outputFile.impl->m_resources.push_back(&resource);
-    }
-
-    const ramses::status_t savingStatus = ramsesClient.saveResources(outputFile, arguments.getUseCompression());
-    if (ramses::StatusOK != savingStatus)
-    {
-        PRINT_ERROR("ramses fail to save to output resource file.\n");
+        PRINT_ERROR("ramses fail to pack input resource files to output resource file: %s\n", ramsesClient.getStatusMessage(packingStatus));
         return false;
     }
 
@@ -0,0 +1,763 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "TextureBlockEncoder.h"
+#include "Utils/ParallelJobs.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <assert.h>
+
+namespace
+{
+    const uint32_t PixelCount = TextureBlockEncoder::BlockPixelCount;
+
+    uint8_t ClampToByte(int32_t value)
+    {
+        return static_cast<uint8_t>(std::min(255, std::max(0, value)));
+    }
+
+    // ETC and EAC address pixels of a block column by column
+    uint32_t GetColumnMajorIndex(uint32_t pixel)
+    {
+        return (pixel % 4u) * 4u + pixel / 4u;
+    }
+
+    uint32_t GetSquaredError(const uint8_t* pixelA, const uint8_t* pixelB, uint32_t componentCount)
+    {
+        uint32_t error = 0u;
+        for (uint32_t c = 0u; c < componentCount; ++c)
+        {
+            const int32_t difference = int32_t(pixelA[c]) - int32_t(pixelB[c]);
+            error += difference * difference;
+        }
+        return error;
+    }
+
+    // ETC2 RGB, ETC1 compatible modes: block is split into two sub-blocks of 2x4 or 4x2 pixels (flipped), each has a base color
+    // and a table of intensity modifiers, pixels select one of four modifiers which is added to all components of base color
+    const int32_t ETCModifierTables[8][2] = { { 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 }, { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 } };
+
+    int32_t GetETCModifier(uint32_t table, uint32_t index)
+    {
+        const int32_t modifier = ETCModifierTables[table][index & 1u];
+        return (index & 2u) != 0u ? -modifier : modifier;
+    }
+
+    uint32_t GetETCSubblock(uint32_t pixel, bool flip)
+    {
+        return (flip ? pixel / 4u : pixel % 4u) / 2u;
+    }
+
+    int32_t Expand4Bit(int32_t value)
+    {
+        return (value << 4) | value;
+    }
+
+    int32_t Expand5Bit(int32_t value)
+    {
+        return (value << 3) | (value >> 2);
+    }
+
+    struct ETCEncoding
+    {
+        uint32_t error;
+        bool differential;
+        bool flip;
+        int32_t colors[2][3];
+        uint32_t tables[2];
+        uint8_t selectors[PixelCount];
+    };
+
+    // selects modifier table and modifiers of sub-block pixels with smallest error for given base color
+    uint32_t FitETCSubblock(const uint8_t* pixels, bool flip, uint32_t subblock, const int32_t baseColor[3], uint32_t& bestTable, uint8_t* bestSelectors)
+    {
+        uint32_t bestError = std::numeric_limits<uint32_t>::max();
+        uint8_t selectors[PixelCount];
+        for (uint32_t table = 0u; table < 8u; ++table)
+        {
+            uint32_t error = 0u;
+            for (uint32_t pixel = 0u; pixel < PixelCount && error < bestError; ++pixel)
+            {
+                if (GetETCSubblock(pixel, flip) != subblock)
+                    continue;
+
+                uint32_t bestPixelError = std::numeric_limits<uint32_t>::max();
+                for (uint32_t index = 0u; index < 4u; ++index)
+                {
+                    const int32_t modifier = GetETCModifier(table, index);
+                    const uint8_t modifiedColor[3] = { ClampToByte(baseColor[0] + modifier), ClampToByte(baseColor[1] + modifier), ClampToByte(baseColor[2] + modifier) };
+                    const uint32_t pixelError = GetSquaredError(modifiedColor, pixels + pixel * 4u, 3u);
+                    if (pixelError < bestPixelError)
+                    {
+                        bestPixelError = pixelError;
+                        selectors[pixel] = static_cast<uint8_t>(index);
+                    }
+                }
+                error += bestPixelError;
+            }
+
+            if (error < bestError)
+            {
+                bestError = error;
+                bestTable = table;
+                for (uint32_t pixel = 0u; pixel < PixelCount; ++pixel)
+                {
+                    if (GetETCSubblock(pixel, flip) == subblock)
+                        bestSelectors[pixel] = selectors[pixel];
+                }
+            }
+        }
+
+        return bestError;
+    }
+
+    void EncodeETC2RGBBlock(const uint8_t* pixels, uint8_t* block)
+    {
+        ETCEncoding best = {};
+        best.error = std::numeric_limits<uint32_t>::max();
+
+        for (const bool flip : { false, true })
+        {
+            uint32_t sums[2][3] = {};
+            for (uint32_t pixel = 0u; pixel < PixelCount; ++pixel)
+            {
+                const uint32_t subblock = GetETCSubblock(pixel, flip);
+                for (uint32_t c = 0u; c < 3u; ++c)
+                    sums[subblock][c] += pixels[pixel * 4u + c];
+            }
+
+            int32_t colors4Bit[2][3];
+            int32_t colors5Bit[2][3];
+            bool differentialPossible = true;
+            for (uint32_t c = 0u; c < 3u; ++c)
+            {
+                for (uint32_t subblock = 0u; subblock < 2u; ++subblock)
+                {
+                    colors4Bit[subblock][c] = static_cast<int32_t>((sums[subblock][c] * 15u + 4u * 255u) / (8u * 255u));
+                    colors5Bit[subblock][c] = static_cast<int32_t>((sums[subblock][c] * 31u + 4u * 255u) / (8u * 255u));
+                }
+                const int32_t delta = colors5Bit[1][c] - colors5Bit[0][c];
+                differentialPossible = differentialPossible && delta >= -4 && delta <= 3;
+            }
+
+            for (const bool differential : { false, true })
+            {
+                if (differential && !differentialPossible)
+                    continue;
+
+                ETCEncoding candidate = {};
+                candidate.differential = differential;
+                candidate.flip = flip;
+                for (uint32_t subblock = 0u; subblock < 2u; ++subblock)
+                {
+                    int32_t baseColor[3];
+                    for (uint32_t c = 0u; c < 3u; ++c)
+                    {
+                        candidate.colors[subblock][c] = differential ? colors5Bit[subblock][c] : colors4Bit[subblock][c];
+                        baseColor[c] = differential ? Expand5Bit(candidate.colors[subblock][c]) : Expand4Bit(candidate.colors[subblock][c]);
+                    }
+                    candidate.error += FitETCSubblock(pixels, flip, subblock, baseColor, candidate.tables[subblock], candidate.selectors);
+                }
+
+                if (candidate.error < best.error)
+                    best = candidate;
+            }
+        }
+
+        for (uint32_t c = 0u; c < 3u; ++c)
+        {
+            if (best.differential)
+                block[c] = static_cast<uint8_t>((best.colors[0][c] << 3) | ((best.colors[1][c] - best.colors[0][c]) & 0x7));
+            else
+                block[c] = static_cast<uint8_t>((best.colors[0][c] << 4) | best.colors[1][c]);
+        }
+        block[3] = static_cast<uint8_t>((best.tables[0] << 5) | (best.tables[1] << 2) | (best.differential ? 2u : 0u) | (best.flip ? 1u : 0u));
+
+        uint32_t indexBits = 0u;
+        for (uint32_t pixel = 0u; pixel < PixelCount; ++pixel)
+        {
+            const uint32_t bit = GetColumnMajorIndex(pixel);
+            indexBits |= ((best.selectors[pixel] >> 1u) << (bit + 16u)) | ((best.selectors[pixel] & 1u) << bit);
+        }
+        for (uint32_t i = 0u; i < 4u; ++i)
+            block[4u + i] = static_cast<uint8_t>(indexBits >> (24u - 8u * i));
+    }
+
+    void DecodeETC2RGBBlock(const uint8_t* block, uint8_t* pixels)
+    {
+        const bool differential = (block[3] & 2u) != 0u;
+        const bool flip = (block[3] & 1u) != 0u;
+        const uint32_t tables[2] = { uint32_t(block[3] >> 5u), uint32_t((block[3] >> 2u) & 0x7) };
+
+        int32_t baseColors[2][3];
+        for (uint32_t c = 0u; c < 3u; ++c)
+        {
+            if (differential)
+            {
+                const int32_t color = block[c] >> 3;
+                const int32_t delta = (block[c] & 0x7) >= 4 ? (block[c] & 0x7) - 8 : (block[c] & 0x7);
+                // ETC2 T, H and planar modes are not produced by encoder
+                assert(color + delta >= 0 && color + delta <= 31);
+                baseColors[0][c] = Expand5Bit(color);
+                baseColors[1][c] = Expand5Bit(color + delta);
+            }
+            else
+            {
+                baseColors[0][c] = Expand4Bit(block[c] >> 4);
+                baseColors[1][c] = Expand4Bit(block[c] & 0xF);
+            }
+        }
+
+        const uint32_t indexBits = (uint32_t(block[4]) << 24u) | (uint32_t(block[5]) << 16u) | (uint32_t(block[6]) << 8u) | uint32_t(block[7]);
+        for (uint32_t pixel = 0u; pixel < PixelCount; ++pixel)
+        {
+            const uint32_t bit = GetColumnMajorIndex(pixel);
+            const uint32_t index = (((indexBits >> (bit + 16u)) & 1u) << 1u) | ((indexBits >> bit) & 1u);
+            const uint32_t subblock = GetETCSubblock(pixel, flip);
+            const int32_t modifier = GetETCModifier(tables[subblock], index);
+            for (uint32_t c = 0u; c < 3u; ++c)
+                pixels[pixel * 4u + c] = ClampToByte(baseColors[subblock][c] + modifier);
+            pixels[pixel * 4u + 3u] = 255u;
+        }
+    }
+
+    // EAC alpha: base value plus one of eight modifiers of a table, scaled by a multiplier
+    const int32_t EACModifierTables[16][8] =
+    {
+        { -3, -6, -9, -15, 2, 5, 8, 14 },
+        { -3, -7, -10, -13, 2, 6, 9, 12 },
+        { -2, -5, -8, -13, 1, 4, 7, 12 },
+        { -2, -4, -6, -13, 1, 3, 5, 12 },
+        { -3, -6, -8, -12, 2, 5, 7, 11 },
+        { -3, -7, -9, -11, 2, 6, 8, 10 },
+        { -4, -7, -8, -11, 3, 6, 7, 10 },
+        { -3, -5, -8, -11, 2, 4, 7, 10 },
+        { -2, -6, -8, -10, 1, 5, 7, 9 },
+        { -2, -5, -8, -10, 1, 4, 7, 9 },
+        { -2, -4, -8, -10, 1, 3, 7, 9 },
+        { -2, -5, -7, -10, 1, 4, 6, 9 },
+        { -3, -4, -7, -10, 2, 3, 6, 9 },
+        { -1, -2, -3, -10, 0, 1, 2, 9 },
+        { -4, -6, -8, -9, 3, 5, 7, 8 },
+        { -3, -5, -7, -9, 2, 4, 6, 8 }
+    };
+    // table which contains a zero modifier, used for blocks with constant alpha
+    const uint32_t EACTableWithZeroModifier = 13u;
+    const uint32_t EACZeroModifierIndex = 4u;
+
+    uint32_t FitEACAlpha(const uint8_t* pixels, int32_t base, uint32_t multiplier, uint32_t table, uint8_t* selectors, uint32_t bestError)
+    {
+        uint32_t error = 0u;
+        for (uint32_t pixel = 0u; pixel < PixelCount && error < bestError; ++pixel)
+        {
+            uint32_t bestPixelError = std::numeric_limits<uint32_t>::max();
+            for (uint32_t index = 0u; index < 8u; ++index)
+            {
+                const int32_t difference = int32_t(ClampToByte(base + EACModifierTables[table][index] * int32_t(multiplier))) - int32_t(pixels[pixel * 4u + 3u]);
+                const uint32_t pixelError = static_cast<uint32_t>(difference * difference);
+                if (pixelError < bestPixelError)
+                {
+                    bestPixelError = pixelError;
+                    selectors[pixel] = static_cast<uint8_t>(index);
+                }
+            }
+            error += bestPixelError;
+        }
+        return error;
+    }
+
+    void EncodeEACAlphaBlock(const uint8_t* pixels, uint8_t* block)
+    {
+        int32_t minAlpha = 255;
+        int32_t maxAlpha = 0;
+        for (uint32_t pixel = 0u; pixel < PixelCount; ++pixel)
+        {
+            minAlpha = std::min<int32_t>(minAlpha, pixels[pixel * 4u + 3u]);
+            maxAlpha = std::max<int32_t>(maxAlpha, pixels[pixel * 4u + 3u]);
+        }
+
+        int32_t bestBase = minAlpha;
+        uint32_t bestMultiplier = 1u;
+        uint32_t bestTable = EACTableWithZeroModifier;
+        uint8_t bestSelectors[PixelCount];
+        std::fill(bestSelectors, bestSelectors + PixelCount, static_cast<uint8_t>(EACZeroModifierIndex));
+
+        if (minAlpha != maxAlpha)
+        {
+            // for every table only multipliers and base values around those which map modifier range to alpha range are tried
+            uint32_t bestError = std::numeric_limits<uint32_t>::max();
+            uint8_t selectors[PixelCount];
+            for (uint32_t table = 0u; table < 16u && bestError > 0u; ++table)
+            {
+                const int32_t minModifier = EACModifierTables[table][3];
+                const int32_t maxModifier = EACModifierTables[table][7];
+                const int32_t idealMultiplier = (maxAlpha - minAlpha + (maxModifier - minModifier) / 2) / (maxModifier - minModifier);
+                for (int32_t multiplier = std::max(1, idealMultiplier - 1); multiplier <= std::min(15, idealMultiplier + 1); ++multiplier)
+                {
+                    const int32_t idealBase = (minAlpha + maxAlpha - (minModifier + maxModifier) * multiplier) / 2;
+                    for (int32_t base = std::max(0, idealBase - 1); base <= std::min(255, idealBase + 1); ++base)
+                    {
+                        const uint32_t error = FitEACAlpha(pixels, base, multiplier, table, selectors, bestError);
+                        if (error < bestError)
+                        {
+                            bestError = error;
+                            bestBase = base;
+                            bestMultiplier = multiplier;
+                            bestTable = table;
+                            std::copy(selectors, selectors + PixelCount, bestSelectors);
+                        }
+                    }
+                }
+            }
+        }
+
+        block[0] = static_cast<uint8_t>(bestBase);
+        block[1] = static_cast<uint8_t>((bestMultiplier << 4) | bestTable);
+        uint64_t indexBits = 0u;
+        for (uint32_t pixel = 0u; pixel < PixelCount; ++pixel)
+            indexBits |= uint64_t(bestSelectors[pixel]) << (45u - 3u * GetColumnMajorIndex(pixel));
+        for (uint32_t i = 0u; i < 6u; ++i)
+            block[2u + i] = static_cast<uint8_t>(indexBits >> (40u - 8u * i));
+    }
+
+    void DecodeEACAlphaBlock(const uint8_t* block, uint8_t* pixels)
+    {
+        const int32_t base = block[0];
+        const int32_t multiplier = block[1] >> 4;
+        const uint32_t table = block[1] & 0xF;
+        uint64_t indexBits = 0u;
+        for (uint32_t i = 0u; i < 6u; ++i)
+            indexBits = (indexBits << 8u) | block[2u + i];
+
+        for (uint32_t pixel = 0u; pixel < PixelCount; ++pixel)
+        {
+            const uint32_t index = static_cast<uint32_t>(indexBits >> (45u - 3u * GetColumnMajorIndex(pixel))) & 0x7;
+            pixels[pixel * 4u + 3u] = ClampToByte(base + EACModifierTables[table][index] * multiplier);
+        }
+    }
+
+    // ASTC 4x4: fixed block layout with single partition and 4x4 weight grid, color endpoints use full 8 bit range.
+    // Block mode fields (weight range and grid size) are stored in the first 11 bits.
+    const uint32_t ASTCBlockModeRGBA = 0x042;   // 2 bit weights
+    const uint32_t ASTCBlockModeRGB = 0x053;    // 3 bit weights
+    const uint32_t ASTCEndpointModeRGB = 8u;    // LDR RGB direct
+    const uint32_t ASTCEndpointModeRGBA = 12u;  // LDR RGBA direct
+    const uint32_t ASTCEndpointsOffset = 17u;
+    // void extent blocks (single color) are not produced by encoder but can be decoded
+    const uint32_t ASTCVoidExtentBlockMode = 0x1FC;
+    const uint8_t ASTCWeights2Bit[4] = { 0, 21, 43, 64 };
+    const uint8_t ASTCWeights3Bit[8] = { 0, 9, 18, 27, 37, 46, 55, 64 };
+
+    void WriteBits(uint8_t* block, uint32_t offset, uint32_t count, uint32_t value)
+    {
+        for (uint32_t i = 0u; i < count; ++i)
+        {
+            if ((value >> i) & 1u)
+                block[(offset + i) / 8u] |= static_cast<uint8_t>(1u << ((offset + i) % 8u));
+        }
+    }
+
+    uint32_t ReadBits(const uint8_t* block, uint32_t offset, uint32_t count)
+    {
+        uint32_t value = 0u;
+        for (uint32_t i = 0u; i < count; ++i)
+            value |= ((block[(offset + i) / 8u] >> ((offset + i) % 8u)) & 1u) << i;
+        return value;
+    }
+
+    struct ASTCEndpoints
+    {
+        uint8_t colors[2][4];
+    };
+
+    uint8_t InterpolateASTC(uint8_t endpoint0, uint8_t endpoint1, uint32_t weight, bool sRGB)
+    {
+        const uint32_t expanded0 = sRGB ? (uint32_t(endpoint0) << 8u) | 0x80 : uint32_t(endpoint0) * 257u;
+        const uint32_t expanded1 = sRGB ? (uint32_t(endpoint1) << 8u) | 0x80 : uint32_t(endpoint1) * 257u;
+        return static_cast<uint8_t>(((expanded0 * (64u - weight) + expanded1 * weight + 32u) / 64u) >> 8u);
+    }
+
+    // selects weight with smallest error for every pixel and returns total error
+    uint32_t FitASTCWeights(const uint8_t* pixels, const ASTCEndpoints& endpoints, const uint8_t* weightValues, uint32_t weightCount, uint32_t componentCount, bool sRGB, uint8_t* weights)
+    {
+        uint32_t error = 0u;
+        for (uint32_t pixel = 0u; pixel < PixelCount; ++pixel)
+        {
+            uint32_t bestPixelError = std::numeric_limits<uint32_t>::max();
+            for (uint32_t weight = 0u; weight < weightCount; ++weight)
+            {
+                uint8_t color[4];
+                for (uint32_t c = 0u; c < componentCount; ++c)
+                    color[c] = InterpolateASTC(endpoints.colors[0][c], endpoints.colors[1][c], weightValues[weight], sRGB);
+                const uint32_t pixelError = GetSquaredError(color, pixels + pixel * 4u, componentCount);
+                if (pixelError < bestPixelError)
+                {
+                    bestPixelError = pixelError;
+                    weights[pixel] = static_cast<uint8_t>(weight);
+                }
+            }
+            error += bestPixelError;
+        }
+        return error;
+    }
+
+    // endpoints at extremes of pixel projections to principal axis of block colors
+    ASTCEndpoints GetASTCPrincipalAxisEndpoints(const uint8_t* pixels, uint32_t componentCount)
+    {
+        float mean[4] = {};
+        float axis[4] = {};
+        float minimum[4] = { 255.f, 255.f, 255.f, 255.f };
+        float maximum[4] = {};
+        for (uint32_t pixel = 0u; pixel < PixelCount; ++pixel)
+        {
+            for (uint32_t c = 0u; c < componentCount; ++c)
+            {
+                mean[c] += pixels[pixel * 4u + c] / float(PixelCount);
+                minimum[c] = std::min<float>(minimum[c], pixels[pixel * 4u + c]);
+                maximum[c] = std::max<float>(maximum[c], pixels[pixel * 4u + c]);
+            }
+        }
+
+        float covariance[4][4] = {};
+        for (uint32_t pixel = 0u; pixel < PixelCount; ++pixel)
+        {
+            for (uint32_t i = 0u; i < componentCount; ++i)
+                for (uint32_t j = 0u; j < componentCount; ++j)
+                    covariance[i][j] += (pixels[pixel * 4u + i] - mean[i]) * (pixels[pixel * 4u + j] - mean[j]);
+        }
+
+        // power iteration, starting with diagonal of bounding box
+        for (uint32_t c = 0u; c < componentCount; ++c)
+            axis[c] = maximum[c] - minimum[c];
+        for (uint32_t iteration = 0u; iteration < 8u; ++iteration)
+        {
+            float product[4] = {};
+            float length = 0.f;
+            for (uint32_t i = 0u; i < componentCount; ++i)
+            {
+                for (uint32_t j = 0u; j < componentCount; ++j)
+                    product[i] += covariance[i][j] * axis[j];
+                length += product[i] * product[i];
+            }
+            if (length < 1e-6f)
+                break;
+            length = std::sqrt(length);
+            for (uint32_t c = 0u; c < componentCount; ++c)
+                axis[c] = product[c] / length;
+        }
+
+        float axisLength = 0.f;
+        for (uint32_t c = 0u; c < componentCount; ++c)
+            axisLength += axis[c] * axis[c];
+        if (axisLength > 0.f)
+        {
+            axisLength = std::sqrt(axisLength);
+            for (uint32_t c = 0u; c < componentCount; ++c)
+                axis[c] /= axisLength;
+        }
+
+        float minProjection = 0.f;
+        float maxProjection = 0.f;
+        for (uint32_t pixel = 0u; pixel < PixelCount; ++pixel)
+        {
+            float projection = 0.f;
+            for (uint32_t c = 0u; c < componentCount; ++c)
+                projection += (pixels[pixel * 4u + c] - mean[c]) * axis[c];
+            minProjection = std::min(minProjection, projection);
+            maxProjection = std::max(maxProjection, projection);
+        }
+
+        ASTCEndpoints endpoints;
+        for (uint32_t c = 0u; c < 4u; ++c)
+        {
+            endpoints.colors[0][c] = c < componentCount ? ClampToByte(int32_t(std::lround(mean[c] + minProjection * axis[c]))) : 255u;
+            endpoints.colors[1][c] = c < componentCount ? ClampToByte(int32_t(std::lround(mean[c] + maxProjection * axis[c]))) : 255u;
+        }
+        return endpoints;
+    }
+
+    // least squares fit of endpoints to pixels for given weights
+    bool RefineASTCEndpoints(const uint8_t* pixels, const uint8_t* weights, const uint8_t* weightValues, uint32_t componentCount, ASTCEndpoints& endpoints)
+    {
+        float a00 = 0.f;
+        float a01 = 0.f;
+        float a11 = 0.f;
+        float b0[4] = {};
+        float b1[4] = {};
+        for (uint32_t pixel = 0u; pixel < PixelCount; ++pixel)
+        {
+            const float t = weightValues[weights[pixel]] / 64.f;
+            a00 += (1.f - t) * (1.f - t);
+            a01 += (1.f - t) * t;
+            a11 += t * t;
+            for (uint32_t c = 0u; c < componentCount; ++c)
+            {
+                b0[c] += (1.f - t) * pixels[pixel * 4u + c];
+                b1[c] += t * pixels[pixel * 4u + c];
+            }
+        }
+
+        const float determinant = a00 * a11 - a01 * a01;
+        if (std::fabs(determinant) < 1e-4f)
+            return false;
+
+        for (uint32_t c = 0u; c < componentCount; ++c)
+        {
+            endpoints.colors[0][c] = ClampToByte(int32_t(std::lround((a11 * b0[c] - a01 * b1[c]) / determinant)));
+            endpoints.colors[1][c] = ClampToByte(int32_t(std::lround((a00 * b1[c] - a01 * b0[c]) / determinant)));
+        }
+        return true;
+    }
+
+    void EncodeASTC4x4Block(const uint8_t* pixels, uint8_t* block, bool sRGB)
+    {
+        bool opaque = true;
+        for (uint32_t pixel = 0u; pixel < PixelCount; ++pixel)
+            opaque = opaque && pixels[pixel * 4u + 3u] == 255u;
+
+        // opaque blocks spend bits saved on alpha endpoints for higher weight precision
+        const uint32_t componentCount = opaque ? 3u : 4u;
+        const uint8_t* weightValues = opaque ? ASTCWeights3Bit : ASTCWeights2Bit;
+        const uint32_t weightBits = opaque ? 3u : 2u;
+        const uint32_t weightCount = 1u << weightBits;
+
+        ASTCEndpoints endpoints = GetASTCPrincipalAxisEndpoints(pixels, componentCount);
+        uint8_t weights[PixelCount];
+        uint32_t error = FitASTCWeights(pixels, endpoints, weightValues, weightCount, componentCount, sRGB, weights);
+        for (uint32_t iteration = 0u; iteration < 2u && error > 0u; ++iteration)
+        {
+            ASTCEndpoints refinedEndpoints = endpoints;
+            uint8_t refinedWeights[PixelCount];
+            if (!RefineASTCEndpoints(pixels, weights, weightValues, componentCount, refinedEndpoints))
+                break;
+            const uint32_t refinedError = FitASTCWeights(pixels, refinedEndpoints, weightValues, weightCount, componentCount, sRGB, refinedWeights);
+            if (refinedError >= error)
+                break;
+            error = refinedError;
+            endpoints = refinedEndpoints;
+            std::copy(refinedWeights, refinedWeights + PixelCount, weights);
+        }
+
+        // decoder applies blue contraction if sum of second endpoint is smaller, avoid it by swapping endpoints
+        if (endpoints.colors[1][0] + endpoints.colors[1][1] + endpoints.colors[1][2] < endpoints.colors[0][0] + endpoints.colors[0][1] + endpoints.colors[0][2])
+        {
+            std::swap(endpoints.colors[0], endpoints.colors[1]);
+            for (uint32_t pixel = 0u; pixel < PixelCount; ++pixel)
+                weights[pixel] = static_cast<uint8_t>(weightCount - 1u - weights[pixel]);
+        }
+
+        std::memset(block, 0, 16u);
+        WriteBits(block, 0u, 11u, opaque ? ASTCBlockModeRGB : ASTCBlockModeRGBA);
+        WriteBits(block, 13u, 4u, opaque ? ASTCEndpointModeRGB : ASTCEndpointModeRGBA);
+        for (uint32_t c = 0u; c < componentCount; ++c)
+        {
+            WriteBits(block, ASTCEndpointsOffset + 16u * c, 8u, endpoints.colors[0][c]);
+            WriteBits(block, ASTCEndpointsOffset + 16u * c + 8u, 8u, endpoints.colors[1][c]);
+        }
+
+        // weights are stored bit reversed from end of block
+        for (uint32_t pixel = 0u; pixel < PixelCount; ++pixel)
+        {
+            for (uint32_t bit = 0u; bit < weightBits; ++bit)
+            {
+                if ((weights[pixel] >> bit) & 1u)
+                    WriteBits(block, 127u - (pixel * weightBits + bit), 1u, 1u);
+            }
+        }
+    }
+
+    void DecodeASTC4x4Block(const uint8_t* block, uint8_t* pixels, bool sRGB)
+    {
+        if (ReadBits(block, 0u, 9u) == ASTCVoidExtentBlockMode)
+        {
+            // LDR void extent stores color as four 16 bit UNORM components in upper half of block
+            assert(ReadBits(block, 9u, 1u) == 0u);
+            for (uint32_t pixel = 0u; pixel < PixelCount; ++pixel)
+            {
+                for (uint32_t c = 0u; c < 4u; ++c)
+                    pixels[pixel * 4u + c] = static_cast<uint8_t>(ReadBits(block, 64u + 16u * c, 16u) >> 8u);
+            }
+            return;
+        }
+
+        const bool opaque = ReadBits(block, 0u, 11u) == ASTCBlockModeRGB;
+        assert(opaque || ReadBits(block, 0u, 11u) == ASTCBlockModeRGBA);
+        const uint32_t componentCount = opaque ? 3u : 4u;
+        const uint8_t* weightValues = opaque ? ASTCWeights3Bit : ASTCWeights2Bit;
+        const uint32_t weightBits = opaque ? 3u : 2u;
+
+        ASTCEndpoints endpoints;
+        for (uint32_t c = 0u; c < 4u; ++c)
+        {
+            endpoints.colors[0][c] = c < componentCount ? static_cast<uint8_t>(ReadBits(block, ASTCEndpointsOffset + 16u * c, 8u)) : 255u;
+            endpoints.colors[1][c] = c < componentCount ? static_cast<uint8_t>(ReadBits(block, ASTCEndpointsOffset + 16u * c + 8u, 8u)) : 255u;
+        }
+
+        for (uint32_t pixel = 0u; pixel < PixelCount; ++pixel)
+        {
+            uint32_t weight = 0u;
+            for (uint32_t bit = 0u; bit < weightBits; ++bit)
+                weight |= ReadBits(block, 127u - (pixel * weightBits + bit), 1u) << bit;
+            for (uint32_t c = 0u; c < componentCount; ++c)
+                pixels[pixel * 4u + c] = InterpolateASTC(endpoints.colors[0][c], endpoints.colors[1][c], weightValues[weight], sRGB);
+            if (opaque)
+                pixels[pixel * 4u + 3u] = 255u;
+        }
+    }
+}
+
+bool TextureBlockEncoder::IsFormatSupported(ramses::ETextureFormat format)
+{
+    switch (format)
+    {
+    case ramses::ETextureFormat_ETC2RGB:
+    case ramses::ETextureFormat_ETC2RGBA:
+    case ramses::ETextureFormat_ASTC_RGBA_4x4:
+    case ramses::ETextureFormat_ASTC_SRGBA_4x4:
+        return true;
+    default:
+        return false;
+    }
+}
+
+uint32_t TextureBlockEncoder::GetBlockSize(ramses::ETextureFormat format)
+{
+    assert(IsFormatSupported(format));
+    return format == ramses::ETextureFormat_ETC2RGB ? 8u : 16u;
+}
+
+uint32_t TextureBlockEncoder::GetEncodedLevelSize(ramses::ETextureFormat format, uint32_t width, uint32_t height)
+{
+    return ((width + BlockDimension - 1u) / BlockDimension) * ((height + BlockDimension - 1u) / BlockDimension) * GetBlockSize(format);
+}
+
+void TextureBlockEncoder::EncodeBlock(ramses::ETextureFormat format, const uint8_t* rgba8Pixels, uint8_t* encodedBlock)
+{
+    switch (format)
+    {
+    case ramses::ETextureFormat_ETC2RGB:
+        EncodeETC2RGBBlock(rgba8Pixels, encodedBlock);
+        break;
+    case ramses::ETextureFormat_ETC2RGBA:
+        EncodeEACAlphaBlock(rgba8Pixels, encodedBlock);
+        EncodeETC2RGBBlock(rgba8Pixels, encodedBlock + 8u);
+        break;
+    case ramses::ETextureFormat_ASTC_RGBA_4x4:
+        EncodeASTC4x4Block(rgba8Pixels, encodedBlock, false);
+        break;
+    case ramses::ETextureFormat_ASTC_SRGBA_4x4:
+        EncodeASTC4x4Block(rgba8Pixels, encodedBlock, true);
+        break;
+    default:
+        assert(false && "unsupported texture format for block encoding");
+    }
+}
+
+void TextureBlockEncoder::DecodeBlock(ramses::ETextureFormat format, const uint8_t* encodedBlock, uint8_t* rgba8Pixels)
+{
+    switch (format)
+    {
+    case ramses::ETextureFormat_ETC2RGB:
+        DecodeETC2RGBBlock(encodedBlock, rgba8Pixels);
+        break;
+    case ramses::ETextureFormat_ETC2RGBA:
+        DecodeETC2RGBBlock(encodedBlock + 8u, rgba8Pixels);
+        DecodeEACAlphaBlock(encodedBlock, rgba8Pixels);
+        break;
+    case ramses::ETextureFormat_ASTC_RGBA_4x4:
+        DecodeASTC4x4Block(encodedBlock, rgba8Pixels, false);
+        break;
+    case ramses::ETextureFormat_ASTC_SRGBA_4x4:
+        DecodeASTC4x4Block(encodedBlock, rgba8Pixels, true);
+        break;
+    default:
+        assert(false && "unsupported texture format for block decoding");
+    }
+}
+
+std::vector<TextureBlockEncoder::LevelData> TextureBlockEncoder::EncodeMipChain(ramses::ETextureFormat format, uint32_t width, uint32_t height, const std::vector<LevelData>& rgba8Levels, Statistics& statistics)
+{
+    assert(IsFormatSupported(format));
+    const auto startTime = std::chrono::steady_clock::now();
+
+    // job is a row of blocks of a level, so that also small levels at the end of chain are encoded in parallel
+    struct Job
+    {
+        uint32_t level;
+        uint32_t blockRow;
+    };
+    std::vector<Job> jobs;
+    std::vector<LevelData> encodedLevels(rgba8Levels.size());
+    uint64_t pixelCount = 0u;
+    for (uint32_t level = 0u; level < rgba8Levels.size(); ++level)
+    {
+        const uint32_t levelWidth = std::max(1u, width >> level);
+        const uint32_t levelHeight = std::max(1u, height >> level);
+        assert(rgba8Levels[level].size() == levelWidth * levelHeight * 4u);
+        encodedLevels[level].resize(GetEncodedLevelSize(format, levelWidth, levelHeight));
+        pixelCount += levelWidth * levelHeight;
+        for (uint32_t blockRow = 0u; blockRow < (levelHeight + BlockDimension - 1u) / BlockDimension; ++blockRow)
+            jobs.push_back({ level, blockRow });
+    }
+
+    // error of decoded pixels is summed up per job and all jobs are summed up after encoding, to avoid synchronization
+    const uint32_t componentCount = (format == ramses::ETextureFormat_ETC2RGB ? 3u : 4u);
+    const uint32_t blockSize = GetBlockSize(format);
+    std::vector<uint64_t> jobErrors(jobs.size(), 0u);
+    ramses_internal::ParallelJobs::Execute(static_cast<uint32_t>(jobs.size()), [&](uint32_t jobIndex)
+    {
+        const Job& job = jobs[jobIndex];
+        const uint32_t levelWidth = std::max(1u, width >> job.level);
+        const uint32_t levelHeight = std::max(1u, height >> job.level);
+        const uint32_t blocksPerRow = (levelWidth + BlockDimension - 1u) / BlockDimension;
+        const uint8_t* levelPixels = rgba8Levels[job.level].data();
+
+        for (uint32_t blockColumn = 0u; blockColumn < blocksPerRow; ++blockColumn)
+        {
+            // blocks exceeding the level are filled by repeating its last row and column
+            uint8_t pixels[BlockPixelCount * 4u];
+            for (uint32_t y = 0u; y < BlockDimension; ++y)
+            {
+                for (uint32_t x = 0u; x < BlockDimension; ++x)
+                {
+                    const uint32_t levelX = std::min(blockColumn * BlockDimension + x, levelWidth - 1u);
+                    const uint32_t levelY = std::min(job.blockRow * BlockDimension + y, levelHeight - 1u);
+                    std::memcpy(pixels + (y * BlockDimension + x) * 4u, levelPixels + (levelY * levelWidth + levelX) * 4u, 4u);
+                }
+            }
+
+            uint8_t* encodedBlock = encodedLevels[job.level].data() + (job.blockRow * blocksPerRow + blockColumn) * blockSize;
+            EncodeBlock(format, pixels, encodedBlock);
+
+            uint8_t decodedPixels[BlockPixelCount * 4u];
+            DecodeBlock(format, encodedBlock, decodedPixels);
+            for (uint32_t y = 0u; y < BlockDimension && job.blockRow * BlockDimension + y < levelHeight; ++y)
+            {
+                for (uint32_t x = 0u; x < BlockDimension && blockColumn * BlockDimension + x < levelWidth; ++x)
+                {
+                    const uint32_t pixel = y * BlockDimension + x;
+                    jobErrors[jobIndex] += GetSquaredError(pixels + pixel * 4u, decodedPixels + pixel * 4u, componentCount);
+                }
+            }
+        }
+    });
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    uint64_t squaredError = 0u;
+    for (const auto jobError : jobErrors)
+        squaredError += jobError;
+
+    const double meanSquaredError = pixelCount > 0u ? double(squaredError) / double(pixelCount * componentCount) : 0.0;
+    statistics.psnr = meanSquaredError > 0.0 ? 10.0 * std::log10(255.0 * 255.0 / meanSquaredError) : std::numeric_limits<double>::infinity();
+    statistics.megaPixelsPerSecond = seconds > 0.0 ? double(pixelCount) / seconds / 1e6 : 0.0;
+
+    return encodedLevels;
+}
@@ -0,0 +1,89 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RamsesTextureEncoderArguments.h"
+#include "TextureEncoder.h"
+#include "TextureBlockEncoder.h"
+#include "ConsoleUtils.h"
+
+#include "ramses-client-api/RamsesClient.h"
+#include "ramses-client-api/ResourceFileDescription.h"
+#include "ramses-client-api/Texture2D.h"
+#include "ramses-framework-api/RamsesFramework.h"
+#include "ramses-utils.h"
+#include "Utils/Image.h"
+
+bool TextureEncoder::Encode(const RamsesTextureEncoderArguments& arguments)
+{
+    ramses_internal::Image image;
+    image.loadFromFilePNG(arguments.getInputPngFile());
+    if (0u == image.getNumberOfPixels())
+    {
+        PRINT_ERROR("could not load PNG file: %s\n", arguments.getInputPngFile().c_str());
+        return false;
+    }
+
+    const ramses::ETextureFormat format = arguments.getTextureFormat();
+    const uint32_t width = image.getWidth();
+    const uint32_t height = image.getHeight();
+
+    std::vector<TextureBlockEncoder::LevelData> levels;
+    if (arguments.getGenerateMipMaps())
+    {
+        // levels of sRGB texture are filtered in linear color space, same as GPU would do
+        std::vector<uint8_t> data(image.getData());
+        uint32_t mipMapCount = 0u;
+        ramses::MipLevelData* mipLevelData = ramses::RamsesUtils::GenerateMipMapsTexture2D(width, height, 4u, data.data(), mipMapCount, format == ramses::ETextureFormat_ASTC_SRGBA_4x4);
+        for (uint32_t level = 0u; level < mipMapCount; ++level)
+        {
+            levels.emplace_back(mipLevelData[level].m_data, mipLevelData[level].m_data + mipLevelData[level].m_size);
+        }
+        ramses::RamsesUtils::DeleteGeneratedMipMaps(mipLevelData, mipMapCount);
+
+        if (1u == mipMapCount)
+        {
+            PRINT_HINT("mip maps can only be generated for textures with power of two size, only original level is encoded\n");
+        }
+    }
+    else
+    {
+        levels.push_back(image.getData());
+    }
+
+    TextureBlockEncoder::Statistics statistics;
+    const std::vector<TextureBlockEncoder::LevelData> encodedLevels = TextureBlockEncoder::EncodeMipChain(format, width, height, levels, statistics);
+    PRINT_INFO("encoded %ux%u texture with %u mip levels to %s: PSNR %.2f dB, %.2f megapixels per second\n",
+        width, height, static_cast<uint32_t>(encodedLevels.size()), ramses::getTextureFormatString(format), statistics.psnr, statistics.megaPixelsPerSecond);
+
+    ramses::RamsesFramework framework;
+    ramses::RamsesClient ramsesClient("ramses client", framework);
+
+    std::vector<ramses::MipLevelData> encodedMipLevelData;
+    for (const auto& level : encodedLevels)
+    {
+        encodedMipLevelData.emplace_back(static_cast<uint32_t>(level.size()), level.data());
+    }
+
+    ramses::Texture2D* texture = ramsesClient.createTexture2D(width, height, format, static_cast<uint32_t>(encodedMipLevelData.size()), encodedMipLevelData.data(), false, ramses::ResourceCacheFlag_DoNotCache, arguments.getInputPngFile().c_str());
+    if (nullptr == texture)
+    {
+        PRINT_ERROR("ramses fail to create texture from encoded data\n");
+        return false;
+    }
+
+    ramses::ResourceFileDescription resourceFileDescription(arguments.getOutputResourceFile().c_str());
+    resourceFileDescription.add(texture);
+    const ramses::status_t savingStatus = ramsesClient.saveResources(resourceFileDescription, arguments.getUseCompression());
+    if (ramses::StatusOK != savingStatus)
+    {
+        PRINT_ERROR("ramses fail to save encoded texture to output resource file: %s\n", ramsesClient.getStatusMessage(savingStatus));
+        return false;
+    }
+
+    return true;
+}
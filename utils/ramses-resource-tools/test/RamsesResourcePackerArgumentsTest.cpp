@@ -74,3 +74,18 @@ TEST(ARamsesResourcePackerArguments, reportsErrorWhenInputResourceFilesConfigIsN
     RamsesResourcePackerArguments arguments;
     EXPECT_FALSE(arguments.loadArguments(argc, argv));
 }
+
+TEST(ARamsesResourcePackerArguments, appendsToOutputResourceFileOnlyWhenRequested)
+{
+    const char* argv[] = { "program.exe", "-ir", "res/ramses-resource-tools-test.filepathesconfig", "-or", "res/ramses-resource-tools-output.res", NULL };
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+    RamsesResourcePackerArguments arguments;
+    ASSERT_TRUE(arguments.loadArguments(argc, argv));
+    EXPECT_FALSE(arguments.getAppendToOutputResourceFile());
+
+    const char* argvAppend[] = { "program.exe", "-ir", "res/ramses-resource-tools-test.filepathesconfig", "-or", "res/ramses-resource-tools-output.res", "--out-append", NULL };
+    int argcAppend = sizeof(argvAppend) / sizeof(char*) - 1;
+    RamsesResourcePackerArguments argumentsAppend;
+    ASSERT_TRUE(argumentsAppend.loadArguments(argcAppend, argvAppend));
+    EXPECT_TRUE(argumentsAppend.getAppendToOutputResourceFile());
+}
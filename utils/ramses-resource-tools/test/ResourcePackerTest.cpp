@@ -26,6 +26,9 @@
 #include "RamsesClientImpl.h"
 #include "FileUtils.h"
 #include "RamsesObjectTypeUtils.h"
+#include <fstream>
+#include <iterator>
+#include <vector>
 
 
 namespace ramses
@@ -41,6 +44,8 @@ namespace ramses
         void checkEffect(const Effect& loadedEffect);
         void checkTexture(const Texture2D& loadedTexture);
         void checkIndices(const UInt16Array& loadedIndices);
+        void saveEffectToOutputResourceFile();
+        static std::vector<char> ReadFileContent(const ramses_internal::String& fileName);
 
     private:
         void        cleanupOutputFiles();
@@ -113,6 +118,19 @@ namespace ramses
         EXPECT_EQ(StatusOK, status);
     }
 
+    void AResourcePacker::saveEffectToOutputResourceFile()
+    {
+        ResourceFileDescription resourceFileDescription(m_outputResourceFile.c_str());
+        resourceFileDescription.add(m_effect);
+        EXPECT_EQ(StatusOK, m_client.saveResources(resourceFileDescription, false));
+    }
+
+    std::vector<char> AResourcePacker::ReadFileContent(const ramses_internal::String& fileName)
+    {
+        std::ifstream file(fileName.c_str(), std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
     void AResourcePacker::RemoveFile(const ramses_internal::String& fileName)
     {
         FileUtils::RemoveFileIfExist(fileName.c_str());
@@ -189,4 +207,43 @@ namespace ramses
         const UInt16Array& loadedIndices = RamsesObjectTypeUtils::ConvertTo<UInt16Array>(*loadedResources[2]);
         checkIndices(loadedIndices);
     }
+
+    TEST_F(AResourcePacker, appendsOnlyNewResourcesToExistingOutputFile)
+    {
+        createResourceFiles();
+        saveEffectToOutputResourceFile();
+        const std::vector<char> existingContent = ReadFileContent(m_outputResourceFile);
+
+        const char* argv[] = {"program.exe", "-ir", "res/ramses-resource-tools-resourcepackerinput.filepathesconfig", "-or", m_outputResourceFile.c_str(), "-oa", NULL};
+        int         argc   = sizeof(argv) / sizeof(char*) - 1;
+
+        RamsesResourcePackerArguments arguments;
+        ASSERT_TRUE(arguments.loadArguments(argc, argv));
+        ASSERT_TRUE(ResourcePacker::Pack(arguments));
+
+        // existing content stays untouched except for offsets to HL resources and TOC in the header
+        const std::vector<char> appendedContent = ReadFileContent(m_outputResourceFile);
+        ASSERT_GT(appendedContent.size(), existingContent.size());
+        std::size_t changedBytes = 0u;
+        for (std::size_t i = 0u; i < existingContent.size(); ++i)
+        {
+            if (existingContent[i] != appendedContent[i])
+            {
+                ++changedBytes;
+            }
+        }
+        EXPECT_LE(changedBytes, 2u * sizeof(uint64_t));
+
+        RamsesClient loadedClient("ramses client", m_framework);
+
+        ResourceFileDescription resourceFileDesc(m_outputResourceFile.c_str());
+        ASSERT_TRUE(StatusOK == loadedClient.loadResources(resourceFileDesc));
+
+        const RamsesObjectVector loadedResources = loadedClient.impl.getListOfResourceObjects();
+        ASSERT_EQ(3u, loadedResources.size());
+
+        checkEffect(RamsesObjectTypeUtils::ConvertTo<Effect>(*loadedResources[0]));
+        checkTexture(RamsesObjectTypeUtils::ConvertTo<Texture2D>(*loadedResources[1]));
+        checkIndices(RamsesObjectTypeUtils::ConvertTo<UInt16Array>(*loadedResources[2]));
+    }
 }
@@ -0,0 +1,203 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "TextureBlockEncoder.h"
+#include "gtest/gtest.h"
+#include <cmath>
+
+class ATextureBlockEncoder : public ::testing::TestWithParam<ramses::ETextureFormat>
+{
+protected:
+    static TextureBlockEncoder::LevelData CreateGradient(uint32_t width, uint32_t height, bool withAlpha)
+    {
+        TextureBlockEncoder::LevelData data(width * height * 4u);
+        for (uint32_t y = 0u; y < height; ++y)
+        {
+            for (uint32_t x = 0u; x < width; ++x)
+            {
+                uint8_t* pixel = data.data() + (y * width + x) * 4u;
+                pixel[0] = static_cast<uint8_t>(128.0 + 100.0 * std::sin(x * 0.2));
+                pixel[1] = static_cast<uint8_t>(y * 255u / height);
+                pixel[2] = static_cast<uint8_t>((x + y) * 255u / (width + height));
+                pixel[3] = static_cast<uint8_t>(withAlpha ? 255u - x * 255u / width : 255u);
+            }
+        }
+        return data;
+    }
+
+    static bool HasAlpha(ramses::ETextureFormat format)
+    {
+        return format != ramses::ETextureFormat_ETC2RGB;
+    }
+};
+
+INSTANTIATE_TEST_CASE_P(EncodableFormats, ATextureBlockEncoder, ::testing::Values(
+    ramses::ETextureFormat_ETC2RGB,
+    ramses::ETextureFormat_ETC2RGBA,
+    ramses::ETextureFormat_ASTC_RGBA_4x4,
+    ramses::ETextureFormat_ASTC_SRGBA_4x4));
+
+TEST_P(ATextureBlockEncoder, computesEncodedSizeFromNumberOfBlocks)
+{
+    const uint32_t blockSize = TextureBlockEncoder::GetBlockSize(GetParam());
+    EXPECT_EQ(blockSize, TextureBlockEncoder::GetEncodedLevelSize(GetParam(), 1u, 1u));
+    EXPECT_EQ(blockSize, TextureBlockEncoder::GetEncodedLevelSize(GetParam(), 4u, 4u));
+    EXPECT_EQ(6u * blockSize, TextureBlockEncoder::GetEncodedLevelSize(GetParam(), 9u, 5u));
+}
+
+TEST_P(ATextureBlockEncoder, encodesBlockWithSingleColorAlmostExactly)
+{
+    uint8_t pixels[TextureBlockEncoder::BlockPixelCount * 4u];
+    for (uint32_t pixel = 0u; pixel < TextureBlockEncoder::BlockPixelCount; ++pixel)
+    {
+        pixels[pixel * 4u + 0u] = 200u;
+        pixels[pixel * 4u + 1u] = 30u;
+        pixels[pixel * 4u + 2u] = 90u;
+        pixels[pixel * 4u + 3u] = 77u;
+    }
+
+    uint8_t encodedBlock[16u];
+    uint8_t decodedPixels[TextureBlockEncoder::BlockPixelCount * 4u];
+    TextureBlockEncoder::EncodeBlock(GetParam(), pixels, encodedBlock);
+    TextureBlockEncoder::DecodeBlock(GetParam(), encodedBlock, decodedPixels);
+
+    for (uint32_t pixel = 0u; pixel < TextureBlockEncoder::BlockPixelCount; ++pixel)
+    {
+        for (uint32_t c = 0u; c < 3u; ++c)
+        {
+            EXPECT_NEAR(pixels[pixel * 4u + c], decodedPixels[pixel * 4u + c], 4);
+        }
+        // constant alpha is represented exactly, EAC uses zero modifier and ASTC equal endpoints
+        EXPECT_EQ(HasAlpha(GetParam()) ? 77u : 255u, decodedPixels[pixel * 4u + 3u]);
+    }
+}
+
+TEST_P(ATextureBlockEncoder, encodesAllLevelsOfMipChainWithGoodQuality)
+{
+    const uint32_t width = 64u;
+    const uint32_t height = 32u;
+    std::vector<TextureBlockEncoder::LevelData> levels;
+    for (uint32_t level = 0u; level < 7u; ++level)
+    {
+        levels.push_back(CreateGradient(std::max(1u, width >> level), std::max(1u, height >> level), HasAlpha(GetParam())));
+    }
+
+    TextureBlockEncoder::Statistics statistics;
+    const std::vector<TextureBlockEncoder::LevelData> encodedLevels = TextureBlockEncoder::EncodeMipChain(GetParam(), width, height, levels, statistics);
+
+    ASSERT_EQ(levels.size(), encodedLevels.size());
+    for (uint32_t level = 0u; level < encodedLevels.size(); ++level)
+    {
+        EXPECT_EQ(TextureBlockEncoder::GetEncodedLevelSize(GetParam(), std::max(1u, width >> level), std::max(1u, height >> level)), encodedLevels[level].size());
+    }
+    EXPECT_GT(statistics.psnr, 30.0);
+    EXPECT_GT(statistics.megaPixelsPerSecond, 0.0);
+}
+
+TEST_P(ATextureBlockEncoder, encodesLevelWithSizeNotMultipleOfBlockSizeByRepeatingEdgePixels)
+{
+    const uint32_t width = 5u;
+    const uint32_t height = 3u;
+    std::vector<TextureBlockEncoder::LevelData> levels(1u, TextureBlockEncoder::LevelData(width * height * 4u, 0u));
+    for (uint32_t y = 0u; y < height; ++y)
+    {
+        // last column differs from others and is repeated in second block
+        for (uint32_t c = 0u; c < 4u; ++c)
+        {
+            levels[0][(y * width + width - 1u) * 4u + c] = 255u;
+        }
+    }
+
+    TextureBlockEncoder::Statistics statistics;
+    const std::vector<TextureBlockEncoder::LevelData> encodedLevels = TextureBlockEncoder::EncodeMipChain(GetParam(), width, height, levels, statistics);
+    ASSERT_EQ(1u, encodedLevels.size());
+    ASSERT_EQ(2u * TextureBlockEncoder::GetBlockSize(GetParam()), encodedLevels[0].size());
+
+    uint8_t decodedPixels[TextureBlockEncoder::BlockPixelCount * 4u];
+    TextureBlockEncoder::DecodeBlock(GetParam(), encodedLevels[0].data() + TextureBlockEncoder::GetBlockSize(GetParam()), decodedPixels);
+    for (uint32_t pixel = 0u; pixel < TextureBlockEncoder::BlockPixelCount; ++pixel)
+    {
+        EXPECT_NEAR(255, decodedPixels[pixel * 4u], 4);
+    }
+    EXPECT_GT(statistics.psnr, 30.0);
+}
+
+// blocks below are assembled bit by bit following the format specifications (Khronos Data Format 1.1, ETC1/ETC2/EAC and ASTC)
+// and expected pixels are computed with the decoding equations given there, independent of encoder
+static void ExpectDecodedPixel(const uint8_t* decodedPixels, uint32_t x, uint32_t y, uint8_t r, uint8_t g, uint8_t b, uint8_t a)
+{
+    const uint8_t* pixel = decodedPixels + (y * TextureBlockEncoder::BlockDimension + x) * 4u;
+    EXPECT_EQ(r, pixel[0]) << "pixel " << x << "," << y;
+    EXPECT_EQ(g, pixel[1]) << "pixel " << x << "," << y;
+    EXPECT_EQ(b, pixel[2]) << "pixel " << x << "," << y;
+    EXPECT_EQ(a, pixel[3]) << "pixel " << x << "," << y;
+}
+
+TEST(TextureBlockDecoding, decodesETC1IndividualModeBlockAsSpecified)
+{
+    // individual mode, no flip: left 2x4 sub-block base color (0xA, 0x5, 0x0) with table 2 (9, 29),
+    // right 2x4 sub-block base color (0x3, 0xC, 0xF) with table 5 (24, 80), 4 bit colors are extended by replication.
+    // Pixel indices are stored column by column, MSBs in bits 31..16 and LSBs in bits 15..0:
+    // pixel (0,0) has index 3 (-large), pixel (3,1) index 1 (+large), all others index 0 (+small)
+    const uint8_t block[8] = { 0xA3, 0x5C, 0x0F, 0x54, 0x00, 0x01, 0x20, 0x01 };
+    uint8_t decodedPixels[TextureBlockEncoder::BlockPixelCount * 4u];
+    TextureBlockEncoder::DecodeBlock(ramses::ETextureFormat_ETC2RGB, block, decodedPixels);
+
+    ExpectDecodedPixel(decodedPixels, 0u, 0u, 0xAA - 29, 0x55 - 29, 0u, 255u);
+    ExpectDecodedPixel(decodedPixels, 1u, 0u, 0xAA + 9, 0x55 + 9, 9u, 255u);
+    ExpectDecodedPixel(decodedPixels, 0u, 3u, 0xAA + 9, 0x55 + 9, 9u, 255u);
+    ExpectDecodedPixel(decodedPixels, 3u, 1u, 0x33 + 80, 255u, 255u, 255u);
+    ExpectDecodedPixel(decodedPixels, 2u, 2u, 0x33 + 24, 0xCC + 24, 255u, 255u);
+}
+
+TEST(TextureBlockDecoding, decodesEACAlphaBlockAsSpecified)
+{
+    // base 128, multiplier 3, table 13 (-1, -2, -3, -10, 0, 1, 2, 9), 3 bit indices stored column by column from bit 47 down:
+    // pixel (0,0) has index 3, pixel (0,1) index 7, all others index 4 (zero modifier)
+    const uint8_t block[16] = { 0x80, 0x3D, 0x7E, 0x49, 0x24, 0x92, 0x49, 0x24,
+                                // opaque black ETC1 block for color
+                                0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+    uint8_t decodedPixels[TextureBlockEncoder::BlockPixelCount * 4u];
+    TextureBlockEncoder::DecodeBlock(ramses::ETextureFormat_ETC2RGBA, block, decodedPixels);
+
+    ExpectDecodedPixel(decodedPixels, 0u, 0u, 2u, 2u, 2u, 128 - 10 * 3);
+    ExpectDecodedPixel(decodedPixels, 0u, 1u, 2u, 2u, 2u, 128 + 9 * 3);
+    ExpectDecodedPixel(decodedPixels, 1u, 0u, 2u, 2u, 2u, 128u);
+    ExpectDecodedPixel(decodedPixels, 3u, 3u, 2u, 2u, 2u, 128u);
+}
+
+TEST(TextureBlockDecoding, decodesASTCSinglePartitionRGBDirectBlockAsSpecified)
+{
+    // block mode 0x053 (4x4 weight grid, 3 bit weights), single partition, endpoint mode 8 (LDR RGB direct)
+    // with 8 bit endpoints (0x00, 0x40, 0x80) and (0xFF, 0xC0, 0x90) from bit 17 on, ordered r0 r1 g0 g1 b0 b1.
+    // Weights are stored bit reversed from bit 127 down: pixel (1,1) has weight 4 (unquantized 37), pixel (3,3) weight 7 (64),
+    // all others weight 0
+    const uint8_t block[16] = { 0x53, 0x00, 0x01, 0xFE, 0x81, 0x80, 0x01, 0x21, 0x01, 0x00, 0x07, 0x00, 0x00, 0x40, 0x00, 0x00 };
+    uint8_t decodedPixels[TextureBlockEncoder::BlockPixelCount * 4u];
+    TextureBlockEncoder::DecodeBlock(ramses::ETextureFormat_ASTC_RGBA_4x4, block, decodedPixels);
+
+    ExpectDecodedPixel(decodedPixels, 0u, 0u, 0x00, 0x40, 0x80, 255u);
+    ExpectDecodedPixel(decodedPixels, 3u, 3u, 0xFF, 0xC0, 0x90, 255u);
+    // interpolation of endpoints expanded to 16 bit: (c0 * (64 - 37) + c1 * 37 + 32) / 64
+    ExpectDecodedPixel(decodedPixels, 1u, 1u, 147u, 138u, 137u, 255u);
+}
+
+TEST(TextureBlockDecoding, decodesASTCVoidExtentBlockAsSpecified)
+{
+    // void extent marker 0x1FC, LDR, reserved bits set, all extent coordinates set (no extent),
+    // followed by 16 bit UNORM color components
+    const uint8_t block[16] = { 0xFC, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x33, 0x33, 0x99, 0x99, 0xCC, 0xCC, 0x80, 0x80 };
+    uint8_t decodedPixels[TextureBlockEncoder::BlockPixelCount * 4u];
+    TextureBlockEncoder::DecodeBlock(ramses::ETextureFormat_ASTC_RGBA_4x4, block, decodedPixels);
+
+    for (uint32_t y = 0u; y < TextureBlockEncoder::BlockDimension; ++y)
+    {
+        for (uint32_t x = 0u; x < TextureBlockEncoder::BlockDimension; ++x)
+            ExpectDecodedPixel(decodedPixels, x, y, 0x33, 0x99, 0xCC, 0x80);
+    }
+}
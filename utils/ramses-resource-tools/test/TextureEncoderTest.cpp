@@ -0,0 +1,133 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2018 BMW Car IT GmbH
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RamsesTextureEncoderArguments.h"
+#include "TextureEncoder.h"
+#include "TextureBlockEncoder.h"
+#include "gtest/gtest.h"
+
+#include "ramses-framework-api/RamsesFramework.h"
+#include "ramses-client-api/RamsesClient.h"
+#include "ramses-client-api/ResourceFileDescription.h"
+#include "ramses-client-api/Texture2D.h"
+#include "RamsesClientImpl.h"
+#include "Texture2DImpl.h"
+#include "Resource/TextureResource.h"
+#include "RamsesObjectTypeUtils.h"
+#include "FileUtils.h"
+#include "Utils/Image.h"
+
+namespace ramses
+{
+    class ATextureEncoder : public ::testing::Test
+    {
+    public:
+        ATextureEncoder()
+        {
+            std::vector<uint8_t> data(16u * 8u * 4u);
+            for (uint32_t i = 0u; i < data.size(); ++i)
+            {
+                data[i] = static_cast<uint8_t>(i);
+            }
+            ramses_internal::Image(16u, 8u, std::move(data)).saveToFilePNG(m_inputPngFile);
+        }
+
+        ~ATextureEncoder()
+        {
+            FileUtils::RemoveFileIfExist(m_inputPngFile.c_str());
+            FileUtils::RemoveFileIfExist(m_outputResourceFile.c_str());
+        }
+
+    protected:
+        bool loadArguments(const char* format, bool generateMipMaps)
+        {
+            const char* argv[] = { "program.exe", "-ip", m_inputPngFile.c_str(), "-or", m_outputResourceFile.c_str(), "-tf", format, generateMipMaps ? "-gm" : NULL, NULL };
+            int argc = sizeof(argv) / sizeof(char*) - (generateMipMaps ? 1 : 2);
+            return m_arguments.loadArguments(argc, argv);
+        }
+
+        const Texture2D* loadEncodedTexture(RamsesClient& client)
+        {
+            ResourceFileDescription resourceFileDescription(m_outputResourceFile.c_str());
+            if (StatusOK != client.loadResources(resourceFileDescription))
+            {
+                return nullptr;
+            }
+
+            const RamsesObjectVector loadedResources = client.impl.getListOfResourceObjects();
+            if (1u != loadedResources.size())
+            {
+                return nullptr;
+            }
+            return &RamsesObjectTypeUtils::ConvertTo<Texture2D>(*loadedResources[0]);
+        }
+
+        const ramses_internal::String m_inputPngFile = "res/ramses-resource-tools-textureencoder.png";
+        const ramses_internal::String m_outputResourceFile = "res/ramses-resource-tools-textureencoder.res";
+        RamsesTextureEncoderArguments m_arguments;
+        RamsesFramework m_framework;
+    };
+
+    TEST_F(ATextureEncoder, loadsArgumentsWithShortAndFullFormatName)
+    {
+        ASSERT_TRUE(loadArguments("ETC2RGBA", false));
+        EXPECT_EQ(m_inputPngFile, m_arguments.getInputPngFile());
+        EXPECT_EQ(m_outputResourceFile, m_arguments.getOutputResourceFile());
+        EXPECT_EQ(ETextureFormat_ETC2RGBA, m_arguments.getTextureFormat());
+        EXPECT_FALSE(m_arguments.getGenerateMipMaps());
+        EXPECT_FALSE(m_arguments.getUseCompression());
+
+        ASSERT_TRUE(loadArguments("ETextureFormat_ASTC_SRGBA_4x4", true));
+        EXPECT_EQ(ETextureFormat_ASTC_SRGBA_4x4, m_arguments.getTextureFormat());
+        EXPECT_TRUE(m_arguments.getGenerateMipMaps());
+    }
+
+    TEST_F(ATextureEncoder, reportsErrorWhenFormatCanNotBeEncoded)
+    {
+        EXPECT_FALSE(loadArguments("RGBA8", false));
+        EXPECT_FALSE(loadArguments("ASTC_RGBA_8x8", false));
+    }
+
+    TEST_F(ATextureEncoder, reportsErrorWhenInputPngFileDoesNotExist)
+    {
+        const char* argv[] = { "program.exe", "-ip", "res/ramses-resource-tools-nonexist.png", "-or", m_outputResourceFile.c_str(), "-tf", "ETC2RGB", NULL };
+        int argc = sizeof(argv) / sizeof(char*) - 1;
+        EXPECT_FALSE(m_arguments.loadArguments(argc, argv));
+    }
+
+    TEST_F(ATextureEncoder, encodesPngToTextureInResourceFile)
+    {
+        ASSERT_TRUE(loadArguments("ASTC_RGBA_4x4", false));
+        ASSERT_TRUE(TextureEncoder::Encode(m_arguments));
+
+        RamsesClient loadedClient("ramses client", m_framework);
+        const Texture2D* texture = loadEncodedTexture(loadedClient);
+        ASSERT_TRUE(texture != nullptr);
+        EXPECT_EQ(16u, texture->getWidth());
+        EXPECT_EQ(8u, texture->getHeight());
+        EXPECT_EQ(ETextureFormat_ASTC_RGBA_4x4, texture->getTextureFormat());
+    }
+
+    TEST_F(ATextureEncoder, encodesGeneratedMipMapsOfPngToTextureInResourceFile)
+    {
+        ASSERT_TRUE(loadArguments("ETC2RGB", true));
+        ASSERT_TRUE(TextureEncoder::Encode(m_arguments));
+
+        RamsesClient loadedClient("ramses client", m_framework);
+        const Texture2D* texture = loadEncodedTexture(loadedClient);
+        ASSERT_TRUE(texture != nullptr);
+        EXPECT_EQ(ETextureFormat_ETC2RGB, texture->getTextureFormat());
+
+        const ramses_internal::TextureResource* resource = loadedClient.impl.getResourceData<ramses_internal::TextureResource>(texture->impl.getLowlevelResourceHash());
+        ASSERT_TRUE(resource != nullptr);
+        const ramses_internal::MipDataSizeVector& mipSizes = resource->getMipDataSizes();
+        ASSERT_EQ(5u, mipSizes.size());
+        EXPECT_EQ(TextureBlockEncoder::GetEncodedLevelSize(ETextureFormat_ETC2RGB, 16u, 8u), mipSizes[0]);
+        EXPECT_EQ(TextureBlockEncoder::GetEncodedLevelSize(ETextureFormat_ETC2RGB, 1u, 1u), mipSizes[4]);
+    }
+}
@@ -299,6 +299,7 @@ void EffectConfig::initAttributeSemanticNameTable()
 {
     m_attributeSemanticNameTable.put("EEffectAttributeSemantic_TextPositions", ramses::EEffectAttributeSemantic_TextPositions);
     m_attributeSemanticNameTable.put("EEffectAttributeSemantic_TextTextureCoordinates", ramses::EEffectAttributeSemantic_TextTextureCoordinates);
+    m_attributeSemanticNameTable.put("EEffectAttributeSemantic_InstanceWorldMatrix", ramses::EEffectAttributeSemantic_InstanceWorldMatrix);
 }
 
 void EffectConfig::clear()